@@ -326,6 +326,7 @@ void Engine::startup_begin() {
 void Engine::startup_benchmark_begin_measure(const String &p_what) {
 	startup_benchmark_section = p_what;
 	startup_benchmark_from = OS::get_singleton()->get_ticks_usec();
+	startup_benchmark_lap_from = startup_benchmark_from;
 }
 void Engine::startup_benchmark_end_measure() {
 	uint64_t total = OS::get_singleton()->get_ticks_usec() - startup_benchmark_from;
@@ -334,6 +335,16 @@ void Engine::startup_benchmark_end_measure() {
 	startup_benchmark_json[startup_benchmark_section] = total_f;
 }
 
+// Records the time spent since the previous lap (or the start of the current section)
+// as a sub-phase of the current section.
+void Engine::startup_benchmark_lap(const String &p_what) {
+	uint64_t now = OS::get_singleton()->get_ticks_usec();
+	double total_f = double(now - startup_benchmark_lap_from) / double(1000000);
+	startup_benchmark_lap_from = now;
+
+	startup_benchmark_json[startup_benchmark_section + "/" + p_what] = total_f;
+}
+
 void Engine::startup_dump(const String &p_to_file) {
 	uint64_t total = OS::get_singleton()->get_ticks_usec() - startup_benchmark_total_from;
 	double total_f = double(total) / double(1000000);
@@ -86,6 +86,7 @@ private:
 	Dictionary startup_benchmark_json;
 	String startup_benchmark_section;
 	uint64_t startup_benchmark_from = 0;
+	uint64_t startup_benchmark_lap_from = 0;
 	uint64_t startup_benchmark_total_from = 0;
 
 public:
@@ -166,6 +167,7 @@ public:
 	void startup_begin();
 	void startup_benchmark_begin_measure(const String &p_what);
 	void startup_benchmark_end_measure();
+	void startup_benchmark_lap(const String &p_what);
 	void startup_dump(const String &p_to_file);
 
 	Engine();
@@ -274,6 +274,8 @@ String ProjectSettings::globalize_path(const String &p_path) const {
 bool ProjectSettings::_set(const StringName &p_name, const Variant &p_value) {
 	_THREAD_SAFE_METHOD_
 
+	version.increment();
+
 	if (p_value.get_type() == Variant::NIL) {
 		props.erase(p_name);
 		if (p_name.operator String().begins_with("autoload/")) {
@@ -411,6 +413,33 @@ void ProjectSettings::_get_property_list(List<PropertyInfo> *p_list) const {
 	}
 }
 
+// Same order as the property list, without building the whole list.
+void ProjectSettings::get_settings_with_prefix(const String &p_prefix, List<String> *r_settings) const {
+	_THREAD_SAFE_METHOD_
+
+	RBSet<_VCSort> vclist;
+
+	for (const KeyValue<StringName, VariantContainer> &E : props) {
+		if (E.value.hide_from_editor) {
+			continue;
+		}
+
+		String name = E.key;
+		if (!name.begins_with(p_prefix)) {
+			continue;
+		}
+
+		_VCSort vc;
+		vc.name = name;
+		vc.order = E.value.order;
+		vclist.insert(vc);
+	}
+
+	for (const _VCSort &E : vclist) {
+		r_settings->push_back(E.name);
+	}
+}
+
 bool ProjectSettings::_load_resource_pack(const String &p_pack, bool p_replace_files, int p_offset) {
 	if (PackedData::get_singleton()->is_disabled()) {
 		return false;
@@ -440,6 +469,7 @@ void ProjectSettings::_convert_to_last_version(int p_from_version) {
 				action["deadzone"] = Variant(0.5f);
 				action["events"] = array;
 				E.value.variant = action;
+				version.increment();
 			}
 		}
 	}
@@ -790,6 +820,7 @@ bool ProjectSettings::is_builtin_setting(const String &p_name) const {
 void ProjectSettings::clear(const String &p_name) {
 	ERR_FAIL_COND_MSG(!props.has(p_name), "Request for nonexistent project setting: " + p_name + ".");
 	props.erase(p_name);
+	version.increment();
 }
 
 Error ProjectSettings::save() {
@@ -1197,6 +1228,8 @@ void ProjectSettings::_add_builtin_input_map() {
 }
 
 ProjectSettings::ProjectSettings() {
+	version.set(1);
+
 	// Initialization of engine variables should be done in the setup() method,
 	// so that the values can be overridden from project.godot or project.binary.
 
@@ -1280,6 +1313,8 @@ ProjectSettings::ProjectSettings() {
 	GLOBAL_DEF("debug/disable_touch", false);
 	GLOBAL_DEF("debug/settings/profiler/max_functions", 16384);
 	custom_prop_info["debug/settings/profiler/max_functions"] = PropertyInfo(Variant::INT, "debug/settings/profiler/max_functions", PROPERTY_HINT_RANGE, "128,65535,1");
+	GLOBAL_DEF("debug/settings/profiler/frame_interval", 1);
+	custom_prop_info["debug/settings/profiler/frame_interval"] = PropertyInfo(Variant::INT, "debug/settings/profiler/frame_interval", PROPERTY_HINT_RANGE, "1,60,1");
 
 	GLOBAL_DEF("compression/formats/zstd/long_distance_matching", Compression::zstd_long_distance_matching);
 	custom_prop_info["compression/formats/zstd/long_distance_matching"] = PropertyInfo(Variant::BOOL, "compression/formats/zstd/long_distance_matching");
@@ -1309,6 +1344,9 @@ ProjectSettings::ProjectSettings() {
 	GLOBAL_DEF("rendering/rendering_device/staging_buffer/max_size_mb", 128);
 	GLOBAL_DEF("rendering/rendering_device/staging_buffer/texture_upload_region_size_px", 64);
 	GLOBAL_DEF("rendering/rendering_device/vulkan/max_descriptors_per_pool", 64);
+	GLOBAL_DEF("rendering/rendering_device/pipeline_cache/enable", true);
+	GLOBAL_DEF("rendering/rendering_device/pipeline_cache/save_chunk_size_mb", 3.0);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/rendering_device/pipeline_cache/save_chunk_size_mb", PropertyInfo(Variant::FLOAT, "rendering/rendering_device/pipeline_cache/save_chunk_size_mb", PROPERTY_HINT_RANGE, "0.000001,64.0,0.001,or_greater"));
 
 	// These properties will not show up in the dialog nor in the documentation. If you want to exclude whole groups, see _get_property_list() method.
 	GLOBAL_DEF_INTERNAL("application/config/features", PackedStringArray());
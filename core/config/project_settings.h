@@ -32,9 +32,11 @@
 #define PROJECT_SETTINGS_H
 
 #include "core/object/class_db.h"
+#include "core/os/mutex.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/rb_set.h"
+#include "core/templates/safe_refcount.h"
 
 class ProjectSettings : public Object {
 	GDCLASS(ProjectSettings, Object);
@@ -102,6 +104,9 @@ protected:
 
 	String project_data_dir_name;
 
+	// Bumped whenever a setting changes, so GLOBAL_GET_CACHED knows when to read it again.
+	SafeNumeric<uint32_t> version;
+
 	bool _set(const StringName &p_name, const Variant &p_value);
 	bool _get(const StringName &p_name, Variant &r_ret) const;
 	void _get_property_list(List<PropertyInfo> *p_list) const;
@@ -142,6 +147,8 @@ public:
 
 	void set_setting(const String &p_setting, const Variant &p_value);
 	Variant get_setting(const String &p_setting) const;
+	void get_settings_with_prefix(const String &p_prefix, List<String> *r_settings) const;
+	uint32_t get_version() const { return version.get(); }
 
 	bool has_setting(String p_var) const;
 	String localize_path(const String &p_path) const;
@@ -205,6 +212,22 @@ Variant _GLOBAL_DEF(const String &p_var, const Variant &p_default, bool p_restar
 #define GLOBAL_DEF_RST_NOVAL(m_var, m_value) _GLOBAL_DEF(m_var, m_value, true, true)
 #define GLOBAL_GET(m_var) ProjectSettings::get_singleton()->get(m_var)
 
+// Caches the value at the call site and only reads the setting again after a setting has changed.
+// Meant for code that reads a setting every frame, avoids building a StringName and looking it up.
+#define GLOBAL_GET_CACHED(m_type, m_var) ([](const char *p_name) -> m_type {                                                        \
+	static_assert(std::is_trivially_destructible<m_type>::value, "GLOBAL_GET_CACHED must use a trivial type that allows static lifetime."); \
+	static m_type local_var;                                                                                                         \
+	static uint32_t local_version = 0;                                                                                               \
+	static Mutex local_mutex;                                                                                                        \
+	uint32_t new_version = ProjectSettings::get_singleton()->get_version();                                                          \
+	MutexLock lock(local_mutex);                                                                                                     \
+	if (local_version != new_version) {                                                                                              \
+		local_version = new_version;                                                                                                 \
+		local_var = ProjectSettings::get_singleton()->get_setting(p_name);                                                           \
+	}                                                                                                                                \
+	return local_var;                                                                                                                \
+})(m_var)
+
 #define GLOBAL_DEF_BASIC(m_var, m_value) _GLOBAL_DEF(m_var, m_value, false, false, true)
 #define GLOBAL_DEF_RST_BASIC(m_var, m_value) _GLOBAL_DEF(m_var, m_value, true, false, true)
 #define GLOBAL_DEF_NOVAL_BASIC(m_var, m_value) _GLOBAL_DEF(m_var, m_value, false, true, true)
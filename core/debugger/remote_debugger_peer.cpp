@@ -31,9 +31,13 @@
 #include "remote_debugger_peer.h"
 
 #include "core/config/project_settings.h"
+#include "core/io/compression.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
 
+// Set in the size prefix of messages whose payload is the decoded size followed by Zstd data.
+#define PACKET_COMPRESSED_BIT 0x80000000
+
 bool RemoteDebuggerPeerTCP::is_peer_connected() {
 	return connected;
 }
@@ -76,6 +80,7 @@ RemoteDebuggerPeerTCP::RemoteDebuggerPeerTCP(Ref<StreamPeerTCP> p_tcp) {
 	// This means remote debugger takes 16 MiB just because it exists...
 	in_buf.resize((8 << 20) + 4); // 8 MiB should be way more than enough (need 4 extra bytes for encoding packet size).
 	out_buf.resize(8 << 20); // 8 MiB should be way more than enough
+	compression_threshold = GLOBAL_GET("network/limits/debugger/compression_threshold");
 	tcp_client = p_tcp;
 	if (tcp_client.is_valid()) { // Attaching to an already connected stream.
 		connected = true;
@@ -104,10 +109,27 @@ void RemoteDebuggerPeerTCP::_write_out() {
 			int size = 0;
 			Error err = encode_variant(var, nullptr, size);
 			ERR_CONTINUE(err != OK || size > out_buf.size() - 4); // 4 bytes separator.
-			encode_uint32(size, buf);
-			encode_variant(var, buf + 4, size);
-			out_left = size + 4;
+			out_left = 0;
 			out_pos = 0;
+			if (compression_threshold > 0 && size >= compression_threshold && Compression::get_max_compressed_buffer_size(size, Compression::MODE_ZSTD) <= out_buf.size() - 8) {
+				// Large messages (mostly profiler frames) are worth compressing, this runs on the peer thread.
+				compression_buf.resize(size);
+				encode_variant(var, compression_buf.ptrw(), size);
+				int compressed_size = Compression::compress(buf + 8, compression_buf.ptr(), size, Compression::MODE_ZSTD);
+				if (compressed_size > 0 && compressed_size < size) {
+					encode_uint32(uint32_t(compressed_size + 4) | PACKET_COMPRESSED_BIT, buf);
+					encode_uint32(size, buf + 4);
+					out_left = compressed_size + 8;
+				} else {
+					encode_uint32(size, buf);
+					memcpy(buf + 4, compression_buf.ptr(), size);
+					out_left = size + 4;
+				}
+			} else {
+				encode_uint32(size, buf);
+				encode_variant(var, buf + 4, size);
+				out_left = size + 4;
+			}
 		}
 		int sent = 0;
 		tcp_client->put_partial_data(buf + out_pos, out_left, sent);
@@ -129,6 +151,8 @@ void RemoteDebuggerPeerTCP::_read_in() {
 			uint32_t size = 0;
 			int read = 0;
 			Error err = tcp_client->get_partial_data((uint8_t *)&size, 4, read);
+			in_compressed = size & PACKET_COMPRESSED_BIT;
+			size &= ~PACKET_COMPRESSED_BIT;
 			ERR_CONTINUE(read != 4 || err != OK || size > (uint32_t)in_buf.size());
 			in_left = size;
 			in_pos = 0;
@@ -138,9 +162,20 @@ void RemoteDebuggerPeerTCP::_read_in() {
 		in_left -= read;
 		in_pos += read;
 		if (in_left == 0) {
+			const uint8_t *data = buf;
+			int data_size = in_pos;
+			if (in_compressed) {
+				ERR_CONTINUE(in_pos < 4);
+				data_size = decode_uint32(buf);
+				ERR_CONTINUE(data_size > in_buf.size());
+				compression_buf.resize(data_size);
+				int decompressed = Compression::decompress(compression_buf.ptrw(), data_size, buf + 4, in_pos - 4, Compression::MODE_ZSTD);
+				ERR_CONTINUE_MSG(decompressed != data_size, "Malformed packet received, decompression failed.");
+				data = compression_buf.ptr();
+			}
 			Variant var;
-			Error err = decode_variant(var, buf, in_pos, &read);
-			ERR_CONTINUE(read != in_pos || err != OK);
+			Error err = decode_variant(var, data, data_size, &read);
+			ERR_CONTINUE(read != data_size || err != OK);
 			ERR_CONTINUE_MSG(var.get_type() != Variant::ARRAY, "Malformed packet received, not an Array.");
 			mutex.lock();
 			in_queue.push_back(var);
@@ -66,7 +66,11 @@ private:
 	Vector<uint8_t> out_buf;
 	int in_left = 0;
 	int in_pos = 0;
+	bool in_compressed = false;
 	Vector<uint8_t> in_buf;
+	// Scratch space for messages going through Zstd, only allocated once compression is used.
+	Vector<uint8_t> compression_buf;
+	int compression_threshold = 0;
 	bool connected = false;
 	bool running = false;
 
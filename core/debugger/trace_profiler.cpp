@@ -0,0 +1,153 @@
+/*************************************************************************/
+/*  trace_profiler.cpp                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "trace_profiler.h"
+
+#include "core/io/file_access.h"
+#include "core/os/mutex.h"
+#include "core/os/spin_lock.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+
+// Events are collected per thread and streamed to the file in batches of this size.
+static const uint32_t TRACE_FLUSH_THRESHOLD = 4096;
+
+struct TraceEvent {
+	const char *name = nullptr;
+	uint64_t begin_usec = 0;
+	uint64_t end_usec = 0;
+};
+
+struct TraceThreadBuffer {
+	SpinLock lock;
+	uint32_t index = 0;
+	Thread::ID thread_id = 0;
+	LocalVector<TraceEvent> events;
+};
+
+SafeFlag TraceProfiler::active;
+
+static Mutex trace_mutex;
+static Ref<FileAccess> trace_file;
+static uint64_t trace_start_usec = 0;
+// Buffers are never freed, a zone may still be closing on another thread while the trace stops.
+static LocalVector<TraceThreadBuffer *> trace_buffers;
+static thread_local TraceThreadBuffer *trace_thread_buffer = nullptr;
+
+// Must be called with trace_mutex held.
+static void _trace_write_events(uint32_t p_thread_index, const LocalVector<TraceEvent> &p_events) {
+	if (trace_file.is_null()) {
+		return;
+	}
+	for (uint32_t i = 0; i < p_events.size(); i++) {
+		const TraceEvent &e = p_events[i];
+		// Events from before the (re)start of the trace are dropped.
+		if (e.begin_usec < trace_start_usec) {
+			continue;
+		}
+		trace_file->store_string(vformat(",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%d,\"dur\":%d}", String(e.name).json_escape(), p_thread_index, e.begin_usec - trace_start_usec, e.end_usec - e.begin_usec));
+	}
+}
+
+// Must be called with trace_mutex held.
+static void _trace_write_thread_name(const TraceThreadBuffer *p_buffer) {
+	if (trace_file.is_null()) {
+		return;
+	}
+	String thread_name = p_buffer->thread_id == Thread::get_main_id() ? String("Main Thread") : vformat("Thread %d", p_buffer->index);
+	trace_file->store_string(vformat(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", p_buffer->index, thread_name));
+}
+
+void TraceProfiler::_add_event(const char *p_name, uint64_t p_begin_usec, uint64_t p_end_usec) {
+	if (unlikely(!trace_thread_buffer)) {
+		TraceThreadBuffer *buffer = memnew(TraceThreadBuffer);
+		buffer->thread_id = Thread::get_caller_id();
+		MutexLock lock(trace_mutex);
+		buffer->index = trace_buffers.size();
+		trace_buffers.push_back(buffer);
+		_trace_write_thread_name(buffer);
+		trace_thread_buffer = buffer;
+	}
+
+	TraceThreadBuffer *buffer = trace_thread_buffer;
+	TraceEvent e;
+	e.name = p_name;
+	e.begin_usec = p_begin_usec;
+	e.end_usec = p_end_usec;
+	buffer->lock.lock();
+	buffer->events.push_back(e);
+	bool full = buffer->events.size() >= TRACE_FLUSH_THRESHOLD;
+	buffer->lock.unlock();
+
+	if (full) {
+		// Same lock order as stop(), the global mutex first.
+		MutexLock lock(trace_mutex);
+		buffer->lock.lock();
+		_trace_write_events(buffer->index, buffer->events);
+		buffer->events.clear();
+		buffer->lock.unlock();
+	}
+}
+
+Error TraceProfiler::start(const String &p_path) {
+	MutexLock lock(trace_mutex);
+	ERR_FAIL_COND_V_MSG(trace_file.is_valid(), ERR_ALREADY_IN_USE, "A trace is already being recorded.");
+
+	Error err;
+	trace_file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Can't open trace file for writing: " + p_path);
+
+	// The metadata event keeps every following event able to start with a comma.
+	trace_file->store_string("[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Godot\"}}");
+	for (uint32_t i = 0; i < trace_buffers.size(); i++) {
+		_trace_write_thread_name(trace_buffers[i]);
+	}
+	trace_start_usec = OS::get_singleton()->get_ticks_usec();
+	active.set();
+	return OK;
+}
+
+void TraceProfiler::stop() {
+	if (!active.is_set()) {
+		return;
+	}
+	active.clear();
+
+	MutexLock lock(trace_mutex);
+	for (uint32_t i = 0; i < trace_buffers.size(); i++) {
+		TraceThreadBuffer *buffer = trace_buffers[i];
+		buffer->lock.lock();
+		_trace_write_events(buffer->index, buffer->events);
+		buffer->events.clear();
+		buffer->lock.unlock();
+	}
+	trace_file->store_string("\n]\n");
+	trace_file.unref();
+}
@@ -0,0 +1,78 @@
+/*************************************************************************/
+/*  trace_profiler.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TRACE_PROFILER_H
+#define TRACE_PROFILER_H
+
+#include "core/os/os.h"
+#include "core/templates/safe_refcount.h"
+
+// Scoped CPU timing zones, written as a Chrome/Perfetto JSON trace when started
+// with a file (see the `--trace-file` command line argument).
+// Zones only exist in builds made with `trace_zones=yes`, they compile to nothing otherwise.
+class TraceProfiler {
+	static SafeFlag active;
+
+	static void _add_event(const char *p_name, uint64_t p_begin_usec, uint64_t p_end_usec);
+
+public:
+	class Zone {
+		const char *name = nullptr;
+		uint64_t begin_usec = 0;
+
+	public:
+		// Names are expected to be string literals, they are stored as is.
+		_FORCE_INLINE_ Zone(const char *p_name) {
+			if (active.is_set()) {
+				name = p_name;
+				begin_usec = OS::get_singleton()->get_ticks_usec();
+			}
+		}
+		_FORCE_INLINE_ ~Zone() {
+			if (name) {
+				_add_event(name, begin_usec, OS::get_singleton()->get_ticks_usec());
+			}
+		}
+	};
+
+	static Error start(const String &p_path);
+	static void stop();
+	_FORCE_INLINE_ static bool is_active() { return active.is_set(); }
+};
+
+#ifdef TRACE_ZONES_ENABLED
+#define _TRACE_ZONE_NAME(m_line) _trace_zone_##m_line
+#define _TRACE_ZONE_DECLARE(m_name, m_line) TraceProfiler::Zone _TRACE_ZONE_NAME(m_line)(m_name)
+#define TRACE_ZONE(m_name) _TRACE_ZONE_DECLARE(m_name, __LINE__)
+#else
+#define TRACE_ZONE(m_name)
+#endif
+
+#endif // TRACE_PROFILER_H
@@ -836,6 +836,21 @@ static void gdnative_object_method_bind_ptrcall(GDNativeMethodBindPtr p_method_b
 	mb->ptrcall(o, (const void **)p_args, p_ret);
 }
 
+static void gdnative_object_method_bind_ptrcall_batch(GDNativeMethodBindPtr p_method_bind, const GDNativeObjectPtr *p_instances, GDNativeConstTypePtr *p_args, const GDNativeInt *p_arg_strides, GDNativeTypePtr r_rets, GDNativeInt p_ret_stride, GDNativeInt p_count) {
+	const MethodBind *mb = reinterpret_cast<const MethodBind *>(p_method_bind);
+	ERR_FAIL_COND(mb->has_return() && r_rets == nullptr);
+
+	const int argc = mb->get_argument_count();
+	const void **args = (const void **)alloca(sizeof(void *) * MAX(argc, 1));
+	for (GDNativeInt i = 0; i < p_count; i++) {
+		for (int j = 0; j < argc; j++) {
+			args[j] = (const uint8_t *)p_args[j] + p_arg_strides[j] * i;
+		}
+		void *ret = r_rets ? (uint8_t *)r_rets + p_ret_stride * i : nullptr;
+		mb->ptrcall((Object *)p_instances[i], args, ret);
+	}
+}
+
 static void gdnative_object_destroy(GDNativeObjectPtr p_o) {
 	memdelete((Object *)p_o);
 }
@@ -1047,6 +1062,7 @@ void gdnative_setup_interface(GDNativeInterface *p_interface) {
 
 	gdni.object_method_bind_call = gdnative_object_method_bind_call;
 	gdni.object_method_bind_ptrcall = gdnative_object_method_bind_ptrcall;
+	gdni.object_method_bind_ptrcall_batch = gdnative_object_method_bind_ptrcall_batch;
 	gdni.object_destroy = gdnative_object_destroy;
 	gdni.global_get_singleton = gdnative_global_get_singleton;
 	gdni.object_get_instance_binding = gdnative_object_get_instance_binding;
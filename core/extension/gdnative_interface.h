@@ -539,6 +539,9 @@ typedef struct {
 
 	void (*object_method_bind_call)(GDNativeMethodBindPtr p_method_bind, GDNativeObjectPtr p_instance, GDNativeConstVariantPtr *p_args, GDNativeInt p_arg_count, GDNativeVariantPtr r_ret, GDNativeCallError *r_error);
 	void (*object_method_bind_ptrcall)(GDNativeMethodBindPtr p_method_bind, GDNativeObjectPtr p_instance, GDNativeConstTypePtr *p_args, GDNativeTypePtr r_ret);
+	/* Calls the method on p_count instances. Argument i of call n is read from p_args[i] + n * p_arg_strides[i] (in bytes), and the return value of call n
+	 * is written to r_rets + n * p_ret_stride. A stride of 0 passes the same value to every call. r_rets can be NULL if the method returns nothing. */
+	void (*object_method_bind_ptrcall_batch)(GDNativeMethodBindPtr p_method_bind, const GDNativeObjectPtr *p_instances, GDNativeConstTypePtr *p_args, const GDNativeInt *p_arg_strides, GDNativeTypePtr r_rets, GDNativeInt p_ret_stride, GDNativeInt p_count);
 	void (*object_destroy)(GDNativeObjectPtr p_o);
 	GDNativeObjectPtr (*global_get_singleton)(GDNativeConstStringNamePtr p_name);
 
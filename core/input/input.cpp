@@ -136,6 +136,7 @@ void Input::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_use_accumulated_input", "enable"), &Input::set_use_accumulated_input);
 	ClassDB::bind_method(D_METHOD("is_using_accumulated_input"), &Input::is_using_accumulated_input);
 	ClassDB::bind_method(D_METHOD("flush_buffered_events"), &Input::flush_buffered_events);
+	ClassDB::bind_method(D_METHOD("get_last_event_timestamp"), &Input::get_last_event_timestamp);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "mouse_mode"), "set_mouse_mode", "get_mouse_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_accumulated_input"), "set_use_accumulated_input", "is_using_accumulated_input");
@@ -173,15 +174,11 @@ void Input::get_argument_options(const StringName &p_function, int p_idx, List<S
 	if ((p_idx == 0 && (pf == "is_action_pressed" || pf == "action_press" || pf == "action_release" || pf == "is_action_just_pressed" || pf == "is_action_just_released" || pf == "get_action_strength" || pf == "get_action_raw_strength")) ||
 			(p_idx < 2 && pf == "get_axis") ||
 			(p_idx < 4 && pf == "get_vector")) {
-		List<PropertyInfo> pinfo;
-		ProjectSettings::get_singleton()->get_property_list(&pinfo);
+		List<String> settings;
+		ProjectSettings::get_singleton()->get_settings_with_prefix("input/", &settings);
 
-		for (const PropertyInfo &pi : pinfo) {
-			if (!pi.name.begins_with("input/")) {
-				continue;
-			}
-
-			String name = pi.name.substr(pi.name.find("/") + 1, pi.name.length());
+		for (const String &setting : settings) {
+			String name = setting.substr(setting.find("/") + 1, setting.length());
 			r_options->push_back(name.quote());
 		}
 	}
@@ -863,30 +860,50 @@ void Input::set_custom_mouse_cursor(const Ref<Resource> &p_cursor, CursorShape p
 }
 
 void Input::parse_input_event(const Ref<InputEvent> &p_event) {
+	parse_input_event_at(p_event, OS::get_singleton()->get_ticks_usec());
+}
+
+// Used by platforms which know when the event was received, e.g. from an event polling thread.
+void Input::parse_input_event_at(const Ref<InputEvent> &p_event, uint64_t p_timestamp) {
 	_THREAD_SAFE_METHOD_
 
 	ERR_FAIL_COND(p_event.is_null());
 
 	if (use_accumulated_input) {
-		if (buffered_events.is_empty() || !buffered_events.back()->get()->accumulate(p_event)) {
-			buffered_events.push_back(p_event);
+		if (buffered_events.is_empty() || !buffered_events.back()->get().event->accumulate(p_event)) {
+			buffered_events.push_back({ p_event, p_timestamp });
+		} else {
+			// The accumulated event stands for the most recent state.
+			buffered_events.back()->get().timestamp = MAX(buffered_events.back()->get().timestamp, p_timestamp);
 		}
 	} else if (use_input_buffering) {
-		buffered_events.push_back(p_event);
+		buffered_events.push_back({ p_event, p_timestamp });
 	} else {
+		last_event_timestamp = p_timestamp;
 		_parse_input_event_impl(p_event, false);
 	}
 }
 
 void Input::flush_buffered_events() {
+	flush_buffered_events_until(UINT64_MAX);
+}
+
+// Only sends the events received up to the given time, so events buffered during a long frame
+// can be spread over the physics ticks that ran during it.
+void Input::flush_buffered_events_until(uint64_t p_timestamp) {
 	_THREAD_SAFE_METHOD_
 
-	while (buffered_events.front()) {
-		_parse_input_event_impl(buffered_events.front()->get(), false);
+	while (buffered_events.front() && buffered_events.front()->get().timestamp <= p_timestamp) {
+		last_event_timestamp = buffered_events.front()->get().timestamp;
+		_parse_input_event_impl(buffered_events.front()->get().event, false);
 		buffered_events.pop_front();
 	}
 }
 
+uint64_t Input::get_last_event_timestamp() const {
+	return last_event_timestamp;
+}
+
 bool Input::is_using_input_buffering() {
 	return use_input_buffering;
 }
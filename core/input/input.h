@@ -221,7 +221,13 @@ private:
 
 	void _parse_input_event_impl(const Ref<InputEvent> &p_event, bool p_is_emulated);
 
-	List<Ref<InputEvent>> buffered_events;
+	struct BufferedEvent {
+		Ref<InputEvent> event;
+		uint64_t timestamp = 0; // When the event was received, in microseconds since engine start.
+	};
+
+	List<BufferedEvent> buffered_events;
+	uint64_t last_event_timestamp = 0;
 
 	friend class DisplayServer;
 
@@ -279,6 +285,7 @@ public:
 	Point2i warp_mouse_motion(const Ref<InputEventMouseMotion> &p_motion, const Rect2 &p_rect);
 
 	void parse_input_event(const Ref<InputEvent> &p_event);
+	void parse_input_event_at(const Ref<InputEvent> &p_event, uint64_t p_timestamp);
 
 	void set_gravity(const Vector3 &p_gravity);
 	void set_accelerometer(const Vector3 &p_accel);
@@ -322,6 +329,8 @@ public:
 	void set_fallback_mapping(String p_guid);
 
 	void flush_buffered_events();
+	void flush_buffered_events_until(uint64_t p_timestamp);
+	uint64_t get_last_event_timestamp() const;
 	bool is_using_input_buffering();
 	void set_use_input_buffering(bool p_enable);
 	void set_use_accumulated_input(bool p_enable);
@@ -247,17 +247,13 @@ const HashMap<StringName, InputMap::Action> &InputMap::get_action_map() const {
 void InputMap::load_from_project_settings() {
 	input_map.clear();
 
-	List<PropertyInfo> pinfo;
-	ProjectSettings::get_singleton()->get_property_list(&pinfo);
+	List<String> settings;
+	ProjectSettings::get_singleton()->get_settings_with_prefix("input/", &settings);
 
-	for (const PropertyInfo &pi : pinfo) {
-		if (!pi.name.begins_with("input/")) {
-			continue;
-		}
-
-		String name = pi.name.substr(pi.name.find("/") + 1, pi.name.length());
+	for (const String &setting : settings) {
+		String name = setting.substr(setting.find("/") + 1, setting.length());
 
-		Dictionary action = GLOBAL_GET(pi.name);
+		Dictionary action = GLOBAL_GET(setting);
 		float deadzone = action.has("deadzone") ? (float)action["deadzone"] : 0.5f;
 		Array events = action["events"];
 
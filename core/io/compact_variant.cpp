@@ -0,0 +1,1107 @@
+/*************************************************************************/
+/*  compact_variant.cpp                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "compact_variant.h"
+
+#include "core/io/marshalls.h"
+#include "core/variant/binder_common.h"
+
+static const uint8_t COMPACT_VARIANT_MAGIC[4] = { 'G', 'D', 'C', 'V' };
+
+enum {
+	// The low bits of each tag byte are the Variant::Type of the value.
+	TAG_TYPE_MASK = 0x3F,
+	// Set for a true bool, and for floats and real_t based values stored with 64 bits.
+	TAG_FLAG = 0x40,
+	// Untrusted input (e.g. from the network) must not be able to exhaust the stack.
+	MAX_DEPTH = 1024,
+};
+
+static_assert(Variant::VARIANT_MAX <= TAG_TYPE_MASK + 1, "Variant types don't fit in the compact tag.");
+
+static int _get_real_component_count(int p_type) {
+	switch (p_type) {
+		case Variant::VECTOR2:
+			return 2;
+		case Variant::VECTOR3:
+			return 3;
+		case Variant::RECT2:
+		case Variant::VECTOR4:
+		case Variant::PLANE:
+		case Variant::QUATERNION:
+			return 4;
+		case Variant::TRANSFORM2D:
+		case Variant::AABB:
+			return 6;
+		case Variant::BASIS:
+			return 9;
+		case Variant::TRANSFORM3D:
+			return 12;
+		case Variant::PROJECTION:
+			return 16;
+		default:
+			return 0;
+	}
+}
+
+static int _get_int_component_count(int p_type) {
+	switch (p_type) {
+		case Variant::VECTOR2I:
+			return 2;
+		case Variant::VECTOR3I:
+			return 3;
+		case Variant::RECT2I:
+		case Variant::VECTOR4I:
+			return 4;
+		default:
+			return 0;
+	}
+}
+
+// Size of the elements of fixed size packed arrays, and of their scalar components.
+static int _get_packed_element_size(int p_type, bool p_wide, int &r_component_size) {
+	switch (p_type) {
+		case Variant::PACKED_BYTE_ARRAY:
+			r_component_size = 1;
+			return 1;
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY:
+			r_component_size = 4;
+			return 4;
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY:
+			r_component_size = 8;
+			return 8;
+		case Variant::PACKED_VECTOR2_ARRAY:
+			r_component_size = p_wide ? 8 : 4;
+			return r_component_size * 2;
+		case Variant::PACKED_VECTOR3_ARRAY:
+			r_component_size = p_wide ? 8 : 4;
+			return r_component_size * 3;
+		case Variant::PACKED_COLOR_ARRAY:
+			r_component_size = 4;
+			return 16;
+		default:
+			r_component_size = 0;
+			return 0;
+	}
+}
+
+// Packed array contents are stored little-endian.
+static void _copy_components(uint8_t *p_dst, const uint8_t *p_src, int p_size, int p_component_size) {
+#ifdef BIG_ENDIAN_ENABLED
+	for (int i = 0; i < p_size; i += p_component_size) {
+		for (int j = 0; j < p_component_size; j++) {
+			p_dst[i + j] = p_src[i + p_component_size - 1 - j];
+		}
+	}
+#else
+	memcpy(p_dst, p_src, p_size);
+#endif
+}
+
+/* Encoding */
+
+struct CompactVariantEncoder {
+	LocalVector<uint8_t> body;
+	HashMap<String, uint32_t> string_ids;
+	LocalVector<String> strings;
+
+	void put_u8(uint8_t p_value) {
+		body.push_back(p_value);
+	}
+
+	void put_varint(uint64_t p_value) {
+		while (p_value >= 0x80) {
+			body.push_back(uint8_t(p_value | 0x80));
+			p_value >>= 7;
+		}
+		body.push_back(uint8_t(p_value));
+	}
+
+	void put_zigzag(int64_t p_value) {
+		put_varint((uint64_t(p_value) << 1) ^ uint64_t(p_value >> 63));
+	}
+
+	uint8_t *put_space(uint32_t p_size) {
+		uint32_t pos = body.size();
+		body.resize(pos + p_size);
+		return body.ptr() + pos;
+	}
+
+	void put_float(float p_value) {
+		encode_float(p_value, put_space(4));
+	}
+
+	void put_double(double p_value) {
+		encode_double(p_value, put_space(8));
+	}
+
+	void put_string(const String &p_string) {
+		const uint32_t *id = string_ids.getptr(p_string);
+		if (!id) {
+			id = &string_ids.insert(p_string, strings.size())->value;
+			strings.push_back(p_string);
+		}
+		put_varint(*id);
+	}
+
+	void put_reals(int p_type, const real_t *p_components, int p_count) {
+		bool wide = false;
+#ifdef REAL_T_IS_DOUBLE
+		for (int i = 0; i < p_count; i++) {
+			if ((double)(float)p_components[i] != p_components[i]) {
+				wide = true;
+				break;
+			}
+		}
+#endif
+		put_u8(p_type | (wide ? TAG_FLAG : 0));
+		for (int i = 0; i < p_count; i++) {
+			if (wide) {
+				put_double(p_components[i]);
+			} else {
+				put_float(p_components[i]);
+			}
+		}
+	}
+
+	template <class T>
+	void put_math(int p_type, const T &p_value) {
+		static_assert(sizeof(T) % sizeof(real_t) == 0, "Math types are expected to only hold real_t.");
+		put_reals(p_type, (const real_t *)&p_value, sizeof(T) / sizeof(real_t));
+	}
+
+	template <class T>
+	void put_packed(int p_type, const Vector<T> &p_array) {
+		int component_size = 0;
+		int element_size = _get_packed_element_size(p_type, sizeof(real_t) == 8, component_size);
+		put_u8(p_type | (sizeof(real_t) == 8 && (p_type == Variant::PACKED_VECTOR2_ARRAY || p_type == Variant::PACKED_VECTOR3_ARRAY) ? TAG_FLAG : 0));
+		put_varint(p_array.size());
+		if (p_array.size()) {
+			_copy_components(put_space(p_array.size() * element_size), (const uint8_t *)p_array.ptr(), p_array.size() * element_size, component_size);
+		}
+	}
+
+	// Containers store their size in bytes first, so readers can skip them.
+	uint32_t begin_sized(int p_type) {
+		put_u8(p_type);
+		uint32_t pos = body.size();
+		put_space(4);
+		return pos;
+	}
+
+	void end_sized(uint32_t p_pos) {
+		encode_uint32(body.size() - p_pos - 4, &body[p_pos]);
+	}
+
+	Error put_value(const Variant &p_value, int p_depth) {
+		ERR_FAIL_COND_V_MSG(p_depth > MAX_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deeply nested to be encoded.");
+
+		const int type = p_value.get_type();
+		switch (type) {
+			case Variant::NIL: {
+				put_u8(type);
+			} break;
+			case Variant::BOOL: {
+				put_u8(type | (bool(p_value) ? TAG_FLAG : 0));
+			} break;
+			case Variant::INT: {
+				put_u8(type);
+				put_zigzag(p_value);
+			} break;
+			case Variant::FLOAT: {
+				double d = p_value;
+				if ((double)(float)d == d) {
+					put_u8(type);
+					put_float(d);
+				} else {
+					put_u8(type | TAG_FLAG);
+					put_double(d);
+				}
+			} break;
+			case Variant::STRING: {
+				put_u8(type);
+				put_string(p_value);
+			} break;
+			case Variant::STRING_NAME: {
+				put_u8(type);
+				put_string(String(StringName(p_value)));
+			} break;
+			case Variant::NODE_PATH: {
+				put_u8(type);
+				put_string(String(NodePath(p_value)));
+			} break;
+			case Variant::VECTOR2: {
+				put_math(type, Vector2(p_value));
+			} break;
+			case Variant::RECT2: {
+				put_math(type, Rect2(p_value));
+			} break;
+			case Variant::VECTOR3: {
+				put_math(type, Vector3(p_value));
+			} break;
+			case Variant::TRANSFORM2D: {
+				put_math(type, Transform2D(p_value));
+			} break;
+			case Variant::VECTOR4: {
+				put_math(type, Vector4(p_value));
+			} break;
+			case Variant::PLANE: {
+				put_math(type, Plane(p_value));
+			} break;
+			case Variant::QUATERNION: {
+				put_math(type, Quaternion(p_value));
+			} break;
+			case Variant::AABB: {
+				put_math(type, ::AABB(p_value));
+			} break;
+			case Variant::BASIS: {
+				put_math(type, Basis(p_value));
+			} break;
+			case Variant::TRANSFORM3D: {
+				put_math(type, Transform3D(p_value));
+			} break;
+			case Variant::PROJECTION: {
+				put_math(type, Projection(p_value));
+			} break;
+			case Variant::VECTOR2I: {
+				Vector2i v = p_value;
+				put_u8(type);
+				put_zigzag(v.x);
+				put_zigzag(v.y);
+			} break;
+			case Variant::RECT2I: {
+				Rect2i r = p_value;
+				put_u8(type);
+				put_zigzag(r.position.x);
+				put_zigzag(r.position.y);
+				put_zigzag(r.size.x);
+				put_zigzag(r.size.y);
+			} break;
+			case Variant::VECTOR3I: {
+				Vector3i v = p_value;
+				put_u8(type);
+				put_zigzag(v.x);
+				put_zigzag(v.y);
+				put_zigzag(v.z);
+			} break;
+			case Variant::VECTOR4I: {
+				Vector4i v = p_value;
+				put_u8(type);
+				put_zigzag(v.x);
+				put_zigzag(v.y);
+				put_zigzag(v.z);
+				put_zigzag(v.w);
+			} break;
+			case Variant::COLOR: {
+				Color c = p_value;
+				put_u8(type);
+				put_float(c.r);
+				put_float(c.g);
+				put_float(c.b);
+				put_float(c.a);
+			} break;
+			case Variant::RID: {
+				put_u8(type);
+				put_varint(RID(p_value).get_id());
+			} break;
+			case Variant::OBJECT: {
+				ERR_FAIL_COND_V_MSG(p_value.get_validated_object() != nullptr, ERR_INVALID_PARAMETER, "Objects can't be encoded in the compact Variant format.");
+				put_u8(type);
+			} break;
+			case Variant::DICTIONARY: {
+				Dictionary d = p_value;
+				uint32_t pos = begin_sized(type);
+				put_varint(d.size());
+				const Variant *key = nullptr;
+				while ((key = d.next(key))) {
+					Error err = put_value(*key, p_depth + 1);
+					ERR_FAIL_COND_V(err != OK, err);
+					err = put_value(d[*key], p_depth + 1);
+					ERR_FAIL_COND_V(err != OK, err);
+				}
+				end_sized(pos);
+			} break;
+			case Variant::ARRAY: {
+				Array a = p_value;
+				uint32_t pos = begin_sized(type);
+				put_varint(a.size());
+				for (int i = 0; i < a.size(); i++) {
+					Error err = put_value(a[i], p_depth + 1);
+					ERR_FAIL_COND_V(err != OK, err);
+				}
+				end_sized(pos);
+			} break;
+			case Variant::PACKED_BYTE_ARRAY: {
+				put_packed(type, PackedByteArray(p_value));
+			} break;
+			case Variant::PACKED_INT32_ARRAY: {
+				put_packed(type, PackedInt32Array(p_value));
+			} break;
+			case Variant::PACKED_INT64_ARRAY: {
+				put_packed(type, PackedInt64Array(p_value));
+			} break;
+			case Variant::PACKED_FLOAT32_ARRAY: {
+				put_packed(type, PackedFloat32Array(p_value));
+			} break;
+			case Variant::PACKED_FLOAT64_ARRAY: {
+				put_packed(type, PackedFloat64Array(p_value));
+			} break;
+			case Variant::PACKED_VECTOR2_ARRAY: {
+				put_packed(type, PackedVector2Array(p_value));
+			} break;
+			case Variant::PACKED_VECTOR3_ARRAY: {
+				put_packed(type, PackedVector3Array(p_value));
+			} break;
+			case Variant::PACKED_COLOR_ARRAY: {
+				put_packed(type, PackedColorArray(p_value));
+			} break;
+			case Variant::PACKED_STRING_ARRAY: {
+				PackedStringArray a = p_value;
+				uint32_t pos = begin_sized(type);
+				put_varint(a.size());
+				for (int i = 0; i < a.size(); i++) {
+					put_string(a[i]);
+				}
+				end_sized(pos);
+			} break;
+			default: {
+				ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Values of type '" + Variant::get_type_name(p_value.get_type()) + "' can't be encoded in the compact Variant format.");
+			}
+		}
+		return OK;
+	}
+};
+
+/* Decoding */
+
+struct CompactVariantDecoder {
+	const uint8_t *data = nullptr;
+	int len = 0;
+	const String *strings = nullptr;
+	int string_count = 0;
+
+	bool get_varint(int &r_pos, uint64_t &r_value) const {
+		r_value = 0;
+		for (int shift = 0; shift < 64; shift += 7) {
+			if (r_pos >= len) {
+				return false;
+			}
+			uint8_t b = data[r_pos++];
+			r_value |= uint64_t(b & 0x7F) << shift;
+			if (!(b & 0x80)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool get_zigzag(int &r_pos, int64_t &r_value) const {
+		uint64_t v;
+		if (!get_varint(r_pos, v)) {
+			return false;
+		}
+		r_value = int64_t(v >> 1) ^ -int64_t(v & 1);
+		return true;
+	}
+
+	bool get_count(int &r_pos, int &r_count) const {
+		uint64_t v;
+		if (!get_varint(r_pos, v) || v > uint64_t(len)) {
+			return false; // Every entry takes at least one byte.
+		}
+		r_count = v;
+		return true;
+	}
+
+	bool get_string(int &r_pos, String &r_string) const {
+		uint64_t id;
+		if (!get_varint(r_pos, id) || id >= uint64_t(string_count)) {
+			return false;
+		}
+		r_string = strings[id];
+		return true;
+	}
+
+	bool get_reals(int &r_pos, bool p_wide, real_t *r_components, int p_count) const {
+		const int size = p_wide ? 8 : 4;
+		if (r_pos + size * p_count > len) {
+			return false;
+		}
+		for (int i = 0; i < p_count; i++) {
+			r_components[i] = p_wide ? (real_t)decode_double(&data[r_pos]) : (real_t)decode_float(&data[r_pos]);
+			r_pos += size;
+		}
+		return true;
+	}
+
+	bool get_sized(int &r_pos, int &r_end) const {
+		if (r_pos + 4 > len) {
+			return false;
+		}
+		uint32_t size = decode_uint32(&data[r_pos]);
+		r_pos += 4;
+		if (size > uint32_t(len - r_pos)) {
+			return false;
+		}
+		r_end = r_pos + size;
+		return true;
+	}
+
+	template <class T>
+	static Variant make_math(const real_t *p_components) {
+		T value;
+		memcpy((void *)&value, p_components, sizeof(T));
+		return value;
+	}
+
+	template <class T>
+	bool get_packed(int &r_pos, int p_type, bool p_wide, Variant &r_value) const {
+		int count = 0;
+		if (!get_count(r_pos, count)) {
+			return false;
+		}
+		int component_size = 0;
+		int element_size = _get_packed_element_size(p_type, p_wide, component_size);
+		if (int64_t(count) * element_size > len - r_pos) {
+			return false;
+		}
+		Vector<T> array;
+		array.resize(count);
+		if (count) {
+			if (component_size == (int)sizeof(real_t) || (p_type != Variant::PACKED_VECTOR2_ARRAY && p_type != Variant::PACKED_VECTOR3_ARRAY)) {
+				_copy_components((uint8_t *)array.ptrw(), &data[r_pos], count * element_size, component_size);
+			} else {
+				// Stored with a different precision than real_t.
+				real_t *w = (real_t *)array.ptrw();
+				const int components = element_size / component_size;
+				for (int i = 0; i < count * components; i++) {
+					w[i] = p_wide ? (real_t)decode_double(&data[r_pos + i * 8]) : (real_t)decode_float(&data[r_pos + i * 4]);
+				}
+			}
+		}
+		r_pos += count * element_size;
+		r_value = array;
+		return true;
+	}
+
+	bool skip_value(int &r_pos) const {
+		if (r_pos >= len) {
+			return false;
+		}
+		const uint8_t tag = data[r_pos++];
+		const int type = tag & TAG_TYPE_MASK;
+		const bool wide = tag & TAG_FLAG;
+		uint64_t v;
+
+		if (_get_real_component_count(type)) {
+			r_pos += _get_real_component_count(type) * (wide ? 8 : 4);
+			return r_pos <= len;
+		}
+		if (_get_int_component_count(type)) {
+			for (int i = 0; i < _get_int_component_count(type); i++) {
+				if (!get_varint(r_pos, v)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		switch (type) {
+			case Variant::NIL:
+			case Variant::BOOL:
+			case Variant::OBJECT:
+				return true;
+			case Variant::INT:
+			case Variant::STRING:
+			case Variant::STRING_NAME:
+			case Variant::NODE_PATH:
+			case Variant::RID:
+				return get_varint(r_pos, v);
+			case Variant::FLOAT:
+				r_pos += wide ? 8 : 4;
+				return r_pos <= len;
+			case Variant::COLOR:
+				r_pos += 16;
+				return r_pos <= len;
+			case Variant::DICTIONARY:
+			case Variant::ARRAY:
+			case Variant::PACKED_STRING_ARRAY: {
+				int end = 0;
+				if (!get_sized(r_pos, end)) {
+					return false;
+				}
+				r_pos = end;
+				return true;
+			}
+			default: {
+				int component_size = 0;
+				int element_size = _get_packed_element_size(type, wide, component_size);
+				int count = 0;
+				if (!element_size || !get_count(r_pos, count) || int64_t(count) * element_size > len - r_pos) {
+					return false;
+				}
+				r_pos += count * element_size;
+				return true;
+			}
+		}
+	}
+
+	bool get_value(int &r_pos, Variant &r_value, int p_depth) const {
+		if (r_pos >= len || p_depth > MAX_DEPTH) {
+			return false;
+		}
+		const uint8_t tag = data[r_pos++];
+		const int type = tag & TAG_TYPE_MASK;
+		const bool wide = tag & TAG_FLAG;
+
+		if (_get_real_component_count(type)) {
+			real_t c[16];
+			if (!get_reals(r_pos, wide, c, _get_real_component_count(type))) {
+				return false;
+			}
+			switch (type) {
+				case Variant::VECTOR2:
+					r_value = make_math<Vector2>(c);
+					break;
+				case Variant::RECT2:
+					r_value = make_math<Rect2>(c);
+					break;
+				case Variant::VECTOR3:
+					r_value = make_math<Vector3>(c);
+					break;
+				case Variant::TRANSFORM2D:
+					r_value = make_math<Transform2D>(c);
+					break;
+				case Variant::VECTOR4:
+					r_value = make_math<Vector4>(c);
+					break;
+				case Variant::PLANE:
+					r_value = make_math<Plane>(c);
+					break;
+				case Variant::QUATERNION:
+					r_value = make_math<Quaternion>(c);
+					break;
+				case Variant::AABB:
+					r_value = make_math<::AABB>(c);
+					break;
+				case Variant::BASIS:
+					r_value = make_math<Basis>(c);
+					break;
+				case Variant::TRANSFORM3D:
+					r_value = make_math<Transform3D>(c);
+					break;
+				case Variant::PROJECTION:
+					r_value = make_math<Projection>(c);
+					break;
+			}
+			return true;
+		}
+		if (_get_int_component_count(type)) {
+			int64_t c[4];
+			for (int i = 0; i < _get_int_component_count(type); i++) {
+				if (!get_zigzag(r_pos, c[i])) {
+					return false;
+				}
+			}
+			switch (type) {
+				case Variant::VECTOR2I:
+					r_value = Vector2i(c[0], c[1]);
+					break;
+				case Variant::RECT2I:
+					r_value = Rect2i(c[0], c[1], c[2], c[3]);
+					break;
+				case Variant::VECTOR3I:
+					r_value = Vector3i(c[0], c[1], c[2]);
+					break;
+				case Variant::VECTOR4I:
+					r_value = Vector4i(c[0], c[1], c[2], c[3]);
+					break;
+			}
+			return true;
+		}
+
+		switch (type) {
+			case Variant::NIL: {
+				r_value = Variant();
+			} break;
+			case Variant::BOOL: {
+				r_value = wide;
+			} break;
+			case Variant::INT: {
+				int64_t v;
+				if (!get_zigzag(r_pos, v)) {
+					return false;
+				}
+				r_value = v;
+			} break;
+			case Variant::FLOAT: {
+				if (r_pos + (wide ? 8 : 4) > len) {
+					return false;
+				}
+				r_value = wide ? decode_double(&data[r_pos]) : (double)decode_float(&data[r_pos]);
+				r_pos += wide ? 8 : 4;
+			} break;
+			case Variant::STRING:
+			case Variant::STRING_NAME:
+			case Variant::NODE_PATH: {
+				String s;
+				if (!get_string(r_pos, s)) {
+					return false;
+				}
+				if (type == Variant::STRING) {
+					r_value = s;
+				} else if (type == Variant::STRING_NAME) {
+					r_value = StringName(s);
+				} else {
+					r_value = NodePath(s);
+				}
+			} break;
+			case Variant::COLOR: {
+				if (r_pos + 16 > len) {
+					return false;
+				}
+				r_value = Color(decode_float(&data[r_pos]), decode_float(&data[r_pos + 4]), decode_float(&data[r_pos + 8]), decode_float(&data[r_pos + 12]));
+				r_pos += 16;
+			} break;
+			case Variant::RID: {
+				uint64_t id;
+				if (!get_varint(r_pos, id)) {
+					return false;
+				}
+				r_value = RID::from_uint64(id);
+			} break;
+			case Variant::OBJECT: {
+				r_value = (Object *)nullptr;
+			} break;
+			case Variant::DICTIONARY: {
+				int end = 0;
+				int count = 0;
+				if (!get_sized(r_pos, end) || !get_count(r_pos, count)) {
+					return false;
+				}
+				Dictionary d;
+				for (int i = 0; i < count; i++) {
+					Variant key;
+					Variant value;
+					if (!get_value(r_pos, key, p_depth + 1) || !get_value(r_pos, value, p_depth + 1)) {
+						return false;
+					}
+					d[key] = value;
+				}
+				if (r_pos != end) {
+					return false;
+				}
+				r_value = d;
+			} break;
+			case Variant::ARRAY: {
+				int end = 0;
+				int count = 0;
+				if (!get_sized(r_pos, end) || !get_count(r_pos, count)) {
+					return false;
+				}
+				Array a;
+				a.resize(count);
+				for (int i = 0; i < count; i++) {
+					Variant value;
+					if (!get_value(r_pos, value, p_depth + 1)) {
+						return false;
+					}
+					a[i] = value;
+				}
+				if (r_pos != end) {
+					return false;
+				}
+				r_value = a;
+			} break;
+			case Variant::PACKED_STRING_ARRAY: {
+				int end = 0;
+				int count = 0;
+				if (!get_sized(r_pos, end) || !get_count(r_pos, count)) {
+					return false;
+				}
+				PackedStringArray a;
+				a.resize(count);
+				String *w = a.ptrw();
+				for (int i = 0; i < count; i++) {
+					if (!get_string(r_pos, w[i])) {
+						return false;
+					}
+				}
+				if (r_pos != end) {
+					return false;
+				}
+				r_value = a;
+			} break;
+			case Variant::PACKED_BYTE_ARRAY:
+				return get_packed<uint8_t>(r_pos, type, wide, r_value);
+			case Variant::PACKED_INT32_ARRAY:
+				return get_packed<int32_t>(r_pos, type, wide, r_value);
+			case Variant::PACKED_INT64_ARRAY:
+				return get_packed<int64_t>(r_pos, type, wide, r_value);
+			case Variant::PACKED_FLOAT32_ARRAY:
+				return get_packed<float>(r_pos, type, wide, r_value);
+			case Variant::PACKED_FLOAT64_ARRAY:
+				return get_packed<double>(r_pos, type, wide, r_value);
+			case Variant::PACKED_VECTOR2_ARRAY:
+				return get_packed<Vector2>(r_pos, type, wide, r_value);
+			case Variant::PACKED_VECTOR3_ARRAY:
+				return get_packed<Vector3>(r_pos, type, wide, r_value);
+			case Variant::PACKED_COLOR_ARRAY:
+				return get_packed<Color>(r_pos, type, wide, r_value);
+			default:
+				return false;
+		}
+		return true;
+	}
+
+	// Returns the single element of a fixed size packed array stored at p_pos.
+	Variant get_packed_element(int p_pos, int p_type, bool p_wide) const {
+		const uint8_t *p = &data[p_pos];
+		switch (p_type) {
+			case Variant::PACKED_BYTE_ARRAY:
+				return p[0];
+			case Variant::PACKED_INT32_ARRAY:
+				return (int32_t)decode_uint32(p);
+			case Variant::PACKED_INT64_ARRAY:
+				return (int64_t)decode_uint64(p);
+			case Variant::PACKED_FLOAT32_ARRAY:
+				return decode_float(p);
+			case Variant::PACKED_FLOAT64_ARRAY:
+				return decode_double(p);
+			case Variant::PACKED_VECTOR2_ARRAY:
+				return p_wide ? Vector2(decode_double(p), decode_double(p + 8)) : Vector2(decode_float(p), decode_float(p + 4));
+			case Variant::PACKED_VECTOR3_ARRAY:
+				return p_wide ? Vector3(decode_double(p), decode_double(p + 8), decode_double(p + 16)) : Vector3(decode_float(p), decode_float(p + 4), decode_float(p + 8));
+			case Variant::PACKED_COLOR_ARRAY:
+				return Color(decode_float(p), decode_float(p + 4), decode_float(p + 8), decode_float(p + 12));
+			default:
+				return Variant();
+		}
+	}
+};
+
+static Error _parse_header(const uint8_t *p_buffer, int p_len, Vector<String> &r_strings, int &r_pos) {
+	ERR_FAIL_COND_V_MSG(p_len < 4 || memcmp(p_buffer, COMPACT_VARIANT_MAGIC, 4) != 0, ERR_FILE_UNRECOGNIZED, "Not a compact Variant buffer.");
+	CompactVariantDecoder decoder;
+	decoder.data = p_buffer;
+	decoder.len = p_len;
+
+	r_pos = 4;
+	int string_count = 0;
+	ERR_FAIL_COND_V(!decoder.get_count(r_pos, string_count), ERR_FILE_CORRUPT);
+	r_strings.resize(string_count);
+	String *w = r_strings.ptrw();
+	for (int i = 0; i < string_count; i++) {
+		int length = 0;
+		ERR_FAIL_COND_V(!decoder.get_count(r_pos, length) || length > p_len - r_pos, ERR_FILE_CORRUPT);
+		w[i].parse_utf8((const char *)&p_buffer[r_pos], length);
+		r_pos += length;
+	}
+	return OK;
+}
+
+Error CompactVariant::encode_to_buffer(const Variant &p_value, Vector<uint8_t> &r_buffer) {
+	CompactVariantEncoder encoder;
+	Error err = encoder.put_value(p_value, 0);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	// The string table is only known once the whole value is encoded, write it first.
+	CompactVariantEncoder header;
+	header.put_space(4);
+	memcpy(header.body.ptr(), COMPACT_VARIANT_MAGIC, 4);
+	header.put_varint(encoder.strings.size());
+	for (uint32_t i = 0; i < encoder.strings.size(); i++) {
+		CharString utf8 = encoder.strings[i].utf8();
+		header.put_varint(utf8.length());
+		if (utf8.length()) {
+			memcpy(header.put_space(utf8.length()), utf8.get_data(), utf8.length());
+		}
+	}
+
+	r_buffer.resize(header.body.size() + encoder.body.size());
+	uint8_t *w = r_buffer.ptrw();
+	memcpy(w, header.body.ptr(), header.body.size());
+	memcpy(w + header.body.size(), encoder.body.ptr(), encoder.body.size());
+	return OK;
+}
+
+Error CompactVariant::decode_from_buffer(const uint8_t *p_buffer, int p_len, Variant &r_value) {
+	Vector<String> table;
+	int pos = 0;
+	Error err = _parse_header(p_buffer, p_len, table, pos);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	CompactVariantDecoder decoder;
+	decoder.data = p_buffer;
+	decoder.len = p_len;
+	decoder.strings = table.ptr();
+	decoder.string_count = table.size();
+	ERR_FAIL_COND_V_MSG(!decoder.get_value(pos, r_value, 0), ERR_FILE_CORRUPT, "Corrupt compact Variant buffer.");
+	return OK;
+}
+
+PackedByteArray CompactVariant::encode(const Variant &p_value) {
+	PackedByteArray buffer;
+	Error err = encode_to_buffer(p_value, buffer);
+	ERR_FAIL_COND_V(err != OK, PackedByteArray());
+	return buffer;
+}
+
+Variant CompactVariant::decode(const PackedByteArray &p_data) {
+	Variant value;
+	Error err = decode_from_buffer(p_data.ptr(), p_data.size(), value);
+	ERR_FAIL_COND_V(err != OK, Variant());
+	return value;
+}
+
+/* Lazy reader */
+
+Error CompactVariant::_set_offset(int p_offset) {
+	CompactVariantDecoder decoder;
+	decoder.data = data.ptr();
+	decoder.len = data.size();
+
+	int pos = p_offset;
+	ERR_FAIL_COND_V(!decoder.skip_value(pos), ERR_FILE_CORRUPT);
+
+	offset = p_offset;
+	type = Variant::Type(data[p_offset] & TAG_TYPE_MASK);
+	count = 0;
+	items_offset = 0;
+	indexed = false;
+	key_offsets.clear();
+	element_offsets.clear();
+
+	pos = p_offset + 1;
+	int end = 0;
+	switch (type) {
+		case Variant::DICTIONARY:
+		case Variant::ARRAY:
+		case Variant::PACKED_STRING_ARRAY: {
+			ERR_FAIL_COND_V(!decoder.get_sized(pos, end) || !decoder.get_count(pos, count), ERR_FILE_CORRUPT);
+		} break;
+		case Variant::PACKED_BYTE_ARRAY:
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY:
+		case Variant::PACKED_VECTOR2_ARRAY:
+		case Variant::PACKED_VECTOR3_ARRAY:
+		case Variant::PACKED_COLOR_ARRAY: {
+			ERR_FAIL_COND_V(!decoder.get_count(pos, count), ERR_FILE_CORRUPT);
+		} break;
+		default:
+			break;
+	}
+	items_offset = pos;
+	return OK;
+}
+
+Error CompactVariant::_build_index() {
+	if (indexed) {
+		return OK;
+	}
+
+	CompactVariantDecoder decoder;
+	decoder.data = data.ptr();
+	decoder.len = data.size();
+	decoder.strings = strings.ptr();
+	decoder.string_count = strings.size();
+
+	// Only the keys are decoded, values are skipped until they are requested.
+	int pos = items_offset;
+	if (type == Variant::DICTIONARY) {
+		key_offsets.reserve(count);
+		for (int i = 0; i < count; i++) {
+			Variant key;
+			ERR_FAIL_COND_V(!decoder.get_value(pos, key, 0), ERR_FILE_CORRUPT);
+			key_offsets[key] = pos;
+			ERR_FAIL_COND_V(!decoder.skip_value(pos), ERR_FILE_CORRUPT);
+		}
+	} else if (type == Variant::ARRAY) {
+		element_offsets.resize(count);
+		for (int i = 0; i < count; i++) {
+			element_offsets[i] = pos;
+			ERR_FAIL_COND_V(!decoder.skip_value(pos), ERR_FILE_CORRUPT);
+		}
+	}
+	indexed = true;
+	return OK;
+}
+
+int CompactVariant::_find_offset(const Variant &p_key) {
+	if (type != Variant::DICTIONARY && type != Variant::ARRAY) {
+		return -1;
+	}
+	if (_build_index() != OK) {
+		return -1;
+	}
+	if (type == Variant::DICTIONARY) {
+		const int *value_offset = key_offsets.getptr(p_key);
+		return value_offset ? *value_offset : -1;
+	}
+	if (p_key.get_type() != Variant::INT) {
+		return -1;
+	}
+	int64_t index = p_key;
+	if (index < 0 || index >= count) {
+		return -1;
+	}
+	return element_offsets[index];
+}
+
+Error CompactVariant::open(const PackedByteArray &p_data) {
+	offset = -1;
+	type = Variant::NIL;
+	count = 0;
+
+	Vector<String> table;
+	int pos = 0;
+	Error err = _parse_header(p_data.ptr(), p_data.size(), table, pos);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	data = p_data;
+	strings = table;
+	return _set_offset(pos);
+}
+
+bool CompactVariant::is_open() const {
+	return offset >= 0;
+}
+
+Variant::Type CompactVariant::get_type() const {
+	return type;
+}
+
+int CompactVariant::size() const {
+	return count;
+}
+
+bool CompactVariant::has(const Variant &p_key) {
+	ERR_FAIL_COND_V_MSG(offset < 0, false, "No compact Variant buffer is open.");
+	if (type >= Variant::PACKED_BYTE_ARRAY) {
+		return p_key.get_type() == Variant::INT && int64_t(p_key) >= 0 && int64_t(p_key) < count;
+	}
+	return _find_offset(p_key) >= 0;
+}
+
+Variant CompactVariant::get(const Variant &p_key, const Variant &p_default) {
+	ERR_FAIL_COND_V_MSG(offset < 0, p_default, "No compact Variant buffer is open.");
+
+	CompactVariantDecoder decoder;
+	decoder.data = data.ptr();
+	decoder.len = data.size();
+	decoder.strings = strings.ptr();
+	decoder.string_count = strings.size();
+
+	if (type >= Variant::PACKED_BYTE_ARRAY) {
+		if (p_key.get_type() != Variant::INT || int64_t(p_key) < 0 || int64_t(p_key) >= count) {
+			return p_default;
+		}
+		const bool wide = data[offset] & TAG_FLAG;
+		if (type == Variant::PACKED_STRING_ARRAY) {
+			int pos = items_offset;
+			uint64_t id = 0;
+			for (int64_t i = 0; i <= int64_t(p_key); i++) {
+				ERR_FAIL_COND_V(!decoder.get_varint(pos, id), p_default);
+			}
+			ERR_FAIL_COND_V(id >= uint64_t(strings.size()), p_default);
+			return strings[id];
+		}
+		// Fixed size elements are read in place.
+		int component_size = 0;
+		int element_size = _get_packed_element_size(type, wide, component_size);
+		return decoder.get_packed_element(items_offset + int64_t(p_key) * element_size, type, wide);
+	}
+
+	int value_offset = _find_offset(p_key);
+	if (value_offset < 0) {
+		return p_default;
+	}
+	Variant value;
+	ERR_FAIL_COND_V(!decoder.get_value(value_offset, value, 0), p_default);
+	return value;
+}
+
+Array CompactVariant::get_keys() {
+	Array keys;
+	ERR_FAIL_COND_V_MSG(offset < 0, keys, "No compact Variant buffer is open.");
+	ERR_FAIL_COND_V_MSG(type != Variant::DICTIONARY, keys, "The value read is not a Dictionary.");
+	ERR_FAIL_COND_V(_build_index() != OK, keys);
+	for (const KeyValue<Variant, int> &E : key_offsets) {
+		keys.push_back(E.key);
+	}
+	return keys;
+}
+
+Ref<CompactVariant> CompactVariant::get_reader(const Variant &p_key) {
+	ERR_FAIL_COND_V_MSG(offset < 0, Ref<CompactVariant>(), "No compact Variant buffer is open.");
+	int value_offset = _find_offset(p_key);
+	ERR_FAIL_COND_V_MSG(value_offset < 0, Ref<CompactVariant>(), "Key not found in the value read: " + p_key.operator String() + ".");
+
+	Ref<CompactVariant> reader;
+	reader.instantiate();
+	reader->data = data;
+	reader->strings = strings;
+	ERR_FAIL_COND_V(reader->_set_offset(value_offset) != OK, Ref<CompactVariant>());
+	return reader;
+}
+
+Variant CompactVariant::get_value() const {
+	ERR_FAIL_COND_V_MSG(offset < 0, Variant(), "No compact Variant buffer is open.");
+
+	CompactVariantDecoder decoder;
+	decoder.data = data.ptr();
+	decoder.len = data.size();
+	decoder.strings = strings.ptr();
+	decoder.string_count = strings.size();
+
+	int pos = offset;
+	Variant value;
+	ERR_FAIL_COND_V_MSG(!decoder.get_value(pos, value, 0), Variant(), "Corrupt compact Variant buffer.");
+	return value;
+}
+
+void CompactVariant::_bind_methods() {
+	ClassDB::bind_static_method("CompactVariant", D_METHOD("encode", "value"), &CompactVariant::encode);
+	ClassDB::bind_static_method("CompactVariant", D_METHOD("decode", "data"), &CompactVariant::decode);
+
+	ClassDB::bind_method(D_METHOD("open", "data"), &CompactVariant::open);
+	ClassDB::bind_method(D_METHOD("is_open"), &CompactVariant::is_open);
+	ClassDB::bind_method(D_METHOD("get_type"), &CompactVariant::get_type);
+	ClassDB::bind_method(D_METHOD("size"), &CompactVariant::size);
+	ClassDB::bind_method(D_METHOD("has", "key"), &CompactVariant::has);
+	ClassDB::bind_method(D_METHOD("get", "key", "default"), &CompactVariant::get, DEFVAL(Variant()));
+	ClassDB::bind_method(D_METHOD("get_keys"), &CompactVariant::get_keys);
+	ClassDB::bind_method(D_METHOD("get_reader", "key"), &CompactVariant::get_reader);
+	ClassDB::bind_method(D_METHOD("get_value"), &CompactVariant::get_value);
+}
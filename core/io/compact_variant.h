@@ -0,0 +1,86 @@
+/*************************************************************************/
+/*  compact_variant.h                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef COMPACT_VARIANT_H
+#define COMPACT_VARIANT_H
+
+#include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/variant.h"
+
+// Compact binary Variant format, an alternative to encode_variant() meant for network messages and save data.
+// Integers are stored as variable length, strings are stored once in a table and referenced by index, packed
+// arrays are stored as their raw contents, and containers are prefixed with their size so they can be skipped.
+// This lets a reader access single entries of an encoded Dictionary or Array without decoding the rest.
+class CompactVariant : public RefCounted {
+	GDCLASS(CompactVariant, RefCounted);
+
+	// The buffer and string table are copy-on-write, so nested readers share them with their parent.
+	Vector<uint8_t> data;
+	Vector<String> strings;
+
+	int offset = -1;
+	Variant::Type type = Variant::NIL;
+	int count = 0;
+	int items_offset = 0;
+
+	// Built the first time entries are looked up.
+	bool indexed = false;
+	HashMap<Variant, int, VariantHasher, VariantComparator> key_offsets;
+	LocalVector<int> element_offsets;
+
+	Error _set_offset(int p_offset);
+	Error _build_index();
+	int _find_offset(const Variant &p_key);
+
+protected:
+	static void _bind_methods();
+
+public:
+	static Error encode_to_buffer(const Variant &p_value, Vector<uint8_t> &r_buffer);
+	static Error decode_from_buffer(const uint8_t *p_buffer, int p_len, Variant &r_value);
+
+	static PackedByteArray encode(const Variant &p_value);
+	static Variant decode(const PackedByteArray &p_data);
+
+	Error open(const PackedByteArray &p_data);
+	bool is_open() const;
+
+	Variant::Type get_type() const;
+	int size() const;
+	bool has(const Variant &p_key);
+	Variant get(const Variant &p_key, const Variant &p_default = Variant());
+	Array get_keys();
+	Ref<CompactVariant> get_reader(const Variant &p_key);
+	Variant get_value() const;
+};
+
+#endif // COMPACT_VARIANT_H
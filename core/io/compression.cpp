@@ -32,13 +32,24 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/zip_io.h"
+#include "core/os/rw_lock.h"
+#include "core/templates/hash_map.h"
 
 #include "thirdparty/misc/fastlz.h"
 
 #include <zlib.h>
 #include <zstd.h>
 
-int Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int p_src_size, Mode p_mode) {
+struct ZstdDictionary {
+	ZSTD_CDict *cdict = nullptr;
+	ZSTD_DDict *ddict = nullptr;
+};
+
+static RWLock zstd_dictionaries_lock;
+static HashMap<int, ZstdDictionary> zstd_dictionaries;
+static int zstd_dictionary_last_id = 0;
+
+int Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int p_src_size, Mode p_mode, int p_zstd_dictionary) {
 	switch (p_mode) {
 		case MODE_FASTLZ: {
 			if (p_src_size < 16) {
@@ -77,6 +88,18 @@ int Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int p_src_size,
 
 		} break;
 		case MODE_ZSTD: {
+			if (p_zstd_dictionary) {
+				RWLockRead lock(zstd_dictionaries_lock);
+				const ZstdDictionary *dict = zstd_dictionaries.getptr(p_zstd_dictionary);
+				ERR_FAIL_COND_V_MSG(!dict, -1, vformat("Invalid Zstd dictionary ID: %d.", p_zstd_dictionary));
+				ZSTD_CCtx *cctx = ZSTD_createCCtx();
+				int max_dst_size = get_max_compressed_buffer_size(p_src_size, MODE_ZSTD);
+				// The compression level is the one the dictionary was added with.
+				size_t ret = ZSTD_compress_usingCDict(cctx, p_dst, max_dst_size, p_src, p_src_size, dict->cdict);
+				ZSTD_freeCCtx(cctx);
+				return ZSTD_isError(ret) ? -1 : (int)ret;
+			}
+
 			ZSTD_CCtx *cctx = ZSTD_createCCtx();
 			ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, zstd_level);
 			if (zstd_long_distance_matching) {
@@ -127,7 +150,7 @@ int Compression::get_max_compressed_buffer_size(int p_src_size, Mode p_mode) {
 	ERR_FAIL_V(-1);
 }
 
-int Compression::decompress(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p_src, int p_src_size, Mode p_mode) {
+int Compression::decompress(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p_src, int p_src_size, Mode p_mode, int p_zstd_dictionary) {
 	switch (p_mode) {
 		case MODE_FASTLZ: {
 			int ret_size = 0;
@@ -167,6 +190,16 @@ int Compression::decompress(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p
 			return total;
 		} break;
 		case MODE_ZSTD: {
+			if (p_zstd_dictionary) {
+				RWLockRead lock(zstd_dictionaries_lock);
+				const ZstdDictionary *dict = zstd_dictionaries.getptr(p_zstd_dictionary);
+				ERR_FAIL_COND_V_MSG(!dict, -1, vformat("Invalid Zstd dictionary ID: %d.", p_zstd_dictionary));
+				ZSTD_DCtx *dctx = ZSTD_createDCtx();
+				size_t ret = ZSTD_decompress_usingDDict(dctx, p_dst, p_dst_max_size, p_src, p_src_size, dict->ddict);
+				ZSTD_freeDCtx(dctx);
+				return ZSTD_isError(ret) ? -1 : (int)ret;
+			}
+
 			ZSTD_DCtx *dctx = ZSTD_createDCtx();
 			if (zstd_long_distance_matching) {
 				ZSTD_DCtx_setParameter(dctx, ZSTD_d_windowLogMax, zstd_window_log_size);
@@ -269,6 +302,56 @@ int Compression::decompress_dynamic(Vector<uint8_t> *p_dst_vect, int p_max_dst_s
 	return Z_OK;
 }
 
+int Compression::add_zstd_dictionary(const Vector<uint8_t> &p_dictionary) {
+	ERR_FAIL_COND_V(p_dictionary.is_empty(), 0);
+
+	// Trained dictionaries (e.g. from `zstd --train`) are detected by their header, anything else is used as raw content.
+	ZstdDictionary dict;
+	dict.cdict = ZSTD_createCDict(p_dictionary.ptr(), p_dictionary.size(), zstd_level);
+	dict.ddict = ZSTD_createDDict(p_dictionary.ptr(), p_dictionary.size());
+	if (!dict.cdict || !dict.ddict) {
+		ZSTD_freeCDict(dict.cdict);
+		ZSTD_freeDDict(dict.ddict);
+		ERR_FAIL_V_MSG(0, "Couldn't create Zstd dictionary.");
+	}
+
+	RWLockWrite lock(zstd_dictionaries_lock);
+	int id = ++zstd_dictionary_last_id;
+	zstd_dictionaries.insert(id, dict);
+	return id;
+}
+
+void Compression::remove_zstd_dictionary(int p_id) {
+	RWLockWrite lock(zstd_dictionaries_lock);
+	ZstdDictionary *dict = zstd_dictionaries.getptr(p_id);
+	ERR_FAIL_COND(!dict);
+	ZSTD_freeCDict(dict->cdict);
+	ZSTD_freeDDict(dict->ddict);
+	zstd_dictionaries.erase(p_id);
+}
+
+Vector<uint8_t> Compression::build_zstd_dictionary(const Vector<Vector<uint8_t>> &p_samples, int p_max_size) {
+	ERR_FAIL_COND_V(p_max_size <= 0, Vector<uint8_t>());
+
+	// Zstd references recent content with shorter offsets, so keep the most recent samples
+	// and put them at the end of the dictionary.
+	int first = p_samples.size();
+	int size = 0;
+	while (first > 0 && size + p_samples[first - 1].size() <= p_max_size) {
+		first--;
+		size += p_samples[first].size();
+	}
+
+	Vector<uint8_t> dictionary;
+	dictionary.resize(size);
+	uint8_t *w = dictionary.ptrw();
+	for (int i = first; i < p_samples.size(); i++) {
+		memcpy(w, p_samples[i].ptr(), p_samples[i].size());
+		w += p_samples[i].size();
+	}
+	return dictionary;
+}
+
 int Compression::zlib_level = Z_DEFAULT_COMPRESSION;
 int Compression::gzip_level = Z_DEFAULT_COMPRESSION;
 int Compression::zstd_level = 3;
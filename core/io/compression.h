@@ -50,10 +50,16 @@ public:
 		MODE_GZIP
 	};
 
-	static int compress(uint8_t *p_dst, const uint8_t *p_src, int p_src_size, Mode p_mode = MODE_ZSTD);
+	static int compress(uint8_t *p_dst, const uint8_t *p_src, int p_src_size, Mode p_mode = MODE_ZSTD, int p_zstd_dictionary = 0);
 	static int get_max_compressed_buffer_size(int p_src_size, Mode p_mode = MODE_ZSTD);
-	static int decompress(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p_src, int p_src_size, Mode p_mode = MODE_ZSTD);
+	static int decompress(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p_src, int p_src_size, Mode p_mode = MODE_ZSTD, int p_zstd_dictionary = 0);
 	static int decompress_dynamic(Vector<uint8_t> *p_dst_vect, int p_max_dst_size, const uint8_t *p_src, int p_src_size, Mode p_mode);
+
+	// Zstd dictionaries help most with many small payloads sharing structure, like network packets.
+	// Both sides must use the same dictionary, the ID is only valid within this process.
+	static int add_zstd_dictionary(const Vector<uint8_t> &p_dictionary); ///< returns the dictionary ID, 0 on failure
+	static void remove_zstd_dictionary(int p_id);
+	static Vector<uint8_t> build_zstd_dictionary(const Vector<Vector<uint8_t>> &p_samples, int p_max_size = 112640); ///< raw content dictionary from the most recent samples
 };
 
 #endif // COMPRESSION_H
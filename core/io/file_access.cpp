@@ -36,6 +36,7 @@
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h"
 #include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 FileAccess::CreateFunc FileAccess::create_func[ACCESS_MAX] = { nullptr, nullptr };
@@ -469,6 +470,41 @@ uint64_t FileAccess::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return i;
 }
 
+uint64_t FileAccess::get_buffer_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+
+	// Generic fallback, implementations with positional reads avoid the lock.
+	MutexLock lock(positional_mutex);
+	FileAccess *fa = const_cast<FileAccess *>(this);
+	uint64_t prev_pos = get_position();
+	fa->seek(p_offset);
+	uint64_t read = get_buffer(p_dst, p_length);
+	fa->seek(prev_pos);
+	return read;
+}
+
+void FileAccess::_async_read_func(void *p_userdata) {
+	AsyncRead *ar = (AsyncRead *)p_userdata;
+	uint64_t read = ar->file->get_buffer_at(ar->offset, ar->dst, ar->length);
+	if (ar->callback) {
+		ar->callback(ar->userdata, read);
+	}
+	memdelete(ar);
+}
+
+int64_t FileAccess::get_buffer_async(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length, AsyncReadCallback p_callback, void *p_userdata) {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, WorkerThreadPool::INVALID_TASK_ID);
+
+	AsyncRead *ar = memnew(AsyncRead);
+	ar->file = Ref<FileAccess>(this);
+	ar->offset = p_offset;
+	ar->dst = p_dst;
+	ar->length = p_length;
+	ar->callback = p_callback;
+	ar->userdata = p_userdata;
+	return WorkerThreadPool::get_singleton()->add_native_task(&FileAccess::_async_read_func, ar, false, "FileAccess async read");
+}
+
 Vector<uint8_t> FileAccess::_get_buffer(int64_t p_length) const {
 	Vector<uint8_t> data;
 
@@ -35,6 +35,7 @@
 #include "core/math/math_defs.h"
 #include "core/object/ref_counted.h"
 #include "core/os/memory.h"
+#include "core/os/mutex.h"
 #include "core/string/ustring.h"
 #include "core/typedefs.h"
 
@@ -70,6 +71,7 @@ public:
 	typedef void (*FileCloseFailNotify)(const String &);
 
 	typedef Ref<FileAccess> (*CreateFunc)();
+	typedef void (*AsyncReadCallback)(void *p_userdata, uint64_t p_read); ///< called from a worker thread with the amount of bytes read
 	bool big_endian = false;
 	bool real_is_double = false;
 
@@ -100,6 +102,18 @@ private:
 
 	static Ref<FileAccess> _open(const String &p_path, ModeFlags p_mode_flags);
 
+	struct AsyncRead {
+		Ref<FileAccess> file;
+		uint64_t offset = 0;
+		uint8_t *dst = nullptr;
+		uint64_t length = 0;
+		AsyncReadCallback callback = nullptr;
+		void *userdata = nullptr;
+	};
+
+	mutable Mutex positional_mutex;
+	static void _async_read_func(void *p_userdata);
+
 public:
 	static void set_file_close_fail_notify_callback(FileCloseFailNotify p_cbk) { close_fail_notify = p_cbk; }
 
@@ -127,7 +141,11 @@ public:
 	Variant get_var(bool p_allow_objects = false) const;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const; ///< get an array of bytes
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const { return nullptr; } ///< get a pointer to the next p_length bytes without copying and advance past them, nullptr if unsupported
+	virtual const uint8_t *get_memory_map() { return nullptr; } ///< map the whole file for reading, valid while the file stays open, nullptr if unsupported
 	Vector<uint8_t> _get_buffer(int64_t p_length) const;
+	virtual uint64_t get_buffer_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const; ///< get an array of bytes at a given offset without moving the position, safe to call from several threads
+	int64_t get_buffer_async(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length, AsyncReadCallback p_callback = nullptr, void *p_userdata = nullptr); ///< queue get_buffer_at() on the worker thread pool, returns a WorkerThreadPool task ID to wait on or poll
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
@@ -30,12 +30,20 @@
 
 #include "file_access_encrypted.h"
 
-#include "core/crypto/crypto_core.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 #include "core/variant/variant.h"
 
 #include <stdio.h>
 
+void FileAccessEncrypted::_decrypt_chunk(uint32_t p_index, DecryptChunks *p_chunks) {
+	uint64_t ofs = p_index * DECRYPT_CHUNK_SIZE;
+	uint64_t size = MIN(DECRYPT_CHUNK_SIZE, p_chunks->size - ofs);
+	uint8_t iv[16];
+	memcpy(iv, p_chunks->ivs + p_index * 16, 16);
+	p_chunks->ctx->decrypt_cfb(size, iv, p_chunks->data + ofs, p_chunks->data + ofs);
+}
+
 Error FileAccessEncrypted::open_and_parse(Ref<FileAccess> p_base, const Vector<uint8_t> &p_key, Mode p_mode, bool p_with_magic) {
 	ERR_FAIL_COND_V_MSG(file != nullptr, ERR_ALREADY_IN_USE, "Can't open file while another file from path '" + file->get_path_absolute() + "' is open.");
 	ERR_FAIL_COND_V(p_key.size() != 32, ERR_INVALID_PARAMETER);
@@ -83,7 +91,27 @@ Error FileAccessEncrypted::open_and_parse(Ref<FileAccess> p_base, const Vector<u
 			CryptoCore::AESContext ctx;
 
 			ctx.set_encode_key(key.ptrw(), 256); // Due to the nature of CFB, same key schedule is used for both encryption and decryption!
-			ctx.decrypt_cfb(ds, iv, data.ptrw(), data.ptrw());
+			if (ds <= DECRYPT_CHUNK_SIZE) {
+				ctx.decrypt_cfb(ds, iv, data.ptrw(), data.ptrw());
+			} else {
+				// Each chunk starts from the last ciphertext block of the previous one,
+				// save those before they get decrypted in place.
+				uint32_t chunk_count = (ds + DECRYPT_CHUNK_SIZE - 1) / DECRYPT_CHUNK_SIZE;
+				Vector<uint8_t> ivs;
+				ivs.resize(chunk_count * 16);
+				memcpy(ivs.ptrw(), iv, 16);
+				for (uint32_t i = 1; i < chunk_count; i++) {
+					memcpy(ivs.ptrw() + i * 16, data.ptr() + i * DECRYPT_CHUNK_SIZE - 16, 16);
+				}
+
+				DecryptChunks chunks;
+				chunks.ctx = &ctx;
+				chunks.data = data.ptrw();
+				chunks.size = ds;
+				chunks.ivs = ivs.ptr();
+				WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &FileAccessEncrypted::_decrypt_chunk, &chunks, chunk_count, -1, true, SNAME("FileAccessEncryptedDecrypt"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+			}
 		}
 
 		data.resize(length);
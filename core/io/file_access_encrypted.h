@@ -31,6 +31,7 @@
 #ifndef FILE_ACCESS_ENCRYPTED_H
 #define FILE_ACCESS_ENCRYPTED_H
 
+#include "core/crypto/crypto_core.h"
 #include "core/io/file_access.h"
 
 #define ENCRYPTED_HEADER_MAGIC 0x43454447
@@ -54,6 +55,17 @@ private:
 	mutable bool eofed = false;
 	bool use_magic = true;
 
+	// CFB decryption only depends on the previous ciphertext block, so large files are decrypted in parallel chunks.
+	static const uint64_t DECRYPT_CHUNK_SIZE = 256 * 1024;
+
+	struct DecryptChunks {
+		CryptoCore::AESContext *ctx = nullptr;
+		uint8_t *data = nullptr;
+		uint64_t size = 0;
+		const uint8_t *ivs = nullptr; // 16 bytes per chunk.
+	};
+
+	void _decrypt_chunk(uint32_t p_index, DecryptChunks *p_chunks);
 	void _close();
 
 public:
@@ -30,6 +30,7 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/compression.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
@@ -47,13 +48,14 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed) {
 	PathMD5 pmd5(p_path.md5_buffer());
 
 	bool exists = files.has(pmd5);
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -247,13 +249,31 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f->get_buffer(md5, 16);
 		uint32_t flags = f->get_32();
 
-		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_COMPRESSED));
+	}
+
+	if (!mapped_packs.has(p_path)) {
+		MappedPack mp;
+		mp.file = FileAccess::open(p_path, FileAccess::READ);
+		if (mp.file.is_valid()) {
+			mp.data = mp.file->get_memory_map();
+		}
+		if (mp.data) {
+			mp.length = mp.file->get_length();
+			mapped_packs[p_path] = mp;
+		}
 	}
 
 	return true;
 }
 
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file) {
+	if (!p_file->encrypted && !p_file->compressed) {
+		const MappedPack *mp = mapped_packs.getptr(p_file->pack);
+		if (mp && p_file->offset + p_file->size <= mp->length) {
+			return memnew(FileAccessPack(*p_file, mp->data + p_file->offset));
+		}
+	}
 	return memnew(FileAccessPack(p_path, *p_file));
 }
 
@@ -265,7 +285,9 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (mapped) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -273,7 +295,7 @@ bool FileAccessPack::is_open() const {
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(!mapped && f.is_null(), "File must be opened before use.");
 
 	if (p_position > pf.size) {
 		eof = true;
@@ -281,7 +303,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!mapped && block_size == 0) {
+		f->seek(off + p_position); // Compressed entries seek when loading a block.
+	}
 	pos = p_position;
 }
 
@@ -302,18 +326,31 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint8_t FileAccessPack::get_8() const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), 0, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(!mapped && f.is_null(), 0, "File must be opened before use.");
 	if (pos >= pf.size) {
 		eof = true;
 		return 0;
 	}
 
+	if (mapped) {
+		return mapped[pos++];
+	}
+	if (block_size) {
+		if (!_load_block(pos / block_size)) {
+			eof = true;
+			return 0;
+		}
+		uint8_t b = block_data[pos % block_size];
+		pos++;
+		return b;
+	}
+
 	pos++;
 	return f->get_8();
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(!mapped && f.is_null(), -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -326,21 +363,115 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
+	uint64_t read_pos = pos;
 	pos += p_length;
 
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+	if (mapped) {
+		memcpy(p_dst, mapped + read_pos, to_read);
+	} else if (block_size) {
+		uint64_t done = 0;
+		while (done < (uint64_t)to_read) {
+			uint64_t p = read_pos + done;
+			if (!_load_block(p / block_size)) {
+				break;
+			}
+			uint64_t block_ofs = p % block_size;
+			uint64_t n = MIN((uint64_t)to_read - done, (uint64_t)block_data.size() - block_ofs);
+			memcpy(p_dst + done, block_data.ptr() + block_ofs, n);
+			done += n;
+		}
+		return done;
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+uint64_t FileAccessPack::get_buffer_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(!mapped && f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+
+	if (block_size) {
+		// Decompression goes through the shared block cache.
+		return FileAccess::get_buffer_at(p_offset, p_dst, p_length);
+	}
+	if (p_offset >= pf.size) {
+		return 0;
+	}
+
+	uint64_t to_read = MIN(p_length, pf.size - p_offset);
+	if (mapped) {
+		memcpy(p_dst, mapped + p_offset, to_read);
+		return to_read;
+	}
+	return f->get_buffer_at(off + p_offset, p_dst, to_read);
+}
+
+bool FileAccessPack::_load_block(uint32_t p_block) const {
+	if (current_block == p_block) {
+		return true;
+	}
+	ERR_FAIL_UNSIGNED_INDEX_V(p_block, (uint32_t)block_offsets.size() - 1, false);
+
+	uint64_t stored_size = block_offsets[p_block + 1] - block_offsets[p_block];
+	uint64_t size = MIN((uint64_t)block_size, pf.size - (uint64_t)p_block * block_size);
+	block_data.resize(size);
+
+	// Reading already moves the underlying position from const methods, seeking is no different.
+	const_cast<FileAccess *>(f.ptr())->seek(off + block_offsets[p_block]);
+	if (stored_size == size) {
+		ERR_FAIL_COND_V(f->get_buffer(block_data.ptrw(), size) != size, false);
+	} else {
+		block_read_buffer.resize(stored_size);
+		ERR_FAIL_COND_V(f->get_buffer(block_read_buffer.ptrw(), stored_size) != stored_size, false);
+		int ret = Compression::decompress(block_data.ptrw(), size, block_read_buffer.ptr(), stored_size, Compression::MODE_ZSTD);
+		ERR_FAIL_COND_V_MSG(ret != (int)size, false, "Corrupt compressed block in pack-referenced file '" + String(pf.pack) + "'.");
+	}
+
+	current_block = p_block;
+	return true;
+}
+
+void FileAccessPack::_open_compressed() {
+	f->seek(off);
+	uint32_t bs = f->get_32();
+	uint32_t block_count = f->get_32();
+	if (bs == 0 || block_count != (pf.size + bs - 1) / bs) {
+		f.unref();
+		ERR_FAIL_MSG("Invalid block table for compressed pack-referenced file '" + String(pf.pack) + "'.");
+	}
+
+	block_offsets.resize(block_count + 1);
+	uint64_t ofs = 8 + (uint64_t)block_count * 4;
+	for (uint32_t i = 0; i < block_count; i++) {
+		block_offsets.write[i] = ofs;
+		ofs += f->get_32();
+	}
+	block_offsets.write[block_count] = ofs;
+	block_size = bs;
+}
+
+const uint8_t *FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	if (!mapped || eof || pos + p_length > pf.size) {
+		return nullptr;
+	}
+
+	const uint8_t *view = mapped + pos;
+	pos += p_length;
+	return view;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(!mapped && f.is_null(), "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -392,6 +523,18 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 	}
 	pos = 0;
 	eof = false;
+
+	if (pf.compressed) {
+		_open_compressed();
+	}
+}
+
+FileAccessPack::FileAccessPack(const PackedData::PackedFile &p_file, const uint8_t *p_mapped) :
+		pf(p_file),
+		mapped(p_mapped) {
+	off = pf.offset;
+	pos = 0;
+	eof = false;
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -48,7 +48,9 @@ enum PackFlags {
 };
 
 enum PackFileFlags {
-	PACK_FILE_ENCRYPTED = 1 << 0
+	PACK_FILE_ENCRYPTED = 1 << 0,
+	// Stored as independently Zstd compressed blocks, see FileAccessPack.
+	PACK_FILE_COMPRESSED = 1 << 1,
 };
 
 class PackSource;
@@ -66,6 +68,7 @@ public:
 		uint8_t md5[16];
 		PackSource *src = nullptr;
 		bool encrypted;
+		bool compressed = false;
 	};
 
 private:
@@ -109,7 +112,7 @@ private:
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_compressed = false); // for PackSource
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -135,6 +138,16 @@ public:
 };
 
 class PackedSourcePCK : public PackSource {
+	struct MappedPack {
+		Ref<FileAccess> file;
+		const uint8_t *data = nullptr;
+		uint64_t length = 0;
+	};
+
+	// Packs are mapped read-only when the platform supports it, so uncompressed
+	// and unencrypted entries are served without seeks or read syscalls.
+	HashMap<String, MappedPack> mapped_packs;
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) override;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) override;
@@ -148,6 +161,20 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+	const uint8_t *mapped = nullptr; // Start of this entry inside the pack mapping, if any.
+
+	// Compressed entries start with a block table: block size, block count and
+	// the stored size of every block, followed by the blocks themselves. A block
+	// whose stored size equals its uncompressed size was kept raw.
+	uint32_t block_size = 0;
+	Vector<uint64_t> block_offsets; // Block count + 1 entries, relative to the entry start.
+	mutable Vector<uint8_t> block_data;
+	mutable Vector<uint8_t> block_read_buffer;
+	mutable int64_t current_block = -1;
+
+	bool _load_block(uint32_t p_block) const;
+	void _open_compressed();
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual uint32_t _get_unix_permissions(const String &p_file) override { return 0; }
@@ -166,6 +193,8 @@ public:
 	virtual uint8_t get_8() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual uint64_t get_buffer_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -179,6 +208,7 @@ public:
 	virtual bool file_exists(const String &p_name) override;
 
 	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file);
+	FileAccessPack(const PackedData::PackedFile &p_file, const uint8_t *p_mapped);
 };
 
 Ref<FileAccess> PackedData::try_open_path(const String &p_path) {
@@ -35,8 +35,10 @@
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/dictionary.h"
 
 #include <stdio.h>
@@ -632,8 +634,59 @@ static double _bicubic_interp_kernel(double x) {
 	return bc;
 }
 
+// Row based image processing, split into bands of destination rows
+// that are processed on the WorkerThreadPool for large enough images.
+
+struct _ImageRowsData {
+	void (*func)(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from_row, uint32_t p_to_row) = nullptr;
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	uint32_t src_width = 0;
+	uint32_t src_height = 0;
+	uint32_t dst_width = 0;
+	uint32_t dst_height = 0;
+	uint32_t rows_per_task = 0;
+};
+
+static const uint64_t _IMAGE_PARALLEL_MIN_PIXELS = 256 * 256;
+
+static void _image_rows_task(void *p_userdata, uint32_t p_index) {
+	const _ImageRowsData *data = static_cast<const _ImageRowsData *>(p_userdata);
+	uint32_t from = p_index * data->rows_per_task;
+	uint32_t to = MIN(from + data->rows_per_task, data->dst_height);
+	data->func(data->src, data->dst, data->src_width, data->src_height, data->dst_width, data->dst_height, from, to);
+}
+
+static void _image_process_rows(_ImageRowsData &p_data) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Waiting from inside the pool could leave no thread to run the bands, so process serially there.
+	if (uint64_t(p_data.dst_width) * p_data.dst_height < _IMAGE_PARALLEL_MIN_PIXELS || p_data.dst_height < 2 || !pool || pool->get_thread_count() < 2 || pool->get_thread_index() != -1) {
+		p_data.func(p_data.src, p_data.dst, p_data.src_width, p_data.src_height, p_data.dst_width, p_data.dst_height, 0, p_data.dst_height);
+		return;
+	}
+
+	uint32_t tasks = MIN(p_data.dst_height, uint32_t(pool->get_thread_count()) * 4);
+	p_data.rows_per_task = (p_data.dst_height + tasks - 1) / tasks;
+	tasks = (p_data.dst_height + p_data.rows_per_task - 1) / p_data.rows_per_task;
+
+	WorkerThreadPool::GroupID group_task = pool->add_native_group_task(&_image_rows_task, &p_data, tasks, -1, true, SNAME("ImageRows"));
+	pool->wait_for_group_task_completion(group_task);
+}
+
+static void _image_run_rows(void (*p_func)(const uint8_t *__restrict, uint8_t *__restrict, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t), const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_ImageRowsData data;
+	data.func = p_func;
+	data.src = p_src;
+	data.dst = p_dst;
+	data.src_width = p_src_width;
+	data.src_height = p_src_height;
+	data.dst_width = p_dst_width;
+	data.dst_height = p_dst_height;
+	_image_process_rows(data);
+}
+
 template <int CC, class T>
-static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from_row, uint32_t p_to_row) {
 	// get source image size
 	int width = p_src_width;
 	int height = p_src_height;
@@ -648,7 +701,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
+	for (uint32_t y = p_from_row; y < p_to_row; y++) {
 		// Y coordinates
 		oy = (double)y * yfac - 0.5f;
 		oy1 = (int)oy;
@@ -720,7 +773,12 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 }
 
 template <int CC, class T>
-static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_image_run_rows(&_scale_cubic_rows<CC, T>, p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height);
+}
+
+template <int CC, class T>
+static void _scale_bilinear_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from_row, uint32_t p_to_row) {
 	enum {
 		FRAC_BITS = 8,
 		FRAC_LEN = (1 << FRAC_BITS),
@@ -728,7 +786,25 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 		FRAC_MASK = FRAC_LEN - 1
 	};
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+	// The horizontal sampling positions are the same for every row, compute them once.
+	LocalVector<uint32_t> x_offsets;
+	x_offsets.resize(p_dst_width * 3);
+	for (uint32_t j = 0; j < p_dst_width; j++) {
+		uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
+		uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
+		uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
+		if (src_xofs_right >= p_src_width) {
+			src_xofs_right = p_src_width - 1;
+		}
+		uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
+		src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
+
+		x_offsets[j * 3 + 0] = src_xofs_left * CC;
+		x_offsets[j * 3 + 1] = src_xofs_right * CC;
+		x_offsets[j * 3 + 2] = src_xofs_frac;
+	}
+
+	for (uint32_t i = p_from_row; i < p_to_row; i++) {
 		// Add 0.5 in order to interpolate based on pixel center
 		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
 		// Calculate nearest src pixel center above current, and truncate to get y index
@@ -745,17 +821,9 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 		uint32_t y_ofs_down = src_yofs_down * p_src_width * CC;
 
 		for (uint32_t j = 0; j < p_dst_width; j++) {
-			uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
-			uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
-			uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
-			if (src_xofs_right >= p_src_width) {
-				src_xofs_right = p_src_width - 1;
-			}
-			uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
-			src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
-
-			src_xofs_left *= CC;
-			src_xofs_right *= CC;
+			uint32_t src_xofs_left = x_offsets[j * 3 + 0];
+			uint32_t src_xofs_right = x_offsets[j * 3 + 1];
+			uint32_t src_xofs_frac = x_offsets[j * 3 + 2];
 
 			for (uint32_t l = 0; l < CC; l++) {
 				if constexpr (sizeof(T) == 1) { //uint8
@@ -810,8 +878,13 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 }
 
 template <int CC, class T>
-static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_image_run_rows(&_scale_bilinear_rows<CC, T>, p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height);
+}
+
+template <int CC, class T>
+static void _scale_nearest_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from_row, uint32_t p_to_row) {
+	for (uint32_t i = p_from_row; i < p_to_row; i++) {
 		uint32_t src_yofs = i * p_src_height / p_dst_height;
 		uint32_t y_ofs = src_yofs * p_src_width * CC;
 
@@ -830,6 +903,11 @@ static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict
 	}
 }
 
+template <int CC, class T>
+static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_image_run_rows(&_scale_nearest_rows<CC, T>, p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height);
+}
+
 #define LANCZOS_TYPE 3
 
 static float _lanczos(float p_x) {
@@ -1621,15 +1699,15 @@ bool Image::_can_modify(Format p_format) const {
 template <class Component, int CC, bool renormalize,
 		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
 		void (*renormalize_func)(Component *)>
-static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
-	//fast power of 2 mipmap generation
-	uint32_t dst_w = MAX(p_width >> 1, 1u);
-	uint32_t dst_h = MAX(p_height >> 1, 1u);
+static void _generate_po2_mipmap_rows(const uint8_t *__restrict p_src_bytes, uint8_t *__restrict p_dst_bytes, uint32_t p_width, uint32_t p_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from_row, uint32_t p_to_row) {
+	const Component *p_src = reinterpret_cast<const Component *>(p_src_bytes);
+	Component *p_dst = reinterpret_cast<Component *>(p_dst_bytes);
+	uint32_t dst_w = p_dst_width;
 
 	int right_step = (p_width == 1) ? 0 : CC;
 	int down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
+	for (uint32_t i = p_from_row; i < p_to_row; i++) {
 		const Component *rup_ptr = &p_src[i * 2 * down_step];
 		const Component *rdown_ptr = rup_ptr + down_step;
 		Component *dst_ptr = &p_dst[i * dst_w * CC];
@@ -1652,6 +1730,17 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	}
 }
 
+template <class Component, int CC, bool renormalize,
+		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
+		void (*renormalize_func)(Component *)>
+static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
+	//fast power of 2 mipmap generation
+	uint32_t dst_w = MAX(p_width >> 1, 1u);
+	uint32_t dst_h = MAX(p_height >> 1, 1u);
+
+	_image_run_rows(&_generate_po2_mipmap_rows<Component, CC, renormalize, average_func, renormalize_func>, reinterpret_cast<const uint8_t *>(p_src), reinterpret_cast<uint8_t *>(p_dst), p_width, p_height, dst_w, dst_h);
+}
+
 void Image::shrink_x2() {
 	ERR_FAIL_COND(data.size() == 0);
 
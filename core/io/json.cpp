@@ -31,6 +31,7 @@
 #include "json.h"
 
 #include "core/string/print_string.h"
+#include "core/templates/local_vector.h"
 
 const char *JSON::tk_name[TK_MAX] = {
 	"'{'",
@@ -145,7 +146,102 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 	}
 }
 
-Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
+// Returns the end of the run of characters that can be copied into a string token as is,
+// stopping at quotes, escapes and control characters (which includes the null terminator).
+static _FORCE_INLINE_ int _scan_string_run(const char32_t *p_str, int p_index, int p_len) {
+	while (p_str[p_index] != '"' && p_str[p_index] != '\\' && p_str[p_index] >= 32) {
+		p_index++;
+	}
+	return p_index;
+}
+
+static _FORCE_INLINE_ int _scan_string_run(const uint8_t *p_str, int p_index, int p_len) {
+	// Test eight bytes at a time for any byte below 32, or equal to '"' or '\\'.
+	const uint64_t ones = 0x0101010101010101ULL;
+	const uint64_t highs = 0x8080808080808080ULL;
+	while (p_index + 8 <= p_len) {
+		uint64_t chunk;
+		memcpy(&chunk, &p_str[p_index], sizeof(uint64_t));
+		uint64_t quote = chunk ^ (ones * '"');
+		uint64_t backslash = chunk ^ (ones * '\\');
+		// Bytes with the high bit set (UTF-8 sequences) never match, the XORs don't change the high bit.
+		uint64_t special = ((chunk - ones * 32) | (quote - ones) | (backslash - ones)) & ~chunk & highs;
+		if (special) {
+			break;
+		}
+		p_index += 8;
+	}
+	while (p_str[p_index] != '"' && p_str[p_index] != '\\' && p_str[p_index] >= 32) {
+		p_index++;
+	}
+	return p_index;
+}
+
+static _FORCE_INLINE_ void _append_string_run(String &r_str, const char32_t *p_run, int p_len) {
+	r_str += String(p_run, p_len);
+}
+
+static _FORCE_INLINE_ void _append_string_run(String &r_str, const uint8_t *p_run, int p_len) {
+	r_str += String::utf8((const char *)p_run, p_len);
+}
+
+static _FORCE_INLINE_ double _string_to_float(const char32_t *p_str) {
+	return String::to_float(p_str);
+}
+
+static _FORCE_INLINE_ double _string_to_float(const uint8_t *p_str) {
+	return String::to_float((const char *)p_str);
+}
+
+template <class C>
+Error JSON::_parse_number(const C *p_str, int &index, Token &r_token, String &r_err_str) {
+	int start = index;
+	bool negative = p_str[index] == '-';
+	if (negative) {
+		index++;
+	}
+
+	int digits = 0;
+	int64_t int_value = 0;
+	while (is_digit(p_str[index])) {
+		int_value = int_value * 10 + (p_str[index] - '0');
+		digits++;
+		index++;
+	}
+	if (digits == 0) {
+		r_err_str = "Malformed number.";
+		return ERR_PARSE_ERROR;
+	}
+
+	// At most 18 digits always fit in an int64_t.
+	bool is_int = digits <= 18;
+	if (p_str[index] == '.') {
+		is_int = false;
+		index++;
+		while (is_digit(p_str[index])) {
+			index++;
+		}
+	}
+	if (p_str[index] == 'e' || p_str[index] == 'E') {
+		is_int = false;
+		index++;
+		if (p_str[index] == '+' || p_str[index] == '-') {
+			index++;
+		}
+		while (is_digit(p_str[index])) {
+			index++;
+		}
+	}
+
+	r_token.type = TK_NUMBER;
+	r_token.value = _string_to_float(&p_str[start]);
+	r_token.is_int = is_int;
+	r_token.int_value = negative ? -int_value : int_value;
+	return OK;
+}
+
+template <class C>
+Error JSON::_get_token(const C *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
 	while (p_len > 0) {
 		switch (p_str[index]) {
 			case '\n': {
@@ -309,10 +405,17 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 						str += res;
 
 					} else {
+						int run_end = _scan_string_run(p_str, index, p_len);
+						if (run_end > index) {
+							_append_string_run(str, &p_str[index], run_end - index);
+							index = run_end;
+							continue;
+						}
+
 						if (p_str[index] == '\n') {
 							line++;
 						}
-						str += p_str[index];
+						str += (char32_t)p_str[index];
 					}
 					index++;
 				}
@@ -330,12 +433,7 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 
 				if (p_str[index] == '-' || is_digit(p_str[index])) {
 					//a number
-					const char32_t *rptr;
-					double number = String::to_float(&p_str[index], &rptr);
-					index += (rptr - &p_str[index]);
-					r_token.type = TK_NUMBER;
-					r_token.value = number;
-					return OK;
+					return _parse_number(p_str, index, r_token, r_err_str);
 
 				} else if (is_ascii_char(p_str[index])) {
 					String id;
@@ -359,7 +457,8 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <class C>
+Error JSON::_parse_value(Variant &value, Token &token, const C *p_str, int &index, int p_len, int &line, int p_depth, bool p_packed_arrays, String &r_err_str) {
 	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
 		r_err_str = "JSON structure is too deep. Bailing.";
 		return ERR_OUT_OF_MEMORY;
@@ -367,18 +466,16 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 
 	if (token.type == TK_CURLY_BRACKET_OPEN) {
 		Dictionary d;
-		Error err = _parse_object(d, p_str, index, p_len, line, p_depth + 1, r_err_str);
+		Error err = _parse_object(d, p_str, index, p_len, line, p_depth + 1, p_packed_arrays, r_err_str);
 		if (err) {
 			return err;
 		}
 		value = d;
 	} else if (token.type == TK_BRACKET_OPEN) {
-		Array a;
-		Error err = _parse_array(a, p_str, index, p_len, line, p_depth + 1, r_err_str);
+		Error err = _parse_array(value, p_str, index, p_len, line, p_depth + 1, p_packed_arrays, r_err_str);
 		if (err) {
 			return err;
 		}
-		value = a;
 	} else if (token.type == TK_IDENTIFIER) {
 		String id = token.value;
 		if (id == "true") {
@@ -403,10 +500,18 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 	return OK;
 }
 
-Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <class C>
+Error JSON::_parse_array(Variant &r_array, const C *p_str, int &index, int p_len, int &line, int p_depth, bool p_packed_arrays, String &r_err_str) {
+	Array array;
 	Token token;
 	bool need_comma = false;
 
+	// With packed arrays, numbers are decoded straight into a packed array until a non-numeric value shows up.
+	bool numeric = p_packed_arrays;
+	bool integer = true;
+	LocalVector<double> floats;
+	LocalVector<int64_t> ints;
+
 	while (index < p_len) {
 		Error err = _get_token(p_str, index, p_len, token, line, r_err_str);
 		if (err != OK) {
@@ -414,6 +519,21 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 		}
 
 		if (token.type == TK_BRACKET_CLOSE) {
+			if (numeric && floats.size()) {
+				if (integer) {
+					PackedInt64Array packed;
+					packed.resize(ints.size());
+					memcpy(packed.ptrw(), ints.ptr(), ints.size() * sizeof(int64_t));
+					r_array = packed;
+				} else {
+					PackedFloat64Array packed;
+					packed.resize(floats.size());
+					memcpy(packed.ptrw(), floats.ptr(), floats.size() * sizeof(double));
+					r_array = packed;
+				}
+			} else {
+				r_array = array;
+			}
 			return OK;
 		}
 
@@ -427,8 +547,29 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 			}
 		}
 
+		if (numeric) {
+			if (token.type == TK_NUMBER) {
+				floats.push_back(token.value);
+				if (integer) {
+					if (token.is_int) {
+						ints.push_back(token.int_value);
+					} else {
+						integer = false;
+					}
+				}
+				need_comma = true;
+				continue;
+			}
+
+			// Not a numeric array, move what was decoded so far to a regular array.
+			numeric = false;
+			for (uint32_t i = 0; i < floats.size(); i++) {
+				array.push_back(floats[i]);
+			}
+		}
+
 		Variant v;
-		err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+		err = _parse_value(v, token, p_str, index, p_len, line, p_depth, p_packed_arrays, r_err_str);
 		if (err) {
 			return err;
 		}
@@ -441,7 +582,8 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <class C>
+Error JSON::_parse_object(Dictionary &object, const C *p_str, int &index, int p_len, int &line, int p_depth, bool p_packed_arrays, String &r_err_str) {
 	bool at_key = true;
 	String key;
 	Token token;
@@ -490,7 +632,7 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 			}
 
 			Variant v;
-			err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+			err = _parse_value(v, token, p_str, index, p_len, line, p_depth, p_packed_arrays, r_err_str);
 			if (err) {
 				return err;
 			}
@@ -508,10 +650,9 @@ void JSON::set_data(const Variant &p_data) {
 	data = p_data;
 }
 
-Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
-	const char32_t *str = p_json.ptr();
+template <class C>
+Error JSON::_parse_buffer(const C *str, int len, bool p_packed_arrays, Variant &r_ret, String &r_err_str, int &r_err_line) {
 	int idx = 0;
-	int len = p_json.length();
 	Token token;
 	r_err_line = 0;
 	String aux_key;
@@ -521,7 +662,7 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 		return err;
 	}
 
-	err = _parse_value(r_ret, token, str, idx, len, r_err_line, 0, r_err_str);
+	err = _parse_value(r_ret, token, str, idx, len, r_err_line, 0, p_packed_arrays, r_err_str);
 
 	// Check if EOF is reached
 	// or it's a type of the next token.
@@ -539,8 +680,35 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 	return err;
 }
 
-Error JSON::parse(const String &p_json_string) {
-	Error err = _parse_string(p_json_string, data, err_str, err_line);
+Error JSON::parse(const String &p_json_string, bool p_packed_arrays) {
+	Error err = _parse_buffer(p_json_string.ptr(), p_json_string.length(), p_packed_arrays, data, err_str, err_line);
+	if (err == Error::OK) {
+		err_line = 0;
+	}
+	return err;
+}
+
+Error JSON::parse_utf8(const Vector<uint8_t> &p_json_buffer, bool p_packed_arrays) {
+	// Parsing the bytes directly avoids decoding the whole input to UTF-32 first, only string values are decoded.
+	const uint8_t *str = p_json_buffer.ptr();
+	int len = p_json_buffer.size();
+
+	Vector<uint8_t> terminated;
+	if (len > 0 && str[len - 1] == 0) {
+		len--;
+	} else {
+		terminated = p_json_buffer;
+		terminated.push_back(0);
+		str = terminated.ptr();
+	}
+
+	// Skip the byte order mark.
+	int start = 0;
+	if (len >= 3 && str[0] == 0xEF && str[1] == 0xBB && str[2] == 0xBF) {
+		start = 3;
+	}
+
+	Error err = _parse_buffer(str + start, len - start, p_packed_arrays, data, err_str, err_line);
 	if (err == Error::OK) {
 		err_line = 0;
 	}
@@ -565,7 +733,8 @@ Variant JSON::parse_string(const String &p_json_string) {
 void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("stringify", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify, DEFVAL(""), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_static_method("JSON", D_METHOD("parse_string", "json_string"), &JSON::parse_string);
-	ClassDB::bind_method(D_METHOD("parse", "json_string"), &JSON::parse);
+	ClassDB::bind_method(D_METHOD("parse", "json_string", "packed_arrays"), &JSON::parse, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_utf8", "json_buffer", "packed_arrays"), &JSON::parse_utf8, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("get_data"), &JSON::get_data);
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &JSON::set_data);
@@ -592,7 +761,7 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path));
+	Error err = json->parse_utf8(FileAccess::get_file_as_bytes(p_path));
 	if (err != OK) {
 		if (r_error) {
 			*r_error = err;
@@ -63,6 +63,8 @@ class JSON : public RefCounted {
 	struct Token {
 		TokenType type;
 		Variant value;
+		bool is_int = false; // Numbers without fraction or exponent that fit in an int64_t, in int_value.
+		int64_t int_value = 0;
 	};
 
 	Variant data;
@@ -73,17 +75,26 @@ class JSON : public RefCounted {
 
 	static String _make_indent(const String &p_indent, int p_size);
 	static String _stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
-	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
-	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
+	// The parser works both on UTF-32 (String) and UTF-8 input, which must be null-terminated.
+	template <class C>
+	static Error _get_token(const C *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
+	template <class C>
+	static Error _parse_number(const C *p_str, int &index, Token &r_token, String &r_err_str);
+	template <class C>
+	static Error _parse_value(Variant &value, Token &token, const C *p_str, int &index, int p_len, int &line, int p_depth, bool p_packed_arrays, String &r_err_str);
+	template <class C>
+	static Error _parse_array(Variant &r_array, const C *p_str, int &index, int p_len, int &line, int p_depth, bool p_packed_arrays, String &r_err_str);
+	template <class C>
+	static Error _parse_object(Dictionary &object, const C *p_str, int &index, int p_len, int &line, int p_depth, bool p_packed_arrays, String &r_err_str);
+	template <class C>
+	static Error _parse_buffer(const C *p_str, int p_len, bool p_packed_arrays, Variant &r_ret, String &r_err_str, int &r_err_line);
 
 protected:
 	static void _bind_methods();
 
 public:
-	Error parse(const String &p_json_string);
+	Error parse(const String &p_json_string, bool p_packed_arrays = false);
+	Error parse_utf8(const Vector<uint8_t> &p_json_buffer, bool p_packed_arrays = false);
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
 	static Variant parse_string(const String &p_json_string);
 
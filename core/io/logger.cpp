@@ -51,30 +51,29 @@ void Logger::set_flush_stdout_on_print(bool value) {
 	_flush_stdout_on_print = value;
 }
 
-void Logger::log_error(const char *p_function, const char *p_file, int p_line, const char *p_code, const char *p_rationale, bool p_editor_notify, ErrorType p_type) {
-	if (!should_log(true)) {
-		return;
-	}
-
-	const char *err_type = "ERROR";
+const char *Logger::_get_error_type_string(ErrorType p_type) {
 	switch (p_type) {
 		case ERR_ERROR:
-			err_type = "ERROR";
-			break;
+			return "ERROR";
 		case ERR_WARNING:
-			err_type = "WARNING";
-			break;
+			return "WARNING";
 		case ERR_SCRIPT:
-			err_type = "SCRIPT ERROR";
-			break;
+			return "SCRIPT ERROR";
 		case ERR_SHADER:
-			err_type = "SHADER ERROR";
-			break;
+			return "SHADER ERROR";
 		default:
 			ERR_PRINT("Unknown error type");
-			break;
+			return "ERROR";
+	}
+}
+
+void Logger::log_error(const char *p_function, const char *p_file, int p_line, const char *p_code, const char *p_rationale, bool p_editor_notify, ErrorType p_type) {
+	if (!should_log(true)) {
+		return;
 	}
 
+	const char *err_type = _get_error_type_string(p_type);
+
 	const char *err_details;
 	if (p_rationale && *p_rationale) {
 		err_details = p_rationale;
@@ -176,10 +175,92 @@ void RotatedFileLogger::rotate_file() {
 	file->detach_from_objectdb(); // Note: This FileAccess instance will exist longer than ObjectDB, therefore can't be registered in ObjectDB.
 }
 
-RotatedFileLogger::RotatedFileLogger(const String &p_base_path, int p_max_files) :
+RotatedFileLogger::RotatedFileLogger(const String &p_base_path, int p_max_files, bool p_async) :
 		base_path(p_base_path.simplify_path()),
 		max_files(p_max_files > 0 ? p_max_files : 1) {
 	rotate_file();
+
+	if (p_async && file.is_valid()) {
+		async = true;
+		thread.start(_thread_func, this);
+	}
+}
+
+void RotatedFileLogger::_write(const char *p_buf, int p_len, bool p_flush) {
+	file->store_buffer((const uint8_t *)p_buf, p_len);
+	if (p_flush) {
+		file->flush();
+	}
+}
+
+void RotatedFileLogger::_queue_repeat_note() {
+	// Called with pending_mutex locked.
+	if (repeat_count == 0) {
+		return;
+	}
+	char note[64];
+	int len = snprintf(note, sizeof(note), "   (Previous message repeated %u times)\n", repeat_count);
+	repeat_count = 0;
+	pending.push_back(CharString(note));
+}
+
+void RotatedFileLogger::_queue_message(const char *p_buf, int p_len) {
+	MutexLock lock(pending_mutex);
+
+	if (p_len == last_message.length() && memcmp(p_buf, last_message.get_data(), p_len) == 0) {
+		repeat_count++;
+		return;
+	}
+
+	if (pending.size() >= MAX_PENDING_MESSAGES) {
+		// The writer can't keep up, drop the message rather than stall the caller.
+		dropped_count++;
+		return;
+	}
+
+	bool was_empty = pending.is_empty();
+	_queue_repeat_note();
+	last_message = CharString(p_buf);
+	pending.push_back(last_message);
+	if (was_empty) {
+		pending_semaphore.post();
+	}
+}
+
+void RotatedFileLogger::_thread_func(void *p_userdata) {
+	RotatedFileLogger *logger = (RotatedFileLogger *)p_userdata;
+	Vector<CharString> messages;
+
+	while (true) {
+		logger->pending_semaphore.wait();
+		bool exit = logger->exit_thread.is_set();
+
+		uint32_t dropped = 0;
+		{
+			MutexLock lock(logger->pending_mutex);
+			if (exit) {
+				logger->_queue_repeat_note();
+			}
+			SWAP(messages, logger->pending);
+			SWAP(dropped, logger->dropped_count);
+		}
+
+		for (int i = 0; i < messages.size(); i++) {
+			logger->_write(messages[i].get_data(), messages[i].length(), false);
+		}
+		if (dropped > 0) {
+			char note[64];
+			int len = snprintf(note, sizeof(note), "   (%u messages dropped, log queue was full)\n", dropped);
+			logger->_write(note, len, false);
+		}
+		// One flush per batch, instead of one per message on the calling thread.
+		logger->file->flush();
+		messages.clear();
+
+		if (exit) {
+			break;
+		}
+	}
 }
 
 void RotatedFileLogger::logv(const char *p_format, va_list p_list, bool p_err) {
@@ -199,17 +280,40 @@ void RotatedFileLogger::logv(const char *p_format, va_list p_list, bool p_err) {
 			vsnprintf(buf, len + 1, p_format, list_copy);
 		}
 		va_end(list_copy);
-		file->store_buffer((uint8_t *)buf, len);
+
+		if (async) {
+			_queue_message(buf, len);
+		} else {
+			// Don't always flush when printing stdout to avoid performance
+			// issues when `print()` is spammed in release builds.
+			_write(buf, len, p_err || _flush_stdout_on_print);
+		}
 
 		if (len >= static_buf_size) {
 			Memory::free_static(buf);
 		}
+	}
+}
 
-		if (p_err || _flush_stdout_on_print) {
-			// Don't always flush when printing stdout to avoid performance
-			// issues when `print()` is spammed in release builds.
-			file->flush();
-		}
+void RotatedFileLogger::log_error(const char *p_function, const char *p_file, int p_line, const char *p_code, const char *p_rationale, bool p_editor_notify, ErrorType p_type) {
+	if (!async) {
+		Logger::log_error(p_function, p_file, p_line, p_code, p_rationale, p_editor_notify, p_type);
+		return;
+	}
+	if (!should_log(true)) {
+		return;
+	}
+
+	// Queue both lines as a single message, so repeated errors can be coalesced.
+	const char *err_details = (p_rationale && *p_rationale) ? p_rationale : p_code;
+	logf_error("%s%s: %s\n   at: %s (%s:%i)\n", p_editor_notify ? "" : "USER ", _get_error_type_string(p_type), err_details, p_function, p_file, p_line);
+}
+
+RotatedFileLogger::~RotatedFileLogger() {
+	if (async) {
+		exit_thread.set();
+		pending_semaphore.post();
+		thread.wait_to_finish();
 	}
 }
 
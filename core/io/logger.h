@@ -32,7 +32,11 @@
 #define LOGGER_H
 
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
 #include "core/string/ustring.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/vector.h"
 
 #include <stdarg.h>
@@ -51,6 +55,10 @@ public:
 		ERR_SHADER
 	};
 
+protected:
+	static const char *_get_error_type_string(ErrorType p_type);
+
+public:
 	static void set_flush_stdout_on_print(bool value);
 
 	virtual void logv(const char *p_format, va_list p_list, bool p_err) _PRINTF_FORMAT_ATTRIBUTE_2_0 = 0;
@@ -76,6 +84,10 @@ public:
  * of it with timestamp appended to the file name. Maximum number of backups is configurable.
  * When maximum is reached, the oldest backups are erased. With the maximum being equal to 1,
  * it acts as a simple file logger.
+ *
+ * In asynchronous mode, messages are formatted by the caller and written by a background
+ * thread. Consecutive identical messages are coalesced into a repeat count, and messages
+ * are dropped (and counted) when the queue is full.
  */
 class RotatedFileLogger : public Logger {
 	String base_path;
@@ -83,13 +95,35 @@ class RotatedFileLogger : public Logger {
 
 	Ref<FileAccess> file;
 
+	enum {
+		MAX_PENDING_MESSAGES = 4096,
+	};
+
+	bool async = false;
+	Thread thread;
+	SafeFlag exit_thread;
+	Mutex pending_mutex;
+	Semaphore pending_semaphore;
+	Vector<CharString> pending; // Protected by pending_mutex.
+	CharString last_message; // Protected by pending_mutex.
+	uint32_t repeat_count = 0; // Protected by pending_mutex.
+	uint32_t dropped_count = 0; // Protected by pending_mutex.
+
 	void clear_old_backups();
 	void rotate_file();
 
+	void _write(const char *p_buf, int p_len, bool p_flush);
+	void _queue_message(const char *p_buf, int p_len);
+	void _queue_repeat_note();
+	static void _thread_func(void *p_userdata);
+
 public:
-	explicit RotatedFileLogger(const String &p_base_path, int p_max_files = 10);
+	explicit RotatedFileLogger(const String &p_base_path, int p_max_files = 10, bool p_async = false);
 
 	virtual void logv(const char *p_format, va_list p_list, bool p_err) override _PRINTF_FORMAT_ATTRIBUTE_2_0;
+	virtual void log_error(const char *p_function, const char *p_file, int p_line, const char *p_code, const char *p_rationale, bool p_editor_notify = false, ErrorType p_type = ERR_ERROR) override;
+
+	virtual ~RotatedFileLogger();
 };
 
 class CompositeLogger : public Logger {
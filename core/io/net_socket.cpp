@@ -31,6 +31,7 @@
 #include "net_socket.h"
 
 NetSocket *(*NetSocket::_create)() = nullptr;
+Error (*NetSocket::_poll_many)(const Ref<NetSocket> *p_sockets, int p_count, PollType p_type, int p_timeout, LocalVector<uint8_t> &r_ready) = nullptr;
 
 NetSocket *NetSocket::create() {
 	if (_create) {
@@ -40,3 +41,22 @@ NetSocket *NetSocket::create() {
 	ERR_PRINT("Unable to create network socket, platform not supported");
 	return nullptr;
 }
+
+Error NetSocket::poll_many(const Ref<NetSocket> *p_sockets, int p_count, PollType p_type, int p_timeout, LocalVector<uint8_t> &r_ready) {
+	r_ready.resize(p_count);
+	if (p_count == 0) {
+		return ERR_BUSY;
+	}
+	if (_poll_many) {
+		return _poll_many(p_sockets, p_count, p_type, p_timeout, r_ready);
+	}
+
+	// Fall back to checking each socket (timeout only applies to the first one).
+	bool any = false;
+	for (int i = 0; i < p_count; i++) {
+		Error err = p_sockets[i].is_valid() ? p_sockets[i]->poll(p_type, i == 0 ? p_timeout : 0) : FAILED;
+		r_ready[i] = err != ERR_BUSY;
+		any = any || r_ready[i];
+	}
+	return any ? OK : ERR_BUSY;
+}
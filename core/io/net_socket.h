@@ -33,20 +33,27 @@
 
 #include "core/io/ip.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 
 class NetSocket : public RefCounted {
-protected:
-	static NetSocket *(*_create)();
-
 public:
-	static NetSocket *create();
-
 	enum PollType {
 		POLL_TYPE_IN,
 		POLL_TYPE_OUT,
 		POLL_TYPE_IN_OUT
 	};
 
+protected:
+	static NetSocket *(*_create)();
+	static Error (*_poll_many)(const Ref<NetSocket> *p_sockets, int p_count, PollType p_type, int p_timeout, LocalVector<uint8_t> &r_ready);
+
+public:
+	static NetSocket *create();
+
+	// Checks many sockets at once (with a single system call when supported).
+	// r_ready[i] is set for each socket that is ready (or in error), returns ERR_BUSY if none is.
+	static Error poll_many(const Ref<NetSocket> *p_sockets, int p_count, PollType p_type, int p_timeout, LocalVector<uint8_t> &r_ready);
+
 	enum Type {
 		TYPE_NONE,
 		TYPE_TCP,
@@ -31,11 +31,16 @@
 #include "pck_packer.h"
 
 #include "core/crypto/crypto_core.h"
+#include "core/io/compression.h"
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/marshalls.h"
 #include "core/version.h"
 
+// Compressed entries are split in blocks of this size, so they can be read back at random.
+static const uint32_t COMPRESSED_BLOCK_SIZE = 65536;
+
 static int _get_pad(int p_alignment, int p_n) {
 	int rest = p_n % p_alignment;
 	int pad = 0;
@@ -48,7 +53,7 @@ static int _get_pad(int p_alignment, int p_n) {
 
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_name", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
-	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt", "compress"), &PCKPacker::add_file, DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 }
 
@@ -106,7 +111,7 @@ Error PCKPacker::pck_start(const String &p_file, int p_alignment, const String &
 	return OK;
 }
 
-Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encrypt) {
+Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encrypt, bool p_compress) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
 	Ref<FileAccess> f = FileAccess::open(p_src, FileAccess::READ);
@@ -130,8 +135,42 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 		}
 	}
 	pf.encrypted = p_encrypt;
+	pf.compressed = p_compress;
 
 	uint64_t _size = pf.size;
+	if (p_compress) {
+		uint32_t block_count = (data.size() + COMPRESSED_BLOCK_SIZE - 1) / COMPRESSED_BLOCK_SIZE;
+		uint64_t table_size = 8 + (uint64_t)block_count * 4;
+
+		Vector<uint8_t> block;
+		block.resize(Compression::get_max_compressed_buffer_size(COMPRESSED_BLOCK_SIZE, Compression::MODE_ZSTD));
+
+		pf.compressed_data.resize(table_size);
+		encode_uint32(COMPRESSED_BLOCK_SIZE, pf.compressed_data.ptrw());
+		encode_uint32(block_count, pf.compressed_data.ptrw() + 4);
+
+		for (uint32_t i = 0; i < block_count; i++) {
+			const uint8_t *src = data.ptr() + (uint64_t)i * COMPRESSED_BLOCK_SIZE;
+			int src_size = MIN((int64_t)COMPRESSED_BLOCK_SIZE, (int64_t)data.size() - (int64_t)i * COMPRESSED_BLOCK_SIZE);
+			int size = Compression::compress(block.ptrw(), src, src_size, Compression::MODE_ZSTD);
+			ERR_FAIL_COND_V_MSG(size < 0, ERR_BUG, "Failed compressing file: " + p_src + ".");
+
+			// Keep blocks that don't shrink as they are, the reader tells them apart by size.
+			const uint8_t *stored = src;
+			int stored_size = src_size;
+			if (size < src_size) {
+				stored = block.ptr();
+				stored_size = size;
+			}
+
+			uint64_t at = pf.compressed_data.size();
+			pf.compressed_data.resize(at + stored_size);
+			memcpy(pf.compressed_data.ptrw() + at, stored, stored_size);
+			encode_uint32(stored_size, pf.compressed_data.ptrw() + 8 + i * 4);
+		}
+
+		_size = pf.compressed_data.size();
+	}
 	if (p_encrypt) { // Add encryption overhead.
 		if (_size % 16) { // Pad to encryption block size.
 			_size += 16 - (_size % 16);
@@ -193,6 +232,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -229,10 +271,14 @@ Error PCKPacker::flush(bool p_verbose) {
 			ftmp = fae;
 		}
 
-		while (to_write > 0) {
-			uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
-			ftmp->store_buffer(buf, read);
-			to_write -= read;
+		if (files[i].compressed) {
+			ftmp->store_buffer(files[i].compressed_data.ptr(), files[i].compressed_data.size());
+		} else {
+			while (to_write > 0) {
+				uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
+				ftmp->store_buffer(buf, read);
+				to_write -= read;
+			}
 		}
 
 		if (fae.is_valid()) {
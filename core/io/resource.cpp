@@ -56,32 +56,32 @@ void Resource::set_path(const String &p_path, bool p_take_over) {
 		p_take_over = false; // Can't take over an empty path
 	}
 
-	ResourceCache::lock.lock();
-
-	if (!path_cache.is_empty()) {
-		ResourceCache::resources.erase(path_cache);
-	}
-
-	path_cache = "";
-
-	Ref<Resource> existing = ResourceCache::get_ref(p_path);
-
-	if (existing.is_valid()) {
-		if (p_take_over) {
-			existing->path_cache = String();
-			ResourceCache::resources.erase(p_path);
-		} else {
-			ResourceCache::lock.unlock();
-			ERR_FAIL_MSG("Another resource is loaded from path '" + p_path + "' (possible cyclic resource inclusion).");
+	ResourceCache::_erase(this);
+
+	if (!p_path.is_empty()) {
+		// Released only after the shard is unlocked, as dropping the last reference erases from the cache.
+		Ref<Resource> existing;
+
+		ResourceCache::Shard &shard = ResourceCache::_get_shard(p_path);
+		ResourceCache::_write_lock(shard);
+
+		Resource **res = shard.resources.getptr(p_path);
+		if (res) {
+			existing = Ref<Resource>(*res);
+			if (existing.is_null() || p_take_over) {
+				// Either in the process of being deleted, or being taken over.
+				(*res)->path_cache = String();
+			} else {
+				shard.lock.write_unlock();
+				ERR_FAIL_MSG("Another resource is loaded from path '" + p_path + "' (possible cyclic resource inclusion).");
+			}
 		}
-	}
 
-	path_cache = p_path;
+		path_cache = p_path;
+		shard.resources[p_path] = this;
 
-	if (!path_cache.is_empty()) {
-		ResourceCache::resources[path_cache] = this;
+		shard.lock.write_unlock();
 	}
-	ResourceCache::lock.unlock();
 
 	_resource_path_changed();
 }
@@ -448,17 +448,13 @@ Resource::Resource() :
 		remapped_list(this) {}
 
 Resource::~Resource() {
-	if (!path_cache.is_empty()) {
-		ResourceCache::lock.lock();
-		ResourceCache::resources.erase(path_cache);
-		ResourceCache::lock.unlock();
-	}
+	ResourceCache::_erase(this);
 	if (owners.size()) {
 		WARN_PRINT("Resource is still owned.");
 	}
 }
 
-HashMap<String, Resource *> ResourceCache::resources;
+ResourceCache::Shard ResourceCache::shards[ResourceCache::SHARD_COUNT];
 #ifdef TOOLS_ENABLED
 HashMap<String, HashMap<String, String>> ResourceCache::resource_path_cache;
 #endif
@@ -468,77 +464,142 @@ Mutex ResourceCache::lock;
 RWLock ResourceCache::path_cache_lock;
 #endif
 
+void ResourceCache::_read_lock(Shard &p_shard) {
+	if (p_shard.lock.read_try_lock() != OK) {
+		p_shard.contentions.increment();
+		p_shard.lock.read_lock();
+	}
+}
+
+void ResourceCache::_write_lock(Shard &p_shard) {
+	if (p_shard.lock.write_try_lock() != OK) {
+		p_shard.contentions.increment();
+		p_shard.lock.write_lock();
+	}
+}
+
+void ResourceCache::_erase(Resource *p_resource) {
+	if (p_resource->path_cache.is_empty()) {
+		return;
+	}
+
+	Shard &shard = _get_shard(p_resource->path_cache);
+	_write_lock(shard);
+
+	Resource **res = shard.resources.getptr(p_resource->path_cache);
+	if (res && *res == p_resource) {
+		shard.resources.erase(p_resource->path_cache);
+	}
+	p_resource->path_cache = String();
+
+	shard.lock.write_unlock();
+}
+
 void ResourceCache::clear() {
-	if (resources.size()) {
+	int count = get_cached_resource_count();
+	if (count) {
 		ERR_PRINT("Resources still in use at exit (run with --verbose for details).");
 		if (OS::get_singleton()->is_stdout_verbose()) {
-			for (const KeyValue<String, Resource *> &E : resources) {
-				print_line(vformat("Resource still in use: %s (%s)", E.key, E.value->get_class()));
+			for (int i = 0; i < SHARD_COUNT; i++) {
+				for (const KeyValue<String, Resource *> &E : shards[i].resources) {
+					print_line(vformat("Resource still in use: %s (%s)", E.key, E.value->get_class()));
+				}
 			}
 		}
 	}
 
-	resources.clear();
+	for (int i = 0; i < SHARD_COUNT; i++) {
+		shards[i].resources.clear();
+	}
 }
 
 void ResourceCache::reload_externals() {
 }
 
 bool ResourceCache::has(const String &p_path) {
-	lock.lock();
+	Shard &shard = _get_shard(p_path);
+	_read_lock(shard);
 
-	Resource **res = resources.getptr(p_path);
+	Resource **res = shard.resources.getptr(p_path);
+	bool dying = res && (*res)->get_reference_count() == 0;
 
-	if (res && (*res)->get_reference_count() == 0) {
-		// This resource is in the process of being deleted, ignore its existence.
-		(*res)->path_cache = String();
-		resources.erase(p_path);
-		res = nullptr;
-	}
-
-	lock.unlock();
+	shard.lock.read_unlock();
 
 	if (!res) {
 		return false;
 	}
 
-	return true;
+	if (dying) {
+		// This resource is in the process of being deleted, ignore its existence.
+		_write_lock(shard);
+		res = shard.resources.getptr(p_path);
+		if (res && (*res)->get_reference_count() == 0) {
+			(*res)->path_cache = String();
+			shard.resources.erase(p_path);
+			res = nullptr;
+		}
+		shard.lock.write_unlock();
+	}
+
+	return res != nullptr;
 }
 
 Ref<Resource> ResourceCache::get_ref(const String &p_path) {
 	Ref<Resource> ref;
-	lock.lock();
+	Shard &shard = _get_shard(p_path);
+	_read_lock(shard);
 
-	Resource **res = resources.getptr(p_path);
+	Resource **res = shard.resources.getptr(p_path);
 
 	if (res) {
 		ref = Ref<Resource>(*res);
 	}
 
+	shard.lock.read_unlock();
+
 	if (res && !ref.is_valid()) {
-		// This resource is in the process of being deleted, ignore its existence
-		(*res)->path_cache = String();
-		resources.erase(p_path);
-		res = nullptr;
+		// This resource is in the process of being deleted, ignore its existence.
+		// Check again under the write lock, as it may have been erased or replaced meanwhile.
+		_write_lock(shard);
+		res = shard.resources.getptr(p_path);
+		if (res && (*res)->get_reference_count() == 0) {
+			(*res)->path_cache = String();
+			shard.resources.erase(p_path);
+		}
+		shard.lock.write_unlock();
 	}
 
-	lock.unlock();
-
 	return ref;
 }
 
 void ResourceCache::get_cached_resources(List<Ref<Resource>> *p_resources) {
-	lock.lock();
-	for (KeyValue<String, Resource *> &E : resources) {
-		p_resources->push_back(Ref<Resource>(E.value));
+	for (int i = 0; i < SHARD_COUNT; i++) {
+		_read_lock(shards[i]);
+		for (KeyValue<String, Resource *> &E : shards[i].resources) {
+			Ref<Resource> ref = Ref<Resource>(E.value);
+			if (ref.is_valid()) {
+				p_resources->push_back(ref);
+			}
+		}
+		shards[i].lock.read_unlock();
 	}
-	lock.unlock();
 }
 
 int ResourceCache::get_cached_resource_count() {
-	lock.lock();
-	int rc = resources.size();
-	lock.unlock();
+	int rc = 0;
+	for (int i = 0; i < SHARD_COUNT; i++) {
+		_read_lock(shards[i]);
+		rc += shards[i].resources.size();
+		shards[i].lock.read_unlock();
+	}
 
 	return rc;
 }
+
+uint64_t ResourceCache::get_lock_contention_count() {
+	uint64_t count = 0;
+	for (int i = 0; i < SHARD_COUNT; i++) {
+		count += shards[i].contentions.get();
+	}
+	return count;
+}
@@ -153,8 +153,27 @@ public:
 class ResourceCache {
 	friend class Resource;
 	friend class ResourceLoader; //need the lock
-	static Mutex lock;
-	static HashMap<String, Resource *> resources;
+	static Mutex lock; // Only guards the translation remap list.
+
+	// The cache is split by path hash, so threads loading unrelated resources don't serialize on a single lock.
+	enum {
+		SHARD_COUNT = 32,
+	};
+
+	struct Shard {
+		RWLock lock;
+		HashMap<String, Resource *> resources;
+		SafeNumeric<uint64_t> contentions;
+	};
+
+	static Shard shards[SHARD_COUNT];
+
+	_FORCE_INLINE_ static Shard &_get_shard(const String &p_path) {
+		return shards[HashMapHasherDefault::hash(p_path) & (SHARD_COUNT - 1)];
+	}
+	static void _read_lock(Shard &p_shard);
+	static void _write_lock(Shard &p_shard);
+	static void _erase(Resource *p_resource);
 #ifdef TOOLS_ENABLED
 	static HashMap<String, HashMap<String, String>> resource_path_cache; // Each tscn has a set of resource paths and IDs.
 	static RWLock path_cache_lock;
@@ -169,6 +188,7 @@ public:
 	static Ref<Resource> get_ref(const String &p_path);
 	static void get_cached_resources(List<Ref<Resource>> *p_resources);
 	static int get_cached_resource_count();
+	static uint64_t get_lock_contention_count();
 };
 
 #endif // RESOURCE_H
@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/image.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
@@ -94,6 +95,8 @@ enum {
 	FORMAT_VERSION = 4,
 	FORMAT_VERSION_CAN_RENAME_DEPS = 1,
 	FORMAT_VERSION_NO_NODEPATH_PROPERTY = 3,
+	// Files up to this size are read into memory at once before their resources are parsed.
+	BUFFERED_LOAD_MAX_SIZE = 16 * 1024 * 1024,
 };
 
 void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
@@ -444,7 +447,13 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
 					} else {
-						if (external_resources[erindex].cache.is_null()) {
+						if (external_resources[erindex].load_task != WorkerThreadPool::INVALID_TASK_ID) {
+							//still loading in a worker task, wait for it now that it's needed
+							error = _resolve_external_resource(erindex);
+							if (error != OK) {
+								return error;
+							}
+						} else if (external_resources[erindex].cache.is_null()) {
 							//cache not here yet, wait for it?
 							if (use_sub_threads) {
 								Error err;
@@ -669,11 +678,38 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
+void ResourceLoaderBinary::_load_external_resource_task(void *p_userdata) {
+	ExtResource *er = (ExtResource *)p_userdata;
+	er->cache = ResourceLoader::load(er->path, er->type);
+}
+
+Error ResourceLoaderBinary::_resolve_external_resource(int p_index) {
+	ExtResource &er = external_resources.write[p_index];
+	if (er.load_task == WorkerThreadPool::INVALID_TASK_ID) {
+		return OK;
+	}
+
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(er.load_task);
+	er.load_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	if (er.cache.is_null()) {
+		if (!ResourceLoader::get_abort_on_missing_resources()) {
+			ResourceLoader::notify_dependency_error(local_path, er.path, er.type);
+		} else {
+			ERR_FAIL_V_MSG(ERR_FILE_MISSING_DEPENDENCIES, "Can't load dependency: " + er.path + ".");
+		}
+	}
+
+	return OK;
+}
+
 Error ResourceLoaderBinary::load() {
 	if (error != OK) {
 		return error;
 	}
 
+	LocalVector<int> pending_external;
+
 	for (int i = 0; i < external_resources.size(); i++) {
 		String path = external_resources[i].path;
 
@@ -689,15 +725,9 @@ Error ResourceLoaderBinary::load() {
 		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
 
 		if (!use_sub_threads) {
-			external_resources.write[i].cache = ResourceLoader::load(path, external_resources[i].type);
-
+			external_resources.write[i].cache = ResourceCache::get_ref(path);
 			if (external_resources[i].cache.is_null()) {
-				if (!ResourceLoader::get_abort_on_missing_resources()) {
-					ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
-				} else {
-					error = ERR_FILE_MISSING_DEPENDENCIES;
-					ERR_FAIL_V_MSG(error, "Can't load dependency: " + path + ".");
-				}
+				pending_external.push_back(i);
 			}
 
 		} else {
@@ -713,6 +743,34 @@ Error ResourceLoaderBinary::load() {
 		}
 	}
 
+	if (pending_external.size() == 1) {
+		// Not worth a task, load it right here.
+		ExtResource &er = external_resources.write[pending_external[0]];
+		er.cache = ResourceLoader::load(er.path, er.type);
+
+		if (er.cache.is_null()) {
+			if (!ResourceLoader::get_abort_on_missing_resources()) {
+				ResourceLoader::notify_dependency_error(local_path, er.path, er.type);
+			} else {
+				error = ERR_FILE_MISSING_DEPENDENCIES;
+				ERR_FAIL_V_MSG(error, "Can't load dependency: " + er.path + ".");
+			}
+		}
+	} else if (pending_external.size() > 1) {
+		// Load all dependencies in parallel while the internal resources are parsed.
+		// Each one is only waited for when a property actually references it.
+		// Low priority tasks are used on purpose: they don't process other tasks while
+		// waiting, so a dependency blocking on a resource shared with a sibling can't
+		// end up running (and waiting on) its own loader.
+		ExtResource *w = external_resources.ptrw();
+		for (uint32_t i = 0; i < pending_external.size(); i++) {
+			ExtResource &er = w[pending_external[i]];
+			er.load_task = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoaderBinary::_load_external_resource_task, &er, false, "Load dependency: " + er.path);
+		}
+	}
+
+	_buffer_file();
+
 	for (int i = 0; i < internal_resources.size(); i++) {
 		bool main = i == (internal_resources.size() - 1);
 
@@ -859,7 +917,16 @@ Error ResourceLoaderBinary::load() {
 		resource_cache.push_back(res);
 
 		if (main) {
+			// Dependencies nothing referenced still need to be done (and reported) before returning.
+			for (int j = 0; j < external_resources.size(); j++) {
+				error = _resolve_external_resource(j);
+				if (error != OK) {
+					return error;
+				}
+			}
+
 			f.unref();
+			file_buffer.clear();
 			resource = res;
 			resource->set_as_translation_remapped(translation_remapped);
 			error = OK;
@@ -870,6 +937,46 @@ Error ResourceLoaderBinary::load() {
 	return ERR_FILE_EOF;
 }
 
+void ResourceLoaderBinary::_buffer_file() {
+	// Parsing issues many small reads and a seek per resource, which are much
+	// cheaper on memory than on a file (or a compressed file, that has to
+	// decompress the block again after each seek).
+	if (internal_resources.is_empty() || Ref<FileAccessMemory>(f).is_valid()) {
+		return;
+	}
+
+	const uint64_t start = internal_resources[0].offset;
+	const uint64_t length = f->get_length();
+	if (length <= start || length > BUFFERED_LOAD_MAX_SIZE) {
+		return;
+	}
+
+	// Offsets in the file are absolute, map the whole file so they stay valid.
+	file_buffer.resize(length);
+	f->seek(start);
+	if (f->get_buffer(file_buffer.ptrw() + start, length - start) != length - start) {
+		// Let the regular path report the error.
+		file_buffer.clear();
+		return;
+	}
+
+	Ref<FileAccessMemory> fm;
+	fm.instantiate();
+	fm->open_custom(file_buffer.ptr(), length);
+	fm->set_big_endian(f->is_big_endian());
+	fm->real_is_double = f->real_is_double;
+	f = fm;
+}
+
+ResourceLoaderBinary::~ResourceLoaderBinary() {
+	// Loading may have failed midway, tasks hold pointers into external_resources.
+	for (int i = 0; i < external_resources.size(); i++) {
+		if (external_resources[i].load_task != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(external_resources[i].load_task);
+		}
+	}
+}
+
 void ResourceLoaderBinary::set_translation_remapped(bool p_remapped) {
 	translation_remapped = p_remapped;
 }
@@ -1983,6 +2090,56 @@ static String _resource_get_class(Ref<Resource> p_resource) {
 	}
 }
 
+// Write-only file that appends to a memory buffer, used to serialize resources on worker threads.
+class FileAccessResourceBuffer : public FileAccess {
+	LocalVector<uint8_t> *data = nullptr;
+
+public:
+	virtual Error open_internal(const String &p_path, int p_mode_flags) override { return ERR_UNAVAILABLE; }
+	virtual bool is_open() const override { return data != nullptr; }
+
+	virtual void seek(uint64_t p_position) override { ERR_FAIL_MSG("Seeking is not supported."); }
+	virtual void seek_end(int64_t p_position) override { ERR_FAIL_MSG("Seeking is not supported."); }
+	virtual uint64_t get_position() const override { return data->size(); }
+	virtual uint64_t get_length() const override { return data->size(); }
+
+	virtual bool eof_reached() const override { return true; }
+	virtual uint8_t get_8() const override { ERR_FAIL_V_MSG(0, "Reading is not supported."); }
+	virtual Error get_error() const override { return OK; }
+
+	virtual void flush() override {}
+	virtual void store_8(uint8_t p_byte) override { data->push_back(p_byte); }
+	virtual void store_buffer(const uint8_t *p_src, uint64_t p_length) override {
+		uint32_t size = data->size();
+		data->resize(size + p_length);
+		memcpy(data->ptr() + size, p_src, p_length);
+	}
+
+	virtual bool file_exists(const String &p_name) override { return false; }
+
+	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
+	virtual uint32_t _get_unix_permissions(const String &p_file) override { return 0; }
+	virtual Error _set_unix_permissions(const String &p_file, uint32_t p_permissions) override { return FAILED; }
+
+	FileAccessResourceBuffer(LocalVector<uint8_t> *p_data, bool p_big_endian) {
+		data = p_data;
+		big_endian = p_big_endian;
+	}
+};
+
+void ResourceFormatSaverBinaryInstance::_write_resource_task(uint32_t p_index, WriteResourcesData *p_data) {
+	const ResourceData &rd = *p_data->resources[p_index];
+	Ref<FileAccess> f = memnew(FileAccessResourceBuffer(&p_data->buffers.write[p_index], big_endian));
+
+	save_unicode_string(f, rd.type);
+	f->store_32(rd.properties.size());
+
+	for (const Property &p : rd.properties) {
+		f->store_32(p.name_idx);
+		write_variant(f, p.value, *p_data->resource_map, external_resources, string_map, p.pi);
+	}
+}
+
 Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags) {
 	Error err;
 	Ref<FileAccess> f;
@@ -2182,14 +2339,33 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 	Vector<uint64_t> ofs_table;
 
 	//now actually save the resources
-	for (const ResourceData &rd : resources) {
-		ofs_table.push_back(f->get_position());
-		save_unicode_string(f, rd.type);
-		f->store_32(rd.properties.size());
-
-		for (const Property &p : rd.properties) {
-			f->store_32(p.name_idx);
-			write_variant(f, p.value, resource_map, external_resources, string_map, p.pi);
+	if (resources.size() >= PARALLEL_SAVE_MIN_RESOURCES) {
+		// Property values were all read above, so the resources can be serialized on worker threads into
+		// separate buffers, which only read the lookup tables. The buffers are then written in order.
+		WriteResourcesData write_data;
+		write_data.resource_map = &resource_map;
+		write_data.buffers.resize(resources.size());
+		for (const ResourceData &rd : resources) {
+			write_data.resources.push_back(&rd);
+		}
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceFormatSaverBinaryInstance::_write_resource_task, &write_data, write_data.resources.size(), -1, true, SNAME("ResourceSaverBinary"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (int i = 0; i < write_data.buffers.size(); i++) {
+			ofs_table.push_back(f->get_position());
+			f->store_buffer(write_data.buffers[i].ptr(), write_data.buffers[i].size());
+		}
+	} else {
+		for (const ResourceData &rd : resources) {
+			ofs_table.push_back(f->get_position());
+			save_unicode_string(f, rd.type);
+			f->store_32(rd.properties.size());
+
+			for (const Property &p : rd.properties) {
+				f->store_32(p.name_idx);
+				write_variant(f, p.value, resource_map, external_resources, string_map, p.pi);
+			}
 		}
 	}
 
@@ -34,6 +34,8 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -44,6 +46,7 @@ class ResourceLoaderBinary {
 	uint32_t ver_format = 0;
 
 	Ref<FileAccess> f;
+	Vector<uint8_t> file_buffer;
 
 	uint64_t importmd_ofs = 0;
 
@@ -61,6 +64,7 @@ class ResourceLoaderBinary {
 		String type;
 		ResourceUID::ID uid = ResourceUID::INVALID_ID;
 		Ref<Resource> cache;
+		WorkerThreadPool::TaskID load_task = WorkerThreadPool::INVALID_TASK_ID;
 	};
 
 	bool using_named_scene_ids = false;
@@ -79,6 +83,7 @@ class ResourceLoaderBinary {
 
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
+	void _buffer_file();
 
 	HashMap<String, String> remaps;
 	Error error = OK;
@@ -89,6 +94,9 @@ class ResourceLoaderBinary {
 
 	Error parse_variant(Variant &r_v);
 
+	static void _load_external_resource_task(void *p_userdata);
+	Error _resolve_external_resource(int p_index);
+
 	HashMap<String, Ref<Resource>> dependency_cache;
 
 public:
@@ -104,6 +112,7 @@ public:
 	void get_classes_used(Ref<FileAccess> p_f, HashSet<StringName> *p_classes);
 
 	ResourceLoaderBinary() {}
+	~ResourceLoaderBinary();
 };
 
 class ResourceFormatLoaderBinary : public ResourceFormatLoader {
@@ -155,6 +164,14 @@ class ResourceFormatSaverBinaryInstance {
 		List<Property> properties;
 	};
 
+	struct WriteResourcesData {
+		Vector<const ResourceData *> resources;
+		Vector<LocalVector<uint8_t>> buffers;
+		HashMap<Ref<Resource>, int> *resource_map = nullptr;
+	};
+
+	void _write_resource_task(uint32_t p_index, WriteResourcesData *p_data);
+
 	static void _pad_buffer(Ref<FileAccess> f, int p_bytes);
 	void _find_resources(const Variant &p_variant, bool p_main = false);
 	static void save_unicode_string(Ref<FileAccess> f, const String &p_string, bool p_bit_on_len = false);
@@ -167,7 +184,10 @@ public:
 		FORMAT_FLAG_REAL_T_IS_DOUBLE = 4,
 
 		// Amount of reserved 32-bit fields in resource header
-		RESERVED_FIELDS = 11
+		RESERVED_FIELDS = 11,
+
+		// Minimum amount of internal resources to serialize them on worker threads
+		PARALLEL_SAVE_MIN_RESOURCES = 32
 	};
 	Error save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags = 0);
 	static void write_variant(Ref<FileAccess> f, const Variant &p_property, HashMap<Ref<Resource>, int> &resource_map, HashMap<Ref<Resource>, int> &external_resources, HashMap<StringName, int> &string_map, const PropertyInfo &p_hint = PropertyInfo());
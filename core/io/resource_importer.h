@@ -141,6 +141,8 @@ public:
 	virtual bool can_import_threaded() const { return true; }
 	virtual void import_threaded_begin() {}
 	virtual void import_threaded_end() {}
+	// Whether the result only depends on the source file, the options and get_import_settings_string(), so it can be reused from the import cache.
+	virtual bool can_cache_import(const HashMap<StringName, Variant> &p_options) const { return false; }
 
 	virtual Error import_group_file(const String &p_group_file, const HashMap<String, HashMap<StringName, Variant>> &p_source_file_options, const HashMap<String, String> &p_base_paths) { return ERR_UNAVAILABLE; }
 	virtual bool are_import_settings_valid(const String &p_path) const { return true; }
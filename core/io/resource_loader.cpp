@@ -31,6 +31,7 @@
 #include "resource_loader.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/trace_profiler.h"
 #include "core/io/file_access.h"
 #include "core/io/resource_importer.h"
 #include "core/os/os.h"
@@ -195,6 +196,7 @@ void ResourceFormatLoader::_bind_methods() {
 ///////////////////////////////////
 
 Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_original_path, const String &p_type_hint, ResourceFormatLoader::CacheMode p_cache_mode, Error *r_error, bool p_use_sub_threads, float *r_progress) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_RESOURCES);
 	bool found = false;
 
 	// Try all loaders and pick the first match for the type hint
@@ -223,6 +225,7 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 }
 
 void ResourceLoader::_thread_load_function(void *p_userdata) {
+	TRACE_ZONE("ResourceLoader::load_threaded");
 	ThreadLoadTask &load_task = *(ThreadLoadTask *)p_userdata;
 	load_task.loader_id = Thread::get_caller_id();
 
@@ -483,6 +486,26 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 			}
 			return Ref<Resource>();
 		}
+	} else if (load_task.status == THREAD_LOAD_IN_PROGRESS && load_task.loader_id != Thread::get_caller_id()) {
+		// Being loaded by a plain load() from another thread (no semaphore to wait on),
+		// poll until it's done rather than returning an empty resource.
+		while (true) {
+			thread_load_mutex->unlock();
+			OS::get_singleton()->delay_usec(100);
+			thread_load_mutex->lock();
+
+			ThreadLoadTask *task = thread_load_tasks.getptr(local_path);
+			if (!task) {
+				thread_load_mutex->unlock();
+				if (r_error) {
+					*r_error = ERR_INVALID_PARAMETER;
+				}
+				return Ref<Resource>();
+			}
+			if (task->status != THREAD_LOAD_IN_PROGRESS) {
+				break;
+			}
+		}
 	}
 
 	Ref<Resource> resource = load_task.resource;
@@ -81,6 +81,9 @@ public:
 	// Wait or check for writable, readable.
 	Error wait(NetSocket::PollType p_type, int p_timeout = 0);
 
+	// The underlying socket, e.g. to check many streams at once via NetSocket::poll_many.
+	Ref<NetSocket> get_socket() const { return _sock; }
+
 	// Read/Write from StreamPeer
 	Error put_data(const uint8_t *p_data, int p_bytes) override;
 	Error put_partial_data(const uint8_t *p_data, int p_bytes, int &r_sent) override;
@@ -32,6 +32,7 @@
 
 #include "core/math/geometry_3d.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 
 int64_t AStar3D::get_available_point_id() const {
 	if (points.has(last_free_id)) {
@@ -62,9 +63,16 @@ void AStar3D::add_point(int64_t p_id, const Vector3 &p_pos, real_t p_weight_scal
 		pt->closed_pass = 0;
 		pt->enabled = true;
 		points.set(p_id, pt);
+		_invalidate_bake();
 	} else {
 		found_pt->pos = p_pos;
 		found_pt->weight_scale = p_weight_scale;
+
+		uint32_t idx;
+		if (baked && baked_indices.lookup(p_id, idx)) {
+			baked_points[idx].pos = p_pos;
+			baked_points[idx].weight_scale = p_weight_scale;
+		}
 	}
 }
 
@@ -82,6 +90,11 @@ void AStar3D::set_point_position(int64_t p_id, const Vector3 &p_pos) {
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't set point's position. Point with id: %d doesn't exist.", p_id));
 
 	p->pos = p_pos;
+
+	uint32_t idx;
+	if (baked && baked_indices.lookup(p_id, idx)) {
+		baked_points[idx].pos = p_pos;
+	}
 }
 
 real_t AStar3D::get_point_weight_scale(int64_t p_id) const {
@@ -99,6 +112,11 @@ void AStar3D::set_point_weight_scale(int64_t p_id, real_t p_weight_scale) {
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't set point's weight scale less than 0.0: %f.", p_weight_scale));
 
 	p->weight_scale = p_weight_scale;
+
+	uint32_t idx;
+	if (baked && baked_indices.lookup(p_id, idx)) {
+		baked_points[idx].weight_scale = p_weight_scale;
+	}
 }
 
 void AStar3D::remove_point(int64_t p_id) {
@@ -125,6 +143,7 @@ void AStar3D::remove_point(int64_t p_id) {
 	memdelete(p);
 	points.remove(p_id);
 	last_free_id = p_id;
+	_invalidate_bake();
 }
 
 void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool bidirectional) {
@@ -139,6 +158,7 @@ void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool bidirectional
 	ERR_FAIL_COND_MSG(!to_exists, vformat("Can't connect points. Point with id: %d doesn't exist.", p_with_id));
 
 	a->neighbours.set(b->id, b);
+	_invalidate_bake();
 
 	if (bidirectional) {
 		b->neighbours.set(a->id, a);
@@ -179,6 +199,8 @@ void AStar3D::disconnect_points(int64_t p_id, int64_t p_with_id, bool bidirectio
 
 	HashSet<Segment, Segment>::Iterator element = segments.find(s);
 	if (element) {
+		_invalidate_bake();
+
 		// s is the new segment
 		// Erase the directions to be removed
 		s.direction = (element->direction & ~remove_direction);
@@ -248,6 +270,7 @@ void AStar3D::clear() {
 	}
 	segments.clear();
 	points.clear();
+	_invalidate_bake();
 }
 
 int64_t AStar3D::get_point_count() const {
@@ -429,6 +452,23 @@ Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id) {
 		return ret;
 	}
 
+	if (baked) {
+		uint32_t begin_idx = 0, end_idx = 0;
+		baked_indices.lookup(p_from_id, begin_idx);
+		baked_indices.lookup(p_to_id, end_idx);
+
+		Vector<int64_t> id_path = _get_baked_id_path(baked_context, begin_idx, end_idx);
+		Vector<Vector3> path;
+		path.resize(id_path.size());
+		Vector3 *w = path.ptrw();
+		for (int i = 0; i < id_path.size(); i++) {
+			uint32_t idx = 0;
+			baked_indices.lookup(id_path[i], idx);
+			w[i] = baked_points[idx].pos;
+		}
+		return path;
+	}
+
 	Point *begin_point = a;
 	Point *end_point = b;
 
@@ -478,6 +518,13 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
 		return ret;
 	}
 
+	if (baked) {
+		uint32_t begin_idx = 0, end_idx = 0;
+		baked_indices.lookup(p_from_id, begin_idx);
+		baked_indices.lookup(p_to_id, end_idx);
+		return _get_baked_id_path(baked_context, begin_idx, end_idx);
+	}
+
 	Point *begin_point = a;
 	Point *end_point = b;
 
@@ -512,12 +559,285 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
 	return path;
 }
 
+void AStar3D::SolveContext::sift_up(uint32_t p_index) {
+	uint32_t point = open_list[p_index];
+	while (p_index > 0) {
+		uint32_t parent = (p_index - 1) / 2;
+		if (!is_better(point, open_list[parent])) {
+			break;
+		}
+		open_list[p_index] = open_list[parent];
+		states[open_list[p_index]].heap_index = p_index;
+		p_index = parent;
+	}
+	open_list[p_index] = point;
+	states[point].heap_index = p_index;
+}
+
+void AStar3D::SolveContext::push(uint32_t p_point) {
+	open_list.push_back(p_point);
+	sift_up(open_list.size() - 1);
+}
+
+void AStar3D::SolveContext::pop() {
+	uint32_t last = open_list[open_list.size() - 1];
+	open_list.resize(open_list.size() - 1);
+
+	uint32_t size = open_list.size();
+	if (size == 0) {
+		return;
+	}
+
+	uint32_t index = 0;
+	while (true) {
+		uint32_t child = index * 2 + 1;
+		if (child >= size) {
+			break;
+		}
+		if (child + 1 < size && is_better(open_list[child + 1], open_list[child])) {
+			child++;
+		}
+		if (!is_better(open_list[child], last)) {
+			break;
+		}
+		open_list[index] = open_list[child];
+		states[open_list[index]].heap_index = index;
+		index = child;
+	}
+	open_list[index] = last;
+	states[last].heap_index = index;
+}
+
+void AStar3D::_invalidate_bake() {
+	if (!baked) {
+		return;
+	}
+
+	baked = false;
+	baked_points.reset();
+	baked_offsets.reset();
+	baked_neighbours.reset();
+	baked_indices.clear();
+	baked_context.states.reset();
+	baked_context.open_list.reset();
+}
+
+void AStar3D::bake() {
+	_invalidate_bake();
+
+	uint32_t count = points.get_num_elements();
+	baked_points.resize(count);
+	baked_offsets.resize(count + 1);
+	baked_indices.reserve(MAX(count, 1u));
+
+	uint32_t idx = 0;
+	uint32_t neighbour_count = 0;
+	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		const Point *p = *it.value;
+		baked_indices.set(p->id, idx);
+
+		BakedPoint &bp = baked_points[idx];
+		bp.id = p->id;
+		bp.pos = p->pos;
+		bp.weight_scale = p->weight_scale;
+		bp.enabled = p->enabled;
+
+		baked_offsets[idx] = neighbour_count;
+		neighbour_count += p->neighbours.get_num_elements();
+		idx++;
+	}
+	baked_offsets[count] = neighbour_count;
+
+	baked_neighbours.resize(neighbour_count);
+	idx = 0;
+	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		uint32_t offset = baked_offsets[idx];
+		const Point *p = *it.value;
+		for (OAHashMap<int64_t, Point *>::Iterator n = p->neighbours.iter(); n.valid; n = p->neighbours.next_iter(n)) {
+			baked_indices.lookup(*n.key, baked_neighbours[offset++]);
+		}
+		idx++;
+	}
+
+	baked = true;
+}
+
+bool AStar3D::is_baked() const {
+	return baked;
+}
+
+bool AStar3D::_solve_baked(SolveContext &r_context, uint32_t p_begin, uint32_t p_end) {
+	const BakedPoint *pts = baked_points.ptr();
+	if (!pts[p_end].enabled) {
+		return false;
+	}
+
+	if (r_context.states.size() != baked_points.size()) {
+		r_context.states.resize(baked_points.size());
+		for (uint32_t i = 0; i < r_context.states.size(); i++) {
+			r_context.states[i].open_pass = 0;
+			r_context.states[i].closed_pass = 0;
+		}
+		r_context.pass = 0;
+	}
+
+	r_context.pass++;
+	if (r_context.pass == 0) {
+		// The counter wrapped around, so the old passes can't be told apart from the new ones anymore.
+		for (uint32_t i = 0; i < r_context.states.size(); i++) {
+			r_context.states[i].open_pass = 0;
+			r_context.states[i].closed_pass = 0;
+		}
+		r_context.pass = 1;
+	}
+
+	const uint32_t current_pass = r_context.pass;
+	SolveState *states = r_context.states.ptr();
+	const int64_t end_id = pts[p_end].id;
+
+	r_context.open_list.clear();
+	states[p_begin].g_score = 0;
+	states[p_begin].f_score = _estimate_cost(pts[p_begin].id, end_id);
+	states[p_begin].open_pass = current_pass;
+	r_context.push(p_begin);
+
+	while (!r_context.open_list.is_empty()) {
+		uint32_t p = r_context.open_list[0]; // The currently processed point.
+
+		if (p == p_end) {
+			return true;
+		}
+
+		r_context.pop();
+		states[p].closed_pass = current_pass;
+
+		for (uint32_t i = baked_offsets[p]; i < baked_offsets[p + 1]; i++) {
+			uint32_t e = baked_neighbours[i];
+
+			if (!pts[e].enabled || states[e].closed_pass == current_pass) {
+				continue;
+			}
+
+			real_t tentative_g_score = states[p].g_score + _compute_cost(pts[p].id, pts[e].id) * pts[e].weight_scale;
+
+			bool new_point = false;
+
+			if (states[e].open_pass != current_pass) { // The point wasn't inside the open list.
+				states[e].open_pass = current_pass;
+				new_point = true;
+			} else if (tentative_g_score >= states[e].g_score) { // The new path is worse than the previous.
+				continue;
+			}
+
+			states[e].prev_point = p;
+			states[e].g_score = tentative_g_score;
+			states[e].f_score = tentative_g_score + _estimate_cost(pts[e].id, end_id);
+
+			if (new_point) {
+				r_context.push(e);
+			} else {
+				r_context.sift_up(states[e].heap_index);
+			}
+		}
+	}
+
+	return false;
+}
+
+Vector<int64_t> AStar3D::_get_baked_id_path(SolveContext &r_context, uint32_t p_begin, uint32_t p_end) {
+	Vector<int64_t> path;
+
+	if (p_begin == p_end) {
+		path.push_back(baked_points[p_begin].id);
+		return path;
+	}
+
+	if (!_solve_baked(r_context, p_begin, p_end)) {
+		return path;
+	}
+
+	int64_t pc = 1; // Begin point
+	for (uint32_t p = p_end; p != p_begin; p = r_context.states[p].prev_point) {
+		pc++;
+	}
+
+	path.resize(pc);
+	int64_t *w = path.ptrw();
+	int64_t idx = pc - 1;
+	for (uint32_t p = p_end; p != p_begin; p = r_context.states[p].prev_point) {
+		w[idx--] = baked_points[p].id;
+	}
+	w[0] = baked_points[p_begin].id; // Assign first
+
+	return path;
+}
+
+void AStar3D::_solve_batch(uint32_t p_task, BatchSolve *p_batch) {
+	uint32_t from = p_task * p_batch->queries_per_task;
+	uint32_t to = MIN(from + p_batch->queries_per_task, p_batch->from.size());
+	for (uint32_t i = from; i < to; i++) {
+		if (p_batch->from[i] == UINT32_MAX || p_batch->to[i] == UINT32_MAX) {
+			continue;
+		}
+		p_batch->paths[i] = _get_baked_id_path(p_batch->contexts[p_task], p_batch->from[i], p_batch->to[i]);
+	}
+}
+
+TypedArray<PackedInt64Array> AStar3D::get_id_paths(const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids) {
+	TypedArray<PackedInt64Array> ret;
+	ERR_FAIL_COND_V_MSG(p_from_ids.size() != p_to_ids.size(), ret, vformat("Can't get id paths. The number of begin points (%d) and end points (%d) must match.", p_from_ids.size(), p_to_ids.size()));
+
+	uint32_t count = p_from_ids.size();
+	ret.resize(count);
+
+	// Script cost callbacks can't be called from several threads, so only baked graphs with the built-in costs are solved in parallel.
+	if (!baked || GDVIRTUAL_IS_OVERRIDDEN(_estimate_cost) || GDVIRTUAL_IS_OVERRIDDEN(_compute_cost) || count < 2) {
+		for (uint32_t i = 0; i < count; i++) {
+			ret[i] = get_id_path(p_from_ids[i], p_to_ids[i]);
+		}
+		return ret;
+	}
+
+	BatchSolve batch;
+	batch.from.resize(count);
+	batch.to.resize(count);
+	batch.paths.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		if (!baked_indices.lookup(p_from_ids[i], batch.from[i])) {
+			ERR_PRINT(vformat("Can't get id path. Point with id: %d doesn't exist.", p_from_ids[i]));
+			batch.from[i] = UINT32_MAX;
+		}
+		if (!baked_indices.lookup(p_to_ids[i], batch.to[i])) {
+			ERR_PRINT(vformat("Can't get id path. Point with id: %d doesn't exist.", p_to_ids[i]));
+			batch.to[i] = UINT32_MAX;
+		}
+	}
+
+	uint32_t task_count = MIN(count, (uint32_t)MAX(WorkerThreadPool::get_singleton()->get_thread_count(), 1));
+	batch.queries_per_task = (count + task_count - 1) / task_count;
+	batch.contexts.resize(task_count);
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AStar3D::_solve_batch, &batch, task_count, -1, true, SNAME("AStar3DSolveBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (uint32_t i = 0; i < count; i++) {
+		ret[i] = batch.paths[i];
+	}
+
+	return ret;
+}
+
 void AStar3D::set_point_disabled(int64_t p_id, bool p_disabled) {
 	Point *p;
 	bool p_exists = points.lookup(p_id, p);
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't set if point is disabled. Point with id: %d doesn't exist.", p_id));
 
 	p->enabled = !p_disabled;
+
+	uint32_t idx;
+	if (baked && baked_indices.lookup(p_id, idx)) {
+		baked_points[idx].enabled = !p_disabled;
+	}
 }
 
 bool AStar3D::is_point_disabled(int64_t p_id) const {
@@ -557,6 +877,10 @@ void AStar3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id"), &AStar3D::get_point_path);
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id"), &AStar3D::get_id_path);
+	ClassDB::bind_method(D_METHOD("get_id_paths", "from_ids", "to_ids"), &AStar3D::get_id_paths);
+
+	ClassDB::bind_method(D_METHOD("bake"), &AStar3D::bake);
+	ClassDB::bind_method(D_METHOD("is_baked"), &AStar3D::is_baked);
 
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "to_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
@@ -34,7 +34,9 @@
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
+#include "core/variant/typed_array.h"
 
 /**
 	A* pathfinding algorithm.
@@ -105,14 +107,68 @@ class AStar3D : public RefCounted {
 		}
 	};
 
+	// Compact copy of the graph built by bake(), with the connections in compressed sparse row layout.
+	struct BakedPoint {
+		int64_t id = 0;
+		Vector3 pos;
+		real_t weight_scale = 0;
+		bool enabled = false;
+	};
+
+	// Search state of a baked query, kept apart from the graph so several queries can be solved at once.
+	struct SolveState {
+		real_t g_score = 0;
+		real_t f_score = 0;
+		uint32_t prev_point = 0;
+		uint32_t heap_index = 0;
+		uint32_t open_pass = 0;
+		uint32_t closed_pass = 0;
+	};
+
+	struct SolveContext {
+		LocalVector<SolveState> states;
+		LocalVector<uint32_t> open_list; // Binary heap of point indices, best point first.
+		uint32_t pass = 0;
+
+		_FORCE_INLINE_ bool is_better(uint32_t p_a, uint32_t p_b) const {
+			const SolveState &a = states[p_a];
+			const SolveState &b = states[p_b];
+			// If the f_costs are the same then prioritize the points that are further away from the start.
+			return a.f_score < b.f_score || (a.f_score == b.f_score && a.g_score > b.g_score);
+		}
+		void sift_up(uint32_t p_index);
+		void push(uint32_t p_point);
+		void pop();
+	};
+
+	struct BatchSolve {
+		LocalVector<uint32_t> from;
+		LocalVector<uint32_t> to;
+		LocalVector<Vector<int64_t>> paths;
+		LocalVector<SolveContext> contexts;
+		uint32_t queries_per_task = 0;
+	};
+
 	int64_t last_free_id = 0;
 	uint64_t pass = 1;
 
 	OAHashMap<int64_t, Point *> points;
 	HashSet<Segment, Segment> segments;
 
+	bool baked = false;
+	LocalVector<BakedPoint> baked_points;
+	LocalVector<uint32_t> baked_offsets; // Neighbours of point i are in baked_neighbours[baked_offsets[i]] to baked_neighbours[baked_offsets[i + 1] - 1].
+	LocalVector<uint32_t> baked_neighbours;
+	OAHashMap<int64_t, uint32_t> baked_indices;
+	SolveContext baked_context;
+
 	bool _solve(Point *begin_point, Point *end_point);
 
+	void _invalidate_bake();
+	bool _solve_baked(SolveContext &r_context, uint32_t p_begin, uint32_t p_end);
+	Vector<int64_t> _get_baked_id_path(SolveContext &r_context, uint32_t p_begin, uint32_t p_end);
+	void _solve_batch(uint32_t p_task, BatchSolve *p_batch);
+
 protected:
 	static void _bind_methods();
 
@@ -152,6 +208,10 @@ public:
 
 	Vector<Vector3> get_point_path(int64_t p_from_id, int64_t p_to_id);
 	Vector<int64_t> get_id_path(int64_t p_from_id, int64_t p_to_id);
+	TypedArray<PackedInt64Array> get_id_paths(const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids);
+
+	void bake();
+	bool is_baked() const;
 
 	AStar3D() {}
 	~AStar3D();
@@ -30,6 +30,8 @@
 
 #include "a_star_grid_2d.h"
 
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/sort_array.h"
 #include "core/variant/typed_array.h"
 
 static real_t heuristic_euclidian(const Vector2i &p_from, const Vector2i &p_to) {
@@ -103,6 +105,8 @@ void AStarGrid2D::update() {
 		points.push_back(line);
 	}
 	dirty = false;
+	clusters_dirty = true;
+	flow_fields.clear();
 }
 
 bool AStarGrid2D::is_in_bounds(int p_x, int p_y) const {
@@ -125,9 +129,40 @@ bool AStarGrid2D::is_jumping_enabled() const {
 	return jumping_enabled;
 }
 
+void AStarGrid2D::set_hierarchical_enabled(bool p_enabled) {
+	if (hierarchical_enabled == p_enabled) {
+		return;
+	}
+	hierarchical_enabled = p_enabled;
+	if (!hierarchical_enabled) {
+		clusters.clear();
+		dirty_clusters.clear();
+		node_clusters.clear();
+	}
+	clusters_dirty = true;
+}
+
+bool AStarGrid2D::is_hierarchical_enabled() const {
+	return hierarchical_enabled;
+}
+
+void AStarGrid2D::set_cluster_size(int p_cluster_size) {
+	ERR_FAIL_COND_MSG(p_cluster_size < 2, "Cluster size must be at least 2.");
+	if (cluster_size != p_cluster_size) {
+		cluster_size = p_cluster_size;
+		clusters_dirty = true;
+	}
+}
+
+int AStarGrid2D::get_cluster_size() const {
+	return cluster_size;
+}
+
 void AStarGrid2D::set_diagonal_mode(DiagonalMode p_diagonal_mode) {
 	ERR_FAIL_INDEX((int)p_diagonal_mode, (int)DIAGONAL_MODE_MAX);
 	diagonal_mode = p_diagonal_mode;
+	clusters_dirty = true;
+	flow_fields.clear();
 }
 
 AStarGrid2D::DiagonalMode AStarGrid2D::get_diagonal_mode() const {
@@ -137,6 +172,8 @@ AStarGrid2D::DiagonalMode AStarGrid2D::get_diagonal_mode() const {
 void AStarGrid2D::set_default_heuristic(Heuristic p_heuristic) {
 	ERR_FAIL_INDEX((int)p_heuristic, (int)HEURISTIC_MAX);
 	default_heuristic = p_heuristic;
+	clusters_dirty = true;
+	flow_fields.clear();
 }
 
 AStarGrid2D::Heuristic AStarGrid2D::get_default_heuristic() const {
@@ -146,7 +183,12 @@ AStarGrid2D::Heuristic AStarGrid2D::get_default_heuristic() const {
 void AStarGrid2D::set_point_solid(const Vector2i &p_id, bool p_solid) {
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set if point is disabled. Point out of bounds (%s/%s, %s/%s).", p_id.x, size.width, p_id.y, size.height));
-	points[p_id.y][p_id.x].solid = p_solid;
+	Point &p = points[p_id.y][p_id.x];
+	if (p.solid != p_solid) {
+		p.solid = p_solid;
+		_mark_clusters_dirty(p_id);
+		flow_fields.clear();
+	}
 }
 
 bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
@@ -156,102 +198,110 @@ bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
 }
 
 AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
-	if (!p_to || p_to->solid) {
-		return nullptr;
-	}
-	if (p_to == end) {
-		return p_to;
-	}
+	// Moving on in the same direction is done in a loop rather than recursively, so long open
+	// stretches on large grids don't grow the call stack.
+	while (p_to && !p_to->solid) {
+		if (p_to == end) {
+			return p_to;
+		}
 
-	int64_t from_x = p_from->id.x;
-	int64_t from_y = p_from->id.y;
+		int64_t from_x = p_from->id.x;
+		int64_t from_y = p_from->id.y;
 
-	int64_t to_x = p_to->id.x;
-	int64_t to_y = p_to->id.y;
+		int64_t to_x = p_to->id.x;
+		int64_t to_y = p_to->id.y;
 
-	int64_t dx = to_x - from_x;
-	int64_t dy = to_y - from_y;
+		int64_t dx = to_x - from_x;
+		int64_t dy = to_y - from_y;
 
-	if (diagonal_mode == DIAGONAL_MODE_ALWAYS || diagonal_mode == DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE) {
-		if (dx != 0 && dy != 0) {
-			if ((_is_walkable(to_x - dx, to_y + dy) && !_is_walkable(to_x - dx, to_y)) || (_is_walkable(to_x + dx, to_y - dy) && !_is_walkable(to_x, to_y - dy))) {
-				return p_to;
-			}
-			if (_jump(p_to, _get_point(to_x + dx, to_y)) != nullptr) {
-				return p_to;
-			}
-			if (_jump(p_to, _get_point(to_x, to_y + dy)) != nullptr) {
-				return p_to;
-			}
-		} else {
-			if (dx != 0) {
-				if ((_is_walkable(to_x + dx, to_y + 1) && !_is_walkable(to_x, to_y + 1)) || (_is_walkable(to_x + dx, to_y - 1) && !_is_walkable(to_x, to_y - 1))) {
+		if (diagonal_mode == DIAGONAL_MODE_ALWAYS || diagonal_mode == DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE) {
+			if (dx != 0 && dy != 0) {
+				if ((_is_walkable(to_x - dx, to_y + dy) && !_is_walkable(to_x - dx, to_y)) || (_is_walkable(to_x + dx, to_y - dy) && !_is_walkable(to_x, to_y - dy))) {
 					return p_to;
 				}
-			} else {
-				if ((_is_walkable(to_x + 1, to_y + dy) && !_is_walkable(to_x + 1, to_y)) || (_is_walkable(to_x - 1, to_y + dy) && !_is_walkable(to_x - 1, to_y))) {
+				if (_jump(p_to, _get_point(to_x + dx, to_y)) != nullptr) {
+					return p_to;
+				}
+				if (_jump(p_to, _get_point(to_x, to_y + dy)) != nullptr) {
 					return p_to;
 				}
+			} else {
+				if (dx != 0) {
+					if ((_is_walkable(to_x + dx, to_y + 1) && !_is_walkable(to_x, to_y + 1)) || (_is_walkable(to_x + dx, to_y - 1) && !_is_walkable(to_x, to_y - 1))) {
+						return p_to;
+					}
+				} else {
+					if ((_is_walkable(to_x + 1, to_y + dy) && !_is_walkable(to_x + 1, to_y)) || (_is_walkable(to_x - 1, to_y + dy) && !_is_walkable(to_x - 1, to_y))) {
+						return p_to;
+					}
+				}
 			}
-		}
-		if (_is_walkable(to_x + dx, to_y + dy) && (diagonal_mode == DIAGONAL_MODE_ALWAYS || (_is_walkable(to_x + dx, to_y) || _is_walkable(to_x, to_y + dy)))) {
-			return _jump(p_to, _get_point(to_x + dx, to_y + dy));
-		}
-	} else if (diagonal_mode == DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES) {
-		if (dx != 0 && dy != 0) {
-			if ((_is_walkable(to_x + dx, to_y + dy) && !_is_walkable(to_x, to_y + dy)) || !_is_walkable(to_x + dx, to_y)) {
-				return p_to;
+			if (_is_walkable(to_x + dx, to_y + dy) && (diagonal_mode == DIAGONAL_MODE_ALWAYS || (_is_walkable(to_x + dx, to_y) || _is_walkable(to_x, to_y + dy)))) {
+				p_from = p_to;
+				p_to = _get_point(to_x + dx, to_y + dy);
+				continue;
 			}
-			if (_jump(p_to, _get_point(to_x + dx, to_y)) != nullptr) {
-				return p_to;
+		} else if (diagonal_mode == DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES) {
+			if (dx != 0 && dy != 0) {
+				if ((_is_walkable(to_x + dx, to_y + dy) && !_is_walkable(to_x, to_y + dy)) || !_is_walkable(to_x + dx, to_y)) {
+					return p_to;
+				}
+				if (_jump(p_to, _get_point(to_x + dx, to_y)) != nullptr) {
+					return p_to;
+				}
+				if (_jump(p_to, _get_point(to_x, to_y + dy)) != nullptr) {
+					return p_to;
+				}
+			} else {
+				if (dx != 0) {
+					if ((_is_walkable(to_x, to_y + 1) && !_is_walkable(to_x - dx, to_y + 1)) || (_is_walkable(to_x, to_y - 1) && !_is_walkable(to_x - dx, to_y - 1))) {
+						return p_to;
+					}
+				} else {
+					if ((_is_walkable(to_x + 1, to_y) && !_is_walkable(to_x + 1, to_y - dy)) || (_is_walkable(to_x - 1, to_y) && !_is_walkable(to_x - 1, to_y - dy))) {
+						return p_to;
+					}
+				}
 			}
-			if (_jump(p_to, _get_point(to_x, to_y + dy)) != nullptr) {
-				return p_to;
+			if (_is_walkable(to_x + dx, to_y + dy) && _is_walkable(to_x + dx, to_y) && _is_walkable(to_x, to_y + dy)) {
+				p_from = p_to;
+				p_to = _get_point(to_x + dx, to_y + dy);
+				continue;
 			}
-		} else {
+		} else { // DIAGONAL_MODE_NEVER
 			if (dx != 0) {
-				if ((_is_walkable(to_x, to_y + 1) && !_is_walkable(to_x - dx, to_y + 1)) || (_is_walkable(to_x, to_y - 1) && !_is_walkable(to_x - dx, to_y - 1))) {
+				if (!_is_walkable(to_x + dx, to_y)) {
+					return p_to;
+				}
+				if (_jump(p_to, _get_point(to_x, to_y + 1)) != nullptr) {
+					return p_to;
+				}
+				if (_jump(p_to, _get_point(to_x, to_y - 1)) != nullptr) {
 					return p_to;
 				}
 			} else {
-				if ((_is_walkable(to_x + 1, to_y) && !_is_walkable(to_x + 1, to_y - dy)) || (_is_walkable(to_x - 1, to_y) && !_is_walkable(to_x - 1, to_y - dy))) {
+				if (!_is_walkable(to_x, to_y + dy)) {
+					return p_to;
+				}
+				if (_jump(p_to, _get_point(to_x + 1, to_y)) != nullptr) {
+					return p_to;
+				}
+				if (_jump(p_to, _get_point(to_x - 1, to_y)) != nullptr) {
 					return p_to;
 				}
 			}
-		}
-		if (_is_walkable(to_x + dx, to_y + dy) && _is_walkable(to_x + dx, to_y) && _is_walkable(to_x, to_y + dy)) {
-			return _jump(p_to, _get_point(to_x + dx, to_y + dy));
-		}
-	} else { // DIAGONAL_MODE_NEVER
-		if (dx != 0) {
-			if (!_is_walkable(to_x + dx, to_y)) {
-				return p_to;
-			}
-			if (_jump(p_to, _get_point(to_x, to_y + 1)) != nullptr) {
-				return p_to;
-			}
-			if (_jump(p_to, _get_point(to_x, to_y - 1)) != nullptr) {
-				return p_to;
-			}
-		} else {
-			if (!_is_walkable(to_x, to_y + dy)) {
-				return p_to;
-			}
-			if (_jump(p_to, _get_point(to_x + 1, to_y)) != nullptr) {
-				return p_to;
-			}
-			if (_jump(p_to, _get_point(to_x - 1, to_y)) != nullptr) {
-				return p_to;
+			if (_is_walkable(to_x + dx, to_y + dy) && _is_walkable(to_x + dx, to_y) && _is_walkable(to_x, to_y + dy)) {
+				p_from = p_to;
+				p_to = _get_point(to_x + dx, to_y + dy);
+				continue;
 			}
 		}
-		if (_is_walkable(to_x + dx, to_y + dy) && _is_walkable(to_x + dx, to_y) && _is_walkable(to_x, to_y + dy)) {
-			return _jump(p_to, _get_point(to_x + dx, to_y + dy));
-		}
+		return nullptr;
 	}
 	return nullptr;
 }
 
-void AStarGrid2D::_get_nbors(Point *p_point, List<Point *> &r_nbors) {
+void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 	bool ts0 = false, td0 = false,
 		 ts1 = false, td1 = false,
 		 ts2 = false, td2 = false,
@@ -366,6 +416,7 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 
 	Vector<Point *> open_list;
 	SortArray<Point *, SortPoints> sorter;
+	LocalVector<Point *> nbors;
 
 	p_begin_point->g_score = 0;
 	p_begin_point->f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
@@ -384,11 +435,14 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 		open_list.remove_at(open_list.size() - 1);
 		p->closed_pass = pass; // Mark the point as closed.
 
-		List<Point *> nbors;
+		nbors.clear();
 		_get_nbors(p, nbors);
-		for (List<Point *>::Element *E = nbors.front(); E; E = E->next()) {
-			Point *e = E->get(); // The neighbour point.
-			if (jumping_enabled) {
+		for (uint32_t i = 0; i < nbors.size(); i++) {
+			Point *e = nbors[i]; // The neighbour point.
+			if (solve_bounded && !solve_bounds.has_point(e->id)) {
+				continue;
+			}
+			if (jumping_enabled && !solve_bounded) {
 				e = _jump(p, e);
 				if (!e || e->closed_pass == pass) {
 					continue;
@@ -425,6 +479,521 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 	return found_route;
 }
 
+void AStarGrid2D::_mark_clusters_dirty(const Vector2i &p_id) {
+	if (clusters_dirty) {
+		return; // Everything gets rebuilt anyway.
+	}
+
+	// Border cells also affect the entrances of the cluster across that border.
+	Vector2i ids[5] = { p_id, p_id, p_id, p_id, p_id };
+	int count = 1;
+	if (p_id.x % cluster_size == 0 && p_id.x > 0) {
+		ids[count++].x -= 1;
+	} else if (p_id.x % cluster_size == cluster_size - 1 && p_id.x + 1 < size.width) {
+		ids[count++].x += 1;
+	}
+	if (p_id.y % cluster_size == 0 && p_id.y > 0) {
+		ids[count++].y -= 1;
+	} else if (p_id.y % cluster_size == cluster_size - 1 && p_id.y + 1 < size.height) {
+		ids[count++].y += 1;
+	}
+
+	for (int i = 0; i < count; i++) {
+		uint32_t index = _get_cluster_index(ids[i]);
+		if (!clusters[index].dirty) {
+			clusters[index].dirty = true;
+			dirty_clusters.push_back(index);
+		}
+	}
+}
+
+void AStarGrid2D::_scan_cluster_border(Cluster &r_cluster, const Vector2i &p_start, const Vector2i &p_step, const Vector2i &p_across, int p_length) {
+	// Both clusters sharing a border scan it in the same direction, so they agree on the entrances.
+	int run_start = -1;
+	for (int i = 0; i <= p_length; i++) {
+		Vector2i id = p_start + p_step * i;
+		bool open = i < p_length && _is_walkable(id.x, id.y) && _is_walkable(id.x + p_across.x, id.y + p_across.y);
+		if (open && run_start < 0) {
+			run_start = i;
+		} else if (!open && run_start >= 0) {
+			Vector2i entrance = p_start + p_step * ((run_start + i - 1) / 2);
+			r_cluster.entrances.push_back(entrance);
+			r_cluster.exits.push_back(entrance + p_across);
+			run_start = -1;
+		}
+	}
+}
+
+void AStarGrid2D::_compute_distances(const Rect2i &p_rect, const Vector2i &p_from, bool p_script_cost, LocalVector<real_t> &r_distances) {
+	const int64_t width = p_rect.size.width;
+	r_distances.resize(width * p_rect.size.height);
+	for (uint32_t i = 0; i < r_distances.size(); i++) {
+		r_distances[i] = INFINITY;
+	}
+
+	LocalVector<uint8_t> closed;
+	closed.resize(r_distances.size());
+	memset(closed.ptr(), 0, closed.size());
+
+	LocalVector<ClusterEntry> open_list;
+	SortArray<ClusterEntry, SortClusterEntries> sorter;
+	LocalVector<Point *> nbors;
+
+	ClusterEntry start;
+	start.index = (p_from.y - p_rect.position.y) * width + (p_from.x - p_rect.position.x);
+	r_distances[start.index] = 0;
+	open_list.push_back(start);
+
+	while (!open_list.is_empty()) {
+		sorter.pop_heap(0, open_list.size(), open_list.ptr());
+		ClusterEntry entry = open_list[open_list.size() - 1];
+		open_list.resize(open_list.size() - 1);
+		if (closed[entry.index]) {
+			continue;
+		}
+		closed[entry.index] = 1;
+
+		Point *p = _get_point_unchecked(p_rect.position.x + entry.index % width, p_rect.position.y + entry.index / width);
+		nbors.clear();
+		_get_nbors(p, nbors);
+		for (uint32_t i = 0; i < nbors.size(); i++) {
+			Point *e = nbors[i];
+			if (!p_rect.has_point(e->id)) {
+				continue;
+			}
+			uint32_t index = (e->id.y - p_rect.position.y) * width + (e->id.x - p_rect.position.x);
+			if (closed[index]) {
+				continue;
+			}
+			real_t score = entry.f_score + (p_script_cost ? _compute_cost(p->id, e->id) : heuristics[default_heuristic](p->id, e->id));
+			if (score < r_distances[index]) {
+				r_distances[index] = score;
+				ClusterEntry next;
+				next.f_score = score;
+				next.index = index;
+				open_list.push_back(next);
+				sorter.push_heap(0, open_list.size() - 1, 0, next, open_list.ptr());
+			}
+		}
+	}
+}
+
+void AStarGrid2D::_rebuild_cluster(uint32_t p_index, const uint32_t *p_clusters) {
+	Cluster &c = clusters[p_clusters[p_index]];
+	const Vector2i pos = c.rect.position;
+	const Vector2i last = c.rect.get_end() - Vector2i(1, 1);
+
+	c.entrances.clear();
+	c.exits.clear();
+	if (pos.y > 0) {
+		_scan_cluster_border(c, pos, Vector2i(1, 0), Vector2i(0, -1), c.rect.size.width);
+	}
+	if (last.x + 1 < size.width) {
+		_scan_cluster_border(c, Vector2i(last.x, pos.y), Vector2i(0, 1), Vector2i(1, 0), c.rect.size.height);
+	}
+	if (last.y + 1 < size.height) {
+		_scan_cluster_border(c, Vector2i(pos.x, last.y), Vector2i(1, 0), Vector2i(0, 1), c.rect.size.width);
+	}
+	if (pos.x > 0) {
+		_scan_cluster_border(c, pos, Vector2i(0, 1), Vector2i(-1, 0), c.rect.size.height);
+	}
+
+	const uint32_t n = c.entrances.size();
+	c.costs.resize(n * n);
+	LocalVector<real_t> distances;
+	for (uint32_t i = 0; i < n; i++) {
+		_compute_distances(c.rect, c.entrances[i], script_cost, distances);
+		for (uint32_t j = 0; j < n; j++) {
+			const Vector2i &to = c.entrances[j];
+			c.costs[i * n + j] = distances[(to.y - pos.y) * c.rect.size.width + (to.x - pos.x)];
+		}
+	}
+}
+
+void AStarGrid2D::_update_clusters() {
+	script_cost = GDVIRTUAL_IS_OVERRIDDEN(_compute_cost);
+
+	if (clusters_dirty) {
+		cluster_grid = Size2i((size.width + cluster_size - 1) / cluster_size, (size.height + cluster_size - 1) / cluster_size);
+		clusters.clear();
+		clusters.resize(cluster_grid.width * cluster_grid.height);
+		dirty_clusters.resize(clusters.size());
+		for (int y = 0; y < cluster_grid.height; y++) {
+			for (int x = 0; x < cluster_grid.width; x++) {
+				uint32_t index = y * cluster_grid.width + x;
+				Rect2i rect(x * cluster_size, y * cluster_size, cluster_size, cluster_size);
+				clusters[index].rect = rect.intersection(Rect2i(Vector2i(), size));
+				clusters[index].dirty = true;
+				dirty_clusters[index] = index;
+			}
+		}
+		clusters_dirty = false;
+	}
+
+	if (dirty_clusters.is_empty()) {
+		return;
+	}
+
+	// Scripted costs can't be evaluated from worker threads.
+	if (!script_cost && dirty_clusters.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AStarGrid2D::_rebuild_cluster, (const uint32_t *)dirty_clusters.ptr(), dirty_clusters.size(), -1, true, SNAME("AStarGrid2DClusters"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < dirty_clusters.size(); i++) {
+			_rebuild_cluster(i, dirty_clusters.ptr());
+		}
+	}
+
+	// Entrance indices of the rebuilt clusters may have changed, so their neighbors need to be relinked too.
+	const Vector2i neighbors[5] = { Vector2i(), Vector2i(-1, 0), Vector2i(1, 0), Vector2i(0, -1), Vector2i(0, 1) };
+	for (uint32_t i = 0; i < dirty_clusters.size(); i++) {
+		Vector2i cell(dirty_clusters[i] % cluster_grid.width, dirty_clusters[i] / cluster_grid.width);
+		for (int j = 0; j < 5; j++) {
+			Vector2i ncell = cell + neighbors[j];
+			if (ncell.x < 0 || ncell.y < 0 || ncell.x >= cluster_grid.width || ncell.y >= cluster_grid.height) {
+				continue;
+			}
+			Cluster &c = clusters[ncell.y * cluster_grid.width + ncell.x];
+			c.links.resize(c.entrances.size());
+			for (uint32_t k = 0; k < c.entrances.size(); k++) {
+				const Cluster &other = clusters[_get_cluster_index(c.exits[k])];
+				c.links[k] = UINT32_MAX;
+				for (uint32_t l = 0; l < other.entrances.size(); l++) {
+					if (other.entrances[l] == c.exits[k] && other.exits[l] == c.entrances[k]) {
+						c.links[k] = l;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < dirty_clusters.size(); i++) {
+		clusters[dirty_clusters[i]].dirty = false;
+	}
+	dirty_clusters.clear();
+
+	uint32_t node_count = 0;
+	for (uint32_t i = 0; i < clusters.size(); i++) {
+		clusters[i].first_node = node_count;
+		node_count += clusters[i].entrances.size();
+	}
+	node_clusters.resize(node_count);
+	for (uint32_t i = 0; i < clusters.size(); i++) {
+		for (uint32_t j = 0; j < clusters[i].entrances.size(); j++) {
+			node_clusters[clusters[i].first_node + j] = i;
+		}
+	}
+}
+
+bool AStarGrid2D::_solve_hierarchical(Point *p_begin_point, Point *p_end_point, LocalVector<Point *> &r_path) {
+	_update_clusters();
+
+	const uint32_t begin_cluster = _get_cluster_index(p_begin_point->id);
+	const uint32_t end_cluster = _get_cluster_index(p_end_point->id);
+	const uint32_t node_count = node_clusters.size();
+	const uint32_t begin_node = node_count;
+	const uint32_t end_node = node_count + 1;
+
+	if (node_open_pass.size() != node_count + 2) {
+		node_g_scores.resize(node_count + 2);
+		node_prev.resize(node_count + 2);
+		node_open_pass.resize(node_count + 2);
+		node_closed_pass.resize(node_count + 2);
+		for (uint32_t i = 0; i < node_count + 2; i++) {
+			node_open_pass[i] = 0;
+			node_closed_pass[i] = 0;
+		}
+	}
+	node_pass++;
+
+	// Connect the endpoints to the entrances of their clusters.
+	LocalVector<real_t> begin_distances;
+	LocalVector<real_t> end_distances;
+	_compute_distances(clusters[begin_cluster].rect, p_begin_point->id, script_cost, begin_distances);
+	_compute_distances(clusters[end_cluster].rect, p_end_point->id, script_cost, end_distances);
+
+	auto node_id = [&](uint32_t p_node) -> Vector2i {
+		if (p_node == begin_node) {
+			return p_begin_point->id;
+		} else if (p_node == end_node) {
+			return p_end_point->id;
+		}
+		const Cluster &c = clusters[node_clusters[p_node]];
+		return c.entrances[p_node - c.first_node];
+	};
+	auto cluster_distance = [&](const LocalVector<real_t> &p_distances, uint32_t p_cluster, const Vector2i &p_id) -> real_t {
+		const Rect2i &rect = clusters[p_cluster].rect;
+		return p_distances[(p_id.y - rect.position.y) * rect.size.width + (p_id.x - rect.position.x)];
+	};
+
+	LocalVector<ClusterEntry> open_list;
+	SortArray<ClusterEntry, SortClusterEntries> sorter;
+
+	auto relax = [&](uint32_t p_node, uint32_t p_from, real_t p_g_score) {
+		if (node_closed_pass[p_node] == node_pass) {
+			return;
+		}
+		if (node_open_pass[p_node] == node_pass && p_g_score >= node_g_scores[p_node]) {
+			return;
+		}
+		node_open_pass[p_node] = node_pass;
+		node_g_scores[p_node] = p_g_score;
+		node_prev[p_node] = p_from;
+
+		ClusterEntry entry;
+		entry.index = p_node;
+		entry.f_score = p_g_score + (p_node == end_node ? 0 : _estimate_cost(node_id(p_node), p_end_point->id));
+		open_list.push_back(entry);
+		sorter.push_heap(0, open_list.size() - 1, 0, entry, open_list.ptr());
+	};
+
+	relax(begin_node, begin_node, 0);
+
+	bool found_route = false;
+	while (!open_list.is_empty()) {
+		sorter.pop_heap(0, open_list.size(), open_list.ptr());
+		uint32_t u = open_list[open_list.size() - 1].index;
+		open_list.resize(open_list.size() - 1);
+		if (node_closed_pass[u] == node_pass) {
+			continue; // Stale entry.
+		}
+		node_closed_pass[u] = node_pass;
+
+		if (u == end_node) {
+			found_route = true;
+			break;
+		}
+
+		const real_t g_score = node_g_scores[u];
+		if (u == begin_node) {
+			const Cluster &c = clusters[begin_cluster];
+			for (uint32_t i = 0; i < c.entrances.size(); i++) {
+				real_t distance = cluster_distance(begin_distances, begin_cluster, c.entrances[i]);
+				if (distance != INFINITY) {
+					relax(c.first_node + i, u, distance);
+				}
+			}
+			continue;
+		}
+
+		const uint32_t cluster_index = node_clusters[u];
+		const Cluster &c = clusters[cluster_index];
+		const uint32_t local = u - c.first_node;
+		const uint32_t n = c.entrances.size();
+		for (uint32_t i = 0; i < n; i++) {
+			real_t cost = c.costs[local * n + i];
+			if (i != local && cost != INFINITY) {
+				relax(c.first_node + i, u, g_score + cost);
+			}
+		}
+		if (c.links[local] != UINT32_MAX) {
+			const Cluster &other = clusters[_get_cluster_index(c.exits[local])];
+			relax(other.first_node + c.links[local], u, g_score + _compute_cost(c.entrances[local], c.exits[local]));
+		}
+		if (cluster_index == end_cluster) {
+			real_t distance = cluster_distance(end_distances, end_cluster, c.entrances[local]);
+			if (distance != INFINITY) {
+				relax(end_node, u, g_score + distance);
+			}
+		}
+	}
+
+	if (!found_route) {
+		return false;
+	}
+
+	LocalVector<Vector2i> waypoints;
+	for (uint32_t node = end_node; node != begin_node; node = node_prev[node]) {
+		waypoints.push_back(node_id(node));
+	}
+	waypoints.push_back(p_begin_point->id);
+	waypoints.invert();
+
+	// Refine the abstract path into cells, searching only inside one cluster at a time.
+	r_path.clear();
+	r_path.push_back(p_begin_point);
+	LocalVector<Point *> segment;
+	for (uint32_t i = 1; i < waypoints.size(); i++) {
+		const Vector2i &from = waypoints[i - 1];
+		const Vector2i &to = waypoints[i];
+		if (from == to) {
+			continue;
+		}
+		Point *to_point = _get_point_unchecked(to.x, to.y);
+		uint32_t cluster_index = _get_cluster_index(from);
+		if (cluster_index != _get_cluster_index(to)) {
+			r_path.push_back(to_point); // Crossing an entrance, the cells are adjacent.
+			continue;
+		}
+
+		Point *from_point = _get_point_unchecked(from.x, from.y);
+		solve_bounded = true;
+		solve_bounds = clusters[cluster_index].rect;
+		bool found_segment = _solve(from_point, to_point);
+		solve_bounded = false;
+		ERR_FAIL_COND_V(!found_segment, false);
+
+		segment.clear();
+		for (Point *p = to_point; p != from_point; p = p->prev_point) {
+			segment.push_back(p);
+		}
+		for (int64_t j = (int64_t)segment.size() - 1; j >= 0; j--) {
+			r_path.push_back(segment[j]);
+		}
+	}
+
+	return true;
+}
+
+bool AStarGrid2D::_get_path(Point *p_begin_point, Point *p_end_point, LocalVector<Point *> &r_path) {
+	r_path.clear();
+	if (p_begin_point == p_end_point) {
+		r_path.push_back(p_begin_point);
+		return true;
+	}
+
+	const Vector2i begin_cluster = p_begin_point->id / cluster_size;
+	const Vector2i end_cluster = p_end_point->id / cluster_size;
+	if (hierarchical_enabled && begin_cluster != end_cluster) {
+		if (p_end_point->solid) {
+			return false;
+		}
+		return _solve_hierarchical(p_begin_point, p_end_point, r_path);
+	}
+
+	if (!_solve(p_begin_point, p_end_point)) {
+		return false;
+	}
+
+	for (Point *p = p_end_point; p != p_begin_point; p = p->prev_point) {
+		r_path.push_back(p);
+	}
+	r_path.push_back(p_begin_point);
+	r_path.invert();
+	return true;
+}
+
+void AStarGrid2D::_compute_flow_field(uint32_t p_index, FlowFieldBatch *p_batch) {
+	const Vector2i &goal = p_batch->goals[p_index];
+	LocalVector<real_t> &distances = p_batch->distances[p_index];
+	if (points[goal.y][goal.x].solid) {
+		distances.resize(size.width * size.height);
+		for (uint32_t i = 0; i < distances.size(); i++) {
+			distances[i] = INFINITY;
+		}
+		return;
+	}
+	// Costs are assumed to be symmetric, so searching outwards from the goal gives the distance of every cell to it.
+	_compute_distances(Rect2i(Vector2i(), size), goal, script_cost, distances);
+}
+
+const Vector<real_t> *AStarGrid2D::_get_flow_field(const Vector2i &p_goal) {
+	const Vector<real_t> *field = flow_fields.getptr(p_goal);
+	if (!field) {
+		TypedArray<Vector2i> goals;
+		goals.push_back(p_goal);
+		build_flow_fields(goals);
+		field = flow_fields.getptr(p_goal);
+	}
+	return field;
+}
+
+void AStarGrid2D::set_flow_field_cache_size(int p_size) {
+	ERR_FAIL_COND_MSG(p_size < 1, "Flow field cache size must be at least 1.");
+	flow_fields.set_capacity(p_size);
+}
+
+int AStarGrid2D::get_flow_field_cache_size() const {
+	return flow_fields.get_capacity();
+}
+
+void AStarGrid2D::build_flow_fields(const TypedArray<Vector2i> &p_goals) {
+	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
+
+	LocalVector<Vector2i> goals;
+	for (int i = 0; i < p_goals.size(); i++) {
+		Vector2i goal = p_goals[i];
+		ERR_CONTINUE_MSG(!is_in_boundsv(goal), vformat("Can't build flow field. Point out of bounds (%s/%s, %s/%s).", goal.x, size.width, goal.y, size.height));
+		if (!flow_fields.has(goal) && goals.find(goal) < 0) {
+			goals.push_back(goal);
+		}
+	}
+	if (goals.is_empty()) {
+		return;
+	}
+
+	script_cost = GDVIRTUAL_IS_OVERRIDDEN(_compute_cost);
+
+	LocalVector<LocalVector<real_t>> distances;
+	distances.resize(goals.size());
+	FlowFieldBatch batch;
+	batch.goals = goals.ptr();
+	batch.distances = distances.ptr();
+
+	// Scripted costs can't be evaluated from worker threads.
+	if (!script_cost && goals.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AStarGrid2D::_compute_flow_field, &batch, goals.size(), -1, true, SNAME("AStarGrid2DFlowFields"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < goals.size(); i++) {
+			_compute_flow_field(i, &batch);
+		}
+	}
+
+	for (uint32_t i = 0; i < goals.size(); i++) {
+		Vector<real_t> field;
+		field.resize(distances[i].size());
+		memcpy(field.ptrw(), distances[i].ptr(), distances[i].size() * sizeof(real_t));
+		flow_fields.insert(goals[i], field);
+	}
+}
+
+bool AStarGrid2D::has_flow_field(const Vector2i &p_goal) const {
+	return flow_fields.has(p_goal);
+}
+
+void AStarGrid2D::clear_flow_fields() {
+	flow_fields.clear();
+}
+
+Vector2i AStarGrid2D::get_flow_direction(const Vector2i &p_goal, const Vector2i &p_id) {
+	ERR_FAIL_COND_V_MSG(dirty, Vector2i(), "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_goal), Vector2i(), vformat("Can't get flow direction. Point out of bounds (%s/%s, %s/%s).", p_goal.x, size.width, p_goal.y, size.height));
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_id), Vector2i(), vformat("Can't get flow direction. Point out of bounds (%s/%s, %s/%s).", p_id.x, size.width, p_id.y, size.height));
+
+	const Vector<real_t> *field = _get_flow_field(p_goal);
+	ERR_FAIL_NULL_V(field, Vector2i());
+	const real_t *distances = field->ptr();
+	if (distances[p_id.y * size.width + p_id.x] == INFINITY) {
+		return Vector2i();
+	}
+
+	// Step towards the neighbor closest to the goal, this always gets strictly closer to it.
+	LocalVector<Point *> nbors;
+	_get_nbors(_get_point_unchecked(p_id.x, p_id.y), nbors);
+	Vector2i direction;
+	real_t best_distance = distances[p_id.y * size.width + p_id.x];
+	for (uint32_t i = 0; i < nbors.size(); i++) {
+		real_t distance = distances[nbors[i]->id.y * size.width + nbors[i]->id.x];
+		if (distance < best_distance) {
+			best_distance = distance;
+			direction = nbors[i]->id - p_id;
+		}
+	}
+	return direction;
+}
+
+real_t AStarGrid2D::get_flow_distance(const Vector2i &p_goal, const Vector2i &p_id) {
+	ERR_FAIL_COND_V_MSG(dirty, INFINITY, "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_goal), INFINITY, vformat("Can't get flow distance. Point out of bounds (%s/%s, %s/%s).", p_goal.x, size.width, p_goal.y, size.height));
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_id), INFINITY, vformat("Can't get flow distance. Point out of bounds (%s/%s, %s/%s).", p_id.x, size.width, p_id.y, size.height));
+
+	const Vector<real_t> *field = _get_flow_field(p_goal);
+	ERR_FAIL_NULL_V(field, INFINITY);
+	return field->get(p_id.y * size.width + p_id.x);
+}
+
 real_t AStarGrid2D::_estimate_cost(const Vector2i &p_from_id, const Vector2i &p_to_id) {
 	real_t scost;
 	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_to_id, scost)) {
@@ -444,6 +1013,8 @@ real_t AStarGrid2D::_compute_cost(const Vector2i &p_from_id, const Vector2i &p_t
 void AStarGrid2D::clear() {
 	points.clear();
 	size = Vector2i();
+	clusters_dirty = true;
+	flow_fields.clear();
 }
 
 Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vector2i &p_to_id) {
@@ -454,41 +1025,16 @@ Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vec
 	Point *a = _get_point(p_from_id.x, p_from_id.y);
 	Point *b = _get_point(p_to_id.x, p_to_id.y);
 
-	if (a == b) {
-		Vector<Vector2> ret;
-		ret.push_back(a->pos);
-		return ret;
-	}
-
-	Point *begin_point = a;
-	Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point);
-	if (!found_route) {
+	LocalVector<Point *> route;
+	if (!_get_path(a, b, route)) {
 		return Vector<Vector2>();
 	}
 
-	Point *p = end_point;
-	int64_t pc = 1;
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
-	}
-
 	Vector<Vector2> path;
-	path.resize(pc);
-
-	{
-		Vector2 *w = path.ptrw();
-
-		p = end_point;
-		int64_t idx = pc - 1;
-		while (p != begin_point) {
-			w[idx--] = p->pos;
-			p = p->prev_point;
-		}
-
-		w[0] = p->pos;
+	path.resize(route.size());
+	Vector2 *w = path.ptrw();
+	for (uint32_t i = 0; i < route.size(); i++) {
+		w[i] = route[i]->pos;
 	}
 
 	return path;
@@ -502,39 +1048,15 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 	Point *a = _get_point(p_from_id.x, p_from_id.y);
 	Point *b = _get_point(p_to_id.x, p_to_id.y);
 
-	if (a == b) {
-		TypedArray<Vector2i> ret;
-		ret.push_back(a);
-		return ret;
-	}
-
-	Point *begin_point = a;
-	Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point);
-	if (!found_route) {
+	LocalVector<Point *> route;
+	if (!_get_path(a, b, route)) {
 		return TypedArray<Vector2i>();
 	}
 
-	Point *p = end_point;
-	int64_t pc = 1;
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
-	}
-
 	TypedArray<Vector2i> path;
-	path.resize(pc);
-
-	{
-		p = end_point;
-		int64_t idx = pc - 1;
-		while (p != begin_point) {
-			path[idx--] = p->id;
-			p = p->prev_point;
-		}
-
-		path[0] = p->id;
+	path.resize(route.size());
+	for (uint32_t i = 0; i < route.size(); i++) {
+		path[i] = route[i]->id;
 	}
 
 	return path;
@@ -553,6 +1075,10 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("update"), &AStarGrid2D::update);
 	ClassDB::bind_method(D_METHOD("set_jumping_enabled", "enabled"), &AStarGrid2D::set_jumping_enabled);
 	ClassDB::bind_method(D_METHOD("is_jumping_enabled"), &AStarGrid2D::is_jumping_enabled);
+	ClassDB::bind_method(D_METHOD("set_hierarchical_enabled", "enabled"), &AStarGrid2D::set_hierarchical_enabled);
+	ClassDB::bind_method(D_METHOD("is_hierarchical_enabled"), &AStarGrid2D::is_hierarchical_enabled);
+	ClassDB::bind_method(D_METHOD("set_cluster_size", "cluster_size"), &AStarGrid2D::set_cluster_size);
+	ClassDB::bind_method(D_METHOD("get_cluster_size"), &AStarGrid2D::get_cluster_size);
 	ClassDB::bind_method(D_METHOD("set_diagonal_mode", "mode"), &AStarGrid2D::set_diagonal_mode);
 	ClassDB::bind_method(D_METHOD("get_diagonal_mode"), &AStarGrid2D::get_diagonal_mode);
 	ClassDB::bind_method(D_METHOD("set_default_heuristic", "heuristic"), &AStarGrid2D::set_default_heuristic);
@@ -561,6 +1087,14 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_point_solid", "id"), &AStarGrid2D::is_point_solid);
 	ClassDB::bind_method(D_METHOD("clear"), &AStarGrid2D::clear);
 
+	ClassDB::bind_method(D_METHOD("set_flow_field_cache_size", "size"), &AStarGrid2D::set_flow_field_cache_size);
+	ClassDB::bind_method(D_METHOD("get_flow_field_cache_size"), &AStarGrid2D::get_flow_field_cache_size);
+	ClassDB::bind_method(D_METHOD("build_flow_fields", "goals"), &AStarGrid2D::build_flow_fields);
+	ClassDB::bind_method(D_METHOD("has_flow_field", "goal"), &AStarGrid2D::has_flow_field);
+	ClassDB::bind_method(D_METHOD("clear_flow_fields"), &AStarGrid2D::clear_flow_fields);
+	ClassDB::bind_method(D_METHOD("get_flow_direction", "goal", "id"), &AStarGrid2D::get_flow_direction);
+	ClassDB::bind_method(D_METHOD("get_flow_distance", "goal", "id"), &AStarGrid2D::get_flow_distance);
+
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id"), &AStarGrid2D::get_point_path);
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id"), &AStarGrid2D::get_id_path);
 
@@ -572,6 +1106,9 @@ void AStarGrid2D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "cell_size"), "set_cell_size", "get_cell_size");
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "jumping_enabled"), "set_jumping_enabled", "is_jumping_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "hierarchical_enabled"), "set_hierarchical_enabled", "is_hierarchical_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "cluster_size", PROPERTY_HINT_RANGE, "2,256,1,or_greater"), "set_cluster_size", "get_cluster_size");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "flow_field_cache_size", PROPERTY_HINT_RANGE, "1,64,1,or_greater"), "set_flow_field_cache_size", "get_flow_field_cache_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "default_heuristic", PROPERTY_HINT_ENUM, "Euclidean,Manhattan,Octile,Chebyshev,Max"), "set_default_heuristic", "get_default_heuristic");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "diagonal_mode", PROPERTY_HINT_ENUM, "Never,Always,At Least One Walkable,Only If No Obstacles,Max"), "set_diagonal_mode", "get_diagonal_mode");
 
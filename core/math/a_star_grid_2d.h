@@ -36,6 +36,7 @@
 #include "core/object/script_language.h"
 #include "core/templates/list.h"
 #include "core/templates/local_vector.h"
+#include "core/templates/lru.h"
 
 class AStarGrid2D : public RefCounted {
 	GDCLASS(AStarGrid2D, RefCounted);
@@ -64,6 +65,8 @@ private:
 	bool dirty = false;
 
 	bool jumping_enabled = false;
+	bool hierarchical_enabled = false;
+	int cluster_size = 16;
 	DiagonalMode diagonal_mode = DIAGONAL_MODE_ALWAYS;
 	Heuristic default_heuristic = HEURISTIC_EUCLIDEAN;
 
@@ -103,6 +106,56 @@ private:
 
 	uint64_t pass = 1;
 
+	// Restricts _solve() to a rectangle, used when refining hierarchical paths.
+	bool solve_bounded = false;
+	Rect2i solve_bounds;
+
+	// Hierarchical (HPA*) data. The grid is split into square clusters; each walkable run of cells
+	// along a cluster border gets one entrance in the middle, and the costs between entrances of the
+	// same cluster are precomputed. Clusters touched by set_point_solid() are rebuilt lazily.
+	struct Cluster {
+		Rect2i rect;
+		LocalVector<Vector2i> entrances; // Cells inside this cluster.
+		LocalVector<Vector2i> exits; // Matching cells across the border, in the neighboring cluster.
+		LocalVector<uint32_t> links; // Index of the matching entrance in the neighboring cluster.
+		LocalVector<real_t> costs; // entrances.size() squared, INFINITY when unreachable.
+		uint32_t first_node = 0;
+		bool dirty = true;
+	};
+
+	struct ClusterEntry {
+		real_t f_score = 0;
+		uint32_t index = 0;
+	};
+
+	struct SortClusterEntries {
+		_FORCE_INLINE_ bool operator()(const ClusterEntry &A, const ClusterEntry &B) const {
+			return A.f_score > B.f_score;
+		}
+	};
+
+	LocalVector<Cluster> clusters;
+	Size2i cluster_grid;
+	bool clusters_dirty = true;
+	bool script_cost = false;
+	LocalVector<uint32_t> dirty_clusters;
+	LocalVector<uint32_t> node_clusters;
+
+	// Abstract graph search state.
+	LocalVector<real_t> node_g_scores;
+	LocalVector<uint32_t> node_prev;
+	LocalVector<uint64_t> node_open_pass;
+	LocalVector<uint64_t> node_closed_pass;
+	uint64_t node_pass = 1;
+
+	// Flow fields, the distance of every cell to a goal, cached per goal.
+	struct FlowFieldBatch {
+		const Vector2i *goals = nullptr;
+		LocalVector<real_t> *distances = nullptr;
+	};
+
+	LRUCache<Vector2i, Vector<real_t>> flow_fields = LRUCache<Vector2i, Vector<real_t>>(8);
+
 private: // Internal routines.
 	_FORCE_INLINE_ bool _is_walkable(int64_t p_x, int64_t p_y) const {
 		if (p_x >= 0 && p_y >= 0 && p_x < size.width && p_y < size.height) {
@@ -122,10 +175,25 @@ private: // Internal routines.
 		return &points[p_y][p_x];
 	}
 
-	void _get_nbors(Point *p_point, List<Point *> &r_nbors);
+	_FORCE_INLINE_ uint32_t _get_cluster_index(const Vector2i &p_id) const {
+		return (p_id.y / cluster_size) * cluster_grid.width + (p_id.x / cluster_size);
+	}
+
+	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
 	Point *_jump(Point *p_from, Point *p_to);
 	bool _solve(Point *p_begin_point, Point *p_end_point);
 
+	void _mark_clusters_dirty(const Vector2i &p_id);
+	void _scan_cluster_border(Cluster &r_cluster, const Vector2i &p_start, const Vector2i &p_step, const Vector2i &p_across, int p_length);
+	void _compute_distances(const Rect2i &p_rect, const Vector2i &p_from, bool p_script_cost, LocalVector<real_t> &r_distances);
+	void _rebuild_cluster(uint32_t p_index, const uint32_t *p_clusters);
+	void _update_clusters();
+	bool _solve_hierarchical(Point *p_begin_point, Point *p_end_point, LocalVector<Point *> &r_path);
+	bool _get_path(Point *p_begin_point, Point *p_end_point, LocalVector<Point *> &r_path);
+
+	void _compute_flow_field(uint32_t p_index, FlowFieldBatch *p_batch);
+	const Vector<real_t> *_get_flow_field(const Vector2i &p_goal);
+
 protected:
 	static void _bind_methods();
 
@@ -157,6 +225,12 @@ public:
 	void set_jumping_enabled(bool p_enabled);
 	bool is_jumping_enabled() const;
 
+	void set_hierarchical_enabled(bool p_enabled);
+	bool is_hierarchical_enabled() const;
+
+	void set_cluster_size(int p_cluster_size);
+	int get_cluster_size() const;
+
 	void set_diagonal_mode(DiagonalMode p_diagonal_mode);
 	DiagonalMode get_diagonal_mode() const;
 
@@ -168,6 +242,15 @@ public:
 
 	void clear();
 
+	void set_flow_field_cache_size(int p_size);
+	int get_flow_field_cache_size() const;
+
+	void build_flow_fields(const TypedArray<Vector2i> &p_goals);
+	bool has_flow_field(const Vector2i &p_goal) const;
+	void clear_flow_fields();
+	Vector2i get_flow_direction(const Vector2i &p_goal, const Vector2i &p_id);
+	real_t get_flow_distance(const Vector2i &p_goal, const Vector2i &p_id);
+
 	Vector<Vector2> get_point_path(const Vector2i &p_from, const Vector2i &p_to);
 	TypedArray<Vector2i> get_id_path(const Vector2i &p_from, const Vector2i &p_to);
 };
@@ -52,6 +52,7 @@
 // and pairable_mask is either 0 if static, or set to all if non static
 
 #include "bvh_tree.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 
 #define BVHTREE_CLASS BVH_Tree<T, NUM_TREES, 2, MAX_ITEMS, USER_PAIR_TEST_FUNCTION, USER_CULL_TEST_FUNCTION, USE_PAIRS, BOUNDS, POINT>
@@ -271,6 +272,24 @@ public:
 		return false;
 	}
 
+	// Activates items created inactive, all from the same tree, in a single batch.
+	// This is much faster than activating them one by one for large amounts of items.
+	void activate_bulk(const BVHHandle *p_handles, const BOUNDS *p_aabbs, uint32_t p_count) {
+		BVH_LOCKED_FUNCTION
+		tree.items_activate_bulk(p_handles, p_aabbs, p_count);
+
+		if (USE_PAIRS) {
+			for (uint32_t n = 0; n < p_count; n++) {
+				BOUNDS &expanded_aabb = tree._pairs[p_handles[n].id()].expanded_aabb;
+				expanded_aabb = p_aabbs[n];
+				expanded_aabb.grow_by(tree._pairing_expansion);
+
+				_add_changed_item(p_handles[n], p_aabbs[n], false);
+			}
+			_check_for_collisions(true);
+		}
+	}
+
 	bool deactivate(BVHHandle p_handle) {
 		DEV_ASSERT(!p_handle.is_invalid());
 		BVH_LOCKED_FUNCTION
@@ -381,6 +400,12 @@ public:
 		return params.result_count_overall;
 	}
 
+	// Not locked, as it only reads from the tree. The caller must ensure the BVH is not
+	// modified while it runs, but several threads can cull packets at the same time.
+	void cull_segment_packet(const typename BVHABB_CLASS::Segment *p_segments, int p_segment_count, T **r_results, int *r_subindices, int p_result_max, int *r_result_counts, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF) {
+		tree.cull_segment_packet(p_segments, p_segment_count, p_tester, p_tree_collision_mask, p_result_max, r_results, r_subindices, r_result_counts);
+	}
+
 	int cull_point(const POINT &p_point, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
 		BVH_LOCKED_FUNCTION
 		typename BVHTREE_CLASS::CullParams params;
@@ -429,12 +454,63 @@ public:
 
 private:
 	// do this after moving etc.
+	// Below this amount of moved items, pairing isn't worth spreading over threads.
+	static const uint32_t PARALLEL_PAIRING_MIN_CHANGED_ITEMS = 256;
+
+	void _cull_changed_item(uint32_t p_index, void *p_userdata) {
+		const BVHHandle &h = changed_items[p_index];
+		const typename BVHTREE_CLASS::ItemExtra &extra = tree._extra[h.id()];
+
+		BVHABB_CLASS abb;
+		abb.from(tree._pairs[h.id()].expanded_aabb);
+
+		LocalVector<uint32_t> &hits = changed_item_hits[p_index];
+		hits.clear();
+		tree.cull_aabb_ref_ids(abb, extra.userdata, extra.tree_collision_mask, hits);
+	}
+
+	void _check_for_collisions_parallel(bool p_full_check) {
+		// The culls only read the tree, so they run in parallel first. Leavers and
+		// new pairs are still handled serially in the same order, as the callbacks
+		// aren't thread safe.
+		if (changed_item_hits.size() < changed_items.size()) {
+			changed_item_hits.resize(changed_items.size());
+		}
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &BVH_Manager::_cull_changed_item, nullptr, changed_items.size(), -1, true, SNAME("BVHPairCull"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (unsigned int n = 0; n < changed_items.size(); n++) {
+			const BVHHandle &h = changed_items[n];
+
+			BVHABB_CLASS abb;
+			abb.from(tree._pairs[h.id()].expanded_aabb);
+			_find_leavers(h, abb, p_full_check);
+
+			const LocalVector<uint32_t> &hits = changed_item_hits[n];
+			for (unsigned int i = 0; i < hits.size(); i++) {
+				if (hits[i] == h.id()) {
+					continue;
+				}
+
+				BVHHandle h_collidee;
+				h_collidee.set_id(hits[i]);
+				_collide(h, h_collidee);
+			}
+		}
+		_reset();
+	}
+
 	void _check_for_collisions(bool p_full_check = false) {
 		if (!changed_items.size()) {
 			// noop
 			return;
 		}
 
+		if (changed_items.size() >= PARALLEL_PAIRING_MIN_CHANGED_ITEMS && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+			_check_for_collisions_parallel(p_full_check);
+			return;
+		}
+
 		BOUNDS bb;
 
 		typename BVHTREE_CLASS::CullParams params;
@@ -775,6 +851,7 @@ private:
 	// for collision pairing,
 	// maintain a list of all items moved etc on each frame / tick
 	LocalVector<BVHHandle, uint32_t, true> changed_items;
+	LocalVector<LocalVector<uint32_t>> changed_item_hits; // Cull results of each changed item, when pairing in parallel.
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
 	class BVHLockedFunction {
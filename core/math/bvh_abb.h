@@ -47,6 +47,21 @@ struct BVH_ABB {
 		POINT to;
 	};
 
+	// Segment preprocessed for slab tests, the parameter runs from 0 at from to 1 at to.
+	struct Ray {
+		POINT origin;
+		POINT inv_dir;
+
+		void set(const Segment &p_s) {
+			origin = p_s.from;
+			POINT dir = p_s.to - p_s.from;
+			for (int axis = 0; axis < POINT::AXIS_COUNT; ++axis) {
+				// Avoid infinities, so points lying on a slab plane don't produce NaNs.
+				inv_dir[axis] = dir[axis] != 0 ? 1 / dir[axis] : FLT_MAX;
+			}
+		}
+	};
+
 	enum IntersectResult {
 		IR_MISS = 0,
 		IR_PARTIAL,
@@ -202,6 +217,20 @@ struct BVH_ABB {
 		return bb.intersects_segment(p_s.from, p_s.to);
 	}
 
+	// Branchless slab test, cheaper than intersects_segment() and easy for the compiler to vectorize
+	// when testing a packet of rays against the same box.
+	bool intersects_ray(const Ray &p_ray) const {
+		real_t t_min = 0;
+		real_t t_max = 1;
+		for (int axis = 0; axis < POINT::AXIS_COUNT; ++axis) {
+			real_t t0 = (min[axis] - p_ray.origin[axis]) * p_ray.inv_dir[axis];
+			real_t t1 = (-neg_max[axis] - p_ray.origin[axis]) * p_ray.inv_dir[axis];
+			t_min = MAX(t_min, MIN(t0, t1));
+			t_max = MIN(t_max, MAX(t0, t1));
+		}
+		return t_min <= t_max;
+	}
+
 	bool intersects_point(const POINT &p_pt) const {
 		if (_any_lessthan(-p_pt, neg_max)) {
 			return false;
@@ -45,6 +45,7 @@
 #include "core/math/vector3.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/pooled_list.h"
+#include "core/templates/sort_array.h"
 #include <limits.h>
 
 #define BVHABB_CLASS BVH_ABB<BOUNDS, POINT>
@@ -84,6 +85,9 @@ struct BVHCommon {
 	// or use zero for invalid and +1 based indices.
 	static const uint32_t INVALID = (0xffffffff);
 	static const uint32_t INACTIVE = (0xfffffffe);
+
+	// Maximum amount of segments culled in a single traversal by cull_segment_packet(), one bit each in a mask.
+	static const int SEGMENT_PACKET_SIZE = 32;
 };
 
 // really a handle, can be anything
@@ -432,6 +436,57 @@ private:
 		return needs_refit;
 	}
 
+	struct BulkItem {
+		uint32_t ref_id;
+		BVHABB_CLASS abb;
+		POINT centre;
+	};
+
+	struct BulkItemComparator {
+		int axis = 0;
+		bool operator()(const BulkItem &p_a, const BulkItem &p_b) const { return p_a.centre[axis] < p_b.centre[axis]; }
+	};
+
+	// Builds a subtree for the items by recursive median splits on the longest axis of their centres.
+	// Leaves are only filled to half their capacity, to leave room for later insertions.
+	uint32_t _build_bulk_subtree(BulkItem *p_items, uint32_t p_count) {
+		uint32_t node_id;
+		TNode *node = _nodes.request(node_id);
+		node->clear();
+
+		const uint32_t leaf_capacity = MAX(MAX_ITEMS / 2, 1);
+		if (p_count <= leaf_capacity) {
+			node_make_leaf(node_id);
+			for (uint32_t n = 0; n < p_count; n++) {
+				_node_add_item(node_id, p_items[n].ref_id, p_items[n].abb);
+			}
+			node_update_aabb(_nodes[node_id]);
+			return node_id;
+		}
+
+		BVHABB_CLASS centres;
+		centres.set_to_max_opposite_extents();
+		for (uint32_t n = 0; n < p_count; n++) {
+			BVHABB_CLASS point;
+			point.min = p_items[n].centre;
+			point.neg_max = -p_items[n].centre;
+			centres.merge(point);
+		}
+
+		SortArray<BulkItem, BulkItemComparator> sorter;
+		sorter.compare.axis = centres.calculate_size().max_axis_index();
+		uint32_t half = p_count / 2;
+		sorter.nth_element(0, p_count, half, p_items);
+
+		uint32_t child_a = _build_bulk_subtree(p_items, half);
+		uint32_t child_b = _build_bulk_subtree(p_items + half, p_count - half);
+
+		node_add_child(node_id, child_a);
+		node_add_child(node_id, child_b);
+		node_update_aabb(_nodes[node_id]);
+		return node_id;
+	}
+
 	uint32_t _node_create_another_child(uint32_t p_node_id, const BVHABB_CLASS &p_aabb) {
 		uint32_t child_node_id;
 		TNode *child_node = _nodes.request(child_node_id);
@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
 #include "core/os/os.h"
+#include "core/variant/variant_internal.h"
 #include "core/variant/variant_parser.h"
 
 Error Expression::_get_token(Token &r_token) {
@@ -1240,6 +1241,56 @@ bool Expression::_compile_expression() {
 	return false;
 }
 
+// Validated evaluators skip the checks done by Variant::evaluate(), so they are only used
+// for operators that can't fail on value types (no division, modulo or shifts).
+static bool _can_use_validated_operator(Variant::Operator p_op, Variant::Type p_type_a, Variant::Type p_type_b) {
+	switch (p_op) {
+		case Variant::OP_EQUAL:
+		case Variant::OP_NOT_EQUAL:
+		case Variant::OP_LESS:
+		case Variant::OP_LESS_EQUAL:
+		case Variant::OP_GREATER:
+		case Variant::OP_GREATER_EQUAL:
+		case Variant::OP_ADD:
+		case Variant::OP_SUBTRACT:
+		case Variant::OP_MULTIPLY:
+		case Variant::OP_NEGATE:
+		case Variant::OP_POSITIVE:
+		case Variant::OP_BIT_AND:
+		case Variant::OP_BIT_OR:
+		case Variant::OP_BIT_XOR:
+		case Variant::OP_BIT_NEGATE:
+		case Variant::OP_AND:
+		case Variant::OP_OR:
+		case Variant::OP_XOR:
+		case Variant::OP_NOT:
+			break;
+		default:
+			return false;
+	}
+
+	for (Variant::Type type : { p_type_a, p_type_b }) {
+		switch (type) {
+			case Variant::NIL:
+			case Variant::BOOL:
+			case Variant::INT:
+			case Variant::FLOAT:
+			case Variant::VECTOR2:
+			case Variant::VECTOR2I:
+			case Variant::VECTOR3:
+			case Variant::VECTOR3I:
+			case Variant::VECTOR4:
+			case Variant::VECTOR4I:
+			case Variant::COLOR:
+				break;
+			default:
+				return false;
+		}
+	}
+
+	return Variant::get_validated_operator_evaluator(p_op, p_type_a, p_type_b) != nullptr;
+}
+
 bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str) {
 	switch (p_node->type) {
 		case Expression::ENode::TYPE_INPUT: {
@@ -1280,6 +1331,12 @@ bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression:
 				}
 			}
 
+			if (op->cached_evaluator && a.get_type() == op->cached_type_a && b.get_type() == op->cached_type_b) {
+				VariantInternal::initialize(&r_ret, op->cached_return_type);
+				op->cached_evaluator(&a, &b, &r_ret);
+				break;
+			}
+
 			bool valid = true;
 			Variant::evaluate(op->op, a, b, r_ret, valid);
 			if (!valid) {
@@ -1287,6 +1344,14 @@ bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression:
 				return true;
 			}
 
+			if (_can_use_validated_operator(op->op, a.get_type(), b.get_type())) {
+				Expression::OperatorNode *cache = const_cast<Expression::OperatorNode *>(op);
+				cache->cached_type_a = a.get_type();
+				cache->cached_type_b = b.get_type();
+				cache->cached_return_type = Variant::get_operator_return_type(op->op, a.get_type(), b.get_type());
+				cache->cached_evaluator = Variant::get_validated_operator_evaluator(op->op, a.get_type(), b.get_type());
+			}
+
 		} break;
 		case Expression::ENode::TYPE_INDEX: {
 			const Expression::IndexNode *index = static_cast<const Expression::IndexNode *>(p_node);
@@ -1468,6 +1533,88 @@ bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression:
 	return false;
 }
 
+Expression::ENode *Expression::_fold_constants(ENode *p_node) {
+	if (!p_node) {
+		return nullptr;
+	}
+
+	bool foldable = false;
+
+	switch (p_node->type) {
+		case ENode::TYPE_OPERATOR: {
+			OperatorNode *op = static_cast<OperatorNode *>(p_node);
+			op->nodes[0] = _fold_constants(op->nodes[0]);
+			op->nodes[1] = _fold_constants(op->nodes[1]);
+			foldable = op->nodes[0]->type == ENode::TYPE_CONSTANT && (!op->nodes[1] || op->nodes[1]->type == ENode::TYPE_CONSTANT);
+		} break;
+		case ENode::TYPE_INDEX: {
+			IndexNode *index = static_cast<IndexNode *>(p_node);
+			index->base = _fold_constants(index->base);
+			index->index = _fold_constants(index->index);
+			foldable = index->base->type == ENode::TYPE_CONSTANT && index->index->type == ENode::TYPE_CONSTANT;
+		} break;
+		case ENode::TYPE_NAMED_INDEX: {
+			NamedIndexNode *index = static_cast<NamedIndexNode *>(p_node);
+			index->base = _fold_constants(index->base);
+			foldable = index->base->type == ENode::TYPE_CONSTANT;
+		} break;
+		case ENode::TYPE_CONSTRUCTOR: {
+			ConstructorNode *constructor = static_cast<ConstructorNode *>(p_node);
+			foldable = true;
+			for (int i = 0; i < constructor->arguments.size(); i++) {
+				constructor->arguments.write[i] = _fold_constants(constructor->arguments[i]);
+				foldable = foldable && constructor->arguments[i]->type == ENode::TYPE_CONSTANT;
+			}
+		} break;
+		case ENode::TYPE_ARRAY: {
+			// Not folded itself, every execution must return a new array.
+			ArrayNode *array = static_cast<ArrayNode *>(p_node);
+			for (int i = 0; i < array->array.size(); i++) {
+				array->array.write[i] = _fold_constants(array->array[i]);
+			}
+		} break;
+		case ENode::TYPE_DICTIONARY: {
+			DictionaryNode *dictionary = static_cast<DictionaryNode *>(p_node);
+			for (int i = 0; i < dictionary->dict.size(); i++) {
+				dictionary->dict.write[i] = _fold_constants(dictionary->dict[i]);
+			}
+		} break;
+		case ENode::TYPE_BUILTIN_FUNC: {
+			// Not folded itself, utility functions like randf() differ between calls.
+			BuiltinFuncNode *func = static_cast<BuiltinFuncNode *>(p_node);
+			for (int i = 0; i < func->arguments.size(); i++) {
+				func->arguments.write[i] = _fold_constants(func->arguments[i]);
+			}
+		} break;
+		case ENode::TYPE_CALL: {
+			CallNode *call = static_cast<CallNode *>(p_node);
+			call->base = _fold_constants(call->base);
+			for (int i = 0; i < call->arguments.size(); i++) {
+				call->arguments.write[i] = _fold_constants(call->arguments[i]);
+			}
+		} break;
+		default: {
+		}
+	}
+
+	if (!foldable) {
+		return p_node;
+	}
+
+	Variant value;
+	String error_txt;
+	if (_execute(Array(), nullptr, p_node, value, true, error_txt)) {
+		return p_node; // Keep the node so execute() reports the error.
+	}
+	if (value.get_type() >= Variant::OBJECT) {
+		return p_node; // Reference types would be shared between executions.
+	}
+
+	ConstantNode *constant = alloc_node<ConstantNode>();
+	constant->value = value;
+	return constant;
+}
+
 Error Expression::parse(const String &p_expression, const Vector<String> &p_input_names) {
 	if (nodes) {
 		memdelete(nodes);
@@ -1492,6 +1639,8 @@ Error Expression::parse(const String &p_expression, const Vector<String> &p_inpu
 		return ERR_INVALID_PARAMETER;
 	}
 
+	root = _fold_constants(root);
+
 	return OK;
 }
 
@@ -1511,6 +1660,50 @@ Variant Expression::execute(Array p_inputs, Object *p_base, bool p_show_error, b
 	return output;
 }
 
+Array Expression::execute_many(const Array &p_input_columns, Object *p_base, bool p_show_error, bool p_const_calls_only) {
+	ERR_FAIL_COND_V_MSG(error_set, Array(), "There was previously a parse error: " + error_str + ".");
+
+	execution_error = false;
+
+	// Columns are converted once, so packed arrays don't go through Variant indexing per row.
+	const int input_count = p_input_columns.size();
+	Vector<Array> columns;
+	columns.resize(input_count);
+	int row_count = input_count > 0 ? -1 : 1;
+	for (int i = 0; i < input_count; i++) {
+		const Variant::Type column_type = p_input_columns[i].get_type();
+		ERR_FAIL_COND_V_MSG(column_type != Variant::ARRAY && (column_type < Variant::PACKED_BYTE_ARRAY || column_type > Variant::PACKED_COLOR_ARRAY), Array(), vformat("Input column %d is not an array.", i));
+		columns.write[i] = p_input_columns[i];
+		if (row_count == -1) {
+			row_count = columns[i].size();
+		}
+		ERR_FAIL_COND_V_MSG(columns[i].size() != row_count, Array(), "All input columns must have the same size.");
+	}
+
+	Array inputs;
+	inputs.resize(input_count);
+	Array outputs;
+	outputs.resize(row_count);
+
+	for (int row = 0; row < row_count; row++) {
+		for (int i = 0; i < input_count; i++) {
+			inputs[i] = columns[i][row];
+		}
+
+		Variant output;
+		String error_txt;
+		if (_execute(inputs, p_base, root, output, p_const_calls_only, error_txt)) {
+			execution_error = true;
+			error_str = error_txt;
+			ERR_FAIL_COND_V_MSG(p_show_error, Array(), error_str);
+			return Array();
+		}
+		outputs[row] = output;
+	}
+
+	return outputs;
+}
+
 bool Expression::has_execute_failed() const {
 	return execution_error;
 }
@@ -1522,6 +1715,7 @@ String Expression::get_error_text() const {
 void Expression::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("parse", "expression", "input_names"), &Expression::parse, DEFVAL(Vector<String>()));
 	ClassDB::bind_method(D_METHOD("execute", "inputs", "base_instance", "show_error", "const_calls_only"), &Expression::execute, DEFVAL(Array()), DEFVAL(Variant()), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("execute_many", "input_columns", "base_instance", "show_error", "const_calls_only"), &Expression::execute_many, DEFVAL(Variant()), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("has_execute_failed"), &Expression::has_execute_failed);
 	ClassDB::bind_method(D_METHOD("get_error_text"), &Expression::get_error_text);
 }
@@ -173,6 +173,12 @@ private:
 
 		ENode *nodes[2] = { nullptr, nullptr };
 
+		// Validated evaluator for the operand types seen last, skips the operator lookup when they repeat.
+		Variant::Type cached_type_a = Variant::VARIANT_MAX;
+		Variant::Type cached_type_b = Variant::VARIANT_MAX;
+		Variant::Type cached_return_type = Variant::NIL;
+		Variant::ValidatedOperatorEvaluator cached_evaluator = nullptr;
+
 		OperatorNode() {
 			type = TYPE_OPERATOR;
 		}
@@ -258,6 +264,7 @@ private:
 
 	bool execution_error = false;
 	bool _execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str);
+	ENode *_fold_constants(ENode *p_node);
 
 protected:
 	static void _bind_methods();
@@ -265,6 +272,7 @@ protected:
 public:
 	Error parse(const String &p_expression, const Vector<String> &p_input_names = Vector<String>());
 	Variant execute(Array p_inputs = Array(), Object *p_base = nullptr, bool p_show_error = true, bool p_const_calls_only = false);
+	Array execute_many(const Array &p_input_columns, Object *p_base = nullptr, bool p_show_error = true, bool p_const_calls_only = false);
 	bool has_execute_failed() const;
 	String get_error_text() const;
 
@@ -0,0 +1,294 @@
+/*************************************************************************/
+/*  packed_array_math.cpp                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "packed_array_math.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PACKED_ARRAY_MATH_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define PACKED_ARRAY_MATH_NEON
+#include <arm_neon.h>
+#endif
+
+void PackedArrayMath::add(float *p_dst, const float *p_src, int64_t p_count) {
+	int64_t i = 0;
+#if defined(PACKED_ARRAY_MATH_SSE2)
+	for (; i + 4 <= p_count; i += 4) {
+		_mm_storeu_ps(p_dst + i, _mm_add_ps(_mm_loadu_ps(p_dst + i), _mm_loadu_ps(p_src + i)));
+	}
+#elif defined(PACKED_ARRAY_MATH_NEON)
+	for (; i + 4 <= p_count; i += 4) {
+		vst1q_f32(p_dst + i, vaddq_f32(vld1q_f32(p_dst + i), vld1q_f32(p_src + i)));
+	}
+#endif
+	for (; i < p_count; i++) {
+		p_dst[i] += p_src[i];
+	}
+}
+
+void PackedArrayMath::add(double *p_dst, const double *p_src, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] += p_src[i];
+	}
+}
+
+void PackedArrayMath::mul(float *p_dst, const float *p_src, int64_t p_count) {
+	int64_t i = 0;
+#if defined(PACKED_ARRAY_MATH_SSE2)
+	for (; i + 4 <= p_count; i += 4) {
+		_mm_storeu_ps(p_dst + i, _mm_mul_ps(_mm_loadu_ps(p_dst + i), _mm_loadu_ps(p_src + i)));
+	}
+#elif defined(PACKED_ARRAY_MATH_NEON)
+	for (; i + 4 <= p_count; i += 4) {
+		vst1q_f32(p_dst + i, vmulq_f32(vld1q_f32(p_dst + i), vld1q_f32(p_src + i)));
+	}
+#endif
+	for (; i < p_count; i++) {
+		p_dst[i] *= p_src[i];
+	}
+}
+
+void PackedArrayMath::mul(double *p_dst, const double *p_src, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] *= p_src[i];
+	}
+}
+
+void PackedArrayMath::scale(float *p_dst, float p_factor, int64_t p_count) {
+	int64_t i = 0;
+#if defined(PACKED_ARRAY_MATH_SSE2)
+	const __m128 factor = _mm_set1_ps(p_factor);
+	for (; i + 4 <= p_count; i += 4) {
+		_mm_storeu_ps(p_dst + i, _mm_mul_ps(_mm_loadu_ps(p_dst + i), factor));
+	}
+#elif defined(PACKED_ARRAY_MATH_NEON)
+	for (; i + 4 <= p_count; i += 4) {
+		vst1q_f32(p_dst + i, vmulq_n_f32(vld1q_f32(p_dst + i), p_factor));
+	}
+#endif
+	for (; i < p_count; i++) {
+		p_dst[i] *= p_factor;
+	}
+}
+
+void PackedArrayMath::scale(double *p_dst, double p_factor, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] *= p_factor;
+	}
+}
+
+void PackedArrayMath::lerp(float *p_dst, const float *p_to, float p_weight, int64_t p_count) {
+	int64_t i = 0;
+#if defined(PACKED_ARRAY_MATH_SSE2)
+	const __m128 weight = _mm_set1_ps(p_weight);
+	for (; i + 4 <= p_count; i += 4) {
+		const __m128 from = _mm_loadu_ps(p_dst + i);
+		_mm_storeu_ps(p_dst + i, _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(p_to + i), from), weight)));
+	}
+#elif defined(PACKED_ARRAY_MATH_NEON)
+	for (; i + 4 <= p_count; i += 4) {
+		const float32x4_t from = vld1q_f32(p_dst + i);
+		vst1q_f32(p_dst + i, vmlaq_n_f32(from, vsubq_f32(vld1q_f32(p_to + i), from), p_weight));
+	}
+#endif
+	for (; i < p_count; i++) {
+		p_dst[i] += (p_to[i] - p_dst[i]) * p_weight;
+	}
+}
+
+void PackedArrayMath::lerp(double *p_dst, const double *p_to, double p_weight, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] += (p_to[i] - p_dst[i]) * p_weight;
+	}
+}
+
+void PackedArrayMath::clamp(float *p_dst, float p_min, float p_max, int64_t p_count) {
+	int64_t i = 0;
+#if defined(PACKED_ARRAY_MATH_SSE2)
+	const __m128 lo = _mm_set1_ps(p_min);
+	const __m128 hi = _mm_set1_ps(p_max);
+	for (; i + 4 <= p_count; i += 4) {
+		_mm_storeu_ps(p_dst + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(p_dst + i), lo), hi));
+	}
+#elif defined(PACKED_ARRAY_MATH_NEON)
+	const float32x4_t lo = vdupq_n_f32(p_min);
+	const float32x4_t hi = vdupq_n_f32(p_max);
+	for (; i + 4 <= p_count; i += 4) {
+		vst1q_f32(p_dst + i, vminq_f32(vmaxq_f32(vld1q_f32(p_dst + i), lo), hi));
+	}
+#endif
+	for (; i < p_count; i++) {
+		p_dst[i] = MIN(MAX(p_dst[i], p_min), p_max);
+	}
+}
+
+void PackedArrayMath::clamp(double *p_dst, double p_min, double p_max, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] = MIN(MAX(p_dst[i], p_min), p_max);
+	}
+}
+
+double PackedArrayMath::dot(const float *p_a, const float *p_b, int64_t p_count) {
+	double ret = 0.0;
+	int64_t i = 0;
+#if defined(PACKED_ARRAY_MATH_SSE2)
+	__m128d acc_lo = _mm_setzero_pd();
+	__m128d acc_hi = _mm_setzero_pd();
+	for (; i + 4 <= p_count; i += 4) {
+		const __m128 product = _mm_mul_ps(_mm_loadu_ps(p_a + i), _mm_loadu_ps(p_b + i));
+		acc_lo = _mm_add_pd(acc_lo, _mm_cvtps_pd(product));
+		acc_hi = _mm_add_pd(acc_hi, _mm_cvtps_pd(_mm_movehl_ps(product, product)));
+	}
+	double lanes[2];
+	_mm_storeu_pd(lanes, _mm_add_pd(acc_lo, acc_hi));
+	ret = lanes[0] + lanes[1];
+#elif defined(PACKED_ARRAY_MATH_NEON)
+	for (; i + 4 <= p_count; i += 4) {
+		const float32x4_t product = vmulq_f32(vld1q_f32(p_a + i), vld1q_f32(p_b + i));
+		ret += (double)vgetq_lane_f32(product, 0) + (double)vgetq_lane_f32(product, 1) + (double)vgetq_lane_f32(product, 2) + (double)vgetq_lane_f32(product, 3);
+	}
+#endif
+	for (; i < p_count; i++) {
+		ret += (double)p_a[i] * (double)p_b[i];
+	}
+	return ret;
+}
+
+double PackedArrayMath::dot(const double *p_a, const double *p_b, int64_t p_count) {
+	double ret = 0.0;
+	for (int64_t i = 0; i < p_count; i++) {
+		ret += p_a[i] * p_b[i];
+	}
+	return ret;
+}
+
+double PackedArrayMath::sum(const float *p_src, int64_t p_count) {
+	double ret = 0.0;
+	int64_t i = 0;
+#if defined(PACKED_ARRAY_MATH_SSE2)
+	__m128d acc_lo = _mm_setzero_pd();
+	__m128d acc_hi = _mm_setzero_pd();
+	for (; i + 4 <= p_count; i += 4) {
+		const __m128 values = _mm_loadu_ps(p_src + i);
+		acc_lo = _mm_add_pd(acc_lo, _mm_cvtps_pd(values));
+		acc_hi = _mm_add_pd(acc_hi, _mm_cvtps_pd(_mm_movehl_ps(values, values)));
+	}
+	double lanes[2];
+	_mm_storeu_pd(lanes, _mm_add_pd(acc_lo, acc_hi));
+	ret = lanes[0] + lanes[1];
+#endif
+	for (; i < p_count; i++) {
+		ret += p_src[i];
+	}
+	return ret;
+}
+
+double PackedArrayMath::sum(const double *p_src, int64_t p_count) {
+	double ret = 0.0;
+	for (int64_t i = 0; i < p_count; i++) {
+		ret += p_src[i];
+	}
+	return ret;
+}
+
+float PackedArrayMath::min(const float *p_src, int64_t p_count) {
+	float ret = p_src[0];
+	int64_t i = 0;
+#if defined(PACKED_ARRAY_MATH_SSE2)
+	if (p_count >= 4) {
+		__m128 acc = _mm_loadu_ps(p_src);
+		for (i = 4; i + 4 <= p_count; i += 4) {
+			acc = _mm_min_ps(acc, _mm_loadu_ps(p_src + i));
+		}
+		float lanes[4];
+		_mm_storeu_ps(lanes, acc);
+		ret = MIN(MIN(lanes[0], lanes[1]), MIN(lanes[2], lanes[3]));
+	}
+#elif defined(PACKED_ARRAY_MATH_NEON)
+	if (p_count >= 4) {
+		float32x4_t acc = vld1q_f32(p_src);
+		for (i = 4; i + 4 <= p_count; i += 4) {
+			acc = vminq_f32(acc, vld1q_f32(p_src + i));
+		}
+		const float32x2_t acc2 = vpmin_f32(vget_low_f32(acc), vget_high_f32(acc));
+		ret = MIN(vget_lane_f32(acc2, 0), vget_lane_f32(acc2, 1));
+	}
+#endif
+	for (; i < p_count; i++) {
+		ret = MIN(ret, p_src[i]);
+	}
+	return ret;
+}
+
+double PackedArrayMath::min(const double *p_src, int64_t p_count) {
+	double ret = p_src[0];
+	for (int64_t i = 1; i < p_count; i++) {
+		ret = MIN(ret, p_src[i]);
+	}
+	return ret;
+}
+
+float PackedArrayMath::max(const float *p_src, int64_t p_count) {
+	float ret = p_src[0];
+	int64_t i = 0;
+#if defined(PACKED_ARRAY_MATH_SSE2)
+	if (p_count >= 4) {
+		__m128 acc = _mm_loadu_ps(p_src);
+		for (i = 4; i + 4 <= p_count; i += 4) {
+			acc = _mm_max_ps(acc, _mm_loadu_ps(p_src + i));
+		}
+		float lanes[4];
+		_mm_storeu_ps(lanes, acc);
+		ret = MAX(MAX(lanes[0], lanes[1]), MAX(lanes[2], lanes[3]));
+	}
+#elif defined(PACKED_ARRAY_MATH_NEON)
+	if (p_count >= 4) {
+		float32x4_t acc = vld1q_f32(p_src);
+		for (i = 4; i + 4 <= p_count; i += 4) {
+			acc = vmaxq_f32(acc, vld1q_f32(p_src + i));
+		}
+		const float32x2_t acc2 = vpmax_f32(vget_low_f32(acc), vget_high_f32(acc));
+		ret = MAX(vget_lane_f32(acc2, 0), vget_lane_f32(acc2, 1));
+	}
+#endif
+	for (; i < p_count; i++) {
+		ret = MAX(ret, p_src[i]);
+	}
+	return ret;
+}
+
+double PackedArrayMath::max(const double *p_src, int64_t p_count) {
+	double ret = p_src[0];
+	for (int64_t i = 1; i < p_count; i++) {
+		ret = MAX(ret, p_src[i]);
+	}
+	return ret;
+}
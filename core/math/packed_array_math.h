@@ -0,0 +1,69 @@
+/*************************************************************************/
+/*  packed_array_math.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef PACKED_ARRAY_MATH_H
+#define PACKED_ARRAY_MATH_H
+
+#include "core/typedefs.h"
+
+// Bulk kernels behind the math methods of the packed float and vector arrays.
+// Vector arrays are processed as flat arrays of their components. The float
+// versions use SSE2 or NEON when the target has them, the double versions
+// are plain loops the compiler can vectorize.
+class PackedArrayMath {
+public:
+	// p_dst += p_src.
+	static void add(float *p_dst, const float *p_src, int64_t p_count);
+	static void add(double *p_dst, const double *p_src, int64_t p_count);
+	// p_dst *= p_src.
+	static void mul(float *p_dst, const float *p_src, int64_t p_count);
+	static void mul(double *p_dst, const double *p_src, int64_t p_count);
+	// p_dst *= p_factor.
+	static void scale(float *p_dst, float p_factor, int64_t p_count);
+	static void scale(double *p_dst, double p_factor, int64_t p_count);
+	// p_dst += (p_to - p_dst) * p_weight.
+	static void lerp(float *p_dst, const float *p_to, float p_weight, int64_t p_count);
+	static void lerp(double *p_dst, const double *p_to, double p_weight, int64_t p_count);
+	static void clamp(float *p_dst, float p_min, float p_max, int64_t p_count);
+	static void clamp(double *p_dst, double p_min, double p_max, int64_t p_count);
+
+	// Sums are accumulated in double precision.
+	static double dot(const float *p_a, const float *p_b, int64_t p_count);
+	static double dot(const double *p_a, const double *p_b, int64_t p_count);
+	static double sum(const float *p_src, int64_t p_count);
+	static double sum(const double *p_src, int64_t p_count);
+	// p_count must be greater than 0.
+	static float min(const float *p_src, int64_t p_count);
+	static double min(const double *p_src, int64_t p_count);
+	static float max(const float *p_src, int64_t p_count);
+	static double max(const double *p_src, int64_t p_count);
+};
+
+#endif // PACKED_ARRAY_MATH_H
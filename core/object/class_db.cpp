@@ -53,6 +53,8 @@ MethodDefinition D_METHODP(const char *p_name, const char *const **p_args, uint3
 #endif
 
 ClassDB::APIType ClassDB::current_api = API_CORE;
+bool ClassDB::lazy_binding = false;
+SafeNumeric<uint32_t> ClassDB::lazy_class_count;
 
 void ClassDB::set_current_api(APIType p_api) {
 	current_api = p_api;
@@ -162,6 +164,8 @@ ClassDB::APIType ClassDB::get_api_type(const StringName &p_class) {
 }
 
 uint64_t ClassDB::get_api_hash(APIType p_api) {
+	bind_lazy_classes();
+
 	OBJTYPE_RLOCK;
 #ifdef DEBUG_METHODS_ENABLED
 
@@ -396,7 +400,11 @@ void ClassDB::_add_class2(const StringName &p_class, const StringName &p_inherit
 
 	const StringName &name = p_class;
 
-	ERR_FAIL_COND_MSG(classes.has(name), "Class '" + String(p_class) + "' already exists.");
+	ClassInfo *existing = classes.getptr(name);
+	if (existing && existing->lazy_initialize_func) {
+		return; // Registered lazily, the class is being bound now.
+	}
+	ERR_FAIL_COND_MSG(existing, "Class '" + String(p_class) + "' already exists.");
 
 	classes[name] = ClassInfo();
 	ClassInfo &ti = classes[name];
@@ -413,6 +421,98 @@ void ClassDB::_add_class2(const StringName &p_class, const StringName &p_inherit
 	}
 }
 
+ClassDB::ClassInfo *ClassDB::_add_lazy_class(const StringName &p_class, const StringName &p_inherits, void (*p_initialize_func)()) {
+	OBJTYPE_WLOCK;
+
+	ClassInfo *ti = classes.getptr(p_class);
+	if (ti) {
+		return ti; // Already initialized, e.g. as the parent of a class registered earlier.
+	}
+
+	ClassInfo *parent = nullptr;
+	if (p_inherits != StringName()) {
+		parent = classes.getptr(p_inherits);
+		if (!parent) {
+			return nullptr;
+		}
+	}
+
+	ti = &classes.insert(p_class, ClassInfo())->value;
+	ti->name = p_class;
+	ti->inherits = p_inherits;
+	ti->inherits_ptr = parent;
+	ti->api = current_api;
+	ti->lazy_initialize_func = p_initialize_func;
+	lazy_class_count.increment();
+
+	return ti;
+}
+
+void ClassDB::_bind_lazy_class(const StringName &p_class) {
+	ClassInfo *ti = nullptr;
+	{
+		OBJTYPE_RLOCK;
+		ti = classes.getptr(p_class);
+		if (likely(!ti || !ti->lazy_initialize_func)) {
+			return;
+		}
+	}
+
+	GLOBAL_LOCK_FUNCTION;
+
+	void (*initialize_func)() = nullptr;
+	{
+		OBJTYPE_RLOCK;
+		initialize_func = ti->lazy_initialize_func;
+	}
+	if (!initialize_func) {
+		return; // Bound by another thread while waiting for the lock.
+	}
+
+	// Also binds every parent class, so the whole chain can be marked as bound.
+	initialize_func();
+
+	OBJTYPE_WLOCK;
+	for (ClassInfo *t = ti; t; t = t->inherits_ptr) {
+		if (t->lazy_initialize_func) {
+			t->lazy_initialize_func = nullptr;
+			lazy_class_count.decrement();
+		}
+	}
+}
+
+void ClassDB::set_lazy_binding_enabled(bool p_enabled) {
+	lazy_binding = p_enabled;
+}
+
+bool ClassDB::is_lazy_binding_enabled() {
+	return lazy_binding;
+}
+
+void ClassDB::bind_lazy_classes() {
+	if (lazy_class_count.get() == 0) {
+		return;
+	}
+
+	LocalVector<StringName> pending;
+	{
+		OBJTYPE_RLOCK;
+		for (const KeyValue<StringName, ClassInfo> &E : classes) {
+			if (E.value.lazy_initialize_func) {
+				pending.push_back(E.key);
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < pending.size(); i++) {
+		_bind_lazy_class(pending[i]);
+	}
+}
+
+uint32_t ClassDB::get_lazy_class_count() {
+	return lazy_class_count.get();
+}
+
 static MethodInfo info_from_bind(MethodBind *p_method) {
 	MethodInfo minfo;
 	minfo.name = p_method->get_name();
@@ -435,6 +535,7 @@ static MethodInfo info_from_bind(MethodBind *p_method) {
 }
 
 void ClassDB::get_method_list(const StringName &p_class, List<MethodInfo> *p_methods, bool p_no_inheritance, bool p_exclude_from_properties) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -485,6 +586,7 @@ void ClassDB::get_method_list(const StringName &p_class, List<MethodInfo> *p_met
 }
 
 bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_method, MethodInfo *r_info, bool p_no_inheritance, bool p_exclude_from_properties) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -535,6 +637,7 @@ bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_met
 }
 
 MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_name) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -587,6 +690,7 @@ void ClassDB::bind_integer_constant(const StringName &p_class, const StringName
 }
 
 void ClassDB::get_integer_constant_list(const StringName &p_class, List<String> *p_constants, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -612,6 +716,7 @@ void ClassDB::get_integer_constant_list(const StringName &p_class, List<String>
 }
 
 int64_t ClassDB::get_integer_constant(const StringName &p_class, const StringName &p_name, bool *p_success) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -636,6 +741,7 @@ int64_t ClassDB::get_integer_constant(const StringName &p_class, const StringNam
 }
 
 bool ClassDB::has_integer_constant(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -655,6 +761,7 @@ bool ClassDB::has_integer_constant(const StringName &p_class, const StringName &
 }
 
 StringName ClassDB::get_integer_constant_enum(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -679,6 +786,7 @@ StringName ClassDB::get_integer_constant_enum(const StringName &p_class, const S
 }
 
 void ClassDB::get_enum_list(const StringName &p_class, List<StringName> *p_enums, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -697,6 +805,7 @@ void ClassDB::get_enum_list(const StringName &p_class, List<StringName> *p_enums
 }
 
 void ClassDB::get_enum_constants(const StringName &p_class, const StringName &p_enum, List<StringName> *p_constants, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -730,6 +839,7 @@ void ClassDB::set_method_error_return_values(const StringName &p_class, const St
 }
 
 Vector<Error> ClassDB::get_method_error_return_values(const StringName &p_class, const StringName &p_method) {
+	_ensure_class_bound(p_class);
 #ifdef DEBUG_METHODS_ENABLED
 	ClassInfo *type = classes.getptr(p_class);
 
@@ -745,6 +855,7 @@ Vector<Error> ClassDB::get_method_error_return_values(const StringName &p_class,
 }
 
 bool ClassDB::has_enum(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -764,6 +875,7 @@ bool ClassDB::has_enum(const StringName &p_class, const StringName &p_name, bool
 }
 
 bool ClassDB::is_enum_bitfield(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -802,6 +914,7 @@ void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal)
 }
 
 void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_signals, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -823,6 +936,7 @@ void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_sig
 }
 
 bool ClassDB::has_signal(const StringName &p_class, const StringName &p_signal, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -840,6 +954,7 @@ bool ClassDB::has_signal(const StringName &p_class, const StringName &p_signal,
 }
 
 bool ClassDB::get_signal(const StringName &p_class, const StringName &p_signal, MethodInfo *r_signal) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -978,6 +1093,7 @@ void ClassDB::add_linked_property(const StringName &p_class, const String &p_pro
 }
 
 void ClassDB::get_property_list(const StringName &p_class, List<PropertyInfo> *p_list, bool p_no_inheritance, const Object *p_validator) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -1002,6 +1118,7 @@ void ClassDB::get_property_list(const StringName &p_class, List<PropertyInfo> *p
 }
 
 void ClassDB::get_linked_properties_info(const StringName &p_class, const StringName &p_property, List<StringName> *r_properties, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 #ifdef TOOLS_ENABLED
 	ClassInfo *check = classes.getptr(p_class);
 	while (check) {
@@ -1021,6 +1138,7 @@ void ClassDB::get_linked_properties_info(const StringName &p_class, const String
 }
 
 bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_property, PropertyInfo *r_info, bool p_no_inheritance, const Object *p_validator) {
+	_ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *check = classes.getptr(p_class);
@@ -1145,6 +1263,7 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 }
 
 int ClassDB::get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
+	_ensure_class_bound(p_class);
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1167,6 +1286,7 @@ int ClassDB::get_property_index(const StringName &p_class, const StringName &p_p
 }
 
 Variant::Type ClassDB::get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
+	_ensure_class_bound(p_class);
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1189,6 +1309,7 @@ Variant::Type ClassDB::get_property_type(const StringName &p_class, const String
 }
 
 StringName ClassDB::get_property_setter(const StringName &p_class, const StringName &p_property) {
+	_ensure_class_bound(p_class);
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1203,7 +1324,27 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+MethodBind *ClassDB::get_property_setter_bind(const StringName &p_class, const StringName &p_property, int *r_index) {
+	_ensure_class_bound(p_class);
+	ClassInfo *type = classes.getptr(p_class);
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			if (r_index) {
+				*r_index = psg->index;
+			}
+			return psg->_setptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
+	_ensure_class_bound(p_class);
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1219,6 +1360,7 @@ StringName ClassDB::get_property_getter(const StringName &p_class, const StringN
 }
 
 bool ClassDB::has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1245,6 +1387,7 @@ void ClassDB::set_method_flags(const StringName &p_class, const StringName &p_me
 }
 
 bool ClassDB::has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1370,6 +1513,7 @@ void ClassDB::add_virtual_method(const StringName &p_class, const MethodInfo &p_
 }
 
 void ClassDB::get_virtual_methods(const StringName &p_class, List<MethodInfo> *p_methods, bool p_no_inheritance) {
+	_ensure_class_bound(p_class);
 	ERR_FAIL_COND_MSG(!classes.has(p_class), "Request for nonexistent class '" + p_class + "'.");
 
 #ifdef DEBUG_METHODS_ENABLED
@@ -1449,6 +1593,7 @@ HashMap<StringName, HashMap<StringName, Variant>> ClassDB::default_values;
 HashSet<StringName> ClassDB::default_values_cached;
 
 Variant ClassDB::class_get_default_property_value(const StringName &p_class, const StringName &p_property, bool *r_valid) {
+	_ensure_class_bound(p_class);
 	if (!default_values_cached.has(p_class)) {
 		if (!default_values.has(p_class)) {
 			default_values[p_class] = HashMap<StringName, Variant>();
@@ -1528,6 +1673,9 @@ void ClassDB::register_extension_class(ObjectNativeExtension *p_extension) {
 	ERR_FAIL_COND_MSG(classes.has(p_extension->class_name), "Class already registered: " + String(p_extension->class_name));
 	ERR_FAIL_COND_MSG(!classes.has(p_extension->parent_class_name), "Parent class name for extension class not found: " + String(p_extension->parent_class_name));
 
+	// Extension classes only bind their own methods, so the native parent must be bound too.
+	_ensure_class_bound(p_extension->parent_class_name);
+
 	ClassInfo *parent = classes.getptr(p_extension->parent_class_name);
 
 	ClassInfo c;
@@ -39,6 +39,7 @@
 // Needs to come after method_bind and object have been included.
 #include "core/object/callable_method_pointer.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/safe_refcount.h"
 
 #define DEFVAL(m_defval) (m_defval)
 
@@ -130,6 +131,8 @@ public:
 		bool exposed = false;
 		bool is_virtual = false;
 		Object *(*creation_func)() = nullptr;
+		// Set while the class is registered but its methods and properties are not bound yet.
+		void (*lazy_initialize_func)() = nullptr;
 
 		ClassInfo() {}
 		~ClassInfo() {}
@@ -152,8 +155,35 @@ public:
 #endif
 
 	static APIType current_api;
+	static bool lazy_binding;
+	static SafeNumeric<uint32_t> lazy_class_count;
 
 	static void _add_class2(const StringName &p_class, const StringName &p_inherits);
+	static ClassInfo *_add_lazy_class(const StringName &p_class, const StringName &p_inherits, void (*p_initialize_func)());
+	static void _bind_lazy_class(const StringName &p_class);
+
+	// Binds the methods and properties of a lazily registered class before it is queried.
+	// Must be called before taking the lock, as binding needs to write to the class.
+	_FORCE_INLINE_ static void _ensure_class_bound(const StringName &p_class) {
+		if (unlikely(lazy_class_count.get() > 0)) {
+			_bind_lazy_class(p_class);
+		}
+	}
+
+	template <class T>
+	static ClassInfo *_register_class_info() {
+		if (lazy_binding) {
+			// Only the class hierarchy is needed up front, binding is deferred until the
+			// class is instantiated or queried. Classes whose parent is not registered yet
+			// are initialized right away, as the parent type is not known here.
+			ClassInfo *t = _add_lazy_class(T::get_class_static(), T::get_parent_class_static(), &T::initialize_class);
+			if (t) {
+				return t;
+			}
+		}
+		T::initialize_class();
+		return classes.getptr(T::get_class_static());
+	}
 
 	static HashMap<StringName, HashMap<StringName, Variant>> default_values;
 	static HashSet<StringName> default_values_cached;
@@ -180,8 +210,7 @@ public:
 	template <class T>
 	static void register_class(bool p_virtual = false) {
 		GLOBAL_LOCK_FUNCTION;
-		T::initialize_class();
-		ClassInfo *t = classes.getptr(T::get_class_static());
+		ClassInfo *t = _register_class_info<T>();
 		ERR_FAIL_COND(!t);
 		t->creation_func = &creator<T>;
 		t->exposed = true;
@@ -194,8 +223,7 @@ public:
 	template <class T>
 	static void register_abstract_class() {
 		GLOBAL_LOCK_FUNCTION;
-		T::initialize_class();
-		ClassInfo *t = classes.getptr(T::get_class_static());
+		ClassInfo *t = _register_class_info<T>();
 		ERR_FAIL_COND(!t);
 		t->exposed = true;
 		t->class_ptr = T::get_class_ptr_static();
@@ -241,6 +269,11 @@ public:
 
 	static uint64_t get_api_hash(APIType p_api);
 
+	static void set_lazy_binding_enabled(bool p_enabled);
+	static bool is_lazy_binding_enabled();
+	static void bind_lazy_classes();
+	static uint32_t get_lazy_class_count();
+
 	template <class N, class M, typename... VarArgs>
 	static MethodBind *bind_method(N p_method_name, M p_method, VarArgs... p_args) {
 		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
@@ -320,6 +353,7 @@ public:
 	static int get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static Variant::Type get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static StringName get_property_setter(const StringName &p_class, const StringName &p_property);
+	static MethodBind *get_property_setter_bind(const StringName &p_class, const StringName &p_property, int *r_index = nullptr);
 	static StringName get_property_getter(const StringName &p_class, const StringName &p_property);
 
 	static bool has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance = false);
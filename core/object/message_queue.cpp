@@ -37,65 +37,118 @@
 
 MessageQueue *MessageQueue::singleton = nullptr;
 
+thread_local MessageQueue::ThreadBufferOwner MessageQueue::thread_buffer_owner;
+Mutex MessageQueue::thread_buffers_mutex;
+uint32_t MessageQueue::last_generation = 0;
+
+MessageQueue::ThreadBufferOwner::~ThreadBufferOwner() {
+	if (!buffer) {
+		return;
+	}
+	// The thread is exiting, its buffer is freed by the next flush once its messages are processed.
+	MutexLock lock(thread_buffers_mutex);
+	if (MessageQueue::singleton && MessageQueue::singleton->generation == generation) {
+		buffer->orphaned = true;
+	}
+}
+
 MessageQueue *MessageQueue::get_singleton() {
 	return singleton;
 }
 
-Error MessageQueue::push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
-	return push_callablep(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
+MessageQueue::Buffer &MessageQueue::_get_buffer() {
+	ThreadBufferOwner &owner = thread_buffer_owner;
+	if (unlikely(owner.generation != generation)) {
+		owner.generation = generation;
+		owner.is_main_thread = false;
+		owner.buffer = memnew(ThreadBuffer);
+
+		MutexLock lock(thread_buffers_mutex);
+		thread_buffers.push_back(owner.buffer);
+	}
+	return owner.is_main_thread ? main_buffer : owner.buffer->buffer;
 }
 
-Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
-	_THREAD_SAFE_METHOD_
+uint8_t *MessageQueue::_allocate(Buffer &p_buffer, uint32_t p_size) {
+	// Must be called with the buffer locked.
+	Page *page = p_buffer.pages.is_empty() ? nullptr : &p_buffer.pages[p_buffer.pages.size() - 1];
+	if (!page || page->end + p_size > page->size) {
+		Page new_page;
+		new_page.size = MAX(uint32_t(PAGE_SIZE_KB * 1024), p_size);
+		new_page.data = memnew_arr(uint8_t, new_page.size);
+		p_buffer.pages.push_back(new_page);
+		page = &p_buffer.pages[p_buffer.pages.size() - 1];
+	}
 
-	uint8_t room_needed = sizeof(Message) + sizeof(Variant);
+	uint8_t *ptr = &page->data[page->end];
+	page->end += p_size;
+	return ptr;
+}
+
+void MessageQueue::_free_pages(Buffer &p_buffer, bool p_keep_first) {
+	// Must be called with the buffer locked, and its messages already destroyed.
+	uint32_t first = p_keep_first ? 1 : 0;
+	for (uint32_t i = first; i < p_buffer.pages.size(); i++) {
+		memdelete_arr(p_buffer.pages[i].data);
+	}
+	p_buffer.pages.resize(MIN(first, p_buffer.pages.size()));
+	if (p_buffer.pages.size()) {
+		p_buffer.pages[0].end = 0;
+	}
+}
 
-	if ((buffer_end + room_needed) >= buffer_size) {
-		String type;
-		if (ObjectDB::get_instance(p_id)) {
-			type = ObjectDB::get_instance(p_id)->get_class();
+uint32_t MessageQueue::_get_message_size(const Message *p_message) {
+	uint32_t size = sizeof(Message);
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		size += sizeof(Variant) * p_message->args;
+	}
+	return size;
+}
+
+void MessageQueue::_destroy_message(Message *p_message) {
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		Variant *args = (Variant *)(p_message + 1);
+		for (int i = 0; i < p_message->args; i++) {
+			args[i].~Variant();
 		}
-		print_line("Failed set: " + type + ":" + p_prop + " target ID: " + itos(p_id));
-		statistics();
-		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
+	p_message->~Message();
+}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+Error MessageQueue::push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
+	return push_callablep(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
+}
+
+Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
+	Buffer &buffer = _get_buffer();
+	MutexLock lock(buffer.mutex);
+
+	uint8_t *ptr = _allocate(buffer, sizeof(Message) + sizeof(Variant));
+
+	Message *msg = memnew_placement(ptr, Message);
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
 	msg->type = TYPE_SET;
 
-	buffer_end += sizeof(Message);
-
-	Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-	buffer_end += sizeof(Variant);
+	Variant *v = memnew_placement(ptr + sizeof(Message), Variant);
 	*v = p_value;
 
 	return OK;
 }
 
 Error MessageQueue::push_notification(ObjectID p_id, int p_notification) {
-	_THREAD_SAFE_METHOD_
-
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
 
-	uint8_t room_needed = sizeof(Message);
-
-	if ((buffer_end + room_needed) >= buffer_size) {
-		print_line("Failed notification: " + itos(p_notification) + " target ID: " + itos(p_id));
-		statistics();
-		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
-	}
+	Buffer &buffer = _get_buffer();
+	MutexLock lock(buffer.mutex);
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	Message *msg = memnew_placement(_allocate(buffer, sizeof(Message)), Message);
 
 	msg->type = TYPE_NOTIFICATION;
 	msg->callable = Callable(p_id, CoreStringNames::get_singleton()->notification); //name is meaningless but callable needs it
 	//msg->target;
 	msg->notification = p_notification;
 
-	buffer_end += sizeof(Message);
-
 	return OK;
 }
 
@@ -112,17 +165,12 @@ Error MessageQueue::push_set(Object *p_object, const StringName &p_prop, const V
 }
 
 Error MessageQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
-	_THREAD_SAFE_METHOD_
+	Buffer &buffer = _get_buffer();
+	MutexLock lock(buffer.mutex);
 
-	int room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
+	uint8_t *ptr = _allocate(buffer, sizeof(Message) + sizeof(Variant) * p_argcount);
 
-	if ((buffer_end + room_needed) >= buffer_size) {
-		print_line("Failed method: " + p_callable);
-		statistics();
-		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
-	}
-
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	Message *msg = memnew_placement(ptr, Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
 	msg->type = TYPE_CALL;
@@ -130,11 +178,9 @@ Error MessageQueue::push_callablep(const Callable &p_callable, const Variant **p
 		msg->type |= FLAG_SHOW_ERROR;
 	}
 
-	buffer_end += sizeof(Message);
-
+	Variant *args = (Variant *)(msg + 1);
 	for (int i = 0; i < p_argcount; i++) {
-		Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-		buffer_end += sizeof(Variant);
+		Variant *v = memnew_placement(&args[i], Variant);
 		*v = *p_args[i];
 	}
 
@@ -146,56 +192,61 @@ void MessageQueue::statistics() {
 	HashMap<int, int> notify_count;
 	HashMap<Callable, int> call_count;
 	int null_count = 0;
+	uint32_t total_bytes = 0;
 
-	uint32_t read_pos = 0;
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
+	MutexLock lock(main_buffer.mutex);
 
-		Object *target = message->callable.get_object();
+	for (uint32_t i = 0; i < main_buffer.pages.size(); i++) {
+		const Page &page = main_buffer.pages[i];
+		total_bytes += page.end;
 
-		if (target != nullptr) {
-			switch (message->type & FLAG_MASK) {
-				case TYPE_CALL: {
-					if (!call_count.has(message->callable)) {
-						call_count[message->callable] = 0;
-					}
+		uint32_t read_pos = 0;
+		while (read_pos < page.end) {
+			Message *message = (Message *)&page.data[read_pos];
 
-					call_count[message->callable]++;
+			Object *target = message->callable.get_object();
 
-				} break;
-				case TYPE_NOTIFICATION: {
-					if (!notify_count.has(message->notification)) {
-						notify_count[message->notification] = 0;
-					}
+			if (target != nullptr) {
+				switch (message->type & FLAG_MASK) {
+					case TYPE_CALL: {
+						if (!call_count.has(message->callable)) {
+							call_count[message->callable] = 0;
+						}
 
-					notify_count[message->notification]++;
+						call_count[message->callable]++;
 
-				} break;
-				case TYPE_SET: {
-					StringName t = message->callable.get_method();
-					if (!set_count.has(t)) {
-						set_count[t] = 0;
-					}
+					} break;
+					case TYPE_NOTIFICATION: {
+						if (!notify_count.has(message->notification)) {
+							notify_count[message->notification] = 0;
+						}
 
-					set_count[t]++;
+						notify_count[message->notification]++;
 
-				} break;
-			}
+					} break;
+					case TYPE_SET: {
+						StringName t = message->callable.get_method();
+						if (!set_count.has(t)) {
+							set_count[t] = 0;
+						}
 
-		} else {
-			//object was deleted
-			print_line("Object was deleted while awaiting a callback");
+						set_count[t]++;
 
-			null_count++;
-		}
+					} break;
+				}
 
-		read_pos += sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			read_pos += sizeof(Variant) * message->args;
+			} else {
+				//object was deleted
+				print_line("Object was deleted while awaiting a callback");
+
+				null_count++;
+			}
+
+			read_pos += _get_message_size(message);
 		}
 	}
 
-	print_line("TOTAL BYTES: " + itos(buffer_end));
+	print_line("TOTAL BYTES: " + itos(total_bytes));
 	print_line("NULL count: " + itos(null_count));
 
 	for (const KeyValue<StringName, int> &E : set_count) {
@@ -232,78 +283,162 @@ void MessageQueue::_call_function(const Callable &p_callable, const Variant *p_a
 	}
 }
 
-void MessageQueue::flush() {
-	if (buffer_end > buffer_max_used) {
-		buffer_max_used = buffer_end;
-	}
+void MessageQueue::_execute_message(Message *p_message) {
+	Object *target = p_message->callable.get_object();
 
-	uint32_t read_pos = 0;
+	if (target != nullptr) {
+		switch (p_message->type & FLAG_MASK) {
+			case TYPE_CALL: {
+				Variant *args = (Variant *)(p_message + 1);
 
-	//using reverse locking strategy
-	_THREAD_SAFE_LOCK_
+				// messages don't expect a return value
 
-	if (flushing) {
-		_THREAD_SAFE_UNLOCK_
-		ERR_FAIL_COND(flushing); //already flushing, you did something odd
+				_call_function(p_message->callable, args, p_message->args, p_message->type & FLAG_SHOW_ERROR);
+
+			} break;
+			case TYPE_NOTIFICATION: {
+				// messages don't expect a return value
+				target->notification(p_message->notification);
+
+			} break;
+			case TYPE_SET: {
+				Variant *arg = (Variant *)(p_message + 1);
+				// messages don't expect a return value
+				target->set(p_message->callable.get_method(), *arg);
+
+			} break;
+		}
 	}
-	flushing = true;
 
-	while (read_pos < buffer_end) {
-		//lock on each iteration, so a call can re-add itself to the message queue
+	_destroy_message(p_message);
+}
+
+void MessageQueue::_flush_main_buffer() {
+	uint32_t page_idx = 0;
+	uint32_t read_pos = 0;
 
-		Message *message = (Message *)&buffer[read_pos];
+	//using reverse locking strategy
+	main_buffer.mutex.lock();
 
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
+	while (page_idx < main_buffer.pages.size()) {
+		//lock on each iteration, so a call can re-add itself to the message queue
+		// Only the last page grows, so the previous ones are done once their end is reached.
+		const Page &page = main_buffer.pages[page_idx];
+		if (read_pos >= page.end) {
+			page_idx++;
+			read_pos = 0;
+			continue;
 		}
 
+		Message *message = (Message *)&page.data[read_pos];
+
 		//pre-advance so this function is reentrant
-		read_pos += advance;
+		read_pos += _get_message_size(message);
 
-		_THREAD_SAFE_UNLOCK_
+		main_buffer.mutex.unlock();
 
-		Object *target = message->callable.get_object();
+		_execute_message(message);
 
-		if (target != nullptr) {
-			switch (message->type & FLAG_MASK) {
-				case TYPE_CALL: {
-					Variant *args = (Variant *)(message + 1);
+		main_buffer.mutex.lock();
+	}
 
-					// messages don't expect a return value
+	uint32_t used = 0;
+	for (uint32_t i = 0; i < main_buffer.pages.size(); i++) {
+		used += main_buffer.pages[i].end;
+	}
+	if (used > buffer_max_used) {
+		buffer_max_used = used;
+	}
 
-					_call_function(message->callable, args, message->args, message->type & FLAG_SHOW_ERROR);
+	// Keep the preallocated page, release the ones added by bursts.
+	_free_pages(main_buffer, true);
 
-				} break;
-				case TYPE_NOTIFICATION: {
-					// messages don't expect a return value
-					target->notification(message->notification);
+	main_buffer.mutex.unlock();
+}
+
+void MessageQueue::_flush_thread_buffers() {
+	LocalVector<ThreadBuffer *> buffers;
+	{
+		MutexLock lock(thread_buffers_mutex);
+		buffers = thread_buffers;
+	}
 
-				} break;
-				case TYPE_SET: {
-					Variant *arg = (Variant *)(message + 1);
-					// messages don't expect a return value
-					target->set(message->callable.get_method(), *arg);
+	for (uint32_t i = 0; i < buffers.size(); i++) {
+		ThreadBuffer *tb = buffers[i];
+
+		// Take the pages so the thread can keep pushing while these are processed.
+		LocalVector<Page> pages;
+		{
+			MutexLock lock(tb->buffer.mutex);
+			pages = tb->buffer.pages;
+			tb->buffer.pages.clear();
+		}
 
-				} break;
+		for (uint32_t j = 0; j < pages.size(); j++) {
+			uint32_t read_pos = 0;
+			while (read_pos < pages[j].end) {
+				Message *message = (Message *)&pages[j].data[read_pos];
+				read_pos += _get_message_size(message);
+				_execute_message(message);
 			}
 		}
 
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int i = 0; i < message->args; i++) {
-				args[i].~Variant();
+		uint32_t first_freed = 0;
+		if (pages.size()) {
+			// Hand a page back, so the thread doesn't allocate again on its next push.
+			MutexLock lock(tb->buffer.mutex);
+			if (tb->buffer.pages.is_empty()) {
+				pages[0].end = 0;
+				tb->buffer.pages.push_back(pages[0]);
+				first_freed = 1;
 			}
 		}
+		for (uint32_t j = first_freed; j < pages.size(); j++) {
+			memdelete_arr(pages[j].data);
+		}
+	}
 
-		message->~Message();
+	MutexLock lock(thread_buffers_mutex);
+	for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+		ThreadBuffer *tb = thread_buffers[i];
+		if (!tb->orphaned) {
+			continue;
+		}
 
-		_THREAD_SAFE_LOCK_
+		// The thread is gone, so nothing else can lock its buffer anymore.
+		bool empty = true;
+		for (uint32_t j = 0; j < tb->buffer.pages.size(); j++) {
+			if (tb->buffer.pages[j].end) {
+				empty = false;
+				break;
+			}
+		}
+		if (!empty) {
+			continue;
+		}
+
+		_free_pages(tb->buffer, false);
+		memdelete(tb);
+		thread_buffers.remove_at_unordered(i);
+		i--;
 	}
+}
 
-	buffer_end = 0; // reset buffer
+void MessageQueue::flush() {
+	{
+		MutexLock lock(main_buffer.mutex);
+		ERR_FAIL_COND(flushing); //already flushing, you did something odd
+		flushing = true;
+	}
+
+	// Messages keep the order they were pushed in by each thread. Messages from other threads
+	// are processed after the main thread's, and whatever they push in turn is flushed last.
+	_flush_main_buffer();
+	_flush_thread_buffers();
+	_flush_main_buffer();
+
+	MutexLock lock(main_buffer.mutex);
 	flushing = false;
-	_THREAD_SAFE_UNLOCK_
 }
 
 bool MessageQueue::is_flushing() const {
@@ -314,32 +449,50 @@ MessageQueue::MessageQueue() {
 	ERR_FAIL_COND_MSG(singleton != nullptr, "A MessageQueue singleton already exists.");
 	singleton = this;
 
-	buffer_size = GLOBAL_DEF_RST("memory/limits/message_queue/max_size_kb", DEFAULT_QUEUE_SIZE_KB);
+	// The thread creating the queue is the one flushing it, it pushes straight to the main buffer.
+	generation = ++last_generation;
+	thread_buffer_owner.generation = generation;
+	thread_buffer_owner.is_main_thread = true;
+	thread_buffer_owner.buffer = nullptr;
+
+	uint32_t initial_size = GLOBAL_DEF_RST("memory/limits/message_queue/max_size_kb", DEFAULT_QUEUE_SIZE_KB);
 	ProjectSettings::get_singleton()->set_custom_property_info("memory/limits/message_queue/max_size_kb", PropertyInfo(Variant::INT, "memory/limits/message_queue/max_size_kb", PROPERTY_HINT_RANGE, "1024,4096,1,or_greater"));
-	buffer_size *= 1024;
-	buffer = memnew_arr(uint8_t, buffer_size);
+
+	// Preallocate the main thread's first page, the queue grows past it when needed.
+	Page page;
+	page.size = initial_size * 1024;
+	page.data = memnew_arr(uint8_t, page.size);
+	main_buffer.pages.push_back(page);
 }
 
 MessageQueue::~MessageQueue() {
-	uint32_t read_pos = 0;
-
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
-		Variant *args = (Variant *)(message + 1);
-		int argc = message->args;
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			for (int i = 0; i < argc; i++) {
-				args[i].~Variant();
-			}
+	for (uint32_t i = 0; i < main_buffer.pages.size(); i++) {
+		const Page &page = main_buffer.pages[i];
+		uint32_t read_pos = 0;
+		while (read_pos < page.end) {
+			Message *message = (Message *)&page.data[read_pos];
+			read_pos += _get_message_size(message);
+			_destroy_message(message);
 		}
-		message->~Message();
-
-		read_pos += sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			read_pos += sizeof(Variant) * message->args;
+	}
+	_free_pages(main_buffer, false);
+
+	MutexLock lock(thread_buffers_mutex);
+	for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+		ThreadBuffer *tb = thread_buffers[i];
+		for (uint32_t j = 0; j < tb->buffer.pages.size(); j++) {
+			const Page &page = tb->buffer.pages[j];
+			uint32_t read_pos = 0;
+			while (read_pos < page.end) {
+				Message *message = (Message *)&page.data[read_pos];
+				read_pos += _get_message_size(message);
+				_destroy_message(message);
+			}
 		}
+		_free_pages(tb->buffer, false);
+		memdelete(tb);
 	}
+	thread_buffers.clear();
 
 	singleton = nullptr;
-	memdelete_arr(buffer);
 }
@@ -32,16 +32,16 @@
 #define MESSAGE_QUEUE_H
 
 #include "core/object/object_id.h"
-#include "core/os/thread_safe.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/variant.h"
 
 class Object;
 
 class MessageQueue {
-	_THREAD_SAFE_CLASS_
-
 	enum {
-		DEFAULT_QUEUE_SIZE_KB = 4096
+		DEFAULT_QUEUE_SIZE_KB = 4096,
+		PAGE_SIZE_KB = 64,
 	};
 
 	enum {
@@ -62,10 +62,51 @@ class MessageQueue {
 		};
 	};
 
-	uint8_t *buffer = nullptr;
-	uint32_t buffer_end = 0;
+	struct Page {
+		uint8_t *data = nullptr;
+		uint32_t size = 0;
+		uint32_t end = 0;
+	};
+
+	// Messages are appended to pages that never move, so a buffer can grow while it is being flushed.
+	struct Buffer {
+		Mutex mutex;
+		LocalVector<Page> pages;
+	};
+
+	// Threads other than the main one push to their own buffer, so producers don't contend with each other.
+	struct ThreadBuffer {
+		Buffer buffer;
+		bool orphaned = false;
+	};
+
+	// Identifies queues by generation rather than address, a new queue may be allocated where an old one was.
+	struct ThreadBufferOwner {
+		uint32_t generation = 0;
+		bool is_main_thread = false;
+		ThreadBuffer *buffer = nullptr;
+
+		~ThreadBufferOwner();
+	};
+
+	static thread_local ThreadBufferOwner thread_buffer_owner;
+	static Mutex thread_buffers_mutex;
+	static uint32_t last_generation;
+
+	uint32_t generation = 0;
+
+	Buffer main_buffer;
+	LocalVector<ThreadBuffer *> thread_buffers;
 	uint32_t buffer_max_used = 0;
-	uint32_t buffer_size = 0;
+
+	Buffer &_get_buffer();
+	uint8_t *_allocate(Buffer &p_buffer, uint32_t p_size);
+	void _free_pages(Buffer &p_buffer, bool p_keep_first);
+	static uint32_t _get_message_size(const Message *p_message);
+	static void _destroy_message(Message *p_message);
+	void _execute_message(Message *p_message);
+	void _flush_main_buffer();
+	void _flush_thread_buffers();
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
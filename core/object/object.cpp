@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/message_queue.h"
 #include "core/object/script_language.h"
+#include "core/os/mutex.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 #include "core/string/translation.h"
@@ -62,6 +63,25 @@ struct _ObjectDebugLock {
 
 #endif
 
+static Mutex extension_virtual_cache_mutex;
+
+GDNativeExtensionClassCallVirtual ObjectNativeExtension::resolve_virtual(const StringName &p_name) const {
+	if (!get_virtual) {
+		return nullptr;
+	}
+
+	// Every instance resolves its virtuals once; only the first instance of the class asks the extension.
+	MutexLock lock(extension_virtual_cache_mutex);
+	HashMap<StringName, GDNativeExtensionClassCallVirtual>::ConstIterator E = virtual_cache.find(p_name);
+	if (E) {
+		return E->value;
+	}
+	// TODO: C-style cast because GDNativeStringNamePtr's const qualifier is broken (see https://github.com/godotengine/godot/pull/67751)
+	GDNativeExtensionClassCallVirtual func = get_virtual(class_userdata, (GDNativeStringNamePtr)&p_name);
+	virtual_cache.insert(p_name, func);
+	return func;
+}
+
 PropertyInfo::operator Dictionary() const {
 	Dictionary d;
 	d["name"] = name;
@@ -1014,19 +1034,28 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	List<_ObjectSignalDisconnectData> disconnect_data;
 
+	if (s->emit_snapshot.size() != s->slot_map.size()) {
+		s->emit_snapshot.resize(s->slot_map.size());
+		Connection *w = s->emit_snapshot.ptrw();
+		const VMap<Callable, SignalData::Slot>::Pair *slot_list = s->slot_map.get_array();
+		for (int i = 0; i < s->slot_map.size(); i++) {
+			w[i] = slot_list[i].value.conn;
+		}
+	}
+
 	//copy on write will ensure that disconnecting the signal or even deleting the object will not affect the signal calling.
-	//this happens automatically and will not change the performance of calling.
-	//awesome, isn't it?
-	VMap<Callable, SignalData::Slot> slot_map = s->slot_map;
+	//this only takes a reference to the snapshot, so it will not change the performance of calling.
+	const Vector<Connection> snapshot = s->emit_snapshot;
+	const Connection *connection_list = snapshot.ptr();
 
-	int ssize = slot_map.size();
+	int ssize = snapshot.size();
 
 	OBJ_DEBUG_LOCK
 
 	Error err = OK;
 
 	for (int i = 0; i < ssize; i++) {
-		const Connection &c = slot_map.getv(i).conn;
+		const Connection &c = connection_list[i];
 
 		Object *target = c.callable.get_object();
 		if (!target) {
@@ -1285,6 +1314,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*target.get_base_comparator()] = slot;
+	s->emit_snapshot.clear();
 
 	return OK;
 }
@@ -1341,6 +1371,7 @@ void Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 
 	target_object->connections.erase(slot->cE);
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->emit_snapshot.clear();
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -1850,8 +1881,9 @@ void ObjectDB::debug_objects(DebugFunc p_func) {
 	spin_lock.lock();
 
 	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
+		ObjectSlot &object_slot = _get_slot(i);
+		if (object_slot.id.load(std::memory_order_relaxed)) {
+			p_func(object_slot.object.load(std::memory_order_relaxed));
 			count--;
 		}
 	}
@@ -1904,7 +1936,8 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 SpinLock ObjectDB::spin_lock;
 uint32_t ObjectDB::slot_count = 0;
 uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::object_slot_chunks[OBJECTDB_SLOT_MAX_CHUNKS];
+uint32_t *ObjectDB::free_slots = nullptr;
 uint64_t ObjectDB::validator_counter = 0;
 
 int ObjectDB::get_object_count() {
@@ -1916,29 +1949,27 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 	if (unlikely(slot_count == slot_max)) {
 		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
+		// Grow by a whole chunk. Existing chunks stay where they are, so lookups
+		// running concurrently on other threads are not affected.
+		uint32_t new_slot_max = slot_max + OBJECTDB_SLOT_CHUNK_SIZE;
+		free_slots = (uint32_t *)memrealloc(free_slots, sizeof(uint32_t) * new_slot_max);
 		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+			free_slots[i] = i;
 		}
+		object_slot_chunks[slot_max >> OBJECTDB_SLOT_CHUNK_BITS].store(memnew_arr(ObjectSlot, OBJECTDB_SLOT_CHUNK_SIZE), std::memory_order_release);
 		slot_max = new_slot_max;
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
+	uint32_t slot = free_slots[slot_count];
+	ObjectSlot &object_slot = _get_slot(slot);
+	if (object_slot.object.load(std::memory_order_relaxed) != nullptr) {
 		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+		ERR_FAIL_COND_V(object_slot.object.load(std::memory_order_relaxed) != nullptr, ObjectID());
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
 	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
 	if (unlikely(validator_counter == 0)) {
 		validator_counter = 1;
 	}
-	object_slots[slot].validator = validator_counter;
 
 	uint64_t id = validator_counter;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
@@ -1948,6 +1979,10 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
+	// The object must be visible before the ID that makes lookups accept it.
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.id.store(id, std::memory_order_release);
+
 	slot_count++;
 
 	spin_lock.unlock();
@@ -1961,29 +1996,27 @@ void ObjectDB::remove_instance(Object *p_object) {
 
 	spin_lock.lock();
 
+	ObjectSlot &object_slot = _get_slot(slot);
+
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
+	if (object_slot.object.load(std::memory_order_relaxed) != p_object) {
 		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
+		ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	}
-	{
-		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
-		}
+	if (object_slot.id.load(std::memory_order_relaxed) != t) {
+		spin_lock.unlock();
+		ERR_FAIL_COND(object_slot.id.load(std::memory_order_relaxed) != t);
 	}
 
 #endif
 	//decrease slot count
 	slot_count--;
 	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
-	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	free_slots[slot_count] = slot;
+	//invalidate the ID first, so lookups fail before the object goes away
+	object_slot.id.store(0, std::memory_order_release);
+	object_slot.object.store(nullptr, std::memory_order_release);
 
 	spin_lock.unlock();
 }
@@ -2006,8 +2039,10 @@ void ObjectDB::cleanup() {
 			Callable::CallError call_error;
 
 			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+				ObjectSlot &object_slot = _get_slot(i);
+				uint64_t id = object_slot.id.load(std::memory_order_relaxed);
+				if (id) {
+					Object *obj = object_slot.object.load(std::memory_order_relaxed);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2017,7 +2052,6 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_VALIDATOR_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + itos(id) + extra_info);
 
 					count--;
@@ -2028,7 +2062,11 @@ void ObjectDB::cleanup() {
 		spin_lock.unlock();
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < slot_max >> OBJECTDB_SLOT_CHUNK_BITS; i++) {
+		memdelete_arr(object_slot_chunks[i].load(std::memory_order_relaxed));
+		object_slot_chunks[i].store(nullptr, std::memory_order_relaxed);
+	}
+	if (free_slots) {
+		memfree(free_slots);
 	}
 }
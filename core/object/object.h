@@ -339,6 +339,10 @@ struct ObjectNativeExtension {
 	GDNativeExtensionClassCreateInstance create_instance;
 	GDNativeExtensionClassFreeInstance free_instance;
 	GDNativeExtensionClassGetVirtual get_virtual;
+
+	// Virtuals resolved through `get_virtual`, shared by all instances of the class.
+	mutable HashMap<StringName, GDNativeExtensionClassCallVirtual> virtual_cache;
+	GDNativeExtensionClassCallVirtual resolve_virtual(const StringName &p_name) const;
 };
 
 #define GDVIRTUAL_CALL(m_name, ...) _gdvirtual_##m_name##_call<false>(__VA_ARGS__)
@@ -591,6 +595,10 @@ private:
 
 		MethodInfo user;
 		VMap<Callable, Slot> slot_map;
+		// Connections in slot order, rebuilt on the next emission after
+		// connecting or disconnecting. Emitting only takes a reference to it,
+		// so callbacks that change the connections don't affect the emission.
+		Vector<Connection> emit_snapshot;
 	};
 
 	HashMap<StringName, SignalData> signal_map;
@@ -941,17 +949,23 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
+#define OBJECTDB_SLOT_CHUNK_BITS 12
+#define OBJECTDB_SLOT_CHUNK_SIZE (1 << OBJECTDB_SLOT_CHUNK_BITS)
+#define OBJECTDB_SLOT_CHUNK_MASK (OBJECTDB_SLOT_CHUNK_SIZE - 1)
+#define OBJECTDB_SLOT_MAX_CHUNKS (1 << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_CHUNK_BITS))
+
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		std::atomic<uint64_t> id{ 0 }; // Full ObjectID of the instance, zero when free.
+		std::atomic<Object *> object{ nullptr };
 	};
 
+	// Slots live in fixed-size chunks that are never moved or freed until cleanup,
+	// so lookups can read them without taking the lock.
 	static SpinLock spin_lock;
 	static uint32_t slot_count;
 	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
+	static std::atomic<ObjectSlot *> object_slot_chunks[OBJECTDB_SLOT_MAX_CHUNKS];
+	static uint32_t *free_slots;
 	static uint64_t validator_counter;
 
 	friend class Object;
@@ -964,6 +978,10 @@ class ObjectDB {
 	friend void register_core_types();
 	static void setup();
 
+	_FORCE_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return object_slot_chunks[p_slot >> OBJECTDB_SLOT_CHUNK_BITS].load(std::memory_order_relaxed)[p_slot & OBJECTDB_SLOT_CHUNK_MASK];
+	}
+
 public:
 	typedef void (*DebugFunc)(Object *p_obj);
 
@@ -971,20 +989,23 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		ObjectSlot *chunk = object_slot_chunks[slot >> OBJECTDB_SLOT_CHUNK_BITS].load(std::memory_order_acquire);
+		ERR_FAIL_COND_V(!chunk, nullptr); // This should never happen unless RID is corrupted.
 
-		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
+		if (unlikely(((id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK) == 0)) {
+			return nullptr; // Validators are never zero, this keeps null IDs away from free slots.
+		}
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		// Slots are filled by storing the object before the ID and emptied by clearing the ID
+		// before the object, so the object belongs to this ID if the ID matches around the read.
+		ObjectSlot &object_slot = chunk[slot & OBJECTDB_SLOT_CHUNK_MASK];
+		if (unlikely(object_slot.id.load(std::memory_order_acquire) != id)) {
+			return nullptr;
+		}
+		Object *object = object_slot.object.load(std::memory_order_acquire);
+		if (unlikely(object_slot.id.load(std::memory_order_relaxed) != id)) {
 			return nullptr;
 		}
-
-		Object *object = object_slots[slot].object;
-
-		spin_lock.unlock();
 
 		return object;
 	}
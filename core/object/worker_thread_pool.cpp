@@ -30,6 +30,7 @@
 
 #include "worker_thread_pool.h"
 
+#include "core/debugger/trace_profiler.h"
 #include "core/os/os.h"
 
 void WorkerThreadPool::Task::free_template_userdata() {
@@ -41,15 +42,130 @@ void WorkerThreadPool::Task::free_template_userdata() {
 
 WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 
-void WorkerThreadPool::_process_task_queue() {
+WorkerThreadPool::Task *WorkerThreadPool::_pop_task(int p_thread_index) {
+	Task *task = nullptr;
+
+	// Own queue first, newest task is the most likely to be cache-hot.
+	if (p_thread_index >= 0) {
+		ThreadData &td = threads[p_thread_index];
+		td.queue_mutex.lock();
+		if (td.task_queue.first()) {
+			task = td.task_queue.first()->self();
+			td.task_queue.remove(td.task_queue.first());
+		}
+		td.queue_mutex.unlock();
+		if (task) {
+			return task;
+		}
+	}
+
+	// Then the shared queue, used by tasks posted from outside the pool.
 	task_mutex.lock();
-	Task *task = task_queue.first()->self();
-	task_queue.remove(task_queue.first());
+	if (task_queue.first()) {
+		task = task_queue.first()->self();
+		task_queue.remove(task_queue.first());
+	}
 	task_mutex.unlock();
+	if (task) {
+		return task;
+	}
+
+	// Finally steal the oldest task from another worker.
+	uint32_t start = p_thread_index >= 0 ? uint32_t(p_thread_index) + 1 : 0;
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		uint32_t victim = (start + i) % threads.size();
+		if (int(victim) == p_thread_index) {
+			continue;
+		}
+		ThreadData &td = threads[victim];
+		td.queue_mutex.lock();
+		if (td.task_queue.last()) {
+			task = td.task_queue.last()->self();
+			td.task_queue.remove(td.task_queue.last());
+		}
+		td.queue_mutex.unlock();
+		if (task) {
+			return task;
+		}
+	}
+
+	return nullptr;
+}
+
+void WorkerThreadPool::_process_task_queue() {
+	const int *thread_index = thread_ids.getptr(Thread::get_caller_id());
+	Task *task = nullptr;
+	while (!task) {
+		// The semaphore guarantees a task is queued somewhere for us, but it may sit in a queue that
+		// was already scanned by the time it was pushed, so retry until it's found.
+		task = _pop_task(thread_index ? *thread_index : -1);
+	}
 	_process_task(task);
 }
 
+void WorkerThreadPool::_add_dependent(int64_t p_dependency, Task *p_task) {
+	// Must be called with task_mutex locked.
+	Task **taskp = tasks.getptr(p_dependency);
+	if (taskp) {
+		if (!(*taskp)->completed) {
+			(*taskp)->dependents.push_back(p_task);
+			p_task->pending_dependencies++;
+		}
+		return;
+	}
+	Group **groupp = groups.getptr(p_dependency);
+	if (groupp) {
+		if (!(*groupp)->completed.is_set()) {
+			(*groupp)->dependents.push_back(p_task);
+			p_task->pending_dependencies++;
+		}
+		return;
+	}
+	// IDs that were handed out but are no longer tracked belong to tasks that were already waited for.
+	ERR_FAIL_COND_MSG(p_dependency <= 0 || p_dependency >= int64_t(last_task), "Invalid Task or Group ID used as dependency: " + itos(p_dependency));
+}
+
+void WorkerThreadPool::_collect_ready_dependents(TightLocalVector<Task *> &p_dependents, TightLocalVector<Task *> &r_ready) {
+	// Must be called with task_mutex locked.
+	for (uint32_t i = 0; i < p_dependents.size(); i++) {
+		Task *dependent = p_dependents[i];
+		dependent->pending_dependencies--;
+		if (dependent->pending_dependencies == 0) {
+			r_ready.push_back(dependent);
+		}
+	}
+	p_dependents.clear();
+}
+
+void WorkerThreadPool::_post_ready_dependents(TightLocalVector<Task *> &p_ready) {
+	for (uint32_t i = 0; i < p_ready.size(); i++) {
+		_post_task(p_ready[i], !p_ready[i]->low_priority);
+	}
+}
+
+void WorkerThreadPool::_mark_task_completed(Task *p_task) {
+	TightLocalVector<Task *> ready;
+	task_mutex.lock();
+	p_task->completed = true;
+	_collect_ready_dependents(p_task->dependents, ready);
+	task_mutex.unlock();
+
+	_post_ready_dependents(ready);
+	p_task->done_semaphore.post(); // Task may be freed by the waiter from here on.
+}
+
+void WorkerThreadPool::_mark_group_completed(Group *p_group) {
+	TightLocalVector<Task *> ready;
+	task_mutex.lock();
+	p_group->completed.set_to(true);
+	_collect_ready_dependents(p_group->dependents, ready);
+	task_mutex.unlock();
+
+	_post_ready_dependents(ready);
+}
+
 void WorkerThreadPool::_process_task(Task *p_task) {
+	TRACE_ZONE("WorkerThreadPool::task");
 	bool low_priority = p_task->low_priority;
 
 	if (p_task->group) {
@@ -88,15 +204,15 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		}
 
 		if (low_priority && use_native_low_priority_threads) {
-			p_task->completed = true;
-			p_task->done_semaphore.post();
 			if (do_post) {
-				p_task->group->completed.set_to(true);
+				_mark_group_completed(p_task->group);
 			}
+			p_task->completed = true;
+			p_task->done_semaphore.post();
 		} else {
 			if (do_post) {
+				_mark_group_completed(p_task->group);
 				p_task->group->done_semaphore.post();
-				p_task->group->completed.set_to(true);
 			}
 			uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 			uint32_t finished_users = p_task->group->finished.increment();
@@ -126,8 +242,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->callable.callp(nullptr, 0, ret, ce);
 		}
 
-		p_task->completed = true;
-		p_task->done_semaphore.post();
+		_mark_task_completed(p_task);
 	}
 
 	if (!use_native_low_priority_threads && low_priority) {
@@ -142,7 +257,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		} else {
 			low_priority_threads_used.decrement();
 		}
-		task_mutex.lock();
+		task_mutex.unlock();
 		if (post) {
 			task_available_semaphore.post();
 		}
@@ -165,6 +280,21 @@ void WorkerThreadPool::_native_low_priority_thread_function(void *p_user) {
 }
 
 void WorkerThreadPool::_post_task(Task *p_task, bool p_high_priority) {
+	if (p_high_priority) {
+		const int *thread_index = thread_ids.getptr(Thread::get_caller_id());
+		if (thread_index) {
+			// Posted from a worker, keep it in its own queue so the shared lock is not touched.
+			// Idle workers will steal it if the owner is busy.
+			ThreadData &td = threads[*thread_index];
+			p_task->low_priority = false;
+			td.queue_mutex.lock();
+			td.task_queue.add(&p_task->task_elem);
+			td.queue_mutex.unlock();
+			task_available_semaphore.post();
+			return;
+		}
+	}
+
 	task_mutex.lock();
 	p_task->low_priority = !p_high_priority;
 	if (!p_high_priority && use_native_low_priority_threads) {
@@ -186,11 +316,11 @@ void WorkerThreadPool::_post_task(Task *p_task, bool p_high_priority) {
 	}
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
-	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, p_dependencies);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
 	task_mutex.lock();
 	// Get a free task
 	Task *task = task_allocator.alloc();
@@ -200,16 +330,28 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 	task->native_func_userdata = p_userdata;
 	task->description = p_description;
 	task->template_userdata = p_template_userdata;
+	task->low_priority = !p_high_priority;
 	tasks.insert(id, task);
+
+	bool ready = true;
+	if (p_dependencies.size()) {
+		// Dependencies can't complete while the mutex is held, so this is registered atomically.
+		for (int i = 0; i < p_dependencies.size(); i++) {
+			_add_dependent(p_dependencies[i], task);
+		}
+		ready = task->pending_dependencies == 0;
+	}
 	task_mutex.unlock();
 
-	_post_task(task, p_high_priority);
+	if (ready) {
+		_post_task(task, p_high_priority);
+	} // Otherwise, the last dependency to complete will post it.
 
 	return id;
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bool p_high_priority, const String &p_description) {
-	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description);
+WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, p_dependencies);
 }
 
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
@@ -344,6 +486,12 @@ WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_act
 	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
 }
 
+int WorkerThreadPool::get_thread_index() const {
+	// Returns -1 when called from a thread that is not part of the pool.
+	const int *index = thread_ids.getptr(Thread::get_caller_id());
+	return index ? *index : -1;
+}
+
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
 	task_mutex.lock();
 	const Group *const *groupp = groups.getptr(p_group);
@@ -457,7 +605,7 @@ void WorkerThreadPool::finish() {
 }
 
 void WorkerThreadPool::_bind_methods() {
-	ClassDB::bind_method(D_METHOD("add_task", "action", "high_priority", "description"), &WorkerThreadPool::add_task, DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_task", "action", "high_priority", "description", "dependencies"), &WorkerThreadPool::add_task, DEFVAL(false), DEFVAL(String()), DEFVAL(Vector<TaskID>()));
 	ClassDB::bind_method(D_METHOD("is_task_completed", "task_id"), &WorkerThreadPool::is_task_completed);
 	ClassDB::bind_method(D_METHOD("wait_for_task_completion", "task_id"), &WorkerThreadPool::wait_for_task_completion);
 
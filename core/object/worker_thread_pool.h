@@ -69,6 +69,7 @@ private:
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
 		TightLocalVector<Task *> low_priority_native_tasks;
+		TightLocalVector<Task *> dependents; // Tasks waiting for this group to complete.
 	};
 
 	struct Task {
@@ -85,6 +86,8 @@ private:
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
 		Thread *low_priority_thread = nullptr;
+		uint32_t pending_dependencies = 0; // Protected by task_mutex, task is posted once this reaches zero.
+		TightLocalVector<Task *> dependents; // Tasks waiting for this one to complete.
 
 		void free_template_userdata();
 		Task() :
@@ -104,6 +107,10 @@ private:
 	struct ThreadData {
 		uint32_t index;
 		Thread thread;
+		// Tasks posted from this thread. The owner pops from the front (most recent first),
+		// while other threads steal from the back (oldest first) when they run dry.
+		Mutex queue_mutex;
+		SelfList<Task>::List task_queue;
 	};
 
 	TightLocalVector<ThreadData> threads;
@@ -125,11 +132,18 @@ private:
 	void _process_task_queue();
 	void _process_task(Task *task);
 
+	Task *_pop_task(int p_thread_index);
 	void _post_task(Task *p_task, bool p_high_priority);
 
+	void _add_dependent(int64_t p_dependency, Task *p_task);
+	void _collect_ready_dependents(TightLocalVector<Task *> &p_dependents, TightLocalVector<Task *> &r_ready);
+	void _post_ready_dependents(TightLocalVector<Task *> &p_ready);
+	void _mark_task_completed(Task *p_task);
+	void _mark_group_completed(Group *p_group);
+
 	static WorkerThreadPool *singleton;
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies = Vector<TaskID>());
 	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
 
 	template <class C, class M, class U>
@@ -157,16 +171,18 @@ protected:
 
 public:
 	template <class C, class M, class U>
-	TaskID add_template_task(C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String()) {
+	TaskID add_template_task(C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>()) {
 		typedef TaskUserData<C, M, U> TUD;
 		TUD *ud = memnew(TUD);
 		ud->instance = p_instance;
 		ud->method = p_method;
 		ud->userdata = p_userdata;
-		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description);
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, p_dependencies);
 	}
-	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
-	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
+	// Dependencies can be any mix of task and group IDs. The task is only queued once all of them
+	// have completed, so no thread is blocked waiting for them.
+	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>());
+	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>());
 
 	bool is_task_completed(TaskID p_task_id) const;
 	void wait_for_task_completion(TaskID p_task_id);
@@ -187,6 +203,7 @@ public:
 	void wait_for_group_task_completion(GroupID p_group);
 
 	_FORCE_INLINE_ int get_thread_count() const { return threads.size(); }
+	int get_thread_index() const;
 
 	static WorkerThreadPool *get_singleton() { return singleton; }
 	void init(int p_thread_count = -1, bool p_use_native_threads_low_priority = true, float p_low_priority_task_ratio = 0.3);
@@ -0,0 +1,110 @@
+/*************************************************************************/
+/*  frame_arena.cpp                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "frame_arena.h"
+
+SafeNumeric<uint64_t> FrameArena::total_last_frame_used;
+SafeNumeric<uint64_t> FrameArena::total_capacity;
+
+bool FrameArena::_add_block(uint64_t p_min_size) {
+	uint64_t size = MAX(block_size, p_min_size);
+	Block *block = (Block *)Memory::alloc_static(sizeof(Block) + size);
+	ERR_FAIL_COND_V(!block, false);
+	block->next = blocks;
+	block->size = size;
+	blocks = block;
+	block_offset = 0;
+	capacity += size;
+	total_capacity.add(size);
+	return true;
+}
+
+void FrameArena::_free_blocks() {
+	while (blocks) {
+		Block *next = blocks->next;
+		Memory::free_static(blocks);
+		blocks = next;
+	}
+	total_capacity.sub(capacity);
+	capacity = 0;
+	block_offset = 0;
+}
+
+void *FrameArena::alloc(size_t p_bytes, size_t p_align) {
+	ERR_FAIL_COND_V(p_align == 0 || (p_align & (p_align - 1)) != 0, nullptr);
+
+	lock.lock();
+
+	uintptr_t address = 0;
+	if (blocks) {
+		uint8_t *data = (uint8_t *)(blocks + 1);
+		address = ((uintptr_t)(data + block_offset) + p_align - 1) & ~uintptr_t(p_align - 1);
+	}
+	if (!blocks || address + p_bytes > (uintptr_t)(blocks + 1) + blocks->size) {
+		if (unlikely(!_add_block(p_bytes + p_align))) {
+			lock.unlock();
+			return nullptr;
+		}
+		address = ((uintptr_t)(blocks + 1) + p_align - 1) & ~uintptr_t(p_align - 1);
+	}
+
+	block_offset = address - (uintptr_t)(blocks + 1) + p_bytes;
+	used += p_bytes;
+
+	lock.unlock();
+	return (void *)address;
+}
+
+void FrameArena::reset() {
+	lock.lock();
+
+	if (blocks && blocks->next) {
+		uint64_t merged_size = capacity;
+		_free_blocks();
+		_add_block(merged_size);
+	}
+	block_offset = 0;
+
+	total_last_frame_used.sub(last_frame_used);
+	last_frame_used = used;
+	total_last_frame_used.add(last_frame_used);
+	used = 0;
+
+	lock.unlock();
+}
+
+FrameArena::FrameArena(uint64_t p_block_size) {
+	block_size = p_block_size;
+}
+
+FrameArena::~FrameArena() {
+	_free_blocks();
+	total_last_frame_used.sub(last_frame_used);
+}
@@ -0,0 +1,91 @@
+/*************************************************************************/
+/*  frame_arena.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include "core/os/memory.h"
+#include "core/os/spin_lock.h"
+#include "core/templates/safe_refcount.h"
+
+#include <type_traits>
+
+// Linear scratch memory reset once per frame by its owner, meant for per frame data such as cull results or
+// render lists. Allocating is a pointer bump, nothing is freed individually and no destructors are run.
+// Every pointer handed out becomes invalid on reset(). Safe to allocate from several threads at once.
+class FrameArena {
+	struct Block {
+		Block *next = nullptr;
+		uint64_t size = 0;
+	};
+
+	SpinLock lock;
+	Block *blocks = nullptr; // Most recent first, allocation happens in the first one.
+	uint64_t block_offset = 0;
+	uint64_t used = 0;
+	uint64_t capacity = 0;
+	uint64_t last_frame_used = 0;
+	uint64_t block_size = 0;
+
+	static SafeNumeric<uint64_t> total_last_frame_used;
+	static SafeNumeric<uint64_t> total_capacity;
+
+	bool _add_block(uint64_t p_min_size);
+	void _free_blocks();
+
+public:
+	void *alloc(size_t p_bytes, size_t p_align = 16);
+
+	template <class T>
+	T *alloc_array(size_t p_count) {
+		static_assert(std::is_trivially_destructible<T>::value, "FrameArena never runs destructors.");
+		T *ptr = (T *)alloc(sizeof(T) * p_count, alignof(T));
+		for (size_t i = 0; i < p_count; i++) {
+			memnew_placement(&ptr[i], T);
+		}
+		return ptr;
+	}
+
+	// Releases everything allocated since the previous reset. Blocks are merged into one big enough for the
+	// frame that just ended, so a steady state frame fits in a single block.
+	void reset();
+
+	uint64_t get_used() const { return used; }
+	uint64_t get_capacity() const { return capacity; }
+
+	// Summed over all arenas, exposed through Performance.
+	static uint64_t get_total_last_frame_used() { return total_last_frame_used.get(); }
+	static uint64_t get_total_capacity() { return total_capacity.get(); }
+
+	FrameArena(uint64_t p_block_size = 64 * 1024);
+	~FrameArena();
+};
+
+#endif // FRAME_ARENA_H
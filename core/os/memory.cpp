@@ -31,10 +31,12 @@
 #include "memory.h"
 
 #include "core/error/error_macros.h"
+#include "core/os/spin_lock.h"
 #include "core/templates/safe_refcount.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
@@ -61,18 +63,239 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
+
+static SafeNumeric<uint64_t> tag_usage[Memory::TAG_MAX];
+static thread_local uint8_t current_tag = Memory::TAG_CORE;
 #endif
 
 SafeNumeric<uint64_t> Memory::alloc_count;
 
-void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
+// The size in a block header only uses the low 48 bits, the memory tag goes in the next byte
+// and the pool class (with MEMORY_POOL_ENABLED) in the top one.
+#define HEADER_SIZE_MASK ((uint64_t(1) << 48) - 1)
+#define HEADER_TAG_SHIFT 48
+#define HEADER_TAG_MASK (uint64_t(0xFF) << HEADER_TAG_SHIFT)
+
+_FORCE_INLINE_ static uint64_t _header_get_size(uint64_t p_header) {
+	return p_header & HEADER_SIZE_MASK;
+}
+
 #ifdef DEBUG_ENABLED
+_FORCE_INLINE_ static uint8_t _header_get_tag(uint64_t p_header) {
+	return (p_header & HEADER_TAG_MASK) >> HEADER_TAG_SHIFT;
+}
+#endif
+
+#ifdef MEMORY_POOL_ENABLED
+// Size classed pool in front of malloc. Blocks are carved from chunks that are never given back to the system,
+// each thread keeps a cache of free blocks per class so the common alloc/free pair takes no lock at all.
+// The class of a block is kept in the top byte of the size stored in its header, a block may be freed from any
+// thread and simply ends up in that thread's cache.
+
+#define POOL_CLASS_SHIFT 56
+
+static const uint32_t pool_class_sizes[] = { 32, 48, 64, 80, 96, 128, 160, 192, 256, 320, 384, 512, 768, 1024 };
+
+enum {
+	POOL_CLASS_COUNT = sizeof(pool_class_sizes) / sizeof(pool_class_sizes[0]),
+	POOL_MAX_SIZE = 1024,
+	POOL_CHUNK_SIZE = 64 * 1024,
+	POOL_THREAD_CACHE_BYTES = 32 * 1024, // Per class, above this half of the cache goes back to the shared list.
+};
+
+struct PoolFreeBlock {
+	PoolFreeBlock *next;
+};
+
+struct PoolClass {
+	SpinLock lock;
+	PoolFreeBlock *free_list = nullptr;
+	uint32_t free_count = 0;
+};
+
+// Trivial types only, so they stay usable during static and thread_local destruction.
+static PoolClass pool_classes[POOL_CLASS_COUNT];
+static SafeNumeric<uint64_t> pool_reserved;
+
+struct PoolThreadCache {
+	PoolFreeBlock *lists[POOL_CLASS_COUNT];
+	uint32_t counts[POOL_CLASS_COUNT];
+	bool released;
+};
+
+static thread_local PoolThreadCache pool_thread_cache;
+
+// Class for each size in 16 byte steps, up to POOL_MAX_SIZE.
+static const uint8_t pool_size_to_class[POOL_MAX_SIZE / 16 + 1] = {
+	0, 0, 0, 1, 2, 3, 4, 5, 5, 6, 6, 7, 7, 8, 8, 8,
+	8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11,
+	11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13,
+};
+
+_FORCE_INLINE_ static uint32_t _pool_cache_limit(uint32_t p_class) {
+	return MAX(POOL_THREAD_CACHE_BYTES / pool_class_sizes[p_class], 8u);
+}
+
+static void _pool_release_to_shared(uint32_t p_class, uint32_t p_count) {
+	PoolThreadCache &cache = pool_thread_cache;
+	PoolFreeBlock *first = cache.lists[p_class];
+	PoolFreeBlock *last = first;
+	for (uint32_t i = 1; i < p_count; i++) {
+		last = last->next;
+	}
+	cache.lists[p_class] = last->next;
+	cache.counts[p_class] -= p_count;
+
+	PoolClass &pool_class = pool_classes[p_class];
+	pool_class.lock.lock();
+	last->next = pool_class.free_list;
+	pool_class.free_list = first;
+	pool_class.free_count += p_count;
+	pool_class.lock.unlock();
+}
+
+// Gives the blocks of a finished thread back to the shared lists.
+struct PoolThreadCacheRelease {
+	bool registered = false;
+
+	~PoolThreadCacheRelease() {
+		PoolThreadCache &cache = pool_thread_cache;
+		for (uint32_t i = 0; i < POOL_CLASS_COUNT; i++) {
+			if (cache.counts[i]) {
+				_pool_release_to_shared(i, cache.counts[i]);
+			}
+		}
+		cache.released = true;
+	}
+};
+
+static thread_local PoolThreadCacheRelease pool_thread_cache_release;
+
+_FORCE_INLINE_ static int _pool_get_class(size_t p_size) {
+	if (p_size > POOL_MAX_SIZE) {
+		return -1;
+	}
+	return pool_size_to_class[(p_size + 15) >> 4];
+}
+
+static void *_pool_alloc(uint32_t p_class) {
+	PoolThreadCache &cache = pool_thread_cache;
+	if (unlikely(cache.released)) {
+		// Thread is shutting down and its cache is gone, the block joins the pool once freed.
+		return malloc(pool_class_sizes[p_class]);
+	}
+
+	if (unlikely(!cache.lists[p_class])) {
+		// Touch the release helper so its destructor is registered for this thread.
+		pool_thread_cache_release.registered = true;
+
+		PoolClass &pool_class = pool_classes[p_class];
+		uint32_t batch = _pool_cache_limit(p_class) / 2;
+
+		pool_class.lock.lock();
+		if (pool_class.free_count) {
+			PoolFreeBlock *first = pool_class.free_list;
+			PoolFreeBlock *last = first;
+			uint32_t taken = 1;
+			while (taken < batch && last->next) {
+				last = last->next;
+				taken++;
+			}
+			pool_class.free_list = last->next;
+			pool_class.free_count -= taken;
+			last->next = nullptr;
+			cache.lists[p_class] = first;
+			cache.counts[p_class] = taken;
+		}
+		pool_class.lock.unlock();
+
+		if (!cache.lists[p_class]) {
+			uint8_t *chunk = (uint8_t *)malloc(POOL_CHUNK_SIZE);
+			if (!chunk) {
+				return nullptr;
+			}
+			pool_reserved.add(POOL_CHUNK_SIZE);
+
+			uint32_t block_size = pool_class_sizes[p_class];
+			uint32_t block_count = POOL_CHUNK_SIZE / block_size;
+			for (uint32_t i = 0; i < block_count; i++) {
+				PoolFreeBlock *block = (PoolFreeBlock *)(chunk + i * block_size);
+				block->next = cache.lists[p_class];
+				cache.lists[p_class] = block;
+			}
+			cache.counts[p_class] = block_count;
+		}
+	}
+
+	PoolFreeBlock *block = cache.lists[p_class];
+	cache.lists[p_class] = block->next;
+	cache.counts[p_class]--;
+	return block;
+}
+
+static void _pool_free(void *p_mem, uint32_t p_class) {
+	PoolThreadCache &cache = pool_thread_cache;
+	PoolFreeBlock *block = (PoolFreeBlock *)p_mem;
+
+	if (unlikely(cache.released)) {
+		PoolClass &pool_class = pool_classes[p_class];
+		pool_class.lock.lock();
+		block->next = pool_class.free_list;
+		pool_class.free_list = block;
+		pool_class.free_count++;
+		pool_class.lock.unlock();
+		return;
+	}
+
+	block->next = cache.lists[p_class];
+	cache.lists[p_class] = block;
+	cache.counts[p_class]++;
+
+	uint32_t limit = _pool_cache_limit(p_class);
+	if (cache.counts[p_class] > limit) {
+		_pool_release_to_shared(p_class, limit / 2);
+	}
+}
+
+// Allocates p_bytes plus the header, and returns the value to store in the header.
+_FORCE_INLINE_ static void *_pool_alloc_block(size_t p_bytes, uint64_t &r_header) {
+	int pool_class = _pool_get_class(p_bytes + PAD_ALIGN);
+	if (pool_class < 0) {
+		r_header = p_bytes;
+		return malloc(p_bytes + PAD_ALIGN);
+	}
+	void *mem = _pool_alloc(pool_class);
+	r_header = p_bytes | (uint64_t(pool_class + 1) << POOL_CLASS_SHIFT);
+	return mem;
+}
+
+_FORCE_INLINE_ static void _pool_free_block(void *p_mem, uint64_t p_header) {
+	uint32_t pool_class = p_header >> POOL_CLASS_SHIFT;
+	if (pool_class == 0) {
+		free(p_mem);
+		return;
+	}
+	_pool_free(p_mem, pool_class - 1);
+}
+
+#endif // MEMORY_POOL_ENABLED
+
+void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
+#if defined(DEBUG_ENABLED) || defined(MEMORY_POOL_ENABLED)
+	// The pool finds the class of a block through its header, so every block has one.
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
 #endif
 
+#ifdef MEMORY_POOL_ENABLED
+	uint64_t header = 0;
+	void *mem = _pool_alloc_block(p_bytes, header);
+#else
 	void *mem = malloc(p_bytes + (prepad ? PAD_ALIGN : 0));
+#endif
 
 	ERR_FAIL_COND_V(!mem, nullptr);
 
@@ -80,13 +303,20 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 
 	if (prepad) {
 		uint64_t *s = (uint64_t *)mem;
+#ifdef MEMORY_POOL_ENABLED
+		*s = header;
+#else
 		*s = p_bytes;
+#endif
 
 		uint8_t *s8 = (uint8_t *)mem;
 
 #ifdef DEBUG_ENABLED
 		uint64_t new_mem_usage = mem_usage.add(p_bytes);
 		max_usage.exchange_if_greater(new_mem_usage);
+		uint8_t tag = current_tag;
+		*s |= uint64_t(tag) << HEADER_TAG_SHIFT;
+		tag_usage[tag].add(p_bytes);
 #endif
 		return s8 + PAD_ALIGN;
 	} else {
@@ -101,7 +331,7 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_memory;
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) || defined(MEMORY_POOL_ENABLED)
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -110,30 +340,68 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	if (prepad) {
 		mem -= PAD_ALIGN;
 		uint64_t *s = (uint64_t *)mem;
+		uint64_t old_bytes = _header_get_size(*s);
+		// The block keeps the tag it was allocated with.
+		uint64_t tag_bits = *s & HEADER_TAG_MASK;
 
 #ifdef DEBUG_ENABLED
-		if (p_bytes > *s) {
-			uint64_t new_mem_usage = mem_usage.add(p_bytes - *s);
+		uint8_t tag = _header_get_tag(*s);
+		if (p_bytes > old_bytes) {
+			uint64_t new_mem_usage = mem_usage.add(p_bytes - old_bytes);
 			max_usage.exchange_if_greater(new_mem_usage);
+			tag_usage[tag].add(p_bytes - old_bytes);
 		} else {
-			mem_usage.sub(*s - p_bytes);
+			mem_usage.sub(old_bytes - p_bytes);
+			tag_usage[tag].sub(old_bytes - p_bytes);
 		}
 #endif
 
 		if (p_bytes == 0) {
+#ifdef MEMORY_POOL_ENABLED
+			_pool_free_block(mem, *s);
+#else
 			free(mem);
+#endif
 			return nullptr;
 		} else {
-			*s = p_bytes;
+#ifdef MEMORY_POOL_ENABLED
+			uint64_t old_header = *s;
+			int old_class = int(old_header >> POOL_CLASS_SHIFT) - 1;
+			int new_class = _pool_get_class(p_bytes + PAD_ALIGN);
+			if (old_class == new_class && old_class >= 0) {
+				// Still fits in the same block.
+				*s = p_bytes | (old_header & ~HEADER_SIZE_MASK);
+				return mem + PAD_ALIGN;
+			}
+			if (old_class < 0 && new_class < 0) {
+				mem = (uint8_t *)realloc(mem, p_bytes + PAD_ALIGN);
+				ERR_FAIL_COND_V(!mem, nullptr);
+				s = (uint64_t *)mem;
+				*s = p_bytes | tag_bits;
+				return mem + PAD_ALIGN;
+			}
+
+			// Moving between the pool and malloc, or between classes. The whole padding is copied, callers keep
+			// their own data in it (see CowData).
+			uint64_t new_header = 0;
+			uint8_t *new_mem = (uint8_t *)_pool_alloc_block(p_bytes, new_header);
+			ERR_FAIL_COND_V(!new_mem, nullptr);
+			memcpy(new_mem, mem, PAD_ALIGN + MIN(old_bytes, (uint64_t)p_bytes));
+			*(uint64_t *)new_mem = new_header | tag_bits;
+			_pool_free_block(mem, old_header);
+			return new_mem + PAD_ALIGN;
+#else
+			*s = p_bytes | tag_bits;
 
 			mem = (uint8_t *)realloc(mem, p_bytes + PAD_ALIGN);
 			ERR_FAIL_COND_V(!mem, nullptr);
 
 			s = (uint64_t *)mem;
 
-			*s = p_bytes;
+			*s = p_bytes | tag_bits;
 
 			return mem + PAD_ALIGN;
+#endif
 		}
 	} else {
 		mem = (uint8_t *)realloc(mem, p_bytes);
@@ -149,7 +417,7 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_ptr;
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) || defined(MEMORY_POOL_ENABLED)
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -162,15 +430,69 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 #ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)mem;
-		mem_usage.sub(*s);
+		mem_usage.sub(_header_get_size(*s));
+		tag_usage[_header_get_tag(*s)].sub(_header_get_size(*s));
 #endif
 
+#ifdef MEMORY_POOL_ENABLED
+		_pool_free_block(mem, *(uint64_t *)mem);
+#else
 		free(mem);
+#endif
 	} else {
 		free(mem);
 	}
 }
 
+uint64_t Memory::get_pool_reserved() {
+#ifdef MEMORY_POOL_ENABLED
+	return pool_reserved.get();
+#else
+	return 0;
+#endif
+}
+
+Memory::Tag Memory::set_current_tag(Tag p_tag) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, Tag(current_tag));
+	Tag previous = Tag(current_tag);
+	current_tag = p_tag;
+	return previous;
+#else
+	return TAG_CORE;
+#endif
+}
+
+Memory::Tag Memory::get_current_tag() {
+#ifdef DEBUG_ENABLED
+	return Tag(current_tag);
+#else
+	return TAG_CORE;
+#endif
+}
+
+uint64_t Memory::get_tag_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+const char *Memory::get_tag_name(Tag p_tag) {
+	static const char *names[TAG_MAX] = {
+		"core",
+		"script",
+		"render",
+		"physics",
+		"audio",
+		"resources",
+	};
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, "");
+	return names[p_tag];
+}
+
 uint64_t Memory::get_mem_available() {
 	return -1; // 0xFFFF...
 }
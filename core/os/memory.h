@@ -51,6 +51,17 @@ class Memory {
 	static SafeNumeric<uint64_t> alloc_count;
 
 public:
+	// Subsystem an allocation is accounted to, see MemoryTagScope.
+	enum Tag {
+		TAG_CORE,
+		TAG_SCRIPT,
+		TAG_RENDER,
+		TAG_PHYSICS,
+		TAG_AUDIO,
+		TAG_RESOURCES,
+		TAG_MAX
+	};
+
 	static void *alloc_static(size_t p_bytes, bool p_pad_align = false);
 	static void *realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align = false);
 	static void free_static(void *p_ptr, bool p_pad_align = false);
@@ -58,6 +69,28 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+	// Bytes the size classed pool took from the system, 0 unless built with MEMORY_POOL_ENABLED.
+	static uint64_t get_pool_reserved();
+
+	// Tags are only tracked with DEBUG_ENABLED, like the usage totals.
+	static Tag set_current_tag(Tag p_tag); // Returns the previous tag of the calling thread.
+	static Tag get_current_tag();
+	static uint64_t get_tag_usage(Tag p_tag);
+	static const char *get_tag_name(Tag p_tag);
+};
+
+// Accounts everything allocated by the calling thread to p_tag, until going out of scope.
+class MemoryTagScope {
+#ifdef DEBUG_ENABLED
+	Memory::Tag previous;
+
+public:
+	_FORCE_INLINE_ MemoryTagScope(Memory::Tag p_tag) { previous = Memory::set_current_tag(p_tag); }
+	_FORCE_INLINE_ ~MemoryTagScope() { Memory::set_current_tag(previous); }
+#else
+public:
+	_FORCE_INLINE_ MemoryTagScope(Memory::Tag p_tag) {}
+#endif
 };
 
 class DefaultAllocator {
@@ -43,6 +43,7 @@
 #include "core/input/input.h"
 #include "core/input/input_map.h"
 #include "core/input/shortcut.h"
+#include "core/io/compact_variant.h"
 #include "core/io/config_file.h"
 #include "core/io/dir_access.h"
 #include "core/io/dtls_server.h"
@@ -240,6 +241,7 @@ void register_core_types() {
 	GDREGISTER_CLASS(XMLParser);
 	GDREGISTER_CLASS(JSON);
 
+	GDREGISTER_CLASS(CompactVariant);
 	GDREGISTER_CLASS(ConfigFile);
 
 	GDREGISTER_CLASS(PCKPacker);
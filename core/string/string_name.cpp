@@ -46,12 +46,34 @@ StringName _scs_create(const char *p_chr, bool p_static) {
 }
 
 bool StringName::configured = false;
-Mutex StringName::mutex;
+Mutex StringName::mutex[STRING_TABLE_LOCK_LEN];
 
 #ifdef DEBUG_ENABLED
 bool StringName::debug_stringname = false;
 #endif
 
+bool StringName::_Data::matches(const char32_t *p_name, int p_length) const {
+	if (cname) {
+		for (int i = 0; i < p_length; i++) {
+			if (cname[i] == 0 || (char32_t)(uint8_t)cname[i] != p_name[i]) {
+				return false;
+			}
+		}
+		return cname[p_length] == 0;
+	}
+
+	if (name.length() != p_length) {
+		return false;
+	}
+	const char32_t *str = name.ptr();
+	for (int i = 0; i < p_length; i++) {
+		if (str[i] != p_name[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void StringName::setup() {
 	ERR_FAIL_COND(configured);
 	for (int i = 0; i < STRING_TABLE_LEN; i++) {
@@ -61,12 +83,11 @@ void StringName::setup() {
 }
 
 void StringName::cleanup() {
-	MutexLock lock(mutex);
-
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		Vector<_Data *> data;
 		for (int i = 0; i < STRING_TABLE_LEN; i++) {
+			MutexLock lock(_get_mutex(i));
 			_Data *d = _table[i];
 			while (d) {
 				data.push_back(d);
@@ -94,6 +115,7 @@ void StringName::cleanup() {
 #endif
 	int lost_strings = 0;
 	for (int i = 0; i < STRING_TABLE_LEN; i++) {
+		MutexLock lock(_get_mutex(i));
 		while (_table[i]) {
 			_Data *d = _table[i];
 			if (d->static_count.get() != d->refcount.get()) {
@@ -122,7 +144,7 @@ void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
+		MutexLock lock(_get_mutex(_data->idx));
 
 		if (_data->static_count.get() > 0) {
 			if (_data->cname) {
@@ -206,12 +228,12 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_mutex(idx));
+
 	_data = _table[idx];
 
 	while (_data) {
@@ -268,12 +290,12 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_static_string.ptr);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_mutex(idx));
+
 	_data = _table[idx];
 
 	while (_data) {
@@ -330,11 +352,11 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_mutex(idx));
+
 	_data = _table[idx];
 
 	while (_data) {
@@ -382,6 +404,67 @@ StringName::StringName(const String &p_name, bool p_static) {
 	_table[idx] = _data;
 }
 
+StringName::StringName(const char32_t *p_name, int p_length, bool p_static) {
+	_data = nullptr;
+
+	ERR_FAIL_COND(!configured);
+
+	if (!p_name || p_length <= 0) {
+		return;
+	}
+
+	uint32_t hash = String::hash(p_name, p_length);
+	uint32_t idx = hash & STRING_TABLE_MASK;
+
+	MutexLock lock(_get_mutex(idx));
+
+	_data = _table[idx];
+
+	while (_data) {
+		if (_data->hash == hash && _data->matches(p_name, p_length)) {
+			break;
+		}
+		_data = _data->next;
+	}
+
+	if (_data) {
+		if (_data->refcount.ref()) {
+			// exists
+			if (p_static) {
+				_data->static_count.increment();
+			}
+#ifdef DEBUG_ENABLED
+			if (unlikely(debug_stringname)) {
+				_data->debug_references++;
+			}
+#endif
+			return;
+		}
+	}
+
+	_data = memnew(_Data);
+	_data->name = String(p_name, p_length);
+	_data->refcount.init();
+	_data->static_count.set(p_static ? 1 : 0);
+	_data->hash = hash;
+	_data->idx = idx;
+	_data->cname = nullptr;
+	_data->next = _table[idx];
+	_data->prev = nullptr;
+#ifdef DEBUG_ENABLED
+	if (unlikely(debug_stringname)) {
+		// Keep in memory, force static.
+		_data->refcount.ref();
+		_data->static_count.increment();
+	}
+#endif
+
+	if (_table[idx]) {
+		_table[idx]->prev = _data;
+	}
+	_table[idx] = _data;
+}
+
 StringName StringName::search(const char *p_name) {
 	ERR_FAIL_COND_V(!configured, StringName());
 
@@ -390,11 +473,11 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_mutex(idx));
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
@@ -426,12 +509,12 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_mutex(idx));
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
@@ -452,12 +535,12 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name.is_empty(), StringName());
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_mutex(idx));
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
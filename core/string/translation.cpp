@@ -82,6 +82,13 @@ void Translation::_set_messages(const Dictionary &p_messages) {
 void Translation::set_locale(const String &p_locale) {
 	locale = TranslationServer::get_singleton()->standardize_locale(p_locale);
 
+	for (const Ref<Translation> &E : TranslationServer::get_singleton()->translations) {
+		if (E.ptr() == this) {
+			TranslationServer::get_singleton()->_update_locale_translations();
+			break;
+		}
+	}
+
 	if (OS::get_singleton()->get_main_loop() && TranslationServer::get_singleton()->get_loaded_locales().has(get_locale())) {
 		OS::get_singleton()->get_main_loop()->notification(MainLoop::NOTIFICATION_TRANSLATION_CHANGED);
 	}
@@ -510,6 +517,7 @@ String TranslationServer::get_country_name(const String &p_country) const {
 
 void TranslationServer::set_locale(const String &p_locale) {
 	locale = standardize_locale(p_locale);
+	_update_locale_translations();
 
 	if (OS::get_singleton()->get_main_loop()) {
 		OS::get_singleton()->get_main_loop()->notification(MainLoop::NOTIFICATION_TRANSLATION_CHANGED);
@@ -537,10 +545,12 @@ PackedStringArray TranslationServer::get_loaded_locales() const {
 
 void TranslationServer::add_translation(const Ref<Translation> &p_translation) {
 	translations.insert(p_translation);
+	_update_locale_translations();
 }
 
 void TranslationServer::remove_translation(const Ref<Translation> &p_translation) {
 	translations.erase(p_translation);
+	_update_locale_translations();
 }
 
 Ref<Translation> TranslationServer::get_translation_object(const String &p_locale) {
@@ -566,6 +576,61 @@ Ref<Translation> TranslationServer::get_translation_object(const String &p_local
 
 void TranslationServer::clear() {
 	translations.clear();
+	_update_locale_translations();
+}
+
+void TranslationServer::_gather_locale_translations(const String &p_locale, LocalVector<Ref<Translation>> &r_translations) const {
+	struct Candidate {
+		Ref<Translation> translation;
+		int score = 0;
+		int index = 0;
+	};
+
+	// Same order the lookup used to visit them in: higher score first, the first exact match
+	// wins, and among partial matches of equal score the last one wins.
+	struct CandidateSort {
+		_FORCE_INLINE_ bool operator()(const Candidate &p_a, const Candidate &p_b) const {
+			if (p_a.score != p_b.score) {
+				return p_a.score > p_b.score;
+			}
+			return p_a.score == 10 ? p_a.index < p_b.index : p_a.index > p_b.index;
+		}
+	};
+
+	LocalVector<Candidate> candidates;
+	int index = 0;
+	for (const Ref<Translation> &E : translations) {
+		ERR_CONTINUE(E.is_null());
+		int score = compare_locales(p_locale, E->get_locale());
+		if (score > 0) {
+			Candidate c;
+			c.translation = E;
+			c.score = score;
+			c.index = index;
+			candidates.push_back(c);
+		}
+		index++;
+	}
+
+	if (candidates.size() > 1) {
+		SortArray<Candidate, CandidateSort> sorter;
+		sorter.sort(candidates.ptr(), candidates.size());
+	}
+
+	r_translations.clear();
+	for (uint32_t i = 0; i < candidates.size(); i++) {
+		r_translations.push_back(candidates[i].translation);
+	}
+}
+
+void TranslationServer::_update_locale_translations() {
+	_gather_locale_translations(locale, locale_translations);
+	if (fallback.length() >= 2) {
+		_gather_locale_translations(fallback, fallback_translations);
+	} else {
+		fallback_translations.clear();
+	}
+	translation_version++;
 }
 
 StringName TranslationServer::translate(const StringName &p_message, const StringName &p_context) const {
@@ -575,10 +640,10 @@ StringName TranslationServer::translate(const StringName &p_message, const Strin
 		return p_message;
 	}
 
-	StringName res = _get_message_from_translations(p_message, p_context, locale, false);
+	StringName res = _get_message_from_translations(p_message, p_context, locale_translations, false);
 
-	if (!res && fallback.length() >= 2) {
-		res = _get_message_from_translations(p_message, p_context, fallback, false);
+	if (!res) {
+		res = _get_message_from_translations(p_message, p_context, fallback_translations, false);
 	}
 
 	if (!res) {
@@ -596,10 +661,10 @@ StringName TranslationServer::translate_plural(const StringName &p_message, cons
 		return p_message_plural;
 	}
 
-	StringName res = _get_message_from_translations(p_message, p_context, locale, true, p_message_plural, p_n);
+	StringName res = _get_message_from_translations(p_message, p_context, locale_translations, true, p_message_plural, p_n);
 
-	if (!res && fallback.length() >= 2) {
-		res = _get_message_from_translations(p_message, p_context, fallback, true, p_message_plural, p_n);
+	if (!res) {
+		res = _get_message_from_translations(p_message, p_context, fallback_translations, true, p_message_plural, p_n);
 	}
 
 	if (!res) {
@@ -612,35 +677,20 @@ StringName TranslationServer::translate_plural(const StringName &p_message, cons
 	return res;
 }
 
-StringName TranslationServer::_get_message_from_translations(const StringName &p_message, const StringName &p_context, const String &p_locale, bool plural, const String &p_message_plural, int p_n) const {
-	StringName res;
-	int best_score = 0;
-
-	for (const Ref<Translation> &E : translations) {
-		const Ref<Translation> &t = E;
-		ERR_FAIL_COND_V(t.is_null(), p_message);
-		String l = t->get_locale();
-
-		int score = compare_locales(p_locale, l);
-		if (score > 0 && score >= best_score) {
-			StringName r;
-			if (!plural) {
-				r = t->get_message(p_message, p_context);
-			} else {
-				r = t->get_plural_message(p_message, p_message_plural, p_n, p_context);
-			}
-			if (!r) {
-				continue;
-			}
-			res = r;
-			best_score = score;
-			if (score == 10) {
-				break; // Exact match, skip the rest.
-			}
+StringName TranslationServer::_get_message_from_translations(const StringName &p_message, const StringName &p_context, const LocalVector<Ref<Translation>> &p_translations, bool plural, const String &p_message_plural, int p_n) const {
+	for (uint32_t i = 0; i < p_translations.size(); i++) {
+		StringName r;
+		if (!plural) {
+			r = p_translations[i]->get_message(p_message, p_context);
+		} else {
+			r = p_translations[i]->get_plural_message(p_message, p_message_plural, p_n, p_context);
+		}
+		if (r) {
+			return r;
 		}
 	}
 
-	return res;
+	return StringName();
 }
 
 TranslationServer *TranslationServer::singleton = nullptr;
@@ -677,6 +727,7 @@ void TranslationServer::setup() {
 	}
 
 	fallback = GLOBAL_DEF("internationalization/locale/fallback", "en");
+	_update_locale_translations();
 	pseudolocalization_enabled = GLOBAL_DEF("internationalization/pseudolocalization/use_pseudolocalization", false);
 	pseudolocalization_accents_enabled = GLOBAL_DEF("internationalization/pseudolocalization/replace_with_accents", true);
 	pseudolocalization_double_vowels_enabled = GLOBAL_DEF("internationalization/pseudolocalization/double_vowels", false);
@@ -774,6 +825,7 @@ bool TranslationServer::is_pseudolocalization_enabled() const {
 
 void TranslationServer::set_pseudolocalization_enabled(bool p_enabled) {
 	pseudolocalization_enabled = p_enabled;
+	translation_version++;
 
 	if (OS::get_singleton()->get_main_loop()) {
 		OS::get_singleton()->get_main_loop()->notification(MainLoop::NOTIFICATION_TRANSLATION_CHANGED);
@@ -786,6 +838,7 @@ void TranslationServer::set_editor_pseudolocalization(bool p_enabled) {
 }
 
 void TranslationServer::reload_pseudolocalization() {
+	translation_version++;
 	pseudolocalization_accents_enabled = GLOBAL_GET("internationalization/pseudolocalization/replace_with_accents");
 	pseudolocalization_double_vowels_enabled = GLOBAL_GET("internationalization/pseudolocalization/double_vowels");
 	pseudolocalization_fake_bidi_enabled = GLOBAL_GET("internationalization/pseudolocalization/fake_bidi");
@@ -34,6 +34,7 @@
 #include "core/io/resource.h"
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/script_language.h"
+#include "core/templates/local_vector.h"
 
 class Translation : public Resource {
 	GDCLASS(Translation, Resource);
@@ -77,6 +78,12 @@ class TranslationServer : public Object {
 
 	HashSet<Ref<Translation>> translations;
 	Ref<Translation> tool_translation;
+
+	// Translations matching the locale and the fallback, best match first.
+	// Rebuilt when the locale or the translation set changes, so lookups skip locale comparison.
+	LocalVector<Ref<Translation>> locale_translations;
+	LocalVector<Ref<Translation>> fallback_translations;
+	uint64_t translation_version = 0;
 	Ref<Translation> doc_translation;
 
 	bool enabled = true;
@@ -105,7 +112,11 @@ class TranslationServer : public Object {
 	bool _load_translations(const String &p_from);
 	String _standardize_locale(const String &p_locale, bool p_add_defaults) const;
 
-	StringName _get_message_from_translations(const StringName &p_message, const StringName &p_context, const String &p_locale, bool plural, const String &p_message_plural = "", int p_n = 0) const;
+	StringName _get_message_from_translations(const StringName &p_message, const StringName &p_context, const LocalVector<Ref<Translation>> &p_translations, bool plural, const String &p_message_plural = "", int p_n = 0) const;
+	void _gather_locale_translations(const String &p_locale, LocalVector<Ref<Translation>> &r_translations) const;
+	void _update_locale_translations();
+
+	friend class Translation;
 
 	static void _bind_methods();
 
@@ -129,9 +140,15 @@ class TranslationServer : public Object {
 public:
 	_FORCE_INLINE_ static TranslationServer *get_singleton() { return singleton; }
 
-	void set_enabled(bool p_enabled) { enabled = p_enabled; }
+	void set_enabled(bool p_enabled) {
+		enabled = p_enabled;
+		translation_version++;
+	}
 	_FORCE_INLINE_ bool is_enabled() const { return enabled; }
 
+	// Changes whenever translate() may return something different for the same message.
+	_FORCE_INLINE_ uint64_t get_translation_version() const { return translation_version; }
+
 	void set_locale(const String &p_locale);
 	String get_locale() const;
 	Ref<Translation> get_translation_object(const String &p_locale);
@@ -53,8 +53,186 @@
 #define snprintf _snprintf_s
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USTRING_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define USTRING_NEON
+#include <arm_neon.h>
+#endif
+
 static const int MAX_DECIMALS = 32;
 
+// Vectorized fast paths for ASCII text. They only ever consume whole blocks,
+// the scalar code handles whatever is left and everything that isn't plain ASCII.
+
+// Returns the index of the first occurrence of p_char in [p_from, p_to), or -1.
+static _FORCE_INLINE_ int _find_char32(const char32_t *p_str, int p_from, int p_to, char32_t p_char) {
+	int i = p_from;
+#if defined(USTRING_SSE2)
+	const __m128i needle = _mm_set1_epi32((int)p_char);
+	for (; i + 4 <= p_to; i += 4) {
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(p_str + i)), needle))) {
+			break;
+		}
+	}
+#elif defined(USTRING_NEON)
+	const uint32x4_t needle = vdupq_n_u32(p_char);
+	for (; i + 4 <= p_to; i += 4) {
+		if (vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(vceqq_u32(vld1q_u32((const uint32_t *)(p_str + i)), needle))), 0)) {
+			break;
+		}
+	}
+#endif
+	for (; i < p_to; i++) {
+		if (p_str[i] == p_char) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+// Returns how many leading characters, in blocks of 4, are 7-bit ASCII.
+static _FORCE_INLINE_ int _char32_ascii_prefix(const char32_t *p_str, int p_len) {
+	int i = 0;
+#if defined(USTRING_SSE2)
+	const __m128i high_bits = _mm_set1_epi32(~0x7f);
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 4 <= p_len; i += 4) {
+		const __m128i v = _mm_loadu_si128((const __m128i *)(p_str + i));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, high_bits), zero)) != 0xffff) {
+			break;
+		}
+	}
+#elif defined(USTRING_NEON)
+	const uint32x4_t high_bits = vdupq_n_u32(~0x7fu);
+	for (; i + 4 <= p_len; i += 4) {
+		if (vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(vtstq_u32(vld1q_u32((const uint32_t *)(p_str + i)), high_bits))), 0)) {
+			break;
+		}
+	}
+#endif
+	return i;
+}
+
+// Returns how many leading bytes, in blocks of 16, are 7-bit ASCII and neither NUL nor, optionally, CR.
+static _FORCE_INLINE_ int _utf8_ascii_prefix(const uint8_t *p_str, int p_len, bool p_stop_at_cr) {
+	int i = 0;
+#if defined(USTRING_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i cr = _mm_set1_epi8('\r');
+	for (; i + 16 <= p_len; i += 16) {
+		const __m128i v = _mm_loadu_si128((const __m128i *)(p_str + i));
+		__m128i stop = _mm_cmpeq_epi8(v, zero);
+		if (p_stop_at_cr) {
+			stop = _mm_or_si128(stop, _mm_cmpeq_epi8(v, cr));
+		}
+		// Non-ASCII bytes have their high bit set, as do the matched NUL and CR lanes.
+		if (_mm_movemask_epi8(_mm_or_si128(v, stop))) {
+			break;
+		}
+	}
+#elif defined(USTRING_NEON)
+	const uint8x16_t zero = vdupq_n_u8(0);
+	const uint8x16_t ascii_max = vdupq_n_u8(0x7f);
+	const uint8x16_t cr = vdupq_n_u8('\r');
+	for (; i + 16 <= p_len; i += 16) {
+		const uint8x16_t v = vld1q_u8(p_str + i);
+		uint8x16_t stop = vorrq_u8(vceqq_u8(v, zero), vcgtq_u8(v, ascii_max));
+		if (p_stop_at_cr) {
+			stop = vorrq_u8(stop, vceqq_u8(v, cr));
+		}
+		const uint64x2_t stop64 = vreinterpretq_u64_u8(stop);
+		if (vgetq_lane_u64(stop64, 0) | vgetq_lane_u64(stop64, 1)) {
+			break;
+		}
+	}
+#endif
+	return i;
+}
+
+// Widens p_len ASCII bytes to UTF-32. p_len is a multiple of 16, as returned by _utf8_ascii_prefix().
+static _FORCE_INLINE_ void _widen_ascii(char32_t *p_dst, const uint8_t *p_src, int p_len) {
+#if defined(USTRING_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	for (int i = 0; i < p_len; i += 16) {
+		const __m128i v = _mm_loadu_si128((const __m128i *)(p_src + i));
+		const __m128i lo = _mm_unpacklo_epi8(v, zero);
+		const __m128i hi = _mm_unpackhi_epi8(v, zero);
+		_mm_storeu_si128((__m128i *)(p_dst + i), _mm_unpacklo_epi16(lo, zero));
+		_mm_storeu_si128((__m128i *)(p_dst + i + 4), _mm_unpackhi_epi16(lo, zero));
+		_mm_storeu_si128((__m128i *)(p_dst + i + 8), _mm_unpacklo_epi16(hi, zero));
+		_mm_storeu_si128((__m128i *)(p_dst + i + 12), _mm_unpackhi_epi16(hi, zero));
+	}
+#elif defined(USTRING_NEON)
+	for (int i = 0; i < p_len; i += 16) {
+		const uint8x16_t v = vld1q_u8(p_src + i);
+		const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+		const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+		vst1q_u32((uint32_t *)(p_dst + i), vmovl_u16(vget_low_u16(lo)));
+		vst1q_u32((uint32_t *)(p_dst + i + 4), vmovl_u16(vget_high_u16(lo)));
+		vst1q_u32((uint32_t *)(p_dst + i + 8), vmovl_u16(vget_low_u16(hi)));
+		vst1q_u32((uint32_t *)(p_dst + i + 12), vmovl_u16(vget_high_u16(hi)));
+	}
+#else
+	for (int i = 0; i < p_len; i++) {
+		p_dst[i] = p_src[i];
+	}
+#endif
+}
+
+// Narrows p_len ASCII characters to bytes. p_len is a multiple of 4, as returned by _char32_ascii_prefix().
+static _FORCE_INLINE_ void _narrow_ascii(uint8_t *p_dst, const char32_t *p_src, int p_len) {
+	int i = 0;
+#if defined(USTRING_SSE2)
+	for (; i + 16 <= p_len; i += 16) {
+		const __m128i a = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)(p_src + i)), _mm_loadu_si128((const __m128i *)(p_src + i + 4)));
+		const __m128i b = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)(p_src + i + 8)), _mm_loadu_si128((const __m128i *)(p_src + i + 12)));
+		_mm_storeu_si128((__m128i *)(p_dst + i), _mm_packus_epi16(a, b));
+	}
+#elif defined(USTRING_NEON)
+	for (; i + 16 <= p_len; i += 16) {
+		const uint16x8_t a = vcombine_u16(vmovn_u32(vld1q_u32((const uint32_t *)(p_src + i))), vmovn_u32(vld1q_u32((const uint32_t *)(p_src + i + 4))));
+		const uint16x8_t b = vcombine_u16(vmovn_u32(vld1q_u32((const uint32_t *)(p_src + i + 8))), vmovn_u32(vld1q_u32((const uint32_t *)(p_src + i + 12))));
+		vst1q_u8(p_dst + i, vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+	}
+#endif
+	for (; i < p_len; i++) {
+		p_dst[i] = (uint8_t)p_src[i];
+	}
+}
+
+// Converts the ASCII letters in a block of 4 characters to the other case, and returns whether it was plain ASCII.
+// p_from and p_to bound the letters to convert ('a' and 'z' for to_upper(), 'A' and 'Z' for to_lower()).
+static _FORCE_INLINE_ bool _convert_ascii_case_block(String &r_str, int p_index, char32_t p_from, char32_t p_to, bool p_to_upper) {
+#if defined(USTRING_SSE2)
+	const __m128i v = _mm_loadu_si128((const __m128i *)(r_str.get_data() + p_index));
+	if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(~0x7f)), _mm_setzero_si128())) != 0xffff) {
+		return false;
+	}
+	// ASCII values are positive, so signed comparisons are fine here.
+	const __m128i letters = _mm_and_si128(_mm_cmpgt_epi32(v, _mm_set1_epi32(p_from - 1)), _mm_cmplt_epi32(v, _mm_set1_epi32(p_to + 1)));
+	if (_mm_movemask_epi8(letters)) {
+		const __m128i delta = _mm_and_si128(letters, _mm_set1_epi32('a' - 'A'));
+		_mm_storeu_si128((__m128i *)(r_str.ptrw() + p_index), p_to_upper ? _mm_sub_epi32(v, delta) : _mm_add_epi32(v, delta));
+	}
+	return true;
+#elif defined(USTRING_NEON)
+	const uint32x4_t v = vld1q_u32((const uint32_t *)(r_str.get_data() + p_index));
+	if (vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(vtstq_u32(v, vdupq_n_u32(~0x7fu)))), 0)) {
+		return false;
+	}
+	const uint32x4_t letters = vandq_u32(vcgeq_u32(v, vdupq_n_u32(p_from)), vcleq_u32(v, vdupq_n_u32(p_to)));
+	if (vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(letters)), 0)) {
+		const uint32x4_t delta = vandq_u32(letters, vdupq_n_u32('a' - 'A'));
+		vst1q_u32((uint32_t *)(r_str.ptrw() + p_index), p_to_upper ? vsubq_u32(v, delta) : vaddq_u32(v, delta));
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
 static _FORCE_INLINE_ char32_t lower_case(char32_t c) {
 	return (is_ascii_upper_case(c) ? (c + ('a' - 'A')) : c);
 }
@@ -1396,7 +1574,22 @@ char32_t String::char_lowercase(char32_t p_char) {
 String String::to_upper() const {
 	String upper = *this;
 
-	for (int i = 0; i < upper.size(); i++) {
+	const int len = upper.length();
+	int i = 0;
+	for (; i + 4 <= len; i += 4) {
+		if (_convert_ascii_case_block(upper, i, 'a', 'z', true)) {
+			continue;
+		}
+		for (int j = i; j < i + 4; j++) {
+			const char32_t s = upper[j];
+			const char32_t t = _find_upper(s);
+			if (s != t) { // avoid copy on write
+				upper[j] = t;
+			}
+		}
+	}
+
+	for (; i < len; i++) {
 		const char32_t s = upper[i];
 		const char32_t t = _find_upper(s);
 		if (s != t) { // avoid copy on write
@@ -1410,7 +1603,22 @@ String String::to_upper() const {
 String String::to_lower() const {
 	String lower = *this;
 
-	for (int i = 0; i < lower.size(); i++) {
+	const int len = lower.length();
+	int i = 0;
+	for (; i + 4 <= len; i += 4) {
+		if (_convert_ascii_case_block(lower, i, 'A', 'Z', false)) {
+			continue;
+		}
+		for (int j = i; j < i + 4; j++) {
+			const char32_t s = lower[j];
+			const char32_t t = _find_lower(s);
+			if (s != t) { // avoid copy on write
+				lower[j] = t;
+			}
+		}
+	}
+
+	for (; i < len; i++) {
 		const char32_t s = lower[i];
 		const char32_t t = _find_lower(s);
 		if (s != t) { // avoid copy on write
@@ -1725,6 +1933,11 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 		}
 	}
 
+	if (p_len < 0) {
+		// Knowing the length up front lets the ASCII fast path read whole blocks safely.
+		p_len = strlen(p_utf8);
+	}
+
 	bool decode_error = false;
 	bool decode_failed = false;
 	{
@@ -1735,6 +1948,16 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 		while (ptrtmp != ptrtmp_limit && *ptrtmp) {
 			uint8_t c = *ptrtmp >= 0 ? *ptrtmp : uint8_t(256 + *ptrtmp);
 
+			if (skip == 0 && c < 0x80) {
+				const int ascii = _utf8_ascii_prefix((const uint8_t *)ptrtmp, ptrtmp_limit - ptrtmp, p_skip_cr);
+				if (ascii) {
+					str_size += ascii;
+					cstr_size += ascii;
+					ptrtmp += ascii;
+					continue;
+				}
+			}
+
 			if (skip == 0) {
 				if (p_skip_cr && c == '\r') {
 					ptrtmp++;
@@ -1803,6 +2026,17 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 	while (cstr_size) {
 		uint8_t c = *p_utf8 >= 0 ? *p_utf8 : uint8_t(256 + *p_utf8);
 
+		if (skip == 0 && c < 0x80) {
+			const int ascii = _utf8_ascii_prefix((const uint8_t *)p_utf8, cstr_size, p_skip_cr);
+			if (ascii) {
+				_widen_ascii(dst, (const uint8_t *)p_utf8, ascii);
+				dst += ascii;
+				cstr_size -= ascii;
+				p_utf8 += ascii;
+				continue;
+			}
+		}
+
 		if (skip == 0) {
 			if (p_skip_cr && c == '\r') {
 				p_utf8++;
@@ -1886,6 +2120,12 @@ CharString String::utf8() const {
 	for (int i = 0; i < l; i++) {
 		uint32_t c = d[i];
 		if (c <= 0x7f) { // 7 bits.
+			const int ascii = _char32_ascii_prefix(d + i, l - i);
+			if (ascii) {
+				fl += ascii;
+				i += ascii - 1;
+				continue;
+			}
 			fl += 1;
 		} else if (c <= 0x7ff) { // 11 bits
 			fl += 2;
@@ -1919,6 +2159,13 @@ CharString String::utf8() const {
 		uint32_t c = d[i];
 
 		if (c <= 0x7f) { // 7 bits.
+			const int ascii = _char32_ascii_prefix(d + i, l - i);
+			if (ascii) {
+				_narrow_ascii(cdst, d + i, ascii);
+				cdst += ascii;
+				i += ascii - 1;
+				continue;
+			}
 			APPEND_CHAR(c);
 		} else if (c <= 0x7ff) { // 11 bits
 			APPEND_CHAR(uint32_t(0xc0 | ((c >> 6) & 0x1f))); // Top 5 bits.
@@ -2872,17 +3119,17 @@ int String::find(const String &p_str, int p_from) const {
 	const char32_t *src = get_data();
 	const char32_t *str = p_str.get_data();
 
-	for (int i = p_from; i <= (len - src_len); i++) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= len) {
-				ERR_PRINT("read_pos>=len");
-				return -1;
-			}
+	// Jump between occurrences of the first character, and only compare the rest there.
+	const int last = len - src_len;
+	for (int i = p_from; i <= last; i++) {
+		i = _find_char32(src, i, last + 1, str[0]);
+		if (i < 0) {
+			return -1;
+		}
 
-			if (src[read_pos] != str[j]) {
+		bool found = true;
+		for (int j = 1; j < src_len; j++) {
+			if (src[i + j] != str[j]) {
 				found = false;
 				break;
 			}
@@ -2914,35 +3161,29 @@ int String::find(const char *p_str, int p_from) const {
 		src_len++;
 	}
 
-	if (src_len == 1) {
-		const char32_t needle = p_str[0];
+	if (src_len == 0) {
+		return p_from <= len ? p_from : -1;
+	}
 
-		for (int i = p_from; i < len; i++) {
-			if (src[i] == needle) {
-				return i;
-			}
+	// Jump between occurrences of the first character, and only compare the rest there.
+	const char32_t first = (char32_t)p_str[0];
+	const int last = len - src_len;
+	for (int i = p_from; i <= last; i++) {
+		i = _find_char32(src, i, last + 1, first);
+		if (i < 0) {
+			return -1;
 		}
 
-	} else {
-		for (int i = p_from; i <= (len - src_len); i++) {
-			bool found = true;
-			for (int j = 0; j < src_len; j++) {
-				int read_pos = i + j;
-
-				if (read_pos >= len) {
-					ERR_PRINT("read_pos>=len");
-					return -1;
-				}
-
-				if (src[read_pos] != (char32_t)p_str[j]) {
-					found = false;
-					break;
-				}
+		bool found = true;
+		for (int j = 1; j < src_len; j++) {
+			if (src[i + j] != (char32_t)p_str[j]) {
+				found = false;
+				break;
 			}
+		}
 
-			if (found) {
-				return i;
-			}
+		if (found) {
+			return i;
 		}
 	}
 
@@ -336,19 +336,25 @@ class CommandQueueMT {
 		SYNC_SEMAPHORES = 8
 	};
 
-	LocalVector<uint8_t> command_mem;
+	// Commands are written into one buffer while the other is being executed,
+	// so producers only contend on the mutex for the duration of a push.
+	LocalVector<uint8_t> command_mem[2];
+	uint32_t write_buffer = 0;
+	bool flushing = false;
 	SyncSemaphore sync_sems[SYNC_SEMAPHORES];
 	Mutex mutex;
+	Mutex flush_mutex;
 	Semaphore *sync = nullptr;
 
 	template <class T>
 	T *allocate() {
 		// alloc size is size+T+safeguard
 		uint32_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1));
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + 8);
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		T *cmd = memnew_placement(&command_mem[size + 8], T);
+		LocalVector<uint8_t> &mem = command_mem[write_buffer];
+		uint64_t size = mem.size();
+		mem.resize(size + alloc_size + 8);
+		*(uint64_t *)&mem[size] = alloc_size;
+		T *cmd = memnew_placement(&mem[size + 8], T);
 		return cmd;
 	}
 
@@ -360,15 +366,28 @@ class CommandQueueMT {
 	}
 
 	void _flush() {
+		// Serializes flushes coming from different threads. The mutex is recursive,
+		// so a command that flushes the queue again from the flushing thread is caught
+		// by the flushing flag instead.
+		MutexLock flush_lock(flush_mutex);
+		if (flushing) {
+			return;
+		}
+
 		lock();
+		LocalVector<uint8_t> &mem = command_mem[write_buffer];
+		write_buffer = 1 - write_buffer;
+		flushing = true;
+		unlock();
 
+		// Executed without holding the queue lock, new commands go to the other buffer.
 		uint64_t read_ptr = 0;
-		uint64_t limit = command_mem.size();
+		uint64_t limit = mem.size();
 
 		while (read_ptr < limit) {
-			uint64_t size = *(uint64_t *)&command_mem[read_ptr];
+			uint64_t size = *(uint64_t *)&mem[read_ptr];
 			read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[read_ptr]);
+			CommandBase *cmd = reinterpret_cast<CommandBase *>(&mem[read_ptr]);
 
 			cmd->call(); //execute the function
 			cmd->post(); //release in case it needs sync/ret
@@ -377,7 +396,10 @@ class CommandQueueMT {
 			read_ptr += size;
 		}
 
-		command_mem.clear();
+		mem.clear(); // Keeps the capacity for the next swap.
+
+		lock();
+		flushing = false;
 		unlock();
 	}
 
@@ -400,7 +422,7 @@ public:
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
 
 	_FORCE_INLINE_ void flush_if_pending() {
-		if (unlikely(command_mem.size() > 0)) {
+		if (unlikely(command_mem[write_buffer].size() > 0)) {
 			_flush();
 		}
 	}
@@ -41,6 +41,8 @@
 #include "core/templates/safe_refcount.h"
 
 #include <stdio.h>
+#include <atomic>
+#include <type_traits>
 #include <typeinfo>
 
 class RID_AllocBase {
@@ -69,61 +71,107 @@ public:
 
 template <class T, bool THREAD_SAFE = false>
 class RID_Alloc : public RID_AllocBase {
-	T **chunks = nullptr;
+	// Chunks never move once allocated, only the tables pointing to them grow. When a table
+	// is replaced by a bigger one the old one is kept until destruction, so in THREAD_SAFE
+	// allocators get_or_null() and owns() can run without locking: they validate the RID
+	// against whichever table they loaded, and only allocation and freeing take the lock.
+	std::atomic<T **> chunks = { nullptr };
+	std::atomic<std::atomic<uint32_t> **> validator_chunks = { nullptr };
 	uint32_t **free_list_chunks = nullptr;
-	uint32_t **validator_chunks = nullptr;
+
+	void **retired_tables = nullptr;
+	uint32_t retired_table_count = 0;
+	uint32_t table_capacity = 0;
 
 	uint32_t elements_in_chunk;
-	uint32_t max_alloc = 0;
+	std::atomic<uint32_t> max_alloc = { 0 };
 	uint32_t alloc_count = 0;
 
 	const char *description = nullptr;
 
 	mutable SpinLock spin_lock;
 
+	static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+	static_assert(std::is_trivially_destructible<std::atomic<uint32_t>>::value);
+
+	// Non thread-safe allocators don't need any ordering, so they don't pay for it on weakly ordered CPUs.
+	static constexpr std::memory_order ACQUIRE = THREAD_SAFE ? std::memory_order_acquire : std::memory_order_relaxed;
+	static constexpr std::memory_order RELEASE = THREAD_SAFE ? std::memory_order_release : std::memory_order_relaxed;
+
+	void _retire_table(void *p_table) {
+		retired_tables = (void **)memrealloc(retired_tables, sizeof(void *) * (retired_table_count + 1));
+		retired_tables[retired_table_count++] = p_table;
+	}
+
+	_FORCE_INLINE_ std::atomic<uint32_t> *_get_validator(uint64_t p_id) const {
+		uint32_t idx = uint32_t(p_id & 0xFFFFFFFF);
+		if (unlikely(idx >= max_alloc.load(ACQUIRE))) {
+			return nullptr;
+		}
+		return &validator_chunks.load(ACQUIRE)[idx / elements_in_chunk][idx % elements_in_chunk];
+	}
+
+	_FORCE_INLINE_ T *_get_element(uint64_t p_id) const {
+		uint32_t idx = uint32_t(p_id & 0xFFFFFFFF);
+		return &chunks.load(ACQUIRE)[idx / elements_in_chunk][idx % elements_in_chunk];
+	}
+
 	_FORCE_INLINE_ RID _allocate_rid() {
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
 
-		if (alloc_count == max_alloc) {
+		uint32_t current_max_alloc = max_alloc.load(std::memory_order_relaxed);
+		if (alloc_count == current_max_alloc) {
 			//allocate a new chunk
-			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
+			uint32_t chunk_count = current_max_alloc / elements_in_chunk;
+			T **chunk_table = chunks.load(std::memory_order_relaxed);
+			std::atomic<uint32_t> **validator_table = validator_chunks.load(std::memory_order_relaxed);
+
+			if (chunk_count == table_capacity) {
+				//grow tables, readers may still be using the old ones
+				uint32_t new_capacity = table_capacity == 0 ? 1 : table_capacity * 2;
+
+				T **new_chunk_table = (T **)memalloc(sizeof(T *) * new_capacity);
+				std::atomic<uint32_t> **new_validator_table = (std::atomic<uint32_t> **)memalloc(sizeof(std::atomic<uint32_t> *) * new_capacity);
+				if (chunk_count) {
+					memcpy(new_chunk_table, chunk_table, sizeof(T *) * chunk_count);
+					memcpy(new_validator_table, validator_table, sizeof(std::atomic<uint32_t> *) * chunk_count);
+					_retire_table(chunk_table);
+					_retire_table(validator_table);
+				}
+				chunk_table = new_chunk_table;
+				validator_table = new_validator_table;
 
-			//grow chunks
-			chunks = (T **)memrealloc(chunks, sizeof(T *) * (chunk_count + 1));
-			chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
+				free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * new_capacity);
+				table_capacity = new_capacity;
+			}
 
-			//grow validators
-			validator_chunks = (uint32_t **)memrealloc(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			validator_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
-			//grow free lists
-			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
+			chunk_table[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
+			validator_table[chunk_count] = (std::atomic<uint32_t> *)memalloc(sizeof(std::atomic<uint32_t>) * elements_in_chunk);
 			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
 
 			//initialize
 			for (uint32_t i = 0; i < elements_in_chunk; i++) {
 				// Don't initialize chunk.
-				validator_chunks[chunk_count][i] = 0xFFFFFFFF;
+				validator_table[chunk_count][i].store(0xFFFFFFFF, std::memory_order_relaxed);
 				free_list_chunks[chunk_count][i] = alloc_count + i;
 			}
 
-			max_alloc += elements_in_chunk;
+			// Publish the tables before the new size, so a reader seeing the size also sees the chunk.
+			chunks.store(chunk_table, RELEASE);
+			validator_chunks.store(validator_table, RELEASE);
+			max_alloc.store(current_max_alloc + elements_in_chunk, RELEASE);
 		}
 
 		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
 
-		uint32_t free_chunk = free_index / elements_in_chunk;
-		uint32_t free_element = free_index % elements_in_chunk;
-
 		uint32_t validator = (uint32_t)(_gen_id() & 0x7FFFFFFF);
 		uint64_t id = validator;
 		id <<= 32;
 		id |= free_index;
 
-		validator_chunks[free_chunk][free_element] = validator;
-
-		validator_chunks[free_chunk][free_element] |= 0x80000000; //mark uninitialized bit
+		_get_validator(id)->store(validator | 0x80000000, RELEASE); //mark uninitialized bit
 
 		alloc_count++;
 
@@ -134,6 +182,29 @@ class RID_Alloc : public RID_AllocBase {
 		return _make_from_id(id);
 	}
 
+	// Returns the memory of an allocated but not yet initialized RID, which is then
+	// constructed in place before _mark_initialized() makes it visible to get_or_null().
+	_FORCE_INLINE_ T *_get_uninitialized(const RID &p_rid) {
+		uint64_t id = p_rid.get_id();
+		std::atomic<uint32_t> *slot = _get_validator(id);
+		ERR_FAIL_COND_V(!slot, nullptr);
+
+		uint32_t current = slot->load(ACQUIRE);
+		uint32_t validator = uint32_t(id >> 32);
+		if (unlikely(!(current & 0x80000000))) {
+			ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
+		}
+		if (unlikely((current & 0x7FFFFFFF) != validator)) {
+			ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
+		}
+		return _get_element(id);
+	}
+
+	_FORCE_INLINE_ void _mark_initialized(const RID &p_rid) {
+		uint64_t id = p_rid.get_id();
+		_get_validator(id)->store(uint32_t(id >> 32), RELEASE);
+	}
+
 public:
 	RID make_rid() {
 		RID rid = _allocate_rid();
@@ -151,101 +222,47 @@ public:
 		return _allocate_rid();
 	}
 
-	_FORCE_INLINE_ T *get_or_null(const RID &p_rid, bool p_initialize = false) {
+	_FORCE_INLINE_ T *get_or_null(const RID &p_rid) const {
 		if (p_rid == RID()) {
 			return nullptr;
 		}
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
 
 		uint64_t id = p_rid.get_id();
-		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		std::atomic<uint32_t> *slot = _get_validator(id);
+		if (unlikely(!slot)) {
 			return nullptr;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
-		uint32_t validator = uint32_t(id >> 32);
-
-		if (unlikely(p_initialize)) {
-			if (unlikely(!(validator_chunks[idx_chunk][idx_element] & 0x80000000))) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
-			}
-
-			if (unlikely((validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) != validator)) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
-				return nullptr;
-			}
-
-			validator_chunks[idx_chunk][idx_element] &= 0x7FFFFFFF; //initialized
-
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
-			if ((validator_chunks[idx_chunk][idx_element] & 0x80000000) && validator_chunks[idx_chunk][idx_element] != 0xFFFFFFFF) {
+		uint32_t current = slot->load(ACQUIRE);
+		if (unlikely(current != uint32_t(id >> 32))) {
+			if ((current & 0x80000000) && current != 0xFFFFFFFF) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
 		}
 
-		T *ptr = &chunks[idx_chunk][idx_element];
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return ptr;
+		return _get_element(id);
 	}
 	void initialize_rid(RID p_rid) {
-		T *mem = get_or_null(p_rid, true);
+		T *mem = _get_uninitialized(p_rid);
 		ERR_FAIL_COND(!mem);
 		memnew_placement(mem, T);
+		_mark_initialized(p_rid);
 	}
 	void initialize_rid(RID p_rid, const T &p_value) {
-		T *mem = get_or_null(p_rid, true);
+		T *mem = _get_uninitialized(p_rid);
 		ERR_FAIL_COND(!mem);
 		memnew_placement(mem, T(p_value));
+		_mark_initialized(p_rid);
 	}
 
 	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
-		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		std::atomic<uint32_t> *slot = _get_validator(id);
+		if (unlikely(!slot)) {
 			return false;
 		}
-
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
-		uint32_t validator = uint32_t(id >> 32);
-
-		bool owned = (validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) == validator;
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return owned;
+		return (slot->load(ACQUIRE) & 0x7FFFFFFF) == uint32_t(id >> 32);
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
@@ -254,35 +271,33 @@ public:
 		}
 
 		uint64_t id = p_rid.get_id();
-		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
+		std::atomic<uint32_t> *slot = _get_validator(id);
+		if (unlikely(!slot)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL();
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
-		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(validator_chunks[idx_chunk][idx_element] & 0x80000000)) {
+		uint32_t current = slot->load(std::memory_order_relaxed);
+		if (unlikely(current & 0x80000000)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID");
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
+		} else if (unlikely(current != uint32_t(id >> 32))) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL();
 		}
 
-		chunks[idx_chunk][idx_element].~T();
-		validator_chunks[idx_chunk][idx_element] = 0xFFFFFFFF; // go invalid
+		// Invalidate before destroying, so lock-free readers stop handing out the element.
+		slot->store(0xFFFFFFFF, RELEASE); // go invalid
+		_get_element(id)->~T();
 
 		alloc_count--;
-		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
+		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = uint32_t(id & 0xFFFFFFFF);
 
 		if (THREAD_SAFE) {
 			spin_lock.unlock();
@@ -296,8 +311,10 @@ public:
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+		uint32_t current_max_alloc = max_alloc.load(std::memory_order_relaxed);
+		std::atomic<uint32_t> **validator_table = validator_chunks.load(std::memory_order_relaxed);
+		for (size_t i = 0; i < current_max_alloc; i++) {
+			uint64_t validator = validator_table[i / elements_in_chunk][i % elements_in_chunk].load(std::memory_order_relaxed);
 			if (validator != 0xFFFFFFFF) {
 				p_owned->push_back(_make_from_id((validator << 32) | i));
 			}
@@ -313,8 +330,10 @@ public:
 			spin_lock.lock();
 		}
 		uint32_t idx = 0;
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+		uint32_t current_max_alloc = max_alloc.load(std::memory_order_relaxed);
+		std::atomic<uint32_t> **validator_table = validator_chunks.load(std::memory_order_relaxed);
+		for (size_t i = 0; i < current_max_alloc; i++) {
+			uint64_t validator = validator_table[i / elements_in_chunk][i % elements_in_chunk].load(std::memory_order_relaxed);
 			if (validator != 0xFFFFFFFF) {
 				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
 				idx++;
@@ -334,32 +353,41 @@ public:
 	}
 
 	~RID_Alloc() {
+		uint32_t current_max_alloc = max_alloc.load(std::memory_order_acquire);
+		T **chunk_table = chunks.load(std::memory_order_acquire);
+		std::atomic<uint32_t> **validator_table = validator_chunks.load(std::memory_order_acquire);
+
 		if (alloc_count) {
 			print_error(vformat("ERROR: %d RID allocations of type '%s' were leaked at exit.",
 					alloc_count, description ? description : typeid(T).name()));
 
-			for (size_t i = 0; i < max_alloc; i++) {
-				uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+			for (size_t i = 0; i < current_max_alloc; i++) {
+				uint32_t validator = validator_table[i / elements_in_chunk][i % elements_in_chunk].load(std::memory_order_relaxed);
 				if (validator & 0x80000000) {
 					continue; //uninitialized
 				}
-				if (validator != 0xFFFFFFFF) {
-					chunks[i / elements_in_chunk][i % elements_in_chunk].~T();
-				}
+				chunk_table[i / elements_in_chunk][i % elements_in_chunk].~T();
 			}
 		}
 
-		uint32_t chunk_count = max_alloc / elements_in_chunk;
+		uint32_t chunk_count = current_max_alloc / elements_in_chunk;
 		for (uint32_t i = 0; i < chunk_count; i++) {
-			memfree(chunks[i]);
-			memfree(validator_chunks[i]);
+			memfree(chunk_table[i]);
+			memfree(validator_table[i]);
 			memfree(free_list_chunks[i]);
 		}
 
-		if (chunks) {
-			memfree(chunks);
+		if (chunk_table) {
+			memfree(chunk_table);
 			memfree(free_list_chunks);
-			memfree(validator_chunks);
+			memfree(validator_table);
+		}
+
+		for (uint32_t i = 0; i < retired_table_count; i++) {
+			memfree(retired_tables[i]);
+		}
+		if (retired_tables) {
+			memfree(retired_tables);
 		}
 	}
 };
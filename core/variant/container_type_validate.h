@@ -74,6 +74,11 @@ struct ContainerTypeValidate {
 		return true;
 	}
 
+	// True when the value can be stored as is, so callers can skip the copy made for validate().
+	_FORCE_INLINE_ bool accepts_unchanged(const Variant &p_variant) const {
+		return type == Variant::NIL || (type == p_variant.get_type() && type != Variant::OBJECT);
+	}
+
 	// Coerces String and StringName into each other when needed.
 	_FORCE_INLINE_ bool validate(Variant &inout_variant, const char *p_operation = "use") {
 		if (type == Variant::NIL) {
@@ -35,6 +35,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/io/compression.h"
 #include "core/io/marshalls.h"
+#include "core/math/packed_array_math.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
 #include "core/templates/local_vector.h"
@@ -1004,6 +1005,115 @@ struct _VariantCall {
 		return len;
 	}
 
+	// The packed math methods process vector arrays as flat arrays of components.
+	static float *_packed_write(PackedFloat32Array &p_array) { return p_array.ptrw(); }
+	static double *_packed_write(PackedFloat64Array &p_array) { return p_array.ptrw(); }
+	static real_t *_packed_write(PackedVector2Array &p_array) { return (real_t *)p_array.ptrw(); }
+	static real_t *_packed_write(PackedVector3Array &p_array) { return (real_t *)p_array.ptrw(); }
+	static const float *_packed_read(const PackedFloat32Array &p_array) { return p_array.ptr(); }
+	static const double *_packed_read(const PackedFloat64Array &p_array) { return p_array.ptr(); }
+	static const real_t *_packed_read(const PackedVector2Array &p_array) { return (const real_t *)p_array.ptr(); }
+	static const real_t *_packed_read(const PackedVector3Array &p_array) { return (const real_t *)p_array.ptr(); }
+	template <class T>
+	static int64_t _packed_component_count(const T &p_array) { return p_array.size() * (sizeof(p_array[0]) / sizeof(*_packed_read(p_array))); }
+
+	template <class T>
+	static void func_Packed_add(T *p_instance, const T &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		PackedArrayMath::add(_packed_write(*p_instance), _packed_read(p_array), _packed_component_count(p_array));
+	}
+
+	template <class T>
+	static void func_Packed_mul(T *p_instance, const T &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		PackedArrayMath::mul(_packed_write(*p_instance), _packed_read(p_array), _packed_component_count(p_array));
+	}
+
+	template <class T>
+	static void func_Packed_scale(T *p_instance, double p_factor) {
+		PackedArrayMath::scale(_packed_write(*p_instance), p_factor, _packed_component_count(*p_instance));
+	}
+
+	template <class T>
+	static void func_Packed_lerp(T *p_instance, const T &p_to, double p_weight) {
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "Both arrays must have the same size.");
+		PackedArrayMath::lerp(_packed_write(*p_instance), _packed_read(p_to), p_weight, _packed_component_count(p_to));
+	}
+
+	template <class T>
+	static void func_Packed_clamp(T *p_instance, double p_min, double p_max) {
+		PackedArrayMath::clamp(_packed_write(*p_instance), p_min, p_max, _packed_component_count(*p_instance));
+	}
+
+	template <class T>
+	static double func_Packed_dot(T *p_instance, const T &p_array) {
+		ERR_FAIL_COND_V_MSG(p_array.size() != p_instance->size(), 0.0, "Both arrays must have the same size.");
+		return PackedArrayMath::dot(_packed_read(*p_instance), _packed_read(p_array), _packed_component_count(p_array));
+	}
+
+	template <class T>
+	static double func_Packed_sum(T *p_instance) {
+		return PackedArrayMath::sum(_packed_read(*p_instance), _packed_component_count(*p_instance));
+	}
+
+	template <class T>
+	static double func_Packed_min(T *p_instance) {
+		ERR_FAIL_COND_V_MSG(p_instance->is_empty(), 0.0, "Can't get the minimum of an empty array.");
+		return PackedArrayMath::min(_packed_read(*p_instance), p_instance->size());
+	}
+
+	template <class T>
+	static double func_Packed_max(T *p_instance) {
+		ERR_FAIL_COND_V_MSG(p_instance->is_empty(), 0.0, "Can't get the maximum of an empty array.");
+		return PackedArrayMath::max(_packed_read(*p_instance), p_instance->size());
+	}
+
+	static void func_PackedVector2Array_clamp(PackedVector2Array *p_instance, const Vector2 &p_min, const Vector2 &p_max) {
+		Vector2 *w = p_instance->ptrw();
+		for (int64_t i = 0; i < p_instance->size(); i++) {
+			w[i] = w[i].clamp(p_min, p_max);
+		}
+	}
+
+	static Vector2 func_PackedVector2Array_sum(PackedVector2Array *p_instance) {
+		const Vector2 *r = p_instance->ptr();
+		Vector2 sum;
+		for (int64_t i = 0; i < p_instance->size(); i++) {
+			sum += r[i];
+		}
+		return sum;
+	}
+
+	static void func_PackedVector2Array_transform_by(PackedVector2Array *p_instance, const Transform2D &p_transform) {
+		Vector2 *w = p_instance->ptrw();
+		for (int64_t i = 0; i < p_instance->size(); i++) {
+			w[i] = p_transform.xform(w[i]);
+		}
+	}
+
+	static void func_PackedVector3Array_clamp(PackedVector3Array *p_instance, const Vector3 &p_min, const Vector3 &p_max) {
+		Vector3 *w = p_instance->ptrw();
+		for (int64_t i = 0; i < p_instance->size(); i++) {
+			w[i] = w[i].clamp(p_min, p_max);
+		}
+	}
+
+	static Vector3 func_PackedVector3Array_sum(PackedVector3Array *p_instance) {
+		const Vector3 *r = p_instance->ptr();
+		Vector3 sum;
+		for (int64_t i = 0; i < p_instance->size(); i++) {
+			sum += r[i];
+		}
+		return sum;
+	}
+
+	static void func_PackedVector3Array_transform_by(PackedVector3Array *p_instance, const Transform3D &p_transform) {
+		Vector3 *w = p_instance->ptrw();
+		for (int64_t i = 0; i < p_instance->size(); i++) {
+			w[i] = p_transform.xform(w[i]);
+		}
+	}
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = VariantGetInternalPtr<Callable>::get_ptr(v);
 		callable->callp(p_args, p_argcount, r_ret, r_error);
@@ -2361,6 +2471,15 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat32Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, add, _VariantCall::func_Packed_add<PackedFloat32Array>, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, mul, _VariantCall::func_Packed_mul<PackedFloat32Array>, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, scale, _VariantCall::func_Packed_scale<PackedFloat32Array>, sarray("factor"), varray());
+	bind_functionnc(PackedFloat32Array, lerp, _VariantCall::func_Packed_lerp<PackedFloat32Array>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedFloat32Array, clamp, _VariantCall::func_Packed_clamp<PackedFloat32Array>, sarray("min", "max"), varray());
+	bind_function(PackedFloat32Array, dot, _VariantCall::func_Packed_dot<PackedFloat32Array>, sarray("array"), varray());
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_Packed_sum<PackedFloat32Array>, sarray(), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_Packed_min<PackedFloat32Array>, sarray(), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_Packed_max<PackedFloat32Array>, sarray(), varray());
 
 	/* Float64 Array */
 
@@ -2385,6 +2504,15 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat64Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedFloat64Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
+	bind_functionnc(PackedFloat64Array, add, _VariantCall::func_Packed_add<PackedFloat64Array>, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, mul, _VariantCall::func_Packed_mul<PackedFloat64Array>, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, scale, _VariantCall::func_Packed_scale<PackedFloat64Array>, sarray("factor"), varray());
+	bind_functionnc(PackedFloat64Array, lerp, _VariantCall::func_Packed_lerp<PackedFloat64Array>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedFloat64Array, clamp, _VariantCall::func_Packed_clamp<PackedFloat64Array>, sarray("min", "max"), varray());
+	bind_function(PackedFloat64Array, dot, _VariantCall::func_Packed_dot<PackedFloat64Array>, sarray("array"), varray());
+	bind_function(PackedFloat64Array, sum, _VariantCall::func_Packed_sum<PackedFloat64Array>, sarray(), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_Packed_min<PackedFloat64Array>, sarray(), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_Packed_max<PackedFloat64Array>, sarray(), varray());
 
 	/* String Array */
 
@@ -2433,6 +2561,13 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector2Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedVector2Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector2Array, count, sarray("value"), varray());
+	bind_functionnc(PackedVector2Array, add, _VariantCall::func_Packed_add<PackedVector2Array>, sarray("array"), varray());
+	bind_functionnc(PackedVector2Array, mul, _VariantCall::func_Packed_mul<PackedVector2Array>, sarray("array"), varray());
+	bind_functionnc(PackedVector2Array, scale, _VariantCall::func_Packed_scale<PackedVector2Array>, sarray("factor"), varray());
+	bind_functionnc(PackedVector2Array, lerp, _VariantCall::func_Packed_lerp<PackedVector2Array>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedVector2Array, clamp, _VariantCall::func_PackedVector2Array_clamp, sarray("min", "max"), varray());
+	bind_function(PackedVector2Array, sum, _VariantCall::func_PackedVector2Array_sum, sarray(), varray());
+	bind_functionnc(PackedVector2Array, transform_by, _VariantCall::func_PackedVector2Array_transform_by, sarray("transform"), varray());
 
 	/* Vector3 Array */
 
@@ -2457,6 +2592,13 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector3Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
+	bind_functionnc(PackedVector3Array, add, _VariantCall::func_Packed_add<PackedVector3Array>, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, mul, _VariantCall::func_Packed_mul<PackedVector3Array>, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, scale, _VariantCall::func_Packed_scale<PackedVector3Array>, sarray("factor"), varray());
+	bind_functionnc(PackedVector3Array, lerp, _VariantCall::func_Packed_lerp<PackedVector3Array>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedVector3Array, clamp, _VariantCall::func_PackedVector3Array_clamp, sarray("min", "max"), varray());
+	bind_function(PackedVector3Array, sum, _VariantCall::func_PackedVector3Array_sum, sarray(), varray());
+	bind_functionnc(PackedVector3Array, transform_by, _VariantCall::func_PackedVector3Array_transform_by, sarray("transform"), varray());
 
 	/* Color Array */
 
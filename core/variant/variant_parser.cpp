@@ -34,13 +34,9 @@
 #include "core/io/resource_loader.h"
 #include "core/os/keyboard.h"
 #include "core/string/string_buffer.h"
+#include "core/templates/local_vector.h"
 
-char32_t VariantParser::Stream::get_char() {
-	// is within buffer?
-	if (readahead_pointer < readahead_filled) {
-		return readahead_buffer[readahead_pointer++];
-	}
-
+char32_t VariantParser::Stream::_refill_and_get_char() {
 	// attempt to readahead
 	readahead_filled = _read_buffer(readahead_buffer, READAHEAD_SIZE);
 	if (readahead_filled) {
@@ -51,7 +47,7 @@ char32_t VariantParser::Stream::get_char() {
 		eof = true;
 		return 0;
 	}
-	return get_char();
+	return readahead_buffer[readahead_pointer++];
 }
 
 bool VariantParser::StreamFile::is_utf8() const {
@@ -407,16 +403,25 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 #define READING_DONE 4
 					int reading = READING_INT;
 
+					bool negative = false;
 					if (cchar == '-') {
 						num += '-';
+						negative = true;
 						cchar = p_stream->get_char();
 					}
 
 					char32_t c = cchar;
 					bool exp_sign = false;
 					bool exp_beg = false;
+					bool exp_negative = false;
 					bool is_float = false;
 
+					// The value is accumulated while reading, so most numbers don't need the generic string conversion.
+					uint64_t mantissa = 0;
+					int significant_digits = 0;
+					int decimal_digits = 0;
+					int exponent = 0;
+
 					while (true) {
 						switch (reading) {
 							case READING_INT: {
@@ -435,6 +440,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							} break;
 							case READING_DEC: {
 								if (is_digit(c)) {
+									decimal_digits++;
 								} else if (c == 'e') {
 									reading = READING_EXP;
 								} else {
@@ -445,9 +451,13 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							case READING_EXP: {
 								if (is_digit(c)) {
 									exp_beg = true;
+									if (exponent < 10000) {
+										exponent = exponent * 10 + (c - '0');
+									}
 
 								} else if ((c == '-' || c == '+') && !exp_sign && !exp_beg) {
 									exp_sign = true;
+									exp_negative = c == '-';
 
 								} else {
 									reading = READING_DONE;
@@ -458,6 +468,15 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 						if (reading == READING_DONE) {
 							break;
 						}
+						if (reading != READING_EXP && is_digit(c)) {
+							// Leading zeros aren't significant.
+							if (mantissa || c != '0') {
+								significant_digits++;
+							}
+							if (significant_digits <= 19) {
+								mantissa = mantissa * 10 + (c - '0');
+							}
+						}
 						num += c;
 						c = p_stream->get_char();
 					}
@@ -467,9 +486,22 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					r_token.type = TK_NUMBER;
 
 					if (is_float) {
-						r_token.value = num.as_double();
+						// Exact when both the mantissa and the power of ten fit in a double's 53 bits (Clinger's fast path).
+						static const double powers_of_ten[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+						const int power = (exp_negative ? -exponent : exponent) - decimal_digits;
+						if (significant_digits <= 15 && power >= -22 && power <= 22) {
+							double value = double(mantissa);
+							value = power < 0 ? value / powers_of_ten[-power] : value * powers_of_ten[power];
+							r_token.value = negative ? -value : value;
+						} else {
+							r_token.value = num.as_double();
+						}
 					} else {
-						r_token.value = num.as_int();
+						if (significant_digits <= 18) {
+							r_token.value = negative ? -int64_t(mantissa) : int64_t(mantissa);
+						} else {
+							r_token.value = num.as_int();
+						}
 					}
 					return OK;
 				} else if (is_ascii_char(cchar) || is_underscore(cchar)) {
@@ -539,6 +571,8 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 		return ERR_PARSE_ERROR;
 	}
 
+	// Packed arrays can hold millions of values, so collect them without copy-on-write checks on every element.
+	LocalVector<T> values;
 	bool first = true;
 	while (true) {
 		if (!first) {
@@ -572,10 +606,15 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 			}
 		}
 
-		r_construct.push_back(token.value);
+		values.push_back(token.value);
 		first = false;
 	}
 
+	r_construct.resize(values.size());
+	if (values.size()) {
+		memcpy(r_construct.ptrw(), values.ptr(), values.size() * sizeof(T));
+	}
+
 	return OK;
 }
 
@@ -1018,17 +1057,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<uint8_t> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				uint8_t *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt32Array" || id == "PackedIntArray" || id == "PoolIntArray" || id == "IntArray") {
 			Vector<int32_t> args;
 			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
@@ -1036,17 +1065,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int32_t> arr;
-			{
-				int32_t len = args.size();
-				arr.resize(len);
-				int32_t *w = arr.ptrw();
-				for (int32_t i = 0; i < len; i++) {
-					w[i] = int32_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt64Array") {
 			Vector<int64_t> args;
 			Error err = _parse_construct<int64_t>(p_stream, args, line, r_err_str);
@@ -1054,17 +1073,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int64_t> arr;
-			{
-				int64_t len = args.size();
-				arr.resize(len);
-				int64_t *w = arr.ptrw();
-				for (int64_t i = 0; i < len; i++) {
-					w[i] = int64_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat32Array" || id == "PackedRealArray" || id == "PoolRealArray" || id == "FloatArray") {
 			Vector<float> args;
 			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
@@ -1072,17 +1081,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<float> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				float *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat64Array") {
 			Vector<double> args;
 			Error err = _parse_construct<double>(p_stream, args, line, r_err_str);
@@ -1090,17 +1089,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<double> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				double *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedStringArray" || id == "PoolStringArray" || id == "StringArray") {
 			get_token(p_stream, token, line, r_err_str);
 			if (token.type != TK_PARENTHESIS_OPEN) {
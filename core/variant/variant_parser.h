@@ -48,10 +48,18 @@ public:
 	protected:
 		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) = 0;
 
+		char32_t _refill_and_get_char();
+
 	public:
 		char32_t saved = 0;
 
-		char32_t get_char();
+		// Only refilling the readahead buffer goes through the virtual _read_buffer(), reading from it is inlined.
+		_FORCE_INLINE_ char32_t get_char() {
+			if (likely(readahead_pointer < readahead_filled)) {
+				return readahead_buffer[readahead_pointer++];
+			}
+			return _refill_and_get_char();
+		}
 		virtual bool is_utf8() const = 0;
 		bool is_eof() const { return eof; }
 
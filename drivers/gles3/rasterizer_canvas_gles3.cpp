@@ -689,9 +689,6 @@ void RasterizerCanvasGLES3::_render_items(RID p_to_render_target, int p_item_cou
 					} else {
 						glBlendFuncSeparate(GL_CONSTANT_COLOR, GL_ONE_MINUS_SRC_COLOR, GL_ZERO, GL_ONE);
 					}
-					Color blend_color = state.canvas_instance_batches[state.current_batch_index].blend_color;
-					glBlendColor(blend_color.r, blend_color.g, blend_color.b, blend_color.a);
-
 				} break;
 				case GLES3::CanvasShaderData::BLEND_MODE_MIX: {
 					glBlendEquation(GL_FUNC_ADD);
@@ -741,6 +738,12 @@ void RasterizerCanvasGLES3::_render_items(RID p_to_render_target, int p_item_cou
 			last_blend_mode = blend_mode;
 		}
 
+		if (blend_mode == GLES3::CanvasShaderData::BLEND_MODE_LCD) {
+			// Consecutive LCD batches differ by their blend color.
+			const Color &blend_color = state.canvas_instance_batches[i].blend_color;
+			glBlendColor(blend_color.r, blend_color.g, blend_color.b, blend_color.a);
+		}
+
 		_render_batch(p_lights, i);
 	}
 
@@ -1019,7 +1022,38 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 			case Item::Command::TYPE_POLYGON: {
 				const Item::CommandPolygon *polygon = static_cast<const Item::CommandPolygon *>(c);
 
-				// Polygon's can't be batched, so always create a new batch
+				const PolygonBuffers *pb = polygon_buffers.polygons.getptr(polygon->polygon.polygon_id);
+				if (pb && polygon->primitive == RS::PRIMITIVE_TRIANGLES && pb->triangle_points.size()) {
+					// Small polygons are drawn as primitive triangles, so they join the instanced batches.
+					if (state.canvas_instance_batches[state.current_batch_index].primitive_points != 3 || state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_PRIMITIVE || polygon->texture != state.canvas_instance_batches[state.current_batch_index].tex) {
+						_new_batch(r_batch_broken, r_index);
+						state.canvas_instance_batches[state.current_batch_index].tex = polygon->texture;
+						state.canvas_instance_batches[state.current_batch_index].primitive_points = 3;
+						state.canvas_instance_batches[state.current_batch_index].command_type = Item::Command::TYPE_PRIMITIVE;
+						state.canvas_instance_batches[state.current_batch_index].command = c;
+						state.canvas_instance_batches[state.current_batch_index].shader_variant = CanvasShaderGLES3::MODE_PRIMITIVE;
+					}
+
+					_prepare_canvas_texture(polygon->texture, state.canvas_instance_batches[state.current_batch_index].filter, state.canvas_instance_batches[state.current_batch_index].repeat, r_index, texpixel_size);
+
+					const InstanceData base_instance = state.instance_data_array[r_index];
+					for (uint32_t j = 0; j < pb->triangle_points.size(); j += 3) {
+						state.instance_data_array[r_index] = base_instance;
+						for (uint32_t k = 0; k < 3; k++) {
+							state.instance_data_array[r_index].points[k * 2 + 0] = pb->triangle_points[j + k].x;
+							state.instance_data_array[r_index].points[k * 2 + 1] = pb->triangle_points[j + k].y;
+							state.instance_data_array[r_index].uvs[k * 2 + 0] = pb->triangle_uvs[j + k].x;
+							state.instance_data_array[r_index].uvs[k * 2 + 1] = pb->triangle_uvs[j + k].y;
+							Color col = pb->triangle_colors[j + k] * base_color;
+							state.instance_data_array[r_index].colors[k * 2 + 0] = (uint32_t(Math::make_half_float(col.g)) << 16) | Math::make_half_float(col.r);
+							state.instance_data_array[r_index].colors[k * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
+						}
+						_add_to_batch(r_index, r_batch_broken);
+					}
+					break;
+				}
+
+				// Other polygons can't be batched, so always create a new batch
 				_new_batch(r_batch_broken, r_index);
 
 				state.canvas_instance_batches[state.current_batch_index].tex = polygon->texture;
@@ -1046,7 +1080,7 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 			case Item::Command::TYPE_PRIMITIVE: {
 				const Item::CommandPrimitive *primitive = static_cast<const Item::CommandPrimitive *>(c);
 
-				if (primitive->point_count != state.canvas_instance_batches[state.current_batch_index].primitive_points || state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_PRIMITIVE) {
+				if (primitive->point_count != state.canvas_instance_batches[state.current_batch_index].primitive_points || state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_PRIMITIVE || primitive->texture != state.canvas_instance_batches[state.current_batch_index].tex) {
 					_new_batch(r_batch_broken, r_index);
 					state.canvas_instance_batches[state.current_batch_index].tex = primitive->texture;
 					state.canvas_instance_batches[state.current_batch_index].primitive_points = primitive->point_count;
@@ -1208,7 +1242,7 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 }
 
 void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
-	ERR_FAIL_COND(!state.canvas_instance_batches[state.current_batch_index].command);
+	ERR_FAIL_COND(!state.canvas_instance_batches[p_index].command);
 
 	// Used by Polygon and Mesh.
 	static const GLenum prim[5] = { GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP };
@@ -2384,6 +2418,30 @@ RendererCanvasRender::PolygonID RasterizerCanvasGLES3::request_polygon(const Vec
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
+	uint32_t triangle_vertex_count = p_indices.size() ? p_indices.size() : vertex_count;
+	bool has_bones = (uint32_t)p_bones.size() == vertex_count * 4 && (uint32_t)p_weights.size() == vertex_count * 4;
+	if (!has_bones && triangle_vertex_count > 0 && triangle_vertex_count % 3 == 0 && triangle_vertex_count <= MAX_BATCHED_POLYGON_TRIANGLES * 3) {
+		bool use_colors = (uint32_t)p_colors.size() == vertex_count;
+		bool use_uvs = (uint32_t)p_uvs.size() == vertex_count;
+
+		pb.triangle_points.resize(triangle_vertex_count);
+		pb.triangle_uvs.resize(triangle_vertex_count);
+		pb.triangle_colors.resize(triangle_vertex_count);
+		for (uint32_t i = 0; i < triangle_vertex_count; i++) {
+			uint32_t v = p_indices.size() ? uint32_t(p_indices[i]) : i;
+			if (v >= vertex_count) {
+				// Invalid index, leave it to the regular path.
+				pb.triangle_points.clear();
+				pb.triangle_uvs.clear();
+				pb.triangle_colors.clear();
+				break;
+			}
+			pb.triangle_points[i] = p_points[v];
+			pb.triangle_uvs[i] = use_uvs ? p_uvs[v] : Vector2();
+			pb.triangle_colors[i] = use_colors ? p_colors[v] : pb.color;
+		}
+	}
+
 	PolygonID id = polygon_buffers.last_id++;
 
 	polygon_buffers.polygons[id] = pb;
@@ -183,6 +183,9 @@ public:
 		uint32_t pad2;
 	};
 
+	// Polygons with at most this many triangles are drawn as primitives, so they can be batched.
+	static const uint32_t MAX_BATCHED_POLYGON_TRIANGLES = 32;
+
 	struct PolygonBuffers {
 		GLuint vertex_buffer = 0;
 		GLuint vertex_array = 0;
@@ -190,6 +193,11 @@ public:
 		int count = 0;
 		bool color_disabled = false;
 		Color color;
+
+		// Triangle list copy of small polygons, three vertices per triangle.
+		LocalVector<Vector2> triangle_points;
+		LocalVector<Vector2> triangle_uvs;
+		LocalVector<Color> triangle_colors;
 	};
 
 	struct {
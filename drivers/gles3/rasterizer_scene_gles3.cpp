@@ -1998,6 +1998,65 @@ void RasterizerSceneGLES3::render_scene(const Ref<RenderSceneBuffers> &p_render_
 	texture_storage->render_target_disable_clear_request(rb->render_target);
 }
 
+// Returns how many elements starting at p_element can be drawn together with a single instanced draw call.
+// They must be plain meshes sharing the surface, LOD, material and culling, and also the lights in color passes.
+uint32_t RasterizerSceneGLES3::_find_auto_instance_batch(RenderListParameters *p_params, PassMode p_pass_mode, uint32_t p_element, uint32_t p_to_element) {
+	const GeometryInstanceSurface *surf = p_params->elements[p_element];
+	const GeometryInstanceGLES3 *inst = surf->owner;
+
+	if (inst->instance_count >= 0 || inst->mesh_instance.is_valid()) {
+		return 1;
+	}
+
+	bool shadow_pass = p_pass_mode == PASS_MODE_SHADOW;
+	GLES3::SceneShaderData *shader = shadow_pass ? surf->shader_shadow : surf->shader;
+	GLES3::SceneMaterialData *material_data = shadow_pass ? surf->material_shadow : surf->material;
+	void *mesh_surface = shadow_pass ? surf->surface_shadow : surf->surface;
+
+	if (shader->uses_model_matrix || shader->uses_instance || shader->uses_particle_trails || shader->writes_modelview_or_projection) {
+		return 1;
+	}
+
+	uint32_t count = 1;
+	for (uint32_t i = p_element + 1; i < p_to_element; i++) {
+		const GeometryInstanceSurface *next = p_params->elements[i];
+		const GeometryInstanceGLES3 *next_inst = next->owner;
+
+		if ((shadow_pass ? next->surface_shadow : next->surface) != mesh_surface || (shadow_pass ? next->material_shadow : next->material) != material_data || (shadow_pass ? next->shader_shadow : next->shader) != shader) {
+			break;
+		}
+		if (next->lod_index != surf->lod_index || next_inst->instance_count >= 0 || next_inst->mesh_instance.is_valid() || next_inst->mirror != inst->mirror) {
+			break;
+		}
+		if ((next->flags & GeometryInstanceSurface::FLAG_USES_DOUBLE_SIDED_SHADOWS) != (surf->flags & GeometryInstanceSurface::FLAG_USES_DOUBLE_SIDED_SHADOWS)) {
+			break;
+		}
+
+		if (p_pass_mode == PASS_MODE_COLOR) {
+			if (!(next->flags & GeometryInstanceSurface::FLAG_PASS_OPAQUE)) {
+				break;
+			}
+			if (next_inst->omni_light_count != inst->omni_light_count || next_inst->spot_light_count != inst->spot_light_count) {
+				break;
+			}
+			bool same_lights = true;
+			for (uint32_t j = 0; j < inst->omni_light_count && same_lights; j++) {
+				same_lights = next_inst->omni_light_gl_cache[j] == inst->omni_light_gl_cache[j];
+			}
+			for (uint32_t j = 0; j < inst->spot_light_count && same_lights; j++) {
+				same_lights = next_inst->spot_light_gl_cache[j] == inst->spot_light_gl_cache[j];
+			}
+			if (!same_lights) {
+				break;
+			}
+		}
+
+		count++;
+	}
+
+	return count;
+}
+
 template <PassMode p_pass_mode>
 void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params, const RenderDataGLES3 *p_render_data, uint32_t p_from_element, uint32_t p_to_element, bool p_alpha_pass) {
 	GLES3::MeshStorage *mesh_storage = GLES3::MeshStorage::get_singleton();
@@ -2205,6 +2264,12 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 
 		index_array_gl = mesh_storage->mesh_surface_get_index_buffer(mesh_surface, surf->lod_index);
 
+		// Consecutive copies of this surface are drawn together through the instancing variants.
+		uint32_t auto_instance_count = 1;
+		if (config->use_automatic_instancing && p_pass_mode != PASS_MODE_COLOR_TRANSPARENT && p_pass_mode != PASS_MODE_COLOR_ADDITIVE) {
+			auto_instance_count = _find_auto_instance_batch(p_params, p_pass_mode, i, p_to_element);
+		}
+
 		if (prev_vertex_array_gl != vertex_array_gl) {
 			if (vertex_array_gl != 0) {
 				glBindVertexArray(vertex_array_gl);
@@ -2225,7 +2290,31 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 		}
 
 		Transform3D world_transform;
-		if (inst->store_transform_cache) {
+		if (auto_instance_count > 1) {
+			// Transforms go in the instance attributes, the world transform stays the identity.
+			scene_state.auto_instances.resize(auto_instance_count);
+			for (uint32_t j = 0; j < auto_instance_count; j++) {
+				const GeometryInstanceGLES3 *batch_inst = p_params->elements[i + j]->owner;
+				SceneState::AutoInstanceData &instance_data = scene_state.auto_instances[j];
+				if (batch_inst->store_transform_cache) {
+					const Transform3D &xform = batch_inst->transform;
+					for (int k = 0; k < 3; k++) {
+						instance_data.transform[k * 4 + 0] = xform.basis.rows[k][0];
+						instance_data.transform[k * 4 + 1] = xform.basis.rows[k][1];
+						instance_data.transform[k * 4 + 2] = xform.basis.rows[k][2];
+						instance_data.transform[k * 4 + 3] = xform.origin[k];
+					}
+				} else {
+					static const float identity[12] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0 };
+					memcpy(instance_data.transform, identity, sizeof(identity));
+				}
+				// White color and zero custom data, packed as half floats.
+				instance_data.color_custom[0] = 0x3C003C00;
+				instance_data.color_custom[1] = 0x3C003C00;
+				instance_data.color_custom[2] = 0;
+				instance_data.color_custom[3] = 0;
+			}
+		} else if (inst->store_transform_cache) {
 			world_transform = inst->transform;
 		}
 
@@ -2235,8 +2324,8 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 		}
 
 		SceneShaderGLES3::ShaderVariant instance_variant = shader_variant;
-		if (inst->instance_count > 0) {
-			// Will need to use instancing to draw (either MultiMesh or Particles).
+		if (inst->instance_count > 0 || auto_instance_count > 1) {
+			// Will need to use instancing to draw (either MultiMesh, Particles or a batch of Meshes).
 			instance_variant = SceneShaderGLES3::ShaderVariant(1 + int(shader_variant));
 		}
 
@@ -2287,13 +2376,23 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 		}
 
 		material_storage->shaders.scene_shader.version_set_uniform(SceneShaderGLES3::WORLD_TRANSFORM, world_transform, shader->version, instance_variant, spec_constants);
-		if (inst->instance_count > 0) {
-			// Using MultiMesh or Particles.
+		if (inst->instance_count > 0 || auto_instance_count > 1) {
+			// Using MultiMesh, Particles or a batch of Meshes.
 			// Bind instance buffers.
 
 			GLuint instance_buffer = 0;
 			uint32_t stride = 0;
-			if (inst->flags_cache & INSTANCE_DATA_FLAG_PARTICLES) {
+			uint32_t instance_flags = inst->flags_cache;
+			uint32_t instance_count = inst->instance_count;
+			if (auto_instance_count > 1) {
+				// Orphan the previous contents so the driver doesn't stall on draws still reading them.
+				glBindBuffer(GL_ARRAY_BUFFER, scene_state.auto_instance_buffer);
+				glBufferData(GL_ARRAY_BUFFER, auto_instance_count * sizeof(SceneState::AutoInstanceData), scene_state.auto_instances.ptr(), GL_STREAM_DRAW);
+				instance_buffer = scene_state.auto_instance_buffer;
+				stride = sizeof(SceneState::AutoInstanceData) / sizeof(float);
+				instance_flags = INSTANCE_DATA_FLAG_MULTIMESH_HAS_COLOR;
+				instance_count = auto_instance_count;
+			} else if (inst->flags_cache & INSTANCE_DATA_FLAG_PARTICLES) {
 				instance_buffer = particles_storage->particles_get_gl_buffer(inst->data->base);
 				stride = 16; // 12 bytes for instance transform and 4 bytes for packed color and custom.
 			} else {
@@ -2314,22 +2413,22 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			glEnableVertexAttribArray(13);
 			glVertexAttribPointer(13, 4, GL_FLOAT, GL_FALSE, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(sizeof(float) * 4));
 			glVertexAttribDivisor(13, 1);
-			if (!(inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH_FORMAT_2D)) {
+			if (!(instance_flags & INSTANCE_DATA_FLAG_MULTIMESH_FORMAT_2D)) {
 				glEnableVertexAttribArray(14);
 				glVertexAttribPointer(14, 4, GL_FLOAT, GL_FALSE, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(sizeof(float) * 8));
 				glVertexAttribDivisor(14, 1);
 			}
 
-			if ((inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH_HAS_COLOR) || (inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH_HAS_CUSTOM_DATA)) {
-				uint32_t color_custom_offset = inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH_FORMAT_2D ? 8 : 12;
+			if ((instance_flags & INSTANCE_DATA_FLAG_MULTIMESH_HAS_COLOR) || (instance_flags & INSTANCE_DATA_FLAG_MULTIMESH_HAS_CUSTOM_DATA)) {
+				uint32_t color_custom_offset = instance_flags & INSTANCE_DATA_FLAG_MULTIMESH_FORMAT_2D ? 8 : 12;
 				glEnableVertexAttribArray(15);
 				glVertexAttribIPointer(15, 4, GL_UNSIGNED_INT, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(color_custom_offset * sizeof(float)));
 				glVertexAttribDivisor(15, 1);
 			}
 			if (use_index_buffer) {
-				glDrawElementsInstanced(primitive_gl, mesh_storage->mesh_surface_get_vertices_drawn_count(mesh_surface), mesh_storage->mesh_surface_get_index_type(mesh_surface), 0, inst->instance_count);
+				glDrawElementsInstanced(primitive_gl, mesh_storage->mesh_surface_get_vertices_drawn_count(mesh_surface), mesh_storage->mesh_surface_get_index_type(mesh_surface), 0, instance_count);
 			} else {
-				glDrawArraysInstanced(primitive_gl, 0, mesh_storage->mesh_surface_get_vertices_drawn_count(mesh_surface), inst->instance_count);
+				glDrawArraysInstanced(primitive_gl, 0, mesh_storage->mesh_surface_get_vertices_drawn_count(mesh_surface), instance_count);
 			}
 		} else {
 			// Using regular Mesh.
@@ -2339,12 +2438,15 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 				glDrawArrays(primitive_gl, 0, mesh_storage->mesh_surface_get_vertices_drawn_count(mesh_surface));
 			}
 		}
-		if (inst->instance_count > 0) {
+		if (inst->instance_count > 0 || auto_instance_count > 1) {
 			glDisableVertexAttribArray(12);
 			glDisableVertexAttribArray(13);
 			glDisableVertexAttribArray(14);
 			glDisableVertexAttribArray(15);
 		}
+
+		// Skip the elements drawn together with this one.
+		i += auto_instance_count - 1;
 	}
 
 	// Make the actual redraw request
@@ -2554,6 +2656,8 @@ RasterizerSceneGLES3::RasterizerSceneGLES3() {
 		glBindBuffer(GL_UNIFORM_BUFFER, scene_state.directional_light_buffer);
 		glBufferData(GL_UNIFORM_BUFFER, directional_light_buffer_size, nullptr, GL_STREAM_DRAW);
 		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+		glGenBuffers(1, &scene_state.auto_instance_buffer);
 	}
 
 	{
@@ -2697,6 +2801,7 @@ void sky() {
 
 RasterizerSceneGLES3::~RasterizerSceneGLES3() {
 	glDeleteBuffers(1, &scene_state.directional_light_buffer);
+	glDeleteBuffers(1, &scene_state.auto_instance_buffer);
 	glDeleteBuffers(1, &scene_state.omni_light_buffer);
 	glDeleteBuffers(1, &scene_state.spot_light_buffer);
 	memdelete_arr(scene_state.directional_lights);
@@ -386,6 +386,17 @@ private:
 
 		DirectionalLightData *directional_lights = nullptr;
 		GLuint directional_light_buffer = 0;
+
+		// Per-instance attributes for consecutive elements drawn together with automatic instancing.
+		// Laid out like MultiMesh data with colors so the instancing shader variants can read it.
+		struct AutoInstanceData {
+			float transform[12];
+			uint32_t color_custom[4];
+		};
+		static_assert(sizeof(AutoInstanceData) == 16 * sizeof(float), "Automatic instance data must match the 3D MultiMesh stride with colors");
+
+		LocalVector<AutoInstanceData> auto_instances;
+		GLuint auto_instance_buffer = 0;
 	} scene_state;
 
 	struct RenderListParameters {
@@ -464,6 +475,8 @@ private:
 	void _setup_environment(const RenderDataGLES3 *p_render_data, bool p_no_fog, const Size2i &p_screen_size, bool p_flip_y, const Color &p_default_bg_color, bool p_pancake_shadows);
 	void _fill_render_list(RenderListType p_render_list, const RenderDataGLES3 *p_render_data, PassMode p_pass_mode, bool p_append = false);
 
+	uint32_t _find_auto_instance_batch(RenderListParameters *p_params, PassMode p_pass_mode, uint32_t p_element, uint32_t p_to_element);
+
 	template <PassMode p_pass_mode>
 	_FORCE_INLINE_ void _render_list_template(RenderListParameters *p_params, const RenderDataGLES3 *p_render_data, uint32_t p_from_element, uint32_t p_to_element, bool p_alpha_pass = false);
 
@@ -128,6 +128,8 @@ Config::Config() {
 		}
 	}
 
+	use_automatic_instancing = GLOBAL_GET("rendering/gl_compatibility/automatic_instancing");
+
 	max_renderable_elements = GLOBAL_GET("rendering/limits/opengl/max_renderable_elements");
 	max_renderable_lights = GLOBAL_GET("rendering/limits/opengl/max_renderable_lights");
 	max_lights_per_object = GLOBAL_GET("rendering/limits/opengl/max_lights_per_object");
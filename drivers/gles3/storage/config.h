@@ -57,6 +57,7 @@ private:
 public:
 	bool use_nearest_mip_filter = false;
 	bool use_depth_prepass = true;
+	bool use_automatic_instancing = true;
 
 	int max_vertex_texture_image_units = 0;
 	int max_texture_image_units = 0;
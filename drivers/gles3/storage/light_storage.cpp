@@ -685,10 +685,13 @@ void LightStorage::canvas_light_occluder_set_polylines(RID p_occluder, const Poo
 
 /* SHADOW ATLAS API */
 
-RID LightStorage::shadow_atlas_create() {
+RID LightStorage::shadow_atlas_allocate() {
 	return RID();
 }
 
+void LightStorage::shadow_atlas_initialize(RID p_rid) {
+}
+
 void LightStorage::shadow_atlas_free(RID p_atlas) {
 }
 
@@ -3337,6 +3337,8 @@ void SceneShaderData::set_code(const String &p_code) {
 	writes_modelview_or_projection = false;
 	uses_world_coordinates = false;
 	uses_particle_trails = false;
+	uses_model_matrix = false;
+	uses_instance = false;
 
 	ShaderCompiler::IdentifierActions actions;
 	actions.entry_point_stages["vertex"] = ShaderCompiler::STAGE_VERTEX;
@@ -3404,6 +3406,13 @@ void SceneShaderData::set_code(const String &p_code) {
 	actions.usage_flag_pointers["BONE_INDICES"] = &uses_bones;
 	actions.usage_flag_pointers["BONE_WEIGHTS"] = &uses_weights;
 
+	actions.usage_flag_pointers["MODEL_MATRIX"] = &uses_model_matrix;
+	actions.usage_flag_pointers["MODEL_NORMAL_MATRIX"] = &uses_model_matrix;
+	actions.usage_flag_pointers["NODE_POSITION_WORLD"] = &uses_model_matrix;
+	actions.usage_flag_pointers["NODE_POSITION_VIEW"] = &uses_model_matrix;
+	actions.usage_flag_pointers["INSTANCE_ID"] = &uses_instance;
+	actions.usage_flag_pointers["INSTANCE_CUSTOM"] = &uses_instance;
+
 	actions.uniforms = &uniforms;
 
 	Error err = MaterialStorage::get_singleton()->shaders.compiler_scene.compile(RS::SHADER_SPATIAL, code, &actions, path, gen_code);
@@ -138,12 +138,13 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 					case RS::ARRAY_COLOR: {
 						attrib_stride += sizeof(uint32_t);
 					} break;
-					case RS::ARRAY_TEX_UV: {
-						attrib_stride += sizeof(float) * 2;
-
-					} break;
+					case RS::ARRAY_TEX_UV:
 					case RS::ARRAY_TEX_UV2: {
-						attrib_stride += sizeof(float) * 2;
+						if (p_surface.format & RS::ARRAY_FLAG_COMPRESS_UVS) {
+							attrib_stride += sizeof(uint16_t) * 2;
+						} else {
+							attrib_stride += sizeof(float) * 2;
+						}
 
 					} break;
 					case RS::ARRAY_CUSTOM0:
@@ -782,18 +783,17 @@ void MeshStorage::_mesh_surface_generate_version_for_input_mask(Mesh::Surface::V
 				attributes_stride += 4;
 				attribs[i].normalized = GL_TRUE;
 			} break;
-			case RS::ARRAY_TEX_UV: {
-				attribs[i].offset = attributes_stride;
-				attribs[i].size = 2;
-				attribs[i].type = GL_FLOAT;
-				attributes_stride += 2 * sizeof(float);
-				attribs[i].normalized = GL_FALSE;
-			} break;
+			case RS::ARRAY_TEX_UV:
 			case RS::ARRAY_TEX_UV2: {
 				attribs[i].offset = attributes_stride;
 				attribs[i].size = 2;
-				attribs[i].type = GL_FLOAT;
-				attributes_stride += 2 * sizeof(float);
+				if (s->format & RS::ARRAY_FLAG_COMPRESS_UVS) {
+					attribs[i].type = GL_HALF_FLOAT;
+					attributes_stride += 2 * sizeof(uint16_t);
+				} else {
+					attribs[i].type = GL_FLOAT;
+					attributes_stride += 2 * sizeof(float);
+				}
 				attribs[i].normalized = GL_FALSE;
 			} break;
 			case RS::ARRAY_CUSTOM0:
@@ -37,6 +37,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 
@@ -135,6 +136,12 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapping) {
+		munmap(mapping, mapping_length);
+		mapping = nullptr;
+		mapping_length = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -230,6 +237,56 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+uint64_t FileAccessUnix::get_buffer_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+	ERR_FAIL_COND_V_MSG(!f, -1, "File must be opened before use.");
+
+	if (flags != READ) {
+		// Writes may still sit in the stdio buffer, go through it instead.
+		return FileAccess::get_buffer_at(p_offset, p_dst, p_length);
+	}
+
+	// pread() does not touch the file position, so concurrent reads need no locking.
+	int fd = fileno(f);
+	uint64_t read = 0;
+	while (read < p_length) {
+		ssize_t r = pread(fd, p_dst + read, p_length - read, p_offset + read);
+		if (r < 0 && errno == EINTR) {
+			continue;
+		}
+		if (r <= 0) {
+			break;
+		}
+		read += r;
+	}
+	return read;
+}
+
+const uint8_t *FileAccessUnix::get_memory_map() {
+	ERR_FAIL_COND_V_MSG(!f, nullptr, "File must be opened before use.");
+
+	if (mapping) {
+		return (const uint8_t *)mapping;
+	}
+	if (flags != READ) {
+		return nullptr; // Only read-only files can be safely mapped.
+	}
+
+	uint64_t length = get_length();
+	if (length == 0) {
+		return nullptr;
+	}
+
+	void *ptr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (ptr == MAP_FAILED) {
+		return nullptr;
+	}
+
+	mapping = ptr;
+	mapping_length = length;
+	return (const uint8_t *)mapping;
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
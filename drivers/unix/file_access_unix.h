@@ -48,6 +48,8 @@ class FileAccessUnix : public FileAccess {
 	String save_path;
 	String path;
 	String path_src;
+	void *mapping = nullptr;
+	uint64_t mapping_length = 0;
 
 	void _close();
 
@@ -69,6 +71,8 @@ public:
 
 	virtual uint8_t get_8() const override; ///< get a byte
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual uint64_t get_buffer_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_memory_map() override;
 
 	virtual Error get_error() const override; ///< get last error
 
@@ -160,6 +160,7 @@ void NetSocketPosix::make_default() {
 	}
 #endif
 	_create = _create_func;
+	_poll_many = _poll_many_func;
 }
 
 void NetSocketPosix::cleanup() {
@@ -168,6 +169,7 @@ void NetSocketPosix::cleanup() {
 		WSACleanup();
 	}
 	_create = nullptr;
+	_poll_many = nullptr;
 #endif
 }
 
@@ -539,6 +541,53 @@ Error NetSocketPosix::poll(PollType p_type, int p_timeout) const {
 #endif
 }
 
+Error NetSocketPosix::_poll_many_func(const Ref<NetSocket> *p_sockets, int p_count, PollType p_type, int p_timeout, LocalVector<uint8_t> &r_ready) {
+#if defined(WINDOWS_ENABLED)
+	typedef WSAPOLLFD PollFD;
+#else
+	typedef struct pollfd PollFD;
+#endif
+	short events = POLLIN;
+	switch (p_type) {
+		case POLL_TYPE_IN:
+			events = POLLIN;
+			break;
+		case POLL_TYPE_OUT:
+			events = POLLOUT;
+			break;
+		case POLL_TYPE_IN_OUT:
+			events = POLLOUT | POLLIN;
+	}
+
+	static thread_local LocalVector<PollFD> pfds;
+	pfds.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		// All sockets are created by _create_func while this is the default.
+		const NetSocketPosix *sock = static_cast<const NetSocketPosix *>(p_sockets[i].ptr());
+		pfds[i].fd = sock && sock->is_open() ? sock->_sock : SOCK_EMPTY;
+		pfds[i].events = events;
+		pfds[i].revents = 0;
+	}
+
+#if defined(WINDOWS_ENABLED)
+	int ret = WSAPoll(pfds.ptr(), p_count, p_timeout);
+#else
+	int ret = ::poll(pfds.ptr(), p_count, p_timeout);
+#endif
+	if (ret < 0) {
+		print_verbose("Error when polling sockets.");
+		return FAILED;
+	}
+
+	bool any = false;
+	for (int i = 0; i < p_count; i++) {
+		// Closed sockets are reported as ready so the caller notices.
+		r_ready[i] = pfds[i].fd == SOCK_EMPTY || pfds[i].revents != 0;
+		any = any || r_ready[i];
+	}
+	return any ? OK : ERR_BUSY;
+}
+
 Error NetSocketPosix::recv(uint8_t *p_buffer, int p_len, int &r_read) {
 	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
 
@@ -66,6 +66,7 @@ private:
 
 protected:
 	static NetSocket *_create_func();
+	static Error _poll_many_func(const Ref<NetSocket> *p_sockets, int p_count, PollType p_type, int p_timeout, LocalVector<uint8_t> &r_ready);
 
 	bool _can_use_ip(const IPAddress &p_ip, const bool p_for_bind) const;
 
@@ -30,8 +30,10 @@
 
 #include "rendering_device_vulkan.h"
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/io/compression.h"
+#include "core/io/dir_access.h"
 #include "core/io/file_access.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
@@ -1381,7 +1383,8 @@ Error RenderingDeviceVulkan::_insert_staging_block() {
 	bufferInfo.pQueueFamilyIndices = nullptr;
 
 	VmaAllocationCreateInfo allocInfo;
-	allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
+	// Blocks stay mapped for their whole lifetime, so uploads don't need to map and unmap them every time.
+	allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
 	allocInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST;
 	allocInfo.requiredFlags = 0;
 	allocInfo.preferredFlags = 0;
@@ -1390,10 +1393,13 @@ Error RenderingDeviceVulkan::_insert_staging_block() {
 	allocInfo.pUserData = nullptr;
 
 	StagingBufferBlock block;
+	VmaAllocationInfo alloc_info;
 
-	VkResult err = vmaCreateBuffer(allocator, &bufferInfo, &allocInfo, &block.buffer, &block.allocation, nullptr);
+	VkResult err = vmaCreateBuffer(allocator, &bufferInfo, &allocInfo, &block.buffer, &block.allocation, &alloc_info);
 	ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "vmaCreateBuffer failed with error " + itos(err) + ".");
+	ERR_FAIL_NULL_V_MSG(alloc_info.pMappedData, ERR_CANT_CREATE, "Staging buffer block could not be mapped.");
 
+	block.data_ptr = (uint8_t *)alloc_info.pMappedData;
 	block.frame_used = 0;
 	block.fill_amount = 0;
 
@@ -1548,19 +1554,9 @@ Error RenderingDeviceVulkan::_buffer_update(Buffer *p_buffer, size_t p_offset, c
 			return err;
 		}
 
-		// Map staging buffer (It's CPU and coherent).
+		// Copy to staging buffer (It's CPU, coherent and always mapped).
+		memcpy(staging_buffer_blocks[staging_buffer_current].data_ptr + block_write_offset, p_data + submit_from, block_write_amount);
 
-		void *data_ptr = nullptr;
-		{
-			VkResult vkerr = vmaMapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation, &data_ptr);
-			ERR_FAIL_COND_V_MSG(vkerr, ERR_CANT_CREATE, "vmaMapMemory failed with error " + itos(vkerr) + ".");
-		}
-
-		// Copy to staging buffer.
-		memcpy(((uint8_t *)data_ptr) + block_write_offset, p_data + submit_from, block_write_amount);
-
-		// Unmap.
-		vmaUnmapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation);
 		// Insert a command to copy this.
 
 		VkBufferCopy region;
@@ -2535,15 +2531,7 @@ Error RenderingDeviceVulkan::_texture_update(RID p_texture, uint32_t p_layer, co
 					Error err = _staging_buffer_allocate(to_allocate, required_align, alloc_offset, alloc_size, false);
 					ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
 
-					uint8_t *write_ptr;
-
-					{ // Map.
-						void *data_ptr = nullptr;
-						VkResult vkerr = vmaMapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation, &data_ptr);
-						ERR_FAIL_COND_V_MSG(vkerr, ERR_CANT_CREATE, "vmaMapMemory failed with error " + itos(vkerr) + ".");
-						write_ptr = (uint8_t *)data_ptr;
-						write_ptr += alloc_offset;
-					}
+					uint8_t *write_ptr = staging_buffer_blocks[staging_buffer_current].data_ptr + alloc_offset;
 
 					uint32_t block_w, block_h;
 					get_compressed_image_format_block_dimensions(texture->format, block_w, block_h);
@@ -2570,10 +2558,6 @@ Error RenderingDeviceVulkan::_texture_update(RID p_texture, uint32_t p_layer, co
 						_copy_region(read_ptr, write_ptr, x, y, region_w, region_h, width, pixel_size);
 					}
 
-					{ // Unmap.
-						vmaUnmapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation);
-					}
-
 					VkBufferImageCopy buffer_image_copy;
 					buffer_image_copy.bufferOffset = alloc_offset;
 					buffer_image_copy.bufferRowLength = 0; // Tightly packed.
@@ -6456,6 +6440,75 @@ Vector<uint8_t> RenderingDeviceVulkan::buffer_get_data(RID p_buffer) {
 	return buffer_data;
 }
 
+Error RenderingDeviceVulkan::buffer_get_data_async(RID p_buffer, const Callable &p_callback) {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_V_MSG(draw_list, ERR_INVALID_PARAMETER,
+			"Reading back buffers is forbidden during creation of a draw list");
+	ERR_FAIL_COND_V_MSG(compute_list, ERR_INVALID_PARAMETER,
+			"Reading back buffers is forbidden during creation of a compute list");
+
+	VkPipelineShaderStageCreateFlags src_stage_mask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+	VkAccessFlags src_access_mask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	Buffer *buffer = _get_buffer_from_owner(p_buffer, src_stage_mask, src_access_mask, BARRIER_MASK_ALL_BARRIERS);
+	if (!buffer) {
+		ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Buffer is either invalid or this type of buffer can't be retrieved.");
+	}
+
+	Frame::BufferReadback readback;
+	readback.callback = p_callback;
+	Error err = _buffer_allocate(&readback.buffer, buffer->size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VMA_MEMORY_USAGE_AUTO_PREFER_HOST, VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	// Unlike buffer_get_data(), the copy goes to the draw command buffer so it sees everything recorded so far this frame.
+	_buffer_memory_barrier(buffer->buffer, 0, buffer->size, src_stage_mask, VK_PIPELINE_STAGE_TRANSFER_BIT, src_access_mask, VK_ACCESS_TRANSFER_READ_BIT, true);
+
+	VkBufferCopy region;
+	region.srcOffset = 0;
+	region.dstOffset = 0;
+	region.size = buffer->size;
+	vkCmdCopyBuffer(frames[frame].draw_command_buffer, buffer->buffer, readback.buffer.buffer, 1, &region);
+
+	// Make the copy visible to the host, and make later writes to the source buffer wait for it.
+	_buffer_memory_barrier(readback.buffer.buffer, 0, buffer->size, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_HOST_READ_BIT, true);
+	_buffer_memory_barrier(buffer->buffer, 0, buffer->size, VK_PIPELINE_STAGE_TRANSFER_BIT, src_stage_mask, VK_ACCESS_TRANSFER_READ_BIT, src_access_mask, true);
+
+	frames[frame].buffer_readbacks.push_back(readback);
+
+	return OK;
+}
+
+void RenderingDeviceVulkan::_process_buffer_readbacks(int p_frame, bool p_call_callbacks) {
+	while (frames[p_frame].buffer_readbacks.front()) {
+		Frame::BufferReadback &readback = frames[p_frame].buffer_readbacks.front()->get();
+
+		if (p_call_callbacks && readback.callback.is_valid()) {
+			void *buffer_mem;
+			VkResult vkerr = vmaMapMemory(allocator, readback.buffer.allocation, &buffer_mem);
+			if (vkerr) {
+				ERR_PRINT("vmaMapMemory failed with error " + itos(vkerr) + ".");
+			} else {
+				Vector<uint8_t> buffer_data;
+				buffer_data.resize(readback.buffer.size);
+				memcpy(buffer_data.ptrw(), buffer_mem, readback.buffer.size);
+				vmaUnmapMemory(allocator, readback.buffer.allocation);
+
+				Variant data = buffer_data;
+				const Variant *args[1] = { &data };
+				Variant ret;
+				Callable::CallError ce;
+				readback.callback.callp(args, 1, ret, ce);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					ERR_PRINT("Error calling buffer readback callback: " + Variant::get_callable_error_text(readback.callback, args, 1, ce) + ".");
+				}
+			}
+		}
+
+		_buffer_free(&readback.buffer);
+		frames[p_frame].buffer_readbacks.pop_front();
+	}
+}
+
 /*************************/
 /**** RENDER PIPELINE ****/
 /*************************/
@@ -6874,8 +6927,9 @@ RID RenderingDeviceVulkan::render_pipeline_create(RID p_shader, FramebufferForma
 	graphics_pipeline_create_info.basePipelineIndex = 0;
 
 	RenderPipeline pipeline;
-	VkResult err = vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &graphics_pipeline_create_info, nullptr, &pipeline.pipeline);
+	VkResult err = vkCreateGraphicsPipelines(device, pipelines_cache, 1, &graphics_pipeline_create_info, nullptr, &pipeline.pipeline);
 	ERR_FAIL_COND_V_MSG(err, RID(), "vkCreateGraphicsPipelines failed with error " + itos(err) + " for shader '" + shader->name + "'.");
+	pipelines_cache_dirty = true;
 
 	pipeline.set_formats = shader->set_formats;
 	pipeline.push_constant_stages = shader->push_constant.push_constants_vk_stage;
@@ -6989,8 +7043,9 @@ RID RenderingDeviceVulkan::compute_pipeline_create(RID p_shader, const Vector<Pi
 	}
 
 	ComputePipeline pipeline;
-	VkResult err = vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &compute_pipeline_create_info, nullptr, &pipeline.pipeline);
+	VkResult err = vkCreateComputePipelines(device, pipelines_cache, 1, &compute_pipeline_create_info, nullptr, &pipeline.pipeline);
 	ERR_FAIL_COND_V_MSG(err, RID(), "vkCreateComputePipelines failed with error " + itos(err) + ".");
+	pipelines_cache_dirty = true;
 
 	pipeline.set_formats = shader->set_formats;
 	pipeline.push_constant_stages = shader->push_constant.push_constants_vk_stage;
@@ -7893,6 +7948,91 @@ void RenderingDeviceVulkan::draw_list_draw(DrawListID p_list, bool p_use_indices
 	}
 }
 
+void RenderingDeviceVulkan::draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
+	DrawList *dl = _get_draw_list_ptr(p_list);
+	ERR_FAIL_COND(!dl);
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.active, "Submitted Draw Lists can no longer be modified.");
+#endif
+
+	Buffer *buffer = storage_buffer_owner.get_or_null(p_buffer);
+	ERR_FAIL_COND(!buffer);
+
+	ERR_FAIL_COND_MSG(!(buffer->usage & VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT), "Buffer provided was not created to do indirect draws.");
+
+	// The command layouts are VkDrawIndexedIndirectCommand (20 bytes) and VkDrawIndirectCommand (16 bytes).
+	uint32_t command_size = p_use_indices ? 20 : 16;
+	if (p_stride == 0) {
+		p_stride = command_size;
+	}
+	ERR_FAIL_COND_MSG(p_draw_count == 0, "At least one draw must be requested.");
+	ERR_FAIL_COND_MSG((p_offset & 3) || (p_stride & 3) || p_stride < command_size, "Offset and stride must be multiples of 4, and the stride can't be smaller than the command.");
+	ERR_FAIL_COND_MSG(p_offset + p_stride * (p_draw_count - 1) + command_size > buffer->size, "Offset provided (+commands) is past the end of buffer.");
+	ERR_FAIL_COND_MSG(p_draw_count > 1 && !context->get_physical_device_features().multiDrawIndirect, "Multiple indirect draws are not supported by this device.");
+
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.pipeline_active,
+			"No render pipeline was set before attempting to draw.");
+	if (dl->validation.pipeline_vertex_format != INVALID_ID) {
+		// Pipeline uses vertices, validate format.
+		ERR_FAIL_COND_MSG(dl->validation.vertex_format == INVALID_ID,
+				"No vertex array was bound, and render pipeline expects vertices.");
+		// Make sure format is right.
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_vertex_format != dl->validation.vertex_format,
+				"The vertex format used to create the pipeline does not match the vertex format bound.");
+	}
+
+	if (dl->validation.pipeline_push_constant_size > 0) {
+		// Using push constants, check that they were supplied.
+		ERR_FAIL_COND_MSG(!dl->validation.pipeline_push_constant_supplied,
+				"The shader in this pipeline requires a push constant to be set before drawing, but it's not present.");
+	}
+
+	if (p_use_indices) {
+		ERR_FAIL_COND_MSG(!dl->validation.index_array_size,
+				"Draw command requested indices, but no index buffer was set.");
+
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_uses_restart_indices != dl->validation.index_buffer_uses_restart_indices,
+				"The usage of restart indices in index buffer does not match the render primitive in the pipeline.");
+	} else {
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_vertex_format == INVALID_ID,
+				"Draw command lacks indices, but pipeline format does not use vertices.");
+	}
+#endif
+
+	// Bind descriptor sets.
+
+	for (uint32_t i = 0; i < dl->state.set_count; i++) {
+		if (dl->state.sets[i].pipeline_expected_format == 0) {
+			continue; // Nothing expected by this pipeline.
+		}
+#ifdef DEBUG_ENABLED
+		if (dl->state.sets[i].pipeline_expected_format != dl->state.sets[i].uniform_set_format) {
+			if (dl->state.sets[i].uniform_set_format == 0) {
+				ERR_FAIL_MSG("Uniforms were never supplied for set (" + itos(i) + ") at the time of drawing, which are required by the pipeline");
+			} else if (uniform_set_owner.owns(dl->state.sets[i].uniform_set)) {
+				UniformSet *us = uniform_set_owner.get_or_null(dl->state.sets[i].uniform_set);
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + "):\n" + _shader_uniform_debug(us->shader_id, us->shader_set) + "\nare not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			} else {
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + ", which was was just freed) are not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			}
+		}
+#endif
+		if (!dl->state.sets[i].bound) {
+			// All good, see if this requires re-binding.
+			vkCmdBindDescriptorSets(dl->command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, dl->state.pipeline_layout, i, 1, &dl->state.sets[i].descriptor_set, 0, nullptr);
+			dl->state.sets[i].bound = true;
+		}
+	}
+
+	// Index and vertex counts come from the buffer, so the bound index array offset is not applied.
+	if (p_use_indices) {
+		vkCmdDrawIndexedIndirect(dl->command_buffer, buffer->buffer, p_offset, p_draw_count, p_stride);
+	} else {
+		vkCmdDrawIndirect(dl->command_buffer, buffer->buffer, p_offset, p_draw_count, p_stride);
+	}
+}
+
 void RenderingDeviceVulkan::draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect) {
 	DrawList *dl = _get_draw_list_ptr(p_list);
 
@@ -8985,6 +9125,9 @@ void RenderingDeviceVulkan::_finalize_command_bufers() {
 }
 
 void RenderingDeviceVulkan::_begin_frame() {
+	// The GPU is done with this frame, hand back any buffers read in it.
+	_process_buffer_readbacks(frame, true);
+
 	// Erase pending resources.
 	_free_pending_resources(frame);
 
@@ -9063,6 +9206,8 @@ void RenderingDeviceVulkan::swap_buffers() {
 	frame = (frame + 1) % frame_count;
 
 	_begin_frame();
+
+	_update_pipeline_cache();
 }
 
 void RenderingDeviceVulkan::submit() {
@@ -9223,6 +9368,10 @@ uint32_t RenderingDeviceVulkan::get_frame_delay() const {
 	return frame_count;
 }
 
+uint64_t RenderingDeviceVulkan::get_frame_wait_time_usec() const {
+	return context->get_last_fence_wait_usec();
+}
+
 uint64_t RenderingDeviceVulkan::get_memory_usage(MemoryType p_type) const {
 	if (p_type == MEMORY_BUFFERS) {
 		return buffer_memory;
@@ -9290,6 +9439,126 @@ void RenderingDeviceVulkan::_flush(bool p_current_frame) {
 	}
 }
 
+/************************/
+/**** PIPELINE CACHE ****/
+/************************/
+
+static const uint32_t PIPELINE_CACHE_MAGIC = 0x43504447; // "GDPC"
+static const uint32_t PIPELINE_CACHE_VERSION = 1;
+
+void RenderingDeviceVulkan::_load_pipeline_cache() {
+	Vector<uint8_t> cache_data;
+
+	if (!pipelines_cache_file_path.is_empty() && FileAccess::exists(pipelines_cache_file_path)) {
+		Ref<FileAccess> f = FileAccess::open(pipelines_cache_file_path, FileAccess::READ);
+		if (f.is_valid()) {
+			// Any mismatch (other device, other driver version, truncated file) just discards the saved data.
+			bool valid = f->get_32() == PIPELINE_CACHE_MAGIC && f->get_32() == PIPELINE_CACHE_VERSION;
+			valid = valid && f->get_pascal_string() == context->get_device_pipeline_cache_uuid();
+			if (valid) {
+				uint32_t data_size = f->get_32();
+				uint32_t data_hash = f->get_32();
+				if (data_size > 0 && data_size <= f->get_length() - f->get_position()) {
+					cache_data.resize(data_size);
+					f->get_buffer(cache_data.ptrw(), data_size);
+					if (hash_murmur3_buffer(cache_data.ptr(), data_size) != data_hash) {
+						cache_data.clear();
+					}
+				}
+			}
+			if (cache_data.is_empty()) {
+				print_verbose("Discarding invalid or outdated Vulkan pipeline cache: " + pipelines_cache_file_path);
+			}
+		}
+	}
+
+	VkPipelineCacheCreateInfo cache_info;
+	cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+	cache_info.pNext = nullptr;
+	cache_info.flags = 0;
+	cache_info.initialDataSize = cache_data.size();
+	cache_info.pInitialData = cache_data.ptr();
+
+	VkResult err = vkCreatePipelineCache(device, &cache_info, nullptr, &pipelines_cache);
+	if (err != VK_SUCCESS && !cache_data.is_empty()) {
+		// The driver rejected the saved data, start from an empty cache.
+		cache_data.clear();
+		cache_info.initialDataSize = 0;
+		cache_info.pInitialData = nullptr;
+		err = vkCreatePipelineCache(device, &cache_info, nullptr, &pipelines_cache);
+	}
+	if (err != VK_SUCCESS) {
+		pipelines_cache = VK_NULL_HANDLE;
+		ERR_FAIL_MSG("vkCreatePipelineCache failed with error " + itos(err) + ".");
+	}
+
+	pipelines_cache_size = cache_data.size();
+	if (pipelines_cache_size) {
+		print_verbose(vformat("Loaded %d bytes of Vulkan pipeline cache from: %s", uint64_t(pipelines_cache_size), pipelines_cache_file_path));
+	}
+}
+
+void RenderingDeviceVulkan::_update_pipeline_cache(bool p_closing) {
+	if (pipelines_cache_save_task != WorkerThreadPool::INVALID_TASK_ID) {
+		if (!p_closing && !WorkerThreadPool::get_singleton()->is_task_completed(pipelines_cache_save_task)) {
+			return;
+		}
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(pipelines_cache_save_task);
+		pipelines_cache_save_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+
+	if (pipelines_cache == VK_NULL_HANDLE || pipelines_cache_file_path.is_empty()) {
+		return;
+	}
+
+	if (!p_closing && !pipelines_cache_dirty) {
+		return;
+	}
+	pipelines_cache_dirty = false;
+
+	size_t data_size = 0;
+	VkResult err = vkGetPipelineCacheData(device, pipelines_cache, &data_size, nullptr);
+	ERR_FAIL_COND_MSG(err != VK_SUCCESS, "vkGetPipelineCacheData failed with error " + itos(err) + ".");
+
+	if (data_size == pipelines_cache_size) {
+		return;
+	}
+	if (!p_closing && data_size < pipelines_cache_size + pipelines_cache_save_chunk) {
+		// Don't rewrite the whole file for every new pipeline, only after enough has been added.
+		return;
+	}
+
+	pipelines_cache_save_data.resize(data_size);
+	err = vkGetPipelineCacheData(device, pipelines_cache, &data_size, pipelines_cache_save_data.ptrw());
+	ERR_FAIL_COND_MSG(err != VK_SUCCESS && err != VK_INCOMPLETE, "vkGetPipelineCacheData failed with error " + itos(err) + ".");
+	pipelines_cache_save_data.resize(data_size);
+	pipelines_cache_size = data_size;
+
+	if (p_closing) {
+		_save_pipeline_cache(this);
+	} else {
+		pipelines_cache_save_task = WorkerThreadPool::get_singleton()->add_native_task(&RenderingDeviceVulkan::_save_pipeline_cache, this, false, "PipelineCacheSave");
+	}
+}
+
+void RenderingDeviceVulkan::_save_pipeline_cache(void *p_data) {
+	RenderingDeviceVulkan *self = static_cast<RenderingDeviceVulkan *>(p_data);
+	const Vector<uint8_t> &data = self->pipelines_cache_save_data;
+
+	DirAccess::make_dir_recursive_absolute(self->pipelines_cache_file_path.get_base_dir());
+	Ref<FileAccess> f = FileAccess::open(self->pipelines_cache_file_path, FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(f.is_null(), "Unable to save Vulkan pipeline cache to: " + self->pipelines_cache_file_path);
+
+	f->store_32(PIPELINE_CACHE_MAGIC);
+	f->store_32(PIPELINE_CACHE_VERSION);
+	f->store_pascal_string(self->context->get_device_pipeline_cache_uuid());
+	f->store_32(data.size());
+	f->store_32(hash_murmur3_buffer(data.ptr(), data.size()));
+	f->store_buffer(data.ptr(), data.size());
+
+	print_verbose(vformat("Saved %d bytes of Vulkan pipeline cache to: %s", data.size(), self->pipelines_cache_file_path));
+}
+
 void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_device) {
 	// Get our device capabilities.
 	{
@@ -9423,6 +9692,14 @@ void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_de
 
 	max_descriptors_per_pool = GLOBAL_GET("rendering/rendering_device/vulkan/max_descriptors_per_pool");
 
+	// Only the main device persists its pipeline cache, local devices share the same pipelines anyway.
+	if (local_device.is_null() && GLOBAL_GET("rendering/rendering_device/pipeline_cache/enable")) {
+		String device_name = context->get_device_name().validate_identifier().to_lower();
+		pipelines_cache_file_path = "user://vulkan/pipelines." + device_name + (Engine::get_singleton()->is_editor_hint() ? ".editor" : "") + ".cache";
+		pipelines_cache_save_chunk = double(GLOBAL_GET("rendering/rendering_device/pipeline_cache/save_chunk_size_mb")) * 1024 * 1024;
+	}
+	_load_pipeline_cache();
+
 	// Check to make sure DescriptorPoolKey is good.
 	static_assert(sizeof(uint64_t) * 3 >= UNIFORM_TYPE_MAX * sizeof(uint16_t));
 
@@ -9750,6 +10027,8 @@ void RenderingDeviceVulkan::finalize() {
 
 	_flush(false);
 
+	_update_pipeline_cache(true);
+
 	_free_rids(render_pipeline_owner, "Pipeline");
 	_free_rids(compute_pipeline_owner, "Compute");
 	_free_rids(uniform_set_owner, "UniformSet");
@@ -9802,6 +10081,7 @@ void RenderingDeviceVulkan::finalize() {
 	// Free everything pending.
 	for (int i = 0; i < frame_count; i++) {
 		int f = (frame + i) % frame_count;
+		_process_buffer_readbacks(f, false);
 		_free_pending_resources(f);
 		vkDestroyCommandPool(device, frames[i].command_pool, nullptr);
 		vkDestroyQueryPool(device, frames[i].timestamp_pool, nullptr);
@@ -9835,6 +10115,11 @@ void RenderingDeviceVulkan::finalize() {
 	}
 	framebuffer_formats.clear();
 
+	if (pipelines_cache != VK_NULL_HANDLE) {
+		vkDestroyPipelineCache(device, pipelines_cache, nullptr);
+		pipelines_cache = VK_NULL_HANDLE;
+	}
+
 	// All these should be clear at this point.
 	ERR_FAIL_COND(descriptor_pools.size());
 	ERR_FAIL_COND(dependency_map.size());
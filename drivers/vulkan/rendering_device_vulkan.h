@@ -31,6 +31,7 @@
 #ifndef RENDERING_DEVICE_VULKAN_H
 #define RENDERING_DEVICE_VULKAN_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
@@ -198,6 +199,7 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	struct StagingBufferBlock {
 		VkBuffer buffer = VK_NULL_HANDLE;
 		VmaAllocation allocation = nullptr;
+		uint8_t *data_ptr = nullptr; // Persistently mapped.
 		uint64_t frame_used = 0;
 		uint32_t fill_amount = 0;
 	};
@@ -988,6 +990,13 @@ class RenderingDeviceVulkan : public RenderingDevice {
 		List<RenderPipeline> render_pipelines_to_dispose_of;
 		List<ComputePipeline> compute_pipelines_to_dispose_of;
 
+		struct BufferReadback {
+			Buffer buffer;
+			Callable callback;
+		};
+
+		List<BufferReadback> buffer_readbacks; // Copied in this frame, read back when the frame is done.
+
 		VkCommandPool command_pool = VK_NULL_HANDLE;
 		VkCommandBuffer setup_command_buffer = VK_NULL_HANDLE; // Used at the beginning of every frame for set-up.
 		VkCommandBuffer draw_command_buffer = VK_NULL_HANDLE; // Used at the beginning of every frame for set-up.
@@ -1019,6 +1028,27 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	bool local_device_processing = false;
 
 	void _free_pending_resources(int p_frame);
+	void _process_buffer_readbacks(int p_frame, bool p_call_callbacks);
+
+	/************************/
+	/**** PIPELINE CACHE ****/
+	/************************/
+
+	// The driver pipeline cache is saved to the user data directory and
+	// loaded on the next run, so pipelines compiled before are created
+	// without going through the whole shader compiler again.
+
+	VkPipelineCache pipelines_cache = VK_NULL_HANDLE;
+	String pipelines_cache_file_path;
+	size_t pipelines_cache_size = 0; // Size of the cache data the last time it was loaded or saved.
+	size_t pipelines_cache_save_chunk = 0;
+	bool pipelines_cache_dirty = false;
+	Vector<uint8_t> pipelines_cache_save_data;
+	WorkerThreadPool::TaskID pipelines_cache_save_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	void _load_pipeline_cache();
+	void _update_pipeline_cache(bool p_closing = false);
+	static void _save_pipeline_cache(void *p_data);
 
 	VmaAllocator allocator = nullptr;
 	HashMap<uint32_t, VmaPool> small_allocs_pools;
@@ -1127,6 +1157,7 @@ public:
 	virtual Error buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS); // Works for any buffer.
 	virtual Error buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS);
 	virtual Vector<uint8_t> buffer_get_data(RID p_buffer);
+	virtual Error buffer_get_data_async(RID p_buffer, const Callable &p_callback);
 
 	/*************************/
 	/**** RENDER PIPELINE ****/
@@ -1168,6 +1199,7 @@ public:
 	virtual void draw_list_set_push_constant(DrawListID p_list, const void *p_data, uint32_t p_data_size);
 
 	virtual void draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances = 1, uint32_t p_procedural_vertices = 0);
+	virtual void draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset = 0, uint32_t p_draw_count = 1, uint32_t p_stride = 0);
 
 	virtual void draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect);
 	virtual void draw_list_disable_scissor(DrawListID p_list);
@@ -1229,6 +1261,7 @@ public:
 	virtual void sync(); // For local device.
 
 	virtual uint32_t get_frame_delay() const;
+	virtual uint64_t get_frame_wait_time_usec() const;
 
 	virtual RenderingDevice *create_local_device();
 
@@ -32,6 +32,7 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/os/os.h"
 #include "core/string/ustring.h"
 #include "core/templates/local_vector.h"
 #include "core/version.h"
@@ -2189,7 +2190,9 @@ Error VulkanContext::prepare_buffers() {
 	VkResult err;
 
 	// Ensure no more than FRAME_LAG renderings are outstanding.
+	uint64_t wait_begin = OS::get_singleton()->get_ticks_usec();
 	vkWaitForFences(device, 1, &fences[frame_index], VK_TRUE, UINT64_MAX);
+	fence_wait_usec = OS::get_singleton()->get_ticks_usec() - wait_begin;
 	vkResetFences(device, 1, &fences[frame_index]);
 
 	for (KeyValue<int, Window> &E : windows) {
@@ -740,6 +740,76 @@ EditorFileSystem::ScanProgress EditorFileSystem::ScanProgress::get_sub(int p_cur
 }
 
 void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAccess> &da, const ScanProgress &p_progress) {
+	// Walk the directory tree first, then validate all the files found at once,
+	// so the file system and .import checks can run on the worker threads.
+	LocalVector<ScannedFile> scanned_files;
+	_scan_new_dir_tree(p_dir, da, p_progress.get_sub(0, 2), scanned_files);
+
+	if (scanned_files.is_empty()) {
+		return;
+	}
+
+	ScanProgress file_progress = p_progress.get_sub(1, 2);
+	int total = scanned_files.size();
+
+	bool use_multiple_threads = GLOBAL_GET("editor/import/use_multiple_threads");
+	if (use_multiple_threads && total > 1) {
+		scanned_files_done.set(0);
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_scan_file_thread, scanned_files.ptr(), total, -1, false, SNAME("ScanFileInfo"));
+		do {
+			file_progress.update(scanned_files_done.get(), total);
+			OS::get_singleton()->delay_usec(1000);
+		} while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (int i = 0; i < total; i++) {
+			_scan_file(scanned_files[i]);
+			file_progress.update(i, total);
+		}
+	}
+
+	// Registering UIDs, queuing actions and loading documentation are not thread-safe, so finish on this thread.
+	for (int i = 0; i < total; i++) {
+		const ScannedFile &sf = scanned_files[i];
+		EditorFileSystemDirectory::FileInfo *fi = sf.fi;
+
+		if (sf.update_script_class) {
+			fi->script_class_name = _get_global_script_class(fi->type, sf.path, &fi->script_class_extends, &fi->script_class_icon_path);
+		}
+
+		if (sf.test_reimport) {
+			ItemAction ia;
+			ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
+			ia.dir = sf.dir;
+			ia.file = fi->file;
+			scan_actions.push_back(ia);
+		}
+
+		if (fi->uid != ResourceUID::INVALID_ID) {
+			if (ResourceUID::get_singleton()->has_id(fi->uid)) {
+				ResourceUID::get_singleton()->set_id(fi->uid, sf.path);
+			} else {
+				ResourceUID::get_singleton()->add_id(fi->uid, sf.path);
+			}
+		}
+
+		for (int j = 0; j < ScriptServer::get_language_count(); j++) {
+			ScriptLanguage *lang = ScriptServer::get_language(j);
+			if (lang->supports_documentation() && fi->type == lang->get_type()) {
+				Ref<Script> scr = ResourceLoader::load(sf.path);
+				if (scr == nullptr) {
+					continue;
+				}
+				Vector<DocData::ClassDoc> docs = scr->get_documentation();
+				for (int k = 0; k < docs.size(); k++) {
+					EditorHelp::get_doc_data()->add_doc(docs[k]);
+				}
+			}
+		}
+	}
+}
+
+void EditorFileSystem::_scan_new_dir_tree(EditorFileSystemDirectory *p_dir, Ref<DirAccess> &da, const ScanProgress &p_progress, LocalVector<ScannedFile> &r_files) {
 	List<String> dirs;
 	List<String> files;
 
@@ -794,7 +864,7 @@ void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAc
 				efd->parent = p_dir;
 				efd->name = E->get();
 
-				_scan_new_dir(efd, da, p_progress.get_sub(idx, total));
+				_scan_new_dir_tree(efd, da, p_progress.get_sub(idx, total), r_files);
 
 				int idx2 = 0;
 				for (int i = 0; i < p_dir->subdirs.size(); i++) {
@@ -827,117 +897,103 @@ void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAc
 		EditorFileSystemDirectory::FileInfo *fi = memnew(EditorFileSystemDirectory::FileInfo);
 		fi->file = E->get();
 
-		String path = cd.path_join(fi->file);
-
-		FileCache *fc = file_cache.getptr(path);
-		uint64_t mt = FileAccess::get_modified_time(path);
+		ScannedFile sf;
+		sf.dir = p_dir;
+		sf.fi = fi;
+		sf.path = cd.path_join(fi->file);
+		sf.ext = ext;
+		r_files.push_back(sf);
 
-		if (import_extensions.has(ext)) {
-			//is imported
-			uint64_t import_mt = 0;
-			if (FileAccess::exists(path + ".import")) {
-				import_mt = FileAccess::get_modified_time(path + ".import");
-			}
+		p_dir->files.push_back(fi);
+	}
+}
 
-			if (fc && fc->modification_time == mt && fc->import_modification_time == import_mt && !_test_for_reimport(path, true)) {
-				fi->type = fc->type;
-				fi->uid = fc->uid;
-				fi->deps = fc->deps;
-				fi->modified_time = fc->modification_time;
-				fi->import_modified_time = fc->import_modification_time;
+void EditorFileSystem::_scan_file_thread(uint32_t p_index, ScannedFile *p_files) {
+	_scan_file(p_files[p_index]);
+	scanned_files_done.increment();
+}
 
-				fi->import_valid = fc->import_valid;
-				fi->script_class_name = fc->script_class_name;
-				fi->import_group_file = fc->import_group_file;
-				fi->script_class_extends = fc->script_class_extends;
-				fi->script_class_icon_path = fc->script_class_icon_path;
+void EditorFileSystem::_scan_file(ScannedFile &p_file) {
+	// May run on worker threads: only read shared state and defer anything else to _scan_new_dir().
+	EditorFileSystemDirectory::FileInfo *fi = p_file.fi;
+	const String &path = p_file.path;
 
-				if (revalidate_import_files && !ResourceFormatImporter::get_singleton()->are_import_settings_valid(path)) {
-					ItemAction ia;
-					ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
-					ia.dir = p_dir;
-					ia.file = E->get();
-					scan_actions.push_back(ia);
-				}
+	const FileCache *fc = file_cache.getptr(path);
+	uint64_t mt = FileAccess::get_modified_time(path);
 
-				if (fc->type.is_empty()) {
-					fi->type = ResourceLoader::get_resource_type(path);
-					fi->import_group_file = ResourceLoader::get_import_group_file(path);
-					//there is also the chance that file type changed due to reimport, must probably check this somehow here (or kind of note it for next time in another file?)
-					//note: I think this should not happen any longer..
-				}
+	if (import_extensions.has(p_file.ext)) {
+		//is imported
+		uint64_t import_mt = 0;
+		if (FileAccess::exists(path + ".import")) {
+			import_mt = FileAccess::get_modified_time(path + ".import");
+		}
 
-				if (fc->uid == ResourceUID::INVALID_ID) {
-					// imported files should always have a UUID, so attempt to fetch it.
-					fi->uid = ResourceLoader::get_resource_uid(path);
-				}
+		if (fc && fc->modification_time == mt && fc->import_modification_time == import_mt && !_test_for_reimport(path, true)) {
+			fi->type = fc->type;
+			fi->uid = fc->uid;
+			fi->deps = fc->deps;
+			fi->modified_time = fc->modification_time;
+			fi->import_modified_time = fc->import_modification_time;
 
-			} else {
-				fi->type = ResourceFormatImporter::get_singleton()->get_resource_type(path);
-				fi->uid = ResourceFormatImporter::get_singleton()->get_resource_uid(path);
-				fi->import_group_file = ResourceFormatImporter::get_singleton()->get_import_group_file(path);
-				fi->script_class_name = _get_global_script_class(fi->type, path, &fi->script_class_extends, &fi->script_class_icon_path);
-				fi->modified_time = 0;
-				fi->import_modified_time = 0;
-				fi->import_valid = fi->type == "TextFile" ? true : ResourceLoader::is_import_valid(path);
+			fi->import_valid = fc->import_valid;
+			fi->script_class_name = fc->script_class_name;
+			fi->import_group_file = fc->import_group_file;
+			fi->script_class_extends = fc->script_class_extends;
+			fi->script_class_icon_path = fc->script_class_icon_path;
 
-				ItemAction ia;
-				ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
-				ia.dir = p_dir;
-				ia.file = E->get();
-				scan_actions.push_back(ia);
+			if (revalidate_import_files && !ResourceFormatImporter::get_singleton()->are_import_settings_valid(path)) {
+				p_file.test_reimport = true;
 			}
-		} else {
-			if (fc && fc->modification_time == mt) {
-				//not imported, so just update type if changed
-				fi->type = fc->type;
-				fi->uid = fc->uid;
-				fi->modified_time = fc->modification_time;
-				fi->deps = fc->deps;
-				fi->import_modified_time = 0;
-				fi->import_valid = true;
-				fi->script_class_name = fc->script_class_name;
-				fi->script_class_extends = fc->script_class_extends;
-				fi->script_class_icon_path = fc->script_class_icon_path;
-			} else {
-				//new or modified time
+
+			if (fc->type.is_empty()) {
 				fi->type = ResourceLoader::get_resource_type(path);
-				if (fi->type == "" && textfile_extensions.has(ext)) {
-					fi->type = "TextFile";
-				}
-				fi->uid = ResourceLoader::get_resource_uid(path);
-				fi->script_class_name = _get_global_script_class(fi->type, path, &fi->script_class_extends, &fi->script_class_icon_path);
-				fi->deps = _get_dependencies(path);
-				fi->modified_time = mt;
-				fi->import_modified_time = 0;
-				fi->import_valid = true;
+				fi->import_group_file = ResourceLoader::get_import_group_file(path);
+				//there is also the chance that file type changed due to reimport, must probably check this somehow here (or kind of note it for next time in another file?)
+				//note: I think this should not happen any longer..
 			}
-		}
 
-		if (fi->uid != ResourceUID::INVALID_ID) {
-			if (ResourceUID::get_singleton()->has_id(fi->uid)) {
-				ResourceUID::get_singleton()->set_id(fi->uid, path);
-			} else {
-				ResourceUID::get_singleton()->add_id(fi->uid, path);
+			if (fc->uid == ResourceUID::INVALID_ID) {
+				// imported files should always have a UUID, so attempt to fetch it.
+				fi->uid = ResourceLoader::get_resource_uid(path);
 			}
-		}
 
-		for (int i = 0; i < ScriptServer::get_language_count(); i++) {
-			ScriptLanguage *lang = ScriptServer::get_language(i);
-			if (lang->supports_documentation() && fi->type == lang->get_type()) {
-				Ref<Script> scr = ResourceLoader::load(path);
-				if (scr == nullptr) {
-					continue;
-				}
-				Vector<DocData::ClassDoc> docs = scr->get_documentation();
-				for (int j = 0; j < docs.size(); j++) {
-					EditorHelp::get_doc_data()->add_doc(docs[j]);
-				}
-			}
+		} else {
+			fi->type = ResourceFormatImporter::get_singleton()->get_resource_type(path);
+			fi->uid = ResourceFormatImporter::get_singleton()->get_resource_uid(path);
+			fi->import_group_file = ResourceFormatImporter::get_singleton()->get_import_group_file(path);
+			fi->modified_time = 0;
+			fi->import_modified_time = 0;
+			fi->import_valid = fi->type == "TextFile" ? true : ResourceLoader::is_import_valid(path);
+
+			p_file.update_script_class = true;
+			p_file.test_reimport = true;
 		}
+	} else {
+		if (fc && fc->modification_time == mt) {
+			//not imported, so just update type if changed
+			fi->type = fc->type;
+			fi->uid = fc->uid;
+			fi->modified_time = fc->modification_time;
+			fi->deps = fc->deps;
+			fi->import_modified_time = 0;
+			fi->import_valid = true;
+			fi->script_class_name = fc->script_class_name;
+			fi->script_class_extends = fc->script_class_extends;
+			fi->script_class_icon_path = fc->script_class_icon_path;
+		} else {
+			//new or modified time
+			fi->type = ResourceLoader::get_resource_type(path);
+			if (fi->type == "" && textfile_extensions.has(p_file.ext)) {
+				fi->type = "TextFile";
+			}
+			fi->uid = ResourceLoader::get_resource_uid(path);
+			fi->deps = _get_dependencies(path);
+			fi->modified_time = mt;
+			fi->import_modified_time = 0;
+			fi->import_valid = true;
 
-		p_dir->files.push_back(fi);
-		p_progress.update(idx, total);
+			p_file.update_script_class = true;
+		}
 	}
 }
 
@@ -1830,6 +1886,107 @@ Error EditorFileSystem::_reimport_group(const String &p_group_file, const Vector
 	return err;
 }
 
+String EditorFileSystem::_get_import_cache_key(const String &p_file, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params) const {
+	if (!p_importer->can_cache_import(p_params)) {
+		return String();
+	}
+
+	String source_hash = FileAccess::get_sha256(p_file);
+	if (source_hash.is_empty()) {
+		return String();
+	}
+
+	// Everything the import result depends on: the source bytes, the importer and its settings, and the options.
+	String key = p_importer->get_importer_name() + ":" + itos(p_importer->get_format_version()) + ":" + p_importer->get_import_settings_string() + ":" + source_hash;
+	for (const ResourceImporter::ImportOption &E : p_options) {
+		String value;
+		VariantWriter::write_to_string(p_params[E.option.name], value);
+		key += "\n" + String(E.option.name) + "=" + value;
+	}
+
+	return key.sha256_text();
+}
+
+bool EditorFileSystem::_fetch_import_cache(const String &p_cache_dir, const String &p_base_path, List<String> *r_import_variants, Variant *r_metadata) {
+	Ref<ConfigFile> cf;
+	cf.instantiate();
+	if (cf->load(p_cache_dir.path_join("import.cfg")) != OK) {
+		return false;
+	}
+
+	Vector<String> files = cf->get_value("import", "files", Vector<String>());
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	String base_path = ProjectSettings::get_singleton()->globalize_path(p_base_path);
+	for (int i = 0; i < files.size(); i++) {
+		if (da->copy(p_cache_dir.path_join("artifact" + files[i]), base_path + files[i]) != OK) {
+			return false;
+		}
+	}
+
+	Vector<String> variants = cf->get_value("import", "variants", Vector<String>());
+	for (int i = 0; i < variants.size(); i++) {
+		r_import_variants->push_back(variants[i]);
+	}
+	*r_metadata = cf->get_value("import", "metadata", Variant());
+
+	return true;
+}
+
+void EditorFileSystem::_store_import_cache(const String &p_cache_dir, const Ref<ResourceImporter> &p_importer, const String &p_base_path, const List<String> &p_import_variants, const Variant &p_metadata) {
+	String base_path = ProjectSettings::get_singleton()->globalize_path(p_base_path);
+
+	Vector<String> variants;
+	Vector<String> files;
+	if (!p_importer->get_save_extension().is_empty()) {
+		if (p_import_variants.size()) {
+			for (const String &E : p_import_variants) {
+				variants.push_back(E);
+				files.push_back("." + E + "." + p_importer->get_save_extension());
+			}
+		} else {
+			files.push_back("." + p_importer->get_save_extension());
+		}
+
+		// Importers may also write a variant used only by the editor.
+		String editor_file = ".editor." + p_importer->get_save_extension();
+		if (FileAccess::exists(base_path + editor_file)) {
+			files.push_back(editor_file);
+		}
+	}
+
+	// Write into a private directory first and move it in place at the end,
+	// so other editors sharing the cache never see a partial entry.
+	String temp_dir = p_cache_dir + ".tmp" + itos(OS::get_singleton()->get_process_id()) + "_" + itos(Thread::get_caller_id());
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	if (da->make_dir_recursive(temp_dir) != OK) {
+		return;
+	}
+
+	Error err = OK;
+	for (int i = 0; i < files.size() && err == OK; i++) {
+		err = da->copy(base_path + files[i], temp_dir.path_join("artifact" + files[i]));
+	}
+
+	if (err == OK) {
+		Ref<ConfigFile> cf;
+		cf.instantiate();
+		cf->set_value("import", "files", files);
+		cf->set_value("import", "variants", variants);
+		cf->set_value("import", "metadata", p_metadata);
+		err = cf->save(temp_dir.path_join("import.cfg"));
+	}
+
+	if (err == OK && da->rename(temp_dir, p_cache_dir) == OK) {
+		return;
+	}
+
+	// Failed, or another editor stored the same entry first.
+	if (da->change_dir(temp_dir) == OK) {
+		da->erase_contents_recursive();
+	}
+	da->remove(temp_dir);
+}
+
 void EditorFileSystem::_reimport_file(const String &p_file, const HashMap<StringName, Variant> *p_custom_options, const String &p_custom_importer) {
 	EditorFileSystemDirectory *fs = nullptr;
 	int cpos = -1;
@@ -1933,10 +2090,30 @@ void EditorFileSystem::_reimport_file(const String &p_file, const HashMap<String
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant meta;
-	Error err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &meta);
+	Error err = OK;
+
+	String import_cache_dir;
+	if (EditorSettings::get_singleton()) {
+		String import_cache_path = EDITOR_GET("filesystem/import/import_cache_path");
+		if (!import_cache_path.is_empty()) {
+			String key = _get_import_cache_key(p_file, importer, opts, params);
+			if (!key.is_empty()) {
+				import_cache_dir = import_cache_path.path_join(key.substr(0, 2)).path_join(key);
+			}
+		}
+	}
 
-	if (err != OK) {
-		ERR_PRINT("Error importing '" + p_file + "'.");
+	if (!import_cache_dir.is_empty() && _fetch_import_cache(import_cache_dir, base_path, &import_variants, &meta)) {
+		print_verbose("Fetched import of '" + p_file + "' from the import cache.");
+	} else {
+		import_variants.clear();
+		err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &meta);
+
+		if (err != OK) {
+			ERR_PRINT("Error importing '" + p_file + "'.");
+		} else if (!import_cache_dir.is_empty() && gen_files.is_empty()) {
+			_store_import_cache(import_cache_dir, importer, base_path, import_variants, meta);
+		}
 	}
 
 	//as import is complete, save the .import file
@@ -2142,54 +2319,67 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 		}
 	}
 
+	// Files that turned out to be groups are imported with the groups below.
+	for (int i = reimport_files.size() - 1; i >= 0; i--) {
+		if (groups_to_reimport.has(reimport_files[i].path)) {
+			reimport_files.remove_at(i);
+		}
+	}
+
 	reimport_files.sort();
 
 	bool use_multiple_threads = GLOBAL_GET("editor/import/use_multiple_threads");
 
+	// The import order is the dependency level: files sharing it can't depend on each other,
+	// so every threaded importer of a level runs at once, and threaded files come first in it.
 	int from = 0;
-	for (int i = 0; i < reimport_files.size(); i++) {
-		if (groups_to_reimport.has(reimport_files[i].path)) {
-			continue;
+	while (from < reimport_files.size()) {
+		int threaded_to = from;
+		if (use_multiple_threads) {
+			while (threaded_to < reimport_files.size() && reimport_files[threaded_to].threaded && reimport_files[threaded_to].order == reimport_files[from].order) {
+				threaded_to++;
+			}
 		}
 
-		if (use_multiple_threads && reimport_files[i].threaded) {
-			if (i + 1 == reimport_files.size() || reimport_files[i + 1].importer != reimport_files[from].importer) {
-				if (from - i == 0) {
-					// Single file, do not use threads.
-					pr.step(reimport_files[i].path.get_file(), i);
-					_reimport_file(reimport_files[i].path);
-				} else {
-					Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(reimport_files[from].importer);
-					ERR_CONTINUE(!importer.is_valid());
-
-					importer->import_threaded_begin();
-
-					ImportThreadData tdata;
-					tdata.max_index = from;
-					tdata.reimport_from = from;
-					tdata.reimport_files = reimport_files.ptr();
-
-					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &tdata, i - from + 1, -1, false, vformat(TTR("Import resources of type: %s"), reimport_files[from].importer));
-					int current_index = from - 1;
-					do {
-						if (current_index < tdata.max_index) {
-							current_index = tdata.max_index;
-							pr.step(reimport_files[current_index].path.get_file(), current_index);
-						}
-						OS::get_singleton()->delay_usec(1);
-					} while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task));
-
-					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		if (threaded_to - from > 1) {
+			Vector<Ref<ResourceImporter>> importers;
+			for (int i = from; i < threaded_to; i++) {
+				if (i == from || reimport_files[i].importer != reimport_files[i - 1].importer) {
+					Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(reimport_files[i].importer);
+					if (importer.is_valid()) {
+						importer->import_threaded_begin();
+						importers.push_back(importer);
+					}
+				}
+			}
 
-					importer->import_threaded_end();
+			ImportThreadData tdata;
+			tdata.max_index = from;
+			tdata.reimport_from = from;
+			tdata.reimport_files = reimport_files.ptr();
+
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &tdata, threaded_to - from, -1, false, vformat(TTR("Import resources of type: %s"), reimport_files[from].importer));
+			int current_index = from - 1;
+			do {
+				if (current_index < tdata.max_index) {
+					current_index = tdata.max_index;
+					pr.step(reimport_files[current_index].path.get_file(), current_index);
 				}
+				OS::get_singleton()->delay_usec(1);
+			} while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task));
+
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
-				from = i + 1;
+			for (int i = 0; i < importers.size(); i++) {
+				importers.write[i]->import_threaded_end();
 			}
 
+			from = threaded_to;
 		} else {
-			pr.step(reimport_files[i].path.get_file(), i);
-			_reimport_file(reimport_files[i].path);
+			// Single file, do not use threads.
+			pr.step(reimport_files[from].path.get_file(), from);
+			_reimport_file(reimport_files[from].path);
+			from++;
 		}
 	}
 
@@ -32,9 +32,11 @@
 #define EDITOR_FILE_SYSTEM_H
 
 #include "core/io/dir_access.h"
+#include "core/io/resource_importer.h"
 #include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
@@ -223,7 +225,21 @@ class EditorFileSystem : public Node {
 	HashSet<String> valid_extensions;
 	HashSet<String> import_extensions;
 
+	struct ScannedFile {
+		EditorFileSystemDirectory *dir = nullptr;
+		EditorFileSystemDirectory::FileInfo *fi = nullptr;
+		String path;
+		String ext;
+		bool test_reimport = false;
+		bool update_script_class = false;
+	};
+
+	SafeNumeric<uint32_t> scanned_files_done;
+
 	void _scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAccess> &da, const ScanProgress &p_progress);
+	void _scan_new_dir_tree(EditorFileSystemDirectory *p_dir, Ref<DirAccess> &da, const ScanProgress &p_progress, LocalVector<ScannedFile> &r_files);
+	void _scan_file_thread(uint32_t p_index, ScannedFile *p_files);
+	void _scan_file(ScannedFile &p_file);
 
 	Thread thread_sources;
 	bool scanning_changes = false;
@@ -243,6 +259,10 @@ class EditorFileSystem : public Node {
 
 	bool _test_for_reimport(const String &p_path, bool p_only_imported_files);
 
+	String _get_import_cache_key(const String &p_file, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params) const;
+	bool _fetch_import_cache(const String &p_cache_dir, const String &p_base_path, List<String> *r_import_variants, Variant *r_metadata);
+	void _store_import_cache(const String &p_cache_dir, const Ref<ResourceImporter> &p_importer, const String &p_base_path, const List<String> &p_import_variants, const Variant &p_metadata);
+
 	bool reimport_on_missing_imported_files;
 
 	Vector<String> _get_dependencies(const String &p_path);
@@ -253,7 +273,13 @@ class EditorFileSystem : public Node {
 		bool threaded = false;
 		int order = 0;
 		bool operator<(const ImportFile &p_if) const {
-			return order == p_if.order ? (importer < p_if.importer) : (order < p_if.order);
+			if (order != p_if.order) {
+				return order < p_if.order;
+			}
+			if (threaded != p_if.threaded) {
+				return threaded;
+			}
+			return importer < p_if.importer;
 		}
 	};
 
@@ -1514,6 +1514,7 @@ void EditorInspectorSection::unfold() {
 	object->editor_set_section_unfold(section, true);
 	vbox->show();
 	queue_redraw();
+	emit_signal(SNAME("unfolded"));
 }
 
 void EditorInspectorSection::fold() {
@@ -1551,6 +1552,8 @@ void EditorInspectorSection::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_vbox"), &EditorInspectorSection::get_vbox);
 	ClassDB::bind_method(D_METHOD("unfold"), &EditorInspectorSection::unfold);
 	ClassDB::bind_method(D_METHOD("fold"), &EditorInspectorSection::fold);
+
+	ADD_SIGNAL(MethodInfo("unfolded"));
 }
 
 EditorInspectorSection::EditorInspectorSection() {
@@ -2597,6 +2600,206 @@ bool EditorInspector::_is_property_disabled_by_feature_profile(const StringName
 	return false;
 }
 
+void EditorInspector::_create_property_editors(const PropertyInfo &p_property, VBoxContainer *p_vbox, Control *p_placeholder, const String &p_label, const StringName &p_doc_name, const StringName &p_selected, int p_focusable) {
+	// Checkable and checked properties.
+	bool checkable = false;
+	bool checked = false;
+	if (p_property.usage & PROPERTY_USAGE_CHECKABLE) {
+		checkable = true;
+		checked = p_property.usage & PROPERTY_USAGE_CHECKED;
+	}
+
+	bool property_read_only = (p_property.usage & PROPERTY_USAGE_READ_ONLY) || read_only;
+
+	// Mark properties that would require an editor restart (mostly when editing editor settings).
+	if (p_property.usage & PROPERTY_USAGE_RESTART_IF_CHANGED) {
+		restart_request_props.insert(p_property.name);
+	}
+
+	PropertyDocInfo doc_info;
+
+	if (use_doc_hints) {
+		// Build the doc hint, to use as tooltip.
+
+		// Get the class name.
+		StringName classname = p_doc_name;
+		if (!object_class.is_empty()) {
+			classname = object_class;
+		} else if (Object::cast_to<MultiNodeEdit>(object)) {
+			classname = Object::cast_to<MultiNodeEdit>(object)->get_edited_class_name();
+		} else if (classname == "") {
+			classname = object->get_class_name();
+			Resource *res = Object::cast_to<Resource>(object);
+			if (res && !res->get_script().is_null()) {
+				// Grab the script of this resource to get the evaluated script class.
+				Ref<Script> scr = res->get_script();
+				if (scr.is_valid()) {
+					Vector<DocData::ClassDoc> docs = scr->get_documentation();
+					if (!docs.is_empty()) {
+						classname = docs[0].name;
+					}
+				}
+			}
+		}
+
+		StringName propname = property_prefix + p_property.name;
+		bool found = false;
+
+		// Search for the property description in the cache.
+		HashMap<StringName, HashMap<StringName, PropertyDocInfo>>::Iterator E = doc_info_cache.find(classname);
+		if (E) {
+			HashMap<StringName, PropertyDocInfo>::Iterator F = E->value.find(propname);
+			if (F) {
+				found = true;
+				doc_info = F->value;
+			}
+		}
+
+		if (!found) {
+			// Build the property description String and add it to the cache.
+			DocTools *dd = EditorHelp::get_doc_data();
+			HashMap<String, DocData::ClassDoc>::Iterator F = dd->class_list.find(classname);
+			while (F && doc_info.description.is_empty()) {
+				for (int i = 0; i < F->value.properties.size(); i++) {
+					if (F->value.properties[i].name == propname.operator String()) {
+						doc_info.description = DTR(F->value.properties[i].description);
+						doc_info.path = "class_property:" + F->value.name + ":" + F->value.properties[i].name;
+						break;
+					}
+				}
+
+				Vector<String> slices = propname.operator String().split("/");
+				if (slices.size() == 2 && slices[0].begins_with("theme_override_")) {
+					for (int i = 0; i < F->value.theme_properties.size(); i++) {
+						if (F->value.theme_properties[i].name == slices[1]) {
+							doc_info.description = DTR(F->value.theme_properties[i].description);
+							doc_info.path = "class_theme_item:" + F->value.name + ":" + F->value.theme_properties[i].name;
+							break;
+						}
+					}
+				}
+
+				if (!F->value.inherits.is_empty()) {
+					F = dd->class_list.find(F->value.inherits);
+				} else {
+					break;
+				}
+			}
+
+			doc_info_cache[classname][propname] = doc_info;
+		}
+	}
+
+	Vector<EditorInspectorPlugin::AddedEditor> editors;
+	Vector<EditorInspectorPlugin::AddedEditor> late_editors;
+
+	// Search for the inspector plugin that will handle the properties. Then add the correct property editor to it.
+	for (Ref<EditorInspectorPlugin> &ped : valid_plugins) {
+		bool exclusive = ped->parse_property(object, p_property.type, p_property.name, p_property.hint, p_property.hint_string, p_property.usage, wide_editors);
+
+		for (const EditorInspectorPlugin::AddedEditor &F : ped->added_editors) {
+			if (F.add_to_end) {
+				late_editors.push_back(F);
+			} else {
+				editors.push_back(F);
+			}
+		}
+
+		ped->added_editors.clear();
+
+		if (exclusive) {
+			break;
+		}
+	}
+
+	editors.append_array(late_editors);
+
+	for (int i = 0; i < editors.size(); i++) {
+		EditorProperty *ep = Object::cast_to<EditorProperty>(editors[i].property_editor);
+		const Vector<String> &properties = editors[i].properties;
+
+		if (ep) {
+			// Set all this before the control gets the ENTER_TREE notification.
+			ep->object = object;
+
+			if (properties.size()) {
+				if (properties.size() == 1) {
+					//since it's one, associate:
+					ep->property = properties[0];
+					ep->property_path = property_prefix + properties[0];
+					ep->property_usage = p_property.usage;
+					//and set label?
+				}
+				if (!editors[i].label.is_empty()) {
+					ep->set_label(editors[i].label);
+				} else {
+					// Use the existing one.
+					ep->set_label(p_label);
+				}
+
+				for (int j = 0; j < properties.size(); j++) {
+					String prop = properties[j];
+
+					if (!editor_property_map.has(prop)) {
+						editor_property_map[prop] = List<EditorProperty *>();
+					}
+					editor_property_map[prop].push_back(ep);
+				}
+			}
+
+			EditorInspectorSection *section = Object::cast_to<EditorInspectorSection>(p_vbox->get_parent());
+			if (section) {
+				ep->connect("property_can_revert_changed", callable_mp(section, &EditorInspectorSection::property_can_revert_changed));
+			}
+
+			ep->set_draw_warning(draw_warning);
+			ep->set_use_folding(use_folding);
+			ep->set_checkable(checkable);
+			ep->set_checked(checked);
+			ep->set_keying(keying);
+			ep->set_read_only(property_read_only || all_read_only);
+			ep->set_deletable(deletable_properties || p_property.name.begins_with("metadata/"));
+		}
+
+		if (p_placeholder) {
+			// Keep the position the property had in the list.
+			p_placeholder->add_sibling(editors[i].property_editor);
+			p_placeholder = editors[i].property_editor;
+		} else {
+			p_vbox->add_child(editors[i].property_editor);
+		}
+
+		if (ep) {
+			// Eventually, set other properties/signals after the property editor got added to the tree.
+			bool update_all = (p_property.usage & PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED);
+			ep->connect("property_changed", callable_mp(this, &EditorInspector::_property_changed).bind(update_all));
+			ep->connect("property_keyed", callable_mp(this, &EditorInspector::_property_keyed));
+			ep->connect("property_deleted", callable_mp(this, &EditorInspector::_property_deleted), CONNECT_DEFERRED);
+			ep->connect("property_keyed_with_value", callable_mp(this, &EditorInspector::_property_keyed_with_value));
+			ep->connect("property_checked", callable_mp(this, &EditorInspector::_property_checked));
+			ep->connect("property_pinned", callable_mp(this, &EditorInspector::_property_pinned));
+			ep->connect("selected", callable_mp(this, &EditorInspector::_property_selected));
+			ep->connect("multiple_properties_changed", callable_mp(this, &EditorInspector::_multiple_properties_changed));
+			ep->connect("resource_selected", callable_mp(this, &EditorInspector::_resource_selected), CONNECT_DEFERRED);
+			ep->connect("object_id_selected", callable_mp(this, &EditorInspector::_object_id_selected), CONNECT_DEFERRED);
+			if (!doc_info.description.is_empty()) {
+				ep->set_tooltip_text(property_prefix + p_property.name + "::" + doc_info.description);
+			} else {
+				ep->set_tooltip_text(property_prefix + p_property.name);
+			}
+			ep->set_doc_path(doc_info.path);
+			ep->update_property();
+			ep->_update_pin_flags();
+			ep->update_editor_property_status();
+			ep->update_cache();
+
+			if (p_selected && ep->property == p_selected) {
+				ep->select(p_focusable);
+			}
+		}
+	}
+}
+
 void EditorInspector::update_tree() {
 	//to update properly if all is refreshed
 	StringName current_selected = property_selected;
@@ -2629,8 +2832,7 @@ void EditorInspector::update_tree() {
 		return;
 	}
 
-	List<Ref<EditorInspectorPlugin>> valid_plugins;
-
+	valid_plugins.clear();
 	for (int i = inspector_plugin_count - 1; i >= 0; i--) { //start by last, so lastly added can override newly added
 		if (!inspector_plugins[i]->can_handle(object)) {
 			continue;
@@ -2640,8 +2842,8 @@ void EditorInspector::update_tree() {
 
 	// Decide if properties should be drawn with the warning color (yellow),
 	// or if the whole object should be considered read-only.
-	bool draw_warning = false;
-	bool all_read_only = false;
+	draw_warning = false;
+	all_read_only = false;
 	if (is_inside_tree()) {
 		if (object->has_method("_is_read_only")) {
 			all_read_only = object->call("_is_read_only");
@@ -3021,6 +3223,7 @@ void EditorInspector::update_tree() {
 				c.a /= level;
 				section->setup(acc_path, label, object, c, use_folding, section_depth);
 				section->set_tooltip_text(tooltip);
+				section->connect("unfolded", callable_mp(this, &EditorInspector::_section_unfolded));
 
 				// Add editors at the start of a group.
 				for (Ref<EditorInspectorPlugin> &ped : valid_plugins) {
@@ -3101,197 +3304,26 @@ void EditorInspector::update_tree() {
 			continue;
 		}
 
-		// Checkable and checked properties.
-		bool checkable = false;
-		bool checked = false;
-		if (p.usage & PROPERTY_USAGE_CHECKABLE) {
-			checkable = true;
-			checked = p.usage & PROPERTY_USAGE_CHECKED;
-		}
-
-		bool property_read_only = (p.usage & PROPERTY_USAGE_READ_ONLY) || read_only;
-
-		// Mark properties that would require an editor restart (mostly when editing editor settings).
-		if (p.usage & PROPERTY_USAGE_RESTART_IF_CHANGED) {
-			restart_request_props.insert(p.name);
-		}
-
-		PropertyDocInfo doc_info;
-
-		if (use_doc_hints) {
-			// Build the doc hint, to use as tooltip.
-
-			// Get the class name.
-			StringName classname = doc_name;
-			if (!object_class.is_empty()) {
-				classname = object_class;
-			} else if (Object::cast_to<MultiNodeEdit>(object)) {
-				classname = Object::cast_to<MultiNodeEdit>(object)->get_edited_class_name();
-			} else if (classname == "") {
-				classname = object->get_class_name();
-				Resource *res = Object::cast_to<Resource>(object);
-				if (res && !res->get_script().is_null()) {
-					// Grab the script of this resource to get the evaluated script class.
-					Ref<Script> scr = res->get_script();
-					if (scr.is_valid()) {
-						Vector<DocData::ClassDoc> docs = scr->get_documentation();
-						if (!docs.is_empty()) {
-							classname = docs[0].name;
-						}
-					}
-				}
-			}
-
-			StringName propname = property_prefix + p.name;
-			bool found = false;
-
-			// Search for the property description in the cache.
-			HashMap<StringName, HashMap<StringName, PropertyDocInfo>>::Iterator E = doc_info_cache.find(classname);
-			if (E) {
-				HashMap<StringName, PropertyDocInfo>::Iterator F = E->value.find(propname);
-				if (F) {
-					found = true;
-					doc_info = F->value;
-				}
-			}
-
-			if (!found) {
-				// Build the property description String and add it to the cache.
-				DocTools *dd = EditorHelp::get_doc_data();
-				HashMap<String, DocData::ClassDoc>::Iterator F = dd->class_list.find(classname);
-				while (F && doc_info.description.is_empty()) {
-					for (int i = 0; i < F->value.properties.size(); i++) {
-						if (F->value.properties[i].name == propname.operator String()) {
-							doc_info.description = DTR(F->value.properties[i].description);
-							doc_info.path = "class_property:" + F->value.name + ":" + F->value.properties[i].name;
-							break;
-						}
-					}
-
-					Vector<String> slices = propname.operator String().split("/");
-					if (slices.size() == 2 && slices[0].begins_with("theme_override_")) {
-						for (int i = 0; i < F->value.theme_properties.size(); i++) {
-							if (F->value.theme_properties[i].name == slices[1]) {
-								doc_info.description = DTR(F->value.theme_properties[i].description);
-								doc_info.path = "class_theme_item:" + F->value.name + ":" + F->value.theme_properties[i].name;
-								break;
-							}
-						}
-					}
-
-					if (!F->value.inherits.is_empty()) {
-						F = dd->class_list.find(F->value.inherits);
-					} else {
-						break;
-					}
-				}
-
-				doc_info_cache[classname][propname] = doc_info;
-			}
-		}
-
-		Vector<EditorInspectorPlugin::AddedEditor> editors;
-		Vector<EditorInspectorPlugin::AddedEditor> late_editors;
-
-		// Search for the inspector plugin that will handle the properties. Then add the correct property editor to it.
-		for (Ref<EditorInspectorPlugin> &ped : valid_plugins) {
-			bool exclusive = ped->parse_property(object, p.type, p.name, p.hint, p.hint_string, p.usage, wide_editors);
-
-			for (const EditorInspectorPlugin::AddedEditor &F : ped->added_editors) {
-				if (F.add_to_end) {
-					late_editors.push_back(F);
-				} else {
-					editors.push_back(F);
-				}
-			}
-
-			ped->added_editors.clear();
-
-			if (exclusive) {
-				break;
+		// Properties of folded sections get their editors when the section is unfolded.
+		EditorInspectorSection *parent_section = Object::cast_to<EditorInspectorSection>(current_vbox->get_parent());
+		if (array_prefix.is_empty() && parent_section && !_is_vbox_unfolded(current_vbox)) {
+			DeferredProperty deferred;
+			deferred.property = p;
+			deferred.vbox = current_vbox;
+			deferred.placeholder = memnew(Control);
+			deferred.label = property_label_string;
+			deferred.doc_name = doc_name;
+			current_vbox->add_child(deferred.placeholder);
+			deferred_properties.push_back(deferred);
+
+			// Still let the section header show the revert indicator.
+			if (!read_only && !all_read_only && EditorPropertyRevert::can_property_revert(object, p.name)) {
+				parent_section->property_can_revert_changed(p.name, true);
 			}
+			continue;
 		}
 
-		editors.append_array(late_editors);
-
-		for (int i = 0; i < editors.size(); i++) {
-			EditorProperty *ep = Object::cast_to<EditorProperty>(editors[i].property_editor);
-			const Vector<String> &properties = editors[i].properties;
-
-			if (ep) {
-				// Set all this before the control gets the ENTER_TREE notification.
-				ep->object = object;
-
-				if (properties.size()) {
-					if (properties.size() == 1) {
-						//since it's one, associate:
-						ep->property = properties[0];
-						ep->property_path = property_prefix + properties[0];
-						ep->property_usage = p.usage;
-						//and set label?
-					}
-					if (!editors[i].label.is_empty()) {
-						ep->set_label(editors[i].label);
-					} else {
-						// Use the existing one.
-						ep->set_label(property_label_string);
-					}
-
-					for (int j = 0; j < properties.size(); j++) {
-						String prop = properties[j];
-
-						if (!editor_property_map.has(prop)) {
-							editor_property_map[prop] = List<EditorProperty *>();
-						}
-						editor_property_map[prop].push_back(ep);
-					}
-				}
-
-				EditorInspectorSection *section = Object::cast_to<EditorInspectorSection>(current_vbox->get_parent());
-				if (section) {
-					ep->connect("property_can_revert_changed", callable_mp(section, &EditorInspectorSection::property_can_revert_changed));
-				}
-
-				ep->set_draw_warning(draw_warning);
-				ep->set_use_folding(use_folding);
-				ep->set_checkable(checkable);
-				ep->set_checked(checked);
-				ep->set_keying(keying);
-				ep->set_read_only(property_read_only || all_read_only);
-				ep->set_deletable(deletable_properties || p.name.begins_with("metadata/"));
-			}
-
-			current_vbox->add_child(editors[i].property_editor);
-
-			if (ep) {
-				// Eventually, set other properties/signals after the property editor got added to the tree.
-				bool update_all = (p.usage & PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED);
-				ep->connect("property_changed", callable_mp(this, &EditorInspector::_property_changed).bind(update_all));
-				ep->connect("property_keyed", callable_mp(this, &EditorInspector::_property_keyed));
-				ep->connect("property_deleted", callable_mp(this, &EditorInspector::_property_deleted), CONNECT_DEFERRED);
-				ep->connect("property_keyed_with_value", callable_mp(this, &EditorInspector::_property_keyed_with_value));
-				ep->connect("property_checked", callable_mp(this, &EditorInspector::_property_checked));
-				ep->connect("property_pinned", callable_mp(this, &EditorInspector::_property_pinned));
-				ep->connect("selected", callable_mp(this, &EditorInspector::_property_selected));
-				ep->connect("multiple_properties_changed", callable_mp(this, &EditorInspector::_multiple_properties_changed));
-				ep->connect("resource_selected", callable_mp(this, &EditorInspector::_resource_selected), CONNECT_DEFERRED);
-				ep->connect("object_id_selected", callable_mp(this, &EditorInspector::_object_id_selected), CONNECT_DEFERRED);
-				if (!doc_info.description.is_empty()) {
-					ep->set_tooltip_text(property_prefix + p.name + "::" + doc_info.description);
-				} else {
-					ep->set_tooltip_text(property_prefix + p.name);
-				}
-				ep->set_doc_path(doc_info.path);
-				ep->update_property();
-				ep->_update_pin_flags();
-				ep->update_editor_property_status();
-				ep->update_cache();
-
-				if (current_selected && ep->property == current_selected) {
-					ep->select(current_focusable);
-				}
-			}
-		}
+		_create_property_editors(p, current_vbox, nullptr, property_label_string, doc_name, current_selected, current_focusable);
 	}
 
 	if (!hide_metadata && !object->call("_hide_metadata_from_inspector")) {
@@ -3316,6 +3348,31 @@ void EditorInspector::update_tree() {
 	}
 }
 
+bool EditorInspector::_is_vbox_unfolded(VBoxContainer *p_vbox) const {
+	// Folded sections hide their vbox.
+	for (Node *n = p_vbox; n && n != main_vbox; n = n->get_parent()) {
+		Control *c = Object::cast_to<Control>(n);
+		if (c && !c->is_visible()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void EditorInspector::_section_unfolded() {
+	List<DeferredProperty>::Element *E = deferred_properties.front();
+	while (E) {
+		List<DeferredProperty>::Element *N = E->next();
+		DeferredProperty &deferred = E->get();
+		if (_is_vbox_unfolded(deferred.vbox)) {
+			_create_property_editors(deferred.property, deferred.vbox, deferred.placeholder, deferred.label, deferred.doc_name);
+			memdelete(deferred.placeholder);
+			deferred_properties.erase(E);
+		}
+		E = N;
+	}
+}
+
 void EditorInspector::update_property(const String &p_prop) {
 	if (!editor_property_map.has(p_prop)) {
 		return;
@@ -3336,6 +3393,7 @@ void EditorInspector::_clear() {
 	property_focusable = -1;
 	editor_property_map.clear();
 	sections.clear();
+	deferred_properties.clear();
 	pending.clear();
 	restart_request_props.clear();
 }
@@ -452,6 +452,20 @@ class EditorInspector : public ScrollContainer {
 	List<EditorInspectorSection *> sections;
 	HashSet<StringName> pending;
 
+	// Editors for properties inside folded sections are only created once the section is unfolded,
+	// so the state of the last update_tree() is kept to build them.
+	struct DeferredProperty {
+		PropertyInfo property;
+		VBoxContainer *vbox = nullptr;
+		Control *placeholder = nullptr; // Marks where the editors go.
+		String label;
+		StringName doc_name;
+	};
+	List<DeferredProperty> deferred_properties;
+	List<Ref<EditorInspectorPlugin>> valid_plugins;
+	bool draw_warning = false;
+	bool all_read_only = false;
+
 	void _clear();
 	Object *object = nullptr;
 
@@ -522,6 +536,9 @@ class EditorInspector : public ScrollContainer {
 
 	void _filter_changed(const String &p_text);
 	void _parse_added_editors(VBoxContainer *current_vbox, EditorInspectorSection *p_section, Ref<EditorInspectorPlugin> ped);
+	void _create_property_editors(const PropertyInfo &p_property, VBoxContainer *p_vbox, Control *p_placeholder, const String &p_label, const StringName &p_doc_name, const StringName &p_selected = StringName(), int p_focusable = -1);
+	bool _is_vbox_unfolded(VBoxContainer *p_vbox) const;
+	void _section_unfolded();
 
 	void _vscroll_changed(double);
 
@@ -35,6 +35,8 @@
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 #include "editor/editor_node.h"
 #include "editor/editor_paths.h"
 #include "editor/editor_scale.h"
@@ -75,6 +77,10 @@ bool EditorResourcePreviewGenerator::generate_small_preview_automatically() cons
 	return success;
 }
 
+bool EditorResourcePreviewGenerator::is_thread_safe() const {
+	return false;
+}
+
 bool EditorResourcePreviewGenerator::can_generate_small_preview() const {
 	bool success = false;
 	GDVIRTUAL_CALL(_can_generate_small_preview, success);
@@ -203,120 +209,172 @@ void EditorResourcePreview::_generate_preview(Ref<ImageTexture> &r_texture, Ref<
 	}
 }
 
-void EditorResourcePreview::_iterate() {
-	preview_mutex.lock();
+String EditorResourcePreview::_get_cache_base(const String &p_path) const {
+	String temp_path = EditorPaths::get_singleton()->get_cache_dir();
+	String cache_base = ProjectSettings::get_singleton()->globalize_path(p_path).md5_text();
+	return temp_path.path_join("resthumb-" + cache_base);
+}
 
-	if (queue.size()) {
-		QueueItem item = queue.front()->get();
-		queue.pop_front();
+bool EditorResourcePreview::_load_cached_preview(const String &p_path, const String &p_cache_base, Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture) {
+	int thumbnail_size = EDITOR_GET("filesystem/file_dialog/thumbnail_size");
+	thumbnail_size *= EDSCALE;
 
-		if (cache.has(item.path)) {
-			//already has it because someone loaded it, just let it know it's ready
-			String path = item.path;
-			if (item.resource.is_valid()) {
-				path += ":" + itos(cache[item.path].last_hash); //keep last hash (see description of what this is in condition below)
-			}
+	String file = p_cache_base + ".txt";
+	Ref<FileAccess> f = FileAccess::open(file, FileAccess::READ);
+	if (f.is_null()) {
+		return false;
+	}
+
+	uint64_t modtime = FileAccess::get_modified_time(p_path);
+	int tsize = f->get_line().to_int();
+	bool has_small_texture = f->get_line().to_int();
+	uint64_t last_modtime = f->get_line().to_int();
 
-			_preview_ready(path, cache[item.path].preview, cache[item.path].small_preview, item.id, item.function, item.userdata);
+	if (tsize != thumbnail_size) {
+		return false;
+	} else if (last_modtime != modtime) {
+		String last_md5 = f->get_line();
+		String md5 = FileAccess::get_md5(p_path);
+		f.unref();
 
-			preview_mutex.unlock();
+		if (last_md5 != md5) {
+			return false;
+		}
+
+		//update modified time
+		Ref<FileAccess> f2 = FileAccess::open(file, FileAccess::WRITE);
+		if (f2.is_null()) {
+			// Not returning as this would leave the thread hanging and would require
+			// some proper cleanup/disabling of resource preview generation.
+			ERR_PRINT("Cannot create file '" + file + "'. Check user write permissions.");
 		} else {
-			preview_mutex.unlock();
+			f2->store_line(itos(thumbnail_size));
+			f2->store_line(itos(has_small_texture));
+			f2->store_line(itos(modtime));
+			f2->store_line(md5);
+		}
+	}
+	f.unref();
 
-			Ref<ImageTexture> texture;
-			Ref<ImageTexture> small_texture;
+	Ref<Image> img;
+	img.instantiate();
+	if (img->load(p_cache_base + ".png") != OK) {
+		return false;
+	}
+	Ref<Image> small_img;
+	if (has_small_texture) {
+		small_img.instantiate();
+		if (small_img->load(p_cache_base + "_small.png") != OK) {
+			return false;
+		}
+	}
 
-			int thumbnail_size = EDITOR_GET("filesystem/file_dialog/thumbnail_size");
-			thumbnail_size *= EDSCALE;
+	r_texture.instantiate();
+	r_texture->set_image(img);
+	if (small_img.is_valid()) {
+		r_small_texture.instantiate();
+		r_small_texture->set_image(small_img);
+	}
+	return true;
+}
 
-			if (item.resource.is_valid()) {
-				_generate_preview(texture, small_texture, item, String());
+bool EditorResourcePreview::_can_generate_threaded(const String &p_path) const {
+	String type = ResourceLoader::get_resource_type(p_path);
+	for (int i = 0; i < preview_generators.size(); i++) {
+		if (preview_generators[i]->handles(type)) {
+			return preview_generators[i]->is_thread_safe();
+		}
+	}
+	return true; // Nothing to generate.
+}
 
-				//adding hash to the end of path (should be ID:<objid>:<hash>) because of 5 argument limit to call_deferred
-				_preview_ready(item.path + ":" + itos(item.resource->hash_edited_version()), texture, small_texture, item.id, item.function, item.userdata);
+bool EditorResourcePreview::_process_path_item(const QueueItem &p_item, bool p_threaded) {
+	String cache_base = _get_cache_base(p_item.path);
 
-			} else {
-				String temp_path = EditorPaths::get_singleton()->get_cache_dir();
-				String cache_base = ProjectSettings::get_singleton()->globalize_path(item.path).md5_text();
-				cache_base = temp_path.path_join("resthumb-" + cache_base);
+	Ref<ImageTexture> texture;
+	Ref<ImageTexture> small_texture;
+	if (!_load_cached_preview(p_item.path, cache_base, texture, small_texture)) {
+		if (p_threaded && !_can_generate_threaded(p_item.path)) {
+			return false;
+		}
+		texture = Ref<ImageTexture>();
+		small_texture = Ref<ImageTexture>();
+		_generate_preview(texture, small_texture, p_item, cache_base);
+	}
+
+	_preview_ready(p_item.path, texture, small_texture, p_item.id, p_item.function, p_item.userdata);
+	return true;
+}
+
+void EditorResourcePreview::_process_threaded_item(uint32_t p_index, ThreadedItem *p_items) {
+	p_items[p_index].done = _process_path_item(p_items[p_index].item, true);
+}
+
+void EditorResourcePreview::_iterate() {
+	LocalVector<ThreadedItem> items;
+
+	{
+		MutexLock lock(preview_mutex);
+
+		// Take a batch of previews, so cached thumbnails and thread-safe generators can run in parallel.
+		while (queue.size() && items.size() < MAX_BATCH_SIZE) {
+			QueueItem item = queue.front()->get();
+			queue.pop_front();
+
+			if (cache.has(item.path)) {
+				//already has it because someone loaded it, just let it know it's ready
+				String path = item.path;
+				if (item.resource.is_valid()) {
+					path += ":" + itos(cache[item.path].last_hash); //keep last hash (see description of what this is in condition below)
+				}
 
-				//does not have it, try to load a cached thumbnail
+				_preview_ready(path, cache[item.path].preview, cache[item.path].small_preview, item.id, item.function, item.userdata);
+				continue;
+			}
 
-				String file = cache_base + ".txt";
-				Ref<FileAccess> f = FileAccess::open(file, FileAccess::READ);
-				if (f.is_null()) {
-					// No cache found, generate
-					_generate_preview(texture, small_texture, item, cache_base);
+			if (item.resource.is_valid()) {
+				// Edited resources may be modified from the main thread, only generate one at a time.
+				if (items.is_empty()) {
+					ThreadedItem edited;
+					edited.item = item;
+					items.push_back(edited);
 				} else {
-					uint64_t modtime = FileAccess::get_modified_time(item.path);
-					int tsize = f->get_line().to_int();
-					bool has_small_texture = f->get_line().to_int();
-					uint64_t last_modtime = f->get_line().to_int();
-
-					bool cache_valid = true;
-
-					if (tsize != thumbnail_size) {
-						cache_valid = false;
-						f.unref();
-					} else if (last_modtime != modtime) {
-						String last_md5 = f->get_line();
-						String md5 = FileAccess::get_md5(item.path);
-						f.unref();
-
-						if (last_md5 != md5) {
-							cache_valid = false;
-						} else {
-							//update modified time
-
-							Ref<FileAccess> f2 = FileAccess::open(file, FileAccess::WRITE);
-							if (f2.is_null()) {
-								// Not returning as this would leave the thread hanging and would require
-								// some proper cleanup/disabling of resource preview generation.
-								ERR_PRINT("Cannot create file '" + file + "'. Check user write permissions.");
-							} else {
-								f2->store_line(itos(thumbnail_size));
-								f2->store_line(itos(has_small_texture));
-								f2->store_line(itos(modtime));
-								f2->store_line(md5);
-							}
-						}
-					} else {
-						f.unref();
-					}
-
-					if (cache_valid) {
-						Ref<Image> img;
-						img.instantiate();
-						Ref<Image> small_img;
-						small_img.instantiate();
-
-						if (img->load(cache_base + ".png") != OK) {
-							cache_valid = false;
-						} else {
-							texture.instantiate();
-							texture->set_image(img);
-
-							if (has_small_texture) {
-								if (small_img->load(cache_base + "_small.png") != OK) {
-									cache_valid = false;
-								} else {
-									small_texture.instantiate();
-									small_texture->set_image(small_img);
-								}
-							}
-						}
-					}
-
-					if (!cache_valid) {
-						_generate_preview(texture, small_texture, item, cache_base);
-					}
+					queue.push_front(item);
 				}
-				_preview_ready(item.path, texture, small_texture, item.id, item.function, item.userdata);
+				break;
 			}
+
+			ThreadedItem threaded;
+			threaded.item = item;
+			items.push_back(threaded);
 		}
+	}
 
-	} else {
-		preview_mutex.unlock();
+	if (items.is_empty()) {
+		return;
+	}
+
+	if (items[0].item.resource.is_valid()) {
+		const QueueItem &item = items[0].item;
+		Ref<ImageTexture> texture;
+		Ref<ImageTexture> small_texture;
+		_generate_preview(texture, small_texture, item, String());
+
+		//adding hash to the end of path (should be ID:<objid>:<hash>) because of 5 argument limit to call_deferred
+		_preview_ready(item.path + ":" + itos(item.resource->hash_edited_version()), texture, small_texture, item.id, item.function, item.userdata);
+		return;
+	}
+
+	if (items.size() > 1) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorResourcePreview::_process_threaded_item, items.ptr(), items.size(), -1, false, SNAME("EditorResourcePreview"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	}
+
+	// Generators that aren't thread-safe run here, one after the other.
+	for (uint32_t i = 0; i < items.size(); i++) {
+		if (!items[i].done) {
+			_process_path_item(items[i].item, false);
+		}
 	}
 }
 
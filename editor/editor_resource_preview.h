@@ -56,6 +56,7 @@ public:
 
 	virtual bool generate_small_preview_automatically() const;
 	virtual bool can_generate_small_preview() const;
+	virtual bool is_thread_safe() const; ///< true if previews can be generated from several threads at once, without touching the scene or syncing with the RenderingServer
 
 	EditorResourcePreviewGenerator();
 };
@@ -93,6 +94,21 @@ class EditorResourcePreview : public Node {
 
 	HashMap<String, Item> cache;
 
+	enum {
+		MAX_BATCH_SIZE = 64,
+	};
+
+	struct ThreadedItem {
+		QueueItem item;
+		bool done = false; // Otherwise the generator isn't thread-safe, so it's left to the preview thread.
+	};
+
+	String _get_cache_base(const String &p_path) const;
+	bool _load_cached_preview(const String &p_path, const String &p_cache_base, Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture);
+	bool _can_generate_threaded(const String &p_path) const;
+	bool _process_path_item(const QueueItem &p_item, bool p_threaded);
+	void _process_threaded_item(uint32_t p_index, ThreadedItem *p_items);
+
 	void _preview_ready(const String &p_str, const Ref<Texture2D> &p_texture, const Ref<Texture2D> &p_small_texture, ObjectID id, const StringName &p_func, const Variant &p_ud);
 	void _generate_preview(Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture, const QueueItem &p_item, const String &cache_base);
 
@@ -428,6 +428,10 @@ String ResourceImporterLayeredTexture::get_import_settings_string() const {
 	return s;
 }
 
+bool ResourceImporterLayeredTexture::can_cache_import(const HashMap<StringName, Variant> &p_options) const {
+	return true;
+}
+
 bool ResourceImporterLayeredTexture::are_import_settings_valid(const String &p_path) const {
 	//will become invalid if formats are missing to import
 	Dictionary meta = ResourceFormatImporter::get_singleton()->get_resource_metadata(p_path);
@@ -1085,10 +1085,10 @@ Node *ResourceImporterScene::_post_fix_animations(Node *p_node, Node *p_root, co
 	return p_node;
 }
 
-Node *ResourceImporterScene::_post_fix_node(Node *p_node, Node *p_root, HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &collision_map, Pair<PackedVector3Array, PackedInt32Array> &r_occluder_arrays, HashSet<Ref<ImporterMesh>> &r_scanned_meshes, const Dictionary &p_node_data, const Dictionary &p_material_data, const Dictionary &p_animation_data, float p_animation_fps) {
+Node *ResourceImporterScene::_post_fix_node(Node *p_node, Node *p_root, HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &collision_map, Pair<PackedVector3Array, PackedInt32Array> &r_occluder_arrays, HashSet<Ref<ImporterMesh>> &r_scanned_meshes, const Dictionary &p_node_data, const Dictionary &p_material_data, const Dictionary &p_animation_data, float p_animation_fps, Mesh::ConvexDecompositionCache *p_decomposition_cache) {
 	// children first
 	for (int i = 0; i < p_node->get_child_count(); i++) {
-		Node *r = _post_fix_node(p_node->get_child(i), p_root, collision_map, r_occluder_arrays, r_scanned_meshes, p_node_data, p_material_data, p_animation_data, p_animation_fps);
+		Node *r = _post_fix_node(p_node->get_child(i), p_root, collision_map, r_occluder_arrays, r_scanned_meshes, p_node_data, p_material_data, p_animation_data, p_animation_fps, p_decomposition_cache);
 		if (!r) {
 			i--; //was erased
 		}
@@ -1231,7 +1231,8 @@ Node *ResourceImporterScene::_post_fix_node(Node *p_node, Node *p_root, HashMap<
 					} else {
 						shapes = get_collision_shapes(
 								m->get_mesh(),
-								node_settings);
+								node_settings,
+								p_decomposition_cache);
 					}
 
 					if (shapes.size()) {
@@ -1859,8 +1860,14 @@ void ResourceImporterScene::get_import_options(const String &p_path, List<Import
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/ensure_tangents"), true));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/generate_lods"), true));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/create_shadow_meshes"), true));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/generate_meshlets"), false));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/compress_uvs"), false));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "meshes/light_baking", PROPERTY_HINT_ENUM, "Disabled,Static (VoxelGI/SDFGI),Static Lightmaps (VoxelGI/SDFGI/LightmapGI),Dynamic (VoxelGI only)", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED), 1));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "meshes/lightmap_texel_size", PROPERTY_HINT_RANGE, "0.001,100,0.001"), 0.2));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "hlod/enabled"), false));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "hlod/cell_size", PROPERTY_HINT_RANGE, "1,1024,0.1,suffix:m"), 32.0));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "hlod/distance", PROPERTY_HINT_RANGE, "1,4096,0.1,suffix:m"), 100.0));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "hlod/simplify_ratio", PROPERTY_HINT_RANGE, "0.01,1,0.01"), 0.25));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "skins/use_named_skins"), true));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "animation/import"), true));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "animation/fps", PROPERTY_HINT_RANGE, "1,120,1"), 30));
@@ -1922,7 +1929,7 @@ Array ResourceImporterScene::_get_skinned_pose_transforms(ImporterMeshInstance3D
 	return skin_pose_transform_array;
 }
 
-void ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches) {
+void ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, bool p_generate_meshlets, bool p_compress_uvs, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches) {
 	ImporterMeshInstance3D *src_mesh_node = Object::cast_to<ImporterMeshInstance3D>(p_node);
 	if (src_mesh_node) {
 		//is mesh
@@ -2037,6 +2044,17 @@ void ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_m
 					}
 				}
 
+				if (p_generate_meshlets) {
+					src_mesh_node->get_mesh()->generate_meshlets();
+				}
+
+				if (p_compress_uvs) {
+					Ref<ImporterMesh> importer_mesh = src_mesh_node->get_mesh();
+					for (int i = 0; i < importer_mesh->get_surface_count(); i++) {
+						importer_mesh->set_surface_format(i, importer_mesh->get_surface_format(i) | Mesh::ARRAY_FLAG_COMPRESS_UVS);
+					}
+				}
+
 				if (generate_lods) {
 					Array skin_pose_transform_array = _get_skinned_pose_transforms(src_mesh_node);
 					src_mesh_node->get_mesh()->generate_lods(merge_angle, split_angle, skin_pose_transform_array);
@@ -2092,7 +2110,102 @@ void ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_m
 	}
 
 	for (int i = 0; i < p_node->get_child_count(); i++) {
-		_generate_meshes(p_node->get_child(i), p_mesh_data, p_generate_lods, p_create_shadow_meshes, p_light_bake_mode, p_lightmap_texel_size, p_src_lightmap_cache, r_lightmap_caches);
+		_generate_meshes(p_node->get_child(i), p_mesh_data, p_generate_lods, p_create_shadow_meshes, p_generate_meshlets, p_compress_uvs, p_light_bake_mode, p_lightmap_texel_size, p_src_lightmap_cache, r_lightmap_caches);
+	}
+}
+
+static void _collect_hlod_instances(Node *p_node, const Transform3D &p_parent_xform, float p_cell_size, HashMap<Vector3i, LocalVector<Pair<MeshInstance3D *, Transform3D>>> &r_cells) {
+	Transform3D xform = p_parent_xform;
+	Node3D *node_3d = Object::cast_to<Node3D>(p_node);
+	if (node_3d) {
+		xform = xform * node_3d->get_transform();
+		if (!node_3d->get_visibility_parent().is_empty()) {
+			return; // Already part of a manual LOD setup.
+		}
+	}
+
+	MeshInstance3D *mesh_node = Object::cast_to<MeshInstance3D>(p_node);
+	if (mesh_node && mesh_node->get_mesh().is_valid() && mesh_node->get_skin().is_null() && mesh_node->get_mesh()->get_blend_shape_count() == 0 && mesh_node->get_visibility_range_begin() == 0.0 && mesh_node->get_visibility_range_end() == 0.0) {
+		Vector3 center = xform.xform(mesh_node->get_mesh()->get_aabb().get_center());
+		Vector3i cell = Vector3i((center / p_cell_size).floor());
+		r_cells[cell].push_back(Pair<MeshInstance3D *, Transform3D>(mesh_node, xform));
+	}
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_collect_hlod_instances(p_node->get_child(i), xform, p_cell_size, r_cells);
+	}
+}
+
+void ResourceImporterScene::_generate_hlod(Node *p_root, float p_cell_size, float p_distance, float p_simplify_ratio) {
+	// Static meshes are grouped by the spatial cell of their center, and each cell gets a proxy mesh merging all
+	// its meshes, one surface per material. Beyond the HLOD distance only the proxy is drawn: the original meshes
+	// use it as their visibility parent, so RenderingServer swaps them without any script.
+	HashMap<Vector3i, LocalVector<Pair<MeshInstance3D *, Transform3D>>> cells;
+	for (int i = 0; i < p_root->get_child_count(); i++) {
+		_collect_hlod_instances(p_root->get_child(i), Transform3D(), p_cell_size, cells);
+	}
+
+	for (const KeyValue<Vector3i, LocalVector<Pair<MeshInstance3D *, Transform3D>>> &E : cells) {
+		const LocalVector<Pair<MeshInstance3D *, Transform3D>> &instances = E.value;
+		if (instances.size() < 2) {
+			continue; // Nothing to merge.
+		}
+
+		Vector3 origin = (Vector3(E.key) + Vector3(0.5, 0.5, 0.5)) * p_cell_size;
+		Transform3D to_proxy = Transform3D(Basis(), -origin);
+
+		HashMap<Ref<Material>, Ref<SurfaceTool>> material_surfaces;
+		Vector<Ref<Material>> materials; // Keeps the surface order stable between imports.
+		for (uint32_t i = 0; i < instances.size(); i++) {
+			MeshInstance3D *mesh_node = instances[i].first;
+			Ref<Mesh> mesh = mesh_node->get_mesh();
+			for (int j = 0; j < mesh->get_surface_count(); j++) {
+				if (mesh->surface_get_primitive_type(j) != Mesh::PRIMITIVE_TRIANGLES || !(mesh->surface_get_format(j) & Mesh::ARRAY_FORMAT_INDEX)) {
+					continue;
+				}
+				Ref<Material> material = mesh_node->get_active_material(j);
+				if (!material_surfaces.has(material)) {
+					Ref<SurfaceTool> st;
+					st.instantiate();
+					material_surfaces[material] = st;
+					materials.push_back(material);
+				}
+				material_surfaces[material]->append_from(mesh, j, to_proxy * instances[i].second);
+			}
+		}
+
+		if (materials.is_empty()) {
+			continue;
+		}
+
+		Ref<ArrayMesh> proxy_mesh;
+		proxy_mesh.instantiate();
+		for (int i = 0; i < materials.size(); i++) {
+			Ref<SurfaceTool> st = material_surfaces[materials[i]];
+			Array arrays = st->commit_to_arrays();
+			PackedInt32Array indices = arrays[Mesh::ARRAY_INDEX];
+			if (SurfaceTool::simplify_func && p_simplify_ratio < 1.0) {
+				int target_index_count = MAX(3, int(indices.size() * p_simplify_ratio) / 3 * 3);
+				Vector<int> lod = st->generate_lod(1.0, target_index_count);
+				if (!lod.is_empty()) {
+					arrays[Mesh::ARRAY_INDEX] = lod;
+				}
+			}
+			proxy_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+			proxy_mesh->surface_set_material(i, materials[i]);
+		}
+
+		MeshInstance3D *proxy = memnew(MeshInstance3D);
+		proxy->set_name(vformat("HLOD_%d_%d_%d", E.key.x, E.key.y, E.key.z));
+		proxy->set_mesh(proxy_mesh);
+		proxy->set_position(origin);
+		proxy->set_visibility_range_begin(p_distance);
+		p_root->add_child(proxy, true);
+		proxy->set_owner(p_root);
+
+		for (uint32_t i = 0; i < instances.size(); i++) {
+			instances[i].first->set_visibility_parent(instances[i].first->get_path_to(proxy));
+		}
 	}
 }
 
@@ -2397,7 +2510,13 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 		fps = (float)p_options[SNAME("animation/fps")];
 	}
 	_pre_fix_animations(scene, scene, node_data, animation_data, fps);
-	_post_fix_node(scene, scene, collision_map, occluder_arrays, scanned_meshes, node_data, material_data, animation_data, fps);
+	// Decompositions from the previous import of this file, kept with the import artifacts.
+	const String decomposition_cache_path = p_save_path + ".convex_cache";
+	Mesh::ConvexDecompositionCache decomposition_cache;
+	decomposition_cache.load(decomposition_cache_path);
+
+	_post_fix_node(scene, scene, collision_map, occluder_arrays, scanned_meshes, node_data, material_data, animation_data, fps, &decomposition_cache);
+	decomposition_cache.save(decomposition_cache_path);
 	_post_fix_animations(scene, scene, node_data, animation_data, fps);
 
 	String root_type = p_options["nodes/root_type"];
@@ -2440,6 +2559,8 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 
 	bool gen_lods = bool(p_options["meshes/generate_lods"]);
 	bool create_shadow_meshes = bool(p_options["meshes/create_shadow_meshes"]);
+	bool generate_meshlets = bool(p_options["meshes/generate_meshlets"]);
+	bool compress_uvs = bool(p_options["meshes/compress_uvs"]);
 	int light_bake_mode = p_options["meshes/light_baking"];
 	float texel_size = p_options["meshes/lightmap_texel_size"];
 	float lightmap_texel_size = MAX(0.001, texel_size);
@@ -2458,7 +2579,11 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 	if (subresources.has("meshes")) {
 		mesh_data = subresources["meshes"];
 	}
-	_generate_meshes(scene, mesh_data, gen_lods, create_shadow_meshes, LightBakeMode(light_bake_mode), lightmap_texel_size, src_lightmap_cache, mesh_lightmap_caches);
+	_generate_meshes(scene, mesh_data, gen_lods, create_shadow_meshes, generate_meshlets, compress_uvs, LightBakeMode(light_bake_mode), lightmap_texel_size, src_lightmap_cache, mesh_lightmap_caches);
+
+	if (bool(p_options["hlod/enabled"])) {
+		_generate_hlod(scene, MAX(1.0, float(p_options["hlod/cell_size"])), p_options["hlod/distance"], CLAMP(float(p_options["hlod/simplify_ratio"]), 0.01, 1.0));
+	}
 
 	if (mesh_lightmap_caches.size()) {
 		Ref<FileAccess> f = FileAccess::open(p_source_file + ".unwrap_cache", FileAccess::WRITE);
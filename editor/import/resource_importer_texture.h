@@ -102,6 +102,7 @@ public:
 
 	void update_imports();
 
+	virtual bool can_cache_import(const HashMap<StringName, Variant> &p_options) const override;
 	virtual bool are_import_settings_valid(const String &p_path) const override;
 	virtual String get_import_settings_string() const override;
 
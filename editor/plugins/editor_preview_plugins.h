@@ -43,6 +43,7 @@ public:
 	virtual bool handles(const String &p_type) const override;
 	virtual bool generate_small_preview_automatically() const override;
 	virtual Ref<Texture2D> generate(const Ref<Resource> &p_from, const Size2 &p_size) const override;
+	virtual bool is_thread_safe() const override { return true; }
 
 	EditorTexturePreviewPlugin();
 };
@@ -54,6 +55,7 @@ public:
 	virtual bool handles(const String &p_type) const override;
 	virtual bool generate_small_preview_automatically() const override;
 	virtual Ref<Texture2D> generate(const Ref<Resource> &p_from, const Size2 &p_size) const override;
+	virtual bool is_thread_safe() const override { return true; }
 
 	EditorImagePreviewPlugin();
 };
@@ -65,6 +67,7 @@ public:
 	virtual bool handles(const String &p_type) const override;
 	virtual bool generate_small_preview_automatically() const override;
 	virtual Ref<Texture2D> generate(const Ref<Resource> &p_from, const Size2 &p_size) const override;
+	virtual bool is_thread_safe() const override { return true; }
 
 	EditorBitmapPreviewPlugin();
 };
@@ -118,6 +121,7 @@ class EditorAudioStreamPreviewPlugin : public EditorResourcePreviewGenerator {
 public:
 	virtual bool handles(const String &p_type) const;
 	virtual Ref<Texture2D> generate(const Ref<Resource> &p_from, const Size2 &p_size) const;
+	virtual bool is_thread_safe() const { return true; }
 
 	EditorAudioStreamPreviewPlugin();
 };
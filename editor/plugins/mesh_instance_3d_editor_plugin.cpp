@@ -214,7 +214,29 @@ void MeshInstance3DEditor::_menu_option(int p_option) {
 			}
 
 			Mesh::ConvexDecompositionSettings settings;
-			Vector<Ref<Shape3D>> shapes = mesh->convex_decompose(settings);
+			Mesh::ConvexDecompositionTask task;
+			if (mesh->convex_decompose_start(settings, &task) != OK) {
+				err_dialog->set_text(TTR("Couldn't create any collision shapes."));
+				err_dialog->popup_centered();
+				return;
+			}
+
+			{
+				// Decomposing big meshes takes a while, keep the editor drawing and let the user cancel.
+				EditorProgress ep("convex_decompose", TTR("Create Multiple Convex Shapes"), 100, true);
+				while (!Mesh::convex_decompose_is_done(&task)) {
+					if (ep.step(TTR("Decomposing..."), int(task.progress.get() * 100), true)) {
+						task.cancelled.set();
+					}
+					OS::get_singleton()->delay_usec(1000);
+				}
+			}
+
+			bool cancelled = task.cancelled.is_set();
+			Vector<Ref<Shape3D>> shapes = Mesh::convex_decompose_finish(&task);
+			if (cancelled) {
+				return;
+			}
 
 			if (!shapes.size()) {
 				err_dialog->set_text(TTR("Couldn't create any collision shapes."));
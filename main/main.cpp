@@ -35,6 +35,7 @@
 #include "core/core_string_names.h"
 #include "core/crypto/crypto.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/trace_profiler.h"
 #include "core/extension/extension_api_dump.h"
 #include "core/extension/gdnative_interface_dump.gen.h"
 #include "core/extension/native_extension_manager.h"
@@ -57,6 +58,7 @@
 #include "main/app_icon.gen.h"
 #include "main/main_timer_sync.h"
 #include "main/performance.h"
+#include "main/scene_benchmark.h"
 #include "main/splash.gen.h"
 #include "modules/register_module_types.h"
 #include "platform/register_platform_apis.h"
@@ -199,6 +201,10 @@ static int frame_delay = 0;
 static bool disable_render_loop = false;
 static int fixed_fps = -1;
 static MovieWriter *movie_writer = nullptr;
+static SceneBenchmark *scene_benchmark = nullptr;
+static String benchmark_scene_path;
+static String benchmark_scene_file;
+static int benchmark_scene_frames = 600;
 static bool disable_vsync = false;
 static bool print_fps = false;
 #ifdef TOOLS_ENABLED
@@ -405,6 +411,12 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --disable-crash-handler           Disable crash handler when supported by the platform code.\n");
 	OS::get_singleton()->print("  --fixed-fps <fps>                 Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	OS::get_singleton()->print("  --print-fps                       Print the frames per second to the stdout.\n");
+	OS::get_singleton()->print("  --benchmark-scene <path>          Run a scene for a fixed number of frames (with --fixed-fps 60 unless set) and report per-frame timings and memory as JSON.\n");
+	OS::get_singleton()->print("  --benchmark-frames <count>        Number of frames recorded by --benchmark-scene (default: 600).\n");
+	OS::get_singleton()->print("  --benchmark-scene-file <file>     Write the --benchmark-scene report to a file instead of the stdout.\n");
+#ifdef TRACE_ZONES_ENABLED
+	OS::get_singleton()->print("  --trace-file <file>               Record CPU profiling zones to a Chrome/Perfetto trace file in JSON format.\n");
+#endif
 	OS::get_singleton()->print("\n");
 
 	OS::get_singleton()->print("Standalone tools:\n");
@@ -652,6 +664,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 
 	register_core_types();
 	register_core_driver_types();
+	engine->startup_benchmark_lap("register_types");
 
 	MAIN_PRINT("Main: Initialize Globals");
 
@@ -1259,6 +1272,45 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			disable_vsync = true;
 		} else if (I->get() == "--print-fps") {
 			print_fps = true;
+		} else if (I->get() == "--benchmark-scene") {
+			if (I->next()) {
+				benchmark_scene_path = I->next()->get();
+				if (fixed_fps == -1) {
+					fixed_fps = 60;
+				}
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --benchmark-scene <path>.\n");
+				goto error;
+			}
+		} else if (I->get() == "--benchmark-frames") {
+			if (I->next()) {
+				benchmark_scene_frames = I->next()->get().to_int();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <count> argument for --benchmark-frames <count>.\n");
+				goto error;
+			}
+		} else if (I->get() == "--benchmark-scene-file") {
+			if (I->next()) {
+				benchmark_scene_file = I->next()->get();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <file> argument for --benchmark-scene-file <file>.\n");
+				goto error;
+			}
+		} else if (I->get() == "--trace-file") {
+			if (I->next()) {
+#ifdef TRACE_ZONES_ENABLED
+				TraceProfiler::start(I->next()->get());
+#else
+				WARN_PRINT("--trace-file was given, but this build has no profiling zones (compile with trace_zones=yes).");
+#endif
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <file> argument for --trace-file <file>.\n");
+				goto error;
+			}
 		} else if (I->get() == "--profile-gpu") {
 			profile_gpu = true;
 		} else if (I->get() == "--disable-crash-handler") {
@@ -1351,11 +1403,14 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 #endif
 	}
 
+	engine->startup_benchmark_lap("project_settings");
+
 	// Initialize user data dir.
 	OS::get_singleton()->ensure_user_data_dir();
 
 	initialize_modules(MODULE_INITIALIZATION_LEVEL_CORE);
 	register_core_extensions(); // core extensions must be registered after globals setup and before display
+	engine->startup_benchmark_lap("modules");
 
 	ResourceUID::get_singleton()->load_from_cache(); // load UUIDs from cache.
 
@@ -1376,6 +1431,12 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 					"network/limits/debugger/max_queued_messages",
 					PROPERTY_HINT_RANGE,
 					"0, 8192, 1, or_greater"));
+	GLOBAL_DEF("network/limits/debugger/compression_threshold", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("network/limits/debugger/compression_threshold",
+			PropertyInfo(Variant::INT,
+					"network/limits/debugger/compression_threshold",
+					PROPERTY_HINT_RANGE,
+					"0, 65536, 1, or_greater"));
 	GLOBAL_DEF("network/limits/debugger/max_errors_per_second", 400);
 	ProjectSettings::get_singleton()->set_custom_property_info("network/limits/debugger/max_errors_per_second",
 			PropertyInfo(Variant::INT,
@@ -1423,6 +1484,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	// This also prevents logs from being created for the editor instance, as feature tags
 	// are disabled while in the editor (even if they should logically apply).
 	GLOBAL_DEF("debug/file_logging/enable_file_logging.pc", true);
+	GLOBAL_DEF("debug/file_logging/async_writes", false);
 	GLOBAL_DEF("debug/file_logging/log_path", "user://logs/godot.log");
 	GLOBAL_DEF("debug/file_logging/max_log_files", 5);
 	ProjectSettings::get_singleton()->set_custom_property_info("debug/file_logging/max_log_files",
@@ -1436,7 +1498,8 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		// the current working directory, which is inconvenient.
 		String base_path = GLOBAL_GET("debug/file_logging/log_path");
 		int max_files = GLOBAL_GET("debug/file_logging/max_log_files");
-		OS::get_singleton()->add_logger(memnew(RotatedFileLogger(base_path, max_files)));
+		bool async_writes = GLOBAL_GET("debug/file_logging/async_writes");
+		OS::get_singleton()->add_logger(memnew(RotatedFileLogger(base_path, max_files, async_writes)));
 	}
 
 	if (main_args.size() == 0 && String(GLOBAL_GET("application/run/main_scene")) == "") {
@@ -1806,6 +1869,10 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 					PROPERTY_HINT_RANGE, "1,100,1"));
 
 	Engine::get_singleton()->set_physics_jitter_fix(GLOBAL_DEF("physics/common/physics_jitter_fix", 0.5));
+	if (GLOBAL_DEF("physics/common/physics_interpolation", false)) {
+		// Interpolation already smooths out uneven ticks, jitter fix would only add error.
+		Engine::get_singleton()->set_physics_jitter_fix(0.0);
+	}
 	Engine::get_singleton()->set_max_fps(GLOBAL_DEF("application/run/max_fps", 0));
 	ProjectSettings::get_singleton()->set_custom_property_info("application/run/max_fps",
 			PropertyInfo(Variant::INT,
@@ -1863,6 +1930,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	ProjectSettings::get_singleton()->set_custom_property_info("xr/openxr/reference_space", PropertyInfo(Variant::INT, "xr/openxr/reference_space", PROPERTY_HINT_ENUM, "Local,Stage"));
 
 	GLOBAL_DEF_BASIC("xr/openxr/submit_depth_buffer", false);
+	GLOBAL_DEF_BASIC("xr/openxr/pipelined_frame_wait", false);
 
 #ifdef TOOLS_ENABLED
 	// Disabled for now, using XR inside of the editor we'll be working on during the coming months.
@@ -1960,9 +2028,18 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 	physics_server_3d_manager = memnew(PhysicsServer3DManager);
 	physics_server_2d_manager = memnew(PhysicsServer2DManager);
 
+	// Server and scene classes are only bound once they are instantiated or queried.
+	// The editor needs the complete class list, so it always binds up front.
+	bool lazy_class_binding = GLOBAL_DEF_RST("application/run/lazy_class_binding", false);
+#ifdef TOOLS_ENABLED
+	lazy_class_binding = lazy_class_binding && !editor && !project_manager;
+#endif
+	ClassDB::set_lazy_binding_enabled(lazy_class_binding);
+
 	register_server_types();
 	initialize_modules(MODULE_INITIALIZATION_LEVEL_SERVERS);
 	NativeExtensionManager::get_singleton()->initialize_extensions(NativeExtension::INITIALIZATION_LEVEL_SERVERS);
+	engine->startup_benchmark_lap("register_types");
 
 	if (p_main_tid_override) {
 		Thread::main_thread_id = p_main_tid_override;
@@ -2020,6 +2097,8 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 		}
 	}
 
+	engine->startup_benchmark_lap("display_server");
+
 	if (display_server->has_feature(DisplayServer::FEATURE_ORIENTATION)) {
 		display_server->screen_set_orientation(window_orientation);
 	}
@@ -2075,6 +2154,7 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 	rendering_server = memnew(RenderingServerDefault(OS::get_singleton()->get_render_thread_mode() == OS::RENDER_SEPARATE_THREAD));
 
 	rendering_server->init();
+	engine->startup_benchmark_lap("rendering_server");
 	//rendering_server->call_set_use_vsync(OS::get_singleton()->_use_vsync);
 	rendering_server->set_render_loop_enabled(!disable_render_loop);
 
@@ -2113,6 +2193,7 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 
 	audio_server = memnew(AudioServer);
 	audio_server->init();
+	engine->startup_benchmark_lap("audio_server");
 
 	// also init our xr_server from here
 	xr_server = memnew(XRServer);
@@ -2232,6 +2313,10 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 	Input *id = Input::get_singleton();
 	if (id) {
 		agile_input_event_flushing = GLOBAL_DEF("input_devices/buffering/agile_event_flushing", false);
+		if (agile_input_event_flushing) {
+			// Keep the events in the buffer until the physics tick they were received in.
+			id->set_use_input_buffering(true);
+		}
 
 		if (bool(GLOBAL_DEF("input_devices/pointing/emulate_touch_from_mouse", false)) &&
 				!(editor || project_manager)) {
@@ -2336,10 +2421,12 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 	MAIN_PRINT("Main: Load Modules");
 
 	register_platform_apis();
+	engine->startup_benchmark_lap("register_types");
 
 	// Theme needs modules to be initialized so that sub-resources can be loaded.
 	initialize_theme_db();
 	register_scene_singletons();
+	engine->startup_benchmark_lap("theme");
 
 	GLOBAL_DEF_BASIC("display/mouse_cursor/custom_image", String());
 	GLOBAL_DEF_BASIC("display/mouse_cursor/custom_image_hotspot", Vector2());
@@ -2365,9 +2452,11 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 	initialize_physics();
 	initialize_navigation_server();
 	register_server_singletons();
+	engine->startup_benchmark_lap("physics_and_navigation");
 
 	// This loads global classes, so it must happen before custom loaders and savers are registered
 	ScriptServer::init_languages();
+	engine->startup_benchmark_lap("script_languages");
 
 	audio_server->load_default_bus_layout();
 
@@ -2389,8 +2478,14 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 
 	ClassDB::set_current_api(ClassDB::API_NONE); //no more APIs are registered at this point
 
-	print_verbose("CORE API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_CORE)));
-	print_verbose("EDITOR API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_EDITOR)));
+	if (OS::get_singleton()->is_stdout_verbose()) {
+		// Computing the hashes binds every class, so avoid it unless it's printed.
+		if (ClassDB::is_lazy_binding_enabled()) {
+			print_verbose("Classes not bound at startup: " + itos(ClassDB::get_lazy_class_count()));
+		}
+		print_verbose("CORE API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_CORE)));
+		print_verbose("EDITOR API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_EDITOR)));
+	}
 	MAIN_PRINT("Main: Done");
 
 	engine->startup_benchmark_end_measure(); // scene
@@ -2610,6 +2705,10 @@ bool Main::start() {
 
 #endif
 
+	if (!benchmark_scene_path.is_empty()) {
+		game_path = benchmark_scene_path;
+	}
+
 	if (script.is_empty() && game_path.is_empty() && String(GLOBAL_GET("application/run/main_scene")) != "") {
 		game_path = GLOBAL_GET("application/run/main_scene");
 	}
@@ -3059,6 +3158,11 @@ bool Main::start() {
 		movie_writer->begin(DisplayServer::get_singleton()->window_get_size(), fixed_fps, Engine::get_singleton()->get_write_movie_path());
 	}
 
+	if (!benchmark_scene_path.is_empty()) {
+		scene_benchmark = memnew(SceneBenchmark);
+		scene_benchmark->begin(game_path, benchmark_scene_frames, fixed_fps, benchmark_scene_file);
+	}
+
 	if (minimum_time_msec) {
 		uint64_t minimum_time = 1000 * minimum_time_msec;
 		uint64_t elapsed_time = OS::get_singleton()->get_ticks_usec();
@@ -3144,15 +3248,22 @@ bool Main::iteration() {
 	// process all our active interfaces
 	XRServer::get_singleton()->_process();
 
+	const uint64_t physics_step_usec = uint64_t(physics_step * 1000000.0);
+
 	for (int iters = 0; iters < advance.physics_steps; ++iters) {
 		if (Input::get_singleton()->is_using_input_buffering() && agile_input_event_flushing) {
-			Input::get_singleton()->flush_buffered_events();
+			// Each tick only gets the events received up to its share of the elapsed time, the last one gets the rest.
+			const uint64_t ticks_behind = uint64_t(advance.physics_steps - 1 - iters) * physics_step_usec;
+			Input::get_singleton()->flush_buffered_events_until(ticks > ticks_behind ? ticks - ticks_behind : 0);
 		}
 
 		Engine::get_singleton()->_in_physics = true;
 
 		uint64_t physics_begin = OS::get_singleton()->get_ticks_usec();
 
+		// Prepare the scene for a new physics tick before bodies write their new transforms.
+		OS::get_singleton()->get_main_loop()->iteration_prepare();
+
 		PhysicsServer3D::get_singleton()->sync();
 		PhysicsServer3D::get_singleton()->flush_queries();
 
@@ -3220,6 +3331,10 @@ bool Main::iteration() {
 
 	AudioServer::get_singleton()->update();
 
+	if (scene_benchmark && scene_benchmark->add_frame(frame_time, process_ticks, physics_process_ticks)) {
+		exit = true;
+	}
+
 	if (EngineDebugger::is_active()) {
 		EngineDebugger::get_singleton()->iteration(frame_time, process_ticks, physics_process_ticks, physics_step);
 	}
@@ -3312,6 +3427,14 @@ void Main::cleanup(bool p_force) {
 		movie_writer->end();
 	}
 
+	if (scene_benchmark) {
+		scene_benchmark->end();
+		memdelete(scene_benchmark);
+		scene_benchmark = nullptr;
+	}
+
+	TraceProfiler::stop();
+
 	ResourceLoader::remove_custom_loaders();
 	ResourceSaver::remove_custom_savers();
 
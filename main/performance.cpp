@@ -31,6 +31,7 @@
 #include "performance.h"
 
 #include "core/object/message_queue.h"
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
@@ -74,6 +75,15 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PHYSICS_3D_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_COUNT);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(MEMORY_POOL_RESERVED);
+	BIND_ENUM_CONSTANT(MEMORY_FRAME_ARENA_USED);
+	BIND_ENUM_CONSTANT(MEMORY_TAG_CORE);
+	BIND_ENUM_CONSTANT(MEMORY_TAG_SCRIPT);
+	BIND_ENUM_CONSTANT(MEMORY_TAG_RENDER);
+	BIND_ENUM_CONSTANT(MEMORY_TAG_PHYSICS);
+	BIND_ENUM_CONSTANT(MEMORY_TAG_AUDIO);
+	BIND_ENUM_CONSTANT(MEMORY_TAG_RESOURCES);
+	BIND_ENUM_CONSTANT(AUDIO_DECODE_AHEAD_UNDERRUNS);
 
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
@@ -113,6 +123,15 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"physics_3d/collision_pairs",
 		"physics_3d/islands",
 		"audio/driver/output_latency",
+		"memory/pool_reserved",
+		"memory/frame_arena_used",
+		"memory/tag_core",
+		"memory/tag_script",
+		"memory/tag_render",
+		"memory/tag_physics",
+		"memory/tag_audio",
+		"memory/tag_resources",
+		"audio/decode_ahead_underruns",
 
 	};
 
@@ -167,6 +186,19 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT);
 		case AUDIO_OUTPUT_LATENCY:
 			return AudioServer::get_singleton()->get_output_latency();
+		case MEMORY_POOL_RESERVED:
+			return Memory::get_pool_reserved();
+		case MEMORY_FRAME_ARENA_USED:
+			return FrameArena::get_total_last_frame_used();
+		case MEMORY_TAG_CORE:
+		case MEMORY_TAG_SCRIPT:
+		case MEMORY_TAG_RENDER:
+		case MEMORY_TAG_PHYSICS:
+		case MEMORY_TAG_AUDIO:
+		case MEMORY_TAG_RESOURCES:
+			return Memory::get_tag_usage(Memory::Tag(Memory::TAG_CORE + (p_monitor - MEMORY_TAG_CORE)));
+		case AUDIO_DECODE_AHEAD_UNDERRUNS:
+			return AudioServer::get_singleton()->get_decode_ahead_underrun_count();
 
 		default: {
 		}
@@ -202,6 +234,15 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 
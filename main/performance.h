@@ -89,6 +89,15 @@ public:
 		PHYSICS_3D_COLLISION_PAIRS,
 		PHYSICS_3D_ISLAND_COUNT,
 		AUDIO_OUTPUT_LATENCY,
+		MEMORY_POOL_RESERVED,
+		MEMORY_FRAME_ARENA_USED,
+		MEMORY_TAG_CORE,
+		MEMORY_TAG_SCRIPT,
+		MEMORY_TAG_RENDER,
+		MEMORY_TAG_PHYSICS,
+		MEMORY_TAG_AUDIO,
+		MEMORY_TAG_RESOURCES,
+		AUDIO_DECODE_AHEAD_UNDERRUNS,
 		MONITOR_MAX
 	};
 
@@ -0,0 +1,165 @@
+/*************************************************************************/
+/*  scene_benchmark.cpp                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "scene_benchmark.h"
+
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/os/os.h"
+#include "core/version.h"
+#include "servers/display_server.h"
+#include "servers/rendering_server.h"
+
+// Functions seen in a single frame by the script profilers, more than that are ignored.
+static const int SCRIPT_PROFILING_MAX_FUNCTIONS = 4096;
+
+const char *SceneBenchmark::get_metric_name(Metric p_metric) {
+	static const char *names[METRIC_MAX] = {
+		"frame_time_usec",
+		"process_time_usec",
+		"physics_time_usec",
+		"script_time_usec",
+		"render_cpu_time_msec",
+		"render_gpu_time_msec",
+		"static_memory_bytes",
+		"object_count",
+		"draw_calls",
+		"primitives",
+	};
+	return names[p_metric];
+}
+
+double SceneBenchmark::_get_script_time() const {
+	double total = 0.0;
+	ScriptLanguage::ProfilingInfo *info = const_cast<ScriptLanguage::ProfilingInfo *>(profiling_info.ptr());
+	for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+		int count = ScriptServer::get_language(i)->profiling_get_frame_data(info, profiling_info.size());
+		for (int j = 0; j < count; j++) {
+			total += info[j].self_time;
+		}
+	}
+	return total;
+}
+
+void SceneBenchmark::begin(const String &p_scene_path, int p_frame_count, int p_fixed_fps, const String &p_output_path) {
+	scene_path = p_scene_path;
+	frame_count = MAX(p_frame_count, 1);
+	fixed_fps = p_fixed_fps;
+	output_path = p_output_path;
+	for (int i = 0; i < METRIC_MAX; i++) {
+		metrics[i].clear();
+		metrics[i].reserve(frame_count);
+	}
+
+	viewport = RenderingServer::get_singleton()->viewport_find_from_screen_attachment(DisplayServer::MAIN_WINDOW_ID);
+	if (viewport.is_valid()) {
+		RenderingServer::get_singleton()->viewport_set_measure_render_time(viewport, true);
+	}
+
+	// Self times only, so nested calls aren't counted twice. Only debug builds can profile scripts.
+	profiling_info.resize(SCRIPT_PROFILING_MAX_FUNCTIONS);
+	for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+		ScriptServer::get_language(i)->profiling_start();
+	}
+}
+
+bool SceneBenchmark::add_frame(uint64_t p_frame_usec, uint64_t p_process_usec, uint64_t p_physics_usec) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	double values[METRIC_MAX];
+	values[METRIC_FRAME_TIME] = p_frame_usec;
+	values[METRIC_PROCESS_TIME] = p_process_usec;
+	values[METRIC_PHYSICS_TIME] = p_physics_usec;
+	values[METRIC_SCRIPT_TIME] = _get_script_time();
+	values[METRIC_RENDER_CPU_TIME] = viewport.is_valid() ? rs->viewport_get_measured_render_time_cpu(viewport) + rs->get_frame_setup_time_cpu() : 0.0;
+	values[METRIC_RENDER_GPU_TIME] = viewport.is_valid() ? rs->viewport_get_measured_render_time_gpu(viewport) : 0.0;
+	values[METRIC_STATIC_MEMORY] = Memory::get_mem_usage();
+	values[METRIC_OBJECT_COUNT] = ObjectDB::get_object_count();
+	values[METRIC_DRAW_CALLS] = rs->get_rendering_info(RS::RENDERING_INFO_TOTAL_DRAW_CALLS_IN_FRAME);
+	values[METRIC_PRIMITIVES] = rs->get_rendering_info(RS::RENDERING_INFO_TOTAL_PRIMITIVES_IN_FRAME);
+	for (int i = 0; i < METRIC_MAX; i++) {
+		metrics[i].push_back(values[i]);
+	}
+	return int(metrics[METRIC_FRAME_TIME].size()) >= frame_count;
+}
+
+Error SceneBenchmark::end() {
+	for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+		ScriptServer::get_language(i)->profiling_stop();
+	}
+
+	Dictionary summary;
+	Dictionary per_frame;
+	for (int i = 0; i < METRIC_MAX; i++) {
+		const LocalVector<double> &values = metrics[i];
+		Vector<double> frames;
+		frames.resize(values.size());
+		double total = 0.0;
+		for (uint32_t j = 0; j < values.size(); j++) {
+			frames.write[j] = values[j];
+			total += values[j];
+		}
+		per_frame[get_metric_name(Metric(i))] = frames;
+
+		Vector<double> sorted = frames;
+		sorted.sort();
+		Dictionary stats;
+		if (sorted.size()) {
+			stats["min"] = sorted[0];
+			stats["max"] = sorted[sorted.size() - 1];
+			stats["mean"] = total / sorted.size();
+			stats["median"] = sorted[sorted.size() / 2];
+			stats["p95"] = sorted[MIN(sorted.size() - 1, int(sorted.size() * 0.95))];
+		}
+		summary[get_metric_name(Metric(i))] = stats;
+	}
+
+	Dictionary report;
+	report["engine_version"] = VERSION_FULL_BUILD;
+	report["engine_hash"] = VERSION_HASH;
+	report["scene"] = scene_path;
+	report["frames"] = metrics[METRIC_FRAME_TIME].size();
+	report["fixed_fps"] = fixed_fps;
+	report["rendering_driver"] = OS::get_singleton()->get_current_rendering_driver_name();
+	report["summary"] = summary;
+	report["per_frame"] = per_frame;
+
+	String json = JSON::stringify(report, "\t", false);
+	if (output_path.is_empty()) {
+		print_line(json);
+		return OK;
+	}
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(output_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Can't open scene benchmark report for writing: " + output_path);
+	f->store_string(json);
+	print_line(vformat("Scene benchmark report for %d frames of \"%s\" written to: %s", metrics[METRIC_FRAME_TIME].size(), scene_path, output_path));
+	return OK;
+}
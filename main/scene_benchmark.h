@@ -0,0 +1,76 @@
+/*************************************************************************/
+/*  scene_benchmark.h                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef SCENE_BENCHMARK_H
+#define SCENE_BENCHMARK_H
+
+#include "core/object/script_language.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/rid.h"
+
+// Records per-frame timings and memory while a scene runs for a fixed number of frames,
+// then writes them as a JSON report (see `--benchmark-scene`).
+class SceneBenchmark {
+public:
+	enum Metric {
+		METRIC_FRAME_TIME,
+		METRIC_PROCESS_TIME,
+		METRIC_PHYSICS_TIME,
+		METRIC_SCRIPT_TIME,
+		METRIC_RENDER_CPU_TIME,
+		METRIC_RENDER_GPU_TIME,
+		METRIC_STATIC_MEMORY,
+		METRIC_OBJECT_COUNT,
+		METRIC_DRAW_CALLS,
+		METRIC_PRIMITIVES,
+		METRIC_MAX
+	};
+
+private:
+	String scene_path;
+	String output_path;
+	int frame_count = 0;
+	int fixed_fps = 0;
+	RID viewport;
+
+	LocalVector<double> metrics[METRIC_MAX];
+	LocalVector<ScriptLanguage::ProfilingInfo> profiling_info;
+
+	static const char *get_metric_name(Metric p_metric);
+	double _get_script_time() const;
+
+public:
+	void begin(const String &p_scene_path, int p_frame_count, int p_fixed_fps, const String &p_output_path);
+	// Returns true once all the frames are recorded.
+	bool add_frame(uint64_t p_frame_usec, uint64_t p_process_usec, uint64_t p_physics_usec);
+	Error end();
+};
+
+#endif // SCENE_BENCHMARK_H
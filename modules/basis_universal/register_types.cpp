@@ -30,6 +30,7 @@
 
 #include "register_types.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "servers/rendering_server.h"
 
@@ -143,6 +144,25 @@ static Vector<uint8_t> basis_universal_packer(const Ref<Image> &p_image, Image::
 }
 #endif // TOOLS_ENABLED
 
+struct BasisTranscodeLevels {
+	const basist::basisu_transcoder *transcoder = nullptr;
+	const uint8_t *data = nullptr;
+	int size = 0;
+	basist::transcoder_texture_format format = basist::transcoder_texture_format::cTFTotalTextureFormats;
+	uint8_t *dst = nullptr;
+	LocalVector<int> offsets;
+	LocalVector<uint32_t> blocks;
+	LocalVector<bool> failed;
+};
+
+static void _basis_transcode_level(void *p_userdata, uint32_t p_level) {
+	BasisTranscodeLevels *levels = static_cast<BasisTranscodeLevels *>(p_userdata);
+	basist::basisu_transcoder_state state;
+	if (!levels->transcoder->transcode_image_level(levels->data, levels->size, 0, p_level, levels->dst + levels->offsets[p_level], levels->blocks[p_level], levels->format, 0, 0, &state)) {
+		levels->failed[p_level] = true;
+	}
+}
+
 static Ref<Image> basis_universal_unpacker_ptr(const uint8_t *p_data, int p_size) {
 	Ref<Image> image;
 
@@ -231,26 +251,46 @@ static Ref<Image> basis_universal_unpacker_ptr(const uint8_t *p_data, int p_size
 
 	{
 		uint8_t *w = gpudata.ptrw();
-		uint8_t *dst = w;
-		for (int i = 0; i < gpudata.size(); i++) {
-			dst[i] = 0x00;
-		}
+		memset(w, 0, gpudata.size());
+
+		BasisTranscodeLevels levels;
+		levels.transcoder = &tr;
+		levels.data = ptr;
+		levels.size = size;
+		levels.format = format;
+		levels.dst = w;
+		levels.offsets.resize(info.m_total_levels);
+		levels.blocks.resize(info.m_total_levels);
+		levels.failed.resize(info.m_total_levels);
 
 		int ofs = 0;
-		tr.start_transcoding(ptr, size);
 		for (uint32_t i = 0; i < info.m_total_levels; i++) {
 			basist::basisu_image_level_info level;
 			tr.get_image_level_info(ptr, size, level, 0, i);
 
-			bool ret = tr.transcode_image_level(ptr, size, 0, i, dst + ofs, level.m_total_blocks - i, format);
-			if (!ret) {
-				printf("failed! on level %u\n", i);
-				break;
-			};
+			levels.offsets[i] = ofs;
+			levels.blocks[i] = level.m_total_blocks - i;
+			levels.failed[i] = false;
 
 			ofs += level.m_total_blocks * block_size;
-		};
-	};
+		}
+
+		tr.start_transcoding(ptr, size);
+		if (info.m_total_levels > 1) {
+			// Each level gets its own transcoder state, so they can be decoded concurrently.
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(_basis_transcode_level, &levels, info.m_total_levels, -1, true, SNAME("BasisTranscodeLevels"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			_basis_transcode_level(&levels, 0);
+		}
+
+		for (uint32_t i = 0; i < info.m_total_levels; i++) {
+			if (levels.failed[i]) {
+				printf("failed! on level %u\n", i);
+				break;
+			}
+		}
+	}
 
 	image.instantiate();
 	image->set_data(info.m_width, info.m_height, info.m_total_levels > 1, imgfmt, gpudata);
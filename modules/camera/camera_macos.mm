@@ -41,9 +41,6 @@
 
 @interface MyCaptureSession : AVCaptureSession <AVCaptureVideoDataOutputSampleBufferDelegate> {
 	Ref<CameraFeed> feed;
-	size_t width[2];
-	size_t height[2];
-	Vector<uint8_t> img_data[2];
 
 	AVCaptureDeviceInput *input;
 	AVCaptureVideoDataOutput *output;
@@ -57,10 +54,6 @@
 	if (self = [super init]) {
 		NSError *error;
 		feed = p_feed;
-		width[0] = 0;
-		height[0] = 0;
-		width[1] = 0;
-		height[1] = 0;
 
 		[self beginConfiguration];
 
@@ -141,43 +134,33 @@
 	} else if (dataCbCr == nullptr) {
 		print_line("Couldn't access CbCr pixel buffer data");
 	} else {
+		// Copy straight from the locked planes into the image data. The rows of a plane can be padded,
+		// so they are copied one at a time when the stride doesn't match. A new buffer is used for every
+		// frame, reusing one would make a second copy of it while the previous frame's image is still queued.
 		Ref<Image> img[2];
-
-		{
-			// do Y
-			size_t new_width = CVPixelBufferGetWidthOfPlane(pixelBuffer, 0);
-			size_t new_height = CVPixelBufferGetHeightOfPlane(pixelBuffer, 0);
-
-			if ((width[0] != new_width) || (height[0] != new_height)) {
-				width[0] = new_width;
-				height[0] = new_height;
-				img_data[0].resize(new_width * new_height);
+		const unsigned char *plane_data[2] = { dataY, dataCbCr };
+		const int plane_pixel_size[2] = { 1, 2 };
+		const Image::Format plane_format[2] = { Image::FORMAT_R8, Image::FORMAT_RG8 }; ///TODO OpenGL doesn't support FORMAT_RG8, need to do some form of conversion
+
+		for (int plane = 0; plane < 2; plane++) {
+			size_t plane_width = CVPixelBufferGetWidthOfPlane(pixelBuffer, plane);
+			size_t plane_height = CVPixelBufferGetHeightOfPlane(pixelBuffer, plane);
+			size_t bytes_per_row = CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, plane);
+			size_t row_size = plane_width * plane_pixel_size[plane];
+
+			Vector<uint8_t> img_data;
+			img_data.resize(row_size * plane_height);
+			uint8_t *w = img_data.ptrw();
+			if (bytes_per_row == row_size) {
+				memcpy(w, plane_data[plane], row_size * plane_height);
+			} else {
+				for (size_t row = 0; row < plane_height; row++) {
+					memcpy(w + row * row_size, plane_data[plane] + row * bytes_per_row, row_size);
+				}
 			}
 
-			uint8_t *w = img_data[0].ptrw();
-			memcpy(w, dataY, new_width * new_height);
-
-			img[0].instantiate();
-			img[0]->set_data(new_width, new_height, 0, Image::FORMAT_R8, img_data[0]);
-		}
-
-		{
-			// do CbCr
-			size_t new_width = CVPixelBufferGetWidthOfPlane(pixelBuffer, 1);
-			size_t new_height = CVPixelBufferGetHeightOfPlane(pixelBuffer, 1);
-
-			if ((width[1] != new_width) || (height[1] != new_height)) {
-				width[1] = new_width;
-				height[1] = new_height;
-				img_data[1].resize(2 * new_width * new_height);
-			}
-
-			uint8_t *w = img_data[1].ptrw();
-			memcpy(w, dataCbCr, 2 * new_width * new_height);
-
-			///TODO OpenGL doesn't support FORMAT_RG8, need to do some form of conversion
-			img[1].instantiate();
-			img[1]->set_data(new_width, new_height, 0, Image::FORMAT_RG8, img_data[1]);
+			img[plane].instantiate();
+			img[plane]->set_data(plane_width, plane_height, false, plane_format[plane], img_data);
 		}
 
 		// set our texture...
@@ -30,8 +30,10 @@
 
 #include "csg.h"
 
+#include "core/math/dynamic_bvh.h"
 #include "core/math/geometry_2d.h"
 #include "core/math/math_funcs.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/sort_array.h"
 
 // Static helper functions.
@@ -280,14 +282,34 @@ void CSGBrush::copy_from(const CSGBrush &p_brush, const Transform3D &p_xform) {
 
 // CSGBrushOperation
 
+struct CSGFaceQueryResult {
+	LocalVector<int> *faces = nullptr;
+
+	_FORCE_INLINE_ bool operator()(void *p_data) {
+		faces->push_back((int)(intptr_t)p_data);
+		return false;
+	}
+};
+
 void CSGBrushOperation::merge_brushes(Operation p_operation, const CSGBrush &p_brush_a, const CSGBrush &p_brush_b, CSGBrush &r_merged_brush, float p_vertex_snap) {
 	// Check for face collisions and add necessary faces.
+	// Only face pairs with overlapping bounds can intersect, find them through a BVH of the faces of B.
 	Build2DFaceCollection build2DFaceCollection;
+	DynamicBVH face_bvh_b;
+	for (int j = 0; j < p_brush_b.faces.size(); j++) {
+		face_bvh_b.insert(p_brush_b.faces[j].aabb, (void *)(intptr_t)j);
+	}
+
+	LocalVector<int> candidates;
+	CSGFaceQueryResult query_result;
+	query_result.faces = &candidates;
 	for (int i = 0; i < p_brush_a.faces.size(); i++) {
-		for (int j = 0; j < p_brush_b.faces.size(); j++) {
-			if (p_brush_a.faces[i].aabb.intersects_inclusive(p_brush_b.faces[j].aabb)) {
-				update_faces(p_brush_a, i, p_brush_b, j, build2DFaceCollection, p_vertex_snap);
-			}
+		candidates.clear();
+		face_bvh_b.aabb_query(p_brush_a.faces[i].aabb, query_result);
+		// Keep the order of the exhaustive search, the generated faces depend on it.
+		candidates.sort();
+		for (uint32_t k = 0; k < candidates.size(); k++) {
+			update_faces(p_brush_a, i, p_brush_b, candidates[k], build2DFaceCollection, p_vertex_snap);
 		}
 	}
 
@@ -31,6 +31,8 @@
 #include "csg_shape.h"
 
 #include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 
 void CSGShape3D::set_use_collision(bool p_enable) {
 	if (use_collision == p_enable) {
@@ -162,6 +164,23 @@ void CSGShape3D::_make_dirty(bool p_parent_removing) {
 	dirty = true;
 }
 
+bool CSGShape3D::_is_subtree_thread_safe() const {
+	if (!_can_build_brush_in_thread()) {
+		return false;
+	}
+	for (int i = 0; i < get_child_count(); i++) {
+		const CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
+		if (child && child->is_visible() && !child->_is_subtree_thread_safe()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void CSGShape3D::_build_child_brush(uint32_t p_index, CSGShape3D **p_children) {
+	p_children[p_index]->_get_brush();
+}
+
 CSGBrush *CSGShape3D::_get_brush() {
 	if (dirty) {
 		if (brush) {
@@ -169,6 +188,22 @@ CSGBrush *CSGShape3D::_get_brush() {
 		}
 		brush = nullptr;
 
+		// Sibling subtrees don't share any state, so the dirty ones can be rebuilt in parallel.
+		// Only fan out from outside the pool, nested waits could starve it.
+		if (WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+			LocalVector<CSGShape3D *> dirty_children;
+			for (int i = 0; i < get_child_count(); i++) {
+				CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
+				if (child && child->dirty && child->is_visible() && child->_is_subtree_thread_safe()) {
+					dirty_children.push_back(child);
+				}
+			}
+			if (dirty_children.size() > 1) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CSGShape3D::_build_child_brush, dirty_children.ptr(), dirty_children.size(), -1, true, SNAME("CSGBrushes"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			}
+		}
+
 		CSGBrush *n = _build_brush();
 
 		for (int i = 0; i < get_child_count(); i++) {
@@ -108,9 +108,14 @@ private:
 	void _update_shape();
 	void _update_collision_faces();
 
+	bool _is_subtree_thread_safe() const;
+	void _build_child_brush(uint32_t p_index, CSGShape3D **p_children);
+
 protected:
 	void _notification(int p_what);
 	virtual CSGBrush *_build_brush() = 0;
+	// Whether _build_brush() only reads this node, so independent subtrees can be built on worker threads.
+	virtual bool _can_build_brush_in_thread() const { return true; }
 	void _make_dirty(bool p_parent_removing = false);
 
 	static void _bind_methods();
@@ -190,6 +195,8 @@ class CSGMesh3D : public CSGPrimitive3D {
 	GDCLASS(CSGMesh3D, CSGPrimitive3D);
 
 	virtual CSGBrush *_build_brush() override;
+	// Reading mesh arrays may have to go through the RenderingServer.
+	virtual bool _can_build_brush_in_thread() const override { return false; }
 
 	Ref<Mesh> mesh;
 	Ref<Material> material;
@@ -354,6 +361,8 @@ public:
 
 private:
 	virtual CSGBrush *_build_brush() override;
+	// The path mode reads another node and bakes its curve.
+	virtual bool _can_build_brush_in_thread() const override { return false; }
 
 	Vector<Vector2> polygon;
 	Ref<Material> material;
@@ -217,9 +217,10 @@ void ENetConnection::bandwidth_throttle() {
 	enet_host_bandwidth_throttle(host);
 }
 
-void ENetConnection::compress(CompressionMode p_mode) {
+void ENetConnection::compress(CompressionMode p_mode, const Vector<uint8_t> &p_zstd_dictionary) {
 	ERR_FAIL_COND_MSG(!host, "The ENetConnection instance isn't currently active.");
-	Compressor::setup(host, p_mode);
+	ERR_FAIL_COND_MSG(!p_zstd_dictionary.is_empty() && p_mode != COMPRESS_ZSTD, "A compression dictionary can only be used with COMPRESS_ZSTD.");
+	Compressor::setup(host, p_mode, p_zstd_dictionary);
 }
 
 double ENetConnection::pop_statistic(HostStatistic p_stat) {
@@ -350,7 +351,7 @@ void ENetConnection::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("bandwidth_limit", "in_bandwidth", "out_bandwidth"), &ENetConnection::bandwidth_limit, DEFVAL(0), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("channel_limit", "limit"), &ENetConnection::channel_limit);
 	ClassDB::bind_method(D_METHOD("broadcast", "channel", "packet", "flags"), &ENetConnection::_broadcast);
-	ClassDB::bind_method(D_METHOD("compress", "mode"), &ENetConnection::compress);
+	ClassDB::bind_method(D_METHOD("compress", "mode", "zstd_dictionary"), &ENetConnection::compress, DEFVAL(PackedByteArray()));
 	ClassDB::bind_method(D_METHOD("dtls_server_setup", "key", "certificate"), &ENetConnection::dtls_server_setup);
 	ClassDB::bind_method(D_METHOD("dtls_client_setup", "certificate", "hostname", "verify"), &ENetConnection::dtls_client_setup, DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("refuse_new_connections", "refuse"), &ENetConnection::refuse_new_connections);
@@ -422,7 +423,7 @@ size_t ENetConnection::Compressor::enet_compress(void *context, const ENetBuffer
 	if (compressor->dst_mem.size() < req_size) {
 		compressor->dst_mem.resize(req_size);
 	}
-	int ret = Compression::compress(compressor->dst_mem.ptrw(), compressor->src_mem.ptr(), ofs, mode);
+	int ret = Compression::compress(compressor->dst_mem.ptrw(), compressor->src_mem.ptr(), ofs, mode, compressor->zstd_dictionary);
 
 	if (ret < 0) {
 		return 0;
@@ -448,7 +449,7 @@ size_t ENetConnection::Compressor::enet_decompress(void *context, const enet_uin
 			ret = Compression::decompress(outData, outLimit, inData, inLimit, Compression::MODE_DEFLATE);
 		} break;
 		case COMPRESS_ZSTD: {
-			ret = Compression::decompress(outData, outLimit, inData, inLimit, Compression::MODE_ZSTD);
+			ret = Compression::decompress(outData, outLimit, inData, inLimit, Compression::MODE_ZSTD, compressor->zstd_dictionary);
 		} break;
 		default: {
 		}
@@ -460,7 +461,7 @@ size_t ENetConnection::Compressor::enet_decompress(void *context, const enet_uin
 	}
 }
 
-void ENetConnection::Compressor::setup(ENetHost *p_host, CompressionMode p_mode) {
+void ENetConnection::Compressor::setup(ENetHost *p_host, CompressionMode p_mode, const Vector<uint8_t> &p_zstd_dictionary) {
 	ERR_FAIL_COND(!p_host);
 	switch (p_mode) {
 		case COMPRESS_NONE: {
@@ -472,16 +473,28 @@ void ENetConnection::Compressor::setup(ENetHost *p_host, CompressionMode p_mode)
 		case COMPRESS_FASTLZ:
 		case COMPRESS_ZLIB:
 		case COMPRESS_ZSTD: {
-			Compressor *compressor = memnew(Compressor(p_mode));
+			int dictionary = 0;
+			if (!p_zstd_dictionary.is_empty()) {
+				dictionary = Compression::add_zstd_dictionary(p_zstd_dictionary);
+				ERR_FAIL_COND(!dictionary);
+			}
+			Compressor *compressor = memnew(Compressor(p_mode, dictionary));
 			enet_host_compress(p_host, &(compressor->enet_compressor));
 		} break;
 	}
 }
 
-ENetConnection::Compressor::Compressor(CompressionMode p_mode) {
+ENetConnection::Compressor::Compressor(CompressionMode p_mode, int p_zstd_dictionary) {
 	mode = p_mode;
+	zstd_dictionary = p_zstd_dictionary;
 	enet_compressor.context = this;
 	enet_compressor.compress = enet_compress;
 	enet_compressor.decompress = enet_decompress;
 	enet_compressor.destroy = enet_compressor_destroy;
 }
+
+ENetConnection::Compressor::~Compressor() {
+	if (zstd_dictionary) {
+		Compression::remove_zstd_dictionary(zstd_dictionary);
+	}
+}
@@ -91,11 +91,12 @@ private:
 	class Compressor {
 	private:
 		CompressionMode mode = COMPRESS_NONE;
+		int zstd_dictionary = 0;
 		Vector<uint8_t> src_mem;
 		Vector<uint8_t> dst_mem;
 		ENetCompressor enet_compressor;
 
-		Compressor(CompressionMode mode);
+		Compressor(CompressionMode mode, int p_zstd_dictionary);
 
 		static size_t enet_compress(void *context, const ENetBuffer *inBuffers, size_t inBufferCount, size_t inLimit, enet_uint8 *outData, size_t outLimit);
 		static size_t enet_decompress(void *context, const enet_uint8 *inData, size_t inLimit, enet_uint8 *outData, size_t outLimit);
@@ -104,7 +105,8 @@ private:
 		}
 
 	public:
-		static void setup(ENetHost *p_host, CompressionMode p_mode);
+		static void setup(ENetHost *p_host, CompressionMode p_mode, const Vector<uint8_t> &p_zstd_dictionary);
+		~Compressor();
 	};
 
 public:
@@ -119,7 +121,7 @@ public:
 	void bandwidth_limit(int p_in_bandwidth = 0, int p_out_bandwidth = 0);
 	void channel_limit(int p_max_channels);
 	void bandwidth_throttle();
-	void compress(CompressionMode p_mode);
+	void compress(CompressionMode p_mode, const Vector<uint8_t> &p_zstd_dictionary = Vector<uint8_t>());
 	double pop_statistic(HostStatistic p_stat);
 	int get_max_channels() const;
 
@@ -31,6 +31,7 @@
 #include "enet_multiplayer_peer.h"
 #include "core/io/ip.h"
 #include "core/io/marshalls.h"
+#include "core/object/message_queue.h"
 #include "core/os/os.h"
 
 void ENetMultiplayerPeer::set_target_peer(int p_peer) {
@@ -39,21 +40,21 @@ void ENetMultiplayerPeer::set_target_peer(int p_peer) {
 
 int ENetMultiplayerPeer::get_packet_peer() const {
 	ERR_FAIL_COND_V_MSG(!_is_active(), 1, "The multiplayer instance isn't currently active.");
-	ERR_FAIL_COND_V(incoming_packets.size() == 0, 1);
+	ERR_FAIL_COND_V(get_available_packet_count() == 0, 1);
 
-	return incoming_packets.front()->get().from;
+	return incoming_packets[incoming_read].from;
 }
 
 MultiplayerPeer::TransferMode ENetMultiplayerPeer::get_packet_mode() const {
 	ERR_FAIL_COND_V_MSG(!_is_active(), TRANSFER_MODE_RELIABLE, "The multiplayer instance isn't currently active.");
-	ERR_FAIL_COND_V(incoming_packets.size() == 0, TRANSFER_MODE_RELIABLE);
-	return incoming_packets.front()->get().transfer_mode;
+	ERR_FAIL_COND_V(get_available_packet_count() == 0, TRANSFER_MODE_RELIABLE);
+	return incoming_packets[incoming_read].transfer_mode;
 }
 
 int ENetMultiplayerPeer::get_packet_channel() const {
 	ERR_FAIL_COND_V_MSG(!_is_active(), 1, "The multiplayer instance isn't currently active.");
-	ERR_FAIL_COND_V(incoming_packets.size() == 0, 1);
-	int ch = incoming_packets.front()->get().channel;
+	ERR_FAIL_COND_V(get_available_packet_count() == 0, 1);
+	int ch = incoming_packets[incoming_read].channel;
 	if (ch >= SYSCH_MAX) { // First 2 channels are reserved.
 		return ch - SYSCH_MAX + 1;
 	}
@@ -308,6 +309,7 @@ void ENetMultiplayerPeer::close() {
 
 	active_mode = MODE_NONE;
 	incoming_packets.clear();
+	incoming_read = 0;
 	peers.clear();
 	hosts.clear();
 	unique_id = 0;
@@ -316,16 +318,20 @@ void ENetMultiplayerPeer::close() {
 }
 
 int ENetMultiplayerPeer::get_available_packet_count() const {
-	return incoming_packets.size();
+	return incoming_packets.size() - incoming_read;
 }
 
 Error ENetMultiplayerPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
-	ERR_FAIL_COND_V_MSG(incoming_packets.size() == 0, ERR_UNAVAILABLE, "No incoming packets available.");
+	ERR_FAIL_COND_V_MSG(get_available_packet_count() == 0, ERR_UNAVAILABLE, "No incoming packets available.");
 
 	_pop_current_packet();
 
-	current_packet = incoming_packets.front()->get();
-	incoming_packets.pop_front();
+	current_packet = incoming_packets[incoming_read++];
+	if (incoming_read == incoming_packets.size()) {
+		// Drained, keep the allocated buffer for the next frame.
+		incoming_packets.clear();
+		incoming_read = 0;
+	}
 
 	*r_buffer = (const uint8_t *)(current_packet.packet->data);
 	r_buffer_size = current_packet.packet->dataLength;
@@ -388,12 +394,12 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 			peers[target_peer]->send(channel, packet);
 		}
 		ERR_FAIL_COND_V(!hosts.has(0), ERR_BUG);
-		hosts[0]->flush();
+		_flush_host(hosts[0]);
 
 	} else if (active_mode == MODE_CLIENT) {
 		peers[1]->send(channel, packet); // Send to server for broadcast.
 		ERR_FAIL_COND_V(!hosts.has(0), ERR_BUG);
-		hosts[0]->flush();
+		_flush_host(hosts[0]);
 
 	} else {
 		if (target_peer <= 0) {
@@ -404,13 +410,13 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 				}
 				E.value->send(channel, packet);
 				ERR_CONTINUE(!hosts.has(E.key));
-				hosts[E.key]->flush();
+				_flush_host(hosts[E.key]);
 			}
 			_destroy_unused(packet);
 		} else {
 			peers[target_peer]->send(channel, packet);
 			ERR_FAIL_COND_V(!hosts.has(target_peer), ERR_BUG);
-			hosts[target_peer]->flush();
+			_flush_host(hosts[target_peer]);
 		}
 	}
 
@@ -421,6 +427,39 @@ int ENetMultiplayerPeer::get_max_packet_size() const {
 	return 1 << 24; // Anything is good
 }
 
+void ENetMultiplayerPeer::_flush_host(Ref<ENetConnection> &p_host) {
+	if (!deferred_flush) {
+		p_host->flush();
+		return;
+	}
+	// Queued packets are coalesced by ENet into as few datagrams as possible when flushing.
+	if (!flush_queued) {
+		flush_queued = true;
+		MessageQueue::get_singleton()->push_call(get_instance_id(), SNAME("flush"));
+	}
+}
+
+void ENetMultiplayerPeer::flush() {
+	flush_queued = false;
+	if (!_is_active()) {
+		return;
+	}
+	for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
+		E.value->flush();
+	}
+}
+
+void ENetMultiplayerPeer::set_deferred_flush(bool p_enabled) {
+	if (deferred_flush && !p_enabled && flush_queued) {
+		flush();
+	}
+	deferred_flush = p_enabled;
+}
+
+bool ENetMultiplayerPeer::is_deferred_flush() const {
+	return deferred_flush;
+}
+
 void ENetMultiplayerPeer::_pop_current_packet() {
 	if (current_packet.packet) {
 		current_packet.packet->referenceCount--;
@@ -479,7 +518,11 @@ void ENetMultiplayerPeer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_host"), &ENetMultiplayerPeer::get_host);
 	ClassDB::bind_method(D_METHOD("get_peer", "id"), &ENetMultiplayerPeer::get_peer);
+	ClassDB::bind_method(D_METHOD("set_deferred_flush", "enabled"), &ENetMultiplayerPeer::set_deferred_flush);
+	ClassDB::bind_method(D_METHOD("is_deferred_flush"), &ENetMultiplayerPeer::is_deferred_flush);
+	ClassDB::bind_method(D_METHOD("flush"), &ENetMultiplayerPeer::flush);
 
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "deferred_flush"), "set_deferred_flush", "is_deferred_flush");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "host", PROPERTY_HINT_RESOURCE_TYPE, "ENetConnection", PROPERTY_USAGE_NONE), "", "get_host");
 }
 
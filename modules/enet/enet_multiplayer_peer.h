@@ -32,6 +32,7 @@
 #define ENET_MULTIPLAYER_PEER_H
 
 #include "core/crypto/crypto.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/multiplayer_peer.h"
 
 #include "enet_connection.h"
@@ -77,7 +78,9 @@ private:
 		TransferMode transfer_mode = TRANSFER_MODE_RELIABLE;
 	};
 
-	List<Packet> incoming_packets;
+	// Received packets are queued in a reused buffer and consumed from incoming_read on.
+	LocalVector<Packet> incoming_packets;
+	uint32_t incoming_read = 0;
 
 	Packet current_packet;
 
@@ -85,9 +88,12 @@ private:
 	void _pop_current_packet();
 	void _disconnect_inactive_peers();
 	void _destroy_unused(ENetPacket *p_packet);
+	void _flush_host(Ref<ENetConnection> &p_host);
 	_FORCE_INLINE_ bool _is_active() const { return active_mode != MODE_NONE; }
 
 	IPAddress bind_ip;
+	bool deferred_flush = false;
+	bool flush_queued = false;
 
 protected:
 	static void _bind_methods();
@@ -125,6 +131,10 @@ public:
 
 	void set_bind_ip(const IPAddress &p_ip);
 
+	void set_deferred_flush(bool p_enabled);
+	bool is_deferred_flush() const;
+	void flush();
+
 	Ref<ENetConnection> get_host() const;
 	Ref<ENetPacketPeer> get_peer(int p_id) const;
 
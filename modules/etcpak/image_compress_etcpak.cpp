@@ -30,6 +30,7 @@
 
 #include "image_compress_etcpak.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
@@ -88,6 +89,36 @@ void _compress_bc(Image *r_img, float p_lossy_quality, Image::UsedChannels p_cha
 	_compress_etcpak(type, r_img, p_lossy_quality);
 }
 
+struct EtcpakBlockRowsData {
+	EtcpakType compress_type = EtcpakType::ETCPAK_TYPE_ETC1;
+	const uint32_t *src = nullptr;
+	uint64_t *dst = nullptr;
+	int width = 0;
+	int dst_stride = 0; // In 64-bit words per row of blocks.
+};
+
+static void _compress_etcpak_blocks(EtcpakType p_compresstype, const uint32_t *p_src, uint64_t *p_dst, uint32_t p_blocks, int p_width) {
+	if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC1) {
+		CompressEtc1RgbDither(p_src, p_dst, p_blocks, p_width);
+	} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2 || p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG) {
+		CompressEtc2Rgb(p_src, p_dst, p_blocks, p_width, true);
+	} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA) {
+		CompressEtc2Rgba(p_src, p_dst, p_blocks, p_width, true);
+	} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT1) {
+		CompressDxt1Dither(p_src, p_dst, p_blocks, p_width);
+	} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG) {
+		CompressDxt5(p_src, p_dst, p_blocks, p_width);
+	} else {
+		ERR_FAIL_MSG("Invalid or unsupported Etcpak compression format.");
+	}
+}
+
+static void _compress_etcpak_block_row(void *p_userdata, uint32_t p_row) {
+	// Every row of 4x4 blocks is encoded independently, so rows can be compressed in parallel.
+	const EtcpakBlockRowsData *data = static_cast<const EtcpakBlockRowsData *>(p_userdata);
+	_compress_etcpak_blocks(data->compress_type, data->src + p_row * 4 * data->width, data->dst + p_row * data->dst_stride, data->width / 4, data->width);
+}
+
 void _compress_etcpak(EtcpakType p_compresstype, Image *r_img, float p_lossy_quality) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -220,18 +251,22 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img, float p_lossy_qua
 			// Override the src_mip_read pointer to our temporary Vector.
 			src_mip_read = padded_src.ptr();
 		}
-		if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC1) {
-			CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2 || p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG) {
-			CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, mip_w, true);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA) {
-			CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, mip_w, true);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT1) {
-			CompressDxt1Dither(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG) {
-			CompressDxt5(src_mip_read, dest_mip_write, blocks, mip_w);
+
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		// Waiting from inside the pool could leave no thread to run the rows, so compress serially there.
+		if (blocks >= 4096 && pool && pool->get_thread_count() > 1 && pool->get_thread_index() == -1) {
+			EtcpakBlockRowsData rows_data;
+			rows_data.compress_type = p_compresstype;
+			rows_data.src = src_mip_read;
+			rows_data.dst = dest_mip_write;
+			rows_data.width = mip_w;
+			bool two_words = p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG;
+			rows_data.dst_stride = (mip_w / 4) * (two_words ? 2 : 1);
+
+			WorkerThreadPool::GroupID group_task = pool->add_native_group_task(&_compress_etcpak_block_row, &rows_data, mip_h / 4, -1, true, SNAME("EtcpakCompress"));
+			pool->wait_for_group_task_completion(group_task);
 		} else {
-			ERR_FAIL_MSG("Invalid or unsupported Etcpak compression format.");
+			_compress_etcpak_blocks(p_compresstype, src_mip_read, dest_mip_write, blocks, mip_w);
 		}
 	}
 
@@ -68,17 +68,20 @@ Dictionary GDScriptSyntaxHighlighter::_get_line_syntax_highlighting_impl(int p_l
 	Color keyword_color;
 	Color color;
 
+	const int *prev_line_state = color_region_cache.getptr(p_line);
+	const int prev_region = prev_line_state ? *prev_line_state : -2;
+
 	color_region_cache[p_line] = -1;
 	int in_region = -1;
 	if (p_line != 0) {
 		int prev_region_line = p_line - 1;
-		while (prev_region_line > 0 && !color_region_cache.has(prev_region_line)) {
+		while (prev_region_line > 0 && !_is_line_highlighted(prev_region_line)) {
 			prev_region_line--;
 		}
 		for (int i = prev_region_line; i < p_line - 1; i++) {
 			get_line_syntax_highlighting(i);
 		}
-		if (!color_region_cache.has(p_line - 1)) {
+		if (!_is_line_highlighted(p_line - 1)) {
 			get_line_syntax_highlighting(p_line - 1);
 		}
 		in_region = color_region_cache[p_line - 1];
@@ -551,9 +554,20 @@ Dictionary GDScriptSyntaxHighlighter::_get_line_syntax_highlighting_impl(int p_l
 			color_map[j] = highlighter_info;
 		}
 	}
+
+	if (color_region_cache[p_line] != prev_region) {
+		// The following lines start in a different region now.
+		_invalidate_lines_after(p_line);
+	}
+
 	return color_map;
 }
 
+bool GDScriptSyntaxHighlighter::_lines_edited(int p_from_line, int p_to_line) {
+	_shift_line_states(color_region_cache, p_from_line, p_to_line);
+	return true;
+}
+
 String GDScriptSyntaxHighlighter::_get_name() const {
 	return "GDScript";
 }
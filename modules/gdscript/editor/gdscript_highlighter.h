@@ -47,6 +47,8 @@ private:
 	Vector<ColorRegion> color_regions;
 	HashMap<int, int> color_region_cache;
 
+	virtual bool _lines_edited(int p_from_line, int p_to_line) override;
+
 	HashMap<StringName, Color> class_names;
 	HashMap<StringName, Color> reserved_keywords;
 	HashMap<StringName, Color> member_keywords;
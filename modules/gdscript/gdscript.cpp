@@ -40,6 +40,7 @@
 #include "core/io/file_access_encrypted.h"
 #include "core/os/os.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_binary_tokens.h"
 #include "gdscript_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
@@ -808,6 +809,7 @@ String GDScript::_get_debug_path() const {
 }
 
 Error GDScript::reload(bool p_keep_state) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_SCRIPT);
 	if (reloading) {
 		return OK;
 	}
@@ -1057,7 +1059,11 @@ Error GDScript::load_source_code(const String &p_path) {
 	w[len] = 0;
 
 	String s;
-	if (s.parse_utf8((const char *)w) != OK) {
+	if (GDScriptBinaryTokens::is_binary(w, len)) {
+		sourcef.resize(len);
+		ERR_FAIL_COND_V_MSG(GDScriptBinaryTokens::decode_source(sourcef, s) != OK, ERR_FILE_CORRUPT, "Script '" + p_path + "' is a corrupted binary script.");
+		GDScriptCache::register_binary_script(p_path, sourcef, s);
+	} else if (s.parse_utf8((const char *)w) != OK) {
 		ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Script '" + p_path + "' contains invalid unicode (UTF-8), so it was not loaded. Please ensure that scripts are saved in valid UTF-8 unicode.");
 	}
 
@@ -2000,6 +2006,22 @@ void GDScriptLanguage::init() {
 		_add_global(E.name, E.ptr);
 	}
 
+	if (GLOBAL_GET("gdscript/parser/threaded_preparse")) {
+		// Named classes and autoloads are almost always needed, parse them and their dependencies up front.
+		Vector<String> paths;
+		List<StringName> global_classes;
+		ScriptServer::get_global_class_list(&global_classes);
+		for (const StringName &E : global_classes) {
+			if (ScriptServer::get_global_class_language(E) == get_name()) {
+				paths.push_back(ScriptServer::get_global_class_path(E));
+			}
+		}
+		for (const KeyValue<StringName, ProjectSettings::AutoloadInfo> &E : ProjectSettings::get_singleton()->get_autoload_list()) {
+			paths.push_back(E.value.path);
+		}
+		GDScriptCache::preparse_scripts(paths);
+	}
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -2423,14 +2445,13 @@ bool GDScriptLanguage::handles_global_class_type(const String &p_type) const {
 }
 
 String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_base_type, String *r_icon_path) const {
-	Vector<uint8_t> sourcef;
-	Error err;
-	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
-	if (err) {
+	if (!FileAccess::exists(p_path)) {
 		return String();
 	}
 
-	String source = f->get_as_utf8_string();
+	// Also handles exported binary scripts.
+	String source = GDScriptCache::get_source_code(p_path);
+	Error err;
 
 	GDScriptParser parser;
 	err = parser.parse(source, p_path, false);
@@ -2459,11 +2480,10 @@ String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_b
 						} else {
 							Vector<StringName> extend_classes = subclass->extends;
 
-							Ref<FileAccess> subfile = FileAccess::open(subclass->extends_path, FileAccess::READ);
-							if (subfile.is_null()) {
+							if (!FileAccess::exists(subclass->extends_path)) {
 								break;
 							}
-							String subsource = subfile->get_as_utf8_string();
+							String subsource = GDScriptCache::get_source_code(subclass->extends_path);
 
 							if (subsource.is_empty()) {
 								break;
@@ -2540,6 +2560,13 @@ GDScriptLanguage::GDScriptLanguage() {
 	int dmcs = GLOBAL_DEF("debug/settings/gdscript/max_call_stack", 1024);
 	ProjectSettings::get_singleton()->set_custom_property_info("debug/settings/gdscript/max_call_stack", PropertyInfo(Variant::INT, "debug/settings/gdscript/max_call_stack", PROPERTY_HINT_RANGE, "1024,4096,1,or_greater")); //minimum is 1024
 
+	bool jit_enabled = GLOBAL_DEF_RST("gdscript/jit/enabled", false);
+	int jit_threshold = GLOBAL_DEF_RST("gdscript/jit/call_threshold", 1000);
+	ProjectSettings::get_singleton()->set_custom_property_info("gdscript/jit/call_threshold", PropertyInfo(Variant::INT, "gdscript/jit/call_threshold", PROPERTY_HINT_RANGE, "1,100000,1,or_greater"));
+	GDScriptFunction::set_native_tier_threshold(jit_enabled ? MAX(jit_threshold, 1) : 0);
+
+	GLOBAL_DEF("gdscript/parser/threaded_preparse", true);
+
 	if (EngineDebugger::is_active()) {
 		//debugging enabled!
 
@@ -2655,10 +2682,9 @@ String ResourceFormatLoaderGDScript::get_resource_type(const String &p_path) con
 }
 
 void ResourceFormatLoaderGDScript::get_dependencies(const String &p_path, List<String> *p_dependencies, bool p_add_types) {
-	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
-	ERR_FAIL_COND_MSG(file.is_null(), "Cannot open file '" + p_path + "'.");
+	ERR_FAIL_COND_MSG(!FileAccess::exists(p_path), "Cannot open file '" + p_path + "'.");
 
-	String source = file->get_as_utf8_string();
+	String source = GDScriptCache::get_source_code(p_path);
 	if (source.is_empty()) {
 		return;
 	}
@@ -363,6 +363,12 @@ class GDScriptLanguage : public ScriptLanguage {
 
 	Mutex mutex;
 
+	// Stack buffers of finished function states, reused by the next `await`. Guarded by mutex.
+	enum {
+		FUNCTION_STATE_STACK_POOL_MAX = 256,
+	};
+	LocalVector<Vector<uint8_t>> function_state_stack_pool;
+
 	friend class GDScript;
 
 	SelfList<GDScript>::List script_list;
@@ -130,6 +130,8 @@ public:
 	Error resolve_body();
 	Error analyze();
 
+	const HashMap<String, Ref<GDScriptParserRef>> &get_depended_parsers() const { return depended_parsers; }
+
 	GDScriptAnalyzer(GDScriptParser *p_parser);
 };
 
@@ -0,0 +1,276 @@
+/*************************************************************************/
+/*  gdscript_binary_tokens.cpp                                           */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "gdscript_binary_tokens.h"
+
+#include "core/io/marshalls.h"
+#include "core/version.h"
+#include "gdscript_parser.h"
+
+static const uint8_t BINARY_MAGIC[4] = { 'G', 'D', 'S', 'C' };
+
+static String _get_engine_version() {
+	return String(VERSION_FULL_BUILD) + "." + String(VERSION_HASH);
+}
+
+class GDScriptBinaryWriter {
+	Vector<uint8_t> data;
+	uint64_t size = 0;
+
+	uint8_t *_grow(uint64_t p_bytes) {
+		if (size + p_bytes > (uint64_t)data.size()) {
+			data.resize(MAX(size + p_bytes, (uint64_t)data.size() * 2));
+		}
+		uint8_t *ptr = data.ptrw() + size;
+		size += p_bytes;
+		return ptr;
+	}
+
+public:
+	void put_u8(uint8_t p_value) {
+		*_grow(1) = p_value;
+	}
+
+	void put_u32(uint32_t p_value) {
+		encode_uint32(p_value, _grow(4));
+	}
+
+	void put_buffer(const uint8_t *p_buffer, uint64_t p_length) {
+		put_u32(p_length);
+		if (p_length > 0) {
+			memcpy(_grow(p_length), p_buffer, p_length);
+		}
+	}
+
+	void put_string(const String &p_string) {
+		CharString utf8 = p_string.utf8();
+		put_buffer((const uint8_t *)utf8.get_data(), utf8.length());
+	}
+
+	Vector<uint8_t> finish() {
+		data.resize(size);
+		return data;
+	}
+};
+
+class GDScriptBinaryReader {
+	const uint8_t *data = nullptr;
+	uint64_t length = 0;
+	uint64_t position = 0;
+
+public:
+	bool failed = false;
+
+	bool has(uint64_t p_bytes) {
+		if (position + p_bytes > length) {
+			failed = true;
+			return false;
+		}
+		return true;
+	}
+
+	uint8_t get_u8() {
+		if (!has(1)) {
+			return 0;
+		}
+		return data[position++];
+	}
+
+	uint32_t get_u32() {
+		if (!has(4)) {
+			return 0;
+		}
+		uint32_t value = decode_uint32(data + position);
+		position += 4;
+		return value;
+	}
+
+	const uint8_t *get_buffer(uint32_t &r_length) {
+		r_length = get_u32();
+		if (!has(r_length)) {
+			r_length = 0;
+			return nullptr;
+		}
+		const uint8_t *ptr = data + position;
+		position += r_length;
+		return ptr;
+	}
+
+	String get_string() {
+		uint32_t len = 0;
+		const uint8_t *ptr = get_buffer(len);
+		String string;
+		if (len > 0) {
+			string.parse_utf8((const char *)ptr, len);
+		}
+		return string;
+	}
+
+	void skip_buffer() {
+		uint32_t len = 0;
+		get_buffer(len);
+	}
+
+	GDScriptBinaryReader(const uint8_t *p_data, uint64_t p_length) :
+			data(p_data), length(p_length) {}
+};
+
+bool GDScriptBinaryTokens::is_binary(const uint8_t *p_data, uint64_t p_length) {
+	return p_length >= 8 && memcmp(p_data, BINARY_MAGIC, 4) == 0;
+}
+
+Vector<uint8_t> GDScriptBinaryTokens::compile(const String &p_source, const String &p_path) {
+	GDScriptParser parser;
+	parser.set_token_recording(true);
+	if (parser.parse(p_source, p_path, false) != OK) {
+		return Vector<uint8_t>();
+	}
+	return encode(p_source, parser.get_recorded_tokens());
+}
+
+Vector<uint8_t> GDScriptBinaryTokens::encode(const String &p_source, const Vector<GDScriptTokenizer::Token> &p_tokens) {
+	GDScriptBinaryWriter writer;
+
+	for (int i = 0; i < 4; i++) {
+		writer.put_u8(BINARY_MAGIC[i]);
+	}
+	writer.put_u32(FORMAT_VERSION);
+	writer.put_string(_get_engine_version());
+	writer.put_string(p_source);
+
+	// Token sources repeat a lot (keywords, punctuation, identifiers), so they go in a table.
+	HashMap<String, uint32_t> string_map;
+	Vector<String> strings;
+	LocalVector<uint32_t> token_strings;
+	token_strings.resize(p_tokens.size());
+	for (int i = 0; i < p_tokens.size(); i++) {
+		const String &source = p_tokens[i].source;
+		HashMap<String, uint32_t>::Iterator E = string_map.find(source);
+		if (E) {
+			token_strings[i] = E->value;
+		} else {
+			token_strings[i] = strings.size();
+			string_map.insert(source, strings.size());
+			strings.push_back(source);
+		}
+	}
+
+	writer.put_u32(strings.size());
+	for (int i = 0; i < strings.size(); i++) {
+		writer.put_string(strings[i]);
+	}
+
+	writer.put_u32(p_tokens.size());
+	Vector<uint8_t> literal_buffer;
+	for (int i = 0; i < p_tokens.size(); i++) {
+		const GDScriptTokenizer::Token &token = p_tokens[i];
+		writer.put_u8(token.type);
+		writer.put_u32(token.start_line);
+		writer.put_u32(token.end_line);
+		writer.put_u32(token.start_column);
+		writer.put_u32(token.end_column);
+		writer.put_u32(token.leftmost_column);
+		writer.put_u32(token.rightmost_column);
+		writer.put_u32(token_strings[i]);
+
+		if (token.literal.get_type() == Variant::NIL) {
+			writer.put_u32(0);
+			continue;
+		}
+		int len = 0;
+		Error err = encode_variant(token.literal, nullptr, len, false);
+		ERR_FAIL_COND_V(err != OK, Vector<uint8_t>());
+		literal_buffer.resize(len);
+		encode_variant(token.literal, literal_buffer.ptrw(), len, false);
+		writer.put_buffer(literal_buffer.ptr(), len);
+	}
+
+	return writer.finish();
+}
+
+Error GDScriptBinaryTokens::decode_source(const Vector<uint8_t> &p_data, String &r_source) {
+	ERR_FAIL_COND_V(!is_binary(p_data), ERR_FILE_UNRECOGNIZED);
+
+	GDScriptBinaryReader reader(p_data.ptr() + 4, p_data.size() - 4);
+	reader.get_u32(); // Format version, the source is always at the same place.
+	reader.skip_buffer();
+	r_source = reader.get_string();
+	ERR_FAIL_COND_V(reader.failed, ERR_FILE_CORRUPT);
+	return OK;
+}
+
+Error GDScriptBinaryTokens::decode_tokens(const Vector<uint8_t> &p_data, Vector<GDScriptTokenizer::Token> &r_tokens) {
+	ERR_FAIL_COND_V(!is_binary(p_data), ERR_FILE_UNRECOGNIZED);
+
+	GDScriptBinaryReader reader(p_data.ptr() + 4, p_data.size() - 4);
+	if (reader.get_u32() != FORMAT_VERSION || reader.get_string() != _get_engine_version()) {
+		return OK; // Written by another engine version, the source must be parsed instead.
+	}
+	reader.skip_buffer();
+
+	uint32_t string_count = reader.get_u32();
+	ERR_FAIL_COND_V(reader.failed, ERR_FILE_CORRUPT);
+	Vector<String> strings;
+	strings.resize(string_count);
+	for (uint32_t i = 0; i < string_count; i++) {
+		strings.write[i] = reader.get_string();
+	}
+
+	uint32_t token_count = reader.get_u32();
+	ERR_FAIL_COND_V(reader.failed, ERR_FILE_CORRUPT);
+	r_tokens.resize(token_count);
+	GDScriptTokenizer::Token *tokens = r_tokens.ptrw();
+	for (uint32_t i = 0; i < token_count; i++) {
+		GDScriptTokenizer::Token &token = tokens[i];
+		uint8_t type = reader.get_u8();
+		ERR_FAIL_COND_V(type >= GDScriptTokenizer::Token::TK_MAX, ERR_FILE_CORRUPT);
+		token.type = GDScriptTokenizer::Token::Type(type);
+		token.start_line = reader.get_u32();
+		token.end_line = reader.get_u32();
+		token.start_column = reader.get_u32();
+		token.end_column = reader.get_u32();
+		token.leftmost_column = reader.get_u32();
+		token.rightmost_column = reader.get_u32();
+
+		uint32_t string_index = reader.get_u32();
+		ERR_FAIL_COND_V(string_index >= string_count, ERR_FILE_CORRUPT);
+		token.source = strings[string_index];
+
+		uint32_t literal_length = 0;
+		const uint8_t *literal = reader.get_buffer(literal_length);
+		if (literal_length > 0) {
+			Error err = decode_variant(token.literal, literal, literal_length, nullptr, false);
+			ERR_FAIL_COND_V(err != OK, ERR_FILE_CORRUPT);
+		}
+		ERR_FAIL_COND_V(reader.failed, ERR_FILE_CORRUPT);
+	}
+
+	return OK;
+}
@@ -0,0 +1,59 @@
+/*************************************************************************/
+/*  gdscript_binary_tokens.h                                             */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GDSCRIPT_BINARY_TOKENS_H
+#define GDSCRIPT_BINARY_TOKENS_H
+
+#include "gdscript_tokenizer.h"
+
+// Exported scripts store the tokens the parser consumed, next to the source code.
+// Loading them skips the tokenizer entirely. The source is kept so scripts written
+// by a different engine version can still be parsed from text.
+class GDScriptBinaryTokens {
+public:
+	enum {
+		FORMAT_VERSION = 1,
+	};
+
+	static bool is_binary(const uint8_t *p_data, uint64_t p_length);
+	static bool is_binary(const Vector<uint8_t> &p_data) { return is_binary(p_data.ptr(), p_data.size()); }
+
+	// Parses the source and returns the data to write in place of the script.
+	// Returns an empty buffer if the source has parse errors.
+	static Vector<uint8_t> compile(const String &p_source, const String &p_path);
+	static Vector<uint8_t> encode(const String &p_source, const Vector<GDScriptTokenizer::Token> &p_tokens);
+
+	// Tokens are only decoded when the data was written by this engine version,
+	// otherwise r_tokens is left empty.
+	static Error decode_source(const Vector<uint8_t> &p_data, String &r_source);
+	static Error decode_tokens(const Vector<uint8_t> &p_data, Vector<GDScriptTokenizer::Token> &r_tokens);
+};
+
+#endif // GDSCRIPT_BINARY_TOKENS_H
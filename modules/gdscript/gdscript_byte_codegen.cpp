@@ -220,6 +220,17 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_global_names_count = 0;
 	}
 
+	// Candidate for the native tier: typed signature and no Variant-generic operations.
+	function->fully_typed = !untyped_code && function->return_type.has_type;
+	for (int i = 0; i < function->argument_types.size(); i++) {
+		function->fully_typed = function->fully_typed && function->argument_types[i].has_type;
+	}
+
+	if (inline_cache_count) {
+		function->inline_caches = memnew_arr(GDScriptFunction::InlineCache, inline_cache_count);
+		function->inline_cache_count = inline_cache_count;
+	}
+
 	if (opcodes.size()) {
 		function->code = opcodes;
 		function->_code_ptr = &function->code[0];
@@ -555,6 +566,7 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 	}
 
 	// No specific types, perform variant evaluation.
+	untyped_code = true;
 	append(GDScriptFunction::OPCODE_OPERATOR, 3);
 	append(p_left_operand);
 	append(Address());
@@ -572,6 +584,43 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 			}
 		}
 
+		Variant::Type operand_type = p_left_operand.type.builtin_type;
+		if (operand_type == p_right_operand.type.builtin_type && (operand_type == Variant::INT || operand_type == Variant::FLOAT)) {
+			bool is_compare = false;
+			bool inlined = true;
+			switch (p_operator) {
+				case Variant::OP_ADD:
+				case Variant::OP_SUBTRACT:
+				case Variant::OP_MULTIPLY:
+					break;
+				case Variant::OP_EQUAL:
+				case Variant::OP_NOT_EQUAL:
+				case Variant::OP_LESS:
+				case Variant::OP_LESS_EQUAL:
+				case Variant::OP_GREATER:
+				case Variant::OP_GREATER_EQUAL:
+					is_compare = true;
+					break;
+				default:
+					inlined = false; // Division and modulo need the evaluator's checks.
+			}
+
+			if (inlined) {
+				int pos = opcodes.size();
+				append(operand_type == Variant::INT ? GDScriptFunction::OPCODE_OPERATOR_VALIDATED_INT : GDScriptFunction::OPCODE_OPERATOR_VALIDATED_FLOAT, 3);
+				append(p_left_operand);
+				append(p_right_operand);
+				append(p_target);
+				append(p_operator);
+
+				if (is_compare && p_target.mode == Address::TEMPORARY) {
+					last_typed_compare_pos = pos;
+					last_typed_compare_target = p_target.address;
+				}
+				return;
+			}
+		}
+
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
@@ -584,6 +633,7 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 	}
 
 	// No specific types, perform variant evaluation.
+	untyped_code = true;
 	append(GDScriptFunction::OPCODE_OPERATOR, 3);
 	append(p_left_operand);
 	append(p_right_operand);
@@ -591,6 +641,23 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 	append(p_operator);
 }
 
+bool GDScriptByteCodeGenerator::fuse_compare_jump_if_not(const Address &p_condition) {
+	// Only when the condition is the result of the instruction just written, and nothing jumps in between.
+	if (last_typed_compare_pos < 0 || last_typed_compare_pos + 5 != opcodes.size() || last_jump_target_pos == opcodes.size()) {
+		return false;
+	}
+	if (p_condition.mode != Address::TEMPORARY || p_condition.address != last_typed_compare_target) {
+		return false;
+	}
+
+	// Same layout plus the jump target, which the caller appends. The temporary still receives the result.
+	int code = opcodes[last_typed_compare_pos];
+	GDScriptFunction::Opcode fused = (code & GDScriptFunction::INSTR_MASK) == GDScriptFunction::OPCODE_OPERATOR_VALIDATED_INT ? GDScriptFunction::OPCODE_JUMP_IF_NOT_COMPARE_INT : GDScriptFunction::OPCODE_JUMP_IF_NOT_COMPARE_FLOAT;
+	opcodes.write[last_typed_compare_pos] = (fused & GDScriptFunction::INSTR_MASK) | (code & ~GDScriptFunction::INSTR_MASK);
+	last_typed_compare_pos = -1;
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const Address &p_source, const Address &p_type) {
 	append(GDScriptFunction::OPCODE_EXTENDS_TEST, 3);
 	append(p_source);
@@ -606,15 +673,19 @@ void GDScriptByteCodeGenerator::write_type_test_builtin(const Address &p_target,
 }
 
 void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
-	append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
-	append(p_left_operand);
+	if (!fuse_compare_jump_if_not(p_left_operand)) {
+		append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
+		append(p_left_operand);
+	}
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
-	append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
-	append(p_right_operand);
+	if (!fuse_compare_jump_if_not(p_right_operand)) {
+		append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
+		append(p_right_operand);
+	}
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -670,8 +741,10 @@ void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_ternary_condition(const Address &p_condition) {
-	append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
-	append(p_condition);
+	if (!fuse_compare_jump_if_not(p_condition)) {
+		append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
+		append(p_condition);
+	}
 	ternary_jump_fail_pos.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -724,6 +797,7 @@ void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address
 		}
 	}
 
+	untyped_code = true;
 	append(GDScriptFunction::OPCODE_SET_KEYED, 3);
 	append(p_target);
 	append(p_index);
@@ -751,6 +825,7 @@ void GDScriptByteCodeGenerator::write_get(const Address &p_target, const Address
 			return;
 		}
 	}
+	untyped_code = true;
 	append(GDScriptFunction::OPCODE_GET_KEYED, 3);
 	append(p_source);
 	append(p_index);
@@ -767,10 +842,12 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 		append(setter);
 		return;
 	}
+	untyped_code = true;
 	append(GDScriptFunction::OPCODE_SET_NAMED, 2);
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -782,10 +859,12 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 		append(getter);
 		return;
 	}
+	untyped_code = true;
 	append(GDScriptFunction::OPCODE_GET_NAMED, 2);
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -929,6 +1008,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_super_call(const Address &p_target, const StringName &p_function_name, const Vector<Address> &p_arguments) {
@@ -950,6 +1030,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_call_gdscript_utility(const Address &p_target, GDScriptUtilityFunctions::FunctionPtr p_function, const Vector<Address> &p_arguments) {
@@ -1197,6 +1278,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, const StringName &p_function_name, const Vector<Address> &p_arguments) {
@@ -1208,6 +1290,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_target, const Address &p_base, const StringName &p_function_name, const Vector<Address> &p_arguments) {
@@ -1219,6 +1302,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_lambda(const Address &p_target, GDScriptFunction *p_function, const Vector<Address> &p_captures, bool p_use_self) {
@@ -1327,8 +1411,10 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
-	append(p_condition);
+	if (!fuse_compare_jump_if_not(p_condition)) {
+		append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
+		append(p_condition);
+	}
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1522,12 +1608,15 @@ void GDScriptByteCodeGenerator::write_endfor() {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	last_jump_target_pos = opcodes.size();
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
-	append(p_condition);
+	if (!fuse_compare_jump_if_not(p_condition)) {
+		append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
+		append(p_condition);
+	}
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
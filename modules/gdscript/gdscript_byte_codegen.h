@@ -115,6 +115,16 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	List<List<int>> current_breaks_to_patch;
 	List<List<int>> match_continues_to_patch;
 
+	// Last typed int/float comparison written, so a jump-if-not on its result can be fused into it.
+	int last_typed_compare_pos = -1;
+	uint32_t last_typed_compare_target = 0;
+	// Last position used as a jump target, which must not end up inside a fused instruction.
+	int last_jump_target_pos = -1;
+	// Set when an operation has to go through generic Variant code, see GDScriptFunction::fully_typed.
+	bool untyped_code = false;
+	// Number of inline cache slots handed out, see GDScriptFunction::InlineCache.
+	int inline_cache_count = 0;
+
 	void add_stack_identifier(const StringName &p_id, int p_stackpos) {
 		if (locals.size() > max_locals) {
 			max_locals = locals.size();
@@ -396,14 +406,21 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.push_back(get_method_bind_pos(p_method));
 	}
 
+	void append_inline_cache() {
+		opcodes.push_back(inline_cache_count++);
+	}
+
 	void append(GDScriptFunction *p_lambda_function) {
 		opcodes.push_back(get_lambda_function_pos(p_lambda_function));
 	}
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		last_jump_target_pos = opcodes.size();
 	}
 
+	bool fuse_compare_jump_if_not(const Address &p_condition);
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
@@ -31,9 +31,12 @@
 #include "gdscript_cache.h"
 
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/vector.h"
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_binary_tokens.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 #include "scene/resources/packed_scene.h"
@@ -116,7 +119,11 @@ GDScriptParserRef::~GDScriptParserRef() {
 	clear();
 
 	MutexLock lock(GDScriptCache::singleton->mutex);
-	GDScriptCache::singleton->parser_map.erase(path);
+	// A parser discarded by `preparse_scripts()` must not remove the one that is actually in use.
+	HashMap<String, GDScriptParserRef *>::Iterator E = GDScriptCache::singleton->parser_map.find(path);
+	if (E && E->value == this) {
+		GDScriptCache::singleton->parser_map.remove(E);
+	}
 }
 
 GDScriptCache *GDScriptCache::singleton = nullptr;
@@ -144,6 +151,11 @@ void GDScriptCache::move_script(const String &p_from, const String &p_to) {
 	}
 	singleton->parser_map.erase(p_from);
 
+	if (singleton->preparsed_parsers.has(p_from) && !p_from.is_empty()) {
+		singleton->preparsed_parsers[p_to] = singleton->preparsed_parsers[p_from];
+	}
+	singleton->preparsed_parsers.erase(p_from);
+
 	if (singleton->shallow_gdscript_cache.has(p_from) && !p_from.is_empty()) {
 		singleton->shallow_gdscript_cache[p_to] = singleton->shallow_gdscript_cache[p_from];
 	}
@@ -179,10 +191,12 @@ void GDScriptCache::remove_script(const String &p_path) {
 		singleton->parser_map[p_path]->clear();
 		singleton->parser_map.erase(p_path);
 	}
+	singleton->preparsed_parsers.erase(p_path);
 
 	singleton->dependencies.erase(p_path);
 	singleton->shallow_gdscript_cache.erase(p_path);
 	singleton->full_gdscript_cache.erase(p_path);
+	singleton->binary_scripts.erase(p_path);
 }
 
 Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptParserRef::Status p_status, Error &r_error, const String &p_owner) {
@@ -197,6 +211,8 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 			r_error = ERR_INVALID_DATA;
 			return ref;
 		}
+		// The requester owns it from now on.
+		singleton->preparsed_parsers.erase(p_path);
 	} else {
 		if (!FileAccess::exists(p_path)) {
 			r_error = ERR_FILE_NOT_FOUND;
@@ -213,6 +229,78 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 	return ref;
 }
 
+struct GDScriptPreparseTask {
+	LocalVector<Ref<GDScriptParserRef>> parsers;
+};
+
+void GDScriptCache::_preparse_script(void *p_userdata, uint32_t p_index) {
+	GDScriptPreparseTask *task = (GDScriptPreparseTask *)p_userdata;
+	Ref<GDScriptParserRef> &ref = task->parsers[p_index];
+	// Parsers are not shared until the whole batch is done, so they can run concurrently.
+	ref->result = ref->parser->parse(get_source_code(ref->path), ref->path, false);
+	ref->status = GDScriptParserRef::PARSED;
+}
+
+void GDScriptCache::preparse_scripts(const Vector<String> &p_paths) {
+	if (singleton == nullptr) {
+		return;
+	}
+
+	// Parse the scripts and everything they `extends` or `preload()` level by level,
+	// each level in parallel. Analysis stays on the requesting thread, since it
+	// resolves types through ClassDB, ScriptServer and the cache recursively.
+	HashSet<String> visited;
+	Vector<String> pending = p_paths;
+	while (!pending.is_empty()) {
+		GDScriptPreparseTask task;
+		{
+			MutexLock lock(singleton->mutex);
+			if (singleton->cleared) {
+				return;
+			}
+			for (const String &path : pending) {
+				if (visited.has(path)) {
+					continue;
+				}
+				visited.insert(path);
+				if (path.get_extension() != "gd" || singleton->parser_map.has(path) || !FileAccess::exists(path)) {
+					continue;
+				}
+				Ref<GDScriptParserRef> ref;
+				ref.instantiate();
+				ref->parser = memnew(GDScriptParser);
+				ref->path = path;
+				task.parsers.push_back(ref);
+			}
+		}
+		pending.clear();
+
+		if (task.parsers.is_empty()) {
+			break;
+		}
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&GDScriptCache::_preparse_script, &task, task.parsers.size(), -1, true, SNAME("GDScriptPreparse"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		MutexLock lock(singleton->mutex);
+		if (singleton->cleared) {
+			return;
+		}
+		for (uint32_t i = 0; i < task.parsers.size(); i++) {
+			Ref<GDScriptParserRef> &ref = task.parsers[i];
+			for (const String &E : ref->parser->get_dependencies()) {
+				pending.push_back(E);
+			}
+			if (singleton->parser_map.has(ref->path)) {
+				// Requested meanwhile by another thread, keep that one.
+				continue;
+			}
+			singleton->parser_map[ref->path] = ref.ptr();
+			singleton->preparsed_parsers[ref->path] = ref;
+		}
+	}
+}
+
 String GDScriptCache::get_source_code(const String &p_path) {
 	Vector<uint8_t> source_file;
 	Error err;
@@ -226,12 +314,55 @@ String GDScriptCache::get_source_code(const String &p_path) {
 	source_file.write[len] = 0;
 
 	String source;
+	if (GDScriptBinaryTokens::is_binary(source_file.ptr(), len)) {
+		source_file.resize(len);
+		ERR_FAIL_COND_V_MSG(GDScriptBinaryTokens::decode_source(source_file, source) != OK, "", "Script '" + p_path + "' is a corrupted binary script.");
+		register_binary_script(p_path, source_file, source);
+		return source;
+	}
+
 	if (source.parse_utf8((const char *)source_file.ptr()) != OK) {
 		ERR_FAIL_V_MSG("", "Script '" + p_path + "' contains invalid unicode (UTF-8), so it was not loaded. Please ensure that scripts are saved in valid UTF-8 unicode.");
 	}
 	return source;
 }
 
+void GDScriptCache::register_binary_script(const String &p_path, const Vector<uint8_t> &p_data, const String &p_source) {
+	if (singleton == nullptr) {
+		return;
+	}
+
+	MutexLock lock(singleton->mutex);
+	BinaryScript &binary = singleton->binary_scripts[p_path];
+	binary.data = p_data;
+	binary.source_hash = p_source.hash();
+}
+
+bool GDScriptCache::get_binary_tokens(const String &p_path, const String &p_source, Vector<GDScriptTokenizer::Token> &r_tokens) {
+	if (singleton == nullptr) {
+		return false;
+	}
+
+	Vector<uint8_t> data;
+	{
+		MutexLock lock(singleton->mutex);
+		HashMap<String, BinaryScript>::Iterator E = singleton->binary_scripts.find(p_path);
+		if (!E) {
+			return false;
+		}
+		// The source may have been replaced since it was loaded, e.g. by a hot reload.
+		if (E->value.source_hash != p_source.hash()) {
+			return false;
+		}
+		data = E->value.data;
+	}
+
+	if (GDScriptBinaryTokens::decode_tokens(data, r_tokens) != OK) {
+		r_tokens.clear();
+	}
+	return !r_tokens.is_empty();
+}
+
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_error, const String &p_owner) {
 	MutexLock lock(singleton->mutex);
 	if (!p_owner.is_empty()) {
@@ -421,9 +552,11 @@ void GDScriptCache::clear() {
 	}
 
 	parser_map_refs.clear();
+	singleton->preparsed_parsers.clear();
 	singleton->parser_map.clear();
 	singleton->shallow_gdscript_cache.clear();
 	singleton->full_gdscript_cache.clear();
+	singleton->binary_scripts.clear();
 
 	singleton->packed_scene_cache.clear();
 	singleton->packed_scene_dependencies.clear();
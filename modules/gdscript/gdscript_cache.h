@@ -36,6 +36,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "gdscript.h"
+#include "gdscript_tokenizer.h"
 #include "scene/resources/packed_scene.h"
 
 class GDScriptAnalyzer;
@@ -81,6 +82,16 @@ class GDScriptCache {
 	HashMap<String, Ref<PackedScene>> packed_scene_cache;
 	HashMap<String, HashSet<String>> packed_scene_dependencies;
 
+	// Exported scripts that were loaded from the binary token format.
+	struct BinaryScript {
+		Vector<uint8_t> data;
+		uint32_t source_hash = 0;
+	};
+	HashMap<String, BinaryScript> binary_scripts;
+
+	// Parsers created ahead of time by `preparse_scripts()`, kept alive until requested.
+	HashMap<String, Ref<GDScriptParserRef>> preparsed_parsers;
+
 	friend class GDScript;
 	friend class GDScriptParserRef;
 	friend class GDScriptInstance;
@@ -91,11 +102,16 @@ class GDScriptCache {
 
 	Mutex mutex;
 
+	static void _preparse_script(void *p_userdata, uint32_t p_index);
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
 	static Ref<GDScriptParserRef> get_parser(const String &p_path, GDScriptParserRef::Status status, Error &r_error, const String &p_owner = String());
+	static void preparse_scripts(const Vector<String> &p_paths);
 	static String get_source_code(const String &p_path);
+	static void register_binary_script(const String &p_path, const Vector<uint8_t> &p_data, const String &p_source);
+	static bool get_binary_tokens(const String &p_path, const String &p_source, Vector<GDScriptTokenizer::Token> &r_tokens);
 	static Ref<GDScript> get_shallow_script(const String &p_path, Error &r_error, const String &p_owner = String());
 	static Ref<GDScript> get_full_script(const String &p_path, Error &r_error, const String &p_owner = String(), bool p_update_from_disk = false);
 	static Ref<GDScript> get_cached_script(const String &p_path);
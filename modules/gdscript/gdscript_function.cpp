@@ -138,6 +138,30 @@ void GDScriptFunction::debug_get_stack_member_state(int p_line, List<Pair<String
 	}
 }
 
+GDScriptFunction::NativeTierCompiler GDScriptFunction::native_tier_compiler = nullptr;
+uint32_t GDScriptFunction::native_tier_threshold = 0;
+SafeNumeric<uint32_t> GDScriptFunction::inline_cache_epoch;
+
+void GDScriptFunction::_add_inline_cache(int p_cache, const InlineCacheEntry &p_entry) {
+	InlineCache &cache = inline_caches[p_cache];
+	if (cache.fills.get() >= INLINE_CACHE_MAX_FILLS) {
+		return;
+	}
+	uint32_t fill = cache.fills.postincrement();
+	if (fill >= INLINE_CACHE_MAX_FILLS) {
+		return;
+	}
+
+	InlineCacheEntry *entry = memnew(InlineCacheEntry(p_entry));
+	entry->epoch = inline_cache_epoch.get();
+	{
+		MutexLock lock(inline_cache_mutex);
+		inline_cache_entries.push_back(entry);
+	}
+	// Round-robin, a replaced entry stays allocated so a concurrent reader never sees it freed.
+	cache.ways[fill % INLINE_CACHE_WAYS].store(entry, std::memory_order_release);
+}
+
 GDScriptFunction::GDScriptFunction() {
 	name = "<anonymous>";
 #ifdef DEBUG_ENABLED
@@ -151,6 +175,15 @@ GDScriptFunction::GDScriptFunction() {
 GDScriptFunction::~GDScriptFunction() {
 	get_script()->member_functions.erase(name);
 
+	// Other functions may have cached this one or its script's member layout.
+	invalidate_inline_caches();
+	if (inline_caches) {
+		memdelete_arr(inline_caches);
+	}
+	for (uint32_t i = 0; i < inline_cache_entries.size(); i++) {
+		memdelete(inline_cache_entries[i]);
+	}
+
 	for (int i = 0; i < lambdas.size(); i++) {
 		memdelete(lambdas[i]);
 	}
@@ -282,6 +315,9 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 #endif
 	}
 
+	// Either the VM or _clear_stack() destroyed the saved stack by now.
+	state.stack_size = 0;
+
 	return ret;
 }
 
@@ -310,9 +346,71 @@ GDScriptFunctionState::GDScriptFunctionState() :
 }
 
 GDScriptFunctionState::~GDScriptFunctionState() {
+	// Only holds values if the function was never resumed.
+	_clear_stack();
+
 	{
 		MutexLock lock(GDScriptLanguage::singleton->mutex);
 		scripts_list.remove_from_list();
 		instances_list.remove_from_list();
+
+		LocalVector<Vector<uint8_t>> &pool = GDScriptLanguage::singleton->function_state_stack_pool;
+		if (!state.stack.is_empty() && pool.size() < GDScriptLanguage::FUNCTION_STATE_STACK_POOL_MAX) {
+			pool.push_back(state.stack);
+			state.stack = Vector<uint8_t>();
+		}
 	}
 }
+
+/////////////////////
+
+bool GDScriptFunctionStateCallable::compare_equal(const CallableCustom *p_a, const CallableCustom *p_b) {
+	return static_cast<const GDScriptFunctionStateCallable *>(p_a)->function_state == static_cast<const GDScriptFunctionStateCallable *>(p_b)->function_state;
+}
+
+bool GDScriptFunctionStateCallable::compare_less(const CallableCustom *p_a, const CallableCustom *p_b) {
+	return static_cast<const GDScriptFunctionStateCallable *>(p_a)->function_state.ptr() < static_cast<const GDScriptFunctionStateCallable *>(p_b)->function_state.ptr();
+}
+
+uint32_t GDScriptFunctionStateCallable::hash() const {
+	return hash_one_uint64(function_state->get_instance_id());
+}
+
+String GDScriptFunctionStateCallable::get_as_text() const {
+	return "GDScriptFunctionState::resume";
+}
+
+CallableCustom::CompareEqualFunc GDScriptFunctionStateCallable::get_compare_equal_func() const {
+	return compare_equal;
+}
+
+CallableCustom::CompareLessFunc GDScriptFunctionStateCallable::get_compare_less_func() const {
+	return compare_less;
+}
+
+ObjectID GDScriptFunctionStateCallable::get_object() const {
+	return function_state->get_instance_id();
+}
+
+void GDScriptFunctionStateCallable::call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const {
+	r_call_error.error = Callable::CallError::CALL_OK;
+	Ref<GDScriptFunctionState> state = function_state;
+
+	// Same argument handling as _signal_callback(), without the bound state argument.
+	if (p_argcount == 0) {
+		r_return_value = state->resume();
+	} else if (p_argcount == 1) {
+		r_return_value = state->resume(*p_arguments[0]);
+	} else {
+		Array extra_args;
+		extra_args.resize(p_argcount);
+		for (int i = 0; i < p_argcount; i++) {
+			extra_args[i] = *p_arguments[i];
+		}
+		r_return_value = state->resume(extra_args);
+	}
+}
+
+GDScriptFunctionStateCallable::GDScriptFunctionStateCallable(const Ref<GDScriptFunctionState> &p_function_state) {
+	function_state = p_function_state;
+}
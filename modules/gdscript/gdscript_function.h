@@ -33,8 +33,10 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
@@ -219,6 +221,10 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_VALIDATED_INT, // Both operands typed int, operator inlined.
+		OPCODE_OPERATOR_VALIDATED_FLOAT, // Both operands typed float, operator inlined.
+		OPCODE_JUMP_IF_NOT_COMPARE_INT, // Fused typed int comparison and jump-if-not.
+		OPCODE_JUMP_IF_NOT_COMPARE_FLOAT, // Fused typed float comparison and jump-if-not.
 		OPCODE_EXTENDS_TEST,
 		OPCODE_IS_BUILTIN,
 		OPCODE_SET_KEYED,
@@ -429,6 +435,12 @@ public:
 		StringName identifier;
 	};
 
+	// Native code for a function. Setting r_deopt means nothing was executed and the call must run
+	// on the VM instead, after which the function stays there.
+	typedef Variant (*NativeCode)(GDScriptFunction *p_function, GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, bool &r_deopt);
+	// Called once for each fully typed function that reaches the call threshold, may return nullptr.
+	typedef NativeCode (*NativeTierCompiler)(GDScriptFunction *p_function);
+
 private:
 	friend class GDScript;
 	friend class GDScriptCompiler;
@@ -505,6 +517,73 @@ private:
 
 	HashMap<int, Variant::Type> temporary_slots;
 
+	// Native tier: see set_native_tier_compiler().
+	bool fully_typed = false;
+	bool native_tier_attempted = false;
+	SafeNumeric<uint32_t> native_tier_call_count;
+	NativeCode native_code = nullptr;
+
+	static NativeTierCompiler native_tier_compiler;
+	static uint32_t native_tier_threshold;
+
+	// Inline caches, one per OPCODE_CALL* and OPCODE_GET/SET_NAMED site. Entries are never modified once
+	// published and live until the function is freed, readers only need the acquire load.
+	struct InlineCacheEntry {
+		enum Kind {
+			KIND_SCRIPT_FUNCTION,
+			KIND_METHOD_BIND,
+			KIND_MEMBER,
+			KIND_GENERIC, // Known not to be cacheable, go straight to the generic path.
+		};
+		Kind kind = KIND_METHOD_BIND;
+		uint32_t epoch = 0;
+		ObjectID script_id;
+		const StringName *class_name = nullptr;
+		GDScriptFunction *function = nullptr;
+		MethodBind *method = nullptr;
+		int member_index = -1;
+		Variant::Type member_type = Variant::VARIANT_MAX; // VARIANT_MAX when the member is untyped.
+	};
+
+	enum {
+		INLINE_CACHE_WAYS = 4,
+		INLINE_CACHE_MAX_FILLS = 16, // Megamorphic past this, the site stays on the generic path.
+	};
+
+	struct InlineCache {
+		std::atomic<const InlineCacheEntry *> ways[INLINE_CACHE_WAYS] = {};
+		SafeNumeric<uint32_t> fills;
+	};
+
+	InlineCache *inline_caches = nullptr;
+	int inline_cache_count = 0;
+	LocalVector<InlineCacheEntry *> inline_cache_entries;
+	Mutex inline_cache_mutex;
+
+	// Bumped whenever functions or member layouts go away, entries from an older epoch never match.
+	static SafeNumeric<uint32_t> inline_cache_epoch;
+
+	_FORCE_INLINE_ const InlineCacheEntry *_find_inline_cache(int p_cache, ObjectID p_script_id, const StringName *p_class_name) const {
+		const InlineCache &cache = inline_caches[p_cache];
+		const uint32_t epoch = inline_cache_epoch.get();
+		for (int i = 0; i < INLINE_CACHE_WAYS; i++) {
+			const InlineCacheEntry *entry = cache.ways[i].load(std::memory_order_acquire);
+			if (entry && entry->epoch == epoch && entry->script_id == p_script_id && entry->class_name == p_class_name) {
+				return entry;
+			}
+		}
+		return nullptr;
+	}
+	void _add_inline_cache(int p_cache, const InlineCacheEntry &p_entry);
+
+	static GDScriptInstance *_get_gdscript_instance(ScriptInstance *p_script_instance);
+#ifndef DEBUG_ENABLED
+	bool _inline_cached_call(int p_cache, Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
+#endif
+	const InlineCacheEntry *_get_member_inline_cache(int p_cache, GDScriptInstance *p_instance, const StringName &p_name, InlineCacheEntry &r_filled, bool p_set);
+	bool _inline_cached_get_named(int p_cache, const Variant *p_base, const StringName &p_name, Variant *r_dst);
+	bool _inline_cached_set_named(int p_cache, Variant *p_base, const StringName &p_name, const Variant *p_value);
+
 #ifdef TOOLS_ENABLED
 	Vector<StringName> arg_names;
 	Vector<Variant> default_arg_values;
@@ -557,6 +636,13 @@ public:
 	};
 
 	_FORCE_INLINE_ bool is_static() const { return _static; }
+	_FORCE_INLINE_ bool is_fully_typed() const { return fully_typed; }
+
+	// No compiler is bundled, a backend registers one. The threshold comes from the gdscript/jit/* project settings, 0 disables tiering.
+	static void set_native_tier_compiler(NativeTierCompiler p_compiler) { native_tier_compiler = p_compiler; }
+	static void set_native_tier_threshold(uint32_t p_calls) { native_tier_threshold = p_calls; }
+
+	static void invalidate_inline_caches() { inline_cache_epoch.increment(); }
 
 	const int *get_code() const; //used for debug
 	int get_code_size() const;
@@ -608,6 +694,7 @@ public:
 class GDScriptFunctionState : public RefCounted {
 	GDCLASS(GDScriptFunctionState, RefCounted);
 	friend class GDScriptFunction;
+	friend class GDScriptFunctionStateCallable;
 	GDScriptFunction *function = nullptr;
 	GDScriptFunction::CallState state;
 	Variant _signal_callback(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
@@ -629,4 +716,24 @@ public:
 	~GDScriptFunctionState();
 };
 
+// Connected to the awaited signal, resumes the function state directly instead of
+// going through a bound method call with the state passed as extra argument.
+class GDScriptFunctionStateCallable : public CallableCustom {
+	Ref<GDScriptFunctionState> function_state;
+
+	static bool compare_equal(const CallableCustom *p_a, const CallableCustom *p_b);
+	static bool compare_less(const CallableCustom *p_a, const CallableCustom *p_b);
+
+public:
+	uint32_t hash() const override;
+	String get_as_text() const override;
+	CompareEqualFunc get_compare_equal_func() const override;
+	CompareLessFunc get_compare_less_func() const override;
+	ObjectID get_object() const override;
+	void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const override;
+
+	GDScriptFunctionStateCallable(const Ref<GDScriptFunctionState> &p_function_state);
+	virtual ~GDScriptFunctionStateCallable() = default;
+};
+
 #endif // GDSCRIPT_FUNCTION_H
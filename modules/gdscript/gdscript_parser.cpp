@@ -34,7 +34,10 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_defs.h"
+#include "core/os/mutex.h"
+#include "core/templates/safe_refcount.h"
 #include "gdscript.h"
+#include "gdscript_cache.h"
 #include "scene/main/multiplayer_api.h"
 
 #ifdef DEBUG_ENABLED
@@ -48,48 +51,15 @@
 #endif // TOOLS_ENABLED
 
 static HashMap<StringName, Variant::Type> builtin_types;
+static SafeFlag builtin_types_initialized;
+static Mutex builtin_types_mutex;
 Variant::Type GDScriptParser::get_builtin_type(const StringName &p_type) {
-	if (builtin_types.is_empty()) {
-		builtin_types["bool"] = Variant::BOOL;
-		builtin_types["int"] = Variant::INT;
-		builtin_types["float"] = Variant::FLOAT;
-		builtin_types["String"] = Variant::STRING;
-		builtin_types["Vector2"] = Variant::VECTOR2;
-		builtin_types["Vector2i"] = Variant::VECTOR2I;
-		builtin_types["Rect2"] = Variant::RECT2;
-		builtin_types["Rect2i"] = Variant::RECT2I;
-		builtin_types["Transform2D"] = Variant::TRANSFORM2D;
-		builtin_types["Vector3"] = Variant::VECTOR3;
-		builtin_types["Vector3i"] = Variant::VECTOR3I;
-		builtin_types["Vector4"] = Variant::VECTOR4;
-		builtin_types["Vector4i"] = Variant::VECTOR4I;
-		builtin_types["AABB"] = Variant::AABB;
-		builtin_types["Plane"] = Variant::PLANE;
-		builtin_types["Quaternion"] = Variant::QUATERNION;
-		builtin_types["Basis"] = Variant::BASIS;
-		builtin_types["Transform3D"] = Variant::TRANSFORM3D;
-		builtin_types["Projection"] = Variant::PROJECTION;
-		builtin_types["Color"] = Variant::COLOR;
-		builtin_types["RID"] = Variant::RID;
-		builtin_types["Object"] = Variant::OBJECT;
-		builtin_types["StringName"] = Variant::STRING_NAME;
-		builtin_types["NodePath"] = Variant::NODE_PATH;
-		builtin_types["Dictionary"] = Variant::DICTIONARY;
-		builtin_types["Callable"] = Variant::CALLABLE;
-		builtin_types["Signal"] = Variant::SIGNAL;
-		builtin_types["Array"] = Variant::ARRAY;
-		builtin_types["PackedByteArray"] = Variant::PACKED_BYTE_ARRAY;
-		builtin_types["PackedInt32Array"] = Variant::PACKED_INT32_ARRAY;
-		builtin_types["PackedInt64Array"] = Variant::PACKED_INT64_ARRAY;
-		builtin_types["PackedFloat32Array"] = Variant::PACKED_FLOAT32_ARRAY;
-		builtin_types["PackedFloat64Array"] = Variant::PACKED_FLOAT64_ARRAY;
-		builtin_types["PackedStringArray"] = Variant::PACKED_STRING_ARRAY;
-		builtin_types["PackedVector2Array"] = Variant::PACKED_VECTOR2_ARRAY;
-		builtin_types["PackedVector3Array"] = Variant::PACKED_VECTOR3_ARRAY;
-		builtin_types["PackedColorArray"] = Variant::PACKED_COLOR_ARRAY;
-		// NIL is not here, hence the -1.
-		if (builtin_types.size() != Variant::VARIANT_MAX - 1) {
-			ERR_PRINT("Outdated parser: amount of built-in types don't match the amount of types in Variant.");
+	// Scripts may be parsed from several threads at once, only fill the table once.
+	if (!builtin_types_initialized.is_set()) {
+		MutexLock lock(builtin_types_mutex);
+		if (!builtin_types_initialized.is_set()) {
+			_fill_builtin_types();
+			builtin_types_initialized.set();
 		}
 	}
 
@@ -99,8 +69,54 @@ Variant::Type GDScriptParser::get_builtin_type(const StringName &p_type) {
 	return Variant::VARIANT_MAX;
 }
 
+void GDScriptParser::_fill_builtin_types() {
+	builtin_types["bool"] = Variant::BOOL;
+	builtin_types["int"] = Variant::INT;
+	builtin_types["float"] = Variant::FLOAT;
+	builtin_types["String"] = Variant::STRING;
+	builtin_types["Vector2"] = Variant::VECTOR2;
+	builtin_types["Vector2i"] = Variant::VECTOR2I;
+	builtin_types["Rect2"] = Variant::RECT2;
+	builtin_types["Rect2i"] = Variant::RECT2I;
+	builtin_types["Transform2D"] = Variant::TRANSFORM2D;
+	builtin_types["Vector3"] = Variant::VECTOR3;
+	builtin_types["Vector3i"] = Variant::VECTOR3I;
+	builtin_types["Vector4"] = Variant::VECTOR4;
+	builtin_types["Vector4i"] = Variant::VECTOR4I;
+	builtin_types["AABB"] = Variant::AABB;
+	builtin_types["Plane"] = Variant::PLANE;
+	builtin_types["Quaternion"] = Variant::QUATERNION;
+	builtin_types["Basis"] = Variant::BASIS;
+	builtin_types["Transform3D"] = Variant::TRANSFORM3D;
+	builtin_types["Projection"] = Variant::PROJECTION;
+	builtin_types["Color"] = Variant::COLOR;
+	builtin_types["RID"] = Variant::RID;
+	builtin_types["Object"] = Variant::OBJECT;
+	builtin_types["StringName"] = Variant::STRING_NAME;
+	builtin_types["NodePath"] = Variant::NODE_PATH;
+	builtin_types["Dictionary"] = Variant::DICTIONARY;
+	builtin_types["Callable"] = Variant::CALLABLE;
+	builtin_types["Signal"] = Variant::SIGNAL;
+	builtin_types["Array"] = Variant::ARRAY;
+	builtin_types["PackedByteArray"] = Variant::PACKED_BYTE_ARRAY;
+	builtin_types["PackedInt32Array"] = Variant::PACKED_INT32_ARRAY;
+	builtin_types["PackedInt64Array"] = Variant::PACKED_INT64_ARRAY;
+	builtin_types["PackedFloat32Array"] = Variant::PACKED_FLOAT32_ARRAY;
+	builtin_types["PackedFloat64Array"] = Variant::PACKED_FLOAT64_ARRAY;
+	builtin_types["PackedStringArray"] = Variant::PACKED_STRING_ARRAY;
+	builtin_types["PackedVector2Array"] = Variant::PACKED_VECTOR2_ARRAY;
+	builtin_types["PackedVector3Array"] = Variant::PACKED_VECTOR3_ARRAY;
+	builtin_types["PackedColorArray"] = Variant::PACKED_COLOR_ARRAY;
+	// NIL is not here, hence the -1.
+	if (builtin_types.size() != Variant::VARIANT_MAX - 1) {
+		ERR_PRINT("Outdated parser: amount of built-in types don't match the amount of types in Variant.");
+	}
+}
+
 void GDScriptParser::cleanup() {
+	MutexLock lock(builtin_types_mutex);
 	builtin_types.clear();
+	builtin_types_initialized.clear();
 }
 
 void GDScriptParser::get_annotation_list(List<MethodInfo> *r_annotations) const {
@@ -169,6 +185,7 @@ void GDScriptParser::clear() {
 	_is_tool = false;
 	for_completion = false;
 	errors.clear();
+	dependencies.clear();
 	multiline_stack.clear();
 	nodes_in_progress.clear();
 }
@@ -319,6 +336,24 @@ void GDScriptParser::set_last_completion_call_arg(int p_argument) {
 }
 
 Error GDScriptParser::parse(const String &p_source_code, const String &p_script_path, bool p_for_completion) {
+	if (!p_for_completion) {
+		Vector<GDScriptTokenizer::Token> tokens;
+		if (GDScriptCache::get_binary_tokens(p_script_path, p_source_code, tokens)) {
+			tokenizer.set_replay_tokens(tokens);
+			Error err = _parse(p_source_code, p_script_path, false);
+			bool replayed = tokenizer.is_replay_finished();
+			tokenizer.set_replay_tokens(Vector<GDScriptTokenizer::Token>());
+			if (err == OK && replayed) {
+				return OK;
+			}
+			// The recorded tokens don't match what the parser expects, parse the source instead.
+		}
+	}
+
+	return _parse(p_source_code, p_script_path, p_for_completion);
+}
+
+Error GDScriptParser::_parse(const String &p_source_code, const String &p_script_path, bool p_for_completion) {
 	clear();
 
 	String source = p_source_code;
@@ -720,6 +755,7 @@ void GDScriptParser::parse_extends() {
 			push_error(vformat(R"(Only strings or identifiers can be used after "extends", found "%s" instead.)", Variant::get_type_name(previous.literal.get_type())));
 		}
 		current_class->extends_path = previous.literal;
+		add_dependency(current_class->extends_path);
 
 		if (!match(GDScriptTokenizer::Token::PERIOD)) {
 			return;
@@ -3087,6 +3123,13 @@ GDScriptParser::ExpressionNode *GDScriptParser::parse_preload(ExpressionNode *p_
 
 	pop_completion_call();
 
+	if (preload->path != nullptr && preload->path->type == Node::LITERAL) {
+		const Variant &path = static_cast<LiteralNode *>(preload->path)->value;
+		if (path.get_type() == Variant::STRING) {
+			add_dependency(path);
+		}
+	}
+
 	pop_multiline();
 	consume(GDScriptTokenizer::Token::PARENTHESIS_CLOSE, R"*(Expected ")" after preload path.)*");
 	complete_extents(preload);
@@ -3094,6 +3137,18 @@ GDScriptParser::ExpressionNode *GDScriptParser::parse_preload(ExpressionNode *p_
 	return preload;
 }
 
+void GDScriptParser::add_dependency(const String &p_path) {
+	if (p_path.is_empty()) {
+		return;
+	}
+	// Resolved the same way as the analyzer does for `extends` and `preload()`.
+	String path = p_path;
+	if (path.is_relative_path()) {
+		path = script_path.get_base_dir().path_join(path);
+	}
+	dependencies.insert(path.simplify_path());
+}
+
 GDScriptParser::ExpressionNode *GDScriptParser::parse_lambda(ExpressionNode *p_previous_operand, bool p_can_assign) {
 	LambdaNode *lambda = alloc_node<LambdaNode>();
 	lambda->parent_function = current_function;
@@ -37,6 +37,7 @@
 #include "core/string/string_name.h"
 #include "core/string/ustring.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/list.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/vector.h"
@@ -1222,6 +1223,8 @@ private:
 	ClassNode *head = nullptr;
 	Node *list = nullptr;
 	List<ParserError> errors;
+	// Paths of the scripts and resources referenced by constant `extends` and `preload()` paths.
+	HashSet<String> dependencies;
 
 #ifdef DEBUG_ENABLED
 	bool is_ignoring_warnings = false;
@@ -1321,6 +1324,7 @@ private:
 		return node;
 	}
 	void clear();
+	Error _parse(const String &p_source_code, const String &p_script_path, bool p_for_completion);
 	void push_error(const String &p_message, const Node *p_origin = nullptr);
 #ifdef DEBUG_ENABLED
 	void push_warning(const Node *p_source, GDScriptWarning::Code p_code, const String &p_symbol1 = String(), const String &p_symbol2 = String(), const String &p_symbol3 = String(), const String &p_symbol4 = String());
@@ -1418,6 +1422,8 @@ private:
 	ExpressionNode *parse_yield(ExpressionNode *p_previous_operand, bool p_can_assign);
 	ExpressionNode *parse_invalid_token(ExpressionNode *p_previous_operand, bool p_can_assign);
 	TypeNode *parse_type(bool p_allow_void = false);
+	void add_dependency(const String &p_path);
+	static void _fill_builtin_types();
 #ifdef TOOLS_ENABLED
 	// Doc comments.
 	int class_doc_line = 0x7FFFFFFF;
@@ -1428,6 +1434,8 @@ private:
 
 public:
 	Error parse(const String &p_source_code, const String &p_script_path, bool p_for_completion);
+	void set_token_recording(bool p_recording) { tokenizer.set_recording(p_recording); }
+	const Vector<GDScriptTokenizer::Token> &get_recorded_tokens() const { return tokenizer.get_recorded_tokens(); }
 	ClassNode *get_tree() const { return head; }
 	bool is_tool() const { return _is_tool; }
 	static Variant::Type get_builtin_type(const StringName &p_type);
@@ -1439,8 +1447,11 @@ public:
 
 	const List<ParserError> &get_errors() const { return errors; }
 	const List<String> get_dependencies() const {
-		// TODO: Keep track of deps.
-		return List<String>();
+		List<String> ret;
+		for (const String &E : dependencies) {
+			ret.push_back(E);
+		}
+		return ret;
 	}
 #ifdef DEBUG_ENABLED
 	const List<GDScriptWarning> &get_warnings() const { return warnings; }
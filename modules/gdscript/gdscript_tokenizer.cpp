@@ -1238,7 +1238,33 @@ void GDScriptTokenizer::_skip_whitespace() {
 	}
 }
 
+void GDScriptTokenizer::set_recording(bool p_recording) {
+	recording = p_recording;
+	recorded_tokens.clear();
+}
+
+void GDScriptTokenizer::set_replay_tokens(const Vector<Token> &p_tokens) {
+	replay_tokens = p_tokens;
+	replay_position = 0;
+}
+
 GDScriptTokenizer::Token GDScriptTokenizer::scan() {
+	if (!replay_tokens.is_empty()) {
+		if (replay_position < replay_tokens.size()) {
+			return replay_tokens[replay_position++];
+		}
+		// The parser asked for more tokens than were recorded, keep returning the end of file.
+		return replay_tokens[replay_tokens.size() - 1];
+	}
+
+	Token token = _scan();
+	if (recording) {
+		recorded_tokens.push_back(token);
+	}
+	return token;
+}
+
+GDScriptTokenizer::Token GDScriptTokenizer::_scan() {
 	if (has_error()) {
 		return pop_error();
 	}
@@ -1303,7 +1329,7 @@ GDScriptTokenizer::Token GDScriptTokenizer::scan() {
 		_advance();
 		newline(false);
 		line_continuation = true;
-		return scan(); // Recurse to get next token.
+		return _scan(); // Recurse to get next token.
 	}
 
 	line_continuation = false;
@@ -229,6 +229,13 @@ private:
 	HashMap<int, CommentData> comments;
 #endif // TOOLS_ENABLED
 
+	// Tokens are recorded as they are handed to the parser. Replaying them for the same
+	// source makes the parser take the exact same path without scanning the source again.
+	bool recording = false;
+	Vector<Token> recorded_tokens;
+	Vector<Token> replay_tokens;
+	int replay_position = 0;
+
 	_FORCE_INLINE_ bool _is_at_end() { return position >= length; }
 	_FORCE_INLINE_ char32_t _peek(int p_offset = 0) { return position + p_offset >= 0 && position + p_offset < length ? _current[p_offset] : '\0'; }
 	int indent_level() const { return indent_stack.size(); }
@@ -256,6 +263,8 @@ private:
 	Token string();
 	Token annotation();
 
+	Token _scan();
+
 public:
 	Token scan();
 
@@ -270,6 +279,12 @@ public:
 	void push_expression_indented_block(); // For lambdas, or blocks inside expressions.
 	void pop_expression_indented_block(); // For lambdas, or blocks inside expressions.
 
+	void set_recording(bool p_recording);
+	const Vector<Token> &get_recorded_tokens() const { return recorded_tokens; }
+	void set_replay_tokens(const Vector<Token> &p_tokens);
+	bool is_replaying() const { return !replay_tokens.is_empty(); }
+	bool is_replay_finished() const { return replay_position == replay_tokens.size(); }
+
 	GDScriptTokenizer();
 };
 
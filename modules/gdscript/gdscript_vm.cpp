@@ -227,11 +227,229 @@ void (*type_init_function_table[])(Variant *) = {
 	&VariantInitializer<PackedColorArray>::init, // PACKED_COLOR_ARRAY.
 };
 
+// Inlined operators for typed int and float operands, used by OPCODE_OPERATOR_VALIDATED_INT/FLOAT
+// and the fused compare-and-jump opcodes instead of calling a validated operator evaluator.
+// Returns false for operators the code generator never emits for them.
+template <typename T>
+static _FORCE_INLINE_ void _set_typed_operator_result(Variant *r_dst, T p_value) {
+	VariantTypeChanger<T>::change(r_dst);
+	*VariantGetInternalPtr<T>::get_ptr(r_dst) = p_value;
+}
+
+template <typename T>
+static _FORCE_INLINE_ bool _typed_operator(Variant::Operator p_operator, const Variant *p_a, const Variant *p_b, Variant *r_dst) {
+	const T a = *VariantGetInternalPtr<T>::get_ptr(p_a);
+	const T b = *VariantGetInternalPtr<T>::get_ptr(p_b);
+	switch (p_operator) {
+		case Variant::OP_ADD:
+			_set_typed_operator_result<T>(r_dst, a + b);
+			return true;
+		case Variant::OP_SUBTRACT:
+			_set_typed_operator_result<T>(r_dst, a - b);
+			return true;
+		case Variant::OP_MULTIPLY:
+			_set_typed_operator_result<T>(r_dst, a * b);
+			return true;
+		case Variant::OP_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a == b);
+			return true;
+		case Variant::OP_NOT_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a != b);
+			return true;
+		case Variant::OP_LESS:
+			_set_typed_operator_result<bool>(r_dst, a < b);
+			return true;
+		case Variant::OP_LESS_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a <= b);
+			return true;
+		case Variant::OP_GREATER:
+			_set_typed_operator_result<bool>(r_dst, a > b);
+			return true;
+		case Variant::OP_GREATER_EQUAL:
+			_set_typed_operator_result<bool>(r_dst, a >= b);
+			return true;
+		default:
+			return false;
+	}
+}
+
+GDScriptInstance *GDScriptFunction::_get_gdscript_instance(ScriptInstance *p_script_instance) {
+	if (!p_script_instance || p_script_instance->is_placeholder() || p_script_instance->get_language() != GDScriptLanguage::get_singleton()) {
+		return nullptr;
+	}
+	return static_cast<GDScriptInstance *>(p_script_instance);
+}
+
+#ifndef DEBUG_ENABLED
+// Same dispatch as Object::callp(), minus the method lookups. Debug builds keep the generic path for its
+// object debug lock and freed instance checks.
+bool GDScriptFunction::_inline_cached_call(int p_cache, Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return false;
+	}
+	Object *obj = *VariantInternal::get_object(p_base);
+	if (!obj) {
+		return false;
+	}
+
+	ScriptInstance *script_instance = obj->get_script_instance();
+	GDScriptInstance *gd_instance = _get_gdscript_instance(script_instance);
+	if (script_instance && !gd_instance) {
+		return false; // Another language, let it resolve the call.
+	}
+	ObjectID script_id = gd_instance ? gd_instance->script->get_instance_id() : ObjectID();
+	const StringName *class_name = &obj->get_class_name();
+
+	InlineCacheEntry filled;
+	const InlineCacheEntry *entry = _find_inline_cache(p_cache, script_id, class_name);
+	if (!entry) {
+		if (inline_caches[p_cache].fills.get() >= INLINE_CACHE_MAX_FILLS) {
+			return false;
+		}
+
+		filled.kind = InlineCacheEntry::KIND_GENERIC;
+		filled.script_id = script_id;
+		filled.class_name = class_name;
+		// Both are special cased by Object::callp() and GDScriptInstance::callp().
+		if (p_method != CoreStringNames::get_singleton()->_free && p_method != SNAME("_ready")) {
+			const GDScript *sptr = gd_instance ? gd_instance->script.ptr() : nullptr;
+			while (sptr) {
+				HashMap<StringName, GDScriptFunction *>::ConstIterator E = sptr->member_functions.find(p_method);
+				if (E) {
+					filled.kind = InlineCacheEntry::KIND_SCRIPT_FUNCTION;
+					filled.function = E->value;
+					break;
+				}
+				sptr = sptr->_base;
+			}
+			if (!filled.function) {
+				filled.method = ClassDB::get_method(*class_name, p_method);
+				if (filled.method) {
+					filled.kind = InlineCacheEntry::KIND_METHOD_BIND;
+				}
+			}
+		}
+		_add_inline_cache(p_cache, filled);
+		entry = &filled;
+	}
+
+	switch (entry->kind) {
+		case InlineCacheEntry::KIND_SCRIPT_FUNCTION:
+			r_err.error = Callable::CallError::CALL_OK;
+			r_ret = entry->function->call(gd_instance, p_args, p_argcount, r_err);
+			return true;
+		case InlineCacheEntry::KIND_METHOD_BIND:
+			r_err.error = Callable::CallError::CALL_OK;
+			r_ret = entry->method->call(obj, p_args, p_argcount, r_err);
+			return true;
+		default:
+			return false;
+	}
+}
+#endif
+
+// Cached lookup of a GDScript member without getter or setter, which GDScriptInstance::get()/set() would
+// otherwise find through the member hash map on every access.
+const GDScriptFunction::InlineCacheEntry *GDScriptFunction::_get_member_inline_cache(int p_cache, GDScriptInstance *p_instance, const StringName &p_name, InlineCacheEntry &r_filled, bool p_set) {
+	ObjectID script_id = p_instance->script->get_instance_id();
+	const InlineCacheEntry *entry = _find_inline_cache(p_cache, script_id, nullptr);
+	if (entry) {
+		return entry;
+	}
+	if (inline_caches[p_cache].fills.get() >= INLINE_CACHE_MAX_FILLS) {
+		return nullptr;
+	}
+
+	r_filled.kind = InlineCacheEntry::KIND_GENERIC;
+	r_filled.script_id = script_id;
+	HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = p_instance->script->member_indices.find(p_name);
+	if (E) {
+		const GDScript::MemberInfo &member = E->value;
+		const GDScriptDataType &type = member.data_type;
+		if (p_set) {
+			if (!member.setter) {
+				if (!type.has_type) {
+					r_filled.kind = InlineCacheEntry::KIND_MEMBER;
+				} else if (type.kind == GDScriptDataType::BUILTIN && type.builtin_type != Variant::OBJECT && !(type.builtin_type == Variant::ARRAY && type.has_container_element_type())) {
+					// Values of the exact type are stored as is, anything else needs the conversion in GDScriptInstance::set().
+					r_filled.kind = InlineCacheEntry::KIND_MEMBER;
+					r_filled.member_type = type.builtin_type;
+				}
+			}
+		} else if (!member.getter) {
+			r_filled.kind = InlineCacheEntry::KIND_MEMBER;
+		}
+		r_filled.member_index = member.index;
+	}
+	_add_inline_cache(p_cache, r_filled);
+	return &r_filled;
+}
+
+bool GDScriptFunction::_inline_cached_get_named(int p_cache, const Variant *p_base, const StringName &p_name, Variant *r_dst) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return false;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return false;
+	}
+	GDScriptInstance *gd_instance = _get_gdscript_instance(obj->get_script_instance());
+	if (!gd_instance) {
+		return false;
+	}
+
+	InlineCacheEntry filled;
+	const InlineCacheEntry *entry = _get_member_inline_cache(p_cache, gd_instance, p_name, filled, false);
+	if (!entry || entry->kind != InlineCacheEntry::KIND_MEMBER) {
+		return false;
+	}
+
+	// Copy first, the destination may hold the last reference to the base.
+	Variant value = gd_instance->members[entry->member_index];
+	*r_dst = value;
+	return true;
+}
+
+bool GDScriptFunction::_inline_cached_set_named(int p_cache, Variant *p_base, const StringName &p_name, const Variant *p_value) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return false;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return false;
+	}
+	GDScriptInstance *gd_instance = _get_gdscript_instance(obj->get_script_instance());
+	if (!gd_instance) {
+		return false;
+	}
+
+	InlineCacheEntry filled;
+	const InlineCacheEntry *entry = _get_member_inline_cache(p_cache, gd_instance, p_name, filled, true);
+	if (!entry || entry->kind != InlineCacheEntry::KIND_MEMBER) {
+		return false;
+	}
+	if (entry->member_type != Variant::VARIANT_MAX && p_value->get_type() != entry->member_type) {
+		return false;
+	}
+
+#ifdef TOOLS_ENABLED
+	if (!obj->is_edited()) {
+		obj->set_edited(true);
+	}
+#endif
+	gd_instance->members.write[entry->member_index] = *p_value;
+	return true;
+}
+
 #if defined(__GNUC__)
 #define OPCODES_TABLE                                \
 	static const void *switch_table_ops[] = {        \
 		&&OPCODE_OPERATOR,                           \
 		&&OPCODE_OPERATOR_VALIDATED,                 \
+		&&OPCODE_OPERATOR_VALIDATED_INT,             \
+		&&OPCODE_OPERATOR_VALIDATED_FLOAT,           \
+		&&OPCODE_JUMP_IF_NOT_COMPARE_INT,            \
+		&&OPCODE_JUMP_IF_NOT_COMPARE_FLOAT,          \
 		&&OPCODE_EXTENDS_TEST,                       \
 		&&OPCODE_IS_BUILTIN,                         \
 		&&OPCODE_SET_KEYED,                          \
@@ -480,6 +698,22 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		return _get_default_variant_for_data_type(return_type);
 	}
 
+	if (!p_state) {
+		if (native_code) {
+			bool deopt = false;
+			Variant ret = native_code(this, p_instance, p_args, p_argcount, r_err, deopt);
+			if (!deopt) {
+				return ret;
+			}
+			native_code = nullptr; // Back to the VM for good.
+		} else if (fully_typed && native_tier_threshold && !native_tier_attempted && native_tier_call_count.increment() >= native_tier_threshold) {
+			native_tier_attempted = true;
+			if (native_tier_compiler) {
+				native_code = native_tier_compiler(this);
+			}
+		}
+	}
+
 	r_err.error = Callable::CallError::CALL_OK;
 
 	Variant retvalue;
@@ -706,6 +940,74 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_VALIDATED_INT) {
+				CHECK_SPACE(5);
+
+				GET_INSTRUCTION_ARG(a, 0);
+				GET_INSTRUCTION_ARG(b, 1);
+				GET_INSTRUCTION_ARG(dst, 2);
+
+				bool valid = _typed_operator<int64_t>((Variant::Operator)_code_ptr[ip + 4], a, b, dst);
+				GD_ERR_BREAK(!valid);
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_VALIDATED_FLOAT) {
+				CHECK_SPACE(5);
+
+				GET_INSTRUCTION_ARG(a, 0);
+				GET_INSTRUCTION_ARG(b, 1);
+				GET_INSTRUCTION_ARG(dst, 2);
+
+				bool valid = _typed_operator<double>((Variant::Operator)_code_ptr[ip + 4], a, b, dst);
+				GD_ERR_BREAK(!valid);
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_JUMP_IF_NOT_COMPARE_INT) {
+				CHECK_SPACE(6);
+
+				GET_INSTRUCTION_ARG(a, 0);
+				GET_INSTRUCTION_ARG(b, 1);
+				GET_INSTRUCTION_ARG(dst, 2);
+
+				bool valid = _typed_operator<int64_t>((Variant::Operator)_code_ptr[ip + 4], a, b, dst);
+				GD_ERR_BREAK(!valid);
+
+				if (!*VariantGetInternalPtr<bool>::get_ptr(dst)) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_JUMP_IF_NOT_COMPARE_FLOAT) {
+				CHECK_SPACE(6);
+
+				GET_INSTRUCTION_ARG(a, 0);
+				GET_INSTRUCTION_ARG(b, 1);
+				GET_INSTRUCTION_ARG(dst, 2);
+
+				bool valid = _typed_operator<double>((Variant::Operator)_code_ptr[ip + 4], a, b, dst);
+				GD_ERR_BREAK(!valid);
+
+				if (!*VariantGetInternalPtr<bool>::get_ptr(dst)) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_EXTENDS_TEST) {
 				CHECK_SPACE(4);
 
@@ -984,7 +1286,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(4);
 
 				GET_INSTRUCTION_ARG(dst, 0);
 				GET_INSTRUCTION_ARG(value, 1);
@@ -994,8 +1296,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-				dst->set_named(*index, *value, valid);
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= inline_cache_count);
+
+				bool valid = true;
+				if (!_inline_cached_set_named(cache_idx, dst, *index, value)) {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1004,7 +1311,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1024,7 +1331,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_INSTRUCTION_ARG(src, 0);
 				GET_INSTRUCTION_ARG(dst, 1);
@@ -1034,6 +1341,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= inline_cache_count);
+
+				if (_inline_cached_get_named(cache_idx, src, *index, dst)) {
+					ip += 5;
+					DISPATCH_OPCODE;
+				}
+
 				bool valid;
 #ifdef DEBUG_ENABLED
 				//allow better error message in cases where src and dst are the same stack position
@@ -1049,7 +1364,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 				*dst = ret;
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1504,7 +1819,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			OPCODE(OPCODE_CALL_ASYNC)
 			OPCODE(OPCODE_CALL_RETURN)
 			OPCODE(OPCODE_CALL) {
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 				bool call_ret = (_code_ptr[ip] & INSTR_MASK) != OPCODE_CALL;
 #ifdef DEBUG_ENABLED
 				bool call_async = (_code_ptr[ip] & INSTR_MASK) == OPCODE_CALL_ASYNC;
@@ -1519,6 +1834,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+#ifndef DEBUG_ENABLED
+				int cache_idx = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= inline_cache_count);
+#endif
+
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
@@ -1533,7 +1853,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
+#ifdef DEBUG_ENABLED
 					base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+#else
+					if (!_inline_cached_call(cache_idx, base, *methodname, (const Variant **)argptrs, argc, *ret, err)) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					}
+#endif
 #ifdef DEBUG_ENABLED
 					if (!call_async && ret->get_type() == Variant::OBJECT) {
 						// Check if getting a function state without await.
@@ -1552,7 +1878,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 				} else {
 					Variant ret;
+#ifdef DEBUG_ENABLED
 					base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+#else
+					if (!_inline_cached_call(cache_idx, base, *methodname, (const Variant **)argptrs, argc, ret, err)) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+					}
+#endif
 				}
 #ifdef DEBUG_ENABLED
 				if (GDScriptLanguage::get_singleton()->profiling) {
@@ -1597,7 +1929,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -2204,19 +2536,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Ref<GDScriptFunctionState> gdfs = memnew(GDScriptFunctionState);
 					gdfs->function = this;
 
-					gdfs->state.stack.resize(alloca_size);
-
-					// First 3 stack addresses are special, so we just skip them here.
-					for (int i = 3; i < _stack_size; i++) {
-						memnew_placement(&gdfs->state.stack.write[sizeof(Variant) * i], Variant(stack[i]));
-					}
-					gdfs->state.stack_size = _stack_size;
-					gdfs->state.alloca_size = alloca_size;
-					gdfs->state.ip = ip + 2;
-					gdfs->state.line = line;
-					gdfs->state.script = _script;
 					{
 						MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
+						// Reuse the stack buffer of a finished state if there is one.
+						LocalVector<Vector<uint8_t>> &pool = GDScriptLanguage::get_singleton()->function_state_stack_pool;
+						if (pool.size()) {
+							gdfs->state.stack = pool[pool.size() - 1];
+							pool.resize(pool.size() - 1);
+						}
 						_script->pending_func_states.add(&gdfs->scripts_list);
 						if (p_instance) {
 							gdfs->state.instance = p_instance;
@@ -2225,6 +2552,19 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 							gdfs->state.instance = nullptr;
 						}
 					}
+
+					gdfs->state.stack.resize(alloca_size);
+
+					// First 3 stack addresses are special, so we just skip them here.
+					Variant *state_stack = (Variant *)gdfs->state.stack.ptrw();
+					for (int i = 3; i < _stack_size; i++) {
+						memnew_placement(&state_stack[i], Variant(stack[i]));
+					}
+					gdfs->state.stack_size = _stack_size;
+					gdfs->state.alloca_size = alloca_size;
+					gdfs->state.ip = ip + 2;
+					gdfs->state.line = line;
+					gdfs->state.script = _script;
 #ifdef DEBUG_ENABLED
 					gdfs->state.function_name = name;
 					gdfs->state.script_path = _script->get_script_path();
@@ -2234,7 +2574,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 					retvalue = gdfs;
 
-					Error err = sig.connect(Callable(gdfs.ptr(), "_signal_callback").bind(retvalue), Object::CONNECT_ONE_SHOT);
+					Error err = sig.connect(Callable(memnew(GDScriptFunctionStateCallable(gdfs))), Object::CONNECT_ONE_SHOT);
 					if (err != OK) {
 						err_text = "Error connecting to signal: " + sig.get_name() + " during await.";
 						OPCODE_BREAK;
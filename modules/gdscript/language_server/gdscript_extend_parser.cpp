@@ -849,6 +849,7 @@ Error ExtendGDScriptParser::parse(const String &p_code, const String &p_path) {
 	if (err == OK) {
 		err = analyzer.analyze();
 	}
+	dependency_parsers = analyzer.get_depended_parsers();
 	update_diagnostics();
 	update_symbols();
 	update_document_links(p_code);
@@ -31,6 +31,7 @@
 #ifndef GDSCRIPT_EXTEND_PARSER_H
 #define GDSCRIPT_EXTEND_PARSER_H
 
+#include "../gdscript_cache.h"
 #include "../gdscript_parser.h"
 #include "core/variant/variant.h"
 #include "godot_lsp.h"
@@ -58,6 +59,8 @@ class ExtendGDScriptParser : public GDScriptParser {
 	List<lsp::DocumentLink> document_links;
 	ClassMembers members;
 	HashMap<String, ClassMembers> inner_classes;
+	// Keeps the analyzed dependencies cached, so the next parse of this file doesn't analyze them again.
+	HashMap<String, Ref<GDScriptParserRef>> dependency_parsers;
 
 	void update_diagnostics();
 
@@ -93,6 +96,9 @@ public:
 	const lsp::DocumentSymbol *get_member_symbol(const String &p_name, const String &p_subclass = "") const;
 	const List<lsp::DocumentLink> &get_document_links() const;
 
+	bool depends_on(const String &p_path) const { return dependency_parsers.has(p_path); }
+	void release_dependency(const String &p_path) { dependency_parsers.erase(p_path); }
+
 	const Array &get_member_completions();
 	Dictionary generate_api() const;
 
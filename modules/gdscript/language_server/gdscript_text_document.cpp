@@ -79,7 +79,9 @@ void GDScriptTextDocument::didChange(const Variant &p_param) {
 		evt.load(contentChanges[i]);
 		doc.text = evt.text;
 	}
-	sync_script_content(doc.uri, doc.text);
+	// Unsaved changes don't affect the file on disk, so only the workspace needs to be updated.
+	String path = GDScriptLanguageProtocol::get_singleton()->get_workspace()->get_file_path(doc.uri);
+	GDScriptLanguageProtocol::get_singleton()->get_workspace()->parse_script(path, doc.text);
 }
 
 void GDScriptTextDocument::willSaveWaitUntil(const Variant &p_param) {
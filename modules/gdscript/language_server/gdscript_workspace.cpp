@@ -423,6 +423,19 @@ Error GDScriptWorkspace::initialize() {
 }
 
 Error GDScriptWorkspace::parse_script(const String &p_path, const String &p_content) {
+	// Scripts analyzed against the previous version of this one have to resolve it again.
+	for (const KeyValue<String, ExtendGDScriptParser *> &E : parse_results) {
+		if (E.value->depends_on(p_path)) {
+			E.value->release_dependency(p_path);
+		}
+	}
+	for (const KeyValue<String, ExtendGDScriptParser *> &E : scripts) {
+		if (E.value->depends_on(p_path)) {
+			E.value->release_dependency(p_path);
+		}
+	}
+
+	// The previous parser is still alive here, so its dependencies are reused from the cache.
 	ExtendGDScriptParser *parser = memnew(ExtendGDScriptParser);
 	Error err = parser->parse(p_content, p_path);
 	HashMap<String, ExtendGDScriptParser *>::Iterator last_parser = parse_results.find(p_path);
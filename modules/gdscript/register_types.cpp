@@ -36,6 +36,7 @@
 #include "core/io/resource_loader.h"
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_binary_tokens.h"
 #include "gdscript_cache.h"
 #include "gdscript_tokenizer.h"
 #include "gdscript_utility_functions.h"
@@ -85,8 +86,14 @@ public:
 			return;
 		}
 
-		// TODO: Re-add compiled GDScript on export.
-		return;
+		// The tokens are stored in place of the script, keeping the same path.
+		Vector<uint8_t> file = GDScriptBinaryTokens::compile(FileAccess::get_file_as_string(p_path), p_path);
+		if (file.is_empty()) {
+			return; // Scripts with parse errors are exported as text, so the errors show up at runtime.
+		}
+
+		add_file(p_path, file, false);
+		skip();
 	}
 
 	virtual String _get_name() const override { return "GDScript"; }
@@ -31,6 +31,9 @@
 #ifndef GDSCRIPT_TEST_RUNNER_SUITE_H
 #define GDSCRIPT_TEST_RUNNER_SUITE_H
 
+#include "../gdscript_binary_tokens.h"
+#include "../gdscript_cache.h"
+#include "../gdscript_parser.h"
 #include "gdscript_test_runner.h"
 #include "tests/test_macros.h"
 
@@ -69,6 +72,70 @@ func _init():
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
 
+TEST_CASE("[Modules][GDScript] Parse a script from binary tokens") {
+	const String path = "res://binary_tokens_test.gd";
+	const String source = R"(
+extends RefCounted
+
+var values := [1, 2.5, "text", &"name", ^"node/path"]
+
+func _init():
+	var doubled = func(x):
+		return x * 2
+	set_meta("result", doubled.call(21))
+)";
+
+	GDScriptParser text_parser;
+	text_parser.set_token_recording(true);
+	REQUIRE(text_parser.parse(source, path, false) == OK);
+	const Vector<GDScriptTokenizer::Token> &recorded = text_parser.get_recorded_tokens();
+
+	const Vector<uint8_t> data = GDScriptBinaryTokens::compile(source, path);
+	REQUIRE_MESSAGE(GDScriptBinaryTokens::is_binary(data), "The script should be compiled to binary tokens.");
+
+	String decoded_source;
+	CHECK(GDScriptBinaryTokens::decode_source(data, decoded_source) == OK);
+	CHECK_MESSAGE(decoded_source == source, "The source should be kept to fall back to.");
+
+	Vector<GDScriptTokenizer::Token> tokens;
+	CHECK(GDScriptBinaryTokens::decode_tokens(data, tokens) == OK);
+	REQUIRE(tokens.size() == recorded.size());
+	for (int i = 0; i < tokens.size(); i++) {
+		CHECK(tokens[i].type == recorded[i].type);
+		CHECK(tokens[i].literal == recorded[i].literal);
+		CHECK(tokens[i].start_line == recorded[i].start_line);
+		CHECK(tokens[i].source == recorded[i].source);
+	}
+
+	GDScriptCache::register_binary_script(path, data, source);
+	GDScriptParser binary_parser;
+	CHECK_MESSAGE(binary_parser.parse(source, path, false) == OK, "The script should parse from the recorded tokens.");
+	CHECK(binary_parser.get_tree()->members.size() == text_parser.get_tree()->members.size());
+	GDScriptCache::remove_script(path);
+}
+
+TEST_CASE("[Modules][GDScript] Track constant script dependencies") {
+	const String source = R"(
+extends "base.gd"
+
+const Other = preload("../other/other.gd")
+const Texture = preload("res://icon.png")
+
+func load_later():
+	return load("res://not_a_dependency.gd")
+)";
+
+	GDScriptParser parser;
+	REQUIRE(parser.parse(source, "res://scripts/dependencies.gd", false) == OK);
+
+	List<String> dependencies = parser.get_dependencies();
+	CHECK(dependencies.size() == 3);
+	CHECK_MESSAGE(dependencies.find("res://scripts/base.gd") != nullptr, "Relative `extends` paths should be resolved from the script directory.");
+	CHECK(dependencies.find("res://other/other.gd") != nullptr);
+	CHECK(dependencies.find("res://icon.png") != nullptr);
+	CHECK_MESSAGE(dependencies.find("res://not_a_dependency.gd") == nullptr, "Runtime loads aren't known dependencies.");
+}
+
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
 
@@ -0,0 +1,40 @@
+# Member access and calls through untyped values go through inline caches.
+# The same call sites see several classes, so cached entries must not leak
+# between them.
+
+class Base:
+	var value = 1
+	var ratio: float = 0.0
+	var guarded = 0:
+		set(v):
+			guarded = v * 2
+
+	func speak():
+		return "base"
+
+class Derived extends Base:
+	func speak():
+		return "derived"
+
+class Other:
+	var value = "other"
+
+	func speak():
+		return "other"
+
+func test():
+	var objects = [Base.new(), Derived.new(), Other.new(), RefCounted.new()]
+	for _i in 2:
+		for o in objects:
+			if o is RefCounted and not (o is Base or o is Other):
+				print(o.get_class())
+				continue
+			print(o.speak(), " ", o.value)
+
+	for _i in 2:
+		for o in objects:
+			if o is Base:
+				o.value += 1
+				o.ratio = 3
+				o.guarded = 5
+				print(o.value, " ", o.ratio, " ", o.guarded)
@@ -0,0 +1,34 @@
+# Typed int and float operators are inlined, and comparisons feeding a
+# condition are fused with the jump. Check they behave like the generic path.
+
+func test():
+	var a: int = 7
+	var b: int = 3
+	print(a + b, " ", a - b, " ", a * b)
+	print(a == b, " ", a != b, " ", a < b, " ", a <= b, " ", a > b, " ", a >= b)
+
+	var x: float = 2.5
+	var y: float = 0.5
+	print(x + y, " ", x - y, " ", x * y)
+	print(x == y, " ", x != y, " ", x < y, " ", x <= y, " ", x > y, " ", x >= y)
+
+	var count: int = 0
+	var i: int = 0
+	while i < 10:
+		if i >= 5:
+			count += 1
+		i += 1
+	print(count)
+
+	var f: float = 0.0
+	var steps: int = 0
+	while f < 1.0:
+		f += 0.25
+		steps += 1
+	print(steps)
+
+	print("both" if a > b and x > y else "not both")
+	print("either" if a < b or x > y else "neither")
+
+	var result := a < b
+	print(result)
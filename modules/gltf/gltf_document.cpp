@@ -39,6 +39,7 @@
 #include "core/io/json.h"
 #include "core/io/stream_peer.h"
 #include "core/math/disjoint_set.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "drivers/png/png_driver_common.h"
 #include "scene/3d/bone_attachment_3d.h"
@@ -2538,450 +2539,492 @@ Error GLTFDocument::_parse_meshes(Ref<GLTFState> state) {
 	}
 
 	Array meshes = state->json["meshes"];
+	MeshParseData mesh_data;
+	mesh_data.state = state;
+	mesh_data.jobs.resize(meshes.size());
 	for (GLTFMeshIndex i = 0; i < meshes.size(); i++) {
-		print_verbose("glTF: Parsing mesh: " + itos(i));
-		Dictionary d = meshes[i];
+		MeshParseJob &job = mesh_data.jobs[i];
+		job.dict = meshes[i];
 
-		Ref<GLTFMesh> mesh;
-		mesh.instantiate();
-		bool has_vertex_color = false;
+		ERR_FAIL_COND_V(!job.dict.has("primitives"), ERR_PARSE_ERROR);
 
-		ERR_FAIL_COND_V(!d.has("primitives"), ERR_PARSE_ERROR);
-
-		Array primitives = d["primitives"];
-		const Dictionary &extras = d.has("extras") ? (Dictionary)d["extras"] : Dictionary();
-		Ref<ImporterMesh> import_mesh;
-		import_mesh.instantiate();
 		String mesh_name = "mesh";
-		if (d.has("name") && !String(d["name"]).is_empty()) {
-			mesh_name = d["name"];
+		if (job.dict.has("name") && !String(job.dict["name"]).is_empty()) {
+			mesh_name = job.dict["name"];
 		}
-		import_mesh->set_name(_gen_unique_name(state, vformat("%s_%s", state->scene_name, mesh_name)));
+		// Unique names depend on the order, so they're generated up front.
+		job.name = _gen_unique_name(state, vformat("%s_%s", state->scene_name, mesh_name));
+	}
 
-		for (int j = 0; j < primitives.size(); j++) {
-			uint32_t flags = 0;
-			Dictionary p = primitives[j];
+	// Meshes only read from the state while parsing, so each one can decode its accessors
+	// and generate its surfaces on its own thread.
+	if (mesh_data.jobs.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GLTFDocument::_parse_mesh_task, &mesh_data, mesh_data.jobs.size(), -1, true, SNAME("GLTFMeshes"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < mesh_data.jobs.size(); i++) {
+			_parse_mesh_task(i, &mesh_data);
+		}
+	}
 
-			Array array;
-			array.resize(Mesh::ARRAY_MAX);
+	for (uint32_t i = 0; i < mesh_data.jobs.size(); i++) {
+		const MeshParseJob &job = mesh_data.jobs[i];
+		if (job.error != OK) {
+			return job.error;
+		}
+		for (uint32_t j = 0; j < job.vertex_color_materials.size(); j++) {
+			Ref<BaseMaterial3D> base_material = state->materials[job.vertex_color_materials[j]];
+			if (base_material.is_valid()) {
+				base_material->set_flag(BaseMaterial3D::FLAG_ALBEDO_FROM_VERTEX_COLOR, true);
+			}
+		}
+		state->meshes.push_back(job.mesh);
+	}
 
-			ERR_FAIL_COND_V(!p.has("attributes"), ERR_PARSE_ERROR);
+	print_verbose("glTF: Total meshes: " + itos(state->meshes.size()));
 
-			Dictionary a = p["attributes"];
+	return OK;
+}
 
-			Mesh::PrimitiveType primitive = Mesh::PRIMITIVE_TRIANGLES;
-			if (p.has("mode")) {
-				const int mode = p["mode"];
-				ERR_FAIL_INDEX_V(mode, 7, ERR_FILE_CORRUPT);
-				// Convert mesh.primitive.mode to Godot Mesh enum. See:
-				// https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#_mesh_primitive_mode
-				static const Mesh::PrimitiveType primitives2[7] = {
-					Mesh::PRIMITIVE_POINTS, // 0 POINTS
-					Mesh::PRIMITIVE_LINES, // 1 LINES
-					Mesh::PRIMITIVE_LINES, // 2 LINE_LOOP; loop not supported, should be converted
-					Mesh::PRIMITIVE_LINE_STRIP, // 3 LINE_STRIP
-					Mesh::PRIMITIVE_TRIANGLES, // 4 TRIANGLES
-					Mesh::PRIMITIVE_TRIANGLE_STRIP, // 5 TRIANGLE_STRIP
-					Mesh::PRIMITIVE_TRIANGLES, // 6 TRIANGLE_FAN fan not supported, should be converted
-					// TODO: Line loop and triangle fan are not supported and need to be converted to lines and triangles.
-				};
+void GLTFDocument::_parse_mesh_task(uint32_t p_index, MeshParseData *p_data) {
+	print_verbose("glTF: Parsing mesh: " + itos(p_index));
+	MeshParseJob &job = p_data->jobs[p_index];
+	job.error = _parse_mesh(p_data->state, job);
+}
 
-				primitive = primitives2[mode];
-			}
+Error GLTFDocument::_parse_mesh(Ref<GLTFState> state, MeshParseJob &r_job) {
+	Dictionary d = r_job.dict;
 
-			ERR_FAIL_COND_V(!a.has("POSITION"), ERR_PARSE_ERROR);
-			int32_t vertex_num = 0;
-			if (a.has("POSITION")) {
-				PackedVector3Array vertices = _decode_accessor_as_vec3(state, a["POSITION"], true);
-				array[Mesh::ARRAY_VERTEX] = vertices;
-				vertex_num = vertices.size();
-			}
-			if (a.has("NORMAL")) {
-				array[Mesh::ARRAY_NORMAL] = _decode_accessor_as_vec3(state, a["NORMAL"], true);
-			}
-			if (a.has("TANGENT")) {
-				array[Mesh::ARRAY_TANGENT] = _decode_accessor_as_floats(state, a["TANGENT"], true);
-			}
-			if (a.has("TEXCOORD_0")) {
-				array[Mesh::ARRAY_TEX_UV] = _decode_accessor_as_vec2(state, a["TEXCOORD_0"], true);
-			}
-			if (a.has("TEXCOORD_1")) {
-				array[Mesh::ARRAY_TEX_UV2] = _decode_accessor_as_vec2(state, a["TEXCOORD_1"], true);
+	Ref<GLTFMesh> mesh;
+	mesh.instantiate();
+	bool has_vertex_color = false;
+
+	Array primitives = d["primitives"];
+	const Dictionary &extras = d.has("extras") ? (Dictionary)d["extras"] : Dictionary();
+	Ref<ImporterMesh> import_mesh;
+	import_mesh.instantiate();
+	import_mesh->set_name(r_job.name);
+
+	for (int j = 0; j < primitives.size(); j++) {
+		uint32_t flags = 0;
+		Dictionary p = primitives[j];
+
+		Array array;
+		array.resize(Mesh::ARRAY_MAX);
+
+		ERR_FAIL_COND_V(!p.has("attributes"), ERR_PARSE_ERROR);
+
+		Dictionary a = p["attributes"];
+
+		Mesh::PrimitiveType primitive = Mesh::PRIMITIVE_TRIANGLES;
+		if (p.has("mode")) {
+			const int mode = p["mode"];
+			ERR_FAIL_INDEX_V(mode, 7, ERR_FILE_CORRUPT);
+			// Convert mesh.primitive.mode to Godot Mesh enum. See:
+			// https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#_mesh_primitive_mode
+			static const Mesh::PrimitiveType primitives2[7] = {
+				Mesh::PRIMITIVE_POINTS, // 0 POINTS
+				Mesh::PRIMITIVE_LINES, // 1 LINES
+				Mesh::PRIMITIVE_LINES, // 2 LINE_LOOP; loop not supported, should be converted
+				Mesh::PRIMITIVE_LINE_STRIP, // 3 LINE_STRIP
+				Mesh::PRIMITIVE_TRIANGLES, // 4 TRIANGLES
+				Mesh::PRIMITIVE_TRIANGLE_STRIP, // 5 TRIANGLE_STRIP
+				Mesh::PRIMITIVE_TRIANGLES, // 6 TRIANGLE_FAN fan not supported, should be converted
+				// TODO: Line loop and triangle fan are not supported and need to be converted to lines and triangles.
+			};
+
+			primitive = primitives2[mode];
+		}
+
+		ERR_FAIL_COND_V(!a.has("POSITION"), ERR_PARSE_ERROR);
+		int32_t vertex_num = 0;
+		if (a.has("POSITION")) {
+			PackedVector3Array vertices = _decode_accessor_as_vec3(state, a["POSITION"], true);
+			array[Mesh::ARRAY_VERTEX] = vertices;
+			vertex_num = vertices.size();
+		}
+		if (a.has("NORMAL")) {
+			array[Mesh::ARRAY_NORMAL] = _decode_accessor_as_vec3(state, a["NORMAL"], true);
+		}
+		if (a.has("TANGENT")) {
+			array[Mesh::ARRAY_TANGENT] = _decode_accessor_as_floats(state, a["TANGENT"], true);
+		}
+		if (a.has("TEXCOORD_0")) {
+			array[Mesh::ARRAY_TEX_UV] = _decode_accessor_as_vec2(state, a["TEXCOORD_0"], true);
+		}
+		if (a.has("TEXCOORD_1")) {
+			array[Mesh::ARRAY_TEX_UV2] = _decode_accessor_as_vec2(state, a["TEXCOORD_1"], true);
+		}
+		for (int custom_i = 0; custom_i < 3; custom_i++) {
+			Vector<float> cur_custom;
+			Vector<Vector2> texcoord_first;
+			Vector<Vector2> texcoord_second;
+
+			int texcoord_i = 2 + 2 * custom_i;
+			String gltf_texcoord_key = vformat("TEXCOORD_%d", texcoord_i);
+			int num_channels = 0;
+			if (a.has(gltf_texcoord_key)) {
+				texcoord_first = _decode_accessor_as_vec2(state, a[gltf_texcoord_key], true);
+				num_channels = 2;
+			}
+			gltf_texcoord_key = vformat("TEXCOORD_%d", texcoord_i + 1);
+			if (a.has(gltf_texcoord_key)) {
+				texcoord_second = _decode_accessor_as_vec2(state, a[gltf_texcoord_key], true);
+				num_channels = 4;
+			}
+			if (!num_channels) {
+				break;
 			}
-			for (int custom_i = 0; custom_i < 3; custom_i++) {
-				Vector<float> cur_custom;
-				Vector<Vector2> texcoord_first;
-				Vector<Vector2> texcoord_second;
-
-				int texcoord_i = 2 + 2 * custom_i;
-				String gltf_texcoord_key = vformat("TEXCOORD_%d", texcoord_i);
-				int num_channels = 0;
-				if (a.has(gltf_texcoord_key)) {
-					texcoord_first = _decode_accessor_as_vec2(state, a[gltf_texcoord_key], true);
-					num_channels = 2;
-				}
-				gltf_texcoord_key = vformat("TEXCOORD_%d", texcoord_i + 1);
-				if (a.has(gltf_texcoord_key)) {
-					texcoord_second = _decode_accessor_as_vec2(state, a[gltf_texcoord_key], true);
-					num_channels = 4;
+			if (num_channels == 2 || num_channels == 4) {
+				cur_custom.resize(vertex_num * num_channels);
+				for (int32_t uv_i = 0; uv_i < texcoord_first.size() && uv_i < vertex_num; uv_i++) {
+					cur_custom.write[uv_i * num_channels + 0] = texcoord_first[uv_i].x;
+					cur_custom.write[uv_i * num_channels + 1] = texcoord_first[uv_i].y;
 				}
-				if (!num_channels) {
-					break;
+				// Vector.resize seems to not zero-initialize. Ensure all unused elements are 0:
+				for (int32_t uv_i = texcoord_first.size(); uv_i < vertex_num; uv_i++) {
+					cur_custom.write[uv_i * num_channels + 0] = 0;
+					cur_custom.write[uv_i * num_channels + 1] = 0;
 				}
-				if (num_channels == 2 || num_channels == 4) {
-					cur_custom.resize(vertex_num * num_channels);
-					for (int32_t uv_i = 0; uv_i < texcoord_first.size() && uv_i < vertex_num; uv_i++) {
-						cur_custom.write[uv_i * num_channels + 0] = texcoord_first[uv_i].x;
-						cur_custom.write[uv_i * num_channels + 1] = texcoord_first[uv_i].y;
-					}
-					// Vector.resize seems to not zero-initialize. Ensure all unused elements are 0:
-					for (int32_t uv_i = texcoord_first.size(); uv_i < vertex_num; uv_i++) {
-						cur_custom.write[uv_i * num_channels + 0] = 0;
-						cur_custom.write[uv_i * num_channels + 1] = 0;
-					}
-				}
-				if (num_channels == 4) {
-					for (int32_t uv_i = 0; uv_i < texcoord_second.size() && uv_i < vertex_num; uv_i++) {
-						// num_channels must be 4
-						cur_custom.write[uv_i * num_channels + 2] = texcoord_second[uv_i].x;
-						cur_custom.write[uv_i * num_channels + 3] = texcoord_second[uv_i].y;
-					}
-					// Vector.resize seems to not zero-initialize. Ensure all unused elements are 0:
-					for (int32_t uv_i = texcoord_second.size(); uv_i < vertex_num; uv_i++) {
-						cur_custom.write[uv_i * num_channels + 2] = 0;
-						cur_custom.write[uv_i * num_channels + 3] = 0;
-					}
+			}
+			if (num_channels == 4) {
+				for (int32_t uv_i = 0; uv_i < texcoord_second.size() && uv_i < vertex_num; uv_i++) {
+					// num_channels must be 4
+					cur_custom.write[uv_i * num_channels + 2] = texcoord_second[uv_i].x;
+					cur_custom.write[uv_i * num_channels + 3] = texcoord_second[uv_i].y;
 				}
-				if (cur_custom.size() > 0) {
-					array[Mesh::ARRAY_CUSTOM0 + custom_i] = cur_custom;
-					int custom_shift = Mesh::ARRAY_FORMAT_CUSTOM0_SHIFT + custom_i * Mesh::ARRAY_FORMAT_CUSTOM_BITS;
-					if (num_channels == 2) {
-						flags |= Mesh::ARRAY_CUSTOM_RG_FLOAT << custom_shift;
-					} else {
-						flags |= Mesh::ARRAY_CUSTOM_RGBA_FLOAT << custom_shift;
-					}
+				// Vector.resize seems to not zero-initialize. Ensure all unused elements are 0:
+				for (int32_t uv_i = texcoord_second.size(); uv_i < vertex_num; uv_i++) {
+					cur_custom.write[uv_i * num_channels + 2] = 0;
+					cur_custom.write[uv_i * num_channels + 3] = 0;
 				}
 			}
-			if (a.has("COLOR_0")) {
-				array[Mesh::ARRAY_COLOR] = _decode_accessor_as_color(state, a["COLOR_0"], true);
-				has_vertex_color = true;
-			}
-			if (a.has("JOINTS_0") && !a.has("JOINTS_1")) {
-				array[Mesh::ARRAY_BONES] = _decode_accessor_as_ints(state, a["JOINTS_0"], true);
-			} else if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
-				PackedInt32Array joints_0 = _decode_accessor_as_ints(state, a["JOINTS_0"], true);
-				PackedInt32Array joints_1 = _decode_accessor_as_ints(state, a["JOINTS_1"], true);
-				ERR_FAIL_COND_V(joints_0.size() != joints_1.size(), ERR_INVALID_DATA);
-				int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
-				Vector<int> joints;
-				joints.resize(vertex_num * weight_8_count);
-				for (int32_t vertex_i = 0; vertex_i < vertex_num; vertex_i++) {
-					joints.write[vertex_i * weight_8_count + 0] = joints_0[vertex_i * JOINT_GROUP_SIZE + 0];
-					joints.write[vertex_i * weight_8_count + 1] = joints_0[vertex_i * JOINT_GROUP_SIZE + 1];
-					joints.write[vertex_i * weight_8_count + 2] = joints_0[vertex_i * JOINT_GROUP_SIZE + 2];
-					joints.write[vertex_i * weight_8_count + 3] = joints_0[vertex_i * JOINT_GROUP_SIZE + 3];
-					joints.write[vertex_i * weight_8_count + 4] = joints_1[vertex_i * JOINT_GROUP_SIZE + 0];
-					joints.write[vertex_i * weight_8_count + 5] = joints_1[vertex_i * JOINT_GROUP_SIZE + 1];
-					joints.write[vertex_i * weight_8_count + 6] = joints_1[vertex_i * JOINT_GROUP_SIZE + 2];
-					joints.write[vertex_i * weight_8_count + 7] = joints_1[vertex_i * JOINT_GROUP_SIZE + 3];
+			if (cur_custom.size() > 0) {
+				array[Mesh::ARRAY_CUSTOM0 + custom_i] = cur_custom;
+				int custom_shift = Mesh::ARRAY_FORMAT_CUSTOM0_SHIFT + custom_i * Mesh::ARRAY_FORMAT_CUSTOM_BITS;
+				if (num_channels == 2) {
+					flags |= Mesh::ARRAY_CUSTOM_RG_FLOAT << custom_shift;
+				} else {
+					flags |= Mesh::ARRAY_CUSTOM_RGBA_FLOAT << custom_shift;
 				}
-				array[Mesh::ARRAY_BONES] = joints;
-			}
-			if (a.has("WEIGHTS_0") && !a.has("WEIGHTS_1")) {
-				Vector<float> weights = _decode_accessor_as_floats(state, a["WEIGHTS_0"], true);
-				{ //gltf does not seem to normalize the weights for some reason..
-					int wc = weights.size();
-					float *w = weights.ptrw();
-
-					for (int k = 0; k < wc; k += 4) {
-						float total = 0.0;
-						total += w[k + 0];
-						total += w[k + 1];
-						total += w[k + 2];
-						total += w[k + 3];
-						if (total > 0.0) {
-							w[k + 0] /= total;
-							w[k + 1] /= total;
-							w[k + 2] /= total;
-							w[k + 3] /= total;
-						}
+			}
+		}
+		if (a.has("COLOR_0")) {
+			array[Mesh::ARRAY_COLOR] = _decode_accessor_as_color(state, a["COLOR_0"], true);
+			has_vertex_color = true;
+		}
+		if (a.has("JOINTS_0") && !a.has("JOINTS_1")) {
+			array[Mesh::ARRAY_BONES] = _decode_accessor_as_ints(state, a["JOINTS_0"], true);
+		} else if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
+			PackedInt32Array joints_0 = _decode_accessor_as_ints(state, a["JOINTS_0"], true);
+			PackedInt32Array joints_1 = _decode_accessor_as_ints(state, a["JOINTS_1"], true);
+			ERR_FAIL_COND_V(joints_0.size() != joints_1.size(), ERR_INVALID_DATA);
+			int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
+			Vector<int> joints;
+			joints.resize(vertex_num * weight_8_count);
+			for (int32_t vertex_i = 0; vertex_i < vertex_num; vertex_i++) {
+				joints.write[vertex_i * weight_8_count + 0] = joints_0[vertex_i * JOINT_GROUP_SIZE + 0];
+				joints.write[vertex_i * weight_8_count + 1] = joints_0[vertex_i * JOINT_GROUP_SIZE + 1];
+				joints.write[vertex_i * weight_8_count + 2] = joints_0[vertex_i * JOINT_GROUP_SIZE + 2];
+				joints.write[vertex_i * weight_8_count + 3] = joints_0[vertex_i * JOINT_GROUP_SIZE + 3];
+				joints.write[vertex_i * weight_8_count + 4] = joints_1[vertex_i * JOINT_GROUP_SIZE + 0];
+				joints.write[vertex_i * weight_8_count + 5] = joints_1[vertex_i * JOINT_GROUP_SIZE + 1];
+				joints.write[vertex_i * weight_8_count + 6] = joints_1[vertex_i * JOINT_GROUP_SIZE + 2];
+				joints.write[vertex_i * weight_8_count + 7] = joints_1[vertex_i * JOINT_GROUP_SIZE + 3];
+			}
+			array[Mesh::ARRAY_BONES] = joints;
+		}
+		if (a.has("WEIGHTS_0") && !a.has("WEIGHTS_1")) {
+			Vector<float> weights = _decode_accessor_as_floats(state, a["WEIGHTS_0"], true);
+			{ //gltf does not seem to normalize the weights for some reason..
+				int wc = weights.size();
+				float *w = weights.ptrw();
+
+				for (int k = 0; k < wc; k += 4) {
+					float total = 0.0;
+					total += w[k + 0];
+					total += w[k + 1];
+					total += w[k + 2];
+					total += w[k + 3];
+					if (total > 0.0) {
+						w[k + 0] /= total;
+						w[k + 1] /= total;
+						w[k + 2] /= total;
+						w[k + 3] /= total;
 					}
 				}
-				array[Mesh::ARRAY_WEIGHTS] = weights;
-			} else if (a.has("WEIGHTS_0") && a.has("WEIGHTS_1")) {
-				Vector<float> weights_0 = _decode_accessor_as_floats(state, a["WEIGHTS_0"], true);
-				Vector<float> weights_1 = _decode_accessor_as_floats(state, a["WEIGHTS_1"], true);
-				Vector<float> weights;
-				ERR_FAIL_COND_V(weights_0.size() != weights_1.size(), ERR_INVALID_DATA);
-				int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
-				weights.resize(vertex_num * weight_8_count);
-				for (int32_t vertex_i = 0; vertex_i < vertex_num; vertex_i++) {
-					weights.write[vertex_i * weight_8_count + 0] = weights_0[vertex_i * JOINT_GROUP_SIZE + 0];
-					weights.write[vertex_i * weight_8_count + 1] = weights_0[vertex_i * JOINT_GROUP_SIZE + 1];
-					weights.write[vertex_i * weight_8_count + 2] = weights_0[vertex_i * JOINT_GROUP_SIZE + 2];
-					weights.write[vertex_i * weight_8_count + 3] = weights_0[vertex_i * JOINT_GROUP_SIZE + 3];
-					weights.write[vertex_i * weight_8_count + 4] = weights_1[vertex_i * JOINT_GROUP_SIZE + 0];
-					weights.write[vertex_i * weight_8_count + 5] = weights_1[vertex_i * JOINT_GROUP_SIZE + 1];
-					weights.write[vertex_i * weight_8_count + 6] = weights_1[vertex_i * JOINT_GROUP_SIZE + 2];
-					weights.write[vertex_i * weight_8_count + 7] = weights_1[vertex_i * JOINT_GROUP_SIZE + 3];
-				}
-				{ //gltf does not seem to normalize the weights for some reason..
-					int wc = weights.size();
-					float *w = weights.ptrw();
-
-					for (int k = 0; k < wc; k += weight_8_count) {
-						float total = 0.0;
-						total += w[k + 0];
-						total += w[k + 1];
-						total += w[k + 2];
-						total += w[k + 3];
-						total += w[k + 4];
-						total += w[k + 5];
-						total += w[k + 6];
-						total += w[k + 7];
-						if (total > 0.0) {
-							w[k + 0] /= total;
-							w[k + 1] /= total;
-							w[k + 2] /= total;
-							w[k + 3] /= total;
-							w[k + 4] /= total;
-							w[k + 5] /= total;
-							w[k + 6] /= total;
-							w[k + 7] /= total;
-						}
+			}
+			array[Mesh::ARRAY_WEIGHTS] = weights;
+		} else if (a.has("WEIGHTS_0") && a.has("WEIGHTS_1")) {
+			Vector<float> weights_0 = _decode_accessor_as_floats(state, a["WEIGHTS_0"], true);
+			Vector<float> weights_1 = _decode_accessor_as_floats(state, a["WEIGHTS_1"], true);
+			Vector<float> weights;
+			ERR_FAIL_COND_V(weights_0.size() != weights_1.size(), ERR_INVALID_DATA);
+			int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
+			weights.resize(vertex_num * weight_8_count);
+			for (int32_t vertex_i = 0; vertex_i < vertex_num; vertex_i++) {
+				weights.write[vertex_i * weight_8_count + 0] = weights_0[vertex_i * JOINT_GROUP_SIZE + 0];
+				weights.write[vertex_i * weight_8_count + 1] = weights_0[vertex_i * JOINT_GROUP_SIZE + 1];
+				weights.write[vertex_i * weight_8_count + 2] = weights_0[vertex_i * JOINT_GROUP_SIZE + 2];
+				weights.write[vertex_i * weight_8_count + 3] = weights_0[vertex_i * JOINT_GROUP_SIZE + 3];
+				weights.write[vertex_i * weight_8_count + 4] = weights_1[vertex_i * JOINT_GROUP_SIZE + 0];
+				weights.write[vertex_i * weight_8_count + 5] = weights_1[vertex_i * JOINT_GROUP_SIZE + 1];
+				weights.write[vertex_i * weight_8_count + 6] = weights_1[vertex_i * JOINT_GROUP_SIZE + 2];
+				weights.write[vertex_i * weight_8_count + 7] = weights_1[vertex_i * JOINT_GROUP_SIZE + 3];
+			}
+			{ //gltf does not seem to normalize the weights for some reason..
+				int wc = weights.size();
+				float *w = weights.ptrw();
+
+				for (int k = 0; k < wc; k += weight_8_count) {
+					float total = 0.0;
+					total += w[k + 0];
+					total += w[k + 1];
+					total += w[k + 2];
+					total += w[k + 3];
+					total += w[k + 4];
+					total += w[k + 5];
+					total += w[k + 6];
+					total += w[k + 7];
+					if (total > 0.0) {
+						w[k + 0] /= total;
+						w[k + 1] /= total;
+						w[k + 2] /= total;
+						w[k + 3] /= total;
+						w[k + 4] /= total;
+						w[k + 5] /= total;
+						w[k + 6] /= total;
+						w[k + 7] /= total;
 					}
 				}
-				array[Mesh::ARRAY_WEIGHTS] = weights;
 			}
+			array[Mesh::ARRAY_WEIGHTS] = weights;
+		}
 
-			if (p.has("indices")) {
-				Vector<int> indices = _decode_accessor_as_ints(state, p["indices"], false);
+		if (p.has("indices")) {
+			Vector<int> indices = _decode_accessor_as_ints(state, p["indices"], false);
 
-				if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
-					//swap around indices, convert ccw to cw for front face
+			if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
+				//swap around indices, convert ccw to cw for front face
 
-					const int is = indices.size();
-					int *w = indices.ptrw();
-					for (int k = 0; k < is; k += 3) {
-						SWAP(w[k + 1], w[k + 2]);
-					}
+				const int is = indices.size();
+				int *w = indices.ptrw();
+				for (int k = 0; k < is; k += 3) {
+					SWAP(w[k + 1], w[k + 2]);
 				}
-				array[Mesh::ARRAY_INDEX] = indices;
-
-			} else if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
-				//generate indices because they need to be swapped for CW/CCW
-				const Vector<Vector3> &vertices = array[Mesh::ARRAY_VERTEX];
-				ERR_FAIL_COND_V(vertices.size() == 0, ERR_PARSE_ERROR);
-				Vector<int> indices;
-				const int vs = vertices.size();
-				indices.resize(vs);
-				{
-					int *w = indices.ptrw();
-					for (int k = 0; k < vs; k += 3) {
-						w[k] = k;
-						w[k + 1] = k + 2;
-						w[k + 2] = k + 1;
-					}
+			}
+			array[Mesh::ARRAY_INDEX] = indices;
+
+		} else if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
+			//generate indices because they need to be swapped for CW/CCW
+			const Vector<Vector3> &vertices = array[Mesh::ARRAY_VERTEX];
+			ERR_FAIL_COND_V(vertices.size() == 0, ERR_PARSE_ERROR);
+			Vector<int> indices;
+			const int vs = vertices.size();
+			indices.resize(vs);
+			{
+				int *w = indices.ptrw();
+				for (int k = 0; k < vs; k += 3) {
+					w[k] = k;
+					w[k + 1] = k + 2;
+					w[k + 2] = k + 1;
 				}
-				array[Mesh::ARRAY_INDEX] = indices;
 			}
+			array[Mesh::ARRAY_INDEX] = indices;
+		}
 
-			bool generate_tangents = (primitive == Mesh::PRIMITIVE_TRIANGLES && !a.has("TANGENT") && a.has("TEXCOORD_0") && a.has("NORMAL"));
+		bool generate_tangents = (primitive == Mesh::PRIMITIVE_TRIANGLES && !a.has("TANGENT") && a.has("TEXCOORD_0") && a.has("NORMAL"));
 
-			Ref<SurfaceTool> mesh_surface_tool;
-			mesh_surface_tool.instantiate();
-			mesh_surface_tool->create_from_triangle_arrays(array);
-			if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
-				mesh_surface_tool->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
-			}
-			mesh_surface_tool->index();
-			if (generate_tangents) {
-				//must generate mikktspace tangents.. ergh..
-				mesh_surface_tool->generate_tangents();
-			}
-			array = mesh_surface_tool->commit_to_arrays();
+		Ref<SurfaceTool> mesh_surface_tool;
+		mesh_surface_tool.instantiate();
+		mesh_surface_tool->create_from_triangle_arrays(array);
+		if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
+			mesh_surface_tool->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
+		}
+		mesh_surface_tool->index();
+		if (generate_tangents) {
+			//must generate mikktspace tangents.. ergh..
+			mesh_surface_tool->generate_tangents();
+		}
+		array = mesh_surface_tool->commit_to_arrays();
 
-			Array morphs;
-			//blend shapes
-			if (p.has("targets")) {
-				print_verbose("glTF: Mesh has targets");
-				const Array &targets = p["targets"];
-
-				//ideally BLEND_SHAPE_MODE_RELATIVE since gltf2 stores in displacement
-				//but it could require a larger refactor?
-				import_mesh->set_blend_shape_mode(Mesh::BLEND_SHAPE_MODE_NORMALIZED);
-
-				if (j == 0) {
-					const Array &target_names = extras.has("targetNames") ? (Array)extras["targetNames"] : Array();
-					for (int k = 0; k < targets.size(); k++) {
-						import_mesh->add_blend_shape(k < target_names.size() ? (String)target_names[k] : String("morph_") + itos(k));
-					}
-				}
+		Array morphs;
+		//blend shapes
+		if (p.has("targets")) {
+			print_verbose("glTF: Mesh has targets");
+			const Array &targets = p["targets"];
 
+			//ideally BLEND_SHAPE_MODE_RELATIVE since gltf2 stores in displacement
+			//but it could require a larger refactor?
+			import_mesh->set_blend_shape_mode(Mesh::BLEND_SHAPE_MODE_NORMALIZED);
+
+			if (j == 0) {
+				const Array &target_names = extras.has("targetNames") ? (Array)extras["targetNames"] : Array();
 				for (int k = 0; k < targets.size(); k++) {
-					const Dictionary &t = targets[k];
+					import_mesh->add_blend_shape(k < target_names.size() ? (String)target_names[k] : String("morph_") + itos(k));
+				}
+			}
 
-					Array array_copy;
-					array_copy.resize(Mesh::ARRAY_MAX);
+			for (int k = 0; k < targets.size(); k++) {
+				const Dictionary &t = targets[k];
 
-					for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
-						array_copy[l] = array[l];
-					}
+				Array array_copy;
+				array_copy.resize(Mesh::ARRAY_MAX);
 
-					if (t.has("POSITION")) {
-						Vector<Vector3> varr = _decode_accessor_as_vec3(state, t["POSITION"], true);
-						const Vector<Vector3> src_varr = array[Mesh::ARRAY_VERTEX];
-						const int size = src_varr.size();
-						ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
-						{
-							const int max_idx = varr.size();
-							varr.resize(size);
-
-							Vector3 *w_varr = varr.ptrw();
-							const Vector3 *r_varr = varr.ptr();
-							const Vector3 *r_src_varr = src_varr.ptr();
-							for (int l = 0; l < size; l++) {
-								if (l < max_idx) {
-									w_varr[l] = r_varr[l] + r_src_varr[l];
-								} else {
-									w_varr[l] = r_src_varr[l];
-								}
+				for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
+					array_copy[l] = array[l];
+				}
+
+				if (t.has("POSITION")) {
+					Vector<Vector3> varr = _decode_accessor_as_vec3(state, t["POSITION"], true);
+					const Vector<Vector3> src_varr = array[Mesh::ARRAY_VERTEX];
+					const int size = src_varr.size();
+					ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
+					{
+						const int max_idx = varr.size();
+						varr.resize(size);
+
+						Vector3 *w_varr = varr.ptrw();
+						const Vector3 *r_varr = varr.ptr();
+						const Vector3 *r_src_varr = src_varr.ptr();
+						for (int l = 0; l < size; l++) {
+							if (l < max_idx) {
+								w_varr[l] = r_varr[l] + r_src_varr[l];
+							} else {
+								w_varr[l] = r_src_varr[l];
 							}
 						}
-						array_copy[Mesh::ARRAY_VERTEX] = varr;
 					}
-					if (t.has("NORMAL")) {
-						Vector<Vector3> narr = _decode_accessor_as_vec3(state, t["NORMAL"], true);
-						const Vector<Vector3> src_narr = array[Mesh::ARRAY_NORMAL];
-						int size = src_narr.size();
-						ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
-						{
-							int max_idx = narr.size();
-							narr.resize(size);
-
-							Vector3 *w_narr = narr.ptrw();
-							const Vector3 *r_narr = narr.ptr();
-							const Vector3 *r_src_narr = src_narr.ptr();
-							for (int l = 0; l < size; l++) {
-								if (l < max_idx) {
-									w_narr[l] = r_narr[l] + r_src_narr[l];
-								} else {
-									w_narr[l] = r_src_narr[l];
-								}
+					array_copy[Mesh::ARRAY_VERTEX] = varr;
+				}
+				if (t.has("NORMAL")) {
+					Vector<Vector3> narr = _decode_accessor_as_vec3(state, t["NORMAL"], true);
+					const Vector<Vector3> src_narr = array[Mesh::ARRAY_NORMAL];
+					int size = src_narr.size();
+					ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
+					{
+						int max_idx = narr.size();
+						narr.resize(size);
+
+						Vector3 *w_narr = narr.ptrw();
+						const Vector3 *r_narr = narr.ptr();
+						const Vector3 *r_src_narr = src_narr.ptr();
+						for (int l = 0; l < size; l++) {
+							if (l < max_idx) {
+								w_narr[l] = r_narr[l] + r_src_narr[l];
+							} else {
+								w_narr[l] = r_src_narr[l];
 							}
 						}
-						array_copy[Mesh::ARRAY_NORMAL] = narr;
 					}
-					if (t.has("TANGENT")) {
-						const Vector<Vector3> tangents_v3 = _decode_accessor_as_vec3(state, t["TANGENT"], true);
-						const Vector<float> src_tangents = array[Mesh::ARRAY_TANGENT];
-						ERR_FAIL_COND_V(src_tangents.size() == 0, ERR_PARSE_ERROR);
+					array_copy[Mesh::ARRAY_NORMAL] = narr;
+				}
+				if (t.has("TANGENT")) {
+					const Vector<Vector3> tangents_v3 = _decode_accessor_as_vec3(state, t["TANGENT"], true);
+					const Vector<float> src_tangents = array[Mesh::ARRAY_TANGENT];
+					ERR_FAIL_COND_V(src_tangents.size() == 0, ERR_PARSE_ERROR);
 
-						Vector<float> tangents_v4;
+					Vector<float> tangents_v4;
 
-						{
-							int max_idx = tangents_v3.size();
-
-							int size4 = src_tangents.size();
-							tangents_v4.resize(size4);
-							float *w4 = tangents_v4.ptrw();
-
-							const Vector3 *r3 = tangents_v3.ptr();
-							const float *r4 = src_tangents.ptr();
-
-							for (int l = 0; l < size4 / 4; l++) {
-								if (l < max_idx) {
-									w4[l * 4 + 0] = r3[l].x + r4[l * 4 + 0];
-									w4[l * 4 + 1] = r3[l].y + r4[l * 4 + 1];
-									w4[l * 4 + 2] = r3[l].z + r4[l * 4 + 2];
-								} else {
-									w4[l * 4 + 0] = r4[l * 4 + 0];
-									w4[l * 4 + 1] = r4[l * 4 + 1];
-									w4[l * 4 + 2] = r4[l * 4 + 2];
-								}
-								w4[l * 4 + 3] = r4[l * 4 + 3]; //copy flip value
+					{
+						int max_idx = tangents_v3.size();
+
+						int size4 = src_tangents.size();
+						tangents_v4.resize(size4);
+						float *w4 = tangents_v4.ptrw();
+
+						const Vector3 *r3 = tangents_v3.ptr();
+						const float *r4 = src_tangents.ptr();
+
+						for (int l = 0; l < size4 / 4; l++) {
+							if (l < max_idx) {
+								w4[l * 4 + 0] = r3[l].x + r4[l * 4 + 0];
+								w4[l * 4 + 1] = r3[l].y + r4[l * 4 + 1];
+								w4[l * 4 + 2] = r3[l].z + r4[l * 4 + 2];
+							} else {
+								w4[l * 4 + 0] = r4[l * 4 + 0];
+								w4[l * 4 + 1] = r4[l * 4 + 1];
+								w4[l * 4 + 2] = r4[l * 4 + 2];
 							}
+							w4[l * 4 + 3] = r4[l * 4 + 3]; //copy flip value
 						}
-
-						array_copy[Mesh::ARRAY_TANGENT] = tangents_v4;
 					}
 
-					Ref<SurfaceTool> blend_surface_tool;
-					blend_surface_tool.instantiate();
-					blend_surface_tool->create_from_triangle_arrays(array_copy);
-					if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
-						blend_surface_tool->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
-					}
-					blend_surface_tool->index();
-					if (generate_tangents) {
-						blend_surface_tool->generate_tangents();
-					}
-					array_copy = blend_surface_tool->commit_to_arrays();
-
-					// Enforce blend shape mask array format
-					for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
-						if (!(Mesh::ARRAY_FORMAT_BLEND_SHAPE_MASK & (1 << l))) {
-							array_copy[l] = Variant();
-						}
-					}
+					array_copy[Mesh::ARRAY_TANGENT] = tangents_v4;
+				}
 
-					morphs.push_back(array_copy);
+				Ref<SurfaceTool> blend_surface_tool;
+				blend_surface_tool.instantiate();
+				blend_surface_tool->create_from_triangle_arrays(array_copy);
+				if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
+					blend_surface_tool->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
 				}
-			}
+				blend_surface_tool->index();
+				if (generate_tangents) {
+					blend_surface_tool->generate_tangents();
+				}
+				array_copy = blend_surface_tool->commit_to_arrays();
 
-			Ref<Material> mat;
-			String mat_name;
-			if (!state->discard_meshes_and_materials) {
-				if (p.has("material")) {
-					const int material = p["material"];
-					ERR_FAIL_INDEX_V(material, state->materials.size(), ERR_FILE_CORRUPT);
-					Ref<Material> mat3d = state->materials[material];
-					ERR_FAIL_NULL_V(mat3d, ERR_FILE_CORRUPT);
-
-					Ref<BaseMaterial3D> base_material = mat3d;
-					if (has_vertex_color && base_material.is_valid()) {
-						base_material->set_flag(BaseMaterial3D::FLAG_ALBEDO_FROM_VERTEX_COLOR, true);
+				// Enforce blend shape mask array format
+				for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
+					if (!(Mesh::ARRAY_FORMAT_BLEND_SHAPE_MASK & (1 << l))) {
+						array_copy[l] = Variant();
 					}
-					mat = mat3d;
-
-				} else {
-					Ref<StandardMaterial3D> mat3d;
-					mat3d.instantiate();
-					if (has_vertex_color) {
-						mat3d->set_flag(StandardMaterial3D::FLAG_ALBEDO_FROM_VERTEX_COLOR, true);
-					}
-					mat = mat3d;
 				}
-				ERR_FAIL_NULL_V(mat, ERR_FILE_CORRUPT);
-				mat_name = mat->get_name();
+
+				morphs.push_back(array_copy);
 			}
-			import_mesh->add_surface(primitive, array, morphs,
-					Dictionary(), mat, mat_name, flags);
 		}
 
-		Vector<float> blend_weights;
-		blend_weights.resize(import_mesh->get_blend_shape_count());
-		for (int32_t weight_i = 0; weight_i < blend_weights.size(); weight_i++) {
-			blend_weights.write[weight_i] = 0.0f;
-		}
+		Ref<Material> mat;
+		String mat_name;
+		if (!state->discard_meshes_and_materials) {
+			if (p.has("material")) {
+				const int material = p["material"];
+				ERR_FAIL_INDEX_V(material, state->materials.size(), ERR_FILE_CORRUPT);
+				Ref<Material> mat3d = state->materials[material];
+				ERR_FAIL_NULL_V(mat3d, ERR_FILE_CORRUPT);
+
+				if (has_vertex_color) {
+					// Shared between meshes, flagged once all of them are parsed.
+					r_job.vertex_color_materials.push_back(material);
+				}
+				mat = mat3d;
 
-		if (d.has("weights")) {
-			const Array &weights = d["weights"];
-			for (int j = 0; j < weights.size(); j++) {
-				if (j >= blend_weights.size()) {
-					break;
+			} else {
+				Ref<StandardMaterial3D> mat3d;
+				mat3d.instantiate();
+				if (has_vertex_color) {
+					mat3d->set_flag(StandardMaterial3D::FLAG_ALBEDO_FROM_VERTEX_COLOR, true);
 				}
-				blend_weights.write[j] = weights[j];
+				mat = mat3d;
 			}
+			ERR_FAIL_NULL_V(mat, ERR_FILE_CORRUPT);
+			mat_name = mat->get_name();
 		}
-		mesh->set_blend_weights(blend_weights);
-		mesh->set_mesh(import_mesh);
+		import_mesh->add_surface(primitive, array, morphs,
+				Dictionary(), mat, mat_name, flags);
+	}
 
-		state->meshes.push_back(mesh);
+	Vector<float> blend_weights;
+	blend_weights.resize(import_mesh->get_blend_shape_count());
+	for (int32_t weight_i = 0; weight_i < blend_weights.size(); weight_i++) {
+		blend_weights.write[weight_i] = 0.0f;
 	}
 
-	print_verbose("glTF: Total meshes: " + itos(state->meshes.size()));
+	if (d.has("weights")) {
+		const Array &weights = d["weights"];
+		for (int j = 0; j < weights.size(); j++) {
+			if (j >= blend_weights.size()) {
+				break;
+			}
+			blend_weights.write[j] = weights[j];
+		}
+	}
+	mesh->set_blend_weights(blend_weights);
+	mesh->set_mesh(import_mesh);
 
+	r_job.mesh = mesh;
 	return OK;
 }
 
@@ -3054,6 +3097,54 @@ Error GLTFDocument::_serialize_images(Ref<GLTFState> state, const String &p_path
 	return OK;
 }
 
+void GLTFDocument::_decode_image_task(uint32_t p_index, ImageDecodeJob *p_jobs) {
+	ImageDecodeJob &job = p_jobs[p_index];
+	if (!job.base64_uri.is_empty()) {
+		job.data = _parse_base64_uri(job.base64_uri);
+	}
+	if (!job.data.is_empty()) {
+		job.data_ptr = job.data.ptr();
+		job.data_size = job.data.size();
+	}
+
+	// First we honor the mime types if they were defined.
+	if (job.mimetype == "image/png") { // Load buffer as PNG.
+		if (Image::_png_mem_loader_func == nullptr) {
+			job.error = ERR_UNAVAILABLE;
+			return;
+		}
+		job.image = Image::_png_mem_loader_func(job.data_ptr, job.data_size);
+	} else if (job.mimetype == "image/jpeg") { // Loader buffer as JPEG.
+		if (Image::_jpg_mem_loader_func == nullptr) {
+			job.error = ERR_UNAVAILABLE;
+			return;
+		}
+		job.image = Image::_jpg_mem_loader_func(job.data_ptr, job.data_size);
+	}
+
+	// If we didn't pass the above tests, we attempt loading as PNG and then
+	// JPEG directly.
+	// This covers URIs with base64-encoded data with application/* type but
+	// no optional mimeType property, or bufferViews with a bogus mimeType
+	// (e.g. `image/jpeg` but the data is actually PNG).
+	// That's not *exactly* what the spec mandates but this lets us be
+	// lenient with bogus glb files which do exist in production.
+	if (job.image.is_null()) { // Try PNG first.
+		if (Image::_png_mem_loader_func == nullptr) {
+			job.error = ERR_UNAVAILABLE;
+			return;
+		}
+		job.image = Image::_png_mem_loader_func(job.data_ptr, job.data_size);
+	}
+	if (job.image.is_null()) { // And then JPEG.
+		if (Image::_jpg_mem_loader_func == nullptr) {
+			job.error = ERR_UNAVAILABLE;
+			return;
+		}
+		job.image = Image::_jpg_mem_loader_func(job.data_ptr, job.data_size);
+	}
+}
+
 Error GLTFDocument::_parse_images(Ref<GLTFState> state, const String &p_base_path) {
 	ERR_FAIL_NULL_V(state, ERR_INVALID_PARAMETER);
 	if (!state->json.has("images")) {
@@ -3063,6 +3154,7 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> state, const String &p_base_pat
 	// Ref: https://github.com/KhronosGroup/glTF/blob/master/specification/2.0/README.md#images
 
 	const Array &images = state->json["images"];
+	LocalVector<ImageDecodeJob> jobs;
 	for (int i = 0; i < images.size(); i++) {
 		const Dictionary &d = images[i];
 
@@ -3085,9 +3177,8 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> state, const String &p_base_pat
 			mimetype = d["mimeType"];
 		}
 
-		Vector<uint8_t> data;
-		const uint8_t *data_ptr = nullptr;
-		int data_size = 0;
+		ImageDecodeJob job;
+		job.index = i;
 
 		if (d.has("uri")) {
 			// Handles the first two bullet points from the spec (embedded data, or external file).
@@ -3103,9 +3194,7 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> state, const String &p_base_pat
 					state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
 					continue;
 				}
-				data = _parse_base64_uri(uri);
-				data_ptr = data.ptr();
-				data_size = data.size();
+				job.base64_uri = uri; // Decoded along with the image.
 				// mimeType is optional, but if we have it defined in the URI, let's use it.
 				if (mimetype.is_empty()) {
 					if (uri.begins_with("data:image/png;base64")) {
@@ -3131,14 +3220,12 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> state, const String &p_base_pat
 					// Fallback to loading as byte array.
 					// This enables us to support the spec's requirement that we honor mimetype
 					// regardless of file URI.
-					data = FileAccess::get_file_as_bytes(uri);
-					if (data.size() == 0) {
+					job.data = FileAccess::get_file_as_bytes(uri);
+					if (job.data.size() == 0) {
 						WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded as a buffer of MIME type '%s' from URI: %s. Skipping it.", i, mimetype, uri));
 						state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
 						continue;
 					}
-					data_ptr = data.ptr();
-					data_size = data.size();
 				} else {
 					WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded from URI: %s. Skipping it.", i, uri));
 					state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
@@ -3161,43 +3248,36 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> state, const String &p_base_pat
 
 			ERR_FAIL_COND_V(bv->byte_offset + bv->byte_length > state->buffers[bi].size(), ERR_FILE_CORRUPT);
 
-			data_ptr = &state->buffers[bi][bv->byte_offset];
-			data_size = bv->byte_length;
+			job.data_ptr = &state->buffers[bi][bv->byte_offset];
+			job.data_size = bv->byte_length;
 		}
 
-		Ref<Image> img;
+		job.mimetype = mimetype;
+		job.texture_index = state->images.size();
+		jobs.push_back(job);
+		state->images.push_back(Ref<Texture2D>()); // Filled once decoded.
+	}
 
-		// First we honor the mime types if they were defined.
-		if (mimetype == "image/png") { // Load buffer as PNG.
-			ERR_FAIL_COND_V(Image::_png_mem_loader_func == nullptr, ERR_UNAVAILABLE);
-			img = Image::_png_mem_loader_func(data_ptr, data_size);
-		} else if (mimetype == "image/jpeg") { // Loader buffer as JPEG.
-			ERR_FAIL_COND_V(Image::_jpg_mem_loader_func == nullptr, ERR_UNAVAILABLE);
-			img = Image::_jpg_mem_loader_func(data_ptr, data_size);
+	// Decoding PNG/JPEG data is by far the slowest part, and each image is independent.
+	if (jobs.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GLTFDocument::_decode_image_task, jobs.ptr(), jobs.size(), -1, true, SNAME("GLTFImages"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < jobs.size(); i++) {
+			_decode_image_task(i, jobs.ptr());
 		}
+	}
 
-		// If we didn't pass the above tests, we attempt loading as PNG and then
-		// JPEG directly.
-		// This covers URIs with base64-encoded data with application/* type but
-		// no optional mimeType property, or bufferViews with a bogus mimeType
-		// (e.g. `image/jpeg` but the data is actually PNG).
-		// That's not *exactly* what the spec mandates but this lets us be
-		// lenient with bogus glb files which do exist in production.
-		if (img.is_null()) { // Try PNG first.
-			ERR_FAIL_COND_V(Image::_png_mem_loader_func == nullptr, ERR_UNAVAILABLE);
-			img = Image::_png_mem_loader_func(data_ptr, data_size);
-		}
-		if (img.is_null()) { // And then JPEG.
-			ERR_FAIL_COND_V(Image::_jpg_mem_loader_func == nullptr, ERR_UNAVAILABLE);
-			img = Image::_jpg_mem_loader_func(data_ptr, data_size);
-		}
+	// Textures are created in order, as they talk to the RenderingServer.
+	for (uint32_t i = 0; i < jobs.size(); i++) {
+		const ImageDecodeJob &job = jobs[i];
+		ERR_FAIL_COND_V(job.error != OK, job.error);
 		// Now we've done our best, fix your scenes.
-		if (img.is_null()) {
-			ERR_PRINT(vformat("glTF: Couldn't load image index '%d' with its given mimetype: %s.", i, mimetype));
-			state->images.push_back(Ref<Texture2D>());
+		if (job.image.is_null()) {
+			ERR_PRINT(vformat("glTF: Couldn't load image index '%d' with its given mimetype: %s.", job.index, job.mimetype));
 			continue;
 		}
-		state->images.push_back(ImageTexture::create_from_image(img));
+		state->images.write[job.texture_index] = ImageTexture::create_from_image(job.image);
 	}
 
 	print_verbose("glTF: Total images: " + itos(state->images.size()));
@@ -4944,6 +5024,8 @@ Error GLTFDocument::_parse_animations(Ref<GLTFState> state) {
 	}
 
 	const Array &animations = state->json["animations"];
+	AnimationParseData animation_data;
+	animation_data.state = state;
 
 	for (GLTFAnimationIndex i = 0; i < animations.size(); i++) {
 		const Dictionary &d = animations[i];
@@ -4955,9 +5037,6 @@ Error GLTFDocument::_parse_animations(Ref<GLTFState> state) {
 			continue;
 		}
 
-		Array channels = d["channels"];
-		Array samplers = d["samplers"];
-
 		if (d.has("name")) {
 			const String anim_name = d["name"];
 			const String anim_name_lower = anim_name.to_lower();
@@ -4967,112 +5046,145 @@ Error GLTFDocument::_parse_animations(Ref<GLTFState> state) {
 			animation->set_name(_gen_unique_animation_name(state, anim_name));
 		}
 
-		for (int j = 0; j < channels.size(); j++) {
-			const Dictionary &c = channels[j];
-			if (!c.has("target")) {
-				continue;
-			}
-
-			const Dictionary &t = c["target"];
-			if (!t.has("node") || !t.has("path")) {
-				continue;
-			}
-
-			ERR_FAIL_COND_V(!c.has("sampler"), ERR_PARSE_ERROR);
-			const int sampler = c["sampler"];
-			ERR_FAIL_INDEX_V(sampler, samplers.size(), ERR_PARSE_ERROR);
+		AnimationParseJob job;
+		job.dict = d;
+		job.animation = animation;
+		animation_data.jobs.push_back(job);
+	}
 
-			GLTFNodeIndex node = t["node"];
-			String path = t["path"];
+	// Channels of different animations never share tracks, so animations decode in parallel.
+	if (animation_data.jobs.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GLTFDocument::_parse_animation_task, &animation_data, animation_data.jobs.size(), -1, true, SNAME("GLTFAnimations"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < animation_data.jobs.size(); i++) {
+			_parse_animation_task(i, &animation_data);
+		}
+	}
 
-			ERR_FAIL_INDEX_V(node, state->nodes.size(), ERR_PARSE_ERROR);
+	for (uint32_t i = 0; i < animation_data.jobs.size(); i++) {
+		const AnimationParseJob &job = animation_data.jobs[i];
+		if (job.error != OK) {
+			return job.error;
+		}
+		state->animations.push_back(job.animation);
+	}
 
-			GLTFAnimation::Track *track = nullptr;
+	print_verbose("glTF: Total animations '" + itos(state->animations.size()) + "'.");
 
-			if (!animation->get_tracks().has(node)) {
-				animation->get_tracks()[node] = GLTFAnimation::Track();
-			}
+	return OK;
+}
 
-			track = &animation->get_tracks()[node];
+void GLTFDocument::_parse_animation_task(uint32_t p_index, AnimationParseData *p_data) {
+	AnimationParseJob &job = p_data->jobs[p_index];
+	job.error = _parse_animation(p_data->state, job.dict, job.animation);
+}
 
-			const Dictionary &s = samplers[sampler];
+Error GLTFDocument::_parse_animation(Ref<GLTFState> state, const Dictionary &d, Ref<GLTFAnimation> animation) {
+	Array channels = d["channels"];
+	Array samplers = d["samplers"];
 
-			ERR_FAIL_COND_V(!s.has("input"), ERR_PARSE_ERROR);
-			ERR_FAIL_COND_V(!s.has("output"), ERR_PARSE_ERROR);
+	for (int j = 0; j < channels.size(); j++) {
+		const Dictionary &c = channels[j];
+		if (!c.has("target")) {
+			continue;
+		}
 
-			const int input = s["input"];
-			const int output = s["output"];
+		const Dictionary &t = c["target"];
+		if (!t.has("node") || !t.has("path")) {
+			continue;
+		}
 
-			GLTFAnimation::Interpolation interp = GLTFAnimation::INTERP_LINEAR;
-			int output_count = 1;
-			if (s.has("interpolation")) {
-				const String &in = s["interpolation"];
-				if (in == "STEP") {
-					interp = GLTFAnimation::INTERP_STEP;
-				} else if (in == "LINEAR") {
-					interp = GLTFAnimation::INTERP_LINEAR;
-				} else if (in == "CATMULLROMSPLINE") {
-					interp = GLTFAnimation::INTERP_CATMULLROMSPLINE;
-					output_count = 3;
-				} else if (in == "CUBICSPLINE") {
-					interp = GLTFAnimation::INTERP_CUBIC_SPLINE;
-					output_count = 3;
+		ERR_FAIL_COND_V(!c.has("sampler"), ERR_PARSE_ERROR);
+		const int sampler = c["sampler"];
+		ERR_FAIL_INDEX_V(sampler, samplers.size(), ERR_PARSE_ERROR);
+
+		GLTFNodeIndex node = t["node"];
+		String path = t["path"];
+
+		ERR_FAIL_INDEX_V(node, state->nodes.size(), ERR_PARSE_ERROR);
+
+		GLTFAnimation::Track *track = nullptr;
+
+		if (!animation->get_tracks().has(node)) {
+			animation->get_tracks()[node] = GLTFAnimation::Track();
+		}
+
+		track = &animation->get_tracks()[node];
+
+		const Dictionary &s = samplers[sampler];
+
+		ERR_FAIL_COND_V(!s.has("input"), ERR_PARSE_ERROR);
+		ERR_FAIL_COND_V(!s.has("output"), ERR_PARSE_ERROR);
+
+		const int input = s["input"];
+		const int output = s["output"];
+
+		GLTFAnimation::Interpolation interp = GLTFAnimation::INTERP_LINEAR;
+		int output_count = 1;
+		if (s.has("interpolation")) {
+			const String &in = s["interpolation"];
+			if (in == "STEP") {
+				interp = GLTFAnimation::INTERP_STEP;
+			} else if (in == "LINEAR") {
+				interp = GLTFAnimation::INTERP_LINEAR;
+			} else if (in == "CATMULLROMSPLINE") {
+				interp = GLTFAnimation::INTERP_CATMULLROMSPLINE;
+				output_count = 3;
+			} else if (in == "CUBICSPLINE") {
+				interp = GLTFAnimation::INTERP_CUBIC_SPLINE;
+				output_count = 3;
+			}
+		}
+
+		const Vector<float> times = _decode_accessor_as_floats(state, input, false);
+		if (path == "translation") {
+			const Vector<Vector3> positions = _decode_accessor_as_vec3(state, output, false);
+			track->position_track.interpolation = interp;
+			track->position_track.times = Variant(times); //convert via variant
+			track->position_track.values = Variant(positions); //convert via variant
+		} else if (path == "rotation") {
+			const Vector<Quaternion> rotations = _decode_accessor_as_quaternion(state, output, false);
+			track->rotation_track.interpolation = interp;
+			track->rotation_track.times = Variant(times); //convert via variant
+			track->rotation_track.values = rotations;
+		} else if (path == "scale") {
+			const Vector<Vector3> scales = _decode_accessor_as_vec3(state, output, false);
+			track->scale_track.interpolation = interp;
+			track->scale_track.times = Variant(times); //convert via variant
+			track->scale_track.values = Variant(scales); //convert via variant
+		} else if (path == "weights") {
+			const Vector<float> weights = _decode_accessor_as_floats(state, output, false);
+
+			ERR_FAIL_INDEX_V(state->nodes[node]->mesh, state->meshes.size(), ERR_PARSE_ERROR);
+			Ref<GLTFMesh> mesh = state->meshes[state->nodes[node]->mesh];
+			ERR_CONTINUE(!mesh->get_blend_weights().size());
+			const int wc = mesh->get_blend_weights().size();
+
+			track->weight_tracks.resize(wc);
+
+			const int expected_value_count = times.size() * output_count * wc;
+			ERR_CONTINUE_MSG(weights.size() != expected_value_count, "Invalid weight data, expected " + itos(expected_value_count) + " weight values, got " + itos(weights.size()) + " instead.");
+
+			const int wlen = weights.size() / wc;
+			for (int k = 0; k < wc; k++) { //separate tracks, having them together is not such a good idea
+				GLTFAnimation::Channel<real_t> cf;
+				cf.interpolation = interp;
+				cf.times = Variant(times);
+				Vector<real_t> wdata;
+				wdata.resize(wlen);
+				for (int l = 0; l < wlen; l++) {
+					wdata.write[l] = weights[l * wc + k];
 				}
-			}
-
-			const Vector<float> times = _decode_accessor_as_floats(state, input, false);
-			if (path == "translation") {
-				const Vector<Vector3> positions = _decode_accessor_as_vec3(state, output, false);
-				track->position_track.interpolation = interp;
-				track->position_track.times = Variant(times); //convert via variant
-				track->position_track.values = Variant(positions); //convert via variant
-			} else if (path == "rotation") {
-				const Vector<Quaternion> rotations = _decode_accessor_as_quaternion(state, output, false);
-				track->rotation_track.interpolation = interp;
-				track->rotation_track.times = Variant(times); //convert via variant
-				track->rotation_track.values = rotations;
-			} else if (path == "scale") {
-				const Vector<Vector3> scales = _decode_accessor_as_vec3(state, output, false);
-				track->scale_track.interpolation = interp;
-				track->scale_track.times = Variant(times); //convert via variant
-				track->scale_track.values = Variant(scales); //convert via variant
-			} else if (path == "weights") {
-				const Vector<float> weights = _decode_accessor_as_floats(state, output, false);
-
-				ERR_FAIL_INDEX_V(state->nodes[node]->mesh, state->meshes.size(), ERR_PARSE_ERROR);
-				Ref<GLTFMesh> mesh = state->meshes[state->nodes[node]->mesh];
-				ERR_CONTINUE(!mesh->get_blend_weights().size());
-				const int wc = mesh->get_blend_weights().size();
-
-				track->weight_tracks.resize(wc);
-
-				const int expected_value_count = times.size() * output_count * wc;
-				ERR_CONTINUE_MSG(weights.size() != expected_value_count, "Invalid weight data, expected " + itos(expected_value_count) + " weight values, got " + itos(weights.size()) + " instead.");
-
-				const int wlen = weights.size() / wc;
-				for (int k = 0; k < wc; k++) { //separate tracks, having them together is not such a good idea
-					GLTFAnimation::Channel<real_t> cf;
-					cf.interpolation = interp;
-					cf.times = Variant(times);
-					Vector<real_t> wdata;
-					wdata.resize(wlen);
-					for (int l = 0; l < wlen; l++) {
-						wdata.write[l] = weights[l * wc + k];
-					}
 
-					cf.values = wdata;
-					track->weight_tracks.write[k] = cf;
-				}
-			} else {
-				WARN_PRINT("Invalid path '" + path + "'.");
+				cf.values = wdata;
+				track->weight_tracks.write[k] = cf;
 			}
+		} else {
+			WARN_PRINT("Invalid path '" + path + "'.");
 		}
-
-		state->animations.push_back(animation);
 	}
 
-	print_verbose("glTF: Total animations '" + itos(state->animations.size()) + "'.");
-
 	return OK;
 }
 
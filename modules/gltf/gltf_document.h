@@ -43,6 +43,43 @@ class GLTFDocument : public Resource {
 private:
 	const float BAKE_FPS = 30.0f;
 
+	// Per-item state for the parsing steps that run on the WorkerThreadPool.
+	struct MeshParseJob {
+		Dictionary dict;
+		String name;
+		Ref<GLTFMesh> mesh;
+		LocalVector<int> vertex_color_materials;
+		Error error = OK;
+	};
+
+	struct MeshParseData {
+		Ref<GLTFState> state;
+		LocalVector<MeshParseJob> jobs;
+	};
+
+	struct ImageDecodeJob {
+		int index = 0; // In the glTF "images" array, for messages.
+		int texture_index = 0; // In GLTFState::images.
+		String mimetype;
+		String base64_uri;
+		Vector<uint8_t> data;
+		const uint8_t *data_ptr = nullptr;
+		int data_size = 0;
+		Ref<Image> image;
+		Error error = OK;
+	};
+
+	struct AnimationParseJob {
+		Dictionary dict;
+		Ref<GLTFAnimation> animation;
+		Error error = OK;
+	};
+
+	struct AnimationParseData {
+		Ref<GLTFState> state;
+		LocalVector<AnimationParseJob> jobs;
+	};
+
 public:
 	const int32_t JOINT_GROUP_SIZE = 4;
 
@@ -143,11 +180,14 @@ private:
 			const GLTFAccessorIndex p_accessor,
 			const bool p_for_vertex);
 	Error _parse_meshes(Ref<GLTFState> state);
+	void _parse_mesh_task(uint32_t p_index, MeshParseData *p_data);
+	Error _parse_mesh(Ref<GLTFState> state, MeshParseJob &r_job);
 	Error _serialize_textures(Ref<GLTFState> state);
 	Error _serialize_texture_samplers(Ref<GLTFState> state);
 	Error _serialize_images(Ref<GLTFState> state, const String &p_path);
 	Error _serialize_lights(Ref<GLTFState> state);
 	Error _parse_images(Ref<GLTFState> state, const String &p_base_path);
+	void _decode_image_task(uint32_t p_index, ImageDecodeJob *p_jobs);
 	Error _parse_textures(Ref<GLTFState> state);
 	Error _parse_texture_samplers(Ref<GLTFState> state);
 	Error _parse_materials(Ref<GLTFState> state);
@@ -182,6 +222,8 @@ private:
 	Error _parse_cameras(Ref<GLTFState> state);
 	Error _parse_lights(Ref<GLTFState> state);
 	Error _parse_animations(Ref<GLTFState> state);
+	void _parse_animation_task(uint32_t p_index, AnimationParseData *p_data);
+	Error _parse_animation(Ref<GLTFState> state, const Dictionary &d, Ref<GLTFAnimation> animation);
 	Error _serialize_animations(Ref<GLTFState> state);
 	BoneAttachment3D *_generate_bone_attachment(Ref<GLTFState> state,
 			Skeleton3D *skeleton,
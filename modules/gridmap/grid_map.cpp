@@ -32,6 +32,7 @@
 
 #include "core/io/marshalls.h"
 #include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/light_3d.h"
 #include "scene/resources/mesh_library.h"
 #include "scene/resources/physics_material.h"
@@ -349,72 +350,119 @@ void GridMap::set_cell_item(const Vector3i &p_position, int p_item, int p_rot) {
 	ERR_FAIL_INDEX(ABS(p_position.y), 1 << 20);
 	ERR_FAIL_INDEX(ABS(p_position.z), 1 << 20);
 
-	IndexKey key;
-	key.x = p_position.x;
-	key.y = p_position.y;
-	key.z = p_position.z;
+	Octant *octant_cache = nullptr;
+	OctantKey octant_cache_key;
+	_set_cell_item(IndexKey(p_position), p_item, p_rot, octant_cache, octant_cache_key);
+}
+
+void GridMap::set_cell_items(const PackedInt32Array &p_positions, const PackedInt32Array &p_items, const PackedInt32Array &p_orientations) {
+	// Positions are stored as consecutive x, y and z values.
+	int cell_count = p_items.size();
+	ERR_FAIL_COND_MSG(p_positions.size() != cell_count * 3, "The positions array must hold three values per cell.");
+	ERR_FAIL_COND_MSG(!p_orientations.is_empty() && p_orientations.size() != cell_count, "The orientations array must be empty or hold one value per cell.");
+
+	if (baked_meshes.size() && !recreating_octants) {
+		clear_baked_meshes();
+		_recreate_octant_data();
+	}
 
+	const int32_t *positions = p_positions.ptr();
+	const int32_t *items = p_items.ptr();
+	const int32_t *orientations = p_orientations.is_empty() ? nullptr : p_orientations.ptr();
+
+	cell_map.reserve(cell_map.size() + cell_count);
+
+	// Consecutive cells usually fall in the same octant, so keep the last one around.
+	Octant *octant_cache = nullptr;
+	OctantKey octant_cache_key;
+	for (int i = 0; i < cell_count; i++) {
+		Vector3i position(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]);
+		ERR_CONTINUE(ABS(position.x) >= 1 << 20 || ABS(position.y) >= 1 << 20 || ABS(position.z) >= 1 << 20);
+		_set_cell_item(IndexKey(position), items[i], orientations ? orientations[i] : 0, octant_cache, octant_cache_key);
+	}
+}
+
+GridMap::Octant *GridMap::_octant_create(const OctantKey &p_key) {
+	Octant *g = memnew(Octant);
+	g->dirty = true;
+	g->static_body = PhysicsServer3D::get_singleton()->body_create();
+	PhysicsServer3D::get_singleton()->body_set_mode(g->static_body, PhysicsServer3D::BODY_MODE_STATIC);
+	PhysicsServer3D::get_singleton()->body_attach_object_instance_id(g->static_body, get_instance_id());
+	PhysicsServer3D::get_singleton()->body_set_collision_layer(g->static_body, collision_layer);
+	PhysicsServer3D::get_singleton()->body_set_collision_mask(g->static_body, collision_mask);
+	if (physics_material.is_valid()) {
+		PhysicsServer3D::get_singleton()->body_set_param(g->static_body, PhysicsServer3D::BODY_PARAM_FRICTION, physics_material->get_friction());
+		PhysicsServer3D::get_singleton()->body_set_param(g->static_body, PhysicsServer3D::BODY_PARAM_BOUNCE, physics_material->get_bounce());
+	}
+	SceneTree *st = SceneTree::get_singleton();
+
+	if (st && st->is_debugging_collisions_hint()) {
+		g->collision_debug = RenderingServer::get_singleton()->mesh_create();
+		g->collision_debug_instance = RenderingServer::get_singleton()->instance_create();
+		RenderingServer::get_singleton()->instance_set_base(g->collision_debug_instance, g->collision_debug);
+	}
+
+	octant_map[p_key] = g;
+
+	if (is_inside_world()) {
+		_octant_enter_world(p_key);
+		_octant_transform(p_key);
+	}
+
+	return g;
+}
+
+void GridMap::_set_cell_item(const IndexKey &p_key, int p_item, int p_rot, Octant *&r_octant_cache, OctantKey &r_octant_cache_key) {
 	OctantKey ok;
-	ok.x = p_position.x / octant_size;
-	ok.y = p_position.y / octant_size;
-	ok.z = p_position.z / octant_size;
+	ok.x = p_key.x / octant_size;
+	ok.y = p_key.y / octant_size;
+	ok.z = p_key.z / octant_size;
+
+	Octant *g = nullptr;
+	if (r_octant_cache && r_octant_cache_key == ok) {
+		g = r_octant_cache;
+	}
 
 	if (p_item < 0) {
 		//erase
-		if (cell_map.has(key)) {
-			OctantKey octantkey = ok;
-
-			ERR_FAIL_COND(!octant_map.has(octantkey));
-			Octant &g = *octant_map[octantkey];
-			g.cells.erase(key);
-			g.dirty = true;
-			cell_map.erase(key);
+		if (cell_map.has(p_key)) {
+			if (!g) {
+				Octant **octant = octant_map.getptr(ok);
+				ERR_FAIL_COND(!octant);
+				g = *octant;
+			}
+			g->cells.erase(p_key);
+			g->dirty = true;
+			cell_map.erase(p_key);
 			_queue_octants_dirty();
+
+			r_octant_cache = g;
+			r_octant_cache_key = ok;
 		}
 		return;
 	}
 
-	OctantKey octantkey = ok;
-
-	if (!octant_map.has(octantkey)) {
-		//create octant because it does not exist
-		Octant *g = memnew(Octant);
-		g->dirty = true;
-		g->static_body = PhysicsServer3D::get_singleton()->body_create();
-		PhysicsServer3D::get_singleton()->body_set_mode(g->static_body, PhysicsServer3D::BODY_MODE_STATIC);
-		PhysicsServer3D::get_singleton()->body_attach_object_instance_id(g->static_body, get_instance_id());
-		PhysicsServer3D::get_singleton()->body_set_collision_layer(g->static_body, collision_layer);
-		PhysicsServer3D::get_singleton()->body_set_collision_mask(g->static_body, collision_mask);
-		if (physics_material.is_valid()) {
-			PhysicsServer3D::get_singleton()->body_set_param(g->static_body, PhysicsServer3D::BODY_PARAM_FRICTION, physics_material->get_friction());
-			PhysicsServer3D::get_singleton()->body_set_param(g->static_body, PhysicsServer3D::BODY_PARAM_BOUNCE, physics_material->get_bounce());
-		}
-		SceneTree *st = SceneTree::get_singleton();
-
-		if (st && st->is_debugging_collisions_hint()) {
-			g->collision_debug = RenderingServer::get_singleton()->mesh_create();
-			g->collision_debug_instance = RenderingServer::get_singleton()->instance_create();
-			RenderingServer::get_singleton()->instance_set_base(g->collision_debug_instance, g->collision_debug);
-		}
-
-		octant_map[octantkey] = g;
-
-		if (is_inside_world()) {
-			_octant_enter_world(octantkey);
-			_octant_transform(octantkey);
+	if (!g) {
+		Octant **octant = octant_map.getptr(ok);
+		if (octant) {
+			g = *octant;
+		} else {
+			//create octant because it does not exist
+			g = _octant_create(ok);
 		}
+		r_octant_cache = g;
+		r_octant_cache_key = ok;
 	}
 
-	Octant &g = *octant_map[octantkey];
-	g.cells.insert(key);
-	g.dirty = true;
+	g->cells.insert(p_key);
+	g->dirty = true;
 	_queue_octants_dirty();
 
 	Cell c;
 	c.item = p_item;
 	c.rot = p_rot;
 
-	cell_map[key] = c;
+	cell_map[p_key] = c;
 }
 
 int GridMap::get_cell_item(const Vector3i &p_position) const {
@@ -558,13 +606,7 @@ void GridMap::_octant_transform(const OctantKey &p_key) {
 	}
 }
 
-bool GridMap::_octant_update(const OctantKey &p_key) {
-	ERR_FAIL_COND_V(!octant_map.has(p_key), false);
-	Octant &g = *octant_map[p_key];
-	if (!g.dirty) {
-		return false;
-	}
-
+void GridMap::_octant_clear_server_data(Octant &g) {
 	//erase body shapes
 	PhysicsServer3D::get_singleton()->body_clear_shapes(g.static_body);
 
@@ -589,149 +631,197 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		RS::get_singleton()->free(g.multimesh_instances[i].multimesh);
 	}
 	g.multimesh_instances.clear();
+}
 
-	if (g.cells.size() == 0) {
-		//octant no longer needed
-		_octant_clean_up(p_key);
-		return true;
-	}
+void GridMap::_build_octant_update(uint32_t p_index, OctantUpdate *p_updates) {
+	OctantUpdate &update = p_updates[p_index];
+	const Octant &g = *update.octant;
 
-	Vector<Vector3> col_debug;
+	if (!mesh_library.is_valid()) {
+		return;
+	}
 
 	/*
 	 * foreach item in this octant,
-	 * set item's multimesh's instance count to number of cells which have this item
-	 * and set said multimesh bounding box to one containing all cells which have this item
+	 * collect the transforms of the cells which have this item into a single multimesh buffer,
+	 * along with the shapes and navigation meshes of every cell
 	 */
 
-	HashMap<int, List<Pair<Transform3D, IndexKey>>> multimesh_items;
+	Vector3 ofs = _get_offset();
+	bool use_multimeshes = baked_meshes.size() == 0;
+
+	HashMap<int, uint32_t> multimesh_indices;
+	LocalVector<LocalVector<Pair<Transform3D, IndexKey>>> multimesh_transforms;
 
 	for (const IndexKey &E : g.cells) {
-		ERR_CONTINUE(!cell_map.has(E));
-		const Cell &c = cell_map[E];
+		const Cell *c = cell_map.getptr(E);
+		ERR_CONTINUE(!c);
 
-		if (!mesh_library.is_valid() || !mesh_library->has_item(c.item)) {
+		if (!mesh_library->has_item(c->item)) {
 			continue;
 		}
 
 		Vector3 cellpos = Vector3(E.x, E.y, E.z);
-		Vector3 ofs = _get_offset();
 
 		Transform3D xform;
 
-		xform.basis = _ortho_bases[c.rot];
+		xform.basis = _ortho_bases[c->rot];
 		xform.set_origin(cellpos * cell_size + ofs);
 		xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
-		if (baked_meshes.size() == 0) {
-			if (mesh_library->get_item_mesh(c.item).is_valid()) {
-				if (!multimesh_items.has(c.item)) {
-					multimesh_items[c.item] = List<Pair<Transform3D, IndexKey>>();
-				}
-
-				Pair<Transform3D, IndexKey> p;
-				p.first = xform * mesh_library->get_item_mesh_transform(c.item);
-				p.second = E;
-				multimesh_items[c.item].push_back(p);
+		if (use_multimeshes && mesh_library->get_item_mesh(c->item).is_valid()) {
+			HashMap<int, uint32_t>::Iterator I = multimesh_indices.find(c->item);
+			if (!I) {
+				I = multimesh_indices.insert(c->item, update.multimeshes.size());
+				OctantUpdate::MultimeshData multimesh;
+				multimesh.item = c->item;
+				update.multimeshes.push_back(multimesh);
+				multimesh_transforms.push_back(LocalVector<Pair<Transform3D, IndexKey>>());
 			}
+			multimesh_transforms[I->value].push_back(Pair<Transform3D, IndexKey>(xform * mesh_library->get_item_mesh_transform(c->item), E));
 		}
 
-		Vector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c.item);
-		// add the item's shape at given xform to octant's static_body
+		Vector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c->item);
 		for (int i = 0; i < shapes.size(); i++) {
-			// add the item's shape
 			if (!shapes[i].shape.is_valid()) {
 				continue;
 			}
-			PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, shapes[i].shape->get_rid(), xform * shapes[i].local_transform);
-			if (g.collision_debug.is_valid()) {
-				shapes.write[i].shape->add_vertices_to_array(col_debug, xform * shapes[i].local_transform);
-			}
+			OctantUpdate::Shape shape;
+			shape.shape = shapes[i].shape;
+			shape.xform = xform * shapes[i].local_transform;
+			update.shapes.push_back(shape);
 		}
 
-		// add the item's navmesh at given xform to GridMap's Navigation ancestor
-		Ref<NavigationMesh> navmesh = mesh_library->get_item_navmesh(c.item);
+		Ref<NavigationMesh> navmesh = mesh_library->get_item_navmesh(c->item);
 		if (navmesh.is_valid()) {
-			Octant::NavMesh nm;
-			nm.xform = xform * mesh_library->get_item_navmesh_transform(c.item);
-
-			if (bake_navigation) {
-				RID region = NavigationServer3D::get_singleton()->region_create();
-				NavigationServer3D::get_singleton()->region_set_owner_id(region, get_instance_id());
-				NavigationServer3D::get_singleton()->region_set_navigation_layers(region, navigation_layers);
-				NavigationServer3D::get_singleton()->region_set_navmesh(region, navmesh);
-				NavigationServer3D::get_singleton()->region_set_transform(region, get_global_transform() * nm.xform);
-				if (is_inside_tree()) {
-					if (map_override.is_valid()) {
-						NavigationServer3D::get_singleton()->region_set_map(region, map_override);
-					} else {
-						NavigationServer3D::get_singleton()->region_set_map(region, get_world_3d()->get_navigation_map());
-					}
+			OctantUpdate::NavMesh nm;
+			nm.key = E;
+			nm.navmesh = navmesh;
+			nm.xform = xform * mesh_library->get_item_navmesh_transform(c->item);
+			update.navmeshes.push_back(nm);
+		}
+	}
+
+	// Pack the transforms in the layout RenderingServer::multimesh_set_buffer expects, so each multimesh is filled with a single call.
+	for (uint32_t i = 0; i < update.multimeshes.size(); i++) {
+		OctantUpdate::MultimeshData &multimesh = update.multimeshes[i];
+		const LocalVector<Pair<Transform3D, IndexKey>> &transforms = multimesh_transforms[i];
+
+		multimesh.buffer.resize(transforms.size() * 12);
+		float *w = multimesh.buffer.ptrw();
+		for (uint32_t j = 0; j < transforms.size(); j++) {
+			const Transform3D &t = transforms[j].first;
+			float *dataptr = w + j * 12;
+			dataptr[0] = t.basis.rows[0][0];
+			dataptr[1] = t.basis.rows[0][1];
+			dataptr[2] = t.basis.rows[0][2];
+			dataptr[3] = t.origin.x;
+			dataptr[4] = t.basis.rows[1][0];
+			dataptr[5] = t.basis.rows[1][1];
+			dataptr[6] = t.basis.rows[1][2];
+			dataptr[7] = t.origin.y;
+			dataptr[8] = t.basis.rows[2][0];
+			dataptr[9] = t.basis.rows[2][1];
+			dataptr[10] = t.basis.rows[2][2];
+			dataptr[11] = t.origin.z;
+		}
+
+#ifdef TOOLS_ENABLED
+		multimesh.items.resize(transforms.size());
+		Octant::MultimeshInstance::Item *items = multimesh.items.ptrw();
+		for (uint32_t j = 0; j < transforms.size(); j++) {
+			items[j].index = j;
+			items[j].transform = transforms[j].first;
+			items[j].key = transforms[j].second;
+		}
+#endif
+	}
+}
+
+void GridMap::_commit_octant_update(OctantUpdate &p_update) {
+	Octant &g = *p_update.octant;
+	bool inside_tree = is_inside_tree();
+	Transform3D global_xform = inside_tree ? get_global_transform() : Transform3D();
+
+	Vector<Vector3> col_debug;
+
+	// add the items' shapes at their xform to octant's static_body
+	for (uint32_t i = 0; i < p_update.shapes.size(); i++) {
+		OctantUpdate::Shape &shape = p_update.shapes[i];
+		PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, shape.shape->get_rid(), shape.xform);
+		if (g.collision_debug.is_valid()) {
+			shape.shape->add_vertices_to_array(col_debug, shape.xform);
+		}
+	}
+
+	// add the items' navmeshes at their xform to GridMap's Navigation ancestor
+	for (uint32_t i = 0; i < p_update.navmeshes.size(); i++) {
+		OctantUpdate::NavMesh &navmesh = p_update.navmeshes[i];
+		Octant::NavMesh nm;
+		nm.xform = navmesh.xform;
+
+		if (bake_navigation) {
+			RID region = NavigationServer3D::get_singleton()->region_create();
+			NavigationServer3D::get_singleton()->region_set_owner_id(region, get_instance_id());
+			NavigationServer3D::get_singleton()->region_set_navigation_layers(region, navigation_layers);
+			NavigationServer3D::get_singleton()->region_set_navmesh(region, navmesh.navmesh);
+			NavigationServer3D::get_singleton()->region_set_transform(region, global_xform * nm.xform);
+			if (inside_tree) {
+				if (map_override.is_valid()) {
+					NavigationServer3D::get_singleton()->region_set_map(region, map_override);
+				} else {
+					NavigationServer3D::get_singleton()->region_set_map(region, get_world_3d()->get_navigation_map());
 				}
-				nm.region = region;
+			}
+			nm.region = region;
 
 #ifdef DEBUG_ENABLED
-				// add navigation debugmesh visual instances if debug is enabled
-				SceneTree *st = SceneTree::get_singleton();
-				if (st && st->is_debugging_navigation_hint()) {
-					if (!nm.navmesh_debug_instance.is_valid()) {
-						RID navmesh_debug_rid = navmesh->get_debug_mesh()->get_rid();
-						nm.navmesh_debug_instance = RS::get_singleton()->instance_create();
-						RS::get_singleton()->instance_set_base(nm.navmesh_debug_instance, navmesh_debug_rid);
-					}
-					if (is_inside_tree()) {
-						RS::get_singleton()->instance_set_scenario(nm.navmesh_debug_instance, get_world_3d()->get_scenario());
-						RS::get_singleton()->instance_set_transform(nm.navmesh_debug_instance, get_global_transform() * nm.xform);
-					}
+			// add navigation debugmesh visual instances if debug is enabled
+			SceneTree *st = SceneTree::get_singleton();
+			if (st && st->is_debugging_navigation_hint()) {
+				if (!nm.navmesh_debug_instance.is_valid()) {
+					RID navmesh_debug_rid = navmesh.navmesh->get_debug_mesh()->get_rid();
+					nm.navmesh_debug_instance = RS::get_singleton()->instance_create();
+					RS::get_singleton()->instance_set_base(nm.navmesh_debug_instance, navmesh_debug_rid);
+				}
+				if (inside_tree) {
+					RS::get_singleton()->instance_set_scenario(nm.navmesh_debug_instance, get_world_3d()->get_scenario());
+					RS::get_singleton()->instance_set_transform(nm.navmesh_debug_instance, global_xform * nm.xform);
 				}
-#endif // DEBUG_ENABLED
 			}
-			g.navmesh_ids[E] = nm;
+#endif // DEBUG_ENABLED
 		}
+		g.navmesh_ids[navmesh.key] = nm;
 	}
 
 #ifdef DEBUG_ENABLED
 	if (bake_navigation) {
-		_update_octant_navigation_debug_edge_connections_mesh(p_key);
+		_update_octant_navigation_debug_edge_connections_mesh(p_update.key);
 	}
 #endif // DEBUG_ENABLED
 
-	//update multimeshes, only if not baked
-	if (baked_meshes.size() == 0) {
-		for (const KeyValue<int, List<Pair<Transform3D, IndexKey>>> &E : multimesh_items) {
-			Octant::MultimeshInstance mmi;
-
-			RID mm = RS::get_singleton()->multimesh_create();
-			RS::get_singleton()->multimesh_allocate_data(mm, E.value.size(), RS::MULTIMESH_TRANSFORM_3D);
-			RS::get_singleton()->multimesh_set_mesh(mm, mesh_library->get_item_mesh(E.key)->get_rid());
-
-			int idx = 0;
-			for (const Pair<Transform3D, IndexKey> &F : E.value) {
-				RS::get_singleton()->multimesh_instance_set_transform(mm, idx, F.first);
-#ifdef TOOLS_ENABLED
+	//update multimeshes, the update is only built if not baked
+	for (uint32_t i = 0; i < p_update.multimeshes.size(); i++) {
+		const OctantUpdate::MultimeshData &multimesh = p_update.multimeshes[i];
+		Octant::MultimeshInstance mmi;
 
-				Octant::MultimeshInstance::Item it;
-				it.index = idx;
-				it.transform = F.first;
-				it.key = F.second;
-				mmi.items.push_back(it);
-#endif
-
-				idx++;
-			}
+		RID mm = RS::get_singleton()->multimesh_create();
+		RS::get_singleton()->multimesh_allocate_data(mm, multimesh.buffer.size() / 12, RS::MULTIMESH_TRANSFORM_3D);
+		RS::get_singleton()->multimesh_set_mesh(mm, mesh_library->get_item_mesh(multimesh.item)->get_rid());
+		RS::get_singleton()->multimesh_set_buffer(mm, multimesh.buffer);
+		mmi.items = multimesh.items;
 
-			RID instance = RS::get_singleton()->instance_create();
-			RS::get_singleton()->instance_set_base(instance, mm);
+		RID instance = RS::get_singleton()->instance_create();
+		RS::get_singleton()->instance_set_base(instance, mm);
 
-			if (is_inside_tree()) {
-				RS::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
-				RS::get_singleton()->instance_set_transform(instance, get_global_transform());
-			}
+		if (inside_tree) {
+			RS::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
+			RS::get_singleton()->instance_set_transform(instance, global_xform);
+		}
 
-			mmi.multimesh = mm;
-			mmi.instance = instance;
+		mmi.multimesh = mm;
+		mmi.instance = instance;
 
-			g.multimesh_instances.push_back(mmi);
-		}
+		g.multimesh_instances.push_back(mmi);
 	}
 
 	if (col_debug.size()) {
@@ -747,8 +837,6 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 	}
 
 	g.dirty = false;
-
-	return false;
 }
 
 void GridMap::_reset_physic_bodies_collision_filters() {
@@ -983,8 +1071,11 @@ void GridMap::_recreate_octant_data() {
 	recreating_octants = true;
 	HashMap<IndexKey, Cell, IndexKey> cell_copy = cell_map;
 	_clear_internal();
+	cell_map.reserve(cell_copy.size());
+	Octant *octant_cache = nullptr;
+	OctantKey octant_cache_key;
 	for (const KeyValue<IndexKey, Cell> &E : cell_copy) {
-		set_cell_item(Vector3i(E.key), E.value.item, E.value.rot);
+		_set_cell_item(E.key, E.value.item, E.value.rot, octant_cache, octant_cache_key);
 	}
 	recreating_octants = false;
 }
@@ -1018,10 +1109,40 @@ void GridMap::_update_octants_callback() {
 	}
 
 	List<OctantKey> to_delete;
+	LocalVector<OctantUpdate> octant_updates;
 	for (const KeyValue<OctantKey, Octant *> &E : octant_map) {
-		if (_octant_update(E.key)) {
+		Octant &g = *E.value;
+		if (!g.dirty) {
+			continue;
+		}
+
+		_octant_clear_server_data(g);
+
+		if (g.cells.size() == 0) {
+			//octant no longer needed
+			_octant_clean_up(E.key);
 			to_delete.push_back(E.key);
+			continue;
 		}
+
+		OctantUpdate update;
+		update.key = E.key;
+		update.octant = E.value;
+		octant_updates.push_back(update);
+	}
+
+	// Gather what the dirty octants contain, then create all their server objects in one pass.
+	if (octant_updates.size() >= OCTANT_UPDATE_MIN_PARALLEL_SIZE && Thread::get_caller_id() == Thread::get_main_id()) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GridMap::_build_octant_update, octant_updates.ptr(), octant_updates.size(), -1, true, SNAME("Update GridMap octants"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
+		for (uint32_t i = 0; i < octant_updates.size(); i++) {
+			_build_octant_update(i, octant_updates.ptr());
+		}
+	}
+
+	for (uint32_t i = 0; i < octant_updates.size(); i++) {
+		_commit_octant_update(octant_updates[i]);
 	}
 
 	while (to_delete.front()) {
@@ -1075,6 +1196,7 @@ void GridMap::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_octant_size"), &GridMap::get_octant_size);
 
 	ClassDB::bind_method(D_METHOD("set_cell_item", "position", "item", "orientation"), &GridMap::set_cell_item, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("set_cell_items", "positions", "items", "orientations"), &GridMap::set_cell_items, DEFVAL(PackedInt32Array()));
 	ClassDB::bind_method(D_METHOD("get_cell_item", "position"), &GridMap::get_cell_item);
 	ClassDB::bind_method(D_METHOD("get_cell_item_orientation", "position"), &GridMap::get_cell_item_orientation);
 	ClassDB::bind_method(D_METHOD("get_cell_item_basis", "position"), &GridMap::get_cell_item_basis);
@@ -1271,6 +1393,7 @@ void GridMap::make_baked_meshes(bool p_gen_lightmap_uv, float p_lightmap_uv_texe
 		}
 	}
 
+	Vector<Ref<ArrayMesh>> unwrap_meshes;
 	for (KeyValue<OctantKey, HashMap<Ref<Material>, Ref<SurfaceTool>>> &E : surface_map) {
 		Ref<ArrayMesh> mesh;
 		mesh.instantiate();
@@ -1289,11 +1412,16 @@ void GridMap::make_baked_meshes(bool p_gen_lightmap_uv, float p_lightmap_uv_texe
 		}
 
 		if (p_gen_lightmap_uv) {
-			mesh->lightmap_unwrap(get_global_transform(), p_lightmap_uv_texel_size);
+			unwrap_meshes.push_back(mesh);
 		}
 		baked_meshes.push_back(bm);
 	}
 
+	if (unwrap_meshes.size()) {
+		// Octant meshes are independent, unwrap them all at once.
+		ArrayMesh::lightmap_unwrap_meshes(unwrap_meshes, get_global_transform(), p_lightmap_uv_texel_size);
+	}
+
 	_recreate_octant_data();
 }
 
@@ -185,10 +185,43 @@ class GridMap : public Node3D {
 		return Vector3(p_key.x, p_key.y, p_key.z) * cell_size * octant_size;
 	}
 
+	// Everything an octant rebuild needs from the cells and the MeshLibrary. It is built without touching any
+	// server, so dirty octants can be gathered on the WorkerThreadPool and then committed together.
+	struct OctantUpdate {
+		struct MultimeshData {
+			int item = 0;
+			Vector<float> buffer;
+			Vector<Octant::MultimeshInstance::Item> items;
+		};
+
+		struct Shape {
+			Ref<Shape3D> shape;
+			Transform3D xform;
+		};
+
+		struct NavMesh {
+			IndexKey key;
+			Ref<NavigationMesh> navmesh;
+			Transform3D xform;
+		};
+
+		OctantKey key;
+		Octant *octant = nullptr;
+		LocalVector<MultimeshData> multimeshes;
+		LocalVector<Shape> shapes;
+		LocalVector<NavMesh> navmeshes;
+	};
+
+	static constexpr uint32_t OCTANT_UPDATE_MIN_PARALLEL_SIZE = 4;
+
 	void _reset_physic_bodies_collision_filters();
 	void _octant_enter_world(const OctantKey &p_key);
 	void _octant_exit_world(const OctantKey &p_key);
-	bool _octant_update(const OctantKey &p_key);
+	Octant *_octant_create(const OctantKey &p_key);
+	void _octant_clear_server_data(Octant &g);
+	void _build_octant_update(uint32_t p_index, OctantUpdate *p_updates);
+	void _commit_octant_update(OctantUpdate &p_update);
+	void _set_cell_item(const IndexKey &p_key, int p_item, int p_rot, Octant *&r_octant_cache, OctantKey &r_octant_cache_key);
 	void _octant_clean_up(const OctantKey &p_key);
 	void _octant_transform(const OctantKey &p_key);
 #ifdef DEBUG_ENABLED
@@ -274,6 +307,7 @@ public:
 	bool get_center_z() const;
 
 	void set_cell_item(const Vector3i &p_position, int p_item, int p_rot = 0);
+	void set_cell_items(const PackedInt32Array &p_positions, const PackedInt32Array &p_items, const PackedInt32Array &p_orientations = PackedInt32Array());
 	int get_cell_item(const Vector3i &p_position) const;
 	int get_cell_item_orientation(const Vector3i &p_position) const;
 	Basis get_cell_item_basis(const Vector3i &p_position) const;
@@ -31,7 +31,10 @@
 #include "lightmapper_rd.h"
 
 #include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
 #include "core/math/geometry_2d.h"
+#include "core/os/os.h"
 #include "lm_blendseams.glsl.gen.h"
 #include "lm_compute.glsl.gen.h"
 #include "lm_raster.glsl.gen.h"
@@ -662,6 +665,126 @@ LightmapperRD::BakeError LightmapperRD::_dilate(RenderingDevice *rd, Ref<RDShade
 	return BAKE_OK;
 }
 
+#define CHECKPOINT_MAGIC 0x50434d4c // "LMCP"
+
+uint32_t LightmapperRD::_get_checkpoint_key(const PushConstant &p_push_constant, int p_bounces, bool p_bake_sh, int p_region_size, int p_max_rays, const Vector<Ref<Image>> &p_albedo_images, const Vector<Ref<Image>> &p_emission_images, const Ref<Image> &p_environment_panorama) const {
+	// Fields that change between dispatches are not part of the bake inputs.
+	PushConstant pc = p_push_constant;
+	pc.ray_from = 0;
+	pc.ray_to = 0;
+	pc.atlas_slice = 0;
+	pc.region_ofs[0] = 0;
+	pc.region_ofs[1] = 0;
+
+	uint32_t h = hash_murmur3_buffer(&pc, sizeof(PushConstant));
+	h = hash_murmur3_one_32(p_bounces, h);
+	h = hash_murmur3_one_32(p_bake_sh ? 1 : 0, h);
+	h = hash_murmur3_one_32(p_region_size, h);
+	h = hash_murmur3_one_32(p_max_rays, h);
+
+	for (int i = 0; i < mesh_instances.size(); i++) {
+		const MeshInstance &mi = mesh_instances[i];
+		h = hash_murmur3_buffer(mi.data.points.ptr(), mi.data.points.size() * sizeof(Vector3), h);
+		h = hash_murmur3_buffer(mi.data.normal.ptr(), mi.data.normal.size() * sizeof(Vector3), h);
+		h = hash_murmur3_buffer(mi.data.uv2.ptr(), mi.data.uv2.size() * sizeof(Vector2), h);
+		h = hash_murmur3_one_32(mi.slice, h);
+		h = hash_murmur3_one_32(mi.offset.x, h);
+		h = hash_murmur3_one_32(mi.offset.y, h);
+	}
+	h = hash_murmur3_buffer(lights.ptr(), lights.size() * sizeof(Light), h);
+
+	for (int i = 0; i < p_albedo_images.size(); i++) {
+		Vector<uint8_t> data = p_albedo_images[i]->get_data();
+		h = hash_murmur3_buffer(data.ptr(), data.size(), h);
+		data = p_emission_images[i]->get_data();
+		h = hash_murmur3_buffer(data.ptr(), data.size(), h);
+	}
+	if (p_environment_panorama.is_valid()) {
+		Vector<uint8_t> data = p_environment_panorama->get_data();
+		h = hash_murmur3_buffer(data.ptr(), data.size(), h);
+	}
+
+	return hash_fmix32(h);
+}
+
+String LightmapperRD::_get_checkpoint_path(uint32_t p_key) const {
+	return ProjectSettings::get_singleton()->get_project_data_path().path_join(vformat("lightmap_checkpoint_%08x.bin", p_key));
+}
+
+bool LightmapperRD::_load_checkpoint(const String &p_path, uint32_t p_key, int p_layers, int p_accum_layers, Checkpoint &r_checkpoint) const {
+	if (!FileAccess::exists(p_path)) {
+		return false;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	if (f.is_null()) {
+		return false;
+	}
+
+	if (f->get_32() != CHECKPOINT_MAGIC || f->get_32() != p_key) {
+		return false;
+	}
+
+	r_checkpoint.pass = f->get_32();
+
+	Vector<Vector<uint8_t>> *targets[3] = { &r_checkpoint.source_data, &r_checkpoint.dest_data, &r_checkpoint.accum_data };
+	for (int i = 0; i < 3; i++) {
+		int layers = f->get_32();
+		if (layers != (i == 2 ? p_accum_layers : p_layers)) {
+			return false;
+		}
+		targets[i]->resize(layers);
+		for (int j = 0; j < layers; j++) {
+			uint32_t size = f->get_32();
+			Vector<uint8_t> &data = targets[i]->write[j];
+			data.resize(size);
+			if (f->get_buffer(data.ptrw(), size) != size) {
+				return false; // Truncated, likely the bake was interrupted while writing it.
+			}
+		}
+	}
+
+	return true;
+}
+
+void LightmapperRD::_save_checkpoint(RenderingDevice *rd, const String &p_path, uint32_t p_key, uint32_t p_pass, RID p_source_tex, RID p_dest_tex, RID p_accum_tex, int p_layers, int p_accum_layers) const {
+	// Write next to the previous checkpoint and swap it in once complete, so a crash while saving keeps the old one.
+	String tmp_path = p_path + ".tmp";
+	{
+		Ref<FileAccess> f = FileAccess::open(tmp_path, FileAccess::WRITE);
+		ERR_FAIL_COND_MSG(f.is_null(), "Can't write lightmap bake checkpoint: " + tmp_path);
+
+		f->store_32(CHECKPOINT_MAGIC);
+		f->store_32(p_key);
+		f->store_32(p_pass);
+
+		RID textures[3] = { p_source_tex, p_dest_tex, p_accum_tex };
+		for (int i = 0; i < 3; i++) {
+			int layers = i == 2 ? p_accum_layers : p_layers;
+			f->store_32(layers);
+			for (int j = 0; j < layers; j++) {
+				Vector<uint8_t> data = rd->texture_get_data(textures[i], j);
+				f->store_32(data.size());
+				f->store_buffer(data.ptr(), data.size());
+			}
+		}
+	}
+
+	DirAccess::rename_absolute(tmp_path, p_path);
+}
+
+void LightmapperRD::_restore_checkpoint(RenderingDevice *rd, const Checkpoint &p_checkpoint, RID p_source_tex, RID p_dest_tex, RID p_accum_tex) const {
+	for (int i = 0; i < p_checkpoint.source_data.size(); i++) {
+		rd->texture_update(p_source_tex, i, p_checkpoint.source_data[i]);
+		rd->texture_update(p_dest_tex, i, p_checkpoint.dest_data[i]);
+	}
+	for (int i = 0; i < p_checkpoint.accum_data.size(); i++) {
+		rd->texture_update(p_accum_tex, i, p_checkpoint.accum_data[i]);
+	}
+	rd->submit();
+	rd->sync();
+}
+
 LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_denoiser, int p_bounces, float p_bias, int p_max_texture_size, bool p_bake_sh, GenerateProbes p_generate_probes, const Ref<Image> &p_environment_panorama, const Basis &p_environment_transform, BakeStepFunc p_step_function, void *p_bake_userdata, float p_exposure_normalization) {
 	if (p_step_function) {
 		p_step_function(0.0, RTR("Begin Bake"), p_bake_userdata, true);
@@ -1182,6 +1305,8 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 		p_step_function(0.6, RTR("Integrate indirect lighting"), p_bake_userdata, true);
 	}
 
+	String checkpoint_path;
+
 	if (p_bounces > 0) {
 		Vector<RD::Uniform> uniforms;
 		{
@@ -1249,6 +1374,21 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 		int y_regions = (atlas_size.height - 1) / max_region_size + 1;
 		int ray_iterations = (push_constant.ray_count - 1) / max_rays + 1;
 
+		// Every completed pass can be checkpointed. A bake with the same inputs skips the passes stored in the
+		// checkpoint and continues from its textures, which makes aborted or crashed bakes resumable.
+		uint64_t checkpoint_interval = uint64_t(MAX(0, int(GLOBAL_GET("rendering/lightmapping/bake_performance/checkpoint_interval")))) * 1000;
+		int accum_layers = atlas_slices * (p_bake_sh ? 4 : 1);
+		uint32_t checkpoint_key = 0;
+		Checkpoint checkpoint;
+		bool resuming = false;
+		if (checkpoint_interval > 0) {
+			checkpoint_key = _get_checkpoint_key(push_constant, p_bounces, p_bake_sh, max_region_size, max_rays, albedo_images, emission_images, p_environment_panorama);
+			checkpoint_path = _get_checkpoint_path(checkpoint_key);
+			resuming = _load_checkpoint(checkpoint_path, checkpoint_key, atlas_slices, accum_layers, checkpoint);
+		}
+		uint64_t last_checkpoint_msec = OS::get_singleton()->get_ticks_msec();
+		uint32_t pass = 0;
+
 		rd->submit();
 		rd->sync();
 
@@ -1275,6 +1415,16 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 						group_size = Vector3i((w - 1) / 8 + 1, (h - 1) / 8 + 1, 1);
 
 						for (int k = 0; k < ray_iterations; k++) {
+							if (resuming) {
+								if (pass < checkpoint.pass) {
+									pass++;
+									count++;
+									continue;
+								}
+								_restore_checkpoint(rd, checkpoint, light_source_tex, light_dest_tex, light_accum_tex);
+								resuming = false;
+							}
+
 							RD::ComputeListID compute_list = rd->compute_list_begin();
 							rd->compute_list_bind_compute_pipeline(compute_list, compute_shader_secondary_pipeline);
 							rd->compute_list_bind_uniform_set(compute_list, compute_base_uniform_set, 0);
@@ -1289,12 +1439,28 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 							rd->submit();
 							rd->sync();
 
+							pass++;
 							count++;
+							bool abort = false;
 							if (p_step_function) {
 								int total = (atlas_slices * x_regions * y_regions * ray_iterations);
 								int percent = count * 100 / total;
 								float p = float(count) / total * 0.1;
-								p_step_function(0.6 + p, vformat(RTR("Bounce %d/%d: Integrate indirect lighting %d%%"), b + 1, p_bounces, percent), p_bake_userdata, false);
+								abort = p_step_function(0.6 + p, vformat(RTR("Bounce %d/%d: Integrate indirect lighting %d%%"), b + 1, p_bounces, percent), p_bake_userdata, false);
+							}
+
+							if (checkpoint_interval > 0 && (abort || OS::get_singleton()->get_ticks_msec() - last_checkpoint_msec >= checkpoint_interval)) {
+								_save_checkpoint(rd, checkpoint_path, checkpoint_key, pass, light_source_tex, light_dest_tex, light_accum_tex, atlas_slices, accum_layers);
+								last_checkpoint_msec = OS::get_singleton()->get_ticks_msec();
+							}
+
+							if (abort) {
+								FREE_TEXTURES
+								FREE_BUFFERS
+								FREE_RASTER_RESOURCES
+								FREE_COMPUTE_RESOURCES
+								memdelete(rd);
+								return BAKE_ERROR_USER_ABORTED;
 							}
 						}
 					}
@@ -1307,6 +1473,11 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 			}
 		}
 
+		if (resuming) {
+			// The checkpoint was taken after the last pass.
+			_restore_checkpoint(rd, checkpoint, light_source_tex, light_dest_tex, light_accum_tex);
+		}
+
 		// Restore the correct environment transform
 		push_constant.environment_xform[3] = 0.0f;
 	}
@@ -1657,6 +1828,10 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 
 	memdelete(rd);
 
+	if (!checkpoint_path.is_empty() && FileAccess::exists(checkpoint_path)) {
+		DirAccess::remove_absolute(checkpoint_path);
+	}
+
 	return BAKE_OK;
 }
 
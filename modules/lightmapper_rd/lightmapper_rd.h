@@ -229,6 +229,20 @@ class LightmapperRD : public Lightmapper {
 	Vector<Ref<Image>> bake_textures;
 	Vector<Color> probe_values;
 
+	// Indirect lighting state written to disk while baking, so an interrupted bake of the same scene can resume.
+	struct Checkpoint {
+		uint32_t pass = 0;
+		Vector<Vector<uint8_t>> source_data;
+		Vector<Vector<uint8_t>> dest_data;
+		Vector<Vector<uint8_t>> accum_data;
+	};
+
+	uint32_t _get_checkpoint_key(const PushConstant &p_push_constant, int p_bounces, bool p_bake_sh, int p_region_size, int p_max_rays, const Vector<Ref<Image>> &p_albedo_images, const Vector<Ref<Image>> &p_emission_images, const Ref<Image> &p_environment_panorama) const;
+	String _get_checkpoint_path(uint32_t p_key) const;
+	bool _load_checkpoint(const String &p_path, uint32_t p_key, int p_layers, int p_accum_layers, Checkpoint &r_checkpoint) const;
+	void _save_checkpoint(RenderingDevice *rd, const String &p_path, uint32_t p_key, uint32_t p_pass, RID p_source_tex, RID p_dest_tex, RID p_accum_tex, int p_layers, int p_accum_layers) const;
+	void _restore_checkpoint(RenderingDevice *rd, const Checkpoint &p_checkpoint, RID p_source_tex, RID p_dest_tex, RID p_accum_tex) const;
+
 	BakeError _blit_meshes_into_atlas(int p_max_texture_size, Vector<Ref<Image>> &albedo_images, Vector<Ref<Image>> &emission_images, AABB &bounds, Size2i &atlas_size, int &atlas_slices, BakeStepFunc p_step_function, void *p_bake_userdata);
 	void _create_acceleration_structures(RenderingDevice *rd, Size2i atlas_size, int atlas_slices, AABB &bounds, int grid_size, Vector<Probe> &probe_positions, GenerateProbes p_generate_probes, Vector<int> &slice_triangle_count, Vector<int> &slice_seam_count, RID &vertex_buffer, RID &triangle_buffer, RID &lights_buffer, RID &triangle_cell_indices_buffer, RID &probe_positions_buffer, RID &grid_texture, RID &seams_buffer, BakeStepFunc p_step_function, void *p_bake_userdata);
 	void _raster_geometry(RenderingDevice *rd, Size2i atlas_size, int atlas_slices, int grid_size, AABB bounds, float p_bias, Vector<int> slice_triangle_count, RID position_tex, RID unocclude_tex, RID normal_tex, RID raster_depth_buffer, RID rasterize_shader, RID raster_base_uniform);
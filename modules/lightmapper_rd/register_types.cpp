@@ -51,6 +51,7 @@ void initialize_lightmapper_rd_module(ModuleInitializationLevel p_level) {
 	GLOBAL_DEF("rendering/lightmapping/bake_quality/ultra_quality_ray_count", 1024);
 	GLOBAL_DEF("rendering/lightmapping/bake_performance/max_rays_per_pass", 32);
 	GLOBAL_DEF("rendering/lightmapping/bake_performance/region_size", 512);
+	GLOBAL_DEF("rendering/lightmapping/bake_performance/checkpoint_interval", 60);
 
 	GLOBAL_DEF("rendering/lightmapping/bake_quality/low_quality_probe_ray_count", 64);
 	GLOBAL_DEF("rendering/lightmapping/bake_quality/medium_quality_probe_ray_count", 256);
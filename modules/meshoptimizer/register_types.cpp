@@ -32,6 +32,11 @@
 #include "scene/resources/surface_tool.h"
 #include "thirdparty/meshoptimizer/meshoptimizer.h"
 
+static size_t _build_meshlets(SurfaceTool::Meshlet *r_meshlets, unsigned int *r_meshlet_vertices, unsigned char *r_meshlet_triangles, const unsigned int *p_indices, size_t p_index_count, const float *p_vertex_positions, size_t p_vertex_count, size_t p_vertex_positions_stride, size_t p_max_vertices, size_t p_max_triangles, float p_cone_weight) {
+	static_assert(sizeof(SurfaceTool::Meshlet) == sizeof(meshopt_Meshlet), "SurfaceTool::Meshlet must match meshopt_Meshlet.");
+	return meshopt_buildMeshlets((meshopt_Meshlet *)r_meshlets, r_meshlet_vertices, r_meshlet_triangles, p_indices, p_index_count, p_vertex_positions, p_vertex_count, p_vertex_positions_stride, p_max_vertices, p_max_triangles, p_cone_weight);
+}
+
 void initialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
@@ -45,6 +50,8 @@ void initialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	SurfaceTool::generate_remap_func = meshopt_generateVertexRemap;
 	SurfaceTool::remap_vertex_func = meshopt_remapVertexBuffer;
 	SurfaceTool::remap_index_func = meshopt_remapIndexBuffer;
+	SurfaceTool::build_meshlets_func = _build_meshlets;
+	SurfaceTool::build_meshlets_bound_func = meshopt_buildMeshletsBound;
 }
 
 void uninitialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
@@ -59,4 +66,6 @@ void uninitialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	SurfaceTool::generate_remap_func = nullptr;
 	SurfaceTool::remap_vertex_func = nullptr;
 	SurfaceTool::remap_index_func = nullptr;
+	SurfaceTool::build_meshlets_func = nullptr;
+	SurfaceTool::build_meshlets_bound_func = nullptr;
 }
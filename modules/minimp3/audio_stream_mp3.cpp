@@ -38,6 +38,10 @@
 #include "core/io/file_access.h"
 
 int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
+	return decode_ahead.mix(p_buffer, p_frames);
+}
+
+int AudioStreamPlaybackMP3::decode_ahead_frames(AudioFrame *p_buffer, int p_frames) {
 	if (!active) {
 		return 0;
 	}
@@ -76,7 +80,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 					}
 				}
 				loop_fade_remaining = 0;
-				seek(mp3_stream->loop_offset);
+				_seek(mp3_stream->loop_offset);
 				loops++;
 			}
 		}
@@ -84,7 +88,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 		else {
 			//EOF
 			if (mp3_stream->loop) {
-				seek(mp3_stream->loop_offset);
+				_seek(mp3_stream->loop_offset);
 				loops++;
 			} else {
 				frames_mixed_this_step = p_frames - todo;
@@ -105,29 +109,48 @@ float AudioStreamPlaybackMP3::get_stream_sampling_rate() {
 }
 
 void AudioStreamPlaybackMP3::start(double p_from_pos) {
+	decode_ahead.begin_restart();
 	active = true;
-	seek(p_from_pos);
+	_seek(p_from_pos);
 	loops = 0;
+	decode_ahead.end_restart();
 	begin_resample();
 }
 
 void AudioStreamPlaybackMP3::stop() {
+	decode_ahead.begin_restart();
 	active = false;
+	decode_ahead.end_restart();
 }
 
 bool AudioStreamPlaybackMP3::is_playing() const {
-	return active;
+	// The decoder may have reached the end while decoded frames are still waiting to be mixed.
+	return active || decode_ahead.has_frames();
 }
 
 int AudioStreamPlaybackMP3::get_loop_count() const {
-	return loops;
+	return decode_ahead.get_loop_count();
 }
 
 double AudioStreamPlaybackMP3::get_playback_position() const {
+	return decode_ahead.get_playback_position(mp3_stream->sample_rate);
+}
+
+double AudioStreamPlaybackMP3::decode_ahead_get_position() const {
 	return double(frames_mixed) / mp3_stream->sample_rate;
 }
 
+int AudioStreamPlaybackMP3::decode_ahead_get_loop_count() const {
+	return loops;
+}
+
 void AudioStreamPlaybackMP3::seek(double p_time) {
+	decode_ahead.begin_restart();
+	_seek(p_time);
+	decode_ahead.end_restart();
+}
+
+void AudioStreamPlaybackMP3::_seek(double p_time) {
 	if (!active) {
 		return;
 	}
@@ -145,6 +168,7 @@ void AudioStreamPlaybackMP3::tag_used_streams() {
 }
 
 AudioStreamPlaybackMP3::~AudioStreamPlaybackMP3() {
+	decode_ahead.release();
 	if (mp3d) {
 		mp3dec_ex_close(mp3d);
 		memfree(mp3d);
@@ -32,13 +32,14 @@
 #define AUDIO_STREAM_MP3_H
 
 #include "core/io/resource_loader.h"
+#include "servers/audio/audio_decode_ahead.h"
 #include "servers/audio/audio_stream.h"
 
 #include "minimp3_ex.h"
 
 class AudioStreamMP3;
 
-class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled {
+class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled, public AudioDecodeAhead::Decoder {
 	GDCLASS(AudioStreamPlaybackMP3, AudioStreamPlaybackResampled);
 
 	enum {
@@ -56,10 +57,17 @@ class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled {
 
 	Ref<AudioStreamMP3> mp3_stream;
 
+	AudioDecodeAhead decode_ahead;
+	void _seek(double p_time);
+
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
 
+	virtual int decode_ahead_frames(AudioFrame *p_buffer, int p_frames) override;
+	virtual double decode_ahead_get_position() const override;
+	virtual int decode_ahead_get_loop_count() const override;
+
 public:
 	virtual void start(double p_from_pos = 0.0) override;
 	virtual void stop() override;
@@ -72,7 +80,8 @@ public:
 
 	virtual void tag_used_streams() override;
 
-	AudioStreamPlaybackMP3() {}
+	AudioStreamPlaybackMP3() :
+			decode_ahead(this) {}
 	~AudioStreamPlaybackMP3();
 };
 
@@ -1925,7 +1925,7 @@ Error BindingsGenerator::_generate_cs_property(const BindingsGenerator::TypeInte
 	return OK;
 }
 
-Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterface &p_itype, const BindingsGenerator::MethodInterface &p_imethod, int &p_method_bind_count, StringBuilder &p_output) {
+Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterface &p_itype, const BindingsGenerator::MethodInterface &p_imethod, int &p_method_bind_count, StringBuilder &p_output, bool p_span_overload) {
 	const TypeInterface *return_type = _get_type_or_null(p_imethod.return_type);
 	ERR_FAIL_NULL_V(return_type, ERR_BUG); // Return type not found
 
@@ -1957,8 +1957,23 @@ Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterf
 
 	StringBuilder default_args_doc;
 
+	// The span overload can't keep default values up to its last span argument,
+	// as optional parameters must come after all the required ones.
+	int last_span_arg = -1;
+	if (p_span_overload) {
+		int arg_index = 0;
+		for (const ArgumentInterface &iarg : p_imethod.arguments) {
+			const TypeInterface *arg_type = _get_type_or_null(iarg.type);
+			if (arg_type && !arg_type->cs_span_type.is_empty()) {
+				last_span_arg = arg_index;
+			}
+			arg_index++;
+		}
+	}
+
 	// Retrieve information from the arguments
 	const ArgumentInterface &first = p_imethod.arguments.front()->get();
+	int arg_index = 0;
 	for (const ArgumentInterface &iarg : p_imethod.arguments) {
 		const TypeInterface *arg_type = _get_type_or_null(iarg.type);
 		ERR_FAIL_NULL_V(arg_type, ERR_BUG); // Argument type not found
@@ -1978,6 +1993,13 @@ Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterf
 		}
 
 		String arg_cs_type = arg_type->cs_type + _get_generic_type_parameters(*arg_type, iarg.type.generic_type_parameters);
+		if (p_span_overload && !arg_type->cs_span_type.is_empty()) {
+			arg_cs_type = arg_type->cs_span_type;
+		}
+
+		bool has_default = iarg.default_argument.size() && arg_index > last_span_arg;
+		bool nullable = has_default && iarg.def_param_mode == ArgumentInterface::NULLABLE_VAL;
+		arg_index++;
 
 		// Add the current arguments to the signature
 		// If the argument has a default value which is not a constant, we will make it Nullable
@@ -1986,13 +2008,13 @@ Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterf
 				arguments_sig += ", ";
 			}
 
-			if (iarg.def_param_mode == ArgumentInterface::NULLABLE_VAL) {
+			if (nullable) {
 				arguments_sig += "Nullable<";
 			}
 
 			arguments_sig += arg_cs_type;
 
-			if (iarg.def_param_mode == ArgumentInterface::NULLABLE_VAL) {
+			if (nullable) {
 				arguments_sig += "> ";
 			} else {
 				arguments_sig += " ";
@@ -2000,7 +2022,7 @@ Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterf
 
 			arguments_sig += iarg.name;
 
-			if (iarg.default_argument.size()) {
+			if (has_default) {
 				if (iarg.def_param_mode != ArgumentInterface::CONSTANT) {
 					arguments_sig += " = null";
 				} else {
@@ -2011,7 +2033,7 @@ Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterf
 
 		icall_params += ", ";
 
-		if (iarg.default_argument.size() && iarg.def_param_mode != ArgumentInterface::CONSTANT) {
+		if (has_default && iarg.def_param_mode != ArgumentInterface::CONSTANT) {
 			// The default value of an argument must be constant. Otherwise we make it Nullable and do the following:
 			// Type arg_in = arg.HasValue ? arg.Value : <non-const default value>;
 			String arg_or_defval_local = iarg.name;
@@ -2073,7 +2095,7 @@ Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterf
 
 	// Generate method
 	{
-		if (!p_imethod.is_virtual && !p_imethod.requires_object_call) {
+		if (!p_imethod.is_virtual && !p_imethod.requires_object_call && !p_span_overload) {
 			p_output << MEMBER_BEGIN "[DebuggerBrowsable(DebuggerBrowsableState.Never)]\n"
 					 << INDENT1 "private static readonly IntPtr " << method_bind_field << " = ";
 
@@ -2193,6 +2215,22 @@ Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterf
 		p_output.append(CLOSE_BLOCK_L1);
 	}
 
+	if (p_span_overload) {
+		return OK; // Shares the method bind of the array overload
+	}
+
+	// Overload taking spans for blittable Packed arrays, so they can be passed without allocating managed arrays.
+	if (!p_imethod.is_vararg) {
+		for (const ArgumentInterface &iarg : p_imethod.arguments) {
+			const TypeInterface *arg_type = _get_type_or_null(iarg.type);
+			if (arg_type && !arg_type->cs_span_type.is_empty()) {
+				Error err = _generate_cs_method(p_itype, p_imethod, p_method_bind_count, p_output, true);
+				ERR_FAIL_COND_V(err != OK, err);
+				break;
+			}
+		}
+	}
+
 	p_method_bind_count++;
 
 	return OK;
@@ -3672,37 +3710,40 @@ void BindingsGenerator::_populate_builtin_type_interfaces() {
 	itype.c_type_in = "Variant[]";
 	builtin_types.insert(itype.cname, itype);
 
-#define INSERT_ARRAY_FULL(m_name, m_type, m_managed_type, m_proxy_t)                \
-	{                                                                               \
-		itype = TypeInterface();                                                    \
-		itype.name = #m_name;                                                       \
-		itype.cname = itype.name;                                                   \
-		itype.proxy_name = #m_proxy_t "[]";                                         \
-		itype.cs_type = itype.proxy_name;                                           \
-		itype.c_in = "%5using %0 %1_in = " C_METHOD_MONOARRAY_TO(m_type) "(%1);\n"; \
-		itype.c_out = "%5return " C_METHOD_MONOARRAY_FROM(m_type) "(%1);\n";        \
-		itype.c_arg_in = "&%s_in";                                                  \
-		itype.c_type = #m_managed_type;                                             \
-		itype.c_type_in = itype.proxy_name;                                         \
-		itype.c_type_out = itype.proxy_name;                                        \
-		itype.c_type_is_disposable_struct = true;                                   \
-		builtin_types.insert(itype.name, itype);                                    \
-	}
-
-#define INSERT_ARRAY(m_type, m_managed_type, m_proxy_t) INSERT_ARRAY_FULL(m_type, m_type, m_managed_type, m_proxy_t)
-
-	INSERT_ARRAY(PackedInt32Array, godot_packed_int32_array, int);
-	INSERT_ARRAY(PackedInt64Array, godot_packed_int64_array, long);
-	INSERT_ARRAY_FULL(PackedByteArray, PackedByteArray, godot_packed_byte_array, byte);
-
-	INSERT_ARRAY(PackedFloat32Array, godot_packed_float32_array, float);
-	INSERT_ARRAY(PackedFloat64Array, godot_packed_float64_array, double);
-
-	INSERT_ARRAY(PackedStringArray, godot_packed_string_array, string);
-
-	INSERT_ARRAY(PackedColorArray, godot_packed_color_array, Color);
-	INSERT_ARRAY(PackedVector2Array, godot_packed_vector2_array, Vector2);
-	INSERT_ARRAY(PackedVector3Array, godot_packed_vector3_array, Vector3);
+#define INSERT_ARRAY_FULL(m_name, m_type, m_managed_type, m_proxy_t, m_blittable)                  \
+	{                                                                                              \
+		itype = TypeInterface();                                                                   \
+		itype.name = #m_name;                                                                      \
+		itype.cname = itype.name;                                                                  \
+		itype.proxy_name = #m_proxy_t "[]";                                                        \
+		itype.cs_type = itype.proxy_name;                                                          \
+		itype.cs_span_type = m_blittable ? String("ReadOnlySpan<" #m_proxy_t ">") : String();      \
+		itype.c_in = "%5using %0 %1_in = " C_METHOD_MONOARRAY_TO(m_type) "(%1);\n";                \
+		itype.c_out = "%5return " C_METHOD_MONOARRAY_FROM(m_type) "(%1);\n";                       \
+		itype.c_arg_in = "&%s_in";                                                                 \
+		itype.c_type = #m_managed_type;                                                            \
+		itype.c_type_in = m_blittable ? itype.cs_span_type : itype.proxy_name;                     \
+		itype.c_type_out = itype.proxy_name;                                                       \
+		itype.c_type_is_disposable_struct = true;                                                  \
+		builtin_types.insert(itype.name, itype);                                                   \
+	}
+
+#define INSERT_ARRAY(m_type, m_managed_type, m_proxy_t, m_blittable) INSERT_ARRAY_FULL(m_type, m_type, m_managed_type, m_proxy_t, m_blittable)
+
+	// Arrays of blittable elements are taken as spans by the internal calls, so both arrays and spans can be
+	// passed without an intermediate managed copy.
+	INSERT_ARRAY(PackedInt32Array, godot_packed_int32_array, int, true);
+	INSERT_ARRAY(PackedInt64Array, godot_packed_int64_array, long, true);
+	INSERT_ARRAY_FULL(PackedByteArray, PackedByteArray, godot_packed_byte_array, byte, true);
+
+	INSERT_ARRAY(PackedFloat32Array, godot_packed_float32_array, float, true);
+	INSERT_ARRAY(PackedFloat64Array, godot_packed_float64_array, double, true);
+
+	INSERT_ARRAY(PackedStringArray, godot_packed_string_array, string, false);
+
+	INSERT_ARRAY(PackedColorArray, godot_packed_color_array, Color, true);
+	INSERT_ARRAY(PackedVector2Array, godot_packed_vector2_array, Vector2, true);
+	INSERT_ARRAY(PackedVector3Array, godot_packed_vector3_array, Vector3, true);
 
 #undef INSERT_ARRAY
 
@@ -385,6 +385,12 @@ class BindingsGenerator {
 		 */
 		String cs_type;
 
+		/**
+		 * Span type accepted by an additional overload of methods with parameters of this type.
+		 * Only set for Packed arrays of blittable elements, which are copied straight from the span.
+		 */
+		String cs_span_type;
+
 		/**
 		 * Formatting elements:
 		 * %0: input expression of type `in godot_variant`
@@ -723,7 +729,7 @@ class BindingsGenerator {
 	Error _generate_cs_type(const TypeInterface &itype, const String &p_output_file);
 
 	Error _generate_cs_property(const TypeInterface &p_itype, const PropertyInterface &p_iprop, StringBuilder &p_output);
-	Error _generate_cs_method(const TypeInterface &p_itype, const MethodInterface &p_imethod, int &p_method_bind_count, StringBuilder &p_output);
+	Error _generate_cs_method(const TypeInterface &p_itype, const MethodInterface &p_imethod, int &p_method_bind_count, StringBuilder &p_output, bool p_span_overload = false);
 	Error _generate_cs_signal(const BindingsGenerator::TypeInterface &p_itype, const BindingsGenerator::SignalInterface &p_isignal, StringBuilder &p_output);
 
 	Error _generate_cs_native_calls(const InternalCall &p_icall, StringBuilder &r_output);
@@ -31,6 +31,8 @@
 #include "multiplayer_synchronizer.h"
 
 #include "core/config/engine.h"
+#include "scene/2d/node_2d.h"
+#include "scene/3d/node_3d.h"
 #include "scene/main/multiplayer_api.h"
 
 Object *MultiplayerSynchronizer::_get_prop_target(Object *p_obj, const NodePath &p_path) {
@@ -106,7 +108,10 @@ Node *MultiplayerSynchronizer::get_root_node() {
 void MultiplayerSynchronizer::reset() {
 	net_id = 0;
 	last_sync_msec = 0;
+	last_delta_msec = 0;
+	last_watch_usec = 0;
 	last_inbound_sync = 0;
+	watchers.clear();
 }
 
 uint32_t MultiplayerSynchronizer::get_net_id() const {
@@ -129,6 +134,18 @@ bool MultiplayerSynchronizer::update_outbound_sync_time(uint64_t p_msec) {
 	return false;
 }
 
+bool MultiplayerSynchronizer::update_outbound_delta_time(uint64_t p_msec) {
+	if (last_delta_msec == p_msec) {
+		// last_delta_msec has been updated on this frame.
+		return true;
+	}
+	if (p_msec >= last_delta_msec + delta_interval_msec) {
+		last_delta_msec = p_msec;
+		return true;
+	}
+	return false;
+}
+
 bool MultiplayerSynchronizer::update_inbound_sync_time(uint16_t p_network_time) {
 	if (p_network_time <= last_inbound_sync && last_inbound_sync - p_network_time < 32767) {
 		return false;
@@ -176,6 +193,89 @@ Error MultiplayerSynchronizer::set_state(const List<NodePath> &p_properties, Obj
 	return OK;
 }
 
+Error MultiplayerSynchronizer::update_watchers(uint64_t p_usec) {
+	if (last_watch_usec == p_usec) {
+		// Already checked on this frame.
+		return OK;
+	}
+	ERR_FAIL_COND_V(replication_config.is_null(), ERR_UNCONFIGURED);
+	Node *node = get_root_node();
+	ERR_FAIL_COND_V(!node, ERR_UNCONFIGURED);
+	const List<NodePath> &props = replication_config->get_watch_properties();
+	ERR_FAIL_COND_V_MSG(props.size() > 64, ERR_INVALID_DATA, "At most 64 properties can be watched by a single MultiplayerSynchronizer.");
+	if (watchers.size() != props.size()) {
+		// Configuration changed, everything must be sent again.
+		watchers.resize(props.size());
+		int i = 0;
+		for (const NodePath &prop : props) {
+			watchers.write[i].prop = prop;
+			watchers.write[i].last_change_usec = 0;
+			watchers.write[i].value = Variant();
+			i++;
+		}
+	}
+	last_watch_usec = p_usec;
+	Watcher *ptr = watchers.ptrw();
+	for (int i = 0; i < watchers.size(); i++) {
+		Watcher &w = ptr[i];
+		Object *obj = _get_prop_target(node, w.prop);
+		ERR_CONTINUE(!obj);
+		bool valid = false;
+		Variant v = obj->get(w.prop.get_concatenated_subnames(), &valid);
+		ERR_CONTINUE_MSG(!valid, vformat("Property '%s' not found.", w.prop));
+		if (w.last_change_usec != 0 && v == w.value) {
+			continue;
+		}
+		w.value = v;
+		w.last_change_usec = p_usec;
+	}
+	return OK;
+}
+
+Vector<Variant> MultiplayerSynchronizer::get_delta_state(uint64_t p_cur_usec, uint64_t p_last_usec, uint64_t &r_indexes) {
+	r_indexes = 0;
+	Vector<Variant> out;
+	const Watcher *ptr = watchers.ptr();
+	for (int i = 0; i < watchers.size(); i++) {
+		const Watcher &w = ptr[i];
+		if (w.last_change_usec == 0 || w.last_change_usec <= p_last_usec || w.last_change_usec > p_cur_usec) {
+			continue;
+		}
+		out.push_back(w.value);
+		r_indexes |= uint64_t(1) << i;
+	}
+	return out;
+}
+
+List<NodePath> MultiplayerSynchronizer::get_delta_properties(uint64_t p_indexes) {
+	List<NodePath> out;
+	ERR_FAIL_COND_V(replication_config.is_null(), out);
+	const List<NodePath> &props = replication_config->get_watch_properties();
+	int idx = 0;
+	for (const NodePath &prop : props) {
+		if (p_indexes & (uint64_t(1) << idx)) {
+			out.push_back(prop);
+		}
+		idx++;
+		if (idx == 64) {
+			break;
+		}
+	}
+	return out;
+}
+
+Vector<float> MultiplayerSynchronizer::get_delta_quantization(uint64_t p_indexes) {
+	Vector<float> out;
+	ERR_FAIL_COND_V(replication_config.is_null(), out);
+	const Vector<float> &steps = replication_config->get_watch_quantization();
+	for (int i = 0; i < MIN(steps.size(), 64); i++) {
+		if (p_indexes & (uint64_t(1) << i)) {
+			out.push_back(steps[i]);
+		}
+	}
+	return out;
+}
+
 bool MultiplayerSynchronizer::is_visibility_public() const {
 	return peer_visibility.has(0);
 }
@@ -236,6 +336,37 @@ MultiplayerSynchronizer::VisibilityUpdateMode MultiplayerSynchronizer::get_visib
 	return visibility_update_mode;
 }
 
+void MultiplayerSynchronizer::set_spatial_interest_enabled(bool p_enabled) {
+	spatial_interest = p_enabled;
+}
+
+bool MultiplayerSynchronizer::is_spatial_interest_enabled() const {
+	return spatial_interest;
+}
+
+void MultiplayerSynchronizer::set_interest_priority(float p_priority) {
+	ERR_FAIL_COND_MSG(p_priority < 0, "Priority must be greater or equal to 0.");
+	interest_priority = p_priority;
+}
+
+float MultiplayerSynchronizer::get_interest_priority() const {
+	return interest_priority;
+}
+
+bool MultiplayerSynchronizer::get_interest_position(Vector3 &r_position) {
+	Node *node = get_root_node();
+	if (Node3D *n3d = Object::cast_to<Node3D>(node)) {
+		r_position = n3d->get_global_position();
+		return true;
+	}
+	if (Node2D *n2d = Object::cast_to<Node2D>(node)) {
+		const Vector2 pos = n2d->get_global_position();
+		r_position = Vector3(pos.x, pos.y, 0);
+		return true;
+	}
+	return false;
+}
+
 void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &MultiplayerSynchronizer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &MultiplayerSynchronizer::get_root_path);
@@ -243,6 +374,9 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_replication_interval", "milliseconds"), &MultiplayerSynchronizer::set_replication_interval);
 	ClassDB::bind_method(D_METHOD("get_replication_interval"), &MultiplayerSynchronizer::get_replication_interval);
 
+	ClassDB::bind_method(D_METHOD("set_delta_interval", "seconds"), &MultiplayerSynchronizer::set_delta_interval);
+	ClassDB::bind_method(D_METHOD("get_delta_interval"), &MultiplayerSynchronizer::get_delta_interval);
+
 	ClassDB::bind_method(D_METHOD("set_replication_config", "config"), &MultiplayerSynchronizer::set_replication_config);
 	ClassDB::bind_method(D_METHOD("get_replication_config"), &MultiplayerSynchronizer::get_replication_config);
 
@@ -258,11 +392,19 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_visibility_for", "peer", "visible"), &MultiplayerSynchronizer::set_visibility_for);
 	ClassDB::bind_method(D_METHOD("get_visibility_for", "peer"), &MultiplayerSynchronizer::get_visibility_for);
 
+	ClassDB::bind_method(D_METHOD("set_spatial_interest_enabled", "enabled"), &MultiplayerSynchronizer::set_spatial_interest_enabled);
+	ClassDB::bind_method(D_METHOD("is_spatial_interest_enabled"), &MultiplayerSynchronizer::is_spatial_interest_enabled);
+	ClassDB::bind_method(D_METHOD("set_interest_priority", "priority"), &MultiplayerSynchronizer::set_interest_priority);
+	ClassDB::bind_method(D_METHOD("get_interest_priority"), &MultiplayerSynchronizer::get_interest_priority);
+
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "replication_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_replication_interval", "get_replication_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "delta_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_delta_interval", "get_delta_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "replication_config", PROPERTY_HINT_RESOURCE_TYPE, "SceneReplicationConfig", PROPERTY_USAGE_NO_EDITOR), "set_replication_config", "get_replication_config");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_update_mode", PROPERTY_HINT_ENUM, "Idle,Physics,None"), "set_visibility_update_mode", "get_visibility_update_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "public_visibility"), "set_visibility_public", "is_visibility_public");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "spatial_interest"), "set_spatial_interest_enabled", "is_spatial_interest_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "interest_priority", PROPERTY_HINT_RANGE, "0,16,0.01,or_greater"), "set_interest_priority", "get_interest_priority");
 
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_IDLE);
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_PHYSICS);
@@ -306,8 +448,18 @@ double MultiplayerSynchronizer::get_replication_interval() const {
 	return double(interval_msec) / 1000.0;
 }
 
+void MultiplayerSynchronizer::set_delta_interval(double p_interval) {
+	ERR_FAIL_COND_MSG(p_interval < 0, "Interval must be greater or equal to 0 (where 0 means default)");
+	delta_interval_msec = uint64_t(p_interval * 1000);
+}
+
+double MultiplayerSynchronizer::get_delta_interval() const {
+	return double(delta_interval_msec) / 1000.0;
+}
+
 void MultiplayerSynchronizer::set_replication_config(Ref<SceneReplicationConfig> p_config) {
 	replication_config = p_config;
+	watchers.clear();
 }
 
 Ref<SceneReplicationConfig> MultiplayerSynchronizer::get_replication_config() {
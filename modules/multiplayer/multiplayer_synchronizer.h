@@ -46,17 +46,29 @@ public:
 	};
 
 private:
+	struct Watcher {
+		NodePath prop;
+		uint64_t last_change_usec = 0;
+		Variant value;
+	};
+
 	Ref<SceneReplicationConfig> replication_config;
 	NodePath root_path = NodePath(".."); // Start with parent, like with AnimationPlayer.
 	uint64_t interval_msec = 0;
+	uint64_t delta_interval_msec = 0;
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
+	bool spatial_interest = false;
+	float interest_priority = 1.0;
 
 	ObjectID root_node_cache;
 	uint64_t last_sync_msec = 0;
+	uint64_t last_delta_msec = 0;
+	uint64_t last_watch_usec = 0;
 	uint16_t last_inbound_sync = 0;
 	uint32_t net_id = 0;
+	Vector<Watcher> watchers;
 
 	static Object *_get_prop_target(Object *p_obj, const NodePath &p_prop);
 	void _start();
@@ -78,13 +90,22 @@ public:
 	void set_net_id(uint32_t p_net_id);
 
 	bool update_outbound_sync_time(uint64_t p_msec);
+	bool update_outbound_delta_time(uint64_t p_msec);
 	bool update_inbound_sync_time(uint16_t p_network_time);
 
+	Error update_watchers(uint64_t p_usec);
+	Vector<Variant> get_delta_state(uint64_t p_cur_usec, uint64_t p_last_usec, uint64_t &r_indexes);
+	List<NodePath> get_delta_properties(uint64_t p_indexes);
+	Vector<float> get_delta_quantization(uint64_t p_indexes);
+
 	PackedStringArray get_configuration_warnings() const override;
 
 	void set_replication_interval(double p_interval);
 	double get_replication_interval() const;
 
+	void set_delta_interval(double p_interval);
+	double get_delta_interval() const;
+
 	void set_replication_config(Ref<SceneReplicationConfig> p_config);
 	Ref<SceneReplicationConfig> get_replication_config();
 
@@ -103,6 +124,12 @@ public:
 	void remove_visibility_filter(Callable p_callback);
 	VisibilityUpdateMode get_visibility_update_mode() const;
 
+	void set_spatial_interest_enabled(bool p_enabled);
+	bool is_spatial_interest_enabled() const;
+	void set_interest_priority(float p_priority);
+	float get_interest_priority() const;
+	bool get_interest_position(Vector3 &r_position);
+
 	MultiplayerSynchronizer();
 };
 
@@ -47,24 +47,26 @@ bool SceneReplicationConfig::_set(const StringName &p_name, const Variant &p_val
 			add_property(path);
 			return true;
 		}
-		ERR_FAIL_COND_V(p_value.get_type() != Variant::BOOL, false);
 		ERR_FAIL_INDEX_V(idx, properties.size(), false);
 		ReplicationProperty &prop = properties[idx];
+		if (what == "quantization") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::FLOAT && p_value.get_type() != Variant::INT, false);
+			prop.quantization = MAX(0.0, float(p_value));
+			_update();
+			return true;
+		}
+		ERR_FAIL_COND_V(p_value.get_type() != Variant::BOOL, false);
 		if (what == "sync") {
 			prop.sync = p_value;
-			if (prop.sync) {
-				sync_props.push_back(prop.name);
-			} else {
-				sync_props.erase(prop.name);
-			}
+			_update();
 			return true;
 		} else if (what == "spawn") {
 			prop.spawn = p_value;
-			if (prop.spawn) {
-				spawn_props.push_back(prop.name);
-			} else {
-				spawn_props.erase(prop.name);
-			}
+			_update();
+			return true;
+		} else if (what == "watch") {
+			prop.watch = p_value;
+			_update();
 			return true;
 		}
 	}
@@ -88,6 +90,12 @@ bool SceneReplicationConfig::_get(const StringName &p_name, Variant &r_ret) cons
 		} else if (what == "spawn") {
 			r_ret = prop.spawn;
 			return true;
+		} else if (what == "watch") {
+			r_ret = prop.watch;
+			return true;
+		} else if (what == "quantization") {
+			r_ret = prop.quantization;
+			return true;
 		}
 	}
 	return false;
@@ -98,6 +106,29 @@ void SceneReplicationConfig::_get_property_list(List<PropertyInfo> *p_list) cons
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/path", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/spawn", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/sync", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/watch", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/quantization", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+	}
+}
+
+void SceneReplicationConfig::_update() {
+	spawn_props.clear();
+	sync_props.clear();
+	watch_props.clear();
+	sync_quantization.clear();
+	watch_quantization.clear();
+	for (const ReplicationProperty &prop : properties) {
+		if (prop.spawn) {
+			spawn_props.push_back(prop.name);
+		}
+		if (prop.sync && prop.watch) {
+			// Watched properties are only sent (reliably) when they change.
+			watch_props.push_back(prop.name);
+			watch_quantization.push_back(prop.quantization);
+		} else if (prop.sync) {
+			sync_props.push_back(prop.name);
+			sync_quantization.push_back(prop.quantization);
+		}
 	}
 }
 
@@ -114,6 +145,7 @@ void SceneReplicationConfig::add_property(const NodePath &p_path, int p_index) {
 
 	if (p_index < 0 || p_index == properties.size()) {
 		properties.push_back(ReplicationProperty(p_path));
+		_update();
 		return;
 	}
 
@@ -126,10 +158,12 @@ void SceneReplicationConfig::add_property(const NodePath &p_path, int p_index) {
 		c++;
 	}
 	properties.insert_before(I, ReplicationProperty(p_path));
+	_update();
 }
 
 void SceneReplicationConfig::remove_property(const NodePath &p_path) {
 	properties.erase(p_path);
+	_update();
 }
 
 bool SceneReplicationConfig::has_property(const NodePath &p_path) const {
@@ -163,12 +197,7 @@ void SceneReplicationConfig::property_set_spawn(const NodePath &p_path, bool p_e
 		return;
 	}
 	E->get().spawn = p_enabled;
-	spawn_props.clear();
-	for (const ReplicationProperty &prop : properties) {
-		if (prop.spawn) {
-			spawn_props.push_back(p_path);
-		}
-	}
+	_update();
 }
 
 bool SceneReplicationConfig::property_get_sync(const NodePath &p_path) {
@@ -184,12 +213,40 @@ void SceneReplicationConfig::property_set_sync(const NodePath &p_path, bool p_en
 		return;
 	}
 	E->get().sync = p_enabled;
-	sync_props.clear();
-	for (const ReplicationProperty &prop : properties) {
-		if (prop.sync) {
-			sync_props.push_back(p_path);
-		}
+	_update();
+}
+
+bool SceneReplicationConfig::property_get_watch(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, false);
+	return E->get().watch;
+}
+
+void SceneReplicationConfig::property_set_watch(const NodePath &p_path, bool p_enabled) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND(!E);
+	if (E->get().watch == p_enabled) {
+		return;
+	}
+	E->get().watch = p_enabled;
+	_update();
+}
+
+float SceneReplicationConfig::property_get_quantization(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, 0.0);
+	return E->get().quantization;
+}
+
+void SceneReplicationConfig::property_set_quantization(const NodePath &p_path, float p_step) {
+	ERR_FAIL_COND(p_step < 0.0);
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND(!E);
+	if (E->get().quantization == p_step) {
+		return;
 	}
+	E->get().quantization = p_step;
+	_update();
 }
 
 void SceneReplicationConfig::_bind_methods() {
@@ -202,4 +259,8 @@ void SceneReplicationConfig::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("property_set_spawn", "path", "enabled"), &SceneReplicationConfig::property_set_spawn);
 	ClassDB::bind_method(D_METHOD("property_get_sync", "path"), &SceneReplicationConfig::property_get_sync);
 	ClassDB::bind_method(D_METHOD("property_set_sync", "path", "enabled"), &SceneReplicationConfig::property_set_sync);
+	ClassDB::bind_method(D_METHOD("property_get_watch", "path"), &SceneReplicationConfig::property_get_watch);
+	ClassDB::bind_method(D_METHOD("property_set_watch", "path", "enabled"), &SceneReplicationConfig::property_set_watch);
+	ClassDB::bind_method(D_METHOD("property_get_quantization", "path"), &SceneReplicationConfig::property_get_quantization);
+	ClassDB::bind_method(D_METHOD("property_set_quantization", "path", "step"), &SceneReplicationConfig::property_set_quantization);
 }
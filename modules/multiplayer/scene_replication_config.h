@@ -45,6 +45,8 @@ private:
 		NodePath name;
 		bool spawn = true;
 		bool sync = true;
+		bool watch = false;
+		float quantization = 0.0;
 
 		bool operator==(const ReplicationProperty &p_to) {
 			return name == p_to.name;
@@ -60,6 +62,11 @@ private:
 	List<ReplicationProperty> properties;
 	List<NodePath> spawn_props;
 	List<NodePath> sync_props;
+	List<NodePath> watch_props;
+	Vector<float> sync_quantization;
+	Vector<float> watch_quantization;
+
+	void _update();
 
 protected:
 	static void _bind_methods();
@@ -82,8 +89,17 @@ public:
 	bool property_get_sync(const NodePath &p_path);
 	void property_set_sync(const NodePath &p_path, bool p_enabled);
 
+	bool property_get_watch(const NodePath &p_path);
+	void property_set_watch(const NodePath &p_path, bool p_enabled);
+
+	float property_get_quantization(const NodePath &p_path);
+	void property_set_quantization(const NodePath &p_path, float p_step);
+
 	const List<NodePath> &get_spawn_properties() { return spawn_props; }
 	const List<NodePath> &get_sync_properties() { return sync_props; }
+	const List<NodePath> &get_watch_properties() { return watch_props; }
+	const Vector<float> &get_sync_quantization() { return sync_quantization; }
+	const Vector<float> &get_watch_quantization() { return watch_quantization; }
 
 	SceneReplicationConfig() {}
 };
@@ -41,6 +41,97 @@
 	if (packet_cache.size() < m_amount) \
 		packet_cache.resize(m_amount);
 
+// Set in the variant meta byte of quantized values. The compressed encoding
+// only uses the high bits for BOOL and INT, which are never quantized.
+#define QUANTIZED_META_FLAG 0x80
+
+static int _encode_varint(int64_t p_value, uint8_t *r_buffer) {
+	uint64_t v = (uint64_t(p_value) << 1) ^ uint64_t(p_value >> 63); // ZigZag.
+	int len = 0;
+	do {
+		uint8_t b = v & 0x7F;
+		v >>= 7;
+		if (v) {
+			b |= 0x80;
+		}
+		if (r_buffer) {
+			r_buffer[len] = b;
+		}
+		len++;
+	} while (v);
+	return len;
+}
+
+static Error _decode_varint(const uint8_t *p_buffer, int p_len, int64_t &r_value, int &r_len) {
+	uint64_t v = 0;
+	int shift = 0;
+	r_len = 0;
+	while (true) {
+		ERR_FAIL_COND_V(r_len >= p_len || shift > 63, ERR_INVALID_DATA);
+		uint8_t b = p_buffer[r_len++];
+		v |= uint64_t(b & 0x7F) << shift;
+		if (!(b & 0x80)) {
+			break;
+		}
+		shift += 7;
+	}
+	r_value = int64_t(v >> 1) ^ -int64_t(v & 1);
+	return OK;
+}
+
+static _FORCE_INLINE_ bool _is_quantizable(int p_type) {
+	return p_type == Variant::FLOAT || p_type == Variant::VECTOR2 || p_type == Variant::VECTOR3 || p_type == Variant::QUATERNION;
+}
+
+static _FORCE_INLINE_ int64_t _quantize(real_t p_value, float p_step) {
+	double q = Math::round(double(p_value) / p_step);
+	return int64_t(CLAMP(q, -4611686018427387904.0, 4611686018427387904.0));
+}
+
+static uint32_t _pack_quaternion(const Quaternion &p_quat) {
+	// Smallest three: drop the largest component (recovered from the unit
+	// length) and store the others with 10 bits each.
+	Quaternion q = p_quat.length_squared() > 0 ? p_quat.normalized() : Quaternion();
+	int largest = 0;
+	for (int i = 1; i < 4; i++) {
+		if (Math::abs(q[i]) > Math::abs(q[largest])) {
+			largest = i;
+		}
+	}
+	if (q[largest] < 0) {
+		q = -q;
+	}
+	uint32_t packed = largest;
+	int shift = 2;
+	for (int i = 0; i < 4; i++) {
+		if (i == largest) {
+			continue;
+		}
+		double c = CLAMP(double(q[i]), -Math_SQRT12, Math_SQRT12) * Math_SQRT12 + 0.5;
+		packed |= uint32_t(Math::round(c * 1023.0)) << shift;
+		shift += 10;
+	}
+	return packed;
+}
+
+static Quaternion _unpack_quaternion(uint32_t p_packed) {
+	Quaternion q;
+	int largest = p_packed & 3;
+	int shift = 2;
+	double sum = 0;
+	for (int i = 0; i < 4; i++) {
+		if (i == largest) {
+			continue;
+		}
+		double c = (double((p_packed >> shift) & 1023) / 1023.0 - 0.5) * Math_SQRT2;
+		q[i] = c;
+		sum += c * c;
+		shift += 10;
+	}
+	q[largest] = Math::sqrt(MAX(0.0, 1.0 - sum));
+	return q;
+}
+
 #ifdef DEBUG_ENABLED
 _FORCE_INLINE_ void SceneReplicationInterface::_profile_node_data(const String &p_what, ObjectID p_id, int p_size) {
 	if (EngineDebugger::is_profiling("multiplayer:replication")) {
@@ -125,17 +216,169 @@ void SceneReplicationInterface::on_reset() {
 }
 
 void SceneReplicationInterface::on_network_process() {
-	uint64_t msec = OS::get_singleton()->get_ticks_msec();
+	uint64_t usec = OS::get_singleton()->get_ticks_usec();
+	uint64_t msec = usec / 1000;
+	_update_interest_grid();
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
-		const HashSet<ObjectID> to_sync = E.value.sync_nodes;
+		HashSet<ObjectID> to_sync = E.value.sync_nodes;
 		if (to_sync.is_empty()) {
 			continue; // Nothing to sync
 		}
+		HashMap<ObjectID, real_t> weights;
+		_filter_interest(E.value, to_sync, weights);
+		if (to_sync.is_empty()) {
+			continue; // Nothing relevant.
+		}
+		// Deltas are reliable and cumulative, so they are not subject to the budget.
+		_send_delta(E.key, to_sync, usec, E.value.last_watch_usecs);
+		if (replication_budget > 0) {
+			_apply_budget(E.value, to_sync, weights);
+		}
 		uint16_t sync_net_time = ++E.value.last_sent_sync;
 		_send_sync(E.key, to_sync, sync_net_time, msec);
 	}
 }
 
+void SceneReplicationInterface::_update_interest_grid() {
+	interest_grid.clear();
+	interest_nodes.clear();
+	bool needed = false;
+	for (const KeyValue<int, PeerInfo> &E : peers_info) {
+		if (E.value.interest_radius >= 0) {
+			needed = true;
+			break;
+		}
+	}
+	if (!needed) {
+		return;
+	}
+	for (const ObjectID &sid : sync_nodes) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		if (!sync || !sync->is_spatial_interest_enabled() || !sync->is_multiplayer_authority()) {
+			continue;
+		}
+		InterestEntry entry;
+		if (!sync->get_interest_position(entry.position)) {
+			continue; // Not a spatial node, always relevant.
+		}
+		entry.id = sid;
+		interest_grid[_get_interest_cell(entry.position)].push_back(entry);
+		interest_nodes.insert(sid);
+	}
+}
+
+void SceneReplicationInterface::_gather_interest(const LocalVector<InterestEntry> &p_entries, const Vector3 &p_origin, real_t p_radius, const HashSet<ObjectID> &p_synchronizers, HashMap<ObjectID, real_t> &r_weights) {
+	const real_t radius_sq = p_radius * p_radius;
+	for (uint32_t i = 0; i < p_entries.size(); i++) {
+		const InterestEntry &entry = p_entries[i];
+		const real_t dist_sq = p_origin.distance_squared_to(entry.position);
+		if (dist_sq > radius_sq || !p_synchronizers.has(entry.id)) {
+			continue;
+		}
+		// Weights go from 1 (at the origin) to 0.5 (at the radius), so far away nodes still accumulate priority.
+		r_weights[entry.id] = p_radius > 0 ? 1.0 - 0.5 * Math::sqrt(dist_sq) / p_radius : 1.0;
+	}
+}
+
+void SceneReplicationInterface::_filter_interest(const PeerInfo &p_info, HashSet<ObjectID> &r_synchronizers, HashMap<ObjectID, real_t> &r_weights) {
+	if (p_info.interest_radius < 0 || interest_nodes.is_empty()) {
+		return;
+	}
+	const Vector3 origin = p_info.interest_origin;
+	const real_t radius = p_info.interest_radius;
+	const Vector3 extents(radius, radius, radius);
+	const Vector3i from = _get_interest_cell(origin - extents);
+	const Vector3i to = _get_interest_cell(origin + extents);
+	const double span = double(to.x - from.x + 1) * double(to.y - from.y + 1) * double(to.z - from.z + 1);
+	if (span > interest_grid.size()) {
+		// The area covers more cells than there are occupied ones.
+		for (const KeyValue<Vector3i, LocalVector<InterestEntry>> &E : interest_grid) {
+			_gather_interest(E.value, origin, radius, r_synchronizers, r_weights);
+		}
+	} else {
+		for (int x = from.x; x <= to.x; x++) {
+			for (int y = from.y; y <= to.y; y++) {
+				for (int z = from.z; z <= to.z; z++) {
+					const LocalVector<InterestEntry> *entries = interest_grid.getptr(Vector3i(x, y, z));
+					if (entries) {
+						_gather_interest(*entries, origin, radius, r_synchronizers, r_weights);
+					}
+				}
+			}
+		}
+	}
+	for (const ObjectID &sid : interest_nodes) {
+		if (!r_weights.has(sid)) {
+			r_synchronizers.erase(sid);
+		}
+	}
+}
+
+void SceneReplicationInterface::_apply_budget(PeerInfo &r_info, HashSet<ObjectID> &r_synchronizers, const HashMap<ObjectID, real_t> &p_weights) {
+	if (r_synchronizers.size() <= uint32_t(replication_budget)) {
+		r_info.priorities.clear(); // Everything is sent.
+		return;
+	}
+	struct Candidate {
+		ObjectID id;
+		float priority = 0;
+		bool operator<(const Candidate &p_other) const { return priority > p_other.priority; }
+	};
+	LocalVector<Candidate> candidates;
+	candidates.reserve(r_synchronizers.size());
+	for (const ObjectID &sid : r_synchronizers) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		ERR_CONTINUE(!sync);
+		const real_t *weight = p_weights.getptr(sid);
+		const float *prev = r_info.priorities.getptr(sid);
+		Candidate c;
+		c.id = sid;
+		c.priority = (prev ? *prev : 0) + sync->get_interest_priority() * (weight ? *weight : 1.0);
+		candidates.push_back(c);
+	}
+	candidates.sort();
+	// Selected synchronizers restart from zero, the others keep accumulating.
+	r_synchronizers.clear();
+	r_info.priorities.clear();
+	for (uint32_t i = 0; i < candidates.size(); i++) {
+		if (i < uint32_t(replication_budget)) {
+			r_synchronizers.insert(candidates[i].id);
+		} else {
+			r_info.priorities[candidates[i].id] = candidates[i].priority;
+		}
+	}
+}
+
+void SceneReplicationInterface::set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius) {
+	ERR_FAIL_COND(p_radius < 0);
+	ERR_FAIL_COND(!peers_info.has(p_peer));
+	peers_info[p_peer].interest_origin = p_origin;
+	peers_info[p_peer].interest_radius = p_radius;
+}
+
+void SceneReplicationInterface::clear_peer_interest(int p_peer) {
+	ERR_FAIL_COND(!peers_info.has(p_peer));
+	peers_info[p_peer].interest_radius = -1;
+}
+
+void SceneReplicationInterface::set_interest_cell_size(real_t p_size) {
+	ERR_FAIL_COND(p_size <= 0);
+	interest_cell_size = p_size;
+}
+
+real_t SceneReplicationInterface::get_interest_cell_size() const {
+	return interest_cell_size;
+}
+
+void SceneReplicationInterface::set_replication_budget(int p_budget) {
+	ERR_FAIL_COND(p_budget < 0);
+	replication_budget = p_budget;
+}
+
+int SceneReplicationInterface::get_replication_budget() const {
+	return replication_budget;
+}
+
 Error SceneReplicationInterface::on_spawn(Object *p_obj, Variant p_config) {
 	Node *node = Object::cast_to<Node>(p_obj);
 	ERR_FAIL_COND_V(!node || p_config.get_type() != Variant::OBJECT, ERR_INVALID_PARAMETER);
@@ -244,6 +487,7 @@ Error SceneReplicationInterface::on_replication_stop(Object *p_obj, Variant p_co
 	sync_nodes.erase(sid);
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		E.value.sync_nodes.erase(sid);
+		E.value.last_watch_usecs.erase(sid);
 		if (sync->get_net_id()) {
 			E.value.recv_sync_ids.erase(sync->get_net_id());
 		}
@@ -321,6 +565,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 				E.value.sync_nodes.insert(sid);
 			} else {
 				E.value.sync_nodes.erase(sid);
+				E.value.last_watch_usecs.erase(sid);
 			}
 		}
 		return OK;
@@ -333,6 +578,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 			peers_info[p_peer].sync_nodes.insert(sid);
 		} else {
 			peers_info[p_peer].sync_nodes.erase(sid);
+			peers_info[p_peer].last_watch_usecs.erase(sid);
 		}
 		return OK;
 	}
@@ -634,6 +880,251 @@ Error SceneReplicationInterface::on_despawn_receive(int p_from, const uint8_t *p
 	return OK;
 }
 
+Error SceneReplicationInterface::_encode_state(const Vector<const Variant *> &p_vars, const Vector<float> &p_steps, uint8_t *r_buffer, int &r_len) {
+	bool quantized = false;
+	for (int i = 0; i < p_steps.size(); i++) {
+		if (p_steps[i] > 0) {
+			quantized = true;
+			break;
+		}
+	}
+	if (!quantized) {
+		return MultiplayerAPI::encode_and_compress_variants((const Variant **)p_vars.ptr(), p_vars.size(), r_buffer, r_len);
+	}
+	ERR_FAIL_COND_V(p_steps.size() != p_vars.size(), ERR_BUG);
+	r_len = 0;
+	for (int i = 0; i < p_vars.size(); i++) {
+		const Variant &v = *p_vars[i];
+		const float step = p_steps[i];
+		uint8_t *buf = r_buffer ? r_buffer + r_len : nullptr;
+		Variant::Type type = v.get_type();
+		if (step <= 0 || !_is_quantizable(type)) {
+			int len = 0;
+			Error err = MultiplayerAPI::encode_and_compress_variant(v, buf, len, false);
+			ERR_FAIL_COND_V(err != OK, err);
+			r_len += len;
+			continue;
+		}
+		if (buf) {
+			buf[0] = type | QUANTIZED_META_FLAG;
+			buf++;
+		}
+		int len = 1;
+		switch (type) {
+			case Variant::FLOAT: {
+				len += _encode_varint(_quantize(v.operator real_t(), step), buf);
+			} break;
+			case Variant::VECTOR2: {
+				const Vector2 vec = v;
+				for (int j = 0; j < 2; j++) {
+					len += _encode_varint(_quantize(vec[j], step), buf ? buf + len - 1 : nullptr);
+				}
+			} break;
+			case Variant::VECTOR3: {
+				const Vector3 vec = v;
+				for (int j = 0; j < 3; j++) {
+					len += _encode_varint(_quantize(vec[j], step), buf ? buf + len - 1 : nullptr);
+				}
+			} break;
+			case Variant::QUATERNION: {
+				if (buf) {
+					encode_uint32(_pack_quaternion(v), buf);
+				}
+				len += 4;
+			} break;
+			default:
+				ERR_FAIL_V(ERR_BUG);
+		}
+		r_len += len;
+	}
+	return OK;
+}
+
+Error SceneReplicationInterface::_decode_state(Vector<Variant> &r_vars, const Vector<float> &p_steps, const uint8_t *p_buffer, int p_len, int &r_len) {
+	bool quantized = false;
+	for (int i = 0; i < p_steps.size(); i++) {
+		if (p_steps[i] > 0) {
+			quantized = true;
+			break;
+		}
+	}
+	if (!quantized) {
+		return MultiplayerAPI::decode_and_decompress_variants(r_vars, p_buffer, p_len, r_len);
+	}
+	ERR_FAIL_COND_V(p_steps.size() != r_vars.size(), ERR_INVALID_DATA);
+	r_len = 0;
+	for (int i = 0; i < r_vars.size(); i++) {
+		ERR_FAIL_COND_V_MSG(r_len >= p_len, ERR_INVALID_DATA, "Invalid packet received. Size too small.");
+		const uint8_t *buf = p_buffer + r_len;
+		const int left = p_len - r_len;
+		const float step = p_steps[i];
+		if (step <= 0 || !(buf[0] & QUANTIZED_META_FLAG) || !_is_quantizable(buf[0] & ~QUANTIZED_META_FLAG)) {
+			int len = 0;
+			Error err = MultiplayerAPI::decode_and_decompress_variant(r_vars.write[i], buf, left, &len, false);
+			ERR_FAIL_COND_V_MSG(err != OK, err, "Invalid packet received. Unable to decode state variable.");
+			r_len += len;
+			continue;
+		}
+		const Variant::Type type = Variant::Type(buf[0] & ~QUANTIZED_META_FLAG);
+		int len = 1;
+		int64_t q = 0;
+		int vlen = 0;
+		switch (type) {
+			case Variant::FLOAT: {
+				Error err = _decode_varint(buf + len, left - len, q, vlen);
+				ERR_FAIL_COND_V(err != OK, err);
+				len += vlen;
+				r_vars.write[i] = double(q) * step;
+			} break;
+			case Variant::VECTOR2: {
+				Vector2 vec;
+				for (int j = 0; j < 2; j++) {
+					Error err = _decode_varint(buf + len, left - len, q, vlen);
+					ERR_FAIL_COND_V(err != OK, err);
+					len += vlen;
+					vec[j] = double(q) * step;
+				}
+				r_vars.write[i] = vec;
+			} break;
+			case Variant::VECTOR3: {
+				Vector3 vec;
+				for (int j = 0; j < 3; j++) {
+					Error err = _decode_varint(buf + len, left - len, q, vlen);
+					ERR_FAIL_COND_V(err != OK, err);
+					len += vlen;
+					vec[j] = double(q) * step;
+				}
+				r_vars.write[i] = vec;
+			} break;
+			case Variant::QUATERNION: {
+				ERR_FAIL_COND_V(left - len < 4, ERR_INVALID_DATA);
+				r_vars.write[i] = _unpack_quaternion(decode_uint32(buf + len));
+				len += 4;
+			} break;
+			default:
+				ERR_FAIL_V(ERR_BUG);
+		}
+		r_len += len;
+	}
+	return OK;
+}
+
+bool SceneReplicationInterface::_verify_synchronizer(int p_peer, MultiplayerSynchronizer *p_sync, uint32_t &r_net_id) {
+	r_net_id = p_sync->get_net_id();
+	if (r_net_id == 0 || (r_net_id & 0x80000000)) {
+		int path_id = 0;
+		bool verified = multiplayer->get_path_cache()->send_object_cache(p_sync, p_peer, path_id);
+		ERR_FAIL_COND_V_MSG(path_id < 0, false, "This should never happen!");
+		if (r_net_id == 0) {
+			// First time path based ID.
+			r_net_id = path_id | 0x80000000;
+			p_sync->set_net_id(r_net_id | 0x80000000);
+		}
+		return verified;
+	}
+	return true;
+}
+
+MultiplayerSynchronizer *SceneReplicationInterface::_find_synchronizer(int p_peer, uint32_t p_net_id) {
+	MultiplayerSynchronizer *sync = nullptr;
+	if (p_net_id & 0x80000000) {
+		sync = Object::cast_to<MultiplayerSynchronizer>(multiplayer->get_path_cache()->get_cached_object(p_peer, p_net_id & 0x7FFFFFFF));
+	} else if (peers_info[p_peer].recv_sync_ids.has(p_net_id)) {
+		const ObjectID &sid = peers_info[p_peer].recv_sync_ids[p_net_id];
+		sync = get_id_as<MultiplayerSynchronizer>(sid);
+	}
+	return sync;
+}
+
+void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID> p_synchronizers, uint64_t p_usec, HashMap<ObjectID, uint64_t> &r_last_watch_usecs) {
+	MAKE_ROOM(/* header */ 1 + /* element */ 4 + 8 + 4 + delta_mtu);
+	uint8_t *ptr = packet_cache.ptrw();
+	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC | (1 << SceneMultiplayer::CMD_FLAG_0_SHIFT);
+	int ofs = 1;
+	const uint64_t msec = p_usec / 1000;
+	for (const ObjectID &oid : p_synchronizers) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(oid);
+		ERR_CONTINUE(!sync || !sync->get_replication_config().is_valid() || !sync->is_multiplayer_authority());
+		if (sync->get_replication_config()->get_watch_properties().is_empty() || !sync->update_outbound_delta_time(msec)) {
+			continue; // Nothing to watch, or not yet.
+		}
+		uint32_t net_id;
+		if (!_verify_synchronizer(p_peer, sync, net_id)) {
+			continue; // The path based sync is not yet confirmed, skipping.
+		}
+		Error err = sync->update_watchers(p_usec);
+		ERR_CONTINUE_MSG(err != OK, "Unable to update watched properties.");
+		// Only send what changed since the last (reliable) delta sent to this peer.
+		const uint64_t *last_usec = r_last_watch_usecs.getptr(oid);
+		uint64_t indexes = 0;
+		const Vector<Variant> delta = sync->get_delta_state(p_usec, last_usec ? *last_usec : 0, indexes);
+		if (delta.is_empty()) {
+			continue; // Nothing changed.
+		}
+		Vector<const Variant *> varp;
+		varp.resize(delta.size());
+		for (int i = 0; i < delta.size(); i++) {
+			varp.write[i] = &delta[i];
+		}
+		const Vector<float> steps = sync->get_delta_quantization(indexes);
+		int size;
+		err = _encode_state(varp, steps, nullptr, size);
+		ERR_CONTINUE_MSG(err != OK, "Unable to encode delta state.");
+		ERR_CONTINUE_MSG(size > delta_mtu, vformat("Node deltas bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
+		if (ofs + 4 + 8 + 4 + size > delta_mtu) {
+			// Send what we got, and reset write.
+			_send_raw(packet_cache.ptr(), ofs, p_peer, true);
+			ofs = 1;
+		}
+		ofs += encode_uint32(net_id, &ptr[ofs]);
+		ofs += encode_uint64(indexes, &ptr[ofs]);
+		ofs += encode_uint32(size, &ptr[ofs]);
+		_encode_state(varp, steps, &ptr[ofs], size);
+		ofs += size;
+		r_last_watch_usecs[oid] = p_usec;
+#ifdef DEBUG_ENABLED
+		_profile_node_data("delta_out", oid, size);
+#endif
+	}
+	if (ofs > 1) {
+		// Got some left over to send.
+		_send_raw(packet_cache.ptr(), ofs, p_peer, true);
+	}
+}
+
+Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
+	int ofs = 1;
+	while (ofs + 4 + 8 + 4 <= p_buffer_len) {
+		uint32_t net_id = decode_uint32(&p_buffer[ofs]);
+		ofs += 4;
+		uint64_t indexes = decode_uint64(&p_buffer[ofs]);
+		ofs += 8;
+		uint32_t size = decode_uint32(&p_buffer[ofs]);
+		ofs += 4;
+		ERR_FAIL_COND_V(size > uint32_t(p_buffer_len - ofs), ERR_INVALID_DATA);
+		MultiplayerSynchronizer *sync = _find_synchronizer(p_from, net_id);
+		Node *node = sync ? sync->get_root_node() : nullptr;
+		if (!sync || !node || sync->get_multiplayer_authority() != p_from || sync->get_replication_config().is_null()) {
+			ofs += size;
+			ERR_CONTINUE_MSG(true, "Ignoring delta for non-authority or invalid synchronizer.");
+		}
+		const List<NodePath> props = sync->get_delta_properties(indexes);
+		ERR_FAIL_COND_V(props.is_empty(), ERR_INVALID_DATA);
+		Vector<Variant> vars;
+		vars.resize(props.size());
+		int consumed = 0;
+		Error err = _decode_state(vars, sync->get_delta_quantization(indexes), &p_buffer[ofs], size, consumed);
+		ERR_FAIL_COND_V(err != OK, err);
+		err = MultiplayerSynchronizer::set_state(props, node, vars);
+		ERR_FAIL_COND_V(err != OK, err);
+		ofs += size;
+#ifdef DEBUG_ENABLED
+		_profile_node_data("delta_in", sync->get_instance_id(), size);
+#endif
+	}
+	return OK;
+}
+
 void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> p_synchronizers, uint16_t p_sync_net_time, uint64_t p_msec) {
 	MAKE_ROOM(sync_mtu);
 	uint8_t *ptr = packet_cache.ptrw();
@@ -651,28 +1142,19 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> p
 
 		Node *node = sync->get_root_node();
 		ERR_CONTINUE(!node);
-		uint32_t net_id = sync->get_net_id();
-		if (net_id == 0 || (net_id & 0x80000000)) {
-			int path_id = 0;
-			bool verified = multiplayer->get_path_cache()->send_object_cache(sync, p_peer, path_id);
-			ERR_CONTINUE_MSG(path_id < 0, "This should never happen!");
-			if (net_id == 0) {
-				// First time path based ID.
-				net_id = path_id | 0x80000000;
-				sync->set_net_id(net_id | 0x80000000);
-			}
-			if (!verified) {
-				// The path based sync is not yet confirmed, skipping.
-				continue;
-			}
+		uint32_t net_id;
+		if (!_verify_synchronizer(p_peer, sync, net_id)) {
+			// The path based sync is not yet confirmed, skipping.
+			continue;
 		}
 		int size;
 		Vector<Variant> vars;
 		Vector<const Variant *> varp;
 		const List<NodePath> props = sync->get_replication_config()->get_sync_properties();
+		const Vector<float> &steps = sync->get_replication_config()->get_sync_quantization();
 		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
 		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
+		err = _encode_state(varp, steps, nullptr, size);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
 		// TODO Handle single state above MTU.
 		ERR_CONTINUE_MSG(size > 3 + 4 + 4 + sync_mtu, vformat("Node states bigger then MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
@@ -684,7 +1166,7 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> p
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
+			_encode_state(varp, steps, &ptr[ofs], size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -698,6 +1180,10 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> p
 }
 
 Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
+	ERR_FAIL_COND_V_MSG(p_buffer_len < 1, ERR_INVALID_DATA, "Invalid sync packet received");
+	if (p_buffer[0] & (1 << SceneMultiplayer::CMD_FLAG_0_SHIFT)) {
+		return on_delta_receive(p_from, p_buffer, p_buffer_len);
+	}
 	ERR_FAIL_COND_V_MSG(p_buffer_len < 11, ERR_INVALID_DATA, "Invalid sync packet received");
 	uint16_t time = decode_uint16(&p_buffer[1]);
 	int ofs = 3;
@@ -706,13 +1192,7 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 		ofs += 4;
 		uint32_t size = decode_uint32(&p_buffer[ofs]);
 		ofs += 4;
-		MultiplayerSynchronizer *sync = nullptr;
-		if (net_id & 0x80000000) {
-			sync = Object::cast_to<MultiplayerSynchronizer>(multiplayer->get_path_cache()->get_cached_object(p_from, net_id & 0x7FFFFFFF));
-		} else if (peers_info[p_from].recv_sync_ids.has(net_id)) {
-			const ObjectID &sid = peers_info[p_from].recv_sync_ids[net_id];
-			sync = get_id_as<MultiplayerSynchronizer>(sid);
-		}
+		MultiplayerSynchronizer *sync = _find_synchronizer(p_from, net_id);
 		if (!sync) {
 			// Not received yet.
 			ofs += size;
@@ -732,7 +1212,7 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 		Vector<Variant> vars;
 		vars.resize(props.size());
 		int consumed;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
+		Error err = _decode_state(vars, sync->get_replication_config()->get_sync_quantization(), &p_buffer[ofs], size, consumed);
 		ERR_FAIL_COND_V(err, err);
 		err = MultiplayerSynchronizer::set_state(props, node, vars);
 		ERR_FAIL_COND_V(err, err);
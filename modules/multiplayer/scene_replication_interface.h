@@ -32,6 +32,7 @@
 #define SCENE_REPLICATION_INTERFACE_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 
 #include "multiplayer_spawner.h"
 #include "multiplayer_synchronizer.h"
@@ -65,9 +66,18 @@ private:
 		HashSet<ObjectID> spawn_nodes;
 		HashMap<uint32_t, ObjectID> recv_sync_ids;
 		HashMap<uint32_t, ObjectID> recv_nodes;
+		HashMap<ObjectID, uint64_t> last_watch_usecs;
+		HashMap<ObjectID, float> priorities;
+		Vector3 interest_origin;
+		real_t interest_radius = -1; // Negative means spatial interest is not used for this peer.
 		uint16_t last_sent_sync = 0;
 	};
 
+	struct InterestEntry {
+		ObjectID id;
+		Vector3 position;
+	};
+
 	// Replication state.
 	HashMap<int, PeerInfo> peers_info;
 	uint32_t last_net_id = 0;
@@ -75,6 +85,12 @@ private:
 	HashSet<ObjectID> spawned_nodes;
 	HashSet<ObjectID> sync_nodes;
 
+	// Interest management (rebuilt every network frame).
+	HashMap<Vector3i, LocalVector<InterestEntry>> interest_grid;
+	HashSet<ObjectID> interest_nodes;
+	real_t interest_cell_size = 32;
+	int replication_budget = 0;
+
 	// Pending spawn information.
 	ObjectID pending_spawn;
 	int pending_spawn_remote = 0;
@@ -86,11 +102,22 @@ private:
 	SceneMultiplayer *multiplayer = nullptr;
 	PackedByteArray packet_cache;
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
+	int delta_mtu = 65535;
 
 	TrackedNode &_track(const ObjectID &p_id);
 	void _untrack(const ObjectID &p_id);
 
+	bool _verify_synchronizer(int p_peer, MultiplayerSynchronizer *p_sync, uint32_t &r_net_id);
+	MultiplayerSynchronizer *_find_synchronizer(int p_peer, uint32_t p_net_id);
+
+	_FORCE_INLINE_ Vector3i _get_interest_cell(const Vector3 &p_pos) const { return Vector3i((p_pos / interest_cell_size).floor()); }
+	void _update_interest_grid();
+	static void _gather_interest(const LocalVector<InterestEntry> &p_entries, const Vector3 &p_origin, real_t p_radius, const HashSet<ObjectID> &p_synchronizers, HashMap<ObjectID, real_t> &r_weights);
+	void _filter_interest(const PeerInfo &p_info, HashSet<ObjectID> &r_synchronizers, HashMap<ObjectID, real_t> &r_weights);
+	void _apply_budget(PeerInfo &r_info, HashSet<ObjectID> &r_synchronizers, const HashMap<ObjectID, real_t> &p_weights);
+
 	void _send_sync(int p_peer, const HashSet<ObjectID> p_synchronizers, uint16_t p_sync_net_time, uint64_t p_msec);
+	void _send_delta(int p_peer, const HashSet<ObjectID> p_synchronizers, uint64_t p_usec, HashMap<ObjectID, uint64_t> &r_last_watch_usecs);
 	Error _make_spawn_packet(Node *p_node, MultiplayerSpawner *p_spawner, int &r_len);
 	Error _make_despawn_packet(Node *p_node, int &r_len);
 	Error _send_raw(const uint8_t *p_buffer, int p_size, int p_peer, bool p_reliable);
@@ -100,6 +127,9 @@ private:
 	Error _update_spawn_visibility(int p_peer, const ObjectID &p_oid);
 	void _free_remotes(const PeerInfo &p_info);
 
+	static Error _encode_state(const Vector<const Variant *> &p_vars, const Vector<float> &p_steps, uint8_t *r_buffer, int &r_len);
+	static Error _decode_state(Vector<Variant> &r_vars, const Vector<float> &p_steps, const uint8_t *p_buffer, int p_len, int &r_len);
+
 	template <class T>
 	static T *get_id_as(const ObjectID &p_id) {
 		return p_id.is_valid() ? Object::cast_to<T>(ObjectDB::get_instance(p_id)) : nullptr;
@@ -124,9 +154,17 @@ public:
 	Error on_spawn_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
 	Error on_despawn_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
 	Error on_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
+	Error on_delta_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
 
 	bool is_rpc_visible(const ObjectID &p_oid, int p_peer) const;
 
+	void set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius);
+	void clear_peer_interest(int p_peer);
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+	void set_replication_budget(int p_budget);
+	int get_replication_budget() const;
+
 	SceneReplicationInterface(SceneMultiplayer *p_multiplayer) {
 		multiplayer = p_multiplayer;
 	}
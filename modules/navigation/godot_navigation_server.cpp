@@ -113,6 +113,12 @@ GodotNavigationServer::GodotNavigationServer() {}
 
 GodotNavigationServer::~GodotNavigationServer() {
 	flush_queries();
+
+	// Nobody is left to receive the results.
+	for (uint32_t i = 0; i < path_query_batches.size(); i++) {
+		memdelete(path_query_batches[i]);
+	}
+	path_query_batches.clear();
 }
 
 void GodotNavigationServer::add_command(SetCommand *command) const {
@@ -794,6 +800,9 @@ void GodotNavigationServer::set_active(bool p_active) const {
 }
 
 void GodotNavigationServer::flush_queries() {
+	// The commands may change or free the maps used by the path queries.
+	_wait_for_path_queries();
+
 	// In c++ we can't be sure that this is performed in the main thread
 	// even with mutable functions.
 	MutexLock lock(commands_mutex);
@@ -816,6 +825,7 @@ void GodotNavigationServer::map_force_update(RID p_map) {
 
 void GodotNavigationServer::process(real_t p_delta_time) {
 	flush_queries();
+	_dispatch_path_queries();
 
 	if (!active) {
 		return;
@@ -838,20 +848,17 @@ void GodotNavigationServer::process(real_t p_delta_time) {
 	}
 }
 
-NavigationUtilities::PathQueryResult GodotNavigationServer::_query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const {
+NavigationUtilities::PathQueryResult GodotNavigationServer::_query_map_path(const NavMap *p_map, const NavigationUtilities::PathQueryParameters &p_parameters) {
 	NavigationUtilities::PathQueryResult r_query_result;
 
-	const NavMap *map = map_owner.get_or_null(p_parameters.map);
-	ERR_FAIL_COND_V(map == nullptr, r_query_result);
-
 	// run the pathfinding
 
 	if (p_parameters.pathfinding_algorithm == NavigationUtilities::PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR) {
 		// while postprocessing is still part of map.get_path() need to check and route it here for the correct "optimize" post-processing
 		if (p_parameters.path_postprocessing == NavigationUtilities::PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL) {
-			r_query_result.path = map->get_path(p_parameters.start_position, p_parameters.target_position, true, p_parameters.navigation_layers);
+			r_query_result.path = p_map->get_path(p_parameters.start_position, p_parameters.target_position, true, p_parameters.navigation_layers);
 		} else if (p_parameters.path_postprocessing == NavigationUtilities::PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED) {
-			r_query_result.path = map->get_path(p_parameters.start_position, p_parameters.target_position, false, p_parameters.navigation_layers);
+			r_query_result.path = p_map->get_path(p_parameters.start_position, p_parameters.target_position, false, p_parameters.navigation_layers);
 		}
 	} else {
 		return r_query_result;
@@ -864,6 +871,100 @@ NavigationUtilities::PathQueryResult GodotNavigationServer::_query_path(const Na
 	return r_query_result;
 }
 
+NavigationUtilities::PathQueryResult GodotNavigationServer::_query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const {
+	const NavMap *map = map_owner.get_or_null(p_parameters.map);
+	ERR_FAIL_COND_V(map == nullptr, NavigationUtilities::PathQueryResult());
+
+	return _query_map_path(map, p_parameters);
+}
+
+void GodotNavigationServer::_query_paths_async(const Vector<NavigationUtilities::PathQueryParameters> &p_parameters, const Callable &p_callback) const {
+	GodotNavigationServer *mut_this = const_cast<GodotNavigationServer *>(this);
+
+	PathQueryBatch *batch = memnew(PathQueryBatch);
+	batch->parameters = p_parameters;
+	batch->callback = p_callback;
+	batch->results.resize(p_parameters.size());
+
+	// The maps are resolved here, the worker threads must not touch the RID owners.
+	batch->maps.resize(p_parameters.size());
+	for (int i = 0; i < p_parameters.size(); i++) {
+		batch->maps[i] = map_owner.get_or_null(p_parameters[i].map);
+		if (batch->maps[i] == nullptr) {
+			ERR_PRINT("Invalid map in path query.");
+		}
+	}
+
+	if (!p_parameters.is_empty()) {
+		batch->group_id = WorkerThreadPool::get_singleton()->add_template_group_task(mut_this, &GodotNavigationServer::_path_query_batch_step, batch, p_parameters.size(), -1, false, SNAME("NavigationServerPathQueries"));
+	}
+
+	MutexLock lock(mut_this->path_queries_mutex);
+	mut_this->path_query_batches.push_back(batch);
+}
+
+void GodotNavigationServer::_path_query_batch_step(uint32_t p_index, PathQueryBatch *p_batch) {
+	const NavMap *map = p_batch->maps[p_index];
+	if (map) {
+		p_batch->results[p_index] = _query_map_path(map, p_batch->parameters[p_index]);
+	}
+}
+
+void GodotNavigationServer::_wait_for_path_queries() {
+	MutexLock lock(path_queries_mutex);
+	for (uint32_t i = 0; i < path_query_batches.size(); i++) {
+		PathQueryBatch *batch = path_query_batches[i];
+		if (batch->group_id != -1) {
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch->group_id);
+			batch->group_id = -1;
+		}
+	}
+}
+
+void GodotNavigationServer::_dispatch_path_queries() {
+	LocalVector<PathQueryBatch *> batches;
+	{
+		MutexLock lock(path_queries_mutex);
+		// Batches queued after the wait may still be running, they are dispatched next time.
+		for (uint32_t i = 0; i < path_query_batches.size(); i++) {
+			if (path_query_batches[i]->group_id == -1 || WorkerThreadPool::get_singleton()->is_group_task_completed(path_query_batches[i]->group_id)) {
+				batches.push_back(path_query_batches[i]);
+				path_query_batches.remove_at(i);
+				i--;
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < batches.size(); i++) {
+		PathQueryBatch *batch = batches[i];
+		if (batch->group_id != -1) {
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch->group_id);
+		}
+
+		if (batch->callback.is_valid()) {
+			TypedArray<NavigationPathQueryResult3D> results;
+			results.resize(batch->results.size());
+			for (uint32_t j = 0; j < batch->results.size(); j++) {
+				Ref<NavigationPathQueryResult3D> result;
+				result.instantiate();
+				result->set_path(batch->results[j].path);
+				results[j] = result;
+			}
+
+			Variant results_variant = results;
+			const Variant *args[1] = { &results_variant };
+			Variant ret;
+			Callable::CallError ce;
+			batch->callback.callp(args, 1, ret, ce);
+			if (ce.error != Callable::CallError::CALL_OK) {
+				ERR_PRINT("Error calling path query callback: " + Variant::get_callable_error_text(batch->callback, args, 1, ce) + ".");
+			}
+		}
+
+		memdelete(batch);
+	}
+}
+
 #undef COMMAND_1
 #undef COMMAND_2
 #undef COMMAND_4
@@ -81,6 +81,23 @@ class GodotNavigationServer : public NavigationServer3D {
 	LocalVector<NavMap *> active_maps;
 	LocalVector<uint32_t> active_maps_update_id;
 
+	/// Asynchronous path queries, processed on the worker threads.
+	struct PathQueryBatch {
+		Vector<NavigationUtilities::PathQueryParameters> parameters;
+		LocalVector<const NavMap *> maps;
+		LocalVector<NavigationUtilities::PathQueryResult> results;
+		Callable callback;
+		WorkerThreadPool::GroupID group_id = -1;
+	};
+
+	Mutex path_queries_mutex;
+	LocalVector<PathQueryBatch *> path_query_batches;
+
+	static NavigationUtilities::PathQueryResult _query_map_path(const NavMap *p_map, const NavigationUtilities::PathQueryParameters &p_parameters);
+	void _path_query_batch_step(uint32_t p_index, PathQueryBatch *p_batch);
+	void _wait_for_path_queries();
+	void _dispatch_path_queries();
+
 public:
 	GodotNavigationServer();
 	virtual ~GodotNavigationServer();
@@ -182,6 +199,7 @@ public:
 	virtual void process(real_t p_delta_time) override;
 
 	virtual NavigationUtilities::PathQueryResult _query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const override;
+	virtual void _query_paths_async(const Vector<NavigationUtilities::PathQueryParameters> &p_parameters, const Callable &p_callback) const override;
 };
 
 #undef COMMAND_1
@@ -30,6 +30,7 @@
 
 #include "nav_map.h"
 
+#include "core/debugger/trace_profiler.h"
 #include "core/object/worker_thread_pool.h"
 #include "nav_link.h"
 #include "nav_region.h"
@@ -50,7 +51,8 @@ void NavMap::set_cell_size(float p_cell_size) {
 
 void NavMap::set_edge_connection_margin(float p_edge_connection_margin) {
 	edge_connection_margin = p_edge_connection_margin;
-	regenerate_links = true;
+	// All the near edges have to be connected again.
+	regenerate_polygons = true;
 }
 
 void NavMap::set_link_connection_radius(float p_link_connection_radius) {
@@ -73,42 +75,11 @@ gd::PointKey NavMap::get_point_key(const Vector3 &p_pos) const {
 
 Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers) const {
 	// Find the start poly and the end poly on this map.
-	const gd::Polygon *begin_poly = nullptr;
-	const gd::Polygon *end_poly = nullptr;
 	Vector3 begin_point;
 	Vector3 end_point;
-	float begin_d = 1e20;
-	float end_d = 1e20;
-	// Find the initial poly and the end poly on this map.
-	for (size_t i(0); i < polygons.size(); i++) {
-		const gd::Polygon &p = polygons[i];
-
-		// Only consider the polygon if it in a region with compatible layers.
-		if ((p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
-			continue;
-		}
-
-		// For each face check the distance between the origin/destination
-		for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
-			const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-
-			Vector3 point = face.get_closest_point_to(p_origin);
-			float distance_to_point = point.distance_to(p_origin);
-			if (distance_to_point < begin_d) {
-				begin_d = distance_to_point;
-				begin_poly = &p;
-				begin_point = point;
-			}
-
-			point = face.get_closest_point_to(p_destination);
-			distance_to_point = point.distance_to(p_destination);
-			if (distance_to_point < end_d) {
-				end_d = distance_to_point;
-				end_poly = &p;
-				end_point = point;
-			}
-		}
-	}
+	Vector3 normal;
+	const gd::Polygon *begin_poly = _get_closest_polygon(p_origin, true, p_navigation_layers, begin_point, normal);
+	const gd::Polygon *end_poly = _get_closest_polygon(p_destination, true, p_navigation_layers, end_point, normal);
 
 	// Check for trivial cases
 	if (!begin_poly || !end_poly) {
@@ -124,7 +95,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 
 	// List of all reachable navigation polys.
 	LocalVector<gd::NavigationPoly> navigation_polys;
-	navigation_polys.reserve(polygons.size() * 0.75);
+	navigation_polys.reserve(polygon_count * 0.75);
 
 	// Add the start polygon to the reachable navigation polygons.
 	gd::NavigationPoly begin_navigation_poly = gd::NavigationPoly(begin_poly);
@@ -220,7 +191,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 
 			// Set as end point the furthest reachable point.
 			end_poly = reachable_end;
-			end_d = 1e20;
+			float end_d = 1e20;
 			for (size_t point_id = 2; point_id < end_poly->points.size(); point_id++) {
 				Face3 f(end_poly->points[0].pos, end_poly->points[point_id - 1].pos, end_poly->points[point_id].pos);
 				Vector3 spoint = f.get_closest_point_to(p_destination);
@@ -389,42 +360,45 @@ Vector3 NavMap::get_closest_point_to_segment(const Vector3 &p_from, const Vector
 	Vector3 closest_point;
 	real_t closest_point_d = 1e20;
 
-	for (size_t i(0); i < polygons.size(); i++) {
-		const gd::Polygon &p = polygons[i];
-
-		// For each face check the distance to the segment
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			Vector3 inters;
-			if (f.intersects_segment(p_from, p_to, &inters)) {
-				const real_t d = closest_point_d = p_from.distance_to(inters);
-				if (use_collision == false) {
-					closest_point = inters;
-					use_collision = true;
-					closest_point_d = d;
-				} else if (closest_point_d > d) {
-					closest_point = inters;
-					closest_point_d = d;
+	for (uint32_t r = 0; r < regions.size(); r++) {
+		const LocalVector<gd::Polygon> &region_polygons = ((const NavRegion *)regions[r])->get_polygons();
+		for (size_t i(0); i < region_polygons.size(); i++) {
+			const gd::Polygon &p = region_polygons[i];
+
+			// For each face check the distance to the segment
+			for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
+				const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+				Vector3 inters;
+				if (f.intersects_segment(p_from, p_to, &inters)) {
+					const real_t d = closest_point_d = p_from.distance_to(inters);
+					if (use_collision == false) {
+						closest_point = inters;
+						use_collision = true;
+						closest_point_d = d;
+					} else if (closest_point_d > d) {
+						closest_point = inters;
+						closest_point_d = d;
+					}
 				}
 			}
-		}
-
-		if (use_collision == false) {
-			for (size_t point_id = 0; point_id < p.points.size(); point_id += 1) {
-				Vector3 a, b;
-
-				Geometry3D::get_closest_points_between_segments(
-						p_from,
-						p_to,
-						p.points[point_id].pos,
-						p.points[(point_id + 1) % p.points.size()].pos,
-						a,
-						b);
 
-				const real_t d = a.distance_to(b);
-				if (d < closest_point_d) {
-					closest_point_d = d;
-					closest_point = b;
+			if (use_collision == false) {
+				for (size_t point_id = 0; point_id < p.points.size(); point_id += 1) {
+					Vector3 a, b;
+
+					Geometry3D::get_closest_points_between_segments(
+							p_from,
+							p_to,
+							p.points[point_id].pos,
+							p.points[(point_id + 1) % p.points.size()].pos,
+							a,
+							b);
+
+					const real_t d = a.distance_to(b);
+					if (d < closest_point_d) {
+						closest_point_d = d;
+						closest_point = b;
+					}
 				}
 			}
 		}
@@ -450,23 +424,10 @@ RID NavMap::get_closest_point_owner(const Vector3 &p_point) const {
 
 gd::ClosestPointQueryResult NavMap::get_closest_point_info(const Vector3 &p_point) const {
 	gd::ClosestPointQueryResult result;
-	real_t closest_point_ds = 1e20;
-
-	for (size_t i(0); i < polygons.size(); i++) {
-		const gd::Polygon &p = polygons[i];
-
-		// For each face check the distance to the point
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			const Vector3 inters = f.get_closest_point_to(p_point);
-			const real_t ds = inters.distance_squared_to(p_point);
-			if (ds < closest_point_ds) {
-				result.point = inters;
-				result.normal = f.get_plane().normal;
-				result.owner = p.owner->get_self();
-				closest_point_ds = ds;
-			}
-		}
+
+	const gd::Polygon *closest_polygon = _get_closest_polygon(p_point, false, 0, result.point, result.normal);
+	if (closest_polygon) {
+		result.owner = closest_polygon->owner->get_self();
 	}
 
 	return result;
@@ -480,6 +441,10 @@ void NavMap::add_region(NavRegion *p_region) {
 void NavMap::remove_region(NavRegion *p_region) {
 	int64_t region_index = regions.find(p_region);
 	if (region_index != -1) {
+		// The region may be freed before the next sync, remove any reference to its polygons now.
+		_clear_link_connections();
+		_disconnect_region(p_region);
+
 		regions.remove_at_unordered(region_index);
 		regenerate_links = true;
 	}
@@ -505,7 +470,6 @@ bool NavMap::has_agent(RvoAgent *agent) const {
 void NavMap::add_agent(RvoAgent *agent) {
 	if (!has_agent(agent)) {
 		agents.push_back(agent);
-		agents_dirty = true;
 	}
 }
 
@@ -514,7 +478,6 @@ void NavMap::remove_agent(RvoAgent *agent) {
 	int64_t agent_index = agents.find(agent);
 	if (agent_index != -1) {
 		agents.remove_at_unordered(agent_index);
-		agents_dirty = true;
 	}
 }
 
@@ -530,25 +493,36 @@ void NavMap::remove_agent_as_controlled(RvoAgent *agent) {
 	int64_t active_avoidance_agent_index = controlled_agents.find(agent);
 	if (active_avoidance_agent_index != -1) {
 		controlled_agents.remove_at_unordered(active_avoidance_agent_index);
-		agents_dirty = true;
 	}
 }
 
 void NavMap::sync() {
+	TRACE_ZONE("NavMap::sync");
 	// Check if we need to update the links.
 	if (regenerate_polygons) {
+		// Everything is reconnected from scratch.
+		edge_connections.clear();
+		region_neighbors.clear();
+		freed_edges.clear();
+		link_connected_polygons.clear();
 		for (uint32_t r = 0; r < regions.size(); r++) {
 			regions[r]->scratch_polygons();
+			regions[r]->get_connections().clear();
 		}
 		regenerate_links = true;
 	}
 
+	LocalVector<NavRegion *> dirty_regions;
 	for (uint32_t r = 0; r < regions.size(); r++) {
-		if (regions[r]->sync()) {
-			regenerate_links = true;
+		if (regions[r]->is_dirty()) {
+			dirty_regions.push_back(regions[r]);
 		}
 	}
 
+	if (!dirty_regions.is_empty() || !freed_edges.is_empty()) {
+		regenerate_links = true;
+	}
+
 	for (uint32_t l = 0; l < links.size(); l++) {
 		if (links[l]->check_dirty()) {
 			regenerate_links = true;
@@ -556,70 +530,60 @@ void NavMap::sync() {
 	}
 
 	if (regenerate_links) {
-		// Remove regions connections.
-		for (uint32_t r = 0; r < regions.size(); r++) {
-			regions[r]->get_connections().clear();
-		}
+		// Links are always connected again, and they may point to polygons about to be rebuilt.
+		_clear_link_connections();
 
-		// Resize the polygon count.
-		int count = 0;
-		for (uint32_t r = 0; r < regions.size(); r++) {
-			count += regions[r]->get_polygons().size();
+		// Detach the changed regions from the rest of the map while their old polygons still exist.
+		for (uint32_t r = 0; r < dirty_regions.size(); r++) {
+			_disconnect_region(dirty_regions[r]);
 		}
-		polygons.resize(count);
+	}
 
-		// Copy all region polygons in the map.
-		count = 0;
+	for (uint32_t r = 0; r < regions.size(); r++) {
+		regions[r]->sync();
+	}
+
+	if (regenerate_links) {
+		polygon_count = 0;
 		for (uint32_t r = 0; r < regions.size(); r++) {
-			const LocalVector<gd::Polygon> &polygons_source = regions[r]->get_polygons();
-			for (uint32_t n = 0; n < polygons_source.size(); n++) {
-				polygons[count + n] = polygons_source[n];
-			}
-			count += regions[r]->get_polygons().size();
+			polygon_count += regions[r]->get_polygons().size();
 		}
 
-		// Group all edges per key.
-		HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey> connections;
-		for (uint32_t poly_id = 0; poly_id < polygons.size(); poly_id++) {
-			gd::Polygon &poly(polygons[poly_id]);
-
-			for (uint32_t p = 0; p < poly.points.size(); p++) {
-				int next_point = (p + 1) % poly.points.size();
-				gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+		// Add the edges of the changed regions to the map, connecting the shared ones.
+		for (uint32_t r = 0; r < dirty_regions.size(); r++) {
+			_connect_region_edges(dirty_regions[r]);
+		}
 
-				HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey>::Iterator connection = connections.find(ek);
-				if (!connection) {
-					connections[ek] = Vector<gd::Edge::Connection>();
-				}
-				if (connections[ek].size() <= 1) {
-					// Add the polygon/edge tuple to this key.
-					gd::Edge::Connection new_connection;
-					new_connection.polygon = &poly;
-					new_connection.edge = p;
-					new_connection.pathway_start = poly.points[p].pos;
-					new_connection.pathway_end = poly.points[next_point].pos;
-					connections[ek].push_back(new_connection);
-				} else {
-					// The edge is already connected with another edge, skip.
-					ERR_PRINT_ONCE("Attempted to merge a navigation mesh triangle edge with another already-merged edge. This happens when the current `cell_size` is different from the one used to generate the navigation mesh. This will cause navigation problems.");
-				}
+		// Only the free edges of the changed regions, and the ones that lost
+		// their connection, have to look for near edges to connect to.
+		HashMap<NavRegion *, LocalVector<FreeEdge>> region_free_edges;
+		LocalVector<FreeEdge *> test_edges;
+		for (uint32_t r = 0; r < dirty_regions.size(); r++) {
+			LocalVector<FreeEdge> &free_edges = region_free_edges[dirty_regions[r]];
+			_get_free_edges(dirty_regions[r], free_edges);
+			for (uint32_t i = 0; i < free_edges.size(); i++) {
+				free_edges[i].test_index = test_edges.size();
+				test_edges.push_back(&free_edges[i]);
 			}
 		}
 
-		Vector<gd::Edge::Connection> free_edges;
-		for (KeyValue<gd::EdgeKey, Vector<gd::Edge::Connection>> &E : connections) {
-			if (E.value.size() == 2) {
-				// Connect edge that are shared in different polygons.
-				gd::Edge::Connection &c1 = E.value.write[0];
-				gd::Edge::Connection &c2 = E.value.write[1];
-				c1.polygon->edges[c1.edge].connections.push_back(c2);
-				c2.polygon->edges[c2.edge].connections.push_back(c1);
-				// Note: The pathway_start/end are full for those connection and do not need to be modified.
-			} else {
-				CRASH_COND_MSG(E.value.size() != 1, vformat("Number of connection != 1. Found: %d", E.value.size()));
-				free_edges.push_back(E.value[0]);
+		for (uint32_t f = 0; f < freed_edges.size(); f++) {
+			NavRegion *region = freed_edges[f].region;
+			ERR_CONTINUE(freed_edges[f].polygon >= region->get_polygons().size());
+			const gd::Polygon *polygon = &region->get_polygons()[freed_edges[f].polygon];
+
+			if (!region_free_edges.has(region)) {
+				_get_free_edges(region, region_free_edges[region]);
+			}
+			LocalVector<FreeEdge> &free_edges = region_free_edges[region];
+			for (uint32_t i = 0; i < free_edges.size(); i++) {
+				if (free_edges[i].test_index < 0 && free_edges[i].connection.polygon == polygon && free_edges[i].connection.edge == freed_edges[f].edge) {
+					free_edges[i].test_index = test_edges.size();
+					test_edges.push_back(&free_edges[i]);
+				}
 			}
 		}
+		freed_edges.clear();
 
 		// Find the compatible near edges.
 		//
@@ -628,59 +592,37 @@ void NavMap::sync() {
 		// to be connected, create new polygons to remove that small gap is
 		// not really useful and would result in wasteful computation during
 		// connection, integration and path finding.
-		for (int i = 0; i < free_edges.size(); i++) {
-			const gd::Edge::Connection &free_edge = free_edges[i];
-			Vector3 edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
-			Vector3 edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
-
-			for (int j = 0; j < free_edges.size(); j++) {
-				const gd::Edge::Connection &other_edge = free_edges[j];
-				if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
-					continue;
+		HashMap<NavRegion *, LocalVector<NavRegion *>> near_regions;
+		for (uint32_t i = 0; i < test_edges.size(); i++) {
+			const gd::Edge::Connection &free_edge = test_edges[i]->connection;
+			NavRegion *region = (NavRegion *)free_edge.polygon->owner;
+
+			// Only regions whose bounds are within the margin can have edges to connect.
+			if (!near_regions.has(region)) {
+				LocalVector<NavRegion *> &near = near_regions[region];
+				const AABB bounds = region->get_bounds().grow(edge_connection_margin + cell_size);
+				for (uint32_t r = 0; r < regions.size(); r++) {
+					if (regions[r] != region && !regions[r]->get_polygons().is_empty() && bounds.intersects(regions[r]->get_bounds())) {
+						near.push_back(regions[r]);
+					}
 				}
+			}
 
-				Vector3 other_edge_p1 = other_edge.polygon->points[other_edge.edge].pos;
-				Vector3 other_edge_p2 = other_edge.polygon->points[(other_edge.edge + 1) % other_edge.polygon->points.size()].pos;
-
-				// Compute the projection of the opposite edge on the current one
-				Vector3 edge_vector = edge_p2 - edge_p1;
-				float projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
-				float projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
-				if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
-					continue;
+			const LocalVector<NavRegion *> &near = near_regions[region];
+			for (uint32_t r = 0; r < near.size(); r++) {
+				if (!region_free_edges.has(near[r])) {
+					_get_free_edges(near[r], region_free_edges[near[r]]);
 				}
 
-				// Check if the two edges are close to each other enough and compute a pathway between the two regions.
-				Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
-				Vector3 other1;
-				if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
-					other1 = other_edge_p1;
-				} else {
-					other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
-				}
-				if (other1.distance_to(self1) > edge_connection_margin) {
-					continue;
-				}
+				const LocalVector<FreeEdge> &other_edges = region_free_edges[near[r]];
+				for (uint32_t j = 0; j < other_edges.size(); j++) {
+					if (other_edges[j].test_index >= 0 && other_edges[j].test_index <= int(i)) {
+						continue; // This pair was already checked from the other edge.
+					}
 
-				Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
-				Vector3 other2;
-				if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
-					other2 = other_edge_p2;
-				} else {
-					other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+					_connect_near_edge(free_edge, other_edges[j].connection);
+					_connect_near_edge(other_edges[j].connection, free_edge);
 				}
-				if (other2.distance_to(self2) > edge_connection_margin) {
-					continue;
-				}
-
-				// The edges can now be connected.
-				gd::Edge::Connection new_connection = other_edge;
-				new_connection.pathway_start = (self1 + other1) / 2.0;
-				new_connection.pathway_end = (self2 + other2) / 2.0;
-				free_edge.polygon->edges[free_edge.edge].connections.push_back(new_connection);
-
-				// Add the connection to the region_connection map.
-				((NavRegion *)free_edge.polygon->owner)->get_connections().push_back(new_connection);
 			}
 		}
 
@@ -701,40 +643,51 @@ void NavMap::sync() {
 			real_t closest_end_distance = link_connection_radius;
 			Vector3 closest_end_point;
 
-			// Create link to any polygons within the search radius of the start point.
-			for (uint32_t start_index = 0; start_index < polygons.size(); start_index++) {
-				gd::Polygon &start_poly = polygons[start_index];
-
-				// For each face check the distance to the start
-				for (uint32_t start_point_id = 2; start_point_id < start_poly.points.size(); start_point_id += 1) {
-					const Face3 start_face(start_poly.points[0].pos, start_poly.points[start_point_id - 1].pos, start_poly.points[start_point_id].pos);
-					const Vector3 start_point = start_face.get_closest_point_to(start);
-					const real_t start_distance = start_point.distance_to(start);
-
-					// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-					if (start_distance <= link_connection_radius && start_distance < closest_start_distance) {
-						closest_start_distance = start_distance;
-						closest_start_point = start_point;
-						closest_start_polygon = &start_poly;
-					}
+			for (uint32_t r = 0; r < regions.size(); r++) {
+				LocalVector<gd::Polygon> &region_polygons = regions[r]->get_polygons();
+				if (region_polygons.is_empty()) {
+					continue;
 				}
-			}
 
-			// Find any polygons within the search radius of the end point.
-			for (uint32_t end_index = 0; end_index < polygons.size(); end_index++) {
-				gd::Polygon &end_poly = polygons[end_index];
-
-				// For each face check the distance to the end
-				for (uint32_t end_point_id = 2; end_point_id < end_poly.points.size(); end_point_id += 1) {
-					const Face3 end_face(end_poly.points[0].pos, end_poly.points[end_point_id - 1].pos, end_poly.points[end_point_id].pos);
-					const Vector3 end_point = end_face.get_closest_point_to(end);
-					const real_t end_distance = end_point.distance_to(end);
-
-					// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-					if (end_distance <= link_connection_radius && end_distance < closest_end_distance) {
-						closest_end_distance = end_distance;
-						closest_end_point = end_point;
-						closest_end_polygon = &end_poly;
+				// Skip the regions that are too far from both ends of the link.
+				const AABB region_bounds = regions[r]->get_bounds().grow(link_connection_radius);
+				const bool check_start = region_bounds.has_point(start);
+				const bool check_end = region_bounds.has_point(end);
+				if (!check_start && !check_end) {
+					continue;
+				}
+
+				for (uint32_t poly_index = 0; poly_index < region_polygons.size(); poly_index++) {
+					gd::Polygon &poly = region_polygons[poly_index];
+
+					for (uint32_t point_id = 2; point_id < poly.points.size(); point_id += 1) {
+						const Face3 face(poly.points[0].pos, poly.points[point_id - 1].pos, poly.points[point_id].pos);
+
+						// Create link to any polygons within the search radius of the start point.
+						if (check_start) {
+							const Vector3 start_point = face.get_closest_point_to(start);
+							const real_t start_distance = start_point.distance_to(start);
+
+							// Pick the polygon that is within our radius and is closer than anything we've seen yet.
+							if (start_distance <= link_connection_radius && start_distance < closest_start_distance) {
+								closest_start_distance = start_distance;
+								closest_start_point = start_point;
+								closest_start_polygon = &poly;
+							}
+						}
+
+						// Find any polygons within the search radius of the end point.
+						if (check_end) {
+							const Vector3 end_point = face.get_closest_point_to(end);
+							const real_t end_distance = end_point.distance_to(end);
+
+							// Pick the polygon that is within our radius and is closer than anything we've seen yet.
+							if (end_distance <= link_connection_radius && end_distance < closest_end_distance) {
+								closest_end_distance = end_distance;
+								closest_end_point = end_point;
+								closest_end_polygon = &poly;
+							}
+						}
 					}
 				}
 			}
@@ -770,6 +723,7 @@ void NavMap::sync() {
 					entry_connection.pathway_start = new_polygon.points[0].pos;
 					entry_connection.pathway_end = new_polygon.points[1].pos;
 					closest_start_polygon->edges[0].connections.push_back(entry_connection);
+					link_connected_polygons.push_back(closest_start_polygon);
 
 					gd::Edge::Connection exit_connection;
 					exit_connection.polygon = closest_end_polygon;
@@ -787,6 +741,7 @@ void NavMap::sync() {
 					entry_connection.pathway_start = new_polygon.points[2].pos;
 					entry_connection.pathway_end = new_polygon.points[3].pos;
 					closest_end_polygon->edges[0].connections.push_back(entry_connection);
+					link_connected_polygons.push_back(closest_end_polygon);
 
 					gd::Edge::Connection exit_connection;
 					exit_connection.polygon = closest_start_polygon;
@@ -802,20 +757,296 @@ void NavMap::sync() {
 		map_update_id = (map_update_id + 1) % 9999999;
 	}
 
-	// Update agents tree.
-	if (agents_dirty) {
-		// cannot use LocalVector here as RVO library expects std::vector to build KdTree
-		std::vector<RVO::Agent *> raw_agents;
-		raw_agents.reserve(agents.size());
-		for (size_t i(0); i < agents.size(); i++) {
-			raw_agents.push_back(agents[i]->get_agent());
+	regenerate_polygons = false;
+	regenerate_links = false;
+}
+
+static inline real_t _aabb_distance_squared(const AABB &p_aabb, const Vector3 &p_point) {
+	return p_point.distance_squared_to(p_point.clamp(p_aabb.position, p_aabb.position + p_aabb.size));
+}
+
+const gd::Polygon *NavMap::_get_closest_polygon(const Vector3 &p_point, bool p_use_layers, uint32_t p_navigation_layers, Vector3 &r_closest_point, Vector3 &r_normal) const {
+	// The region and polygon bounds work as a two level spatial index: regions
+	// are visited from the closest one, and the search stops as soon as the
+	// bounds are farther than the closest point found so far.
+	struct RegionDistance {
+		const NavRegion *region = nullptr;
+		real_t distance_squared = 0.0;
+
+		bool operator<(const RegionDistance &p_other) const {
+			return distance_squared < p_other.distance_squared;
 		}
-		rvo.buildAgentTree(raw_agents);
+	};
+
+	LocalVector<RegionDistance> sorted_regions;
+	sorted_regions.reserve(regions.size());
+	for (uint32_t r = 0; r < regions.size(); r++) {
+		const NavRegion *region = regions[r];
+		if (region->get_polygons().is_empty()) {
+			continue;
+		}
+
+		// Only consider the polygons in a region with compatible layers.
+		if (p_use_layers && (p_navigation_layers & region->get_navigation_layers()) == 0) {
+			continue;
+		}
+
+		RegionDistance region_distance;
+		region_distance.region = region;
+		region_distance.distance_squared = _aabb_distance_squared(region->get_bounds(), p_point);
+		sorted_regions.push_back(region_distance);
 	}
+	sorted_regions.sort();
 
-	regenerate_polygons = false;
-	regenerate_links = false;
-	agents_dirty = false;
+	const gd::Polygon *closest_polygon = nullptr;
+	real_t closest_distance_squared = 1e20;
+
+	for (uint32_t r = 0; r < sorted_regions.size(); r++) {
+		if (sorted_regions[r].distance_squared > closest_distance_squared) {
+			break;
+		}
+
+		const LocalVector<gd::Polygon> &region_polygons = sorted_regions[r].region->get_polygons();
+		for (uint32_t i = 0; i < region_polygons.size(); i++) {
+			const gd::Polygon &p = region_polygons[i];
+			if (_aabb_distance_squared(p.aabb, p_point) > closest_distance_squared) {
+				continue;
+			}
+
+			// For each face check the distance to the point
+			for (uint32_t point_id = 2; point_id < p.points.size(); point_id++) {
+				const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+				const Vector3 closest_point = face.get_closest_point_to(p_point);
+				const real_t distance_squared = closest_point.distance_squared_to(p_point);
+				if (distance_squared < closest_distance_squared) {
+					closest_distance_squared = distance_squared;
+					closest_polygon = &p;
+					r_closest_point = closest_point;
+					r_normal = face.get_plane().normal;
+				}
+			}
+		}
+	}
+
+	return closest_polygon;
+}
+
+void NavMap::_disconnect_region(NavRegion *p_region) {
+	// Freed edges of this region are going away with its polygons.
+	for (uint32_t i = freed_edges.size(); i > 0; i--) {
+		if (freed_edges[i - 1].region == p_region) {
+			freed_edges.remove_at_unordered(i - 1);
+		}
+	}
+
+	// Remove the connections the neighbor regions have towards this region.
+	HashMap<NavRegion *, HashSet<NavRegion *>>::Iterator neighbors = region_neighbors.find(p_region);
+	if (neighbors) {
+		for (NavRegion *neighbor : neighbors->value) {
+			_remove_connections_to(neighbor, p_region);
+
+			HashMap<NavRegion *, HashSet<NavRegion *>>::Iterator neighbor_neighbors = region_neighbors.find(neighbor);
+			if (neighbor_neighbors) {
+				neighbor_neighbors->value.erase(p_region);
+			}
+		}
+		region_neighbors.remove(neighbors);
+	}
+	p_region->get_connections().clear();
+
+	LocalVector<gd::Polygon> &own_polygons = p_region->get_polygons();
+	for (uint32_t poly_id = 0; poly_id < own_polygons.size(); poly_id++) {
+		for (uint32_t e = 0; e < own_polygons[poly_id].edges.size(); e++) {
+			own_polygons[poly_id].edges[e].connections.clear();
+		}
+	}
+
+	// Remove the region edges, edges that were shared with another region become free.
+	const LocalVector<gd::Polygon> &region_polygons = ((const NavRegion *)p_region)->get_polygons();
+	for (uint32_t poly_id = 0; poly_id < region_polygons.size(); poly_id++) {
+		const gd::Polygon &poly(region_polygons[poly_id]);
+
+		for (uint32_t p = 0; p < poly.points.size(); p++) {
+			int next_point = (p + 1) % poly.points.size();
+			gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+
+			HashMap<gd::EdgeKey, LocalVector<gd::Edge::Connection>, gd::EdgeKey>::Iterator connection = edge_connections.find(ek);
+			if (!connection) {
+				continue;
+			}
+
+			LocalVector<gd::Edge::Connection> &edge_polygons = connection->value;
+			uint32_t previous_size = edge_polygons.size();
+			for (uint32_t i = edge_polygons.size(); i > 0; i--) {
+				if (edge_polygons[i - 1].polygon->owner == p_region) {
+					edge_polygons.remove_at(i - 1);
+				}
+			}
+
+			if (edge_polygons.is_empty()) {
+				edge_connections.remove(connection);
+			} else if (edge_polygons.size() == 1 && previous_size > 1) {
+				NavRegion *other_region = (NavRegion *)edge_polygons[0].polygon->owner;
+
+				FreedEdge freed_edge;
+				freed_edge.region = other_region;
+				freed_edge.polygon = edge_polygons[0].polygon - other_region->get_polygons().ptr();
+				freed_edge.edge = edge_polygons[0].edge;
+				freed_edges.push_back(freed_edge);
+			}
+		}
+	}
+}
+
+void NavMap::_connect_region_edges(NavRegion *p_region) {
+	LocalVector<gd::Polygon> &region_polygons = p_region->get_polygons();
+	for (uint32_t poly_id = 0; poly_id < region_polygons.size(); poly_id++) {
+		gd::Polygon &poly(region_polygons[poly_id]);
+
+		for (uint32_t p = 0; p < poly.points.size(); p++) {
+			int next_point = (p + 1) % poly.points.size();
+			gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+
+			LocalVector<gd::Edge::Connection> &edge_polygons = edge_connections[ek];
+			if (edge_polygons.size() <= 1) {
+				// Add the polygon/edge tuple to this key.
+				gd::Edge::Connection new_connection;
+				new_connection.polygon = &poly;
+				new_connection.edge = p;
+				new_connection.pathway_start = poly.points[p].pos;
+				new_connection.pathway_end = poly.points[next_point].pos;
+
+				if (edge_polygons.size() == 1) {
+					// Connect edge that are shared in different polygons.
+					gd::Edge::Connection &other = edge_polygons[0];
+					other.polygon->edges[other.edge].connections.push_back(new_connection);
+					poly.edges[p].connections.push_back(other);
+					// Note: The pathway_start/end are full for those connection and do not need to be modified.
+
+					_add_neighbors(p_region, (NavRegion *)other.polygon->owner);
+				}
+
+				edge_polygons.push_back(new_connection);
+			} else {
+				// The edge is already connected with another edge, skip.
+				ERR_PRINT_ONCE("Attempted to merge a navigation mesh triangle edge with another already-merged edge. This happens when the current `cell_size` is different from the one used to generate the navigation mesh. This will cause navigation problems.");
+			}
+		}
+	}
+}
+
+void NavMap::_remove_connections_to(NavRegion *p_region, const NavRegion *p_to_region) {
+	LocalVector<gd::Polygon> &region_polygons = p_region->get_polygons();
+	for (uint32_t poly_id = 0; poly_id < region_polygons.size(); poly_id++) {
+		gd::Polygon &poly(region_polygons[poly_id]);
+
+		for (uint32_t e = 0; e < poly.edges.size(); e++) {
+			Vector<gd::Edge::Connection> &connections = poly.edges[e].connections;
+			for (int i = connections.size() - 1; i >= 0; i--) {
+				if (connections[i].polygon->owner == p_to_region) {
+					connections.remove_at(i);
+				}
+			}
+		}
+	}
+
+	Vector<gd::Edge::Connection> &region_connections = p_region->get_connections();
+	for (int i = region_connections.size() - 1; i >= 0; i--) {
+		if (region_connections[i].polygon->owner == p_to_region) {
+			region_connections.remove_at(i);
+		}
+	}
+}
+
+void NavMap::_add_neighbors(NavRegion *p_region_a, NavRegion *p_region_b) {
+	if (p_region_a == p_region_b) {
+		return;
+	}
+
+	region_neighbors[p_region_a].insert(p_region_b);
+	region_neighbors[p_region_b].insert(p_region_a);
+}
+
+void NavMap::_get_free_edges(NavRegion *p_region, LocalVector<FreeEdge> &r_free_edges) const {
+	const LocalVector<gd::Polygon> &region_polygons = ((const NavRegion *)p_region)->get_polygons();
+	for (uint32_t poly_id = 0; poly_id < region_polygons.size(); poly_id++) {
+		const gd::Polygon &poly(region_polygons[poly_id]);
+
+		for (uint32_t p = 0; p < poly.points.size(); p++) {
+			int next_point = (p + 1) % poly.points.size();
+			gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+
+			const LocalVector<gd::Edge::Connection> *edge_polygons = edge_connections.getptr(ek);
+			if (edge_polygons && edge_polygons->size() == 1 && (*edge_polygons)[0].polygon == &poly) {
+				FreeEdge free_edge;
+				free_edge.connection = (*edge_polygons)[0];
+				r_free_edges.push_back(free_edge);
+			}
+		}
+	}
+}
+
+void NavMap::_connect_near_edge(const gd::Edge::Connection &p_free_edge, const gd::Edge::Connection &p_other_edge) {
+	Vector3 edge_p1 = p_free_edge.polygon->points[p_free_edge.edge].pos;
+	Vector3 edge_p2 = p_free_edge.polygon->points[(p_free_edge.edge + 1) % p_free_edge.polygon->points.size()].pos;
+
+	Vector3 other_edge_p1 = p_other_edge.polygon->points[p_other_edge.edge].pos;
+	Vector3 other_edge_p2 = p_other_edge.polygon->points[(p_other_edge.edge + 1) % p_other_edge.polygon->points.size()].pos;
+
+	// Compute the projection of the opposite edge on the current one
+	Vector3 edge_vector = edge_p2 - edge_p1;
+	float projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
+	float projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
+	if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
+		return;
+	}
+
+	// Check if the two edges are close to each other enough and compute a pathway between the two regions.
+	Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
+	Vector3 other1;
+	if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
+		other1 = other_edge_p1;
+	} else {
+		other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+	}
+	if (other1.distance_to(self1) > edge_connection_margin) {
+		return;
+	}
+
+	Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
+	Vector3 other2;
+	if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
+		other2 = other_edge_p2;
+	} else {
+		other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+	}
+	if (other2.distance_to(self2) > edge_connection_margin) {
+		return;
+	}
+
+	// The edges can now be connected.
+	gd::Edge::Connection new_connection = p_other_edge;
+	new_connection.pathway_start = (self1 + other1) / 2.0;
+	new_connection.pathway_end = (self2 + other2) / 2.0;
+	p_free_edge.polygon->edges[p_free_edge.edge].connections.push_back(new_connection);
+
+	// Add the connection to the region_connection map.
+	NavRegion *region = (NavRegion *)p_free_edge.polygon->owner;
+	region->get_connections().push_back(new_connection);
+	_add_neighbors(region, (NavRegion *)p_other_edge.polygon->owner);
+}
+
+void NavMap::_clear_link_connections() {
+	// Link connections are the only ones without a target edge.
+	for (uint32_t i = 0; i < link_connected_polygons.size(); i++) {
+		Vector<gd::Edge::Connection> &connections = link_connected_polygons[i]->edges[0].connections;
+		for (int c = connections.size() - 1; c >= 0; c--) {
+			if (connections[c].edge == -1) {
+				connections.remove_at(c);
+			}
+		}
+	}
+	link_connected_polygons.clear();
 }
 
 void NavMap::compute_single_step(uint32_t index, RvoAgent **agent) {
@@ -823,9 +1054,35 @@ void NavMap::compute_single_step(uint32_t index, RvoAgent **agent) {
 	(*(agent + index))->get_agent()->computeNewVelocity(deltatime);
 }
 
+void NavMap::build_agent_subtree(uint32_t index, const RVO::KdTree::DeferredNode *nodes) {
+	rvo.buildAgentTreeRecursive(nodes[index].begin, nodes[index].end, nodes[index].node);
+}
+
+void NavMap::_update_agent_tree() {
+	// Agents move every step, so the tree has to be rebuilt before querying neighbors.
+	// cannot use LocalVector here as RVO library expects std::vector to build KdTree
+	raw_agents.clear();
+	raw_agents.reserve(agents.size());
+	for (uint32_t i = 0; i < agents.size(); i++) {
+		raw_agents.push_back(agents[i]->get_agent());
+	}
+
+	if (raw_agents.size() < 1024) {
+		rvo.buildAgentTree(raw_agents);
+		return;
+	}
+
+	// Only split the top levels here, and build the resulting subtrees on the worker threads.
+	rvo.buildAgentTree(raw_agents, 4);
+	const uint32_t subtree_count = rvo.deferredNodes_.size();
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::build_agent_subtree, (const RVO::KdTree::DeferredNode *)rvo.deferredNodes_.data(), subtree_count, -1, true, SNAME("NavigationMapAgentTree"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 void NavMap::step(real_t p_deltatime) {
 	deltatime = p_deltatime;
 	if (controlled_agents.size() > 0) {
+		_update_agent_tree();
 		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_step, controlled_agents.ptr(), controlled_agents.size(), -1, true, SNAME("NavigationMapAgents"));
 		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 	}
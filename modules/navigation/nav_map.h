@@ -35,6 +35,7 @@
 
 #include "core/math/math_defs.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/rb_map.h"
 #include "nav_utils.h"
 
@@ -68,14 +69,32 @@ class NavMap : public NavRid {
 	LocalVector<NavLink *> links;
 	LocalVector<gd::Polygon> link_polygons;
 
-	/// Map polygons
-	LocalVector<gd::Polygon> polygons;
+	/// Map polygons, they are stored in the regions.
+	uint32_t polygon_count = 0;
+
+	/// All the region polygon edges grouped per key, kept between syncs so
+	/// that only the edges of the changed regions have to be reconnected.
+	HashMap<gd::EdgeKey, LocalVector<gd::Edge::Connection>, gd::EdgeKey> edge_connections;
+
+	/// Regions connected to each region, either by a shared or by a near edge.
+	HashMap<NavRegion *, HashSet<NavRegion *>> region_neighbors;
+
+	/// Edges of unchanged regions that lost their connection since the last sync.
+	struct FreedEdge {
+		NavRegion *region = nullptr;
+		uint32_t polygon = 0;
+		int edge = -1;
+	};
+	LocalVector<FreedEdge> freed_edges;
+
+	/// Region polygons that have a connection to a link.
+	LocalVector<gd::Polygon *> link_connected_polygons;
 
 	/// Rvo world
 	RVO::KdTree rvo;
 
-	/// Is agent array modified?
-	bool agents_dirty = false;
+	/// Agents handed to the tree on the next rebuild, swapped with the previous ones to keep the allocation.
+	std::vector<RVO::Agent *> raw_agents;
 
 	/// All the Agents (even the controlled one)
 	LocalVector<RvoAgent *> agents;
@@ -153,7 +172,24 @@ public:
 	void dispatch_callbacks();
 
 private:
+	struct FreeEdge {
+		gd::Edge::Connection connection;
+		int test_index = -1;
+	};
+
+	void _disconnect_region(NavRegion *p_region);
+	void _connect_region_edges(NavRegion *p_region);
+	void _remove_connections_to(NavRegion *p_region, const NavRegion *p_to_region);
+	void _add_neighbors(NavRegion *p_region_a, NavRegion *p_region_b);
+	void _get_free_edges(NavRegion *p_region, LocalVector<FreeEdge> &r_free_edges) const;
+	void _connect_near_edge(const gd::Edge::Connection &p_free_edge, const gd::Edge::Connection &p_other_edge);
+	void _clear_link_connections();
+
+	const gd::Polygon *_get_closest_polygon(const Vector3 &p_point, bool p_use_layers, uint32_t p_navigation_layers, Vector3 &r_closest_point, Vector3 &r_normal) const;
+
 	void compute_single_step(uint32_t index, RvoAgent **agent);
+	void build_agent_subtree(uint32_t index, const RVO::KdTree::DeferredNode *nodes);
+	void _update_agent_tree();
 	void clip_path(const LocalVector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly) const;
 };
 
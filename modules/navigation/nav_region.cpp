@@ -127,6 +127,17 @@ void NavRegion::update_polygons() {
 			p.points[j].pos = point_position;
 			p.points[j].key = map->get_point_key(point_position);
 
+			if (j == 0) {
+				p.aabb = AABB(point_position, Vector3());
+			} else {
+				p.aabb.expand_to(point_position);
+			}
+			if (i == 0 && j == 0) {
+				bounds = AABB(point_position, Vector3());
+			} else {
+				bounds.expand_to(point_position);
+			}
+
 			center += point_position; // Composing the center of the polygon
 
 			if (j >= 2) {
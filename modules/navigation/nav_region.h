@@ -46,6 +46,7 @@ class NavRegion : public NavBase {
 
 	/// Cache
 	LocalVector<gd::Polygon> polygons;
+	AABB bounds;
 
 public:
 	NavRegion() {}
@@ -54,6 +55,10 @@ public:
 		polygons_dirty = true;
 	}
 
+	bool is_dirty() const {
+		return polygons_dirty;
+	}
+
 	void set_map(NavMap *p_map);
 	NavMap *get_map() const {
 		return map;
@@ -80,6 +85,16 @@ public:
 		return polygons;
 	}
 
+	/// The map stores the edge connections directly in the region polygons.
+	LocalVector<gd::Polygon> &get_polygons() {
+		return polygons;
+	}
+
+	/// Bounds of the polygons, only meaningful when there are polygons.
+	const AABB &get_bounds() const {
+		return bounds;
+	}
+
 	bool sync();
 
 private:
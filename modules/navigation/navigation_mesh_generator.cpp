@@ -33,6 +33,7 @@
 #include "navigation_mesh_generator.h"
 
 #include "core/math/convex_hull.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/thread.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/multimesh_instance_3d.h"
@@ -497,6 +498,24 @@ void NavigationMeshGenerator::_convert_detail_mesh_to_native_navigation_mesh(con
 	}
 }
 
+void NavigationMeshGenerator::_fill_recast_config(Ref<NavigationMesh> p_nav_mesh, rcConfig &r_cfg) {
+	memset(&r_cfg, 0, sizeof(r_cfg));
+
+	r_cfg.cs = p_nav_mesh->get_cell_size();
+	r_cfg.ch = p_nav_mesh->get_cell_height();
+	r_cfg.walkableSlopeAngle = p_nav_mesh->get_agent_max_slope();
+	r_cfg.walkableHeight = (int)Math::ceil(p_nav_mesh->get_agent_height() / r_cfg.ch);
+	r_cfg.walkableClimb = (int)Math::floor(p_nav_mesh->get_agent_max_climb() / r_cfg.ch);
+	r_cfg.walkableRadius = (int)Math::ceil(p_nav_mesh->get_agent_radius() / r_cfg.cs);
+	r_cfg.maxEdgeLen = (int)(p_nav_mesh->get_edge_max_length() / p_nav_mesh->get_cell_size());
+	r_cfg.maxSimplificationError = p_nav_mesh->get_edge_max_error();
+	r_cfg.minRegionArea = (int)(p_nav_mesh->get_region_min_size() * p_nav_mesh->get_region_min_size());
+	r_cfg.mergeRegionArea = (int)(p_nav_mesh->get_region_merge_size() * p_nav_mesh->get_region_merge_size());
+	r_cfg.maxVertsPerPoly = (int)p_nav_mesh->get_verts_per_poly();
+	r_cfg.detailSampleDist = MAX(p_nav_mesh->get_cell_size() * p_nav_mesh->get_detail_sample_distance(), 0.1f);
+	r_cfg.detailSampleMaxError = p_nav_mesh->get_cell_height() * p_nav_mesh->get_detail_sample_max_error();
+}
+
 void NavigationMeshGenerator::_build_recast_navigation_mesh(
 		Ref<NavigationMesh> p_nav_mesh,
 #ifdef TOOLS_ENABLED
@@ -526,21 +545,7 @@ void NavigationMeshGenerator::_build_recast_navigation_mesh(
 	rcCalcBounds(verts, nverts, bmin, bmax);
 
 	rcConfig cfg;
-	memset(&cfg, 0, sizeof(cfg));
-
-	cfg.cs = p_nav_mesh->get_cell_size();
-	cfg.ch = p_nav_mesh->get_cell_height();
-	cfg.walkableSlopeAngle = p_nav_mesh->get_agent_max_slope();
-	cfg.walkableHeight = (int)Math::ceil(p_nav_mesh->get_agent_height() / cfg.ch);
-	cfg.walkableClimb = (int)Math::floor(p_nav_mesh->get_agent_max_climb() / cfg.ch);
-	cfg.walkableRadius = (int)Math::ceil(p_nav_mesh->get_agent_radius() / cfg.cs);
-	cfg.maxEdgeLen = (int)(p_nav_mesh->get_edge_max_length() / p_nav_mesh->get_cell_size());
-	cfg.maxSimplificationError = p_nav_mesh->get_edge_max_error();
-	cfg.minRegionArea = (int)(p_nav_mesh->get_region_min_size() * p_nav_mesh->get_region_min_size());
-	cfg.mergeRegionArea = (int)(p_nav_mesh->get_region_merge_size() * p_nav_mesh->get_region_merge_size());
-	cfg.maxVertsPerPoly = (int)p_nav_mesh->get_verts_per_poly();
-	cfg.detailSampleDist = MAX(p_nav_mesh->get_cell_size() * p_nav_mesh->get_detail_sample_distance(), 0.1f);
-	cfg.detailSampleMaxError = p_nav_mesh->get_cell_height() * p_nav_mesh->get_detail_sample_max_error();
+	_fill_recast_config(p_nav_mesh, cfg);
 
 	if (!Math::is_equal_approx((float)cfg.walkableHeight * cfg.ch, p_nav_mesh->get_agent_height())) {
 		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
@@ -718,6 +723,293 @@ void NavigationMeshGenerator::_build_recast_navigation_mesh(
 	detail_mesh = nullptr;
 }
 
+bool NavigationMeshGenerator::_build_recast_tile(const Ref<NavigationMesh> &p_nav_mesh, const rcConfig &p_cfg, const Vector<float> &p_vertices, const Vector<int> &p_indices, TileResult &r_result) {
+	// Frees whatever was allocated when returning early.
+	struct RecastData {
+		rcHeightfield *hf = nullptr;
+		rcCompactHeightfield *chf = nullptr;
+		rcContourSet *cset = nullptr;
+		rcPolyMesh *poly_mesh = nullptr;
+		rcPolyMeshDetail *detail_mesh = nullptr;
+
+		~RecastData() {
+			rcFreeHeightField(hf);
+			rcFreeCompactHeightfield(chf);
+			rcFreeContourSet(cset);
+			rcFreePolyMesh(poly_mesh);
+			rcFreePolyMeshDetail(detail_mesh);
+		}
+	} data;
+
+	rcContext ctx;
+	rcConfig cfg = p_cfg;
+
+	const float *verts = p_vertices.ptr();
+	const int nverts = p_vertices.size() / 3;
+	const int *tris = p_indices.ptr();
+	const int ntris = p_indices.size() / 3;
+
+	data.hf = rcAllocHeightfield();
+	ERR_FAIL_COND_V(!data.hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *data.hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch), false);
+
+	{
+		Vector<unsigned char> tri_areas;
+		tri_areas.resize(ntris);
+		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *data.hf, cfg.walkableClimb), false);
+	}
+
+	if (p_nav_mesh->get_filter_low_hanging_obstacles()) {
+		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *data.hf);
+	}
+	if (p_nav_mesh->get_filter_ledge_spans()) {
+		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *data.hf);
+	}
+	if (p_nav_mesh->get_filter_walkable_low_height_spans()) {
+		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *data.hf);
+	}
+
+	data.chf = rcAllocCompactHeightfield();
+	ERR_FAIL_COND_V(!data.chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *data.hf, *data.chf), false);
+	rcFreeHeightField(data.hf);
+	data.hf = nullptr;
+
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *data.chf), false);
+
+	// The border is only there so the tile edges match their neighbors, it's cut from the regions.
+	if (p_nav_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *data.chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *data.chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea), false);
+	} else if (p_nav_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *data.chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea), false);
+	} else {
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *data.chf, cfg.borderSize, cfg.minRegionArea), false);
+	}
+
+	data.cset = rcAllocContourSet();
+	ERR_FAIL_COND_V(!data.cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *data.chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *data.cset), false);
+
+	data.poly_mesh = rcAllocPolyMesh();
+	ERR_FAIL_COND_V(!data.poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *data.cset, cfg.maxVertsPerPoly, *data.poly_mesh), false);
+
+	data.detail_mesh = rcAllocPolyMeshDetail();
+	ERR_FAIL_COND_V(!data.detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *data.poly_mesh, *data.chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *data.detail_mesh), false);
+
+	// Same conversion as _convert_detail_mesh_to_native_navigation_mesh(), into the tile result.
+	const rcPolyMeshDetail *detail_mesh = data.detail_mesh;
+	r_result.vertices.resize(detail_mesh->nverts);
+	Vector3 *w = r_result.vertices.ptrw();
+	for (int i = 0; i < detail_mesh->nverts; i++) {
+		const float *v = &detail_mesh->verts[i * 3];
+		w[i] = Vector3(v[0], v[1], v[2]);
+	}
+
+	r_result.polygons.clear();
+	for (int i = 0; i < detail_mesh->nmeshes; i++) {
+		const unsigned int *m = &detail_mesh->meshes[i * 4];
+		const unsigned int bverts = m[0];
+		const unsigned int btris = m[2];
+		const unsigned int ntris_mesh = m[3];
+		const unsigned char *mesh_tris = &detail_mesh->tris[btris * 4];
+		for (unsigned int j = 0; j < ntris_mesh; j++) {
+			Vector<int> nav_indices;
+			nav_indices.resize(3);
+			// Polygon order in recast is opposite than godot's
+			nav_indices.write[0] = ((int)(bverts + mesh_tris[j * 4 + 0]));
+			nav_indices.write[1] = ((int)(bverts + mesh_tris[j * 4 + 2]));
+			nav_indices.write[2] = ((int)(bverts + mesh_tris[j * 4 + 1]));
+			r_result.polygons.push_back(nav_indices);
+		}
+	}
+
+	return true;
+}
+
+void NavigationMeshGenerator::_bake_tile(uint32_t p_index, TiledBake *p_bake) {
+	TileBake &tile = p_bake->tiles[p_bake->pending[p_index]];
+	const int border = p_bake->cfg.borderSize;
+	const float tile_width = p_bake->cfg.tileSize * p_bake->cfg.cs;
+
+	rcConfig cfg = p_bake->cfg;
+	cfg.width = cfg.tileSize + border * 2;
+	cfg.height = cfg.tileSize + border * 2;
+	cfg.bmin[0] = tile.tile.x * tile_width - border * cfg.cs;
+	cfg.bmin[2] = tile.tile.y * tile_width - border * cfg.cs;
+	cfg.bmax[0] = cfg.bmin[0] + cfg.width * cfg.cs;
+	cfg.bmax[2] = cfg.bmin[2] + cfg.height * cfg.cs;
+
+	uint32_t geometry_hash = tile.result.geometry_hash;
+	if (!_build_recast_tile(p_bake->nav_mesh, cfg, tile.vertices, tile.indices, tile.result)) {
+		tile.result.vertices.clear();
+		tile.result.polygons.clear();
+	}
+	tile.result.geometry_hash = geometry_hash;
+}
+
+void NavigationMeshGenerator::_bake_tiled(Ref<NavigationMesh> p_nav_mesh, Node *p_node, const Vector<float> &p_vertices, const Vector<int> &p_indices) {
+	TiledBake bake;
+	bake.nav_mesh = p_nav_mesh;
+	rcConfig &cfg = bake.cfg;
+	_fill_recast_config(p_nav_mesh, cfg);
+	cfg.tileSize = p_nav_mesh->get_tile_size();
+	cfg.borderSize = cfg.walkableRadius + 3;
+
+	const float *verts = p_vertices.ptr();
+	const int *tris = p_indices.ptr();
+	const int ntris = p_indices.size() / 3;
+
+	rcCalcBounds(verts, p_vertices.size() / 3, cfg.bmin, cfg.bmax);
+
+	// Snap the height range to steps of whole cells, so small changes to the geometry don't change it and invalidate every tile.
+	const float height_step = cfg.ch * 64;
+	cfg.bmin[1] = Math::floor(cfg.bmin[1] / height_step) * height_step;
+	cfg.bmax[1] = Math::ceil(cfg.bmax[1] / height_step) * height_step;
+
+	AABB baking_aabb = p_nav_mesh->get_filter_baking_aabb();
+	const bool filter_aabb = baking_aabb.has_volume();
+	if (filter_aabb) {
+		baking_aabb.position += p_nav_mesh->get_filter_baking_aabb_offset();
+		cfg.bmin[1] = baking_aabb.position.y;
+		cfg.bmax[1] = baking_aabb.position.y + baking_aabb.size.y;
+	}
+
+	// Tiles are laid out from the origin of the navigation mesh so they stay the same between bakes.
+	const float tile_width = cfg.tileSize * cfg.cs;
+	const float border_width = cfg.borderSize * cfg.cs;
+
+	HashMap<Vector2i, uint32_t> tile_indices;
+	for (int i = 0; i < ntris; i++) {
+		const float *v0 = &verts[tris[i * 3 + 0] * 3];
+		const float *v1 = &verts[tris[i * 3 + 1] * 3];
+		const float *v2 = &verts[tris[i * 3 + 2] * 3];
+		const float min_x = MIN(v0[0], MIN(v1[0], v2[0])) - border_width;
+		const float max_x = MAX(v0[0], MAX(v1[0], v2[0])) + border_width;
+		const float min_z = MIN(v0[2], MIN(v1[2], v2[2])) - border_width;
+		const float max_z = MAX(v0[2], MAX(v1[2], v2[2])) + border_width;
+
+		for (int z = (int)Math::floor(min_z / tile_width); z <= (int)Math::floor(max_z / tile_width); z++) {
+			for (int x = (int)Math::floor(min_x / tile_width); x <= (int)Math::floor(max_x / tile_width); x++) {
+				if (filter_aabb) {
+					AABB tile_aabb(Vector3(x * tile_width, baking_aabb.position.y, z * tile_width), Vector3(tile_width, baking_aabb.size.y, tile_width));
+					if (!tile_aabb.intersects(baking_aabb)) {
+						continue;
+					}
+				}
+
+				Vector2i key(x, z);
+				uint32_t *index = tile_indices.getptr(key);
+				if (!index) {
+					index = &tile_indices.insert(key, bake.tiles.size())->value;
+					TileBake tile;
+					tile.tile = key;
+					bake.tiles.push_back(tile);
+				}
+				TileBake &tile = bake.tiles[*index];
+				int base = tile.vertices.size() / 3;
+				for (int j = 0; j < 3; j++) {
+					const float *v = &verts[tris[i * 3 + j] * 3];
+					tile.vertices.push_back(v[0]);
+					tile.vertices.push_back(v[1]);
+					tile.vertices.push_back(v[2]);
+					tile.indices.push_back(base + j);
+				}
+			}
+		}
+	}
+
+	// Changing any setting, or the height range of the geometry, invalidates every tile.
+	rcConfig settings_cfg = cfg;
+	settings_cfg.bmin[0] = settings_cfg.bmin[2] = 0;
+	settings_cfg.bmax[0] = settings_cfg.bmax[2] = 0;
+	uint32_t settings_hash = hash_murmur3_buffer(&settings_cfg, sizeof(rcConfig));
+	settings_hash = hash_murmur3_one_32(p_nav_mesh->get_sample_partition_type(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_nav_mesh->get_filter_low_hanging_obstacles(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_nav_mesh->get_filter_ledge_spans(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_nav_mesh->get_filter_walkable_low_height_spans(), settings_hash);
+
+	const ObjectID node_id = p_node->get_instance_id();
+	{
+		MutexLock lock(tile_cache_mutex);
+
+		// Forget about the nodes that were freed since their last bake.
+		LocalVector<ObjectID> freed_nodes;
+		for (const KeyValue<ObjectID, TileCache> &E : tile_caches) {
+			if (!ObjectDB::get_instance(E.key)) {
+				freed_nodes.push_back(E.key);
+			}
+		}
+		for (uint32_t i = 0; i < freed_nodes.size(); i++) {
+			tile_caches.erase(freed_nodes[i]);
+		}
+
+		TileCache &cache = tile_caches[node_id];
+		if (cache.settings_hash != settings_hash) {
+			cache.settings_hash = settings_hash;
+			cache.tiles.clear();
+		}
+
+		for (uint32_t i = 0; i < bake.tiles.size(); i++) {
+			TileBake &tile = bake.tiles[i];
+			tile.result.geometry_hash = hash_murmur3_buffer(tile.vertices.ptr(), tile.vertices.size() * sizeof(float));
+			const TileResult *cached = cache.tiles.getptr(tile.tile);
+			if (cached && cached->geometry_hash == tile.result.geometry_hash) {
+				tile.result = *cached;
+				tile.cached = true;
+			} else {
+				bake.pending.push_back(i);
+			}
+		}
+	}
+
+	if (bake.pending.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavigationMeshGenerator::_bake_tile, &bake, bake.pending.size(), -1, true, SNAME("NavigationMeshTiles"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (bake.pending.size() == 1) {
+		_bake_tile(0, &bake);
+	}
+
+	{
+		MutexLock lock(tile_cache_mutex);
+		TileCache &cache = tile_caches[node_id];
+		cache.tiles.clear();
+		for (uint32_t i = 0; i < bake.tiles.size(); i++) {
+			cache.tiles.insert(bake.tiles[i].tile, bake.tiles[i].result);
+		}
+	}
+
+	// Merge the tiles, the edges they share get connected by the navigation map like any other.
+	Vector<Vector3> nav_vertices;
+	int vertex_count = 0;
+	for (uint32_t i = 0; i < bake.tiles.size(); i++) {
+		vertex_count += bake.tiles[i].result.vertices.size();
+	}
+	nav_vertices.resize(vertex_count);
+	Vector3 *w = nav_vertices.ptrw();
+	int offset = 0;
+	for (uint32_t i = 0; i < bake.tiles.size(); i++) {
+		const TileResult &result = bake.tiles[i].result;
+		for (int j = 0; j < result.vertices.size(); j++) {
+			w[offset + j] = result.vertices[j];
+		}
+		for (int j = 0; j < result.polygons.size(); j++) {
+			Vector<int> polygon = result.polygons[j];
+			int *pw = polygon.ptrw();
+			for (int k = 0; k < polygon.size(); k++) {
+				pw[k] += offset;
+			}
+			p_nav_mesh->add_polygon(polygon);
+		}
+		offset += result.vertices.size();
+	}
+	p_nav_mesh->set_vertices(nav_vertices);
+}
+
 NavigationMeshGenerator *NavigationMeshGenerator::get_singleton() {
 	return singleton;
 }
@@ -769,7 +1061,9 @@ void NavigationMeshGenerator::bake(Ref<NavigationMesh> p_nav_mesh, Node *p_node)
 		_parse_geometry(navmesh_xform, E, vertices, indices, geometry_type, collision_mask, recurse_children);
 	}
 
-	if (vertices.size() > 0 && indices.size() > 0) {
+	if (vertices.size() > 0 && indices.size() > 0 && p_nav_mesh->get_tile_size() > 0) {
+		_bake_tiled(p_nav_mesh, p_node, vertices, indices);
+	} else if (vertices.size() > 0 && indices.size() > 0) {
 		rcHeightfield *hf = nullptr;
 		rcCompactHeightfield *chf = nullptr;
 		rcContourSet *cset = nullptr;
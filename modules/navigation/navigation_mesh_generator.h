@@ -33,6 +33,8 @@
 
 #ifndef _3D_DISABLED
 
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
 #include "scene/3d/navigation_region_3d.h"
 
 #include <Recast.h>
@@ -46,6 +48,36 @@ class NavigationMeshGenerator : public Object {
 
 	static NavigationMeshGenerator *singleton;
 
+	// Results of tiled bakes, kept per baked node so unchanged tiles can be reused.
+	struct TileResult {
+		uint32_t geometry_hash = 0;
+		Vector<Vector3> vertices;
+		Vector<Vector<int>> polygons;
+	};
+
+	struct TileCache {
+		uint32_t settings_hash = 0;
+		HashMap<Vector2i, TileResult> tiles;
+	};
+
+	struct TileBake {
+		Vector2i tile;
+		Vector<float> vertices;
+		Vector<int> indices;
+		bool cached = false;
+		TileResult result;
+	};
+
+	struct TiledBake {
+		Ref<NavigationMesh> nav_mesh;
+		rcConfig cfg;
+		LocalVector<TileBake> tiles;
+		LocalVector<uint32_t> pending;
+	};
+
+	Mutex tile_cache_mutex;
+	HashMap<ObjectID, TileCache> tile_caches;
+
 protected:
 	static void _bind_methods();
 
@@ -56,6 +88,10 @@ protected:
 	static void _parse_geometry(const Transform3D &p_navmesh_transform, Node *p_node, Vector<float> &p_vertices, Vector<int> &p_indices, NavigationMesh::ParsedGeometryType p_generate_from, uint32_t p_collision_mask, bool p_recurse_children);
 
 	static void _convert_detail_mesh_to_native_navigation_mesh(const rcPolyMeshDetail *p_detail_mesh, Ref<NavigationMesh> p_nav_mesh);
+	static void _fill_recast_config(Ref<NavigationMesh> p_nav_mesh, rcConfig &r_cfg);
+	static bool _build_recast_tile(const Ref<NavigationMesh> &p_nav_mesh, const rcConfig &p_cfg, const Vector<float> &p_vertices, const Vector<int> &p_indices, TileResult &r_result);
+	void _bake_tile(uint32_t p_index, TiledBake *p_bake);
+	void _bake_tiled(Ref<NavigationMesh> p_nav_mesh, Node *p_node, const Vector<float> &p_vertices, const Vector<int> &p_indices);
 	static void _build_recast_navigation_mesh(
 			Ref<NavigationMesh> p_nav_mesh,
 #ifdef TOOLS_ENABLED
@@ -336,6 +336,43 @@ real_t FastNoiseLite::get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const {
 	return _noise.GetNoise(p_x, p_y, p_z);
 }
 
+void FastNoiseLite::get_noise_2d_row(real_t p_x, real_t p_y, int p_count, real_t *r_values) const {
+	p_x += offset.x;
+	p_y += offset.y;
+	// Same as get_noise_2d(), with the domain warp check and the virtual call hoisted out of the loop.
+	if (domain_warp_enabled) {
+		for (int i = 0; i < p_count; i++) {
+			real_t x = p_x + i;
+			real_t y = p_y;
+			_domain_warp_noise.DomainWarp(x, y);
+			r_values[i] = _noise.GetNoise(x, y);
+		}
+	} else {
+		for (int i = 0; i < p_count; i++) {
+			r_values[i] = _noise.GetNoise(p_x + i, p_y);
+		}
+	}
+}
+
+void FastNoiseLite::get_noise_3d_row(real_t p_x, real_t p_y, real_t p_z, int p_count, real_t *r_values) const {
+	p_x += offset.x;
+	p_y += offset.y;
+	p_z += offset.z;
+	if (domain_warp_enabled) {
+		for (int i = 0; i < p_count; i++) {
+			real_t x = p_x + i;
+			real_t y = p_y;
+			real_t z = p_z;
+			_domain_warp_noise.DomainWarp(x, y, z);
+			r_values[i] = _noise.GetNoise(x, y, z);
+		}
+	} else {
+		for (int i = 0; i < p_count; i++) {
+			r_values[i] = _noise.GetNoise(p_x + i, p_y, p_z);
+		}
+	}
+}
+
 void FastNoiseLite::_changed() {
 	emit_changed();
 }
@@ -30,6 +30,21 @@
 
 #include "noise.h"
 
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
+
+void Noise::get_noise_2d_row(real_t p_x, real_t p_y, int p_count, real_t *r_values) const {
+	for (int i = 0; i < p_count; i++) {
+		r_values[i] = get_noise_2d(p_x + i, p_y);
+	}
+}
+
+void Noise::get_noise_3d_row(real_t p_x, real_t p_y, real_t p_z, int p_count, real_t *r_values) const {
+	for (int i = 0; i < p_count; i++) {
+		r_values[i] = get_noise_3d(p_x + i, p_y, p_z);
+	}
+}
+
 Ref<Image> Noise::get_seamless_image(int p_width, int p_height, bool p_invert, bool p_in_3d_space, real_t p_blend_skirt) const {
 	ERR_FAIL_COND_V(p_width <= 0 || p_height <= 0, Ref<Image>());
 
@@ -64,44 +79,64 @@ Ref<Image> Noise::get_image(int p_width, int p_height, bool p_invert, bool p_in_
 
 	uint8_t *wd8 = data.ptrw();
 
-	// Get all values and identify min/max values.
-	Vector<real_t> values;
+	// Get all values and identify min/max values, one row per task.
+	LocalVector<real_t> values;
 	values.resize(p_width * p_height);
+	LocalVector<real_t> row_min;
+	row_min.resize(p_height);
+	LocalVector<real_t> row_max;
+	row_max.resize(p_height);
+
+	ImageRows rows;
+	rows.values = values.ptr();
+	rows.row_min = row_min.ptr();
+	rows.row_max = row_max.ptr();
+	rows.width = p_width;
+	rows.in_3d_space = p_in_3d_space;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Noise::_sample_image_row, &rows, p_height, -1, true, SNAME("NoiseImageRows"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
 	real_t min_val = 1000;
 	real_t max_val = -1000;
-
-	for (int y = 0, i = 0; y < p_height; y++) {
-		for (int x = 0; x < p_width; x++, i++) {
-			values.set(i, p_in_3d_space ? get_noise_3d(x, y, 0.0) : get_noise_2d(x, y));
-			if (values[i] > max_val) {
-				max_val = values[i];
-			}
-			if (values[i] < min_val) {
-				min_val = values[i];
-			}
-		}
+	for (int y = 0; y < p_height; y++) {
+		min_val = MIN(min_val, row_min[y]);
+		max_val = MAX(max_val, row_max[y]);
 	}
 
 	// Normalize values and write to texture.
-	uint8_t value;
-	for (int i = 0, x = 0; i < p_height; i++) {
-		for (int j = 0; j < p_width; j++, x++) {
-			if (max_val == min_val) {
-				value = 0;
-			} else {
-				value = uint8_t(CLAMP((values[x] - min_val) / (max_val - min_val) * 255.f, 0, 255));
-			}
-			if (p_invert) {
-				value = 255 - value;
-			}
-
-			wd8[x] = value;
+	const int pixel_count = p_width * p_height;
+	if (max_val == min_val) {
+		memset(wd8, p_invert ? 255 : 0, pixel_count);
+	} else {
+		const real_t scale = 255.f / (max_val - min_val);
+		for (int i = 0; i < pixel_count; i++) {
+			uint8_t value = uint8_t(CLAMP((values[i] - min_val) * scale, 0, 255));
+			wd8[i] = p_invert ? 255 - value : value;
 		}
 	}
 
 	return memnew(Image(p_width, p_height, false, Image::FORMAT_L8, data));
 }
 
+void Noise::_sample_image_row(uint32_t p_row, ImageRows *p_rows) const {
+	real_t *row = p_rows->values + p_row * p_rows->width;
+	if (p_rows->in_3d_space) {
+		get_noise_3d_row(0.0, p_row, 0.0, p_rows->width, row);
+	} else {
+		get_noise_2d_row(0.0, p_row, p_rows->width, row);
+	}
+
+	real_t min_val = 1000;
+	real_t max_val = -1000;
+	for (int x = 0; x < p_rows->width; x++) {
+		min_val = MIN(min_val, row[x]);
+		max_val = MAX(max_val, row[x]);
+	}
+	p_rows->row_min[p_row] = min_val;
+	p_rows->row_max[p_row] = max_val;
+}
+
 void Noise::_bind_methods() {
 	// Noise functions.
 	ClassDB::bind_method(D_METHOD("get_noise_1d", "x"), &Noise::get_noise_1d);
@@ -218,6 +218,16 @@ class Noise : public Resource {
 		return out.l;
 	}
 
+	// Shared state of the rows of get_image() sampled on the WorkerThreadPool.
+	struct ImageRows {
+		real_t *values = nullptr;
+		real_t *row_min = nullptr;
+		real_t *row_max = nullptr;
+		int width = 0;
+		bool in_3d_space = false;
+	};
+	void _sample_image_row(uint32_t p_row, ImageRows *p_rows) const;
+
 protected:
 	static void _bind_methods();
 
@@ -233,6 +243,11 @@ public:
 	virtual real_t get_noise_3dv(Vector3 p_v) const = 0;
 	virtual real_t get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const = 0;
 
+	// Sample p_count points one unit apart along the X axis, starting at the given position.
+	// Implementations can override these to avoid the per-point virtual call.
+	virtual void get_noise_2d_row(real_t p_x, real_t p_y, int p_count, real_t *r_values) const;
+	virtual void get_noise_3d_row(real_t p_x, real_t p_y, real_t p_z, int p_count, real_t *r_values) const;
+
 	virtual Ref<Image> get_image(int p_width, int p_height, bool p_invert = false, bool p_in_3d_space = false) const;
 	virtual Ref<Image> get_seamless_image(int p_width, int p_height, bool p_invert = false, bool p_in_3d_space = false, real_t p_blend_skirt = 0.1) const;
 };
@@ -34,6 +34,7 @@
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/os/memory.h"
+#include "core/os/os.h"
 #include "core/version.h"
 
 #ifdef TOOLS_ENABLED
@@ -813,6 +814,8 @@ bool OpenXRAPI::create_swapchains() {
 };
 
 void OpenXRAPI::destroy_session() {
+	_stop_wait_frame_thread();
+
 	if (running && session != XR_NULL_HANDLE) {
 		xrEndSession(session);
 	}
@@ -1028,6 +1031,8 @@ bool OpenXRAPI::on_state_stopping() {
 		wrapper->on_state_stopping();
 	}
 
+	_stop_wait_frame_thread();
+
 	if (running) {
 		XrResult result = xrEndSession(session);
 		if (XR_FAILED(result)) {
@@ -1584,55 +1589,81 @@ bool OpenXRAPI::release_image(OpenXRSwapChainInfo &p_swapchain) {
 	return true;
 }
 
-void OpenXRAPI::pre_render() {
-	ERR_FAIL_COND(instance == XR_NULL_HANDLE);
+void OpenXRAPI::_wait_frame_thread_func(void *p_userdata) {
+	OpenXRAPI *openxr_api = (OpenXRAPI *)p_userdata;
 
-	if (!running) {
-		return;
+	while (true) {
+		openxr_api->wait_frame_request.wait();
+		if (openxr_api->wait_frame_exit.is_set()) {
+			break;
+		}
+
+		XrFrameWaitInfo frame_wait_info = { XR_TYPE_FRAME_WAIT_INFO, nullptr };
+		openxr_api->next_frame_state.predictedDisplayTime = 0;
+		openxr_api->next_frame_state.predictedDisplayPeriod = 0;
+		openxr_api->next_frame_state.shouldRender = false;
+		openxr_api->next_frame_result = openxr_api->xrWaitFrame(openxr_api->session, &frame_wait_info, &openxr_api->next_frame_state);
+
+		openxr_api->wait_frame_done.post();
 	}
+}
 
-	// Waitframe does 2 important things in our process:
-	// 1) It provides us with predictive timing, telling us when OpenXR expects to display the frame we're about to commit
-	// 2) It will use the previous timing to pause our thread so that rendering starts as close to displaying as possible
-	// This must thus be called as close to when we start rendering as possible
-	XrFrameWaitInfo frame_wait_info = { XR_TYPE_FRAME_WAIT_INFO, nullptr };
-	frame_state.predictedDisplayTime = 0;
-	frame_state.predictedDisplayPeriod = 0;
-	frame_state.shouldRender = false;
+void OpenXRAPI::_request_wait_frame() {
+	// xrWaitFrame may only be called again once the previous frame has begun.
+	if (!pipelined_frame_wait || wait_frame_pending || !frame_begun) {
+		return;
+	}
 
-	XrResult result = xrWaitFrame(session, &frame_wait_info, &frame_state);
-	if (XR_FAILED(result)) {
-		print_line("OpenXR: xrWaitFrame() was not successful [", get_error_string(result), "]");
+	if (!wait_frame_thread.is_started()) {
+		wait_frame_exit.clear();
+		wait_frame_thread.start(_wait_frame_thread_func, this);
+	}
 
-		// reset just in case
-		frame_state.predictedDisplayTime = 0;
-		frame_state.predictedDisplayPeriod = 0;
-		frame_state.shouldRender = false;
+	wait_frame_pending = true;
+	wait_frame_request.post();
+}
 
+void OpenXRAPI::_stop_wait_frame_thread() {
+	if (!wait_frame_thread.is_started()) {
 		return;
 	}
 
-	if (frame_state.predictedDisplayPeriod > 500000000) {
-		// display period more then 0.5 seconds? must be wrong data
-		print_verbose(String("OpenXR resetting invalid display period ") + rtos(frame_state.predictedDisplayPeriod));
-		frame_state.predictedDisplayPeriod = 0;
+	if (wait_frame_pending) {
+		wait_frame_done.wait();
+		wait_frame_pending = false;
 	}
 
-	for (OpenXRExtensionWrapper *wrapper : registered_extension_wrappers) {
-		wrapper->on_pre_render();
-	}
+	wait_frame_exit.set();
+	wait_frame_request.post();
+	wait_frame_thread.wait_to_finish();
+}
 
-	// Get our view info for the frame we're about to render, note from the OpenXR manual:
-	// "Repeatedly calling xrLocateViews with the same time may not necessarily return the same result. Instead the prediction gets increasingly accurate as the function is called closer to the given time for which a prediction is made"
+XrResult OpenXRAPI::_wait_frame() {
+	uint64_t wait_begin = OS::get_singleton()->get_ticks_usec();
+	XrResult result;
+
+	if (wait_frame_pending) {
+		// Started when the previous frame ended, collect the result.
+		wait_frame_done.wait();
+		wait_frame_pending = false;
 
-	// We're calling this "relatively" early, the positioning we're obtaining here will be used to do our frustum culling,
-	// occlusion culling, etc. There is however a technique that we can investigate in the future where after our entire
-	// Vulkan command buffer is build, but right before vkSubmitQueue is called, we call xrLocateViews one more time and
-	// update the view and projection matrix once more with a slightly more accurate predication and then submit the
-	// command queues.
+		frame_state = next_frame_state;
+		result = next_frame_result;
+	} else {
+		XrFrameWaitInfo frame_wait_info = { XR_TYPE_FRAME_WAIT_INFO, nullptr };
+		frame_state.predictedDisplayTime = 0;
+		frame_state.predictedDisplayPeriod = 0;
+		frame_state.shouldRender = false;
 
-	// That is not possible yet but worth investigating in the future.
+		result = xrWaitFrame(session, &frame_wait_info, &frame_state);
+	}
+
+	frame_timing.wait_frame_usec = OS::get_singleton()->get_ticks_usec() - wait_begin;
 
+	return result;
+}
+
+bool OpenXRAPI::_locate_views(bool p_update_pose_valid) {
 	XrViewLocateInfo view_locate_info = {
 		XR_TYPE_VIEW_LOCATE_INFO, // type
 		nullptr, // next
@@ -1646,10 +1677,16 @@ void OpenXRAPI::pre_render() {
 		0 // viewStateFlags
 	};
 	uint32_t view_count_output;
-	result = xrLocateViews(session, &view_locate_info, &view_state, view_count, &view_count_output, views);
+	XrResult result = xrLocateViews(session, &view_locate_info, &view_state, view_count, &view_count_output, views);
 	if (XR_FAILED(result)) {
 		print_line("OpenXR: Couldn't locate views [", get_error_string(result), "]");
-		return;
+		return false;
+	}
+
+	frame_timing.views_located_ticks = OS::get_singleton()->get_ticks_usec();
+
+	if (!p_update_pose_valid) {
+		return true;
 	}
 
 	bool pose_valid = true;
@@ -1668,6 +1705,62 @@ void OpenXRAPI::pre_render() {
 		}
 	}
 
+	return true;
+}
+
+void OpenXRAPI::pre_render() {
+	ERR_FAIL_COND(instance == XR_NULL_HANDLE);
+
+	if (!running) {
+		return;
+	}
+
+	frame_begun = false;
+
+	// Waitframe does 2 important things in our process:
+	// 1) It provides us with predictive timing, telling us when OpenXR expects to display the frame we're about to commit
+	// 2) It will use the previous timing to pause our thread so that rendering starts as close to displaying as possible
+	// This must thus be called as close to when we start rendering as possible
+	// With pipelined frame wait it was already started on its own thread when the previous frame ended.
+	XrResult result = _wait_frame();
+	if (XR_FAILED(result)) {
+		print_line("OpenXR: xrWaitFrame() was not successful [", get_error_string(result), "]");
+
+		// reset just in case
+		frame_state.predictedDisplayTime = 0;
+		frame_state.predictedDisplayPeriod = 0;
+		frame_state.shouldRender = false;
+
+		return;
+	}
+
+	if (frame_state.predictedDisplayPeriod > 500000000) {
+		// display period more then 0.5 seconds? must be wrong data
+		print_verbose(String("OpenXR resetting invalid display period ") + rtos(frame_state.predictedDisplayPeriod));
+		frame_state.predictedDisplayPeriod = 0;
+	}
+
+	if (frame_timing.last_predicted_display_time != 0 && frame_state.predictedDisplayPeriod > 0) {
+		XrTime elapsed = frame_state.predictedDisplayTime - frame_timing.last_predicted_display_time;
+		if (elapsed > frame_state.predictedDisplayPeriod * 3 / 2) {
+			frame_timing.missed_frames += (elapsed + frame_state.predictedDisplayPeriod / 2) / frame_state.predictedDisplayPeriod - 1;
+		}
+	}
+	frame_timing.last_predicted_display_time = frame_state.predictedDisplayTime;
+
+	for (OpenXRExtensionWrapper *wrapper : registered_extension_wrappers) {
+		wrapper->on_pre_render();
+	}
+
+	// Get our view info for the frame we're about to render, note from the OpenXR manual:
+	// "Repeatedly calling xrLocateViews with the same time may not necessarily return the same result. Instead the prediction gets increasingly accurate as the function is called closer to the given time for which a prediction is made"
+
+	// We're calling this "relatively" early, the positioning we're obtaining here is used when the XR viewport isn't drawn.
+	// The views are located again in pre_draw_viewport, right before the XR viewport is culled and rendered.
+	if (!_locate_views(true)) {
+		return;
+	}
+
 	// let's start our frame..
 	XrFrameBeginInfo frame_begin_info = {
 		XR_TYPE_FRAME_BEGIN_INFO, // type
@@ -1678,6 +1771,8 @@ void OpenXRAPI::pre_render() {
 		print_line("OpenXR: failed to being frame [", get_error_string(result), "]");
 		return;
 	}
+
+	frame_begun = true;
 }
 
 bool OpenXRAPI::pre_draw_viewport(RID p_render_target) {
@@ -1687,6 +1782,11 @@ bool OpenXRAPI::pre_draw_viewport(RID p_render_target) {
 
 	// TODO: at some point in time we may support multiple viewports in which case we need to handle that...
 
+	// Late-latch our views, the closer to the display time we locate them the more accurate the prediction.
+	// The same views are used for culling, rendering and submitting the frame, so they stay consistent.
+	// On failure we keep the views located in pre_render.
+	_locate_views(false);
+
 	// Acquire our images
 	for (int i = 0; i < OPENXR_SWAPCHAIN_MAX; i++) {
 		if (!swapchains[i].image_acquired && swapchains[i].swapchain != XR_NULL_HANDLE) {
@@ -1752,6 +1852,7 @@ void OpenXRAPI::end_frame() {
 			nullptr // layers
 		};
 		result = xrEndFrame(session, &frame_end_info);
+		_request_wait_frame();
 		if (XR_FAILED(result)) {
 			print_line("OpenXR: failed to end frame! [", get_error_string(result), "]");
 			return;
@@ -1804,12 +1905,24 @@ void OpenXRAPI::end_frame() {
 		layers_list.ptr() // layers
 	};
 	result = xrEndFrame(session, &frame_end_info);
+	frame_timing.pose_to_submit_usec = OS::get_singleton()->get_ticks_usec() - frame_timing.views_located_ticks;
+	_request_wait_frame();
 	if (XR_FAILED(result)) {
 		print_line("OpenXR: failed to end frame! [", get_error_string(result), "]");
 		return;
 	}
 }
 
+Dictionary OpenXRAPI::get_frame_timing() const {
+	Dictionary timing;
+	timing["predicted_display_time"] = frame_state.predictedDisplayTime;
+	timing["predicted_display_period"] = frame_state.predictedDisplayPeriod;
+	timing["wait_frame_usec"] = frame_timing.wait_frame_usec;
+	timing["pose_to_submit_usec"] = frame_timing.pose_to_submit_usec;
+	timing["missed_frames"] = frame_timing.missed_frames;
+	return timing;
+}
+
 float OpenXRAPI::get_display_refresh_rate() const {
 	OpenXRDisplayRefreshRateExtension *drrext = OpenXRDisplayRefreshRateExtension::get_singleton();
 	if (drrext) {
@@ -1889,6 +2002,7 @@ OpenXRAPI::OpenXRAPI() {
 		}
 
 		submit_depth_buffer = GLOBAL_GET("xr/openxr/submit_depth_buffer");
+		pipelined_frame_wait = GLOBAL_GET("xr/openxr/pipelined_frame_wait");
 	}
 
 	// reset a few things that can't be done in our class definition
@@ -36,11 +36,15 @@
 #include "core/math/transform_3d.h"
 #include "core/math/vector2.h"
 #include "core/os/memory.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
 #include "core/string/print_string.h"
 #include "core/string/ustring.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/rid_owner.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/vector.h"
+#include "core/variant/dictionary.h"
 #include "servers/xr/xr_pose.h"
 
 #include "thirdparty/openxr/src/common/xr_linear.h"
@@ -105,6 +109,7 @@ private:
 	XrReferenceSpaceType reference_space = XR_REFERENCE_SPACE_TYPE_STAGE;
 	// XrEnvironmentBlendMode environment_blend_mode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
 	bool submit_depth_buffer = false; // if set to true we submit depth buffers to OpenXR if a suitable extension is enabled.
+	bool pipelined_frame_wait = false; // if set to true xrWaitFrame for the next frame runs on its own thread as soon as a frame ends.
 
 	// state
 	XrInstance instance = XR_NULL_HANDLE;
@@ -116,6 +121,32 @@ private:
 	XrSessionState session_state = XR_SESSION_STATE_UNKNOWN;
 	bool running = false;
 	XrFrameState frame_state = { XR_TYPE_FRAME_STATE, NULL, 0, 0, false };
+	bool frame_begun = false;
+
+	// Pipelined frame wait, the thread waits for the next frame while the main thread processes it.
+	Thread wait_frame_thread;
+	Semaphore wait_frame_request;
+	Semaphore wait_frame_done;
+	SafeFlag wait_frame_exit;
+	bool wait_frame_pending = false;
+	XrFrameState next_frame_state = { XR_TYPE_FRAME_STATE, NULL, 0, 0, false };
+	XrResult next_frame_result = XR_SUCCESS;
+
+	static void _wait_frame_thread_func(void *p_userdata);
+	void _request_wait_frame();
+	void _stop_wait_frame_thread();
+	XrResult _wait_frame();
+
+	// Frame timing statistics, see get_frame_timing().
+	struct FrameTiming {
+		uint64_t wait_frame_usec = 0; // Time pre_render was blocked waiting for the frame.
+		uint64_t pose_to_submit_usec = 0; // Time between the last view locate and xrEndFrame.
+		uint64_t missed_frames = 0; // Display periods skipped between predicted display times.
+		XrTime last_predicted_display_time = 0;
+		uint64_t views_located_ticks = 0;
+	} frame_timing;
+
+	bool _locate_views(bool p_update_pose_valid);
 
 	OpenXRGraphicsExtensionWrapper *graphics_extension = nullptr;
 	XrSystemGraphicsProperties graphics_properties;
@@ -348,6 +379,8 @@ public:
 	void post_draw_viewport(RID p_render_target);
 	void end_frame();
 
+	Dictionary get_frame_timing() const;
+
 	// Display refresh rate
 	float get_display_refresh_rate() const;
 	void set_display_refresh_rate(float p_refresh_rate);
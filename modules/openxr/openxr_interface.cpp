@@ -48,6 +48,9 @@ void OpenXRInterface::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "display_refresh_rate"), "set_display_refresh_rate", "get_display_refresh_rate");
 
 	ClassDB::bind_method(D_METHOD("get_available_display_refresh_rates"), &OpenXRInterface::get_available_display_refresh_rates);
+
+	// Frame timing
+	ClassDB::bind_method(D_METHOD("get_frame_timing"), &OpenXRInterface::get_frame_timing);
 }
 
 StringName OpenXRInterface::get_name() const {
@@ -621,6 +624,16 @@ Array OpenXRInterface::get_available_display_refresh_rates() const {
 	}
 }
 
+Dictionary OpenXRInterface::get_frame_timing() const {
+	if (openxr_api == nullptr) {
+		return Dictionary();
+	} else if (!openxr_api->is_initialized()) {
+		return Dictionary();
+	} else {
+		return openxr_api->get_frame_timing();
+	}
+}
+
 Size2 OpenXRInterface::get_render_target_size() {
 	if (openxr_api == nullptr) {
 		return Size2();
@@ -154,8 +154,22 @@ void RegExMatch::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "strings"), "", "get_strings");
 }
 
+RegEx::CompiledCode::~CompiledCode() {
+	if (code) {
+		pcre2_code_free_32((pcre2_code_32 *)code);
+	}
+}
+
+Mutex RegEx::code_cache_mutex;
+LRUCache<String, Ref<RegEx::CompiledCode>> RegEx::code_cache(RegEx::CODE_CACHE_SIZE);
+
+void RegEx::clear_code_cache() {
+	MutexLock lock(code_cache_mutex);
+	code_cache.clear();
+}
+
 void RegEx::_pattern_info(uint32_t what, void *where) const {
-	pcre2_pattern_info_32((pcre2_code_32 *)code, what, where);
+	pcre2_pattern_info_32((pcre2_code_32 *)compiled->code, what, where);
 }
 
 Ref<RegEx> RegEx::create_from_string(const String &p_pattern) {
@@ -166,16 +180,22 @@ Ref<RegEx> RegEx::create_from_string(const String &p_pattern) {
 }
 
 void RegEx::clear() {
-	if (code) {
-		pcre2_code_free_32((pcre2_code_32 *)code);
-		code = nullptr;
-	}
+	compiled.unref();
 }
 
 Error RegEx::compile(const String &p_pattern) {
 	pattern = p_pattern;
 	clear();
 
+	{
+		MutexLock lock(code_cache_mutex);
+		const Ref<CompiledCode> *cached = code_cache.getptr(pattern);
+		if (cached) {
+			compiled = *cached;
+			return OK;
+		}
+	}
+
 	int err;
 	PCRE2_SIZE offset;
 	uint32_t flags = PCRE2_DUPNAMES;
@@ -184,47 +204,43 @@ Error RegEx::compile(const String &p_pattern) {
 	pcre2_compile_context_32 *cctx = pcre2_compile_context_create_32(gctx);
 	PCRE2_SPTR32 p = (PCRE2_SPTR32)pattern.get_data();
 
-	code = pcre2_compile_32(p, pattern.length(), flags, &err, &offset, cctx);
+	pcre2_code_32 *c = pcre2_compile_32(p, pattern.length(), flags, &err, &offset, cctx);
 
 	pcre2_compile_context_free_32(cctx);
 
-	if (!code) {
+	if (!c) {
 		PCRE2_UCHAR32 buf[256];
 		pcre2_get_error_message_32(err, buf, 256);
 		String message = String::num(offset) + ": " + String((const char32_t *)buf);
 		ERR_PRINT(message.utf8());
 		return FAILED;
 	}
-	return OK;
-}
 
-Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end) const {
-	ERR_FAIL_COND_V(!is_valid(), nullptr);
-	ERR_FAIL_COND_V_MSG(p_offset < 0, nullptr, "RegEx search offset must be >= 0");
+	// Matching falls back to the interpreter if JIT is not supported on this platform.
+	pcre2_jit_compile_32(c, PCRE2_JIT_COMPLETE);
 
-	Ref<RegExMatch> result = memnew(RegExMatch);
+	compiled.instantiate();
+	compiled->code = c;
 
-	int length = p_subject.length();
-	if (p_end >= 0 && p_end < length) {
-		length = p_end;
-	}
+	MutexLock lock(code_cache_mutex);
+	code_cache.insert(pattern, compiled);
 
-	pcre2_code_32 *c = (pcre2_code_32 *)code;
-	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
-	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
-	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
+	return OK;
+}
 
-	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
+Ref<RegExMatch> RegEx::_search(const String &p_subject, int p_offset, int p_length, void *p_match_data, void *p_match_ctx) const {
+	pcre2_code_32 *c = (pcre2_code_32 *)compiled->code;
+	pcre2_match_data_32 *match = (pcre2_match_data_32 *)p_match_data;
+	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 
-	int res = pcre2_match_32(c, s, length, p_offset, 0, match, mctx);
+	int res = pcre2_match_32(c, s, p_length, p_offset, 0, match, (pcre2_match_context_32 *)p_match_ctx);
 
 	if (res < 0) {
-		pcre2_match_data_free_32(match);
-		pcre2_match_context_free_32(mctx);
-
 		return nullptr;
 	}
 
+	Ref<RegExMatch> result = memnew(RegExMatch);
+
 	uint32_t size = pcre2_get_ovector_count_32(match);
 	PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_32(match);
 
@@ -235,9 +251,6 @@ Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end)
 		result->data.write[i].end = ovector[i * 2 + 1];
 	}
 
-	pcre2_match_data_free_32(match);
-	pcre2_match_context_free_32(mctx);
-
 	result->subject = p_subject;
 
 	uint32_t count;
@@ -264,20 +277,93 @@ Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end)
 	return result;
 }
 
+Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end) const {
+	ERR_FAIL_COND_V(!is_valid(), nullptr);
+	ERR_FAIL_COND_V_MSG(p_offset < 0, nullptr, "RegEx search offset must be >= 0");
+
+	int length = p_subject.length();
+	if (p_end >= 0 && p_end < length) {
+		length = p_end;
+	}
+
+	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
+	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
+	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32((pcre2_code_32 *)compiled->code, gctx);
+
+	Ref<RegExMatch> result = _search(p_subject, p_offset, length, match, mctx);
+
+	pcre2_match_data_free_32(match);
+	pcre2_match_context_free_32(mctx);
+
+	return result;
+}
+
 TypedArray<RegExMatch> RegEx::search_all(const String &p_subject, int p_offset, int p_end) const {
+	ERR_FAIL_COND_V(!is_valid(), Array());
 	ERR_FAIL_COND_V_MSG(p_offset < 0, Array(), "RegEx search offset must be >= 0");
 
+	int length = p_subject.length();
+	if (p_end >= 0 && p_end < length) {
+		length = p_end;
+	}
+
+	// The match data is reused for every match.
+	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
+	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
+	pcre2_match_data_32 *match_data = pcre2_match_data_create_from_pattern_32((pcre2_code_32 *)compiled->code, gctx);
+
 	int last_end = -1;
 	TypedArray<RegExMatch> result;
-	Ref<RegExMatch> match = search(p_subject, p_offset, p_end);
+	Ref<RegExMatch> match = _search(p_subject, p_offset, length, match_data, mctx);
 	while (match.is_valid()) {
 		if (last_end == match->get_end(0)) {
 			break;
 		}
 		result.push_back(match);
 		last_end = match->get_end(0);
-		match = search(p_subject, match->get_end(0), p_end);
+		match = _search(p_subject, match->get_end(0), length, match_data, mctx);
+	}
+
+	pcre2_match_data_free_32(match_data);
+	pcre2_match_context_free_32(mctx);
+
+	return result;
+}
+
+PackedStringArray RegEx::search_all_strings(const String &p_subject, int p_offset, int p_end) const {
+	PackedStringArray result;
+
+	ERR_FAIL_COND_V(!is_valid(), result);
+	ERR_FAIL_COND_V_MSG(p_offset < 0, result, "RegEx search offset must be >= 0");
+
+	int length = p_subject.length();
+	if (p_end >= 0 && p_end < length) {
+		length = p_end;
+	}
+
+	pcre2_code_32 *c = (pcre2_code_32 *)compiled->code;
+	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
+	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
+	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
+	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
+	PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_32(match);
+
+	int offset = p_offset;
+	int last_end = -1;
+	while (pcre2_match_32(c, s, length, offset, 0, match, mctx) >= 0) {
+		int start = ovector[0];
+		int end = ovector[1];
+		if (last_end == end) {
+			break;
+		}
+		result.push_back(p_subject.substr(start, end - start));
+		last_end = end;
+		offset = end;
 	}
+
+	pcre2_match_data_free_32(match);
+	pcre2_match_context_free_32(mctx);
+
 	return result;
 }
 
@@ -305,7 +391,7 @@ String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_a
 		length = p_end;
 	}
 
-	pcre2_code_32 *c = (pcre2_code_32 *)code;
+	pcre2_code_32 *c = (pcre2_code_32 *)compiled->code;
 	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
 	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
 	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
@@ -333,7 +419,7 @@ String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_a
 }
 
 bool RegEx::is_valid() const {
-	return (code != nullptr);
+	return compiled.is_valid();
 }
 
 String RegEx::get_pattern() const {
@@ -383,9 +469,6 @@ RegEx::RegEx(const String &p_pattern) {
 }
 
 RegEx::~RegEx() {
-	if (code) {
-		pcre2_code_free_32((pcre2_code_32 *)code);
-	}
 	pcre2_general_context_free_32((pcre2_general_context_32 *)general_ctx);
 }
 
@@ -396,6 +479,7 @@ void RegEx::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("compile", "pattern"), &RegEx::compile);
 	ClassDB::bind_method(D_METHOD("search", "subject", "offset", "end"), &RegEx::search, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("search_all", "subject", "offset", "end"), &RegEx::search_all, DEFVAL(0), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("search_all_strings", "subject", "offset", "end"), &RegEx::search_all_strings, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("sub", "subject", "replacement", "all", "offset", "end"), &RegEx::sub, DEFVAL(false), DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("is_valid"), &RegEx::is_valid);
 	ClassDB::bind_method(D_METHOD("get_pattern"), &RegEx::get_pattern);
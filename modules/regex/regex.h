@@ -32,7 +32,9 @@
 #define REGEX_H
 
 #include "core/object/ref_counted.h"
+#include "core/os/mutex.h"
 #include "core/string/ustring.h"
+#include "core/templates/lru.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/vector.h"
 #include "core/variant/array.h"
@@ -72,11 +74,25 @@ public:
 class RegEx : public RefCounted {
 	GDCLASS(RegEx, RefCounted);
 
+	// Compiled patterns are immutable, so they are JIT-compiled once and shared by every RegEx using the same pattern.
+	struct CompiledCode : public RefCounted {
+		void *code = nullptr;
+		~CompiledCode();
+	};
+
+	enum {
+		CODE_CACHE_SIZE = 512,
+	};
+
+	static Mutex code_cache_mutex;
+	static LRUCache<String, Ref<CompiledCode>> code_cache;
+
 	void *general_ctx = nullptr;
-	void *code = nullptr;
+	Ref<CompiledCode> compiled;
 	String pattern;
 
 	void _pattern_info(uint32_t what, void *where) const;
+	Ref<RegExMatch> _search(const String &p_subject, int p_offset, int p_length, void *p_match_data, void *p_match_ctx) const;
 
 protected:
 	static void _bind_methods();
@@ -89,6 +105,7 @@ public:
 
 	Ref<RegExMatch> search(const String &p_subject, int p_offset = 0, int p_end = -1) const;
 	TypedArray<RegExMatch> search_all(const String &p_subject, int p_offset = 0, int p_end = -1) const;
+	PackedStringArray search_all_strings(const String &p_subject, int p_offset = 0, int p_end = -1) const;
 	String sub(const String &p_subject, const String &p_replacement, bool p_all = false, int p_offset = 0, int p_end = -1) const;
 
 	bool is_valid() const;
@@ -96,6 +113,8 @@ public:
 	int get_group_count() const;
 	PackedStringArray get_names() const;
 
+	static void clear_code_cache();
+
 	RegEx();
 	RegEx(const String &p_pattern);
 	~RegEx();
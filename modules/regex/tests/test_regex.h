@@ -95,10 +95,31 @@ TEST_CASE("[RegEx] Searching") {
 	REQUIRE(match != nullptr);
 	CHECK(match->get_string(0) == "i");
 
+	const PackedStringArray all_strings = re.search_all_strings(s);
+	REQUIRE(all_strings.size() == 2);
+	CHECK(all_strings[0] == "ea");
+	CHECK(all_strings[1] == "i");
+
 	CHECK(re.compile(numerics) == OK);
 	CHECK(re.is_valid());
 	CHECK(re.search(s) == nullptr);
 	CHECK(re.search_all(s).size() == 0);
+	CHECK(re.search_all_strings(s).size() == 0);
+}
+
+TEST_CASE("[RegEx] Shared compiled pattern") {
+	const String s = "Searching";
+
+	RegEx re1("[aeiou]{1,2}");
+	RegEx re2("[aeiou]{1,2}");
+	REQUIRE(re1.is_valid());
+	REQUIRE(re2.is_valid());
+
+	re1.clear();
+	CHECK(!re1.is_valid());
+	REQUIRE(re2.is_valid());
+	CHECK(re2.search_all(s).size() == 2);
+	CHECK(re2.search(s, 2)->get_string(0) == "a");
 }
 
 TEST_CASE("[RegEx] Substitution") {
@@ -116,6 +137,7 @@ TEST_CASE("[RegEx] Uninitialized use") {
 	ERR_PRINT_OFF;
 	CHECK(re.search(s) == nullptr);
 	CHECK(re.search_all(s).size() == 0);
+	CHECK(re.search_all_strings(s).size() == 0);
 	CHECK(re.sub(s, "") == "");
 	CHECK(re.get_group_count() == 0);
 	CHECK(re.get_names().size() == 0);
@@ -385,6 +385,7 @@ void TextServerAdvanced::_free_rid(const RID &p_rid) {
 	_THREAD_SAFE_METHOD_
 	if (font_owner.owns(p_rid)) {
 		FontAdvanced *fd = font_owner.get_or_null(p_rid);
+		font_prefetch_wait(); // Prefetch tasks hold the font data.
 		font_owner.free(p_rid);
 		memdelete(fd);
 	} else if (shaped_owner.owns(p_rid)) {
@@ -1820,6 +1821,9 @@ _FORCE_INLINE_ void TextServerAdvanced::_font_clear_cache(FontAdvanced *p_font_d
 	p_font_data->supported_features.clear();
 	p_font_data->supported_varaitions.clear();
 	p_font_data->supported_scripts.clear();
+
+	// Cached shaping results only know the font RID, drop them all when any font changes.
+	shaping_cache_clear();
 }
 
 hb_font_t *TextServerAdvanced::_font_get_hb_handle(const RID &p_font_rid, int64_t p_size) const {
@@ -3164,6 +3168,31 @@ String TextServerAdvanced::_font_get_supported_chars(const RID &p_font_rid) cons
 	return chars;
 }
 
+void TextServerAdvanced::_font_render_char(FontAdvanced *p_font_data, const Vector2i &p_size, int64_t p_char) const {
+#ifdef MODULE_FREETYPE_ENABLED
+	if (p_font_data->cache[p_size]->face) {
+		int32_t idx = FT_Get_Char_Index(p_font_data->cache[p_size]->face, p_char);
+		if (p_font_data->msdf) {
+			_ensure_glyph(p_font_data, p_size, (int32_t)idx);
+		} else {
+			for (int aa = 0; aa < ((p_font_data->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
+				if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
+					_ensure_glyph(p_font_data, p_size, (int32_t)idx | (0 << 27) | (aa << 24));
+					_ensure_glyph(p_font_data, p_size, (int32_t)idx | (1 << 27) | (aa << 24));
+					_ensure_glyph(p_font_data, p_size, (int32_t)idx | (2 << 27) | (aa << 24));
+					_ensure_glyph(p_font_data, p_size, (int32_t)idx | (3 << 27) | (aa << 24));
+				} else if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
+					_ensure_glyph(p_font_data, p_size, (int32_t)idx | (1 << 27) | (aa << 24));
+					_ensure_glyph(p_font_data, p_size, (int32_t)idx | (0 << 27) | (aa << 24));
+				} else {
+					_ensure_glyph(p_font_data, p_size, (int32_t)idx | (aa << 24));
+				}
+			}
+		}
+	}
+#endif
+}
+
 void TextServerAdvanced::_font_render_range(const RID &p_font_rid, const Vector2i &p_size, int64_t p_start, int64_t p_end) {
 	FontAdvanced *fd = font_owner.get_or_null(p_font_rid);
 	ERR_FAIL_COND(!fd);
@@ -3174,29 +3203,83 @@ void TextServerAdvanced::_font_render_range(const RID &p_font_rid, const Vector2
 	Vector2i size = _get_size_outline(fd, p_size);
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 	for (int64_t i = p_start; i <= p_end; i++) {
-#ifdef MODULE_FREETYPE_ENABLED
-		int32_t idx = FT_Get_Char_Index(fd->cache[size]->face, i);
-		if (fd->cache[size]->face) {
-			if (fd->msdf) {
-				_ensure_glyph(fd, size, (int32_t)idx);
-			} else {
-				for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
-					if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (2 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (3 << 27) | (aa << 24));
-					} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-					} else {
-						_ensure_glyph(fd, size, (int32_t)idx | (aa << 24));
-					}
-				}
-			}
+		_font_render_char(fd, size, i);
+	}
+}
+
+void TextServerAdvanced::_font_prefetch_glyphs_threaded(GlyphPrefetchData *p_data) {
+	for (int i = 0; i < p_data->chars.size(); i++) {
+		// Lock per character, so drawing with this font from the main thread never waits long.
+		MutexLock lock(p_data->font_data->mutex);
+		Vector2i size = _get_size_outline(p_data->font_data, p_data->size);
+		if (!_ensure_cache_for_size(p_data->font_data, size)) {
+			break;
+		}
+		_font_render_char(p_data->font_data, size, p_data->chars[i]);
+	}
+	memdelete(p_data);
+}
+
+void TextServerAdvanced::font_prefetch_glyphs(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters) {
+	FontAdvanced *fd = font_owner.get_or_null(p_font_rid);
+	ERR_FAIL_COND(!fd);
+
+	GlyphPrefetchData *data = memnew(GlyphPrefetchData);
+	data->font_data = fd;
+	data->size = p_size;
+
+	HashSet<char32_t> seen;
+	for (int i = 0; i < p_characters.length(); i++) {
+		char32_t c = p_characters[i];
+		if ((c >= 0xd800 && c <= 0xdfff) || (c > 0x10ffff) || is_control(c) || seen.has(c)) {
+			continue;
+		}
+		seen.insert(c);
+		data->chars.push_back(c);
+	}
+
+#ifdef GDEXTENSION
+	_font_prefetch_glyphs_threaded(data);
+#else
+	MutexLock lock(glyph_prefetch_mutex);
+
+	// Release the tasks that are already done.
+	for (uint32_t i = 0; i < glyph_prefetch_tasks.size(); i++) {
+		if (WorkerThreadPool::get_singleton()->is_task_completed(glyph_prefetch_tasks[i])) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(glyph_prefetch_tasks[i]);
+			glyph_prefetch_tasks.remove_at_unordered(i);
+			i--;
 		}
+	}
+
+	glyph_prefetch_tasks.push_back(WorkerThreadPool::get_singleton()->add_template_task(this, &TextServerAdvanced::_font_prefetch_glyphs_threaded, data, false, SNAME("FontServerPrefetchGlyphs")));
 #endif
+}
+
+bool TextServerAdvanced::font_is_prefetching() const {
+#ifndef GDEXTENSION
+	MutexLock lock(glyph_prefetch_mutex);
+	for (uint32_t i = 0; i < glyph_prefetch_tasks.size(); i++) {
+		if (!WorkerThreadPool::get_singleton()->is_task_completed(glyph_prefetch_tasks[i])) {
+			return true;
+		}
 	}
+#endif
+	return false;
+}
+
+void TextServerAdvanced::font_prefetch_wait() {
+#ifndef GDEXTENSION
+	LocalVector<WorkerThreadPool::TaskID> tasks;
+	{
+		MutexLock lock(glyph_prefetch_mutex);
+		tasks = glyph_prefetch_tasks;
+		glyph_prefetch_tasks.clear();
+	}
+	for (uint32_t i = 0; i < tasks.size(); i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+	}
+#endif
 }
 
 void TextServerAdvanced::_font_render_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_index) {
@@ -5124,6 +5207,86 @@ _FORCE_INLINE_ void TextServerAdvanced::_add_featuers(const Dictionary &p_source
 	}
 }
 
+bool TextServerAdvanced::_shaping_cache_get(const ShapingCacheKey &p_key, Vector<hb_glyph_info_t> &r_glyph_info, Vector<hb_glyph_position_t> &r_glyph_pos) const {
+	MutexLock lock(shaping_cache_mutex);
+
+	List<ShapingCacheEntry>::Element **E = shaping_cache.getptr(p_key);
+	if (!E) {
+		shaping_cache_misses++;
+		return false;
+	}
+	shaping_cache_hits++;
+	shaping_cache_lru.move_to_front(*E);
+	// Return copies, the entry can be evicted while the glyphs are processed.
+	r_glyph_info = (*E)->get().glyph_info;
+	r_glyph_pos = (*E)->get().glyph_pos;
+	return true;
+}
+
+void TextServerAdvanced::_shaping_cache_insert(const ShapingCacheKey &p_key, const hb_glyph_info_t *p_glyph_info, const hb_glyph_position_t *p_glyph_pos, unsigned int p_glyph_count) const {
+	MutexLock lock(shaping_cache_mutex);
+
+	if (shaping_cache.has(p_key)) {
+		return;
+	}
+
+	ShapingCacheEntry entry;
+	entry.key = p_key;
+	entry.glyph_info.resize(p_glyph_count);
+	entry.glyph_pos.resize(p_glyph_count);
+	if (p_glyph_count > 0) {
+		memcpy(entry.glyph_info.ptrw(), p_glyph_info, p_glyph_count * sizeof(hb_glyph_info_t));
+		memcpy(entry.glyph_pos.ptrw(), p_glyph_pos, p_glyph_count * sizeof(hb_glyph_position_t));
+	}
+	entry.memory = sizeof(ShapingCacheEntry) + p_key.text.length() * sizeof(char32_t) + p_key.features.size() * sizeof(hb_feature_t) + p_glyph_count * (sizeof(hb_glyph_info_t) + sizeof(hb_glyph_position_t));
+	if (entry.memory > shaping_cache_budget) {
+		return;
+	}
+
+	_shaping_cache_trim(shaping_cache_budget - entry.memory);
+	shaping_cache_memory += entry.memory;
+	shaping_cache[p_key] = shaping_cache_lru.push_front(entry);
+}
+
+void TextServerAdvanced::_shaping_cache_trim(uint64_t p_budget) const {
+	while (shaping_cache_memory > p_budget && shaping_cache_lru.back()) {
+		List<ShapingCacheEntry>::Element *E = shaping_cache_lru.back();
+		shaping_cache_memory -= E->get().memory;
+		shaping_cache.erase(E->get().key);
+		shaping_cache_lru.pop_back();
+	}
+}
+
+void TextServerAdvanced::shaping_cache_set_memory_budget(int64_t p_bytes) {
+	ERR_FAIL_COND(p_bytes < 0);
+
+	MutexLock lock(shaping_cache_mutex);
+	shaping_cache_budget = p_bytes;
+	_shaping_cache_trim(shaping_cache_budget);
+}
+
+int64_t TextServerAdvanced::shaping_cache_get_memory_budget() const {
+	MutexLock lock(shaping_cache_mutex);
+	return shaping_cache_budget;
+}
+
+Dictionary TextServerAdvanced::shaping_cache_get_stats() const {
+	MutexLock lock(shaping_cache_mutex);
+
+	Dictionary stats;
+	stats["entries"] = shaping_cache.size();
+	stats["memory"] = shaping_cache_memory;
+	stats["memory_budget"] = shaping_cache_budget;
+	stats["hits"] = shaping_cache_hits;
+	stats["misses"] = shaping_cache_misses;
+	return stats;
+}
+
+void TextServerAdvanced::shaping_cache_clear() {
+	MutexLock lock(shaping_cache_mutex);
+	_shaping_cache_trim(0);
+}
+
 void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_start, int64_t p_end, hb_script_t p_script, hb_direction_t p_direction, TypedArray<RID> p_fonts, int64_t p_span, int64_t p_fb_index, int64_t p_prev_start, int64_t p_prev_end) {
 	RID f;
 	int fs = p_sd->spans[p_span].font_size;
@@ -5339,8 +5502,6 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 	bool subpos = (scale != 1.0) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_HALF) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_QUARTER) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_AUTO && fs <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE);
 	ERR_FAIL_COND(hb_font == nullptr);
 
-	hb_buffer_clear_contents(p_sd->hb_buffer);
-	hb_buffer_set_direction(p_sd->hb_buffer, p_direction);
 	int flags = (p_start == 0 ? HB_BUFFER_FLAG_BOT : 0) | (p_end == p_sd->text.length() ? HB_BUFFER_FLAG_EOT : 0);
 	if (p_sd->preserve_control) {
 		flags |= HB_BUFFER_FLAG_PRESERVE_DEFAULT_IGNORABLES;
@@ -5350,28 +5511,66 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 #if HB_VERSION_ATLEAST(5, 1, 0)
 	flags |= HB_BUFFER_FLAG_PRODUCE_SAFE_TO_INSERT_TATWEEL;
 #endif
-	hb_buffer_set_flags(p_sd->hb_buffer, (hb_buffer_flags_t)flags);
-	hb_buffer_set_script(p_sd->hb_buffer, p_script);
 
+	hb_language_t lang;
 	if (p_sd->spans[p_span].language.is_empty()) {
-		hb_language_t lang = hb_language_from_string(TranslationServer::get_singleton()->get_tool_locale().ascii().get_data(), -1);
-		hb_buffer_set_language(p_sd->hb_buffer, lang);
+		lang = hb_language_from_string(TranslationServer::get_singleton()->get_tool_locale().ascii().get_data(), -1);
 	} else {
-		hb_language_t lang = hb_language_from_string(p_sd->spans[p_span].language.ascii().get_data(), -1);
-		hb_buffer_set_language(p_sd->hb_buffer, lang);
+		lang = hb_language_from_string(p_sd->spans[p_span].language.ascii().get_data(), -1);
 	}
 
-	hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
-
 	Vector<hb_feature_t> ftrs;
 	_add_featuers(_font_get_opentype_feature_overrides(f), ftrs);
 	_add_featuers(p_sd->spans[p_span].features, ftrs);
 
-	hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
+	// Bitmap fonts are skipped, their advances and kerning can be changed at any time.
+	bool cacheable = false;
+#ifdef MODULE_FREETYPE_ENABLED
+	cacheable = fd->cache[fss]->face != nullptr;
+#endif
+
+	ShapingCacheKey cache_key;
+	if (cacheable) {
+		cache_key.text = p_sd->text;
+		cache_key.start = p_start;
+		cache_key.end = p_end;
+		cache_key.font = f;
+		cache_key.font_size = fs;
+		cache_key.direction = p_direction;
+		cache_key.script = p_script;
+		cache_key.language = lang;
+		cache_key.flags = flags;
+		cache_key.features = ftrs;
+	}
 
 	unsigned int glyph_count = 0;
-	hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
-	hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
+	const hb_glyph_info_t *glyph_info = nullptr;
+	const hb_glyph_position_t *glyph_pos = nullptr;
+
+	Vector<hb_glyph_info_t> cached_glyph_info;
+	Vector<hb_glyph_position_t> cached_glyph_pos;
+	if (cacheable && _shaping_cache_get(cache_key, cached_glyph_info, cached_glyph_pos)) {
+		glyph_count = cached_glyph_info.size();
+		glyph_info = cached_glyph_info.ptr();
+		glyph_pos = cached_glyph_pos.ptr();
+	} else {
+		hb_buffer_clear_contents(p_sd->hb_buffer);
+		hb_buffer_set_direction(p_sd->hb_buffer, p_direction);
+		hb_buffer_set_flags(p_sd->hb_buffer, (hb_buffer_flags_t)flags);
+		hb_buffer_set_script(p_sd->hb_buffer, p_script);
+		hb_buffer_set_language(p_sd->hb_buffer, lang);
+
+		hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
+
+		hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
+
+		glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
+		glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
+
+		if (cacheable) {
+			_shaping_cache_insert(cache_key, glyph_info, glyph_pos, glyph_count);
+		}
+	}
 
 	int mod = 0;
 	if (fd->antialiasing == FONT_ANTIALIASING_LCD) {
@@ -6465,6 +6664,17 @@ bool TextServerAdvanced::_is_valid_identifier(const String &p_string) const {
 	return true;
 }
 
+void TextServerAdvanced::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("shaping_cache_set_memory_budget", "bytes"), &TextServerAdvanced::shaping_cache_set_memory_budget);
+	ClassDB::bind_method(D_METHOD("shaping_cache_get_memory_budget"), &TextServerAdvanced::shaping_cache_get_memory_budget);
+	ClassDB::bind_method(D_METHOD("shaping_cache_get_stats"), &TextServerAdvanced::shaping_cache_get_stats);
+	ClassDB::bind_method(D_METHOD("shaping_cache_clear"), &TextServerAdvanced::shaping_cache_clear);
+
+	ClassDB::bind_method(D_METHOD("font_prefetch_glyphs", "font_rid", "size", "characters"), &TextServerAdvanced::font_prefetch_glyphs);
+	ClassDB::bind_method(D_METHOD("font_is_prefetching"), &TextServerAdvanced::font_is_prefetching);
+	ClassDB::bind_method(D_METHOD("font_prefetch_wait"), &TextServerAdvanced::font_prefetch_wait);
+}
+
 TextServerAdvanced::TextServerAdvanced() {
 	_insert_num_systems_lang();
 	_insert_feature_sets();
@@ -6483,6 +6693,7 @@ void TextServerAdvanced::_cleanup() {
 }
 
 TextServerAdvanced::~TextServerAdvanced() {
+	font_prefetch_wait();
 	_bmp_free_font_funcs();
 #ifdef MODULE_FREETYPE_ENABLED
 	if (ft_library != nullptr) {
@@ -71,6 +71,7 @@
 
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/templates/rid_owner.hpp>
 
 #include <godot_cpp/templates/vector.hpp>
@@ -85,6 +86,8 @@ using namespace godot;
 #include "core/extension/ext_wrappers.gen.inc"
 #include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/list.h"
 #include "core/templates/rid_owner.h"
 #include "scene/resources/texture.h"
 
@@ -603,6 +606,81 @@ class TextServerAdvanced : public TextServerExtension {
 	mutable HashMap<SystemFontKey, SystemFontCache, SystemFontKeyHasher> system_fonts;
 	mutable HashMap<String, PackedByteArray> system_font_data;
 
+	// HarfBuzz output for a run, shared by all the shaped texts that show the same string with the same font.
+	struct ShapingCacheKey {
+		String text; // Whole text, HarfBuzz uses the characters around the run as context.
+		int64_t start = 0;
+		int64_t end = 0;
+		RID font;
+		int64_t font_size = 0;
+		hb_direction_t direction = HB_DIRECTION_INVALID;
+		hb_script_t script = HB_SCRIPT_INVALID;
+		hb_language_t language = HB_LANGUAGE_INVALID;
+		int flags = 0;
+		Vector<hb_feature_t> features;
+
+		bool operator==(const ShapingCacheKey &p_b) const {
+			if (start != p_b.start || end != p_b.end || font != p_b.font || font_size != p_b.font_size || direction != p_b.direction || script != p_b.script || language != p_b.language || flags != p_b.flags || features.size() != p_b.features.size()) {
+				return false;
+			}
+			for (int i = 0; i < features.size(); i++) {
+				if (features[i].tag != p_b.features[i].tag || features[i].value != p_b.features[i].value || features[i].start != p_b.features[i].start || features[i].end != p_b.features[i].end) {
+					return false;
+				}
+			}
+			return text == p_b.text;
+		}
+	};
+
+	struct ShapingCacheKeyHasher {
+		_FORCE_INLINE_ static uint32_t hash(const ShapingCacheKey &p_a) {
+			uint32_t hash = p_a.text.hash();
+			hash = hash_murmur3_one_64(p_a.start, hash);
+			hash = hash_murmur3_one_64(p_a.end, hash);
+			hash = hash_murmur3_one_64(p_a.font.get_id(), hash);
+			hash = hash_murmur3_one_64(p_a.font_size, hash);
+			hash = hash_murmur3_one_64((uint64_t)p_a.language, hash);
+			for (int i = 0; i < p_a.features.size(); i++) {
+				hash = hash_murmur3_one_32(p_a.features[i].tag, hash);
+				hash = hash_murmur3_one_32(p_a.features[i].value, hash);
+			}
+			return hash_fmix32(hash_murmur3_one_32(((uint32_t)p_a.direction) | ((uint32_t)p_a.flags << 8), hash_murmur3_one_32(p_a.script, hash)));
+		}
+	};
+
+	struct ShapingCacheEntry {
+		ShapingCacheKey key;
+		Vector<hb_glyph_info_t> glyph_info;
+		Vector<hb_glyph_position_t> glyph_pos;
+		uint64_t memory = 0;
+	};
+
+	mutable Mutex shaping_cache_mutex;
+	mutable List<ShapingCacheEntry> shaping_cache_lru; // Most recently used first.
+	mutable HashMap<ShapingCacheKey, List<ShapingCacheEntry>::Element *, ShapingCacheKeyHasher> shaping_cache;
+	mutable uint64_t shaping_cache_memory = 0;
+	mutable uint64_t shaping_cache_hits = 0;
+	mutable uint64_t shaping_cache_misses = 0;
+	uint64_t shaping_cache_budget = 4 * 1024 * 1024;
+
+	bool _shaping_cache_get(const ShapingCacheKey &p_key, Vector<hb_glyph_info_t> &r_glyph_info, Vector<hb_glyph_position_t> &r_glyph_pos) const;
+	void _shaping_cache_insert(const ShapingCacheKey &p_key, const hb_glyph_info_t *p_glyph_info, const hb_glyph_position_t *p_glyph_pos, unsigned int p_glyph_count) const;
+	void _shaping_cache_trim(uint64_t p_budget) const;
+
+	struct GlyphPrefetchData {
+		FontAdvanced *font_data = nullptr;
+		Vector2i size;
+		Vector<char32_t> chars;
+	};
+
+#ifndef GDEXTENSION
+	mutable Mutex glyph_prefetch_mutex;
+	LocalVector<WorkerThreadPool::TaskID> glyph_prefetch_tasks;
+#endif
+
+	void _font_render_char(FontAdvanced *p_font_data, const Vector2i &p_size, int64_t p_char) const;
+	void _font_prefetch_glyphs_threaded(GlyphPrefetchData *p_data);
+
 	void _realign(ShapedTextDataAdvanced *p_sd) const;
 	int64_t _convert_pos(const String &p_utf32, const Char16String &p_utf16, int64_t p_pos) const;
 	int64_t _convert_pos(const ShapedTextDataAdvanced *p_sd, int64_t p_pos) const;
@@ -656,12 +734,21 @@ class TextServerAdvanced : public TextServerExtension {
 	};
 
 protected:
-	static void _bind_methods(){};
+	static void _bind_methods();
 
 	void full_copy(ShapedTextDataAdvanced *p_shaped);
 	void invalidate(ShapedTextDataAdvanced *p_shaped, bool p_text = false);
 
 public:
+	void shaping_cache_set_memory_budget(int64_t p_bytes);
+	int64_t shaping_cache_get_memory_budget() const;
+	Dictionary shaping_cache_get_stats() const;
+	void shaping_cache_clear();
+
+	void font_prefetch_glyphs(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters);
+	bool font_is_prefetching() const;
+	void font_prefetch_wait();
+
 	MODBIND1RC(bool, has_feature, Feature);
 	MODBIND0RC(String, get_name);
 	MODBIND0RC(int64_t, get_features);
@@ -31,6 +31,7 @@
 #include "video_stream_theora.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 #ifdef _MSC_VER
@@ -90,29 +91,50 @@ int VideoStreamPlaybackTheora::queue_page(ogg_page *page) {
 	return 0;
 }
 
+void VideoStreamPlaybackTheora::_convert_yuv_band(uint32_t p_band, YUVConvert *p_convert) {
+	int from = p_band * YUV_CONVERT_BAND_ROWS;
+	int rows = MIN(int(YUV_CONVERT_BAND_ROWS), size.y - from);
+	// 4:2:0 has one chroma row for every two luma rows, the other formats have one each.
+	int chroma_from = px_fmt == TH_PF_420 ? from / 2 : from;
+
+	const th_ycbcr_buffer &yuv = p_convert->yuv;
+	uint8_t *dst = p_convert->dst + from * (size.x << 2);
+	uint8_t *y = (uint8_t *)yuv[0].data + from * yuv[0].stride;
+	uint8_t *u = (uint8_t *)yuv[1].data + chroma_from * yuv[1].stride;
+	uint8_t *v = (uint8_t *)yuv[2].data + chroma_from * yuv[2].stride;
+
+	if (px_fmt == TH_PF_444) {
+		yuv444_2_rgb8888(dst, y, u, v, size.x, rows, yuv[0].stride, yuv[1].stride, size.x << 2);
+
+	} else if (px_fmt == TH_PF_422) {
+		yuv422_2_rgb8888(dst, y, u, v, size.x, rows, yuv[0].stride, yuv[1].stride, size.x << 2);
+
+	} else if (px_fmt == TH_PF_420) {
+		yuv420_2_rgb8888(dst, y, u, v, size.x, rows, yuv[0].stride, yuv[1].stride, size.x << 2);
+	}
+}
+
 void VideoStreamPlaybackTheora::video_write() {
-	th_ycbcr_buffer yuv;
-	th_decode_ycbcr_out(td, yuv);
+	YUVConvert convert;
+	th_decode_ycbcr_out(td, convert.yuv);
 
 	int pitch = 4;
 	frame_data.resize(size.x * size.y * pitch);
-	{
-		uint8_t *w = frame_data.ptrw();
-		char *dst = (char *)w;
-
-		if (px_fmt == TH_PF_444) {
-			yuv444_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
-
-		} else if (px_fmt == TH_PF_422) {
-			yuv422_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
+	convert.dst = frame_data.ptrw();
 
-		} else if (px_fmt == TH_PF_420) {
-			yuv420_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
+	// The conversion is independent per row, so large frames are split in bands across the pool.
+	uint32_t band_count = (size.y + YUV_CONVERT_BAND_ROWS - 1) / YUV_CONVERT_BAND_ROWS;
+	if (band_count > 1 && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &VideoStreamPlaybackTheora::_convert_yuv_band, &convert, band_count, -1, true, SNAME("TheoraYUVToRGB"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < band_count; i++) {
+			_convert_yuv_band(i, &convert);
 		}
-
-		format = Image::FORMAT_RGBA8;
 	}
 
+	format = Image::FORMAT_RGBA8;
+
 	Ref<Image> img = memnew(Image(size.x, size.y, 0, Image::FORMAT_RGBA8, frame_data)); //zero copy image creation
 
 	texture->update(img); //zero copy send to rendering server
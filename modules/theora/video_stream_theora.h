@@ -64,6 +64,16 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 	int buffer_data();
 	int queue_page(ogg_page *page);
 	void video_write();
+
+	// Rows converted from YUV to RGBA by each WorkerThreadPool task, kept even for 4:2:0 chroma.
+	enum {
+		YUV_CONVERT_BAND_ROWS = 64,
+	};
+	struct YUVConvert {
+		th_ycbcr_buffer yuv;
+		uint8_t *dst = nullptr;
+	};
+	void _convert_yuv_band(uint32_t p_band, YUVConvert *p_convert);
 	double get_time() const;
 
 	bool theora_eos = false;
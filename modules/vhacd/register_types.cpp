@@ -32,7 +32,23 @@
 #include "scene/resources/mesh.h"
 #include "thirdparty/vhacd/public/VHACD.h"
 
-static Vector<Vector<Vector3>> convex_decompose(const real_t *p_vertices, int p_vertex_count, const uint32_t *p_triangles, int p_triangle_count, const Mesh::ConvexDecompositionSettings &p_settings, Vector<Vector<uint32_t>> *r_convex_indices) {
+class ConvexDecompositionProgress : public VHACD::IVHACD::IUserCallback {
+public:
+	VHACD::IVHACD *decomposer = nullptr;
+	Mesh::ConvexDecompositionProgressFunc func = nullptr;
+	void *userdata = nullptr;
+	bool cancelled = false;
+
+	virtual void Update(const double overallProgress, const double stageProgress, const double operationProgress, const char *const stage, const char *const operation) override {
+		if (!cancelled && !func(userdata, overallProgress / 100.0)) {
+			// VHACD checks the flag between steps and stops early.
+			cancelled = true;
+			decomposer->Cancel();
+		}
+	}
+};
+
+static Vector<Vector<Vector3>> convex_decompose(const real_t *p_vertices, int p_vertex_count, const uint32_t *p_triangles, int p_triangle_count, const Mesh::ConvexDecompositionSettings &p_settings, Vector<Vector<uint32_t>> *r_convex_indices, Mesh::ConvexDecompositionProgressFunc p_progress_func, void *p_progress_userdata) {
 	VHACD::IVHACD::Parameters params;
 	params.m_concavity = p_settings.max_concavity;
 	params.m_alpha = p_settings.symmetry_planes_clipping_bias;
@@ -50,11 +66,26 @@ static Vector<Vector<Vector3>> convex_decompose(const real_t *p_vertices, int p_
 	params.m_projectHullVertices = p_settings.project_hull_vertices;
 
 	VHACD::IVHACD *decomposer = VHACD::CreateVHACD();
+
+	ConvexDecompositionProgress progress;
+	if (p_progress_func) {
+		progress.decomposer = decomposer;
+		progress.func = p_progress_func;
+		progress.userdata = p_progress_userdata;
+		params.m_callback = &progress;
+	}
+
 	decomposer->Compute(p_vertices, p_vertex_count, p_triangles, p_triangle_count, params);
 
+	Vector<Vector<Vector3>> ret;
+	if (progress.cancelled) {
+		decomposer->Clean();
+		decomposer->Release();
+		return ret;
+	}
+
 	int hull_count = decomposer->GetNConvexHulls();
 
-	Vector<Vector<Vector3>> ret;
 	ret.resize(hull_count);
 
 	if (r_convex_indices) {
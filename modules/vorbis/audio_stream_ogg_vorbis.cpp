@@ -36,6 +36,11 @@
 
 int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	ERR_FAIL_COND_V(!ready, 0);
+	return decode_ahead.mix(p_buffer, p_frames);
+}
+
+int AudioStreamPlaybackOggVorbis::decode_ahead_frames(AudioFrame *p_buffer, int p_frames) {
+	ERR_FAIL_COND_V(!ready, 0);
 
 	if (!active) {
 		return 0;
@@ -113,7 +118,7 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 					loop_fade_remaining = 0;
 				}
 
-				seek(vorbis_stream->loop_offset);
+				_seek(vorbis_stream->loop_offset);
 				loops++;
 				// We still have buffer to fill, start from this element in the next iteration.
 				continue;
@@ -126,7 +131,7 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 			if (vorbis_stream->loop && is_not_empty) {
 				//loop
 
-				seek(vorbis_stream->loop_offset);
+				_seek(vorbis_stream->loop_offset);
 				loops++;
 				// We still have buffer to fill, start from this element in the next iteration.
 
@@ -228,34 +233,54 @@ bool AudioStreamPlaybackOggVorbis::_alloc_vorbis() {
 
 void AudioStreamPlaybackOggVorbis::start(double p_from_pos) {
 	ERR_FAIL_COND(!ready);
+	decode_ahead.begin_restart();
 	loop_fade_remaining = FADE_SIZE;
 	active = true;
-	seek(p_from_pos);
+	_seek(p_from_pos);
 	loops = 0;
+	decode_ahead.end_restart();
 	begin_resample();
 }
 
 void AudioStreamPlaybackOggVorbis::stop() {
+	decode_ahead.begin_restart();
 	active = false;
+	decode_ahead.end_restart();
 }
 
 bool AudioStreamPlaybackOggVorbis::is_playing() const {
-	return active;
+	// The decoder may have reached the end while decoded frames are still waiting to be mixed.
+	return active || decode_ahead.has_frames();
 }
 
 int AudioStreamPlaybackOggVorbis::get_loop_count() const {
-	return loops;
+	return decode_ahead.get_loop_count();
 }
 
 double AudioStreamPlaybackOggVorbis::get_playback_position() const {
+	return decode_ahead.get_playback_position(vorbis_data->get_sampling_rate());
+}
+
+double AudioStreamPlaybackOggVorbis::decode_ahead_get_position() const {
 	return double(frames_mixed) / (double)vorbis_data->get_sampling_rate();
 }
 
+int AudioStreamPlaybackOggVorbis::decode_ahead_get_loop_count() const {
+	return loops;
+}
+
 void AudioStreamPlaybackOggVorbis::tag_used_streams() {
 	vorbis_stream->tag_used(get_playback_position());
 }
 
 void AudioStreamPlaybackOggVorbis::seek(double p_time) {
+	ERR_FAIL_COND(!ready);
+	decode_ahead.begin_restart();
+	_seek(p_time);
+	decode_ahead.end_restart();
+}
+
+void AudioStreamPlaybackOggVorbis::_seek(double p_time) {
 	ERR_FAIL_COND(!ready);
 	ERR_FAIL_COND(vorbis_stream.is_null());
 	if (!active) {
@@ -382,6 +407,7 @@ void AudioStreamPlaybackOggVorbis::seek(double p_time) {
 }
 
 AudioStreamPlaybackOggVorbis::~AudioStreamPlaybackOggVorbis() {
+	decode_ahead.release();
 	if (block_is_allocated) {
 		vorbis_block_clear(&block);
 	}
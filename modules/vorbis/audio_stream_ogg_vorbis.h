@@ -33,12 +33,13 @@
 
 #include "core/variant/variant.h"
 #include "modules/ogg/ogg_packet_sequence.h"
+#include "servers/audio/audio_decode_ahead.h"
 #include "servers/audio/audio_stream.h"
 #include "thirdparty/libvorbis/vorbis/codec.h"
 
 class AudioStreamOggVorbis;
 
-class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
+class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled, public AudioDecodeAhead::Decoder {
 	GDCLASS(AudioStreamPlaybackOggVorbis, AudioStreamPlaybackResampled);
 
 	uint32_t frames_mixed = 0;
@@ -78,10 +79,17 @@ class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 	// Allocates vorbis data structures. Returns true upon success, false on failure.
 	bool _alloc_vorbis();
 
+	AudioDecodeAhead decode_ahead;
+	void _seek(double p_time);
+
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
 
+	virtual int decode_ahead_frames(AudioFrame *p_buffer, int p_frames) override;
+	virtual double decode_ahead_get_position() const override;
+	virtual int decode_ahead_get_loop_count() const override;
+
 public:
 	virtual void start(double p_from_pos = 0.0) override;
 	virtual void stop() override;
@@ -94,7 +102,8 @@ public:
 
 	virtual void tag_used_streams() override;
 
-	AudioStreamPlaybackOggVorbis() {}
+	AudioStreamPlaybackOggVorbis() :
+			decode_ahead(this) {}
 	~AudioStreamPlaybackOggVorbis();
 };
 
@@ -30,6 +30,7 @@
 
 #include "websocket_multiplayer_peer.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 WebSocketMultiplayerPeer::WebSocketMultiplayerPeer() {
@@ -54,6 +55,7 @@ void WebSocketMultiplayerPeer::_clear() {
 	connection_status = CONNECTION_DISCONNECTED;
 	unique_id = 0;
 	peers_map.clear();
+	peers_tcp.clear();
 	use_tls = false;
 	tcp_server.unref();
 	pending_peers.clear();
@@ -284,8 +286,8 @@ void WebSocketMultiplayerPeer::_poll_server() {
 	ERR_FAIL_COND(connection_status != CONNECTION_CONNECTED); // Bug.
 	ERR_FAIL_COND(tcp_server.is_null() || !tcp_server->is_listening()); // Bug.
 
-	// Accept new connections.
-	if (!is_refusing_new_connections() && tcp_server->is_connection_available()) {
+	// Accept new connections (a bounded amount per poll, to avoid starving the connected peers).
+	for (int i = 0; i < MAX_ACCEPT_PER_POLL && !is_refusing_new_connections() && tcp_server->is_connection_available(); i++) {
 		PendingPeer peer;
 		peer.time = OS::get_singleton()->get_ticks_msec();
 		peer.tcp = tcp_server->take_connection();
@@ -319,6 +321,9 @@ void WebSocketMultiplayerPeer::_poll_server() {
 				Error err = peer.ws->put_packet((const uint8_t *)&peer_id, sizeof(peer_id));
 				if (err == OK) {
 					peers_map[id] = peer.ws;
+					if (!use_tls) {
+						peers_tcp[id] = peer.tcp;
+					}
 					emit_signal("peer_connected", id);
 				} else {
 					ERR_PRINT("Failed to send ID to newly connected peer.");
@@ -370,10 +375,49 @@ void WebSocketMultiplayerPeer::_poll_server() {
 	to_remove.clear();
 
 	// Process connected peers.
+	// Open peers over plain TCP with nothing left to send only need polling when their socket is readable,
+	// which is checked for all of them at once.
+	poll_ids.clear();
+	poll_peers.clear();
+	idle_ids.clear();
+	idle_sockets.clear();
 	for (KeyValue<int, Ref<WebSocketPeer>> &E : peers_map) {
-		Ref<WebSocketPeer> ws = E.value;
-		int id = E.key;
-		ws->poll();
+		const Ref<StreamPeerTCP> *tcp = peers_tcp.getptr(E.key);
+		if (tcp && E.value->get_ready_state() == WebSocketPeer::STATE_OPEN && E.value->get_current_outbound_buffered_amount() == 0) {
+			Ref<NetSocket> sock = (*tcp)->get_socket();
+			if (sock.is_valid()) {
+				idle_ids.push_back(E.key);
+				idle_sockets.push_back(sock);
+				continue;
+			}
+		}
+		poll_ids.push_back(E.key);
+		poll_peers.push_back(E.value);
+	}
+	if (idle_sockets.size()) {
+		Error err = NetSocket::poll_many(idle_sockets.ptr(), idle_sockets.size(), NetSocket::POLL_TYPE_IN, 0, idle_ready);
+		for (uint32_t i = 0; i < idle_ids.size(); i++) {
+			if (err == FAILED || idle_ready[i]) {
+				poll_ids.push_back(idle_ids[i]);
+				poll_peers.push_back(peers_map[idle_ids[i]]);
+			}
+		}
+		idle_sockets.clear();
+	}
+
+	// Frame parsing is independent for each peer, spread it over the worker threads when there are many.
+	if (poll_peers.size() >= PARALLEL_POLL_THRESHOLD) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &WebSocketMultiplayerPeer::_poll_peer_task, (void *)nullptr, poll_peers.size(), -1, true, SNAME("WebSocketPoll"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
+		for (uint32_t i = 0; i < poll_peers.size(); i++) {
+			poll_peers[i]->poll();
+		}
+	}
+
+	for (uint32_t i = 0; i < poll_peers.size(); i++) {
+		Ref<WebSocketPeer> ws = poll_peers[i];
+		int id = poll_ids[i];
 		if (ws->get_ready_state() != WebSocketPeer::STATE_OPEN) {
 			to_remove.insert(id); // Disconnected.
 			continue;
@@ -391,19 +435,25 @@ void WebSocketMultiplayerPeer::_poll_server() {
 			packet.data = (uint8_t *)memalloc(size);
 			memcpy(packet.data, in_buffer, size);
 			packet.size = size;
-			packet.source = E.key;
+			packet.source = id;
 			incoming_packets.push_back(packet);
 			pkts--;
 		}
 	}
+	poll_peers.clear();
 
 	// Remove disconnected peers.
 	for (const int &pid : to_remove) {
 		emit_signal(SNAME("peer_disconnected"), pid);
 		peers_map.erase(pid);
+		peers_tcp.erase(pid);
 	}
 }
 
+void WebSocketMultiplayerPeer::_poll_peer_task(uint32_t p_index, void *p_userdata) {
+	poll_peers[p_index]->poll();
+}
+
 void WebSocketMultiplayerPeer::poll() {
 	if (connection_status == CONNECTION_DISCONNECTED) {
 		return;
@@ -488,6 +538,7 @@ void WebSocketMultiplayerPeer::disconnect_peer(int p_peer_id, bool p_force) {
 	peers_map[p_peer_id]->close();
 	if (p_force) {
 		peers_map.erase(p_peer_id);
+		peers_tcp.erase(p_peer_id);
 		if (!is_server()) {
 			_clear();
 		}
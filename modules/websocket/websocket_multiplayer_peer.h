@@ -35,6 +35,7 @@
 #include "core/io/stream_peer_tls.h"
 #include "core/io/tcp_server.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/multiplayer_peer.h"
 #include "websocket_peer.h"
 
@@ -54,6 +55,11 @@ protected:
 		PROTO_SIZE = 9
 	};
 
+	enum {
+		MAX_ACCEPT_PER_POLL = 64,
+		PARALLEL_POLL_THRESHOLD = 64,
+	};
+
 	struct Packet {
 		int source = 0;
 		uint8_t *data = nullptr;
@@ -79,8 +85,16 @@ protected:
 
 	List<Packet> incoming_packets;
 	HashMap<int, Ref<WebSocketPeer>> peers_map;
+	HashMap<int, Ref<StreamPeerTCP>> peers_tcp; // Server only, used to skip idle peers when not using TLS.
 	Packet current_packet;
 
+	// Reused every server poll.
+	LocalVector<int> poll_ids;
+	LocalVector<Ref<WebSocketPeer>> poll_peers;
+	LocalVector<int> idle_ids;
+	LocalVector<Ref<NetSocket>> idle_sockets;
+	LocalVector<uint8_t> idle_ready;
+
 	int target_peer = 0;
 	int unique_id = 0;
 
@@ -88,6 +102,7 @@ protected:
 
 	void _poll_client();
 	void _poll_server();
+	void _poll_peer_task(uint32_t p_index, void *p_userdata);
 	void _clear();
 
 public:
@@ -30,10 +30,74 @@
 
 #include "register_types.h"
 #include "core/crypto/crypto_core.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "thirdparty/xatlas/xatlas.h"
 
 extern bool (*array_mesh_lightmap_unwrap_callback)(float p_texel_size, const float *p_vertices, const float *p_normals, int p_vertex_count, const int *p_indices, int p_index_count, const uint8_t *p_cache_data, bool *r_use_cache, uint8_t **r_mesh_cache, int *r_mesh_cache_size, float **r_uv, int **r_vertex, int *r_vertex_count, int **r_index, int *r_index_count, int *r_size_hint_x, int *r_size_hint_y);
 
+// Unwraps done during this session, keyed by the content hash, so meshes baked or unwrapped again
+// without changes (e.g. GridMap and editor bakes, which don't keep an import cache) skip xatlas.
+struct UnwrapCacheEntry {
+	int size_hint_x = 0;
+	int size_hint_y = 0;
+	LocalVector<int> vertices;
+	LocalVector<float> uvs;
+	LocalVector<int> indices;
+};
+
+static const uint64_t UNWRAP_CACHE_MAX_BYTES = 64 * 1024 * 1024;
+static HashMap<String, UnwrapCacheEntry> unwrap_cache;
+static uint64_t unwrap_cache_bytes = 0;
+static Mutex unwrap_cache_mutex;
+
+static bool _unwrap_cache_get(const String &p_key, float **r_uv, int **r_vertex, int *r_vertex_count, int **r_index, int *r_index_count, int *r_size_hint_x, int *r_size_hint_y) {
+	MutexLock lock(unwrap_cache_mutex);
+	HashMap<String, UnwrapCacheEntry>::Iterator E = unwrap_cache.find(p_key);
+	if (!E) {
+		return false;
+	}
+
+	// The caller frees the buffers once done, so hand out copies.
+	const UnwrapCacheEntry &entry = E->value;
+	*r_size_hint_x = entry.size_hint_x;
+	*r_size_hint_y = entry.size_hint_y;
+	*r_vertex_count = entry.vertices.size();
+	*r_vertex = (int *)memalloc(sizeof(int) * entry.vertices.size());
+	memcpy(*r_vertex, entry.vertices.ptr(), sizeof(int) * entry.vertices.size());
+	*r_uv = (float *)memalloc(sizeof(float) * entry.uvs.size());
+	memcpy(*r_uv, entry.uvs.ptr(), sizeof(float) * entry.uvs.size());
+	*r_index_count = entry.indices.size();
+	*r_index = (int *)memalloc(sizeof(int) * entry.indices.size());
+	memcpy(*r_index, entry.indices.ptr(), sizeof(int) * entry.indices.size());
+	return true;
+}
+
+static void _unwrap_cache_set(const String &p_key, const float *p_uv, const int *p_vertex, int p_vertex_count, const int *p_index, int p_index_count, int p_size_hint_x, int p_size_hint_y) {
+	uint64_t bytes = sizeof(int) * (p_vertex_count * 3 + p_index_count);
+	if (bytes > UNWRAP_CACHE_MAX_BYTES) {
+		return;
+	}
+
+	MutexLock lock(unwrap_cache_mutex);
+	if (unwrap_cache_bytes + bytes > UNWRAP_CACHE_MAX_BYTES) {
+		unwrap_cache.clear();
+		unwrap_cache_bytes = 0;
+	}
+
+	UnwrapCacheEntry &entry = unwrap_cache[p_key];
+	entry.size_hint_x = p_size_hint_x;
+	entry.size_hint_y = p_size_hint_y;
+	entry.vertices.resize(p_vertex_count);
+	memcpy(entry.vertices.ptr(), p_vertex, sizeof(int) * p_vertex_count);
+	entry.uvs.resize(p_vertex_count * 2);
+	memcpy(entry.uvs.ptr(), p_uv, sizeof(float) * p_vertex_count * 2);
+	entry.indices.resize(p_index_count);
+	memcpy(entry.indices.ptr(), p_index, sizeof(int) * p_index_count);
+	unwrap_cache_bytes += bytes;
+}
+
 bool xatlas_mesh_lightmap_unwrap_callback(float p_texel_size, const float *p_vertices, const float *p_normals, int p_vertex_count, const int *p_indices, int p_index_count, const uint8_t *p_cache_data, bool *r_use_cache, uint8_t **r_mesh_cache, int *r_mesh_cache_size, float **r_uv, int **r_vertex, int *r_vertex_count, int **r_index, int *r_index_count, int *r_size_hint_x, int *r_size_hint_y) {
 	CryptoCore::MD5Context ctx;
 	ctx.start();
@@ -102,6 +166,8 @@ bool xatlas_mesh_lightmap_unwrap_callback(float p_texel_size, const float *p_ver
 		*r_index_count = cache_data[cache_idx];
 		cache_idx++;
 		*r_index = &cache_data[cache_idx];
+	} else if (_unwrap_cache_get(String::hex_encode_buffer(hash, 16), r_uv, r_vertex, r_vertex_count, r_index, r_index_count, r_size_hint_x, r_size_hint_y)) {
+		// Unwrapped earlier in this session, the buffers are copies the caller frees as usual.
 	} else {
 		// set up input mesh
 		xatlas::MeshDecl input_mesh;
@@ -174,6 +240,8 @@ bool xatlas_mesh_lightmap_unwrap_callback(float p_texel_size, const float *p_ver
 		*r_index_count = output.indexCount;
 
 		xatlas::Destroy(atlas);
+
+		_unwrap_cache_set(String::hex_encode_buffer(hash, 16), *r_uv, *r_vertex, *r_vertex_count, *r_index, *r_index_count, *r_size_hint_x, *r_size_hint_y);
 	}
 
 	if (*r_use_cache) {
@@ -234,4 +302,7 @@ void uninitialize_xatlas_unwrap_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
 	}
+
+	unwrap_cache.clear();
+	unwrap_cache_bytes = 0;
 }
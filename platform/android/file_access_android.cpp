@@ -32,6 +32,9 @@
 
 #include "core/string/print_string.h"
 
+#include <sys/mman.h>
+#include <unistd.h>
+
 AAssetManager *FileAccessAndroid::asset_manager = nullptr;
 
 String FileAccessAndroid::get_path() const {
@@ -70,6 +73,11 @@ void FileAccessAndroid::_close() {
 	if (!asset) {
 		return;
 	}
+	if (mapping) {
+		munmap(mapping, mapping_length);
+		mapping = nullptr;
+		mapping_length = 0;
+	}
 	AAsset_close(asset);
 	asset = nullptr;
 }
@@ -116,7 +124,11 @@ uint8_t FileAccessAndroid::get_8() const {
 	}
 
 	uint8_t byte;
-	AAsset_read(asset, &byte, 1);
+	if (mapping) {
+		byte = ((const uint8_t *)mapping)[mapping_offset + pos];
+	} else {
+		AAsset_read(asset, &byte, 1);
+	}
 	pos++;
 	return byte;
 }
@@ -124,7 +136,14 @@ uint8_t FileAccessAndroid::get_8() const {
 uint64_t FileAccessAndroid::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
-	int r = AAsset_read(asset, p_dst, p_length);
+	int r;
+	if (mapping) {
+		// Once mapped, reads copy from the mapping and the asset position is no longer used.
+		r = pos < len ? MIN(p_length, len - pos) : 0;
+		memcpy(p_dst, (const uint8_t *)mapping + mapping_offset + pos, r);
+	} else {
+		r = AAsset_read(asset, p_dst, p_length);
+	}
 
 	if (pos + p_length > len) {
 		eof = true;
@@ -139,6 +158,50 @@ uint64_t FileAccessAndroid::get_buffer(uint8_t *p_dst, uint64_t p_length) const
 	return r;
 }
 
+const uint8_t *FileAccessAndroid::get_buffer_view(uint64_t p_length) const {
+	const uint8_t *data = const_cast<FileAccessAndroid *>(this)->get_memory_map();
+	if (!data || eof || pos + p_length > len) {
+		return nullptr;
+	}
+
+	const uint8_t *view = data + pos;
+	pos += p_length;
+	return view;
+}
+
+const uint8_t *FileAccessAndroid::get_memory_map() {
+	ERR_FAIL_NULL_V(asset, nullptr);
+
+	if (mapping) {
+		return (const uint8_t *)mapping + mapping_offset;
+	}
+	if (len == 0) {
+		return nullptr;
+	}
+
+	// Only fails for assets compressed inside the APK, those keep going through AAsset_read().
+	off64_t start = 0;
+	off64_t length = 0;
+	int fd = AAsset_openFileDescriptor64(asset, &start, &length);
+	if (fd < 0) {
+		return nullptr;
+	}
+
+	uint64_t page_size = sysconf(_SC_PAGESIZE);
+	uint64_t map_start = start - (start % page_size);
+	uint64_t ofs = start - map_start;
+	void *ptr = mmap(nullptr, ofs + length, PROT_READ, MAP_PRIVATE, fd, map_start);
+	close(fd); // The mapping keeps the file referenced.
+	if (ptr == MAP_FAILED) {
+		return nullptr;
+	}
+
+	mapping = ptr;
+	mapping_length = ofs + length;
+	mapping_offset = ofs;
+	return (const uint8_t *)mapping + mapping_offset;
+}
+
 Error FileAccessAndroid::get_error() const {
 	return eof ? ERR_FILE_EOF : OK; // not sure what else it may happen
 }
@@ -44,6 +44,11 @@ class FileAccessAndroid : public FileAccess {
 	String absolute_path;
 	String path_src;
 
+	// Uncompressed assets are stored as is in the APK and can be mapped from it.
+	void *mapping = nullptr;
+	uint64_t mapping_length = 0;
+	uint64_t mapping_offset = 0; // Offset of the asset inside the mapping, which starts on a page boundary.
+
 	void _close();
 
 public:
@@ -66,6 +71,8 @@ public:
 
 	virtual uint8_t get_8() const override; // get a byte
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const override;
+	virtual const uint8_t *get_memory_map() override;
 
 	virtual Error get_error() const override; // get last error
 
@@ -286,7 +286,8 @@ void DisplayServerX11::_flush_mouse_motion() {
 			XIDeviceEvent *event_data = (XIDeviceEvent *)event.xcookie.data;
 			if (event_data->evtype == XI_RawMotion) {
 				XFreeEventData(x11_display, &event.xcookie);
-				polled_events.remove_at(event_index--);
+				polled_events.remove_at(event_index);
+				polled_event_ticks.remove_at(event_index--);
 				continue;
 			}
 			XFreeEventData(x11_display, &event.xcookie);
@@ -2905,7 +2906,7 @@ void DisplayServerX11::_handle_key_event(WindowID p_window, XKeyEvent *p_event,
 					k->set_shift_pressed(true);
 				}
 
-				Input::get_singleton()->parse_input_event(k);
+				Input::get_singleton()->parse_input_event_at(k, current_event_ticks);
 			}
 			memfree(utf8string);
 			return;
@@ -3054,7 +3055,7 @@ void DisplayServerX11::_handle_key_event(WindowID p_window, XKeyEvent *p_event,
 		}
 	}
 
-	Input::get_singleton()->parse_input_event(k);
+	Input::get_singleton()->parse_input_event_at(k, current_event_ticks);
 }
 
 Atom DisplayServerX11::_process_selection_request_target(Atom p_target, Window p_requestor, Atom p_property, Atom p_selection) const {
@@ -3364,15 +3365,18 @@ void DisplayServerX11::_poll_events() {
 		{
 			MutexLock mutex_lock(events_mutex);
 
-			_check_pending_events(polled_events);
+			_check_pending_events(polled_events, polled_event_ticks);
 		}
 	}
 }
 
-void DisplayServerX11::_check_pending_events(LocalVector<XEvent> &r_events) {
+void DisplayServerX11::_check_pending_events(LocalVector<XEvent> &r_events, LocalVector<uint64_t> &r_event_ticks) {
 	// Flush to make sure to gather all pending events.
 	XFlush(x11_display);
 
+	// Events are read as soon as they arrive on the polling thread, so this is close to the time they were received.
+	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+
 	// Non-blocking wait for next event and remove it from the queue.
 	XEvent ev = {};
 	while (XCheckIfEvent(x11_display, &ev, _predicate_all_events, nullptr)) {
@@ -3392,6 +3396,7 @@ void DisplayServerX11::_check_pending_events(LocalVector<XEvent> &r_events) {
 		}
 
 		r_events.push_back(ev);
+		r_event_ticks.push_back(ticks);
 	}
 }
 
@@ -3558,18 +3563,22 @@ void DisplayServerX11::process_events() {
 	xi.pressure_supported = false;
 
 	LocalVector<XEvent> events;
+	LocalVector<uint64_t> event_ticks;
 	{
 		// Block events polling while flushing events.
 		MutexLock mutex_lock(events_mutex);
 		events = polled_events;
+		event_ticks = polled_event_ticks;
 		polled_events.clear();
+		polled_event_ticks.clear();
 
 		// Check for more pending events to avoid an extra frame delay.
-		_check_pending_events(events);
+		_check_pending_events(events, event_ticks);
 	}
 
 	for (uint32_t event_index = 0; event_index < events.size(); ++event_index) {
 		XEvent &event = events[event_index];
+		current_event_ticks = event_ticks[event_index];
 		if (ignore_events) {
 			XFreeEventData(x11_display, &event.xcookie);
 			continue;
@@ -3718,13 +3727,13 @@ void DisplayServerX11::process_events() {
 								// in a spurious mouse motion event being sent to Godot; remember it to be able to filter it out
 								xi.mouse_pos_to_filter = pos;
 							}
-							Input::get_singleton()->parse_input_event(st);
+							Input::get_singleton()->parse_input_event_at(st, current_event_ticks);
 						} else {
 							if (!xi.state.has(index)) { // Defensive
 								break;
 							}
 							xi.state.erase(index);
-							Input::get_singleton()->parse_input_event(st);
+							Input::get_singleton()->parse_input_event_at(st, current_event_ticks);
 						}
 					} break;
 
@@ -3741,7 +3750,7 @@ void DisplayServerX11::process_events() {
 							sd->set_index(index);
 							sd->set_position(pos);
 							sd->set_relative(pos - curr_pos_elem->value);
-							Input::get_singleton()->parse_input_event(sd);
+							Input::get_singleton()->parse_input_event_at(sd, current_event_ticks);
 
 							curr_pos_elem->value = pos;
 						}
@@ -3901,7 +3910,7 @@ void DisplayServerX11::process_events() {
 					st->set_index(E.key);
 					st->set_window_id(window_id);
 					st->set_position(E.value);
-					Input::get_singleton()->parse_input_event(st);
+					Input::get_singleton()->parse_input_event_at(st, current_event_ticks);
 				}
 				xi.state.clear();
 #endif
@@ -4010,7 +4019,7 @@ void DisplayServerX11::process_events() {
 					}
 				}
 
-				Input::get_singleton()->parse_input_event(mb);
+				Input::get_singleton()->parse_input_event_at(mb, current_event_ticks);
 
 			} break;
 			case MotionNotify: {
@@ -4129,7 +4138,7 @@ void DisplayServerX11::process_events() {
 				// this is so that the relative motion doesn't get messed up
 				// after we regain focus.
 				if (focused) {
-					Input::get_singleton()->parse_input_event(mm);
+					Input::get_singleton()->parse_input_event_at(mm, current_event_ticks);
 				} else {
 					// Propagate the event to the focused window,
 					// because it's received only on the topmost window.
@@ -4149,7 +4158,7 @@ void DisplayServerX11::process_events() {
 							mm->set_position(pos_focused);
 							mm->set_global_position(pos_focused);
 							mm->set_velocity(Input::get_singleton()->get_last_mouse_velocity());
-							Input::get_singleton()->parse_input_event(mm);
+							Input::get_singleton()->parse_input_event_at(mm, current_event_ticks);
 
 							break;
 						}
@@ -4291,7 +4300,10 @@ void DisplayServerX11::process_events() {
 		*/
 	}
 
-	Input::get_singleton()->flush_buffered_events();
+	// With input buffering, the main loop flushes the events itself, spread over the physics ticks.
+	if (!Input::get_singleton()->is_using_input_buffering()) {
+		Input::get_singleton()->flush_buffered_events();
+	}
 }
 
 void DisplayServerX11::release_rendering_thread() {
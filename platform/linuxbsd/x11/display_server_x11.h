@@ -302,10 +302,12 @@ class DisplayServerX11 : public DisplayServer {
 	Thread events_thread;
 	SafeFlag events_thread_done;
 	LocalVector<XEvent> polled_events;
+	LocalVector<uint64_t> polled_event_ticks; // When each polled event was received, in microseconds.
+	uint64_t current_event_ticks = 0;
 	static void _poll_events_thread(void *ud);
 	bool _wait_for_events() const;
 	void _poll_events();
-	void _check_pending_events(LocalVector<XEvent> &r_events);
+	void _check_pending_events(LocalVector<XEvent> &r_events, LocalVector<uint64_t> &r_event_ticks);
 
 	static Bool _predicate_all_events(Display *display, XEvent *event, XPointer arg);
 	static Bool _predicate_clipboard_selection(Display *display, XEvent *event, XPointer arg);
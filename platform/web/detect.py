@@ -34,6 +34,7 @@ def get_opts():
 
     return [
         ("initial_memory", "Initial WASM memory (in MiB)", 32),
+        ("pthread_pool_size", "Number of Web Workers prewarmed for threads, bounds the worker thread pool", 8),
         BoolVariable("use_assertions", "Use Emscripten runtime assertions", False),
         BoolVariable("use_ubsan", "Use Emscripten undefined behavior sanitizer (UBSAN)", False),
         BoolVariable("use_asan", "Use Emscripten address sanitizer (ASAN)", False),
@@ -193,7 +194,8 @@ def configure(env: "Environment"):
     env.Append(CPPDEFINES=["PTHREAD_NO_RENAME"])
     env.Append(CCFLAGS=["-s", "USE_PTHREADS=1"])
     env.Append(LINKFLAGS=["-s", "USE_PTHREADS=1"])
-    env.Append(LINKFLAGS=["-s", "PTHREAD_POOL_SIZE=8"])
+    env.Append(LINKFLAGS=["-s", "PTHREAD_POOL_SIZE=%s" % env["pthread_pool_size"]])
+    env.Append(CPPDEFINES=[("WEB_PTHREAD_POOL_SIZE", env["pthread_pool_size"])])
     env.Append(LINKFLAGS=["-s", "WASM_MEM_MAX=2048MB"])
 
     if env["dlink_enabled"]:
@@ -309,9 +309,8 @@ const GodotOS = {
 
 	godot_js_os_hw_concurrency_get__sig: 'i',
 	godot_js_os_hw_concurrency_get: function () {
-		// TODO Godot core needs fixing to avoid spawning too many threads (> 24).
-		const concurrency = navigator.hardwareConcurrency || 1;
-		return concurrency < 2 ? concurrency : 2;
+		// Clamped to the prewarmed thread pool in OS_Web::get_processor_count.
+		return navigator.hardwareConcurrency || 1;
 	},
 
 	godot_js_os_download_buffer__sig: 'viiii',
@@ -128,7 +128,14 @@ bool OS_Web::is_process_running(const ProcessID &p_pid) const {
 }
 
 int OS_Web::get_processor_count() const {
-	return godot_js_os_hw_concurrency_get();
+	// Threads beyond the prewarmed pthread pool only start once the main thread yields to the browser,
+	// so a thread waited on from the main loop would never run. Don't report more than the pool can run.
+	return MIN(godot_js_os_hw_concurrency_get(), WEB_PTHREAD_POOL_SIZE);
+}
+
+int OS_Web::get_default_thread_pool_size() const {
+	// Keep the main thread's core free.
+	return MAX(1, MIN(get_processor_count() - 1, WEB_PTHREAD_POOL_SIZE - WEB_RESERVED_THREADS));
 }
 
 bool OS_Web::_check_internal_feature_support(const String &p_feature) {
@@ -38,6 +38,13 @@
 
 #include <emscripten/html5.h>
 
+#ifndef WEB_PTHREAD_POOL_SIZE
+#define WEB_PTHREAD_POOL_SIZE 8
+#endif
+
+// Prewarmed pool workers kept out of the WorkerThreadPool for the audio thread and threads started at runtime.
+#define WEB_RESERVED_THREADS 3
+
 class OS_Web : public OS_Unix {
 	MainLoop *main_loop = nullptr;
 	List<AudioDriverWeb *> audio_drivers;
@@ -81,7 +88,7 @@ public:
 	int get_process_id() const override;
 	bool is_process_running(const ProcessID &p_pid) const override;
 	int get_processor_count() const override;
-	int get_default_thread_pool_size() const override { return 1; }
+	int get_default_thread_pool_size() const override;
 
 	String get_executable_path() const override;
 	Error shell_open(String p_uri) override;
@@ -31,6 +31,7 @@
 #include "cpu_particles_2d.h"
 
 #include "core/core_string_names.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/2d/gpu_particles_2d.h"
 #include "scene/resources/particle_process_material.h"
 
@@ -625,11 +626,11 @@ void CPUParticles2D::_particles_process(double p_delta) {
 	p_delta *= speed_scale;
 
 	int pcount = particles.size();
-	Particle *w = particles.ptrw();
 
-	Particle *parray = w;
-
-	double prev_time = time;
+	ProcessState state;
+	state.particles = particles.ptrw();
+	state.delta = p_delta;
+	state.prev_time = time;
 	time += p_delta;
 	if (time > lifetime) {
 		time = Math::fmod(time, lifetime);
@@ -640,24 +641,56 @@ void CPUParticles2D::_particles_process(double p_delta) {
 		}
 	}
 
-	Transform2D emission_xform;
-	Transform2D velocity_xform;
 	if (!local_coords) {
-		emission_xform = get_global_transform();
-		velocity_xform = emission_xform;
-		velocity_xform[2] = Vector2();
+		state.emission_xform = get_global_transform();
+		state.velocity_xform = state.emission_xform;
+		state.velocity_xform[2] = Vector2();
+	}
+
+	state.system_phase = time / lifetime;
+	state.seed = Math::rand();
+
+	// Gradients sort their points lazily on first access, do it now so groups can read them concurrently.
+	if (color_ramp.is_valid()) {
+		color_ramp->get_color_at_offset(0.0);
 	}
+	if (color_initial_ramp.is_valid()) {
+		color_initial_ramp->get_color_at_offset(0.0);
+	}
+
+	uint32_t group_count = (pcount + PROCESS_GROUP_SIZE - 1) / PROCESS_GROUP_SIZE;
+	if (group_count > 1 && Thread::get_caller_id() == Thread::get_main_id()) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles2D::_particles_process_group, (const ProcessState *)&state, group_count, -1, true, SNAME("Process CPUParticles2D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
+		for (uint32_t i = 0; i < group_count; i++) {
+			_particles_process_group(i, &state);
+		}
+	}
+}
+
+void CPUParticles2D::_particles_process_group(uint32_t p_group, const ProcessState *p_state) {
+	int pcount = particles.size();
+	int from = p_group * PROCESS_GROUP_SIZE;
+	int to = MIN(from + int(PROCESS_GROUP_SIZE), pcount);
+
+	Particle *parray = p_state->particles;
+	const double prev_time = p_state->prev_time;
+	const double system_phase = p_state->system_phase;
+	const Transform2D &emission_xform = p_state->emission_xform;
+	const Transform2D &velocity_xform = p_state->velocity_xform;
 
-	double system_phase = time / lifetime;
+	// Each group draws from its own generator, so the result does not depend on how groups are spread over threads.
+	RandomPCG rng(hash_murmur3_one_32(p_group, p_state->seed));
 
-	for (int i = 0; i < pcount; i++) {
+	for (int i = from; i < to; i++) {
 		Particle &p = parray[i];
 
 		if (!emitting && !p.active) {
 			continue;
 		}
 
-		double local_delta = p_delta;
+		double local_delta = p_state->delta;
 
 		// The phase is a ratio between 0 (birth) and 1 (end of life) for each particle.
 		// While we use time in tests later on, for randomness we use the phase as done in the
@@ -732,22 +765,22 @@ void CPUParticles2D::_particles_process(double p_delta) {
 				tex_anim_offset = curve_parameters[PARAM_ANGLE]->sample(tv);
 			}
 
-			p.seed = Math::rand();
+			p.seed = rng.rand();
 
-			p.angle_rand = Math::randf();
-			p.scale_rand = Math::randf();
-			p.hue_rot_rand = Math::randf();
-			p.anim_offset_rand = Math::randf();
+			p.angle_rand = rng.randf();
+			p.scale_rand = rng.randf();
+			p.hue_rot_rand = rng.randf();
+			p.anim_offset_rand = rng.randf();
 
 			if (color_initial_ramp.is_valid()) {
-				p.start_color_rand = color_initial_ramp->get_color_at_offset(Math::randf());
+				p.start_color_rand = color_initial_ramp->get_color_at_offset(rng.randf());
 			} else {
 				p.start_color_rand = Color(1, 1, 1, 1);
 			}
 
-			real_t angle1_rad = direction.angle() + Math::deg_to_rad((Math::randf() * 2.0 - 1.0) * spread);
+			real_t angle1_rad = direction.angle() + Math::deg_to_rad((rng.randf() * 2.0 - 1.0) * spread);
 			Vector2 rot = Vector2(Math::cos(angle1_rad), Math::sin(angle1_rad));
-			p.velocity = rot * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], (real_t)Math::randf());
+			p.velocity = rot * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], (real_t)rng.randf());
 
 			real_t base_angle = tex_angle * Math::lerp(parameters_min[PARAM_ANGLE], parameters_max[PARAM_ANGLE], p.angle_rand);
 			p.rotation = Math::deg_to_rad(base_angle);
@@ -758,7 +791,7 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			p.custom[3] = 0.0;
 			p.transform = Transform2D();
 			p.time = 0;
-			p.lifetime = lifetime * (1.0 - Math::randf() * lifetime_randomness);
+			p.lifetime = lifetime * (1.0 - rng.randf() * lifetime_randomness);
 			p.base_color = Color(1, 1, 1, 1);
 
 			switch (emission_shape) {
@@ -766,17 +799,17 @@ void CPUParticles2D::_particles_process(double p_delta) {
 					//do none
 				} break;
 				case EMISSION_SHAPE_SPHERE: {
-					real_t t = Math_TAU * Math::randf();
-					real_t radius = emission_sphere_radius * Math::randf();
+					real_t t = Math_TAU * rng.randf();
+					real_t radius = emission_sphere_radius * rng.randf();
 					p.transform[2] = Vector2(Math::cos(t), Math::sin(t)) * radius;
 				} break;
 				case EMISSION_SHAPE_SPHERE_SURFACE: {
-					real_t s = Math::randf(), t = Math_TAU * Math::randf();
+					real_t s = rng.randf(), t = Math_TAU * rng.randf();
 					real_t radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform[2] = Vector2(Math::cos(t), Math::sin(t)) * radius;
 				} break;
 				case EMISSION_SHAPE_RECTANGLE: {
-					p.transform[2] = Vector2(Math::randf() * 2.0 - 1.0, Math::randf() * 2.0 - 1.0) * emission_rect_extents;
+					p.transform[2] = Vector2(rng.randf() * 2.0 - 1.0, rng.randf() * 2.0 - 1.0) * emission_rect_extents;
 				} break;
 				case EMISSION_SHAPE_POINTS:
 				case EMISSION_SHAPE_DIRECTED_POINTS: {
@@ -785,7 +818,7 @@ void CPUParticles2D::_particles_process(double p_delta) {
 						break;
 					}
 
-					int random_idx = Math::rand() % pc;
+					int random_idx = rng.rand() % pc;
 
 					p.transform[2] = emission_points.get(random_idx);
 
@@ -31,6 +31,8 @@
 #include "tile_map.h"
 
 #include "core/io/marshalls.h"
+#include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/resources/world_2d.h"
 #include "servers/navigation_server_2d.h"
 
@@ -728,6 +730,17 @@ bool TileMap::is_collision_animatable() const {
 	return collision_animatable;
 }
 
+void TileMap::set_collision_merge_enabled(bool p_enabled) {
+	collision_merge_enabled = p_enabled;
+	_clear_internals();
+	_recreate_internals();
+	emit_signal(SNAME("changed"));
+}
+
+bool TileMap::is_collision_merge_enabled() const {
+	return collision_merge_enabled;
+}
+
 void TileMap::set_collision_visibility_mode(TileMap::VisibilityMode p_show_collision) {
 	collision_visibility_mode = p_show_collision;
 	_clear_internals();
@@ -818,6 +831,34 @@ void TileMap::_queue_update_dirty_quadrants() {
 	call_deferred(SNAME("_update_dirty_quadrants"));
 }
 
+void TileMap::_run_quadrant_update_task(void (TileMap::*p_method)(uint32_t, QuadrantUpdate *), LocalVector<QuadrantUpdate> &r_updates) {
+	if (r_updates.size() >= QUADRANT_UPDATE_MIN_PARALLEL_SIZE && Thread::get_caller_id() == Thread::get_main_id()) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(this, p_method, r_updates.ptr(), r_updates.size(), -1, true, SNAME("Update TileMap quadrants"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
+		for (uint32_t i = 0; i < r_updates.size(); i++) {
+			(this->*p_method)(i, r_updates.ptr());
+		}
+	}
+}
+
+void TileMap::_update_quadrant_coords_cache(uint32_t p_index, QuadrantUpdate *p_updates) {
+	TileMapQuadrant &q = *p_updates[p_index].quadrant;
+	q.map_to_local.clear();
+	q.local_to_map.clear();
+	for (const Vector2i &E : q.cells) {
+		Vector2i pk = E;
+		Vector2i pk_local_coords = map_to_local(pk);
+		q.map_to_local[pk] = pk_local_coords;
+		q.local_to_map[pk_local_coords] = pk;
+	}
+}
+
+void TileMap::_build_quadrant_update(uint32_t p_index, QuadrantUpdate *p_updates) {
+	_rendering_build_quadrant_update(p_updates[p_index]);
+	_physics_build_quadrant_update(p_updates[p_index]);
+}
+
 void TileMap::_update_dirty_quadrants() {
 	if (!pending_update) {
 		return;
@@ -827,27 +868,31 @@ void TileMap::_update_dirty_quadrants() {
 		return;
 	}
 
+	LocalVector<QuadrantUpdate> quadrant_updates;
 	for (unsigned int layer = 0; layer < layers.size(); layer++) {
 		SelfList<TileMapQuadrant>::List &dirty_quadrant_list = layers[layer].dirty_quadrant_list;
 
-		// Update the coords cache.
+		uint32_t dirty_quadrant_count = 0;
 		for (SelfList<TileMapQuadrant> *q = dirty_quadrant_list.first(); q; q = q->next()) {
-			q->self()->map_to_local.clear();
-			q->self()->local_to_map.clear();
-			for (const Vector2i &E : q->self()->cells) {
-				Vector2i pk = E;
-				Vector2i pk_local_coords = map_to_local(pk);
-				q->self()->map_to_local[pk] = pk_local_coords;
-				q->self()->local_to_map[pk_local_coords] = pk;
-			}
+			dirty_quadrant_count++;
+		}
+		quadrant_updates.clear();
+		quadrant_updates.resize(dirty_quadrant_count);
+		uint32_t quadrant_index = 0;
+		for (SelfList<TileMapQuadrant> *q = dirty_quadrant_list.first(); q; q = q->next()) {
+			quadrant_updates[quadrant_index++].quadrant = q->self();
 		}
 
+		// Update the coords cache.
+		_run_quadrant_update_task(&TileMap::_update_quadrant_coords_cache, quadrant_updates);
+
 		// Find TileData that need a runtime modification.
 		_build_runtime_update_tile_data(dirty_quadrant_list);
 
-		// Call the update_dirty_quadrant method on plugins.
-		_rendering_update_dirty_quadrants(dirty_quadrant_list);
-		_physics_update_dirty_quadrants(dirty_quadrant_list);
+		// Gather what the rendering and physics updates need, then call the update_dirty_quadrant method on plugins.
+		_run_quadrant_update_task(&TileMap::_build_quadrant_update, quadrant_updates);
+		_rendering_update_dirty_quadrants(quadrant_updates);
+		_physics_update_dirty_quadrants(quadrant_updates);
 		_navigation_update_dirty_quadrants(dirty_quadrant_list);
 		_scenes_update_dirty_quadrants(dirty_quadrant_list);
 
@@ -1114,17 +1159,115 @@ void TileMap::_rendering_cleanup_layer(int p_layer) {
 	}
 }
 
-void TileMap::_rendering_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r_dirty_quadrant_list) {
+void TileMap::_rendering_build_quadrant_update(QuadrantUpdate &r_update) const {
+	const TileMapQuadrant &q = *r_update.quadrant;
+
+	Color tile_modulate = get_self_modulate();
+	tile_modulate *= get_layer_modulate(q.layer);
+	if (selected_layer >= 0) {
+		int z1 = get_layer_z_index(q.layer);
+		int z2 = get_layer_z_index(selected_layer);
+		if (z1 < z2 || (z1 == z2 && q.layer < selected_layer)) {
+			tile_modulate = tile_modulate.darkened(0.5);
+		} else if (z1 > z2 || (z1 == z2 && q.layer > selected_layer)) {
+			tile_modulate = tile_modulate.darkened(0.5);
+			tile_modulate.a *= 0.3;
+		}
+	}
+	r_update.tile_modulate = tile_modulate;
+
+	// Those allow to group cell per material or z-index.
+	Ref<Material> prev_material;
+	int prev_z_index = 0;
+
+	// Iterate over the cells of the quadrant.
+	for (const KeyValue<Vector2i, Vector2i> &E_cell : q.local_to_map) {
+		TileMapCell c = get_cell(q.layer, E_cell.value, true);
+
+		TileSetSource *source;
+		if (tile_set->has_source(c.source_id)) {
+			source = *tile_set->get_source(c.source_id);
+
+			if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
+				continue;
+			}
+
+			TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
+			if (atlas_source) {
+				// Get the tile data.
+				const TileData *tile_data;
+				if (q.runtime_tile_data_cache.has(E_cell.value)) {
+					tile_data = q.runtime_tile_data_cache[E_cell.value];
+				} else {
+					tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+				}
+
+				Ref<Material> mat = tile_data->get_material();
+				int tile_z_index = tile_data->get_z_index();
+
+				// Quandrant pos.
+				Vector2 tile_position = map_to_local(q.coords * get_effective_quadrant_size(q.layer));
+				if (is_y_sort_enabled() && layers[q.layer].y_sort_enabled) {
+					// When Y-sorting, the quandrant size is sure to be 1, we can thus offset the CanvasItem.
+					tile_position.y += layers[q.layer].y_sort_origin + tile_data->get_y_sort_origin();
+				}
+
+				// --- CanvasItems ---
+				// Check if the material or the z_index changed.
+				if (r_update.canvas_items.is_empty() || prev_material != mat || prev_z_index != tile_z_index) {
+					// If so, a new CanvasItem is needed.
+					QuadrantUpdate::RenderingCanvasItem canvas_item;
+					canvas_item.material = mat;
+					canvas_item.z_index = tile_z_index;
+					canvas_item.position = tile_position;
+					r_update.canvas_items.push_back(canvas_item);
+
+					prev_material = mat;
+					prev_z_index = tile_z_index;
+				}
+
+				QuadrantUpdate::RenderingTile tile;
+				tile.position = E_cell.key - tile_position;
+				tile.source_id = c.source_id;
+				tile.atlas_coords = c.get_atlas_coords();
+				tile.alternative_tile = c.alternative_tile;
+				tile.tile_data = tile_data;
+				r_update.tiles.push_back(tile);
+				r_update.canvas_items[r_update.canvas_items.size() - 1].tile_count++;
+
+				// --- Occluders ---
+				for (int i = 0; i < tile_set->get_occlusion_layers_count(); i++) {
+					Ref<OccluderPolygon2D> occluder = tile_data->get_occluder(i);
+					if (occluder.is_valid()) {
+						QuadrantUpdate::RenderingOccluder rendering_occluder;
+						rendering_occluder.coords = E_cell.value;
+						rendering_occluder.position = E_cell.key;
+						rendering_occluder.polygon = occluder->get_rid();
+						rendering_occluder.occlusion_layer = i;
+						r_update.occluders.push_back(rendering_occluder);
+					}
+				}
+			}
+		}
+	}
+}
+
+void TileMap::_rendering_update_dirty_quadrants(LocalVector<QuadrantUpdate> &r_updates) {
 	ERR_FAIL_COND(!is_inside_tree());
 	ERR_FAIL_COND(!tile_set.is_valid());
 
 	bool node_visible = is_visible_in_tree();
 
-	SelfList<TileMapQuadrant> *q_list_element = r_dirty_quadrant_list.first();
-	while (q_list_element) {
-		TileMapQuadrant &q = *q_list_element->self();
+	RenderingServer *rs = RenderingServer::get_singleton();
+	Transform2D gl_transform = get_global_transform();
+	bool use_parent_material = get_use_parent_material() || get_material().is_valid();
+	int light_mask = get_light_mask();
+	RS::CanvasItemTextureFilter texture_filter = RS::CanvasItemTextureFilter(get_texture_filter_in_tree());
+	RS::CanvasItemTextureRepeat texture_repeat = RS::CanvasItemTextureRepeat(get_texture_repeat_in_tree());
 
-		RenderingServer *rs = RenderingServer::get_singleton();
+	for (uint32_t update_index = 0; update_index < r_updates.size(); update_index++) {
+		const QuadrantUpdate &update = r_updates[update_index];
+		TileMapQuadrant &q = *update.quadrant;
 
 		// Free the canvas items.
 		for (const RID &ci : q.canvas_items) {
@@ -1138,115 +1281,52 @@ void TileMap::_rendering_update_dirty_quadrants(SelfList<TileMapQuadrant>::List
 		}
 		q.occluders.clear();
 
-		// Those allow to group cell per material or z-index.
-		Ref<Material> prev_material;
-		int prev_z_index = 0;
-		RID prev_ci;
+		uint32_t tile_index = 0;
+		for (uint32_t canvas_item_index = 0; canvas_item_index < update.canvas_items.size(); canvas_item_index++) {
+			const QuadrantUpdate::RenderingCanvasItem &canvas_item = update.canvas_items[canvas_item_index];
 
-		Color tile_modulate = get_self_modulate();
-		tile_modulate *= get_layer_modulate(q.layer);
-		if (selected_layer >= 0) {
-			int z1 = get_layer_z_index(q.layer);
-			int z2 = get_layer_z_index(selected_layer);
-			if (z1 < z2 || (z1 == z2 && q.layer < selected_layer)) {
-				tile_modulate = tile_modulate.darkened(0.5);
-			} else if (z1 > z2 || (z1 == z2 && q.layer > selected_layer)) {
-				tile_modulate = tile_modulate.darkened(0.5);
-				tile_modulate.a *= 0.3;
+			RID ci = rs->canvas_item_create();
+			if (canvas_item.material.is_valid()) {
+				rs->canvas_item_set_material(ci, canvas_item.material->get_rid());
 			}
-		}
-
-		// Iterate over the cells of the quadrant.
-		for (const KeyValue<Vector2i, Vector2i> &E_cell : q.local_to_map) {
-			TileMapCell c = get_cell(q.layer, E_cell.value, true);
-
-			TileSetSource *source;
-			if (tile_set->has_source(c.source_id)) {
-				source = *tile_set->get_source(c.source_id);
-
-				if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
-					continue;
-				}
-
-				TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
-				if (atlas_source) {
-					// Get the tile data.
-					const TileData *tile_data;
-					if (q.runtime_tile_data_cache.has(E_cell.value)) {
-						tile_data = q.runtime_tile_data_cache[E_cell.value];
-					} else {
-						tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
-					}
-
-					Ref<Material> mat = tile_data->get_material();
-					int tile_z_index = tile_data->get_z_index();
-
-					// Quandrant pos.
-					Vector2 tile_position = map_to_local(q.coords * get_effective_quadrant_size(q.layer));
-					if (is_y_sort_enabled() && layers[q.layer].y_sort_enabled) {
-						// When Y-sorting, the quandrant size is sure to be 1, we can thus offset the CanvasItem.
-						tile_position.y += layers[q.layer].y_sort_origin + tile_data->get_y_sort_origin();
-					}
-
-					// --- CanvasItems ---
-					// Create two canvas items, for rendering and debug.
-					RID ci;
-
-					// Check if the material or the z_index changed.
-					if (prev_ci == RID() || prev_material != mat || prev_z_index != tile_z_index) {
-						// If so, create a new CanvasItem.
-						ci = rs->canvas_item_create();
-						if (mat.is_valid()) {
-							rs->canvas_item_set_material(ci, mat->get_rid());
-						}
-						rs->canvas_item_set_parent(ci, layers[q.layer].canvas_item);
-						rs->canvas_item_set_use_parent_material(ci, get_use_parent_material() || get_material().is_valid());
+			rs->canvas_item_set_parent(ci, layers[q.layer].canvas_item);
+			rs->canvas_item_set_use_parent_material(ci, use_parent_material);
 
-						Transform2D xform;
-						xform.set_origin(tile_position);
-						rs->canvas_item_set_transform(ci, xform);
-
-						rs->canvas_item_set_light_mask(ci, get_light_mask());
-						rs->canvas_item_set_z_as_relative_to_parent(ci, true);
-						rs->canvas_item_set_z_index(ci, tile_z_index);
+			Transform2D xform;
+			xform.set_origin(canvas_item.position);
+			rs->canvas_item_set_transform(ci, xform);
 
-						rs->canvas_item_set_default_texture_filter(ci, RS::CanvasItemTextureFilter(get_texture_filter_in_tree()));
-						rs->canvas_item_set_default_texture_repeat(ci, RS::CanvasItemTextureRepeat(get_texture_repeat_in_tree()));
+			rs->canvas_item_set_light_mask(ci, light_mask);
+			rs->canvas_item_set_z_as_relative_to_parent(ci, true);
+			rs->canvas_item_set_z_index(ci, canvas_item.z_index);
 
-						q.canvas_items.push_back(ci);
+			rs->canvas_item_set_default_texture_filter(ci, texture_filter);
+			rs->canvas_item_set_default_texture_repeat(ci, texture_repeat);
 
-						prev_ci = ci;
-						prev_material = mat;
-						prev_z_index = tile_z_index;
+			q.canvas_items.push_back(ci);
 
-					} else {
-						// Keep the same canvas_item to draw on.
-						ci = prev_ci;
-					}
+			// Drawing the tiles in the canvas item.
+			for (uint32_t i = 0; i < canvas_item.tile_count; i++) {
+				const QuadrantUpdate::RenderingTile &tile = update.tiles[tile_index++];
+				draw_tile(ci, tile.position, tile_set, tile.source_id, tile.atlas_coords, tile.alternative_tile, -1, update.tile_modulate, tile.tile_data);
+			}
+		}
 
-					// Drawing the tile in the canvas item.
-					draw_tile(ci, E_cell.key - tile_position, tile_set, c.source_id, c.get_atlas_coords(), c.alternative_tile, -1, tile_modulate, tile_data);
+		for (uint32_t occluder_index = 0; occluder_index < update.occluders.size(); occluder_index++) {
+			const QuadrantUpdate::RenderingOccluder &occluder = update.occluders[occluder_index];
 
-					// --- Occluders ---
-					for (int i = 0; i < tile_set->get_occlusion_layers_count(); i++) {
-						Transform2D xform;
-						xform.set_origin(E_cell.key);
-						if (tile_data->get_occluder(i).is_valid()) {
-							RID occluder_id = rs->canvas_light_occluder_create();
-							rs->canvas_light_occluder_set_enabled(occluder_id, node_visible);
-							rs->canvas_light_occluder_set_transform(occluder_id, get_global_transform() * xform);
-							rs->canvas_light_occluder_set_polygon(occluder_id, tile_data->get_occluder(i)->get_rid());
-							rs->canvas_light_occluder_attach_to_canvas(occluder_id, get_canvas());
-							rs->canvas_light_occluder_set_light_mask(occluder_id, tile_set->get_occlusion_layer_light_mask(i));
-							q.occluders[E_cell.value] = occluder_id;
-						}
-					}
-				}
-			}
+			Transform2D xform;
+			xform.set_origin(occluder.position);
+			RID occluder_id = rs->canvas_light_occluder_create();
+			rs->canvas_light_occluder_set_enabled(occluder_id, node_visible);
+			rs->canvas_light_occluder_set_transform(occluder_id, gl_transform * xform);
+			rs->canvas_light_occluder_set_polygon(occluder_id, occluder.polygon);
+			rs->canvas_light_occluder_attach_to_canvas(occluder_id, get_canvas());
+			rs->canvas_light_occluder_set_light_mask(occluder_id, tile_set->get_occlusion_layer_light_mask(occluder.occlusion_layer));
+			q.occluders[occluder.coords] = occluder_id;
 		}
 
 		_rendering_quadrant_order_dirty = true;
-		q_list_element = q_list_element->next();
 	}
 
 	// Reset the drawing indices
@@ -1494,7 +1574,179 @@ void TileMap::_physics_notification(int p_what) {
 	}
 }
 
-void TileMap::_physics_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r_dirty_quadrant_list) {
+// Unions the polygons that overlap or share an edge. Each merged polygon keeps the indices of the polygons it was
+// built from, in case it can't be decomposed into convex shapes.
+void TileMap::_physics_merge_polygons(const LocalVector<Vector<Vector2>> &p_polygons, LocalVector<Vector<Vector2>> &r_merged, LocalVector<LocalVector<uint32_t>> &r_sources) {
+	LocalVector<Rect2> rects;
+	for (uint32_t polygon_index = 0; polygon_index < p_polygons.size(); polygon_index++) {
+		Vector<Vector2> polygon = p_polygons[polygon_index];
+		LocalVector<uint32_t> sources;
+		sources.push_back(polygon_index);
+
+		Rect2 rect(polygon[0], Vector2());
+		for (int i = 1; i < polygon.size(); i++) {
+			rect.expand_to(polygon[i]);
+		}
+
+		bool merged = true;
+		while (merged) {
+			merged = false;
+			for (uint32_t i = 0; i < r_merged.size(); i++) {
+				if (!rects[i].intersects(rect, true)) {
+					continue;
+				}
+				// Disjoint polygons give two results, unions with holes too. Keep those apart.
+				Vector<Vector<Vector2>> result = Geometry2D::merge_polygons(r_merged[i], polygon);
+				if (result.size() != 1) {
+					continue;
+				}
+				polygon = result[0];
+				rect = rect.merge(rects[i]);
+				for (uint32_t j = 0; j < r_sources[i].size(); j++) {
+					sources.push_back(r_sources[i][j]);
+				}
+				r_merged.remove_at_unordered(i);
+				r_sources.remove_at_unordered(i);
+				rects.remove_at_unordered(i);
+				merged = true;
+				break;
+			}
+		}
+
+		r_merged.push_back(polygon);
+		r_sources.push_back(sources);
+		rects.push_back(rect);
+	}
+}
+
+void TileMap::_physics_add_convex_shapes(const Vector<Vector<Vector2>> &p_decomposition, LocalVector<QuadrantUpdate::PhysicsShape> &r_shapes) {
+	for (int i = 0; i < p_decomposition.size(); i++) {
+		QuadrantUpdate::PhysicsShape shape;
+		shape.points = p_decomposition[i];
+		if (Geometry2D::is_polygon_clockwise(shape.points)) { // Needs to be counter clockwise.
+			shape.points.reverse();
+		}
+		r_shapes.push_back(shape);
+	}
+}
+
+void TileMap::_physics_build_quadrant_update(QuadrantUpdate &r_update) const {
+	const TileMapQuadrant &q = *r_update.quadrant;
+
+	// Polygons to merge, per TileSet physics layer, relative to the first cell they come from.
+	LocalVector<LocalVector<Vector<Vector2>>> merge_polygons;
+	LocalVector<Vector2i> merge_coords;
+	if (collision_merge_enabled) {
+		merge_polygons.resize(tile_set->get_physics_layers_count());
+		merge_coords.resize(tile_set->get_physics_layers_count());
+	}
+
+	for (const Vector2i &E_cell : q.cells) {
+		TileMapCell c = get_cell(q.layer, E_cell, true);
+
+		TileSetSource *source;
+		if (tile_set->has_source(c.source_id)) {
+			source = *tile_set->get_source(c.source_id);
+
+			if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
+				continue;
+			}
+
+			TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
+			if (atlas_source) {
+				const TileData *tile_data;
+				if (q.runtime_tile_data_cache.has(E_cell)) {
+					tile_data = q.runtime_tile_data_cache[E_cell];
+				} else {
+					tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+				}
+				for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+					QuadrantUpdate::PhysicsBody body;
+					body.coords = E_cell;
+					body.position = map_to_local(E_cell);
+					body.physics_layer = tile_set_physics_layer;
+					body.linear_velocity = tile_data->get_constant_linear_velocity(tile_set_physics_layer);
+					body.angular_velocity = tile_data->get_constant_angular_velocity(tile_set_physics_layer);
+
+					// Only solid tiles that don't move what they touch can share a body with their neighbors.
+					bool mergeable = collision_merge_enabled && body.linear_velocity == Vector2() && body.angular_velocity == 0.0;
+
+					for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
+						// Iterate over the polygons.
+						bool one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
+						float one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
+
+						if (mergeable && !one_way_collision) {
+							Vector<Vector2> polygon = tile_data->get_collision_polygon_points(tile_set_physics_layer, polygon_index);
+							if (polygon.size() >= 3) {
+								if (merge_polygons[tile_set_physics_layer].is_empty()) {
+									merge_coords[tile_set_physics_layer] = E_cell;
+								}
+								Vector2 offset = body.position - map_to_local(merge_coords[tile_set_physics_layer]);
+								Vector2 *points = polygon.ptrw();
+								for (int i = 0; i < polygon.size(); i++) {
+									points[i] += offset;
+								}
+								merge_polygons[tile_set_physics_layer].push_back(polygon);
+							}
+							continue;
+						}
+
+						int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
+						for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
+							// Add decomposed convex shapes.
+							QuadrantUpdate::PhysicsShape shape;
+							shape.shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index)->get_rid();
+							shape.one_way_collision = one_way_collision;
+							shape.one_way_collision_margin = one_way_collision_margin;
+							r_update.shapes.push_back(shape);
+							body.shape_count++;
+						}
+					}
+
+					// Merged tiles that are left with nothing to collide with on their own don't need a body.
+					if (!mergeable || body.shape_count > 0) {
+						r_update.bodies.push_back(body);
+					}
+				}
+			}
+		}
+	}
+
+	// One body per physics layer holds the merged shapes.
+	for (uint32_t tile_set_physics_layer = 0; tile_set_physics_layer < merge_polygons.size(); tile_set_physics_layer++) {
+		const LocalVector<Vector<Vector2>> &polygons = merge_polygons[tile_set_physics_layer];
+		if (polygons.is_empty()) {
+			continue;
+		}
+
+		LocalVector<Vector<Vector2>> merged;
+		LocalVector<LocalVector<uint32_t>> sources;
+		_physics_merge_polygons(polygons, merged, sources);
+
+		QuadrantUpdate::PhysicsBody body;
+		body.coords = merge_coords[tile_set_physics_layer];
+		body.position = map_to_local(body.coords);
+		body.physics_layer = tile_set_physics_layer;
+
+		uint32_t first_shape = r_update.shapes.size();
+		for (uint32_t i = 0; i < merged.size(); i++) {
+			Vector<Vector<Vector2>> decomposition = Geometry2D::decompose_polygon_in_convex(merged[i]);
+			if (!decomposition.is_empty()) {
+				_physics_add_convex_shapes(decomposition, r_update.shapes);
+				continue;
+			}
+			// Fall back to the polygons of the tiles if the union is degenerate.
+			for (uint32_t j = 0; j < sources[i].size(); j++) {
+				_physics_add_convex_shapes(Geometry2D::decompose_polygon_in_convex(polygons[sources[i][j]]), r_update.shapes);
+			}
+		}
+		body.shape_count = r_update.shapes.size() - first_shape;
+		r_update.bodies.push_back(body);
+	}
+}
+
+void TileMap::_physics_update_dirty_quadrants(LocalVector<QuadrantUpdate> &r_updates) {
 	ERR_FAIL_COND(!is_inside_tree());
 	ERR_FAIL_COND(!tile_set.is_valid());
 
@@ -1504,9 +1756,9 @@ void TileMap::_physics_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r
 	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
 	RID space = get_world_2d()->get_space();
 
-	SelfList<TileMapQuadrant> *q_list_element = r_dirty_quadrant_list.first();
-	while (q_list_element) {
-		TileMapQuadrant &q = *q_list_element->self();
+	for (uint32_t update_index = 0; update_index < r_updates.size(); update_index++) {
+		const QuadrantUpdate &update = r_updates[update_index];
+		TileMapQuadrant &q = *update.quadrant;
 
 		// Clear bodies.
 		for (RID body : q.bodies) {
@@ -1514,82 +1766,60 @@ void TileMap::_physics_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r
 			ps->free(body);
 		}
 		q.bodies.clear();
+		for (RID shape : q.merged_shapes) {
+			ps->free(shape);
+		}
+		q.merged_shapes.clear();
 
 		// Recreate bodies and shapes.
-		for (const Vector2i &E_cell : q.cells) {
-			TileMapCell c = get_cell(q.layer, E_cell, true);
-
-			TileSetSource *source;
-			if (tile_set->has_source(c.source_id)) {
-				source = *tile_set->get_source(c.source_id);
-
-				if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
-					continue;
-				}
-
-				TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
-				if (atlas_source) {
-					const TileData *tile_data;
-					if (q.runtime_tile_data_cache.has(E_cell)) {
-						tile_data = q.runtime_tile_data_cache[E_cell];
-					} else {
-						tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
-					}
-					for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
-						Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(tile_set_physics_layer);
-						uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(tile_set_physics_layer);
-						uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(tile_set_physics_layer);
+		uint32_t shape_index = 0;
+		for (uint32_t body_index = 0; body_index < update.bodies.size(); body_index++) {
+			const QuadrantUpdate::PhysicsBody &body_update = update.bodies[body_index];
+			Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(body_update.physics_layer);
+			uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(body_update.physics_layer);
+			uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(body_update.physics_layer);
+
+			// Create the body.
+			RID body = ps->body_create();
+			bodies_coords[body] = body_update.coords;
+			ps->body_set_mode(body, collision_animatable ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
+			ps->body_set_space(body, space);
 
-						// Create the body.
-						RID body = ps->body_create();
-						bodies_coords[body] = E_cell;
-						ps->body_set_mode(body, collision_animatable ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
-						ps->body_set_space(body, space);
+			Transform2D xform;
+			xform.set_origin(body_update.position);
+			xform = gl_transform * xform;
+			ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
+
+			ps->body_attach_object_instance_id(body, get_instance_id());
+			ps->body_set_collision_layer(body, physics_layer);
+			ps->body_set_collision_mask(body, physics_mask);
+			ps->body_set_pickable(body, false);
+			ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, body_update.linear_velocity);
+			ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, body_update.angular_velocity);
+
+			if (!physics_material.is_valid()) {
+				ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
+				ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
+			} else {
+				ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
+				ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
+			}
 
-						Transform2D xform;
-						xform.set_origin(map_to_local(E_cell));
-						xform = gl_transform * xform;
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-
-						ps->body_attach_object_instance_id(body, get_instance_id());
-						ps->body_set_collision_layer(body, physics_layer);
-						ps->body_set_collision_mask(body, physics_mask);
-						ps->body_set_pickable(body, false);
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, tile_data->get_constant_linear_velocity(tile_set_physics_layer));
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, tile_data->get_constant_angular_velocity(tile_set_physics_layer));
-
-						if (!physics_material.is_valid()) {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
-						} else {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
-						}
+			q.bodies.push_back(body);
 
-						q.bodies.push_back(body);
-
-						// Add the shapes to the body.
-						int body_shape_index = 0;
-						for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
-							// Iterate over the polygons.
-							bool one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
-							float one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
-							int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
-							for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
-								// Add decomposed convex shapes.
-								Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index);
-								ps->body_add_shape(body, shape->get_rid());
-								ps->body_set_shape_as_one_way_collision(body, body_shape_index, one_way_collision, one_way_collision_margin);
-
-								body_shape_index++;
-							}
-						}
-					}
+			// Add the shapes to the body.
+			for (uint32_t body_shape_index = 0; body_shape_index < body_update.shape_count; body_shape_index++) {
+				const QuadrantUpdate::PhysicsShape &shape = update.shapes[shape_index++];
+				RID shape_rid = shape.shape;
+				if (!shape_rid.is_valid()) {
+					shape_rid = ps->convex_polygon_shape_create();
+					ps->shape_set_data(shape_rid, shape.points);
+					q.merged_shapes.push_back(shape_rid);
 				}
+				ps->body_add_shape(body, shape_rid);
+				ps->body_set_shape_as_one_way_collision(body, body_shape_index, shape.one_way_collision, shape.one_way_collision_margin);
 			}
 		}
-
-		q_list_element = q_list_element->next();
 	}
 }
 
@@ -1600,6 +1830,10 @@ void TileMap::_physics_cleanup_quadrant(TileMapQuadrant *p_quadrant) {
 		PhysicsServer2D::get_singleton()->free(body);
 	}
 	p_quadrant->bodies.clear();
+	for (RID shape : p_quadrant->merged_shapes) {
+		PhysicsServer2D::get_singleton()->free(shape);
+	}
+	p_quadrant->merged_shapes.clear();
 }
 
 void TileMap::_physics_draw_quadrant_debug(TileMapQuadrant *p_quadrant) {
@@ -1981,36 +2215,38 @@ void TileMap::_scenes_draw_quadrant_debug(TileMapQuadrant *p_quadrant) {
 	}
 }
 
-void TileMap::set_cell(int p_layer, const Vector2i &p_coords, int p_source_id, const Vector2i p_atlas_coords, int p_alternative_tile) {
-	ERR_FAIL_INDEX(p_layer, (int)layers.size());
+bool TileMap::_sanitize_cell(int &r_source_id, Vector2i &r_atlas_coords, int &r_alternative_tile) {
+	if ((r_source_id == TileSet::INVALID_SOURCE || r_atlas_coords == TileSetSource::INVALID_ATLAS_COORDS || r_alternative_tile == TileSetSource::INVALID_TILE_ALTERNATIVE) &&
+			(r_source_id != TileSet::INVALID_SOURCE || r_atlas_coords != TileSetSource::INVALID_ATLAS_COORDS || r_alternative_tile != TileSetSource::INVALID_TILE_ALTERNATIVE)) {
+		r_source_id = TileSet::INVALID_SOURCE;
+		r_atlas_coords = TileSetSource::INVALID_ATLAS_COORDS;
+		r_alternative_tile = TileSetSource::INVALID_TILE_ALTERNATIVE;
+		return true;
+	}
+	return false;
+}
 
+void TileMap::_set_cell(int p_layer, const Vector2i &p_coords, int p_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile, QuadrantCache &r_cache) {
 	// Set the current cell tile (using integer position).
 	HashMap<Vector2i, TileMapCell> &tile_map = layers[p_layer].tile_map;
 	Vector2i pk(p_coords);
 	HashMap<Vector2i, TileMapCell>::Iterator E = tile_map.find(pk);
 
-	int source_id = p_source_id;
-	Vector2i atlas_coords = p_atlas_coords;
-	int alternative_tile = p_alternative_tile;
-
-	if ((source_id == TileSet::INVALID_SOURCE || atlas_coords == TileSetSource::INVALID_ATLAS_COORDS || alternative_tile == TileSetSource::INVALID_TILE_ALTERNATIVE) &&
-			(source_id != TileSet::INVALID_SOURCE || atlas_coords != TileSetSource::INVALID_ATLAS_COORDS || alternative_tile != TileSetSource::INVALID_TILE_ALTERNATIVE)) {
-		WARN_PRINT("Setting a cell as empty requires both source_id, atlas_coord and alternative_tile to be set to their respective \"invalid\" values. Values were thus changes accordingly.");
-		source_id = TileSet::INVALID_SOURCE;
-		atlas_coords = TileSetSource::INVALID_ATLAS_COORDS;
-		alternative_tile = TileSetSource::INVALID_TILE_ALTERNATIVE;
-	}
-
-	if (!E && source_id == TileSet::INVALID_SOURCE) {
+	if (!E && p_source_id == TileSet::INVALID_SOURCE) {
 		return; // Nothing to do, the tile is already empty.
 	}
 
 	// Get the quadrant
 	Vector2i qk = _coords_to_quadrant_coords(p_layer, pk);
 
-	HashMap<Vector2i, TileMapQuadrant>::Iterator Q = layers[p_layer].quadrant_map.find(qk);
+	if (r_cache.layer != p_layer || r_cache.coords != qk) {
+		r_cache.layer = p_layer;
+		r_cache.coords = qk;
+		r_cache.quadrant = layers[p_layer].quadrant_map.find(qk);
+	}
+	HashMap<Vector2i, TileMapQuadrant>::Iterator Q = r_cache.quadrant;
 
-	if (source_id == TileSet::INVALID_SOURCE) {
+	if (p_source_id == TileSet::INVALID_SOURCE) {
 		// Erase existing cell in the tile map.
 		tile_map.erase(pk);
 
@@ -2023,6 +2259,7 @@ void TileMap::set_cell(int p_layer, const Vector2i &p_coords, int p_source_id, c
 		// Remove or make the quadrant dirty.
 		if (q.cells.size() == 0) {
 			_erase_quadrant(Q);
+			r_cache.quadrant = HashMap<Vector2i, TileMapQuadrant>::Iterator();
 		} else {
 			_make_quadrant_dirty(Q);
 		}
@@ -2036,6 +2273,7 @@ void TileMap::set_cell(int p_layer, const Vector2i &p_coords, int p_source_id, c
 			// Create a new quadrant if needed, then insert the cell if needed.
 			if (!Q) {
 				Q = _create_quadrant(p_layer, qk);
+				r_cache.quadrant = Q;
 			}
 			TileMapQuadrant &q = Q->value;
 			q.cells.insert(pk);
@@ -2043,26 +2281,135 @@ void TileMap::set_cell(int p_layer, const Vector2i &p_coords, int p_source_id, c
 		} else {
 			ERR_FAIL_COND(!Q); // TileMapQuadrant should exist...
 
-			if (E->value.source_id == source_id && E->value.get_atlas_coords() == atlas_coords && E->value.alternative_tile == alternative_tile) {
+			if (E->value.source_id == p_source_id && E->value.get_atlas_coords() == p_atlas_coords && E->value.alternative_tile == p_alternative_tile) {
 				return; // Nothing changed.
 			}
 		}
 
 		TileMapCell &c = E->value;
 
-		c.source_id = source_id;
-		c.set_atlas_coords(atlas_coords);
-		c.alternative_tile = alternative_tile;
+		c.source_id = p_source_id;
+		c.set_atlas_coords(p_atlas_coords);
+		c.alternative_tile = p_alternative_tile;
 
 		_make_quadrant_dirty(Q);
 		used_rect_cache_dirty = true;
 	}
 }
 
+void TileMap::set_cell(int p_layer, const Vector2i &p_coords, int p_source_id, const Vector2i p_atlas_coords, int p_alternative_tile) {
+	ERR_FAIL_INDEX(p_layer, (int)layers.size());
+
+	int source_id = p_source_id;
+	Vector2i atlas_coords = p_atlas_coords;
+	int alternative_tile = p_alternative_tile;
+	if (_sanitize_cell(source_id, atlas_coords, alternative_tile)) {
+		WARN_PRINT("Setting a cell as empty requires both source_id, atlas_coord and alternative_tile to be set to their respective \"invalid\" values. Values were thus changes accordingly.");
+	}
+
+	QuadrantCache cache;
+	_set_cell(p_layer, p_coords, source_id, atlas_coords, alternative_tile, cache);
+}
+
 void TileMap::erase_cell(int p_layer, const Vector2i &p_coords) {
 	set_cell(p_layer, p_coords, TileSet::INVALID_SOURCE, TileSetSource::INVALID_ATLAS_COORDS, TileSetSource::INVALID_TILE_ALTERNATIVE);
 }
 
+void TileMap::set_cells_packed(int p_layer, const PackedInt32Array &p_coords, const PackedInt32Array &p_source_ids, const PackedInt32Array &p_atlas_coords, const PackedInt32Array &p_alternative_tiles) {
+	ERR_FAIL_INDEX(p_layer, (int)layers.size());
+	// Coords are stored as consecutive x and y values.
+	int cell_count = p_source_ids.size();
+	ERR_FAIL_COND_MSG(p_coords.size() != cell_count * 2 || p_atlas_coords.size() != cell_count * 2 || p_alternative_tiles.size() != cell_count, "The coords and atlas_coords arrays must hold two values per cell, the source_ids and alternative_tiles arrays one value per cell.");
+
+	const int32_t *coords = p_coords.ptr();
+	const int32_t *source_ids = p_source_ids.ptr();
+	const int32_t *atlas_coords = p_atlas_coords.ptr();
+	const int32_t *alternative_tiles = p_alternative_tiles.ptr();
+
+	QuadrantCache cache;
+	int sanitized_count = 0;
+	for (int i = 0; i < cell_count; i++) {
+		int source_id = source_ids[i];
+		Vector2i atlas(atlas_coords[i * 2], atlas_coords[i * 2 + 1]);
+		int alternative_tile = alternative_tiles[i];
+		if (_sanitize_cell(source_id, atlas, alternative_tile)) {
+			sanitized_count++;
+		}
+		_set_cell(p_layer, Vector2i(coords[i * 2], coords[i * 2 + 1]), source_id, atlas, alternative_tile, cache);
+	}
+
+	if (sanitized_count > 0) {
+		WARN_PRINT(vformat("%d cells were set as empty, as setting a cell as empty requires both source_id, atlas_coord and alternative_tile to be set to their respective \"invalid\" values.", sanitized_count));
+	}
+}
+
+void TileMap::fill_cells(int p_layer, const Rect2i &p_rect, int p_source_id, const Vector2i p_atlas_coords, int p_alternative_tile) {
+	ERR_FAIL_INDEX(p_layer, (int)layers.size());
+	ERR_FAIL_COND_MSG(p_rect.size.x < 0 || p_rect.size.y < 0, "Rect2i size is negative, this is not supported. Use Rect2i.abs() to get a Rect2i with a positive size.");
+	if (!p_rect.has_area()) {
+		return;
+	}
+
+	int source_id = p_source_id;
+	Vector2i atlas_coords = p_atlas_coords;
+	int alternative_tile = p_alternative_tile;
+	if (_sanitize_cell(source_id, atlas_coords, alternative_tile)) {
+		WARN_PRINT("Setting a cell as empty requires both source_id, atlas_coord and alternative_tile to be set to their respective \"invalid\" values. Values were thus changes accordingly.");
+	}
+
+	// Go over the rect quadrant by quadrant, so each quadrant is only looked up once.
+	int quadrant_size = get_effective_quadrant_size(p_layer);
+	Vector2i rect_end = p_rect.get_end();
+	Vector2i first_quadrant = _coords_to_quadrant_coords(p_layer, p_rect.position);
+	Vector2i last_quadrant = _coords_to_quadrant_coords(p_layer, rect_end - Vector2i(1, 1));
+
+	QuadrantCache cache;
+	for (int qy = first_quadrant.y; qy <= last_quadrant.y; qy++) {
+		int from_y = MAX(qy * quadrant_size, p_rect.position.y);
+		int to_y = MIN((qy + 1) * quadrant_size, rect_end.y);
+		for (int qx = first_quadrant.x; qx <= last_quadrant.x; qx++) {
+			int from_x = MAX(qx * quadrant_size, p_rect.position.x);
+			int to_x = MIN((qx + 1) * quadrant_size, rect_end.x);
+			for (int y = from_y; y < to_y; y++) {
+				for (int x = from_x; x < to_x; x++) {
+					_set_cell(p_layer, Vector2i(x, y), source_id, atlas_coords, alternative_tile, cache);
+				}
+			}
+		}
+	}
+}
+
+void TileMap::copy_cells(int p_layer, const Rect2i &p_rect, const Vector2i &p_destination, int p_destination_layer) {
+	ERR_FAIL_INDEX(p_layer, (int)layers.size());
+	int destination_layer = p_destination_layer < 0 ? p_layer : p_destination_layer;
+	ERR_FAIL_INDEX(destination_layer, (int)layers.size());
+	ERR_FAIL_COND_MSG(p_rect.size.x < 0 || p_rect.size.y < 0, "Rect2i size is negative, this is not supported. Use Rect2i.abs() to get a Rect2i with a positive size.");
+	if (!p_rect.has_area()) {
+		return;
+	}
+
+	// Read the whole source rect first, in case it overlaps the destination.
+	const HashMap<Vector2i, TileMapCell> &tile_map = layers[p_layer].tile_map;
+	LocalVector<TileMapCell> cells;
+	cells.resize(p_rect.size.x * p_rect.size.y);
+	uint32_t cell_index = 0;
+	for (int y = p_rect.position.y; y < p_rect.get_end().y; y++) {
+		for (int x = p_rect.position.x; x < p_rect.get_end().x; x++) {
+			HashMap<Vector2i, TileMapCell>::ConstIterator E = tile_map.find(Vector2i(x, y));
+			cells[cell_index++] = E ? E->value : TileMapCell();
+		}
+	}
+
+	QuadrantCache cache;
+	cell_index = 0;
+	for (int y = 0; y < p_rect.size.y; y++) {
+		for (int x = 0; x < p_rect.size.x; x++) {
+			const TileMapCell &c = cells[cell_index++];
+			_set_cell(destination_layer, p_destination + Vector2i(x, y), c.source_id, c.get_atlas_coords(), c.alternative_tile, cache);
+		}
+	}
+}
+
 int TileMap::get_cell_source_id(int p_layer, const Vector2i &p_coords, bool p_use_proxies) const {
 	ERR_FAIL_INDEX_V(p_layer, (int)layers.size(), TileSet::INVALID_SOURCE);
 
@@ -3987,6 +4334,8 @@ void TileMap::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_collision_animatable", "enabled"), &TileMap::set_collision_animatable);
 	ClassDB::bind_method(D_METHOD("is_collision_animatable"), &TileMap::is_collision_animatable);
+	ClassDB::bind_method(D_METHOD("set_collision_merge_enabled", "enabled"), &TileMap::set_collision_merge_enabled);
+	ClassDB::bind_method(D_METHOD("is_collision_merge_enabled"), &TileMap::is_collision_merge_enabled);
 	ClassDB::bind_method(D_METHOD("set_collision_visibility_mode", "collision_visibility_mode"), &TileMap::set_collision_visibility_mode);
 	ClassDB::bind_method(D_METHOD("get_collision_visibility_mode"), &TileMap::get_collision_visibility_mode);
 
@@ -3995,6 +4344,9 @@ void TileMap::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_cell", "layer", "coords", "source_id", "atlas_coords", "alternative_tile"), &TileMap::set_cell, DEFVAL(TileSet::INVALID_SOURCE), DEFVAL(TileSetSource::INVALID_ATLAS_COORDS), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("erase_cell", "layer", "coords"), &TileMap::erase_cell);
+	ClassDB::bind_method(D_METHOD("set_cells_packed", "layer", "coords", "source_ids", "atlas_coords", "alternative_tiles"), &TileMap::set_cells_packed);
+	ClassDB::bind_method(D_METHOD("fill_cells", "layer", "rect", "source_id", "atlas_coords", "alternative_tile"), &TileMap::fill_cells, DEFVAL(TileSet::INVALID_SOURCE), DEFVAL(TileSetSource::INVALID_ATLAS_COORDS), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("copy_cells", "layer", "rect", "destination", "destination_layer"), &TileMap::copy_cells, DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("get_cell_source_id", "layer", "coords", "use_proxies"), &TileMap::get_cell_source_id, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_cell_atlas_coords", "layer", "coords", "use_proxies"), &TileMap::get_cell_atlas_coords, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_cell_alternative_tile", "layer", "coords", "use_proxies"), &TileMap::get_cell_alternative_tile, DEFVAL(false));
@@ -4035,6 +4387,7 @@ void TileMap::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "tile_set", PROPERTY_HINT_RESOURCE_TYPE, "TileSet"), "set_tileset", "get_tileset");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "cell_quadrant_size", PROPERTY_HINT_RANGE, "1,128,1"), "set_quadrant_size", "get_quadrant_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_animatable"), "set_collision_animatable", "is_collision_animatable");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_merge_enabled"), "set_collision_merge_enabled", "is_collision_merge_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_collision_visibility_mode", "get_collision_visibility_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "navigation_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_navigation_visibility_mode", "get_navigation_visibility_mode");
 
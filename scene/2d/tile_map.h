@@ -72,6 +72,7 @@ struct TileMapQuadrant {
 
 	// Physics.
 	List<RID> bodies;
+	List<RID> merged_shapes;
 
 	// Navigation.
 	HashMap<Vector2i, Vector<RID>> navigation_regions;
@@ -89,6 +90,7 @@ struct TileMapQuadrant {
 		canvas_items = q.canvas_items;
 		occluders = q.occluders;
 		bodies = q.bodies;
+		merged_shapes = q.merged_shapes;
 		navigation_regions = q.navigation_regions;
 	}
 
@@ -100,6 +102,7 @@ struct TileMapQuadrant {
 		canvas_items = q.canvas_items;
 		occluders = q.occluders;
 		bodies = q.bodies;
+		merged_shapes = q.merged_shapes;
 		navigation_regions = q.navigation_regions;
 	}
 
@@ -187,6 +190,7 @@ private:
 	Ref<TileSet> tile_set;
 	int quadrant_size = 16;
 	bool collision_animatable = false;
+	bool collision_merge_enabled = false;
 	VisibilityMode collision_visibility_mode = VISIBILITY_MODE_DEFAULT;
 	VisibilityMode navigation_visibility_mode = VISIBILITY_MODE_DEFAULT;
 
@@ -224,9 +228,77 @@ private:
 	HashMap<Vector2i, TileMapQuadrant>::Iterator _create_quadrant(int p_layer, const Vector2i &p_qk);
 
 	void _make_quadrant_dirty(HashMap<Vector2i, TileMapQuadrant>::Iterator Q);
+
+	// Remembers the quadrant of the last cell set, so that setting cells quadrant by quadrant skips most lookups.
+	struct QuadrantCache {
+		int layer = -1;
+		Vector2i coords;
+		HashMap<Vector2i, TileMapQuadrant>::Iterator quadrant;
+	};
+
+	static bool _sanitize_cell(int &r_source_id, Vector2i &r_atlas_coords, int &r_alternative_tile);
+	void _set_cell(int p_layer, const Vector2i &p_coords, int p_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile, QuadrantCache &r_cache);
 	void _make_all_quadrants_dirty();
 	void _queue_update_dirty_quadrants();
 
+	// Dirty quadrants are updated in two passes. The build pass only reads the TileMap and its TileSet, so it
+	// runs on the WorkerThreadPool when there are enough quadrants. The commit pass then creates the server
+	// objects from its results on the main thread.
+	struct QuadrantUpdate {
+		struct RenderingCanvasItem {
+			Ref<Material> material;
+			int z_index = 0;
+			Vector2 position;
+			uint32_t tile_count = 0;
+		};
+		struct RenderingTile {
+			Vector2i position;
+			int source_id = TileSet::INVALID_SOURCE;
+			Vector2i atlas_coords;
+			int alternative_tile = 0;
+			const TileData *tile_data = nullptr;
+		};
+		struct RenderingOccluder {
+			Vector2i coords;
+			Vector2 position;
+			RID polygon;
+			int occlusion_layer = 0;
+		};
+		struct PhysicsBody {
+			Vector2i coords;
+			Vector2 position;
+			int physics_layer = 0;
+			Vector2 linear_velocity;
+			real_t angular_velocity = 0.0;
+			uint32_t shape_count = 0;
+		};
+		struct PhysicsShape {
+			// Merged shapes have no RID yet, they are created from their points when committing.
+			RID shape;
+			Vector<Vector2> points;
+			bool one_way_collision = false;
+			real_t one_way_collision_margin = 0.0;
+		};
+
+		TileMapQuadrant *quadrant = nullptr;
+
+		// Rendering, tiles and shapes are listed in the order of the canvas items and bodies they belong to.
+		Color tile_modulate;
+		LocalVector<RenderingCanvasItem> canvas_items;
+		LocalVector<RenderingTile> tiles;
+		LocalVector<RenderingOccluder> occluders;
+
+		// Physics.
+		LocalVector<PhysicsBody> bodies;
+		LocalVector<PhysicsShape> shapes;
+	};
+
+	static constexpr uint32_t QUADRANT_UPDATE_MIN_PARALLEL_SIZE = 4;
+
+	void _run_quadrant_update_task(void (TileMap::*p_method)(uint32_t, QuadrantUpdate *), LocalVector<QuadrantUpdate> &r_updates);
+	void _update_quadrant_coords_cache(uint32_t p_index, QuadrantUpdate *p_updates);
+	void _build_quadrant_update(uint32_t p_index, QuadrantUpdate *p_updates);
+
 	void _update_dirty_quadrants();
 
 	void _recreate_layer_internals(int p_layer);
@@ -246,7 +318,8 @@ private:
 	void _rendering_notification(int p_what);
 	void _rendering_update_layer(int p_layer);
 	void _rendering_cleanup_layer(int p_layer);
-	void _rendering_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r_dirty_quadrant_list);
+	void _rendering_build_quadrant_update(QuadrantUpdate &r_update) const;
+	void _rendering_update_dirty_quadrants(LocalVector<QuadrantUpdate> &r_updates);
 	void _rendering_create_quadrant(TileMapQuadrant *p_quadrant);
 	void _rendering_cleanup_quadrant(TileMapQuadrant *p_quadrant);
 	void _rendering_draw_quadrant_debug(TileMapQuadrant *p_quadrant);
@@ -254,7 +327,10 @@ private:
 	Transform2D last_valid_transform;
 	Transform2D new_transform;
 	void _physics_notification(int p_what);
-	void _physics_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r_dirty_quadrant_list);
+	static void _physics_merge_polygons(const LocalVector<Vector<Vector2>> &p_polygons, LocalVector<Vector<Vector2>> &r_merged, LocalVector<LocalVector<uint32_t>> &r_sources);
+	static void _physics_add_convex_shapes(const Vector<Vector<Vector2>> &p_decomposition, LocalVector<QuadrantUpdate::PhysicsShape> &r_shapes);
+	void _physics_build_quadrant_update(QuadrantUpdate &r_update) const;
+	void _physics_update_dirty_quadrants(LocalVector<QuadrantUpdate> &r_updates);
 	void _physics_cleanup_quadrant(TileMapQuadrant *p_quadrant);
 	void _physics_draw_quadrant_debug(TileMapQuadrant *p_quadrant);
 
@@ -332,6 +408,9 @@ public:
 	void set_collision_animatable(bool p_enabled);
 	bool is_collision_animatable() const;
 
+	void set_collision_merge_enabled(bool p_enabled);
+	bool is_collision_merge_enabled() const;
+
 	// Debug visibility modes.
 	void set_collision_visibility_mode(VisibilityMode p_show_collision);
 	VisibilityMode get_collision_visibility_mode();
@@ -342,6 +421,9 @@ public:
 	// Cells accessors.
 	void set_cell(int p_layer, const Vector2i &p_coords, int p_source_id = -1, const Vector2i p_atlas_coords = TileSetSource::INVALID_ATLAS_COORDS, int p_alternative_tile = 0);
 	void erase_cell(int p_layer, const Vector2i &p_coords);
+	void set_cells_packed(int p_layer, const PackedInt32Array &p_coords, const PackedInt32Array &p_source_ids, const PackedInt32Array &p_atlas_coords, const PackedInt32Array &p_alternative_tiles);
+	void fill_cells(int p_layer, const Rect2i &p_rect, int p_source_id = -1, const Vector2i p_atlas_coords = TileSetSource::INVALID_ATLAS_COORDS, int p_alternative_tile = 0);
+	void copy_cells(int p_layer, const Rect2i &p_rect, const Vector2i &p_destination, int p_destination_layer = -1);
 	int get_cell_source_id(int p_layer, const Vector2i &p_coords, bool p_use_proxies = false) const;
 	Vector2i get_cell_atlas_coords(int p_layer, const Vector2i &p_coords, bool p_use_proxies = false) const;
 	int get_cell_alternative_tile(int p_layer, const Vector2i &p_coords, bool p_use_proxies = false) const;
@@ -281,6 +281,16 @@ void Area3D::_body_inout(int p_status, const RID &p_body, ObjectID p_instance, i
 	locked = false;
 }
 
+void Area3D::_body_inout_batch(const PackedInt32Array &p_statuses, const Array &p_bodies, const PackedInt64Array &p_instances, const PackedInt32Array &p_body_shapes, const PackedInt32Array &p_area_shapes) {
+	const int32_t *statuses = p_statuses.ptr();
+	const int64_t *instances = p_instances.ptr();
+	const int32_t *body_shapes = p_body_shapes.ptr();
+	const int32_t *area_shapes = p_area_shapes.ptr();
+	for (int i = 0; i < p_statuses.size(); i++) {
+		_body_inout(statuses[i], p_bodies[i], ObjectID(uint64_t(instances[i])), body_shapes[i], area_shapes[i]);
+	}
+}
+
 void Area3D::_clear_monitoring() {
 	ERR_FAIL_COND_MSG(locked, "This function can't be used during the in/out signal.");
 
@@ -365,8 +375,8 @@ void Area3D::set_monitoring(bool p_enable) {
 	monitoring = p_enable;
 
 	if (monitoring) {
-		PhysicsServer3D::get_singleton()->area_set_monitor_callback(get_rid(), callable_mp(this, &Area3D::_body_inout));
-		PhysicsServer3D::get_singleton()->area_set_area_monitor_callback(get_rid(), callable_mp(this, &Area3D::_area_inout));
+		PhysicsServer3D::get_singleton()->area_set_monitor_callback(get_rid(), callable_mp(this, &Area3D::_body_inout_batch));
+		PhysicsServer3D::get_singleton()->area_set_area_monitor_callback(get_rid(), callable_mp(this, &Area3D::_area_inout_batch));
 	} else {
 		PhysicsServer3D::get_singleton()->area_set_monitor_callback(get_rid(), Callable());
 		PhysicsServer3D::get_singleton()->area_set_area_monitor_callback(get_rid(), Callable());
@@ -404,6 +414,16 @@ void Area3D::_area_exit_tree(ObjectID p_id) {
 	}
 }
 
+void Area3D::_area_inout_batch(const PackedInt32Array &p_statuses, const Array &p_areas, const PackedInt64Array &p_instances, const PackedInt32Array &p_area_shapes, const PackedInt32Array &p_self_shapes) {
+	const int32_t *statuses = p_statuses.ptr();
+	const int64_t *instances = p_instances.ptr();
+	const int32_t *area_shapes = p_area_shapes.ptr();
+	const int32_t *self_shapes = p_self_shapes.ptr();
+	for (int i = 0; i < p_statuses.size(); i++) {
+		_area_inout(statuses[i], p_areas[i], ObjectID(uint64_t(instances[i])), area_shapes[i], self_shapes[i]);
+	}
+}
+
 void Area3D::_area_inout(int p_status, const RID &p_area, ObjectID p_instance, int p_area_shape, int p_self_shape) {
 	bool area_in = p_status == PhysicsServer3D::AREA_BODY_ADDED;
 	ObjectID objid = p_instance;
@@ -774,6 +794,8 @@ void Area3D::_bind_methods() {
 
 Area3D::Area3D() :
 		CollisionObject3D(PhysicsServer3D::get_singleton()->area_create(), true) {
+	// Overlap changes are received once per step, see _body_inout_batch() and _area_inout_batch().
+	PhysicsServer3D::get_singleton()->area_set_monitor_batched(get_rid(), true);
 	set_gravity(9.8);
 	set_gravity_direction(Vector3(0, -1, 0));
 	set_monitoring(true);
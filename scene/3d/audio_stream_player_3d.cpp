@@ -97,25 +97,31 @@ static const Vector3 speaker_directions[7] = {
 };
 
 void AudioStreamPlayer3D::_calc_output_vol(const Vector3 &source_dir, real_t tightness, Vector<AudioFrame> &output) {
-	unsigned int speaker_count = 0; // only main speakers (no LFE)
+	// The speaker layouts are fixed, so their SPCAP weights are only computed once.
+	static const Spcap spcap_stereo(2, speaker_directions);
+	static const Spcap spcap_surround_31(3, speaker_directions);
+	static const Spcap spcap_surround_51(5, speaker_directions);
+	static const Spcap spcap_surround_71(7, speaker_directions);
+
+	const Spcap *spcap = nullptr; // only main speakers (no LFE)
 	switch (AudioServer::get_singleton()->get_speaker_mode()) {
 		case AudioServer::SPEAKER_MODE_STEREO:
-			speaker_count = 2;
+			spcap = &spcap_stereo;
 			break;
 		case AudioServer::SPEAKER_SURROUND_31:
-			speaker_count = 3;
+			spcap = &spcap_surround_31;
 			break;
 		case AudioServer::SPEAKER_SURROUND_51:
-			speaker_count = 5;
+			spcap = &spcap_surround_51;
 			break;
 		case AudioServer::SPEAKER_SURROUND_71:
-			speaker_count = 7;
+			spcap = &spcap_surround_71;
 			break;
 	}
+	ERR_FAIL_NULL(spcap);
 
-	Spcap spcap(speaker_count, speaker_directions); //TODO: should only be created/recreated once the speaker mode / speaker positions changes
 	real_t volumes[7];
-	spcap.calculate(source_dir, tightness, speaker_count, volumes);
+	spcap->calculate(source_dir, tightness, spcap->get_speaker_count(), volumes);
 
 	switch (AudioServer::get_singleton()->get_speaker_mode()) {
 		case AudioServer::SPEAKER_SURROUND_71:
@@ -279,17 +285,26 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			// Update anything related to position first, if possible of course.
 			Vector<AudioFrame> volume_vector;
-			if (setplay.get() > 0 || (active.is_set() && last_mix_count != AudioServer::get_singleton()->get_mix_count()) || force_update_panning) {
+			bool update_panning = setplay.get() > 0 || (active.is_set() && last_mix_count != AudioServer::get_singleton()->get_mix_count()) || force_update_panning;
+			bool start_playback = setplay.get() >= 0 && stream.is_valid();
+
+			// A single physics query serves both the panning update and the bus selection.
+			Area3D *overriding_area = nullptr;
+			if (start_playback || (update_panning && active.is_set() && stream.is_valid())) {
+				overriding_area = _get_overriding_area();
+			}
+
+			if (update_panning) {
 				force_update_panning = false;
-				volume_vector = _update_panning();
+				volume_vector = _update_panning(overriding_area);
 			}
 
-			if (setplay.get() >= 0 && stream.is_valid()) {
+			if (start_playback) {
 				active.set();
 				Ref<AudioStreamPlayback> new_playback = stream->instantiate_playback();
 				ERR_FAIL_COND_MSG(new_playback.is_null(), "Failed to instantiate playback.");
 				HashMap<StringName, Vector<AudioFrame>> bus_map;
-				bus_map[_get_actual_bus()] = volume_vector;
+				bus_map[_get_actual_bus(overriding_area)] = volume_vector;
 				AudioServer::get_singleton()->start_playback_stream(new_playback, bus_map, setplay.get(), actual_pitch_scale, linear_attenuation, attenuation_filter_cutoff_hz);
 				stream_playbacks.push_back(new_playback);
 				setplay.set(-1);
@@ -365,16 +380,76 @@ Area3D *AudioStreamPlayer3D::_get_overriding_area() {
 }
 
 // Interacts with PhysicsServer3D, so can only be called during _physics_process
-StringName AudioStreamPlayer3D::_get_actual_bus() {
-	Area3D *overriding_area = _get_overriding_area();
-	if (overriding_area && overriding_area->is_overriding_audio_bus() && !overriding_area->is_using_reverb_bus()) {
-		return overriding_area->get_audio_bus_name();
+StringName AudioStreamPlayer3D::_get_actual_bus(Area3D *p_overriding_area) {
+	if (p_overriding_area && p_overriding_area->is_overriding_audio_bus() && !p_overriding_area->is_using_reverb_bus()) {
+		return p_overriding_area->get_audio_bus_name();
 	}
 	return bus;
 }
 
+struct AudioListenerData3D {
+	Transform3D inverse; // Orthonormalized listener transform, inverted.
+	Transform3D area_inverse; // Full listener transform, inverted.
+	Vector3 origin;
+	Vector3 velocity; // Only tracked for cameras.
+};
+
+// Listener transforms are shared by every player in a viewport, so they are gathered
+// once per physics frame instead of being recomputed by each player for each listener.
+static const LocalVector<AudioListenerData3D> &_get_audio_listeners_3d(Viewport *p_viewport, const Ref<World3D> &p_world_3d) {
+	static HashMap<ObjectID, LocalVector<AudioListenerData3D>> listener_cache;
+	static uint64_t listener_cache_frame = UINT64_MAX;
+
+	uint64_t frame = Engine::get_singleton()->get_physics_frames();
+	if (listener_cache_frame != frame) {
+		listener_cache.clear();
+		listener_cache_frame = frame;
+	}
+
+	HashMap<ObjectID, LocalVector<AudioListenerData3D>>::Iterator E = listener_cache.find(p_viewport->get_instance_id());
+	if (E) {
+		return E->value;
+	}
+
+	LocalVector<AudioListenerData3D> &listeners = listener_cache.insert(p_viewport->get_instance_id(), LocalVector<AudioListenerData3D>())->value;
+
+	HashSet<Camera3D *> cameras = p_world_3d->get_cameras();
+	cameras.insert(p_viewport->get_camera_3d());
+
+	for (Camera3D *camera : cameras) {
+		if (!camera) {
+			continue;
+		}
+		Viewport *vp = camera->get_viewport();
+		if (!vp) {
+			continue;
+		}
+		if (!vp->is_audio_listener_3d()) {
+			continue;
+		}
+
+		AudioListenerData3D listener_data;
+		Node3D *listener_node = camera;
+
+		AudioListener3D *listener = vp->get_audio_listener_3d();
+		if (listener) {
+			listener_node = listener;
+		} else {
+			listener_data.velocity = camera->get_doppler_tracked_velocity();
+		}
+
+		Transform3D listener_transform = listener_node->get_global_transform();
+		listener_data.inverse = listener_transform.orthonormalized().affine_inverse();
+		listener_data.area_inverse = listener_transform.affine_inverse();
+		listener_data.origin = listener_transform.origin;
+		listeners.push_back(listener_data);
+	}
+
+	return listeners;
+}
+
 // Interacts with PhysicsServer3D, so can only be called during _physics_process
-Vector<AudioFrame> AudioStreamPlayer3D::_update_panning() {
+Vector<AudioFrame> AudioStreamPlayer3D::_update_panning(Area3D *p_overriding_area) {
 	Vector<AudioFrame> output_volume_vector;
 	output_volume_vector.resize(4);
 	for (AudioFrame &frame : output_volume_vector) {
@@ -397,44 +472,25 @@ Vector<AudioFrame> AudioStreamPlayer3D::_update_panning() {
 	Ref<World3D> world_3d = get_world_3d();
 	ERR_FAIL_COND_V(world_3d.is_null(), output_volume_vector);
 
-	HashSet<Camera3D *> cameras = world_3d->get_cameras();
-	cameras.insert(get_viewport()->get_camera_3d());
+	const LocalVector<AudioListenerData3D> &listeners = _get_audio_listeners_3d(get_viewport(), world_3d);
 
 	PhysicsDirectSpaceState3D *space_state = PhysicsServer3D::get_singleton()->space_get_direct_state(world_3d->get_space());
 
-	for (Camera3D *camera : cameras) {
-		if (!camera) {
-			continue;
-		}
-		Viewport *vp = camera->get_viewport();
-		if (!vp) {
-			continue;
-		}
-		if (!vp->is_audio_listener_3d()) {
-			continue;
-		}
+	Area3D *area = p_overriding_area;
 
-		bool listener_is_camera = true;
-		Node3D *listener_node = camera;
-
-		AudioListener3D *listener = vp->get_audio_listener_3d();
-		if (listener) {
-			listener_node = listener;
-			listener_is_camera = false;
-		}
+	for (uint32_t i = 0; i < listeners.size(); i++) {
+		const AudioListenerData3D &listener_data = listeners[i];
 
-		Vector3 local_pos = listener_node->get_global_transform().orthonormalized().affine_inverse().xform(global_pos);
+		Vector3 local_pos = listener_data.inverse.xform(global_pos);
 
 		float dist = local_pos.length();
 
 		Vector3 area_sound_pos;
 		Vector3 listener_area_pos;
 
-		Area3D *area = _get_overriding_area();
-
 		if (area && area->is_using_reverb_bus() && area->get_reverb_uniformity() > 0) {
-			area_sound_pos = space_state->get_closest_point_to_object_volume(area->get_rid(), listener_node->get_global_transform().origin);
-			listener_area_pos = listener_node->get_global_transform().affine_inverse().xform(area_sound_pos);
+			area_sound_pos = space_state->get_closest_point_to_object_volume(area->get_rid(), listener_data.origin);
+			listener_area_pos = listener_data.area_inverse.xform(area_sound_pos);
 		}
 
 		if (max_distance > 0) {
@@ -456,7 +512,7 @@ Vector<AudioFrame> AudioStreamPlayer3D::_update_panning() {
 		float db_att = (1.0 - MIN(1.0, multiplier)) * attenuation_filter_db;
 
 		if (emission_angle_enabled) {
-			Vector3 listenertopos = global_pos - listener_node->get_global_transform().origin;
+			Vector3 listenertopos = global_pos - listener_data.origin;
 			float c = listenertopos.normalized().dot(get_global_transform().basis.get_column(2).normalized()); //it's z negative
 			float angle = Math::rad_to_deg(Math::acos(c));
 			if (angle > emission_angle) {
@@ -499,13 +555,7 @@ Vector<AudioFrame> AudioStreamPlayer3D::_update_panning() {
 		}
 
 		if (doppler_tracking != DOPPLER_TRACKING_DISABLED) {
-			Vector3 listener_velocity;
-
-			if (listener_is_camera) {
-				listener_velocity = camera->get_doppler_tracked_velocity();
-			}
-
-			Vector3 local_velocity = listener_node->get_global_transform().orthonormalized().basis.xform_inv(linear_velocity - listener_velocity);
+			Vector3 local_velocity = listener_data.inverse.basis.xform(linear_velocity - listener_data.velocity);
 
 			if (local_velocity != Vector3()) {
 				float approaching = local_pos.normalized().dot(local_velocity.normalized());
@@ -92,9 +92,9 @@ private:
 
 	void _set_playing(bool p_enable);
 	bool _is_active() const;
-	StringName _get_actual_bus();
+	StringName _get_actual_bus(Area3D *p_overriding_area);
 	Area3D *_get_overriding_area();
-	Vector<AudioFrame> _update_panning();
+	Vector<AudioFrame> _update_panning(Area3D *p_overriding_area);
 
 	void _bus_layout_changed();
 
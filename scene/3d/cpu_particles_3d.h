@@ -186,7 +186,23 @@ private:
 	Vector3 gravity = Vector3(0, -9.8, 0);
 
 	void _update_internal();
+	// Particles are simulated in fixed size groups, which run on the WorkerThreadPool when there is more than one.
+	enum {
+		PROCESS_GROUP_SIZE = 256,
+	};
+
+	struct ProcessState {
+		Particle *particles = nullptr;
+		double delta = 0.0;
+		double prev_time = 0.0;
+		double system_phase = 0.0;
+		uint32_t seed = 0;
+		Transform3D emission_xform;
+		Basis velocity_xform;
+	};
+
 	void _particles_process(double p_delta);
+	void _particles_process_group(uint32_t p_group, const ProcessState *p_state);
 	void _update_particle_data_buffer();
 
 	Mutex update_mutex;
@@ -108,11 +108,15 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 
 	data.children_lock++;
 
-	for (Node3D *&E : data.children) {
-		if (E->data.top_level_active) {
+	for (uint32_t i = 0; i < data.children.size(); i++) {
+		Node3D *child = data.children[i];
+		if (child->data.top_level_active) {
 			continue; //don't propagate to a top_level
 		}
-		E->_propagate_transform_changed(p_origin);
+		if (child->data.xform_propagated) {
+			continue; // Whole subtree already dirty and queued, e.g. position and rotation set in a row.
+		}
+		child->_propagate_transform_changed(p_origin);
 	}
 #ifdef TOOLS_ENABLED
 	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
@@ -122,10 +126,23 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		get_tree()->xform_change_list.add(&xform_change);
 	}
 	data.dirty |= DIRTY_GLOBAL_TRANSFORM;
+	data.xform_propagated = true;
 
 	data.children_lock--;
 }
 
+void Node3D::_invalidate_xform_propagated() const {
+	// Flags are only ever set on whole subtrees, so the first node without one ends the walk.
+	const Node3D *node = this;
+	while (node && node->data.xform_propagated) {
+		node->data.xform_propagated = false;
+		if (node->data.top_level_active) {
+			break; // Not part of the parent's propagation.
+		}
+		node = node->data.parent;
+	}
+}
+
 void Node3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
@@ -137,10 +154,14 @@ void Node3D::_notification(int p_what) {
 			}
 
 			if (data.parent) {
-				data.C = data.parent->data.children.push_back(this);
+				data.index_in_parent = data.parent->data.children.size();
+				data.parent->data.children.push_back(this);
+				// A clean node joins the parent's subtree.
+				data.parent->_invalidate_xform_propagated();
 			} else {
-				data.C = nullptr;
+				data.index_in_parent = -1;
 			}
+			data.xform_propagated = false;
 
 			if (data.top_level && !Engine::get_singleton()->is_editor_hint()) {
 				if (data.parent) {
@@ -162,11 +183,16 @@ void Node3D::_notification(int p_what) {
 			if (xform_change.in_list()) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
-			if (data.C) {
-				data.parent->data.children.erase(data.C);
+			if (data.index_in_parent >= 0) {
+				LocalVector<Node3D *> &siblings = data.parent->data.children;
+				Node3D *last = siblings[siblings.size() - 1];
+				siblings[data.index_in_parent] = last;
+				last->data.index_in_parent = data.index_in_parent;
+				siblings.resize(siblings.size() - 1);
 			}
 			data.parent = nullptr;
-			data.C = nullptr;
+			data.index_in_parent = -1;
+			data.xform_propagated = false;
 			data.top_level_active = false;
 			_update_visibility_parent(true);
 		} break;
@@ -207,6 +233,8 @@ void Node3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
+			// No longer queued.
+			_invalidate_xform_propagated();
 #ifdef TOOLS_ENABLED
 			for (int i = 0; i < data.gizmos.size(); i++) {
 				data.gizmos.write[i]->transform();
@@ -313,6 +341,7 @@ Transform3D Node3D::get_global_transform() const {
 		}
 
 		data.dirty &= ~DIRTY_GLOBAL_TRANSFORM;
+		data.xform_propagated = false;
 	}
 
 	return data.global_transform;
@@ -527,6 +556,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_xform_propagated(); // Gizmos need transform notifications too.
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -651,7 +681,8 @@ void Node3D::_propagate_visibility_changed() {
 	}
 #endif
 
-	for (Node3D *c : data.children) {
+	for (uint32_t i = 0; i < data.children.size(); i++) {
+		Node3D *c = data.children[i];
 		if (!c || !c->data.visible) {
 			continue;
 		}
@@ -808,6 +839,7 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 
 void Node3D::set_notify_transform(bool p_enabled) {
 	data.notify_transform = p_enabled;
+	_invalidate_xform_propagated();
 }
 
 bool Node3D::is_transform_notification_enabled() const {
@@ -832,6 +864,25 @@ void Node3D::force_update_transform() {
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
 
+void Node3D::_propagate_reset_physics_interpolation() {
+	// Flush the pending transform first, so the reset applies to the latest one.
+	force_update_transform();
+	notification(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
+
+	for (uint32_t i = 0; i < data.children.size(); i++) {
+		Node3D *c = data.children[i];
+		if (!c) {
+			continue;
+		}
+		c->_propagate_reset_physics_interpolation();
+	}
+}
+
+void Node3D::reset_physics_interpolation() {
+	ERR_FAIL_COND(!is_inside_tree());
+	_propagate_reset_physics_interpolation();
+}
+
 void Node3D::_update_visibility_parent(bool p_update_root) {
 	RID new_parent;
 
@@ -860,7 +911,8 @@ void Node3D::_update_visibility_parent(bool p_update_root) {
 		RS::get_singleton()->instance_set_visibility_parent(vi->get_instance(), data.visibility_parent);
 	}
 
-	for (Node3D *c : data.children) {
+	for (uint32_t i = 0; i < data.children.size(); i++) {
+		Node3D *c = data.children[i];
 		c->_update_visibility_parent(false);
 	}
 }
@@ -987,6 +1039,7 @@ void Node3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_world_3d"), &Node3D::get_world_3d);
 
 	ClassDB::bind_method(D_METHOD("force_update_transform"), &Node3D::force_update_transform);
+	ClassDB::bind_method(D_METHOD("reset_physics_interpolation"), &Node3D::reset_physics_interpolation);
 
 	ClassDB::bind_method(D_METHOD("set_visibility_parent", "path"), &Node3D::set_visibility_parent);
 	ClassDB::bind_method(D_METHOD("get_visibility_parent"), &Node3D::get_visibility_parent);
@@ -1035,6 +1088,7 @@ void Node3D::_bind_methods() {
 	BIND_CONSTANT(NOTIFICATION_EXIT_WORLD);
 	BIND_CONSTANT(NOTIFICATION_VISIBILITY_CHANGED);
 	BIND_CONSTANT(NOTIFICATION_LOCAL_TRANSFORM_CHANGED);
+	BIND_CONSTANT(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
 
 	BIND_ENUM_CONSTANT(ROTATION_EDIT_MODE_EULER);
 	BIND_ENUM_CONSTANT(ROTATION_EDIT_MODE_QUATERNION);
@@ -31,6 +31,7 @@
 #ifndef NODE_3D_H
 #define NODE_3D_H
 
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 #include "scene/resources/world_3d.h"
 
@@ -108,8 +109,12 @@ private:
 
 		int children_lock = 0;
 		Node3D *parent = nullptr;
-		List<Node3D *> children;
-		List<Node3D *>::Element *C = nullptr;
+		LocalVector<Node3D *> children; // Contiguous for propagation, unordered.
+		int index_in_parent = -1;
+
+		// This node and every descendant reached by transform propagation are known to be dirty and queued for
+		// NOTIFICATION_TRANSFORM_CHANGED, so propagating into it again can stop here.
+		mutable bool xform_propagated = false;
 
 		bool ignore_notification = false;
 		bool notify_local_transform = false;
@@ -132,14 +137,19 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	void _invalidate_xform_propagated() const;
 
 	void _propagate_visibility_changed();
+	void _propagate_reset_physics_interpolation();
 
 	void _propagate_visibility_parent();
 	void _update_visibility_parent(bool p_update_root);
 
 protected:
-	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) { data.ignore_notification = p_ignore; }
+	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) {
+		data.ignore_notification = p_ignore;
+		_invalidate_xform_propagated();
+	}
 
 	_FORCE_INLINE_ void _update_local_transform() const;
 	_FORCE_INLINE_ void _update_rotation_and_scale() const;
@@ -159,6 +169,7 @@ public:
 		NOTIFICATION_EXIT_WORLD = 42,
 		NOTIFICATION_VISIBILITY_CHANGED = 43,
 		NOTIFICATION_LOCAL_TRANSFORM_CHANGED = 44,
+		NOTIFICATION_RESET_PHYSICS_INTERPOLATION = 45,
 	};
 
 	Node3D *get_parent_node_3d() const;
@@ -260,6 +271,7 @@ public:
 	bool is_visible_in_tree() const;
 
 	void force_update_transform();
+	void reset_physics_interpolation();
 
 	void set_visibility_parent(const NodePath &p_path);
 	NodePath get_visibility_parent() const;
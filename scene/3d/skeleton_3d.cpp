@@ -217,6 +217,7 @@ void Skeleton3D::_update_process_order() {
 	int len = bones.size();
 
 	parentless_bones.clear();
+	bone_process_order.clear();
 
 	for (int i = 0; i < len; i++) {
 		bonesptr[i].child_bones.clear();
@@ -244,7 +245,20 @@ void Skeleton3D::_update_process_order() {
 		}
 	}
 
+	// Flatten the hierarchy breadth first, so global poses can be composed in a single linear pass.
+	bone_process_order.reserve(len);
+	for (int i = 0; i < parentless_bones.size(); i++) {
+		bone_process_order.push_back(parentless_bones[i]);
+	}
+	for (uint32_t i = 0; i < bone_process_order.size(); i++) {
+		const Vector<int> &children = bonesptr[bone_process_order[i]].child_bones;
+		for (int j = 0; j < children.size(); j++) {
+			bone_process_order.push_back(children[j]);
+		}
+	}
+
 	process_order_dirty = false;
+	bones_dirty_all = true;
 }
 
 void Skeleton3D::_notification(int p_what) {
@@ -257,7 +271,7 @@ void Skeleton3D::_notification(int p_what) {
 			dirty = false;
 
 			// Update bone transforms.
-			force_update_all_bone_transforms();
+			_update_dirty_bones_global_pose();
 
 			// Update skins.
 			for (SkinReference *E : skin_bindings) {
@@ -368,7 +382,7 @@ void Skeleton3D::set_bone_global_pose_override(int p_bone, const Transform3D &p_
 	bones.write[p_bone].global_pose_override_amount = p_amount;
 	bones.write[p_bone].global_pose_override = p_pose;
 	bones.write[p_bone].global_pose_override_reset = !p_persistent;
-	_make_dirty();
+	_make_dirty(p_bone);
 }
 
 Transform3D Skeleton3D::get_bone_global_pose_override(int p_bone) const {
@@ -408,7 +422,7 @@ void Skeleton3D::set_bone_local_pose_override(int p_bone, const Transform3D &p_p
 	bones.write[p_bone].local_pose_override_amount = p_amount;
 	bones.write[p_bone].local_pose_override = p_pose;
 	bones.write[p_bone].local_pose_override_reset = !p_persistent;
-	_make_dirty();
+	_make_dirty(p_bone);
 }
 
 Transform3D Skeleton3D::get_bone_local_pose_override(int p_bone) const {
@@ -651,7 +665,7 @@ void Skeleton3D::set_bone_enabled(int p_bone, bool p_enabled) {
 
 	bones.write[p_bone].enabled = p_enabled;
 	emit_signal(SceneStringNames::get_singleton()->bone_enabled_changed, p_bone);
-	_make_dirty();
+	_make_dirty(p_bone);
 }
 
 bool Skeleton3D::is_bone_enabled(int p_bone) const {
@@ -685,8 +699,9 @@ void Skeleton3D::set_bone_pose_position(int p_bone, const Vector3 &p_position) {
 
 	bones.write[p_bone].pose_position = p_position;
 	bones.write[p_bone].pose_cache_dirty = true;
+	bones.write[p_bone].pose_global_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_dirty(p_bone);
 	}
 }
 void Skeleton3D::set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation) {
@@ -695,8 +710,9 @@ void Skeleton3D::set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation
 
 	bones.write[p_bone].pose_rotation = p_rotation;
 	bones.write[p_bone].pose_cache_dirty = true;
+	bones.write[p_bone].pose_global_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_dirty(p_bone);
 	}
 }
 void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
@@ -705,8 +721,38 @@ void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
 
 	bones.write[p_bone].pose_scale = p_scale;
 	bones.write[p_bone].pose_cache_dirty = true;
+	bones.write[p_bone].pose_global_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_dirty(p_bone);
+	}
+}
+
+void Skeleton3D::set_bone_poses(const BonePoseUpdate *p_poses, uint32_t p_count) {
+	const int bone_size = bones.size();
+	Bone *bonesptr = bones.ptrw();
+	int last_bone = -1;
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		const BonePoseUpdate &pose = p_poses[i];
+		ERR_CONTINUE(pose.bone < 0 || pose.bone >= bone_size);
+
+		Bone &b = bonesptr[pose.bone];
+		if (pose.set_position) {
+			b.pose_position = pose.position;
+		}
+		if (pose.set_rotation) {
+			b.pose_rotation = pose.rotation;
+		}
+		if (pose.set_scale) {
+			b.pose_scale = pose.scale;
+		}
+		b.pose_cache_dirty = true;
+		b.pose_global_dirty = true;
+		last_bone = pose.bone;
+	}
+
+	if (last_bone >= 0 && is_inside_tree()) {
+		_make_dirty(last_bone);
 	}
 }
 
@@ -749,7 +795,13 @@ Transform3D Skeleton3D::get_bone_pose(int p_bone) const {
 	return bones[p_bone].pose_cache;
 }
 
-void Skeleton3D::_make_dirty() {
+void Skeleton3D::_make_dirty(int p_bone) {
+	if (p_bone >= 0) {
+		bones.write[p_bone].pose_global_dirty = true;
+	} else {
+		bones_dirty_all = true;
+	}
+
 	if (dirty) {
 		return;
 	}
@@ -1022,82 +1074,116 @@ void Skeleton3D::force_update_all_dirty_bones() {
 }
 
 void Skeleton3D::force_update_all_bone_transforms() {
-	_update_process_order();
-
-	for (int i = 0; i < parentless_bones.size(); i++) {
-		force_update_bone_children_transforms(parentless_bones[i]);
-	}
+	bones_dirty_all = true;
+	_update_dirty_bones_global_pose();
 }
 
 void Skeleton3D::force_update_bone_children_transforms(int p_bone_idx) {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX(p_bone_idx, bone_size);
 
+	_update_process_order();
+
 	Bone *bonesptr = bones.ptrw();
-	List<int> bones_to_process = List<int>();
+	LocalVector<int> bones_to_process;
 	bones_to_process.push_back(p_bone_idx);
 
-	while (bones_to_process.size() > 0) {
-		int current_bone_idx = bones_to_process[0];
-		bones_to_process.erase(current_bone_idx);
+	for (uint32_t i = 0; i < bones_to_process.size(); i++) {
+		int current_bone_idx = bones_to_process[i];
+		_update_bone_global_pose(bonesptr, current_bone_idx);
+
+		// Add the bone's children to the list of bones to be processed.
+		const Bone &b = bonesptr[current_bone_idx];
+		int child_bone_size = b.child_bones.size();
+		for (int j = 0; j < child_bone_size; j++) {
+			bones_to_process.push_back(b.child_bones[j]);
+		}
+	}
+	rest_dirty = false;
+}
 
-		Bone &b = bonesptr[current_bone_idx];
-		bool bone_enabled = b.enabled && !show_rest_only;
+void Skeleton3D::_update_dirty_bones_global_pose() {
+	_update_process_order();
 
-		if (bone_enabled) {
-			b.update_pose_cache();
-			Transform3D pose = b.pose_cache;
+	// Only bones that changed, and the subtrees below them, are recomputed. A full update is done
+	// when the hierarchy, rests or display mode changed.
+	bool update_all = bones_dirty_all || rest_dirty;
+	Bone *bonesptr = bones.ptrw();
 
-			if (b.parent >= 0) {
-				b.pose_global = bonesptr[b.parent].pose_global * pose;
-				b.pose_global_no_override = b.pose_global;
-			} else {
-				b.pose_global = pose;
-				b.pose_global_no_override = b.pose_global;
-			}
-		} else {
-			if (b.parent >= 0) {
-				b.pose_global = bonesptr[b.parent].pose_global * b.rest;
-				b.pose_global_no_override = b.pose_global;
-			} else {
-				b.pose_global = b.rest;
-				b.pose_global_no_override = b.pose_global;
-			}
-		}
-		if (rest_dirty) {
-			b.global_rest = b.parent >= 0 ? bonesptr[b.parent].global_rest * b.rest : b.rest;
+	for (uint32_t i = 0; i < bone_process_order.size(); i++) {
+		const int bone_idx = bone_process_order[i];
+		Bone &b = bonesptr[bone_idx];
+		if (!update_all && !b.pose_global_dirty) {
+			continue;
 		}
 
-		if (b.local_pose_override_amount >= CMP_EPSILON) {
-			Transform3D override_local_pose;
-			if (b.parent >= 0) {
-				override_local_pose = bonesptr[b.parent].pose_global * b.local_pose_override;
-			} else {
-				override_local_pose = b.local_pose_override;
-			}
-			b.pose_global = b.pose_global.interpolate_with(override_local_pose, b.local_pose_override_amount);
-		}
+		_update_bone_global_pose(bonesptr, bone_idx);
 
-		if (b.global_pose_override_amount >= CMP_EPSILON) {
-			b.pose_global = b.pose_global.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
+		int child_bone_size = b.child_bones.size();
+		for (int j = 0; j < child_bone_size; j++) {
+			bonesptr[b.child_bones[j]].pose_global_dirty = true;
 		}
+	}
+
+	bones_dirty_all = false;
+	rest_dirty = false;
+}
 
-		if (b.local_pose_override_reset) {
-			b.local_pose_override_amount = 0.0;
+void Skeleton3D::_update_bone_global_pose(Bone *p_bones, int p_bone) {
+	Bone &b = p_bones[p_bone];
+	b.pose_global_dirty = false;
+
+	bool bone_enabled = b.enabled && !show_rest_only;
+
+	if (bone_enabled) {
+		b.update_pose_cache();
+		Transform3D pose = b.pose_cache;
+
+		if (b.parent >= 0) {
+			b.pose_global = p_bones[b.parent].pose_global * pose;
+			b.pose_global_no_override = b.pose_global;
+		} else {
+			b.pose_global = pose;
+			b.pose_global_no_override = b.pose_global;
 		}
-		if (b.global_pose_override_reset) {
-			b.global_pose_override_amount = 0.0;
+	} else {
+		if (b.parent >= 0) {
+			b.pose_global = p_bones[b.parent].pose_global * b.rest;
+			b.pose_global_no_override = b.pose_global;
+		} else {
+			b.pose_global = b.rest;
+			b.pose_global_no_override = b.pose_global;
 		}
+	}
+	if (rest_dirty) {
+		b.global_rest = b.parent >= 0 ? p_bones[b.parent].global_rest * b.rest : b.rest;
+	}
 
-		// Add the bone's children to the list of bones to be processed.
-		int child_bone_size = b.child_bones.size();
-		for (int i = 0; i < child_bone_size; i++) {
-			bones_to_process.push_back(b.child_bones[i]);
+	if (b.local_pose_override_amount >= CMP_EPSILON) {
+		Transform3D override_local_pose;
+		if (b.parent >= 0) {
+			override_local_pose = p_bones[b.parent].pose_global * b.local_pose_override;
+		} else {
+			override_local_pose = b.local_pose_override;
 		}
+		b.pose_global = b.pose_global.interpolate_with(override_local_pose, b.local_pose_override_amount);
+	}
 
-		emit_signal(SceneStringNames::get_singleton()->bone_pose_changed, current_bone_idx);
+	if (b.global_pose_override_amount >= CMP_EPSILON) {
+		b.pose_global = b.pose_global.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
 	}
-	rest_dirty = false;
+
+	// Overrides that only last one update must be removed from the pose the next time around.
+	if (b.local_pose_override_reset) {
+		b.pose_global_dirty = b.pose_global_dirty || b.local_pose_override_amount >= CMP_EPSILON;
+		b.local_pose_override_amount = 0.0;
+	}
+	if (b.global_pose_override_reset) {
+		b.pose_global_dirty = b.pose_global_dirty || b.global_pose_override_amount >= CMP_EPSILON;
+		b.global_pose_override_amount = 0.0;
+	}
+
+	emit_signal(SceneStringNames::get_singleton()->bone_pose_changed, p_bone);
 }
 
 // Helper functions
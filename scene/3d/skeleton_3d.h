@@ -96,6 +96,7 @@ private:
 
 		Transform3D pose_global;
 		Transform3D pose_global_no_override;
+		bool pose_global_dirty = true; // This bone (and so its subtree) needs its global pose recomputed.
 
 		real_t global_pose_override_amount = 0.0;
 		bool global_pose_override_reset = false;
@@ -142,10 +143,12 @@ private:
 	bool process_order_dirty = false;
 
 	Vector<int> parentless_bones;
+	LocalVector<int> bone_process_order; // Parents always come before their children.
 
-	void _make_dirty();
+	void _make_dirty(int p_bone = -1);
 	bool dirty = false;
 	bool rest_dirty = false;
+	bool bones_dirty_all = true;
 
 	bool show_rest_only = false;
 	float motion_scale = 1.0;
@@ -153,6 +156,8 @@ private:
 	uint64_t version = 1;
 
 	void _update_process_order();
+	_FORCE_INLINE_ void _update_bone_global_pose(Bone *p_bones, int p_bone);
+	void _update_dirty_bones_global_pose();
 
 protected:
 	bool _get(const StringName &p_path, Variant &r_ret) const;
@@ -180,6 +185,16 @@ public:
 		NOTIFICATION_UPDATE_SKELETON = 50
 	};
 
+	struct BonePoseUpdate {
+		int bone = -1;
+		Vector3 position;
+		Quaternion rotation;
+		Vector3 scale = Vector3(1, 1, 1);
+		bool set_position = false;
+		bool set_rotation = false;
+		bool set_scale = false;
+	};
+
 	// skeleton creation api
 	void add_bone(const String &p_name);
 	int find_bone(const String &p_name) const;
@@ -219,6 +234,7 @@ public:
 	void set_bone_pose_position(int p_bone, const Vector3 &p_position);
 	void set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation);
 	void set_bone_pose_scale(int p_bone, const Vector3 &p_scale);
+	void set_bone_poses(const BonePoseUpdate *p_poses, uint32_t p_count);
 
 	Transform3D get_bone_pose(int p_bone) const;
 
@@ -32,6 +32,9 @@
 
 #include "scene/scene_string_names.h"
 
+HashMap<SpriteBase3D::SharedQuadKey, SpriteBase3D::SharedQuad, SpriteBase3D::SharedQuadKey> SpriteBase3D::shared_quads;
+Mutex SpriteBase3D::shared_quads_mutex;
+
 Color SpriteBase3D::_get_color_accum() {
 	if (!color_dirty) {
 		return color_accum;
@@ -240,27 +243,104 @@ void SpriteBase3D::draw_texture_rect(Ref<Texture2D> p_texture, Rect2 p_dst_rect,
 		memcpy(&attribute_write_buffer[i * attrib_stride + mesh_surface_offsets[RS::ARRAY_COLOR]], v_color, 4);
 	}
 
-	RID mesh_new = get_mesh();
-	RS::get_singleton()->mesh_surface_update_vertex_region(mesh_new, 0, 0, vertex_buffer);
-	RS::get_singleton()->mesh_surface_update_attribute_region(mesh_new, 0, 0, attribute_buffer);
-
-	RS::get_singleton()->mesh_set_custom_aabb(mesh_new, aabb_new);
 	set_aabb(aabb_new);
 
 	RID shader_rid;
 	StandardMaterial3D::get_material_for_2d(get_draw_flag(FLAG_SHADED), get_draw_flag(FLAG_TRANSPARENT), get_draw_flag(FLAG_DOUBLE_SIDED), get_alpha_cut_mode() == ALPHA_CUT_DISCARD, get_alpha_cut_mode() == ALPHA_CUT_OPAQUE_PREPASS, get_billboard_mode() == StandardMaterial3D::BILLBOARD_ENABLED, get_billboard_mode() == StandardMaterial3D::BILLBOARD_FIXED_Y, false, get_draw_flag(FLAG_DISABLE_DEPTH_TEST), get_draw_flag(FLAG_FIXED_SIZE), get_texture_filter(), &shader_rid);
-	if (last_shader != shader_rid) {
-		RS::get_singleton()->material_set_shader(get_material(), shader_rid);
-		last_shader = shader_rid;
+
+	SharedQuadKey key;
+	key.vertex_data = vertex_buffer;
+	key.attribute_data = attribute_buffer;
+	key.shader = shader_rid;
+	key.texture = p_texture->get_rid();
+	key.render_priority = get_alpha_cut_mode() == ALPHA_CUT_DISABLED ? get_render_priority() : 0;
+
+	if (!has_shared_quad || !(shared_quad_key == key)) {
+		_release_shared_quad();
+
+		MutexLock lock(shared_quads_mutex);
+
+		SharedQuad *shared = shared_quads.getptr(key);
+		if (!shared) {
+			SharedQuad new_shared;
+
+			new_shared.material = RS::get_singleton()->material_create();
+			// Set defaults for material, names need to match up those in StandardMaterial3D.
+			RS::get_singleton()->material_set_param(new_shared.material, "albedo", Color(1, 1, 1, 1));
+			RS::get_singleton()->material_set_param(new_shared.material, "specular", 0.5);
+			RS::get_singleton()->material_set_param(new_shared.material, "metallic", 0.0);
+			RS::get_singleton()->material_set_param(new_shared.material, "roughness", 1.0);
+			RS::get_singleton()->material_set_param(new_shared.material, "uv1_offset", Vector3(0, 0, 0));
+			RS::get_singleton()->material_set_param(new_shared.material, "uv1_scale", Vector3(1, 1, 1));
+			RS::get_singleton()->material_set_param(new_shared.material, "uv2_offset", Vector3(0, 0, 0));
+			RS::get_singleton()->material_set_param(new_shared.material, "uv2_scale", Vector3(1, 1, 1));
+			RS::get_singleton()->material_set_param(new_shared.material, "alpha_scissor_threshold", 0.5);
+			RS::get_singleton()->material_set_shader(new_shared.material, key.shader);
+			RS::get_singleton()->material_set_param(new_shared.material, "texture_albedo", key.texture);
+			RS::get_singleton()->material_set_render_priority(new_shared.material, key.render_priority);
+
+			RS::SurfaceData sd;
+			_create_quad_surface_data(sd);
+			sd.vertex_data = key.vertex_data;
+			sd.attribute_data = key.attribute_data;
+			sd.material = new_shared.material;
+
+			new_shared.mesh = RS::get_singleton()->mesh_create();
+			RS::get_singleton()->mesh_add_surface(new_shared.mesh, sd);
+			RS::get_singleton()->mesh_set_custom_aabb(new_shared.mesh, aabb_new);
+
+			shared = &shared_quads.insert(key, new_shared)->value;
+		}
+
+		shared->refcount++;
+		shared_quad_key = key;
+		has_shared_quad = true;
+		mesh = shared->mesh;
 	}
-	if (last_texture != p_texture->get_rid()) {
-		RS::get_singleton()->material_set_param(get_material(), "texture_albedo", p_texture->get_rid());
-		last_texture = p_texture->get_rid();
+
+	if (get_base() != mesh) {
+		set_base(mesh);
+	}
+}
+
+uint32_t SpriteBase3D::SharedQuadKey::hash(const SharedQuadKey &p_key) {
+	uint32_t h = hash_murmur3_buffer(p_key.vertex_data.ptr(), p_key.vertex_data.size());
+	h = hash_murmur3_buffer(p_key.attribute_data.ptr(), p_key.attribute_data.size(), h);
+	h = hash_murmur3_one_64(p_key.shader.get_id(), h);
+	h = hash_murmur3_one_64(p_key.texture.get_id(), h);
+	h = hash_murmur3_one_32(p_key.render_priority, h);
+	return hash_fmix32(h);
+}
+
+bool SpriteBase3D::SharedQuadKey::operator==(const SharedQuadKey &p_key) const {
+	if (shader != p_key.shader || texture != p_key.texture || render_priority != p_key.render_priority) {
+		return false;
 	}
-	if (get_alpha_cut_mode() == ALPHA_CUT_DISABLED) {
-		RS::get_singleton()->material_set_render_priority(get_material(), get_render_priority());
-		RS::get_singleton()->mesh_surface_set_material(mesh, 0, get_material());
+	if (vertex_data.size() != p_key.vertex_data.size() || attribute_data.size() != p_key.attribute_data.size()) {
+		return false;
 	}
+	return memcmp(vertex_data.ptr(), p_key.vertex_data.ptr(), vertex_data.size()) == 0 && memcmp(attribute_data.ptr(), p_key.attribute_data.ptr(), attribute_data.size()) == 0;
+}
+
+void SpriteBase3D::_release_shared_quad() {
+	if (!has_shared_quad) {
+		return;
+	}
+
+	MutexLock lock(shared_quads_mutex);
+
+	SharedQuad *shared = shared_quads.getptr(shared_quad_key);
+	if (shared) {
+		shared->refcount--;
+		if (shared->refcount == 0) {
+			RS::get_singleton()->free(shared->mesh);
+			RS::get_singleton()->free(shared->material);
+			shared_quads.erase(shared_quad_key);
+		}
+	}
+
+	shared_quad_key = SharedQuadKey();
+	has_shared_quad = false;
 }
 
 void SpriteBase3D::set_centered(bool p_center) {
@@ -542,20 +622,22 @@ SpriteBase3D::SpriteBase3D() {
 		flags[i] = i == FLAG_TRANSPARENT || i == FLAG_DOUBLE_SIDED;
 	}
 
-	material = RenderingServer::get_singleton()->material_create();
-	// Set defaults for material, names need to match up those in StandardMaterial3D.
-	RS::get_singleton()->material_set_param(material, "albedo", Color(1, 1, 1, 1));
-	RS::get_singleton()->material_set_param(material, "specular", 0.5);
-	RS::get_singleton()->material_set_param(material, "metallic", 0.0);
-	RS::get_singleton()->material_set_param(material, "roughness", 1.0);
-	RS::get_singleton()->material_set_param(material, "uv1_offset", Vector3(0, 0, 0));
-	RS::get_singleton()->material_set_param(material, "uv1_scale", Vector3(1, 1, 1));
-	RS::get_singleton()->material_set_param(material, "uv2_offset", Vector3(0, 0, 0));
-	RS::get_singleton()->material_set_param(material, "uv2_scale", Vector3(1, 1, 1));
-	RS::get_singleton()->material_set_param(material, "alpha_scissor_threshold", 0.5);
+	RS::SurfaceData sd;
+	_create_quad_surface_data(sd);
 
-	mesh = RenderingServer::get_singleton()->mesh_create();
+	mesh_surface_format = sd.format;
+	vertex_buffer = sd.vertex_data;
+	attribute_buffer = sd.attribute_data;
+
+	RS::get_singleton()->mesh_surface_make_offsets_from_format(sd.format, sd.vertex_count, sd.index_count, mesh_surface_offsets, vertex_stride, attrib_stride, skin_stride);
+}
 
+SpriteBase3D::~SpriteBase3D() {
+	set_base(RID());
+	_release_shared_quad();
+}
+
+void SpriteBase3D::_create_quad_surface_data(RS::SurfaceData &r_surface_data) {
 	PackedVector3Array mesh_vertices;
 	PackedVector3Array mesh_normals;
 	PackedFloat32Array mesh_tangents;
@@ -598,23 +680,7 @@ SpriteBase3D::SpriteBase3D() {
 	mesh_array[RS::ARRAY_TEX_UV] = mesh_uvs;
 	mesh_array[RS::ARRAY_INDEX] = indices;
 
-	RS::SurfaceData sd;
-	RS::get_singleton()->mesh_create_surface_data_from_arrays(&sd, RS::PRIMITIVE_TRIANGLES, mesh_array);
-
-	mesh_surface_format = sd.format;
-	vertex_buffer = sd.vertex_data;
-	attribute_buffer = sd.attribute_data;
-
-	sd.material = material;
-
-	RS::get_singleton()->mesh_surface_make_offsets_from_format(sd.format, sd.vertex_count, sd.index_count, mesh_surface_offsets, vertex_stride, attrib_stride, skin_stride);
-	RS::get_singleton()->mesh_add_surface(mesh, sd);
-	set_base(mesh);
-}
-
-SpriteBase3D::~SpriteBase3D() {
-	RenderingServer::get_singleton()->free(mesh);
-	RenderingServer::get_singleton()->free(material);
+	RS::get_singleton()->mesh_create_surface_data_from_arrays(&r_surface_data, RS::PRIMITIVE_TRIANGLES, mesh_array);
 }
 
 ///////////////////////////////////////////
@@ -77,11 +77,34 @@ private:
 	real_t pixel_size = 0.01;
 	AABB aabb;
 
+	// Sprites drawing the same quad with the same texture and material settings share one mesh
+	// and material, which lets the renderer draw all of them with a single instanced draw call.
+	struct SharedQuadKey {
+		PackedByteArray vertex_data;
+		PackedByteArray attribute_data;
+		RID shader;
+		RID texture;
+		int render_priority = 0;
+
+		static uint32_t hash(const SharedQuadKey &p_key);
+		bool operator==(const SharedQuadKey &p_key) const;
+	};
+
+	struct SharedQuad {
+		RID mesh;
+		RID material;
+		uint32_t refcount = 0;
+	};
+
+	static HashMap<SharedQuadKey, SharedQuad, SharedQuadKey> shared_quads;
+	static Mutex shared_quads_mutex;
+
+	SharedQuadKey shared_quad_key;
+	bool has_shared_quad = false;
 	RID mesh;
-	RID material;
 
-	RID last_shader;
-	RID last_texture;
+	void _release_shared_quad();
+	static void _create_quad_surface_data(RS::SurfaceData &r_surface_data);
 
 	bool flags[FLAG_MAX] = {};
 	AlphaCutMode alpha_cut = ALPHA_CUT_DISABLED;
@@ -100,7 +123,6 @@ protected:
 	void draw_texture_rect(Ref<Texture2D> p_texture, Rect2 p_dst_rect, Rect2 p_src_rect);
 	_FORCE_INLINE_ void set_aabb(const AABB &p_aabb) { aabb = p_aabb; }
 	_FORCE_INLINE_ RID &get_mesh() { return mesh; }
-	_FORCE_INLINE_ RID &get_material() { return material; }
 
 	uint32_t mesh_surface_offsets[RS::ARRAY_MAX];
 	PackedByteArray vertex_buffer;
@@ -51,6 +51,25 @@ void VisibleOnScreenNotifier3D::_visibility_exit() {
 	_screen_exit();
 }
 
+void VisibleOnScreenNotifier3D::flush_screen_changes() {
+	Vector<ObjectID> entered;
+	Vector<ObjectID> exited;
+	RS::get_singleton()->visibility_notifier_take_changes(entered, exited);
+
+	for (const ObjectID &id : exited) {
+		VisibleOnScreenNotifier3D *notifier = Object::cast_to<VisibleOnScreenNotifier3D>(ObjectDB::get_instance(id));
+		if (notifier) {
+			notifier->_visibility_exit();
+		}
+	}
+	for (const ObjectID &id : entered) {
+		VisibleOnScreenNotifier3D *notifier = Object::cast_to<VisibleOnScreenNotifier3D>(ObjectDB::get_instance(id));
+		if (notifier) {
+			notifier->_visibility_enter();
+		}
+	}
+}
+
 void VisibleOnScreenNotifier3D::set_aabb(const AABB &p_aabb) {
 	if (aabb == p_aabb) {
 		return;
@@ -92,7 +111,7 @@ void VisibleOnScreenNotifier3D::_bind_methods() {
 VisibleOnScreenNotifier3D::VisibleOnScreenNotifier3D() {
 	RID notifier = RS::get_singleton()->visibility_notifier_create();
 	RS::get_singleton()->visibility_notifier_set_aabb(notifier, aabb);
-	RS::get_singleton()->visibility_notifier_set_callbacks(notifier, callable_mp(this, &VisibleOnScreenNotifier3D::_visibility_enter), callable_mp(this, &VisibleOnScreenNotifier3D::_visibility_exit));
+	// Screen changes are taken in one batch by the SceneTree, see flush_screen_changes().
 	set_base(notifier);
 }
 
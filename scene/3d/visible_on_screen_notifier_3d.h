@@ -57,6 +57,8 @@ public:
 	virtual AABB get_aabb() const override;
 	bool is_on_screen() const;
 
+	static void flush_screen_changes();
+
 	VisibleOnScreenNotifier3D();
 	~VisibleOnScreenNotifier3D();
 };
@@ -51,12 +51,27 @@ void VisualInstance3D::_notification(int p_what) {
 		case NOTIFICATION_ENTER_WORLD: {
 			ERR_FAIL_COND(get_world_3d().is_null());
 			RenderingServer::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
+			if (get_tree()->is_physics_interpolation_enabled()) {
+				// Start at the current transform rather than interpolating from wherever the instance was.
+				RenderingServer::get_singleton()->instance_set_interpolated(instance, true);
+				RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+				RenderingServer::get_singleton()->instance_reset_physics_interpolation(instance);
+			}
 			_update_visibility();
 		} break;
 
+		case NOTIFICATION_RESET_PHYSICS_INTERPOLATION: {
+			RenderingServer::get_singleton()->instance_reset_physics_interpolation(instance);
+		} break;
+
 		case NOTIFICATION_TRANSFORM_CHANGED: {
 			Transform3D gt = get_global_transform();
-			RenderingServer::get_singleton()->instance_set_transform(instance, gt);
+			if (is_inside_tree() && get_tree()->xform_batching) {
+				get_tree()->xform_batch_instances.push_back(instance);
+				get_tree()->xform_batch_transforms.push_back(gt);
+			} else {
+				RenderingServer::get_singleton()->instance_set_transform(instance, gt);
+			}
 		} break;
 
 		case NOTIFICATION_EXIT_WORLD: {
@@ -31,6 +31,7 @@
 #include "voxelizer.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 
 static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3 *p_vtx, const Vector2 *p_uv, const Vector3 *p_normal, Vector2 &r_uv, Vector3 &r_normal) {
 	if (p_pos.is_equal_approx(p_vtx[0])) {
@@ -72,219 +73,237 @@ static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3
 	r_normal = (p_normal[0] * u + p_normal[1] * v + p_normal[2] * w).normalized();
 }
 
-void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb) {
-	if (p_level == cell_subdiv) {
-		//plot the face by guessing its albedo and emission value
-
-		//find best axis to map to, for scanning values
-		int closest_axis = 0;
-		real_t closest_dot = 0;
-
-		Plane plane = Plane(p_vtx[0], p_vtx[1], p_vtx[2]);
-		Vector3 normal = plane.normal;
-
-		for (int i = 0; i < 3; i++) {
-			Vector3 axis;
-			axis[i] = 1.0;
-			real_t dot = ABS(normal.dot(axis));
-			if (i == 0 || dot > closest_dot) {
-				closest_axis = i;
-				closest_dot = dot;
-			}
-		}
-
-		Vector3 axis;
-		axis[closest_axis] = 1.0;
-		Vector3 t1;
-		t1[(closest_axis + 1) % 3] = 1.0;
-		Vector3 t2;
-		t2[(closest_axis + 2) % 3] = 1.0;
-
-		t1 *= p_aabb.size[(closest_axis + 1) % 3] / real_t(color_scan_cell_width);
-		t2 *= p_aabb.size[(closest_axis + 2) % 3] / real_t(color_scan_cell_width);
-
-		Color albedo_accum;
-		Color emission_accum;
-		Vector3 normal_accum;
+void Voxelizer::_plot_leaf(Cell &r_cell, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb) {
+	//plot the face by guessing its albedo and emission value
 
-		float alpha = 0.0;
+	//find best axis to map to, for scanning values
+	int closest_axis = 0;
+	real_t closest_dot = 0;
 
-		//map to a grid average in the best axis for this face
-		for (int i = 0; i < color_scan_cell_width; i++) {
-			Vector3 ofs_i = real_t(i) * t1;
+	Plane plane = Plane(p_vtx[0], p_vtx[1], p_vtx[2]);
+	Vector3 normal = plane.normal;
 
-			for (int j = 0; j < color_scan_cell_width; j++) {
-				Vector3 ofs_j = real_t(j) * t2;
-
-				Vector3 from = p_aabb.position + ofs_i + ofs_j;
-				Vector3 to = from + t1 + t2 + axis * p_aabb.size[closest_axis];
-				Vector3 half = (to - from) * 0.5;
+	for (int i = 0; i < 3; i++) {
+		Vector3 axis;
+		axis[i] = 1.0;
+		real_t dot = ABS(normal.dot(axis));
+		if (i == 0 || dot > closest_dot) {
+			closest_axis = i;
+			closest_dot = dot;
+		}
+	}
 
-				//is in this cell?
-				if (!Geometry3D::triangle_box_overlap(from + half, half, p_vtx)) {
-					continue; //face does not span this cell
-				}
+	Vector3 axis;
+	axis[closest_axis] = 1.0;
+	Vector3 t1;
+	t1[(closest_axis + 1) % 3] = 1.0;
+	Vector3 t2;
+	t2[(closest_axis + 2) % 3] = 1.0;
 
-				//go from -size to +size*2 to avoid skipping collisions
-				Vector3 ray_from = from + (t1 + t2) * 0.5 - axis * p_aabb.size[closest_axis];
-				Vector3 ray_to = ray_from + axis * p_aabb.size[closest_axis] * 2;
+	t1 *= p_aabb.size[(closest_axis + 1) % 3] / real_t(color_scan_cell_width);
+	t2 *= p_aabb.size[(closest_axis + 2) % 3] / real_t(color_scan_cell_width);
 
-				if (normal.dot(ray_from - ray_to) < 0) {
-					SWAP(ray_from, ray_to);
-				}
+	Color albedo_accum;
+	Color emission_accum;
+	Vector3 normal_accum;
 
-				Vector3 intersection;
+	float alpha = 0.0;
 
-				if (!plane.intersects_segment(ray_from, ray_to, &intersection)) {
-					if (ABS(plane.distance_to(ray_from)) < ABS(plane.distance_to(ray_to))) {
-						intersection = plane.project(ray_from);
-					} else {
-						intersection = plane.project(ray_to);
-					}
-				}
+	//map to a grid average in the best axis for this face
+	for (int i = 0; i < color_scan_cell_width; i++) {
+		Vector3 ofs_i = real_t(i) * t1;
 
-				intersection = Face3(p_vtx[0], p_vtx[1], p_vtx[2]).get_closest_point_to(intersection);
+		for (int j = 0; j < color_scan_cell_width; j++) {
+			Vector3 ofs_j = real_t(j) * t2;
 
-				Vector2 uv;
-				Vector3 lnormal;
-				get_uv_and_normal(intersection, p_vtx, p_uv, p_normal, uv, lnormal);
-				if (lnormal == Vector3()) { //just in case normal is not provided
-					lnormal = normal;
-				}
+			Vector3 from = p_aabb.position + ofs_i + ofs_j;
+			Vector3 to = from + t1 + t2 + axis * p_aabb.size[closest_axis];
+			Vector3 half = (to - from) * 0.5;
 
-				int uv_x = CLAMP(int(Math::fposmod(uv.x, (real_t)1.0) * bake_texture_size), 0, bake_texture_size - 1);
-				int uv_y = CLAMP(int(Math::fposmod(uv.y, (real_t)1.0) * bake_texture_size), 0, bake_texture_size - 1);
+			//is in this cell?
+			if (!Geometry3D::triangle_box_overlap(from + half, half, p_vtx)) {
+				continue; //face does not span this cell
+			}
 
-				int ofs = uv_y * bake_texture_size + uv_x;
-				albedo_accum.r += p_material.albedo[ofs].r;
-				albedo_accum.g += p_material.albedo[ofs].g;
-				albedo_accum.b += p_material.albedo[ofs].b;
-				albedo_accum.a += p_material.albedo[ofs].a;
+			//go from -size to +size*2 to avoid skipping collisions
+			Vector3 ray_from = from + (t1 + t2) * 0.5 - axis * p_aabb.size[closest_axis];
+			Vector3 ray_to = ray_from + axis * p_aabb.size[closest_axis] * 2;
 
-				emission_accum.r += p_material.emission[ofs].r;
-				emission_accum.g += p_material.emission[ofs].g;
-				emission_accum.b += p_material.emission[ofs].b;
+			if (normal.dot(ray_from - ray_to) < 0) {
+				SWAP(ray_from, ray_to);
+			}
 
-				normal_accum += lnormal;
+			Vector3 intersection;
 
-				alpha += 1.0;
+			if (!plane.intersects_segment(ray_from, ray_to, &intersection)) {
+				if (ABS(plane.distance_to(ray_from)) < ABS(plane.distance_to(ray_to))) {
+					intersection = plane.project(ray_from);
+				} else {
+					intersection = plane.project(ray_to);
+				}
 			}
-		}
-
-		if (alpha == 0) {
-			//could not in any way get texture information.. so use closest point to center
 
-			Face3 f(p_vtx[0], p_vtx[1], p_vtx[2]);
-			Vector3 inters = f.get_closest_point_to(p_aabb.get_center());
+			intersection = Face3(p_vtx[0], p_vtx[1], p_vtx[2]).get_closest_point_to(intersection);
 
-			Vector3 lnormal;
 			Vector2 uv;
-			get_uv_and_normal(inters, p_vtx, p_uv, p_normal, uv, normal);
+			Vector3 lnormal;
+			get_uv_and_normal(intersection, p_vtx, p_uv, p_normal, uv, lnormal);
 			if (lnormal == Vector3()) { //just in case normal is not provided
 				lnormal = normal;
 			}
 
-			int uv_x = CLAMP(Math::fposmod(uv.x, (real_t)1.0) * bake_texture_size, 0, bake_texture_size - 1);
-			int uv_y = CLAMP(Math::fposmod(uv.y, (real_t)1.0) * bake_texture_size, 0, bake_texture_size - 1);
+			int uv_x = CLAMP(int(Math::fposmod(uv.x, (real_t)1.0) * bake_texture_size), 0, bake_texture_size - 1);
+			int uv_y = CLAMP(int(Math::fposmod(uv.y, (real_t)1.0) * bake_texture_size), 0, bake_texture_size - 1);
 
 			int ofs = uv_y * bake_texture_size + uv_x;
+			albedo_accum.r += p_material.albedo[ofs].r;
+			albedo_accum.g += p_material.albedo[ofs].g;
+			albedo_accum.b += p_material.albedo[ofs].b;
+			albedo_accum.a += p_material.albedo[ofs].a;
 
-			alpha = 1.0 / (color_scan_cell_width * color_scan_cell_width);
+			emission_accum.r += p_material.emission[ofs].r;
+			emission_accum.g += p_material.emission[ofs].g;
+			emission_accum.b += p_material.emission[ofs].b;
 
-			albedo_accum.r = p_material.albedo[ofs].r * alpha;
-			albedo_accum.g = p_material.albedo[ofs].g * alpha;
-			albedo_accum.b = p_material.albedo[ofs].b * alpha;
-			albedo_accum.a = p_material.albedo[ofs].a * alpha;
+			normal_accum += lnormal;
 
-			emission_accum.r = p_material.emission[ofs].r * alpha;
-			emission_accum.g = p_material.emission[ofs].g * alpha;
-			emission_accum.b = p_material.emission[ofs].b * alpha;
+			alpha += 1.0;
+		}
+	}
 
-			normal_accum = lnormal * alpha;
+	if (alpha == 0) {
+		//could not in any way get texture information.. so use closest point to center
 
-		} else {
-			float accdiv = 1.0 / (color_scan_cell_width * color_scan_cell_width);
-			alpha *= accdiv;
+		Face3 f(p_vtx[0], p_vtx[1], p_vtx[2]);
+		Vector3 inters = f.get_closest_point_to(p_aabb.get_center());
 
-			albedo_accum.r *= accdiv;
-			albedo_accum.g *= accdiv;
-			albedo_accum.b *= accdiv;
-			albedo_accum.a *= accdiv;
+		Vector3 lnormal;
+		Vector2 uv;
+		get_uv_and_normal(inters, p_vtx, p_uv, p_normal, uv, normal);
+		if (lnormal == Vector3()) { //just in case normal is not provided
+			lnormal = normal;
+		}
 
-			emission_accum.r *= accdiv;
-			emission_accum.g *= accdiv;
-			emission_accum.b *= accdiv;
+		int uv_x = CLAMP(Math::fposmod(uv.x, (real_t)1.0) * bake_texture_size, 0, bake_texture_size - 1);
+		int uv_y = CLAMP(Math::fposmod(uv.y, (real_t)1.0) * bake_texture_size, 0, bake_texture_size - 1);
 
-			normal_accum *= accdiv;
-		}
+		int ofs = uv_y * bake_texture_size + uv_x;
+
+		alpha = 1.0 / (color_scan_cell_width * color_scan_cell_width);
+
+		albedo_accum.r = p_material.albedo[ofs].r * alpha;
+		albedo_accum.g = p_material.albedo[ofs].g * alpha;
+		albedo_accum.b = p_material.albedo[ofs].b * alpha;
+		albedo_accum.a = p_material.albedo[ofs].a * alpha;
 
-		//put this temporarily here, corrected in a later step
-		bake_cells.write[p_idx].albedo[0] += albedo_accum.r;
-		bake_cells.write[p_idx].albedo[1] += albedo_accum.g;
-		bake_cells.write[p_idx].albedo[2] += albedo_accum.b;
-		bake_cells.write[p_idx].emission[0] += emission_accum.r;
-		bake_cells.write[p_idx].emission[1] += emission_accum.g;
-		bake_cells.write[p_idx].emission[2] += emission_accum.b;
-		bake_cells.write[p_idx].normal[0] += normal_accum.x;
-		bake_cells.write[p_idx].normal[1] += normal_accum.y;
-		bake_cells.write[p_idx].normal[2] += normal_accum.z;
-		bake_cells.write[p_idx].alpha += alpha;
+		emission_accum.r = p_material.emission[ofs].r * alpha;
+		emission_accum.g = p_material.emission[ofs].g * alpha;
+		emission_accum.b = p_material.emission[ofs].b * alpha;
+
+		normal_accum = lnormal * alpha;
 
 	} else {
-		//go down
+		float accdiv = 1.0 / (color_scan_cell_width * color_scan_cell_width);
+		alpha *= accdiv;
 
-		int half = (1 << cell_subdiv) >> (p_level + 1);
-		for (int i = 0; i < 8; i++) {
-			AABB aabb = p_aabb;
-			aabb.size *= 0.5;
+		albedo_accum.r *= accdiv;
+		albedo_accum.g *= accdiv;
+		albedo_accum.b *= accdiv;
+		albedo_accum.a *= accdiv;
 
-			int nx = p_x;
-			int ny = p_y;
-			int nz = p_z;
+		emission_accum.r *= accdiv;
+		emission_accum.g *= accdiv;
+		emission_accum.b *= accdiv;
 
-			if (i & 1) {
-				aabb.position.x += aabb.size.x;
-				nx += half;
-			}
-			if (i & 2) {
-				aabb.position.y += aabb.size.y;
-				ny += half;
-			}
-			if (i & 4) {
-				aabb.position.z += aabb.size.z;
-				nz += half;
-			}
-			//make sure to not plot beyond limits
-			if (nx < 0 || nx >= axis_cell_size[0] || ny < 0 || ny >= axis_cell_size[1] || nz < 0 || nz >= axis_cell_size[2]) {
-				continue;
-			}
+		normal_accum *= accdiv;
+	}
 
-			{
-				AABB test_aabb = aabb;
-				//test_aabb.grow_by(test_aabb.get_longest_axis_size()*0.05); //grow a bit to avoid numerical error in real-time
-				Vector3 qsize = test_aabb.size * 0.5; //quarter size, for fast aabb test
+	//put this temporarily here, corrected in a later step
+	r_cell.albedo[0] += albedo_accum.r;
+	r_cell.albedo[1] += albedo_accum.g;
+	r_cell.albedo[2] += albedo_accum.b;
+	r_cell.emission[0] += emission_accum.r;
+	r_cell.emission[1] += emission_accum.g;
+	r_cell.emission[2] += emission_accum.b;
+	r_cell.normal[0] += normal_accum.x;
+	r_cell.normal[1] += normal_accum.y;
+	r_cell.normal[2] += normal_accum.z;
+	r_cell.alpha += alpha;
+}
 
-				if (!Geometry3D::triangle_box_overlap(test_aabb.position + qsize, qsize, p_vtx)) {
-					//if (!Face3(p_vtx[0],p_vtx[1],p_vtx[2]).intersects_aabb2(aabb)) {
-					//does not fit in child, go on
-					continue;
-				}
-			}
+void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, uint32_t p_triangle, const Vector3 *p_vtx, const AABB &p_aabb) {
+	if (p_level == cell_subdiv) {
+		// Only record the leaf here, the expensive color sampling runs later in parallel.
+		PlotLeaf leaf;
+		leaf.cell = p_idx;
+		leaf.triangle = p_triangle;
+		leaf.aabb = p_aabb;
+		plot_leaves.push_back(leaf);
+		return;
+	}
 
-			if (bake_cells[p_idx].children[i] == CHILD_EMPTY) {
-				//sub cell must be created
+	//go down
 
-				uint32_t child_idx = bake_cells.size();
-				bake_cells.write[p_idx].children[i] = child_idx;
-				bake_cells.resize(bake_cells.size() + 1);
-				bake_cells.write[child_idx].level = p_level + 1;
-				bake_cells.write[child_idx].x = nx / half;
-				bake_cells.write[child_idx].y = ny / half;
-				bake_cells.write[child_idx].z = nz / half;
+	int half = (1 << cell_subdiv) >> (p_level + 1);
+	for (int i = 0; i < 8; i++) {
+		AABB aabb = p_aabb;
+		aabb.size *= 0.5;
+
+		int nx = p_x;
+		int ny = p_y;
+		int nz = p_z;
+
+		if (i & 1) {
+			aabb.position.x += aabb.size.x;
+			nx += half;
+		}
+		if (i & 2) {
+			aabb.position.y += aabb.size.y;
+			ny += half;
+		}
+		if (i & 4) {
+			aabb.position.z += aabb.size.z;
+			nz += half;
+		}
+		//make sure to not plot beyond limits
+		if (nx < 0 || nx >= axis_cell_size[0] || ny < 0 || ny >= axis_cell_size[1] || nz < 0 || nz >= axis_cell_size[2]) {
+			continue;
+		}
+
+		{
+			AABB test_aabb = aabb;
+			//test_aabb.grow_by(test_aabb.get_longest_axis_size()*0.05); //grow a bit to avoid numerical error in real-time
+			Vector3 qsize = test_aabb.size * 0.5; //quarter size, for fast aabb test
+
+			if (!Geometry3D::triangle_box_overlap(test_aabb.position + qsize, qsize, p_vtx)) {
+				//if (!Face3(p_vtx[0],p_vtx[1],p_vtx[2]).intersects_aabb2(aabb)) {
+				//does not fit in child, go on
+				continue;
 			}
+		}
 
-			_plot_face(bake_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb);
+		if (bake_cells[p_idx].children[i] == CHILD_EMPTY) {
+			//sub cell must be created
+
+			uint32_t child_idx = bake_cells.size();
+			bake_cells.write[p_idx].children[i] = child_idx;
+			bake_cells.resize(bake_cells.size() + 1);
+			bake_cells.write[child_idx].level = p_level + 1;
+			bake_cells.write[child_idx].x = nx / half;
+			bake_cells.write[child_idx].y = ny / half;
+			bake_cells.write[child_idx].z = nz / half;
 		}
+
+		_plot_face(bake_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_triangle, p_vtx, aabb);
+	}
+}
+
+void Voxelizer::_plot_cell(uint32_t p_index, Cell *p_cells) {
+	// All leaves of a cell are accumulated by one task, in the order they were plotted.
+	for (uint32_t i = plot_cell_offsets[p_index], ni = plot_cell_offsets[p_index + 1]; i < ni; i++) {
+		const PlotLeaf &leaf = plot_leaves[i];
+		const PlotTriangle &triangle = plot_triangles[leaf.triangle];
+		_plot_leaf(p_cells[leaf.cell], triangle.vertices, triangle.normals, triangle.uvs, *plot_material, leaf.aabb);
 	}
 }
 
@@ -413,73 +432,61 @@ void Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh> &p_mesh, const V
 			nr = normals.ptr();
 		}
 
-		if (index.size()) {
-			int facecount = index.size() / 3;
-			const int *ir = index.ptr();
+		const int *ir = index.size() ? index.ptr() : nullptr;
+		int facecount = ir ? index.size() / 3 : vertices.size() / 3;
 
-			for (int j = 0; j < facecount; j++) {
-				Vector3 vtxs[3];
-				Vector2 uvs[3];
-				Vector3 normal[3];
+		plot_triangles.clear();
+		plot_leaves.clear();
 
-				for (int k = 0; k < 3; k++) {
-					vtxs[k] = p_xform.xform(vr[ir[j * 3 + k]]);
-				}
+		for (int j = 0; j < facecount; j++) {
+			PlotTriangle triangle;
 
+			for (int k = 0; k < 3; k++) {
+				int vtx_index = ir ? ir[j * 3 + k] : j * 3 + k;
+				triangle.vertices[k] = p_xform.xform(vr[vtx_index]);
 				if (uvr) {
-					for (int k = 0; k < 3; k++) {
-						uvs[k] = uvr[ir[j * 3 + k]];
-					}
+					triangle.uvs[k] = uvr[vtx_index];
 				}
-
 				if (nr) {
-					for (int k = 0; k < 3; k++) {
-						normal[k] = nr[ir[j * 3 + k]];
-					}
+					triangle.normals[k] = nr[vtx_index];
 				}
-
-				//test against original bounds
-				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, vtxs)) {
-					continue;
-				}
-				//plot
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
 			}
 
-		} else {
-			int facecount = vertices.size() / 3;
-
-			for (int j = 0; j < facecount; j++) {
-				Vector3 vtxs[3];
-				Vector2 uvs[3];
-				Vector3 normal[3];
-
-				for (int k = 0; k < 3; k++) {
-					vtxs[k] = p_xform.xform(vr[j * 3 + k]);
-				}
+			//test against original bounds
+			if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, triangle.vertices)) {
+				continue;
+			}
 
-				if (uvr) {
-					for (int k = 0; k < 3; k++) {
-						uvs[k] = uvr[j * 3 + k];
-					}
-				}
+			//bin the face into the octree, creating the cells it touches
+			uint32_t triangle_index = plot_triangles.size();
+			plot_triangles.push_back(triangle);
+			_plot_face(0, 0, 0, 0, 0, triangle_index, plot_triangles[triangle_index].vertices, po2_bounds);
+		}
 
-				if (nr) {
-					for (int k = 0; k < 3; k++) {
-						normal[k] = nr[j * 3 + k];
-					}
-				}
+		if (plot_leaves.is_empty()) {
+			continue;
+		}
 
-				//test against original bounds
-				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, vtxs)) {
-					continue;
-				}
-				//plot face
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
+		// Group leaves by cell, keeping the plot order inside each cell so the result matches a serial bake.
+		plot_leaves.sort();
+		plot_cell_offsets.clear();
+		for (uint32_t j = 0; j < plot_leaves.size(); j++) {
+			if (j == 0 || plot_leaves[j].cell != plot_leaves[j - 1].cell) {
+				plot_cell_offsets.push_back(j);
 			}
 		}
+		plot_cell_offsets.push_back(plot_leaves.size());
+
+		plot_material = &material;
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Voxelizer::_plot_cell, bake_cells.ptrw(), plot_cell_offsets.size() - 1, -1, true, SNAME("VoxelizerPlotCells"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		plot_material = nullptr;
 	}
 
+	plot_triangles.clear();
+	plot_leaves.clear();
+	plot_cell_offsets.clear();
+
 	max_original_cells = bake_cells.size();
 }
 
@@ -815,6 +822,36 @@ static void edt(float *f, int stride, int n) {
 
 #undef square
 
+struct VoxelizerEDTPass {
+	float *work_memory = nullptr;
+	uint32_t count_i = 0;
+	uint32_t stride_i = 0;
+	uint32_t stride_j = 0;
+	uint32_t stride = 0;
+	uint32_t n = 0;
+};
+
+static void _edt_pass_line(void *p_userdata, uint32_t p_index) {
+	const VoxelizerEDTPass *pass = static_cast<const VoxelizerEDTPass *>(p_userdata);
+	uint32_t i = p_index % pass->count_i;
+	uint32_t j = p_index / pass->count_i;
+	edt(&pass->work_memory[i * pass->stride_i + j * pass->stride_j], pass->stride, pass->n);
+}
+
+static void _edt_pass(float *p_work_memory, uint32_t p_count_i, uint32_t p_stride_i, uint32_t p_count_j, uint32_t p_stride_j, uint32_t p_stride, uint32_t p_n) {
+	// Every line along the pass axis is independent.
+	VoxelizerEDTPass pass;
+	pass.work_memory = p_work_memory;
+	pass.count_i = p_count_i;
+	pass.stride_i = p_stride_i;
+	pass.stride_j = p_stride_j;
+	pass.stride = p_stride;
+	pass.n = p_n;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(_edt_pass_line, &pass, p_count_i * p_count_j, -1, true, SNAME("VoxelizerSDFPass"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 Vector<uint8_t> Voxelizer::get_sdf_3d_image() const {
 	Vector3i octree_size = get_voxel_gi_octree_size();
 
@@ -844,27 +881,13 @@ Vector<uint8_t> Voxelizer::get_sdf_3d_image() const {
 	//process in each direction
 
 	//xy->z
-
-	for (int i = 0; i < octree_size.x; i++) {
-		for (int j = 0; j < octree_size.y; j++) {
-			edt(&work_memory[i + j * y_mult], z_mult, octree_size.z);
-		}
-	}
+	_edt_pass(work_memory, octree_size.x, 1, octree_size.y, y_mult, z_mult, octree_size.z);
 
 	//xz->y
-
-	for (int i = 0; i < octree_size.x; i++) {
-		for (int j = 0; j < octree_size.z; j++) {
-			edt(&work_memory[i + j * z_mult], y_mult, octree_size.y);
-		}
-	}
+	_edt_pass(work_memory, octree_size.x, 1, octree_size.z, z_mult, y_mult, octree_size.y);
 
 	//yz->x
-	for (int i = 0; i < octree_size.y; i++) {
-		for (int j = 0; j < octree_size.z; j++) {
-			edt(&work_memory[i * y_mult + j * z_mult], 1, octree_size.x);
-		}
-	}
+	_edt_pass(work_memory, octree_size.y, y_mult, octree_size.z, z_mult, 1, octree_size.x);
 
 	Vector<uint8_t> image3d;
 	image3d.resize(float_count);
@@ -86,6 +86,28 @@ private:
 		Vector<Color> emission;
 	};
 
+	struct PlotTriangle {
+		Vector3 vertices[3];
+		Vector3 normals[3];
+		Vector2 uvs[3];
+	};
+
+	// A leaf cell touched by a triangle, sorted by cell so each cell is accumulated by a single task.
+	struct PlotLeaf {
+		uint32_t cell = 0;
+		uint32_t triangle = 0;
+		AABB aabb;
+
+		_FORCE_INLINE_ bool operator<(const PlotLeaf &p_leaf) const {
+			return cell == p_leaf.cell ? triangle < p_leaf.triangle : cell < p_leaf.cell;
+		}
+	};
+
+	LocalVector<PlotTriangle> plot_triangles;
+	LocalVector<PlotLeaf> plot_leaves;
+	LocalVector<uint32_t> plot_cell_offsets;
+	const MaterialCache *plot_material = nullptr;
+
 	HashMap<Ref<Material>, MaterialCache> material_cache;
 	float exposure_normalization = 1.0;
 	AABB original_bounds;
@@ -104,7 +126,9 @@ private:
 	Vector<Color> _get_bake_texture(Ref<Image> p_image, const Color &p_color_mul, const Color &p_color_add);
 	MaterialCache _get_material_cache(Ref<Material> p_material);
 
-	void _plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb);
+	void _plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, uint32_t p_triangle, const Vector3 *p_vtx, const AABB &p_aabb);
+	void _plot_leaf(Cell &r_cell, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb);
+	void _plot_cell(uint32_t p_index, Cell *p_cells);
 	void _fixup_plot(int p_idx, int p_level);
 	void _debug_mesh(int p_idx, int p_level, const AABB &p_aabb, Ref<MultiMesh> &p_multimesh, int &idx);
 
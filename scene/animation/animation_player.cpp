@@ -476,11 +476,16 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, double
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
 	bool backward = signbit(p_delta);
 
+	if (p_anim->sample_cursors.size() != (uint32_t)a->get_track_count()) {
+		p_anim->sample_cursors.resize(a->get_track_count());
+	}
+
 	for (int i = 0; i < a->get_track_count(); i++) {
 		// If an animation changes this animation (or it animates itself)
 		// we need to recreate our animation cache
 		if (p_anim->node_cache.size() != a->get_track_count()) {
 			_ensure_node_caches(p_anim);
+			p_anim->sample_cursors.resize(a->get_track_count());
 		}
 
 		TrackNodeCache *nc = p_anim->node_cache[i];
@@ -506,7 +511,7 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, double
 
 				Vector3 loc;
 
-				Error err = a->position_track_interpolate(i, p_time, &loc);
+				Error err = a->position_track_interpolate(i, p_time, &loc, &p_anim->sample_cursors[i]);
 				//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 
 				if (err != OK) {
@@ -534,7 +539,7 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, double
 
 				Quaternion rot;
 
-				Error err = a->rotation_track_interpolate(i, p_time, &rot);
+				Error err = a->rotation_track_interpolate(i, p_time, &rot, &p_anim->sample_cursors[i]);
 				//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 
 				if (err != OK) {
@@ -562,7 +567,7 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, double
 
 				Vector3 scale;
 
-				Error err = a->scale_track_interpolate(i, p_time, &scale);
+				Error err = a->scale_track_interpolate(i, p_time, &scale, &p_anim->sample_cursors[i]);
 				//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 
 				if (err != OK) {
@@ -590,7 +595,7 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, double
 
 				float blend;
 
-				Error err = a->blend_shape_track_interpolate(i, p_time, &blend);
+				Error err = a->blend_shape_track_interpolate(i, p_time, &blend, &p_anim->sample_cursors[i]);
 				//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 
 				if (err != OK) {
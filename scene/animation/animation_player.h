@@ -197,6 +197,7 @@ private:
 		String name;
 		StringName next;
 		Vector<TrackNodeCache *> node_cache;
+		LocalVector<Animation::TrackSampleCursor> sample_cursors; // One per track, speeds up sequential sampling.
 		Ref<Animation> animation;
 		StringName animation_library;
 		uint64_t last_update = 0;
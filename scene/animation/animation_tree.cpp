@@ -32,6 +32,8 @@
 
 #include "animation_blend_tree.h"
 #include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/resources/animation.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_stream.h"
@@ -860,6 +862,10 @@ void AnimationTree::_clear_caches() {
 	}
 	playing_caches.clear();
 	track_cache.clear();
+	sample_cursors.clear();
+#ifndef _3D_DISABLED
+	bone_pose_updates.clear();
+#endif // _3D_DISABLED
 	cache_valid = false;
 }
 
@@ -878,7 +884,7 @@ static void _call_object(Object *p_object, const StringName &p_method, const Vec
 		p_object->callp(p_method, argptrs, argcount, ce);
 	}
 }
-void AnimationTree::_process_graph(double p_delta) {
+bool AnimationTree::_process_graph_begin(double p_delta) {
 	_update_properties(); //if properties need updating, update them
 
 	//check all tracks, see if they need modification
@@ -890,14 +896,14 @@ void AnimationTree::_process_graph(double p_delta) {
 		ERR_PRINT("AnimationTree: root AnimationNode is not set, disabling playback.");
 		set_active(false);
 		cache_valid = false;
-		return;
+		return false;
 	}
 
 	if (!has_node(animation_player)) {
 		ERR_PRINT("AnimationTree: no valid AnimationPlayer path set, disabling playback");
 		set_active(false);
 		cache_valid = false;
-		return;
+		return false;
 	}
 
 	AnimationPlayer *player = Object::cast_to<AnimationPlayer>(get_node(animation_player));
@@ -927,12 +933,12 @@ void AnimationTree::_process_graph(double p_delta) {
 		ERR_PRINT("AnimationTree: path points to a node not an AnimationPlayer, disabling playback");
 		set_active(false);
 		cache_valid = false;
-		return;
+		return false;
 	}
 
 	if (!cache_valid) {
 		if (!_update_caches(player)) {
-			return;
+			return false;
 		}
 	}
 
@@ -969,7 +975,7 @@ void AnimationTree::_process_graph(double p_delta) {
 	}
 
 	if (!state.valid) {
-		return; //state is not valid. do nothing.
+		return false; //state is not valid. do nothing.
 	}
 
 	// Init all value/transform/blend/bezier tracks that track_cache has.
@@ -1008,443 +1014,500 @@ void AnimationTree::_process_graph(double p_delta) {
 		}
 	}
 
+	return true;
+}
+
+void AnimationTree::_process_animation_states(bool p_sample, bool p_side_effects) {
 	// Apply value/transform/blend/bezier blends to track caches and execute method/audio/animation tracks.
-	{
-		bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
-
-		for (const AnimationNode::AnimationState &as : state.animation_states) {
-			Ref<Animation> a = as.animation;
-			double time = as.time;
-			double delta = as.delta;
-			real_t weight = as.blend;
-			bool seeked = as.seeked;
-			Animation::LoopedFlag looped_flag = as.looped_flag;
-			bool is_external_seeking = as.is_external_seeking;
+	// Sampling only touches the track caches of this tree, so it can run on a worker thread. Everything else has side effects.
+	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
+
+	for (const AnimationNode::AnimationState &as : state.animation_states) {
+		Ref<Animation> a = as.animation;
+		double time = as.time;
+		double delta = as.delta;
+		real_t weight = as.blend;
+		bool seeked = as.seeked;
+		Animation::LoopedFlag looped_flag = as.looped_flag;
+		bool is_external_seeking = as.is_external_seeking;
 #ifndef _3D_DISABLED
-			bool backward = signbit(delta); // This flag is required only for the root motion since it calculates the difference between the previous and current frames.
-			bool calc_root = !seeked || is_external_seeking;
+		bool backward = signbit(delta); // This flag is required only for the root motion since it calculates the difference between the previous and current frames.
+		bool calc_root = !seeked || is_external_seeking;
 #endif // _3D_DISABLED
 
-			for (int i = 0; i < a->get_track_count(); i++) {
-				if (!a->track_is_enabled(i)) {
-					continue;
-				}
+		LocalVector<Animation::TrackSampleCursor> &cursors = sample_cursors[a->get_instance_id()];
+		if (cursors.size() != (uint32_t)a->get_track_count()) {
+			cursors.resize(a->get_track_count());
+		}
 
-				NodePath path = a->track_get_path(i);
-				if (!track_cache.has(path)) {
-					continue; // No path, but avoid error spamming.
-				}
-				TrackCache *track = track_cache[path];
-
-				ERR_CONTINUE(!state.track_map.has(path));
-				int blend_idx = state.track_map[path];
-				ERR_CONTINUE(blend_idx < 0 || blend_idx >= state.track_count);
-				real_t blend = (*as.track_blends)[blend_idx] * weight;
-				if (Math::is_zero_approx(blend)) {
-					continue; // Nothing to blend.
-				}
+		for (int i = 0; i < a->get_track_count(); i++) {
+			if (!a->track_is_enabled(i)) {
+				continue;
+			}
 
-				Animation::TrackType ttype = a->track_get_type(i);
-				if (ttype != Animation::TYPE_POSITION_3D && ttype != Animation::TYPE_ROTATION_3D && ttype != Animation::TYPE_SCALE_3D && track->type != ttype) {
-					//broken animation, but avoid error spamming
-					continue;
-				}
-				track->root_motion = root_motion_track == path;
+			Animation::TrackType ttype = a->track_get_type(i);
+			bool sampled = ttype != Animation::TYPE_METHOD && ttype != Animation::TYPE_AUDIO && ttype != Animation::TYPE_ANIMATION;
+			if (ttype == Animation::TYPE_VALUE) {
+				Animation::UpdateMode update_mode = a->value_track_get_update_mode(i);
+				sampled = update_mode == Animation::UPDATE_CONTINUOUS || update_mode == Animation::UPDATE_CAPTURE;
+			}
+			if (sampled ? !p_sample : !p_side_effects) {
+				continue;
+			}
 
-				switch (ttype) {
-					case Animation::TYPE_POSITION_3D: {
+			NodePath path = a->track_get_path(i);
+			if (!track_cache.has(path)) {
+				continue; // No path, but avoid error spamming.
+			}
+			TrackCache *track = track_cache[path];
+
+			ERR_CONTINUE(!state.track_map.has(path));
+			int blend_idx = state.track_map[path];
+			ERR_CONTINUE(blend_idx < 0 || blend_idx >= state.track_count);
+			real_t blend = (*as.track_blends)[blend_idx] * weight;
+			if (Math::is_zero_approx(blend)) {
+				continue; // Nothing to blend.
+			}
+
+			if (ttype != Animation::TYPE_POSITION_3D && ttype != Animation::TYPE_ROTATION_3D && ttype != Animation::TYPE_SCALE_3D && track->type != ttype) {
+				//broken animation, but avoid error spamming
+				continue;
+			}
+			track->root_motion = root_motion_track == path;
+
+			switch (ttype) {
+				case Animation::TYPE_POSITION_3D: {
 #ifndef _3D_DISABLED
-						TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
-						if (track->root_motion && calc_root) {
-							double prev_time = time - delta;
-							if (!backward) {
-								if (prev_time < 0) {
-									switch (a->get_loop_mode()) {
-										case Animation::LOOP_NONE: {
-											prev_time = 0;
-										} break;
-										case Animation::LOOP_LINEAR: {
-											prev_time = Math::fposmod(prev_time, (double)a->get_length());
-										} break;
-										case Animation::LOOP_PINGPONG: {
-											prev_time = Math::pingpong(prev_time, (double)a->get_length());
-										} break;
-										default:
-											break;
-									}
+					TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
+					if (track->root_motion && calc_root) {
+						double prev_time = time - delta;
+						if (!backward) {
+							if (prev_time < 0) {
+								switch (a->get_loop_mode()) {
+									case Animation::LOOP_NONE: {
+										prev_time = 0;
+									} break;
+									case Animation::LOOP_LINEAR: {
+										prev_time = Math::fposmod(prev_time, (double)a->get_length());
+									} break;
+									case Animation::LOOP_PINGPONG: {
+										prev_time = Math::pingpong(prev_time, (double)a->get_length());
+									} break;
+									default:
+										break;
 								}
-							} else {
-								if (prev_time > a->get_length()) {
-									switch (a->get_loop_mode()) {
-										case Animation::LOOP_NONE: {
-											prev_time = (double)a->get_length();
-										} break;
-										case Animation::LOOP_LINEAR: {
-											prev_time = Math::fposmod(prev_time, (double)a->get_length());
-										} break;
-										case Animation::LOOP_PINGPONG: {
-											prev_time = Math::pingpong(prev_time, (double)a->get_length());
-										} break;
-										default:
-											break;
-									}
+							}
+						} else {
+							if (prev_time > a->get_length()) {
+								switch (a->get_loop_mode()) {
+									case Animation::LOOP_NONE: {
+										prev_time = (double)a->get_length();
+									} break;
+									case Animation::LOOP_LINEAR: {
+										prev_time = Math::fposmod(prev_time, (double)a->get_length());
+									} break;
+									case Animation::LOOP_PINGPONG: {
+										prev_time = Math::pingpong(prev_time, (double)a->get_length());
+									} break;
+									default:
+										break;
 								}
 							}
+						}
 
-							Vector3 loc[2];
+						Vector3 loc[2];
 
-							if (!backward) {
-								if (prev_time > time) {
-									Error err = a->position_track_interpolate(i, prev_time, &loc[0]);
-									if (err != OK) {
-										continue;
-									}
-									loc[0] = _post_process_key_value(a, i, loc[0], t->object, t->bone_idx);
-									a->position_track_interpolate(i, (double)a->get_length(), &loc[1]);
-									loc[1] = _post_process_key_value(a, i, loc[1], t->object, t->bone_idx);
-									t->loc += (loc[1] - loc[0]) * blend;
-									prev_time = 0;
-								}
-							} else {
-								if (prev_time < time) {
-									Error err = a->position_track_interpolate(i, prev_time, &loc[0]);
-									if (err != OK) {
-										continue;
-									}
-									loc[0] = _post_process_key_value(a, i, loc[0], t->object, t->bone_idx);
-									a->position_track_interpolate(i, 0, &loc[1]);
-									loc[1] = _post_process_key_value(a, i, loc[1], t->object, t->bone_idx);
-									t->loc += (loc[1] - loc[0]) * blend;
-									prev_time = (double)a->get_length();
+						if (!backward) {
+							if (prev_time > time) {
+								Error err = a->position_track_interpolate(i, prev_time, &loc[0]);
+								if (err != OK) {
+									continue;
 								}
+								loc[0] = _post_process_key_value(a, i, loc[0], t->object, t->bone_idx);
+								a->position_track_interpolate(i, (double)a->get_length(), &loc[1]);
+								loc[1] = _post_process_key_value(a, i, loc[1], t->object, t->bone_idx);
+								t->loc += (loc[1] - loc[0]) * blend;
+								prev_time = 0;
 							}
-
-							Error err = a->position_track_interpolate(i, prev_time, &loc[0]);
-							if (err != OK) {
-								continue;
+						} else {
+							if (prev_time < time) {
+								Error err = a->position_track_interpolate(i, prev_time, &loc[0]);
+								if (err != OK) {
+									continue;
+								}
+								loc[0] = _post_process_key_value(a, i, loc[0], t->object, t->bone_idx);
+								a->position_track_interpolate(i, 0, &loc[1]);
+								loc[1] = _post_process_key_value(a, i, loc[1], t->object, t->bone_idx);
+								t->loc += (loc[1] - loc[0]) * blend;
+								prev_time = (double)a->get_length();
 							}
-							loc[0] = _post_process_key_value(a, i, loc[0], t->object, t->bone_idx);
+						}
 
-							a->position_track_interpolate(i, time, &loc[1]);
-							loc[1] = _post_process_key_value(a, i, loc[1], t->object, t->bone_idx);
-							t->loc += (loc[1] - loc[0]) * blend;
-							prev_time = !backward ? 0 : (double)a->get_length();
+						Error err = a->position_track_interpolate(i, prev_time, &loc[0]);
+						if (err != OK) {
+							continue;
+						}
+						loc[0] = _post_process_key_value(a, i, loc[0], t->object, t->bone_idx);
 
-						} else {
-							Vector3 loc;
+						a->position_track_interpolate(i, time, &loc[1]);
+						loc[1] = _post_process_key_value(a, i, loc[1], t->object, t->bone_idx);
+						t->loc += (loc[1] - loc[0]) * blend;
+						prev_time = !backward ? 0 : (double)a->get_length();
 
-							Error err = a->position_track_interpolate(i, time, &loc);
-							if (err != OK) {
-								continue;
-							}
-							loc = _post_process_key_value(a, i, loc, t->object, t->bone_idx);
+					} else {
+						Vector3 loc;
 
-							t->loc += (loc - t->init_loc) * blend;
+						Error err = a->position_track_interpolate(i, time, &loc, &cursors[i]);
+						if (err != OK) {
+							continue;
 						}
+						loc = _post_process_key_value(a, i, loc, t->object, t->bone_idx);
+
+						t->loc += (loc - t->init_loc) * blend;
+					}
 #endif // _3D_DISABLED
-					} break;
-					case Animation::TYPE_ROTATION_3D: {
+				} break;
+				case Animation::TYPE_ROTATION_3D: {
 #ifndef _3D_DISABLED
-						TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
-						if (track->root_motion && calc_root) {
-							double prev_time = time - delta;
-							if (!backward) {
-								if (prev_time < 0) {
-									switch (a->get_loop_mode()) {
-										case Animation::LOOP_NONE: {
-											prev_time = 0;
-										} break;
-										case Animation::LOOP_LINEAR: {
-											prev_time = Math::fposmod(prev_time, (double)a->get_length());
-										} break;
-										case Animation::LOOP_PINGPONG: {
-											prev_time = Math::pingpong(prev_time, (double)a->get_length());
-										} break;
-										default:
-											break;
-									}
+					TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
+					if (track->root_motion && calc_root) {
+						double prev_time = time - delta;
+						if (!backward) {
+							if (prev_time < 0) {
+								switch (a->get_loop_mode()) {
+									case Animation::LOOP_NONE: {
+										prev_time = 0;
+									} break;
+									case Animation::LOOP_LINEAR: {
+										prev_time = Math::fposmod(prev_time, (double)a->get_length());
+									} break;
+									case Animation::LOOP_PINGPONG: {
+										prev_time = Math::pingpong(prev_time, (double)a->get_length());
+									} break;
+									default:
+										break;
 								}
-							} else {
-								if (prev_time > a->get_length()) {
-									switch (a->get_loop_mode()) {
-										case Animation::LOOP_NONE: {
-											prev_time = (double)a->get_length();
-										} break;
-										case Animation::LOOP_LINEAR: {
-											prev_time = Math::fposmod(prev_time, (double)a->get_length());
-										} break;
-										case Animation::LOOP_PINGPONG: {
-											prev_time = Math::pingpong(prev_time, (double)a->get_length());
-										} break;
-										default:
-											break;
-									}
+							}
+						} else {
+							if (prev_time > a->get_length()) {
+								switch (a->get_loop_mode()) {
+									case Animation::LOOP_NONE: {
+										prev_time = (double)a->get_length();
+									} break;
+									case Animation::LOOP_LINEAR: {
+										prev_time = Math::fposmod(prev_time, (double)a->get_length());
+									} break;
+									case Animation::LOOP_PINGPONG: {
+										prev_time = Math::pingpong(prev_time, (double)a->get_length());
+									} break;
+									default:
+										break;
 								}
 							}
+						}
 
-							Quaternion rot[2];
+						Quaternion rot[2];
 
-							if (!backward) {
-								if (prev_time > time) {
-									Error err = a->rotation_track_interpolate(i, prev_time, &rot[0]);
-									if (err != OK) {
-										continue;
-									}
-									rot[0] = _post_process_key_value(a, i, rot[0], t->object, t->bone_idx);
-									a->rotation_track_interpolate(i, (double)a->get_length(), &rot[1]);
-									rot[1] = _post_process_key_value(a, i, rot[1], t->object, t->bone_idx);
-									t->rot = (t->rot * Quaternion().slerp(rot[0].inverse() * rot[1], blend)).normalized();
-									prev_time = 0;
-								}
-							} else {
-								if (prev_time < time) {
-									Error err = a->rotation_track_interpolate(i, prev_time, &rot[0]);
-									if (err != OK) {
-										continue;
-									}
-									rot[0] = _post_process_key_value(a, i, rot[0], t->object, t->bone_idx);
-									a->rotation_track_interpolate(i, 0, &rot[1]);
-									t->rot = (t->rot * Quaternion().slerp(rot[0].inverse() * rot[1], blend)).normalized();
-									prev_time = (double)a->get_length();
+						if (!backward) {
+							if (prev_time > time) {
+								Error err = a->rotation_track_interpolate(i, prev_time, &rot[0]);
+								if (err != OK) {
+									continue;
 								}
+								rot[0] = _post_process_key_value(a, i, rot[0], t->object, t->bone_idx);
+								a->rotation_track_interpolate(i, (double)a->get_length(), &rot[1]);
+								rot[1] = _post_process_key_value(a, i, rot[1], t->object, t->bone_idx);
+								t->rot = (t->rot * Quaternion().slerp(rot[0].inverse() * rot[1], blend)).normalized();
+								prev_time = 0;
 							}
-
-							Error err = a->rotation_track_interpolate(i, prev_time, &rot[0]);
-							if (err != OK) {
-								continue;
+						} else {
+							if (prev_time < time) {
+								Error err = a->rotation_track_interpolate(i, prev_time, &rot[0]);
+								if (err != OK) {
+									continue;
+								}
+								rot[0] = _post_process_key_value(a, i, rot[0], t->object, t->bone_idx);
+								a->rotation_track_interpolate(i, 0, &rot[1]);
+								t->rot = (t->rot * Quaternion().slerp(rot[0].inverse() * rot[1], blend)).normalized();
+								prev_time = (double)a->get_length();
 							}
-							rot[0] = _post_process_key_value(a, i, rot[0], t->object, t->bone_idx);
+						}
 
-							a->rotation_track_interpolate(i, time, &rot[1]);
-							rot[1] = _post_process_key_value(a, i, rot[1], t->object, t->bone_idx);
-							t->rot = (t->rot * Quaternion().slerp(rot[0].inverse() * rot[1], blend)).normalized();
-							prev_time = !backward ? 0 : (double)a->get_length();
+						Error err = a->rotation_track_interpolate(i, prev_time, &rot[0]);
+						if (err != OK) {
+							continue;
+						}
+						rot[0] = _post_process_key_value(a, i, rot[0], t->object, t->bone_idx);
 
-						} else {
-							Quaternion rot;
+						a->rotation_track_interpolate(i, time, &rot[1]);
+						rot[1] = _post_process_key_value(a, i, rot[1], t->object, t->bone_idx);
+						t->rot = (t->rot * Quaternion().slerp(rot[0].inverse() * rot[1], blend)).normalized();
+						prev_time = !backward ? 0 : (double)a->get_length();
 
-							Error err = a->rotation_track_interpolate(i, time, &rot);
-							if (err != OK) {
-								continue;
-							}
-							rot = _post_process_key_value(a, i, rot, t->object, t->bone_idx);
+					} else {
+						Quaternion rot;
 
-							t->rot = (t->rot * Quaternion().slerp(t->init_rot.inverse() * rot, blend)).normalized();
+						Error err = a->rotation_track_interpolate(i, time, &rot, &cursors[i]);
+						if (err != OK) {
+							continue;
 						}
+						rot = _post_process_key_value(a, i, rot, t->object, t->bone_idx);
+
+						t->rot = (t->rot * Quaternion().slerp(t->init_rot.inverse() * rot, blend)).normalized();
+					}
 #endif // _3D_DISABLED
-					} break;
-					case Animation::TYPE_SCALE_3D: {
+				} break;
+				case Animation::TYPE_SCALE_3D: {
 #ifndef _3D_DISABLED
-						TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
-						if (track->root_motion && calc_root) {
-							double prev_time = time - delta;
-							if (!backward) {
-								if (prev_time < 0) {
-									switch (a->get_loop_mode()) {
-										case Animation::LOOP_NONE: {
-											prev_time = 0;
-										} break;
-										case Animation::LOOP_LINEAR: {
-											prev_time = Math::fposmod(prev_time, (double)a->get_length());
-										} break;
-										case Animation::LOOP_PINGPONG: {
-											prev_time = Math::pingpong(prev_time, (double)a->get_length());
-										} break;
-										default:
-											break;
-									}
+					TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
+					if (track->root_motion && calc_root) {
+						double prev_time = time - delta;
+						if (!backward) {
+							if (prev_time < 0) {
+								switch (a->get_loop_mode()) {
+									case Animation::LOOP_NONE: {
+										prev_time = 0;
+									} break;
+									case Animation::LOOP_LINEAR: {
+										prev_time = Math::fposmod(prev_time, (double)a->get_length());
+									} break;
+									case Animation::LOOP_PINGPONG: {
+										prev_time = Math::pingpong(prev_time, (double)a->get_length());
+									} break;
+									default:
+										break;
 								}
-							} else {
-								if (prev_time > a->get_length()) {
-									switch (a->get_loop_mode()) {
-										case Animation::LOOP_NONE: {
-											prev_time = (double)a->get_length();
-										} break;
-										case Animation::LOOP_LINEAR: {
-											prev_time = Math::fposmod(prev_time, (double)a->get_length());
-										} break;
-										case Animation::LOOP_PINGPONG: {
-											prev_time = Math::pingpong(prev_time, (double)a->get_length());
-										} break;
-										default:
-											break;
-									}
+							}
+						} else {
+							if (prev_time > a->get_length()) {
+								switch (a->get_loop_mode()) {
+									case Animation::LOOP_NONE: {
+										prev_time = (double)a->get_length();
+									} break;
+									case Animation::LOOP_LINEAR: {
+										prev_time = Math::fposmod(prev_time, (double)a->get_length());
+									} break;
+									case Animation::LOOP_PINGPONG: {
+										prev_time = Math::pingpong(prev_time, (double)a->get_length());
+									} break;
+									default:
+										break;
 								}
 							}
+						}
 
-							Vector3 scale[2];
+						Vector3 scale[2];
 
-							if (!backward) {
-								if (prev_time > time) {
-									Error err = a->scale_track_interpolate(i, prev_time, &scale[0]);
-									if (err != OK) {
-										continue;
-									}
-									scale[0] = _post_process_key_value(a, i, scale[0], t->object, t->bone_idx);
-									a->scale_track_interpolate(i, (double)a->get_length(), &scale[1]);
-									t->scale += (scale[1] - scale[0]) * blend;
-									scale[1] = _post_process_key_value(a, i, scale[1], t->object, t->bone_idx);
-									prev_time = 0;
-								}
-							} else {
-								if (prev_time < time) {
-									Error err = a->scale_track_interpolate(i, prev_time, &scale[0]);
-									if (err != OK) {
-										continue;
-									}
-									scale[0] = _post_process_key_value(a, i, scale[0], t->object, t->bone_idx);
-									a->scale_track_interpolate(i, 0, &scale[1]);
-									scale[1] = _post_process_key_value(a, i, scale[1], t->object, t->bone_idx);
-									t->scale += (scale[1] - scale[0]) * blend;
-									prev_time = (double)a->get_length();
+						if (!backward) {
+							if (prev_time > time) {
+								Error err = a->scale_track_interpolate(i, prev_time, &scale[0]);
+								if (err != OK) {
+									continue;
 								}
+								scale[0] = _post_process_key_value(a, i, scale[0], t->object, t->bone_idx);
+								a->scale_track_interpolate(i, (double)a->get_length(), &scale[1]);
+								t->scale += (scale[1] - scale[0]) * blend;
+								scale[1] = _post_process_key_value(a, i, scale[1], t->object, t->bone_idx);
+								prev_time = 0;
 							}
-
-							Error err = a->scale_track_interpolate(i, prev_time, &scale[0]);
-							if (err != OK) {
-								continue;
+						} else {
+							if (prev_time < time) {
+								Error err = a->scale_track_interpolate(i, prev_time, &scale[0]);
+								if (err != OK) {
+									continue;
+								}
+								scale[0] = _post_process_key_value(a, i, scale[0], t->object, t->bone_idx);
+								a->scale_track_interpolate(i, 0, &scale[1]);
+								scale[1] = _post_process_key_value(a, i, scale[1], t->object, t->bone_idx);
+								t->scale += (scale[1] - scale[0]) * blend;
+								prev_time = (double)a->get_length();
 							}
-							scale[0] = _post_process_key_value(a, i, scale[0], t->object, t->bone_idx);
+						}
 
-							a->scale_track_interpolate(i, time, &scale[1]);
-							scale[1] = _post_process_key_value(a, i, scale[1], t->object, t->bone_idx);
-							t->scale += (scale[1] - scale[0]) * blend;
-							prev_time = !backward ? 0 : (double)a->get_length();
+						Error err = a->scale_track_interpolate(i, prev_time, &scale[0]);
+						if (err != OK) {
+							continue;
+						}
+						scale[0] = _post_process_key_value(a, i, scale[0], t->object, t->bone_idx);
 
-						} else {
-							Vector3 scale;
+						a->scale_track_interpolate(i, time, &scale[1]);
+						scale[1] = _post_process_key_value(a, i, scale[1], t->object, t->bone_idx);
+						t->scale += (scale[1] - scale[0]) * blend;
+						prev_time = !backward ? 0 : (double)a->get_length();
 
-							Error err = a->scale_track_interpolate(i, time, &scale);
-							if (err != OK) {
-								continue;
-							}
-							scale = _post_process_key_value(a, i, scale, t->object, t->bone_idx);
+					} else {
+						Vector3 scale;
 
-							t->scale += (scale - t->init_scale) * blend;
+						Error err = a->scale_track_interpolate(i, time, &scale, &cursors[i]);
+						if (err != OK) {
+							continue;
 						}
+						scale = _post_process_key_value(a, i, scale, t->object, t->bone_idx);
+
+						t->scale += (scale - t->init_scale) * blend;
+					}
 #endif // _3D_DISABLED
-					} break;
-					case Animation::TYPE_BLEND_SHAPE: {
+				} break;
+				case Animation::TYPE_BLEND_SHAPE: {
 #ifndef _3D_DISABLED
-						TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
+					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 
-						float value;
+					float value;
 
-						Error err = a->blend_shape_track_interpolate(i, time, &value);
-						//ERR_CONTINUE(err!=OK); //used for testing, should be removed
+					Error err = a->blend_shape_track_interpolate(i, time, &value, &cursors[i]);
+					//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 
-						if (err != OK) {
-							continue;
-						}
-						value = _post_process_key_value(a, i, value, t->object, t->shape_index);
+					if (err != OK) {
+						continue;
+					}
+					value = _post_process_key_value(a, i, value, t->object, t->shape_index);
 
-						t->value += (value - t->init_value) * blend;
+					t->value += (value - t->init_value) * blend;
 #endif // _3D_DISABLED
-					} break;
-					case Animation::TYPE_VALUE: {
-						TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
+				} break;
+				case Animation::TYPE_VALUE: {
+					TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
 
-						Animation::UpdateMode update_mode = a->value_track_get_update_mode(i);
+					Animation::UpdateMode update_mode = a->value_track_get_update_mode(i);
 
-						if (update_mode == Animation::UPDATE_CONTINUOUS || update_mode == Animation::UPDATE_CAPTURE) {
-							Variant value = a->value_track_interpolate(i, time);
-							value = _post_process_key_value(a, i, value, t->object);
+					if (update_mode == Animation::UPDATE_CONTINUOUS || update_mode == Animation::UPDATE_CAPTURE) {
+						Variant value = a->value_track_interpolate(i, time);
+						value = _post_process_key_value(a, i, value, t->object);
 
-							if (value == Variant()) {
-								continue;
-							}
+						if (value == Variant()) {
+							continue;
+						}
 
-							// Special case for angle interpolation.
-							if (t->is_using_angle) {
-								// For blending consistency, it prevents rotation of more than 180 degrees from init_value.
-								// This is the same as for Quaternion blends.
-								float rot_a = t->value;
-								float rot_b = value;
-								float rot_init = t->init_value;
-								rot_a = Math::fposmod(rot_a, (float)Math_TAU);
-								rot_b = Math::fposmod(rot_b, (float)Math_TAU);
-								rot_init = Math::fposmod(rot_init, (float)Math_TAU);
-								if (rot_init < Math_PI) {
-									rot_a = rot_a > rot_init + Math_PI ? rot_a - Math_TAU : rot_a;
-									rot_b = rot_b > rot_init + Math_PI ? rot_b - Math_TAU : rot_b;
-								} else {
-									rot_a = rot_a < rot_init - Math_PI ? rot_a + Math_TAU : rot_a;
-									rot_b = rot_b < rot_init - Math_PI ? rot_b + Math_TAU : rot_b;
-								}
-								t->value = Math::fposmod(rot_a + (rot_b - rot_init) * (float)blend, (float)Math_TAU);
+						// Special case for angle interpolation.
+						if (t->is_using_angle) {
+							// For blending consistency, it prevents rotation of more than 180 degrees from init_value.
+							// This is the same as for Quaternion blends.
+							float rot_a = t->value;
+							float rot_b = value;
+							float rot_init = t->init_value;
+							rot_a = Math::fposmod(rot_a, (float)Math_TAU);
+							rot_b = Math::fposmod(rot_b, (float)Math_TAU);
+							rot_init = Math::fposmod(rot_init, (float)Math_TAU);
+							if (rot_init < Math_PI) {
+								rot_a = rot_a > rot_init + Math_PI ? rot_a - Math_TAU : rot_a;
+								rot_b = rot_b > rot_init + Math_PI ? rot_b - Math_TAU : rot_b;
 							} else {
-								if (t->init_value.get_type() == Variant::BOOL) {
-									value = Animation::subtract_variant(value.operator real_t(), t->init_value.operator real_t());
-									t->value = Animation::blend_variant(t->value.operator real_t(), value.operator real_t(), blend);
-								} else {
-									value = Animation::subtract_variant(value, t->init_value);
-									t->value = Animation::blend_variant(t->value, value, blend);
-								}
+								rot_a = rot_a < rot_init - Math_PI ? rot_a + Math_TAU : rot_a;
+								rot_b = rot_b < rot_init - Math_PI ? rot_b + Math_TAU : rot_b;
 							}
+							t->value = Math::fposmod(rot_a + (rot_b - rot_init) * (float)blend, (float)Math_TAU);
 						} else {
-							if (seeked) {
-								int idx = a->track_find_key(i, time, !is_external_seeking);
-								if (idx < 0) {
-									continue;
-								}
-								Variant value = a->track_get_key_value(i, idx);
-								value = _post_process_key_value(a, i, value, t->object);
-								t->object->set_indexed(t->subpath, value);
+							if (t->init_value.get_type() == Variant::BOOL) {
+								value = Animation::subtract_variant(value.operator real_t(), t->init_value.operator real_t());
+								t->value = Animation::blend_variant(t->value.operator real_t(), value.operator real_t(), blend);
 							} else {
-								List<int> indices;
-								a->track_get_key_indices_in_range(i, time, delta, &indices, looped_flag);
-								for (int &F : indices) {
-									Variant value = a->track_get_key_value(i, F);
-									value = _post_process_key_value(a, i, value, t->object);
-									t->object->set_indexed(t->subpath, value);
-								}
+								value = Animation::subtract_variant(value, t->init_value);
+								t->value = Animation::blend_variant(t->value, value, blend);
 							}
 						}
-
-					} break;
-					case Animation::TYPE_METHOD: {
-						TrackCacheMethod *t = static_cast<TrackCacheMethod *>(track);
-
+					} else {
 						if (seeked) {
 							int idx = a->track_find_key(i, time, !is_external_seeking);
 							if (idx < 0) {
 								continue;
 							}
-							StringName method = a->method_track_get_name(i, idx);
-							Vector<Variant> params = a->method_track_get_params(i, idx);
-							if (can_call) {
-								_call_object(t->object, method, params, false);
-							}
+							Variant value = a->track_get_key_value(i, idx);
+							value = _post_process_key_value(a, i, value, t->object);
+							t->object->set_indexed(t->subpath, value);
 						} else {
 							List<int> indices;
 							a->track_get_key_indices_in_range(i, time, delta, &indices, looped_flag);
 							for (int &F : indices) {
-								StringName method = a->method_track_get_name(i, F);
-								Vector<Variant> params = a->method_track_get_params(i, F);
-								if (can_call) {
-									_call_object(t->object, method, params, true);
-								}
+								Variant value = a->track_get_key_value(i, F);
+								value = _post_process_key_value(a, i, value, t->object);
+								t->object->set_indexed(t->subpath, value);
 							}
 						}
-					} break;
-					case Animation::TYPE_BEZIER: {
-						TrackCacheBezier *t = static_cast<TrackCacheBezier *>(track);
+					}
 
-						real_t bezier = a->bezier_track_interpolate(i, time);
-						bezier = _post_process_key_value(a, i, bezier, t->object);
+				} break;
+				case Animation::TYPE_METHOD: {
+					TrackCacheMethod *t = static_cast<TrackCacheMethod *>(track);
 
-						t->value += (bezier - t->init_value) * blend;
-					} break;
-					case Animation::TYPE_AUDIO: {
-						TrackCacheAudio *t = static_cast<TrackCacheAudio *>(track);
+					if (seeked) {
+						int idx = a->track_find_key(i, time, !is_external_seeking);
+						if (idx < 0) {
+							continue;
+						}
+						StringName method = a->method_track_get_name(i, idx);
+						Vector<Variant> params = a->method_track_get_params(i, idx);
+						if (can_call) {
+							_call_object(t->object, method, params, false);
+						}
+					} else {
+						List<int> indices;
+						a->track_get_key_indices_in_range(i, time, delta, &indices, looped_flag);
+						for (int &F : indices) {
+							StringName method = a->method_track_get_name(i, F);
+							Vector<Variant> params = a->method_track_get_params(i, F);
+							if (can_call) {
+								_call_object(t->object, method, params, true);
+							}
+						}
+					}
+				} break;
+				case Animation::TYPE_BEZIER: {
+					TrackCacheBezier *t = static_cast<TrackCacheBezier *>(track);
 
-						if (seeked) {
-							//find whatever should be playing
-							int idx = a->track_find_key(i, time, !is_external_seeking);
-							if (idx < 0) {
+					real_t bezier = a->bezier_track_interpolate(i, time);
+					bezier = _post_process_key_value(a, i, bezier, t->object);
+
+					t->value += (bezier - t->init_value) * blend;
+				} break;
+				case Animation::TYPE_AUDIO: {
+					TrackCacheAudio *t = static_cast<TrackCacheAudio *>(track);
+
+					if (seeked) {
+						//find whatever should be playing
+						int idx = a->track_find_key(i, time, !is_external_seeking);
+						if (idx < 0) {
+							continue;
+						}
+
+						Ref<AudioStream> stream = a->audio_track_get_key_stream(i, idx);
+						if (!stream.is_valid()) {
+							t->object->call(SNAME("stop"));
+							t->playing = false;
+							playing_caches.erase(t);
+						} else {
+							double start_ofs = a->audio_track_get_key_start_offset(i, idx);
+							start_ofs += time - a->track_get_key_time(i, idx);
+							double end_ofs = a->audio_track_get_key_end_offset(i, idx);
+							double len = stream->get_length();
+
+							if (start_ofs > len - end_ofs) {
+								t->object->call(SNAME("stop"));
+								t->playing = false;
+								playing_caches.erase(t);
 								continue;
 							}
 
+							t->object->call(SNAME("set_stream"), stream);
+							t->object->call(SNAME("play"), start_ofs);
+
+							t->playing = true;
+							playing_caches.insert(t);
+							if (len && end_ofs > 0) { //force an end at a time
+								t->len = len - start_ofs - end_ofs;
+							} else {
+								t->len = 0;
+							}
+
+							t->start = time;
+						}
+
+					} else {
+						//find stuff to play
+						List<int> to_play;
+						a->track_get_key_indices_in_range(i, time, delta, &to_play, looped_flag);
+						if (to_play.size()) {
+							int idx = to_play.back()->get();
+
 							Ref<AudioStream> stream = a->audio_track_get_key_stream(i, idx);
 							if (!stream.is_valid()) {
 								t->object->call(SNAME("stop"));
@@ -1452,17 +1515,9 @@ void AnimationTree::_process_graph(double p_delta) {
 								playing_caches.erase(t);
 							} else {
 								double start_ofs = a->audio_track_get_key_start_offset(i, idx);
-								start_ofs += time - a->track_get_key_time(i, idx);
 								double end_ofs = a->audio_track_get_key_end_offset(i, idx);
 								double len = stream->get_length();
 
-								if (start_ofs > len - end_ofs) {
-									t->object->call(SNAME("stop"));
-									t->playing = false;
-									playing_caches.erase(t);
-									continue;
-								}
-
 								t->object->call(SNAME("set_stream"), stream);
 								t->object->call(SNAME("play"), start_ofs);
 
@@ -1476,221 +1531,264 @@ void AnimationTree::_process_graph(double p_delta) {
 
 								t->start = time;
 							}
+						} else if (t->playing) {
+							bool loop = a->get_loop_mode() != Animation::LOOP_NONE;
 
-						} else {
-							//find stuff to play
-							List<int> to_play;
-							a->track_get_key_indices_in_range(i, time, delta, &to_play, looped_flag);
-							if (to_play.size()) {
-								int idx = to_play.back()->get();
-
-								Ref<AudioStream> stream = a->audio_track_get_key_stream(i, idx);
-								if (!stream.is_valid()) {
-									t->object->call(SNAME("stop"));
-									t->playing = false;
-									playing_caches.erase(t);
-								} else {
-									double start_ofs = a->audio_track_get_key_start_offset(i, idx);
-									double end_ofs = a->audio_track_get_key_end_offset(i, idx);
-									double len = stream->get_length();
-
-									t->object->call(SNAME("set_stream"), stream);
-									t->object->call(SNAME("play"), start_ofs);
-
-									t->playing = true;
-									playing_caches.insert(t);
-									if (len && end_ofs > 0) { //force an end at a time
-										t->len = len - start_ofs - end_ofs;
-									} else {
-										t->len = 0;
-									}
+							bool stop = false;
 
-									t->start = time;
-								}
-							} else if (t->playing) {
-								bool loop = a->get_loop_mode() != Animation::LOOP_NONE;
-
-								bool stop = false;
-
-								if (!loop) {
-									if (delta > 0) {
-										if (time < t->start) {
-											stop = true;
-										}
-									} else if (delta < 0) {
-										if (time > t->start) {
-											stop = true;
-										}
+							if (!loop) {
+								if (delta > 0) {
+									if (time < t->start) {
+										stop = true;
 									}
-								} else if (t->len > 0) {
-									double len = t->start > time ? (a->get_length() - t->start) + time : time - t->start;
-
-									if (len > t->len) {
+								} else if (delta < 0) {
+									if (time > t->start) {
 										stop = true;
 									}
 								}
+							} else if (t->len > 0) {
+								double len = t->start > time ? (a->get_length() - t->start) + time : time - t->start;
 
-								if (stop) {
-									//time to stop
-									t->object->call(SNAME("stop"));
-									t->playing = false;
-									playing_caches.erase(t);
+								if (len > t->len) {
+									stop = true;
 								}
 							}
+
+							if (stop) {
+								//time to stop
+								t->object->call(SNAME("stop"));
+								t->playing = false;
+								playing_caches.erase(t);
+							}
 						}
+					}
 
-						real_t db = Math::linear_to_db(MAX(blend, 0.00001));
-						t->object->call(SNAME("set_volume_db"), db);
-					} break;
-					case Animation::TYPE_ANIMATION: {
-						TrackCacheAnimation *t = static_cast<TrackCacheAnimation *>(track);
+					real_t db = Math::linear_to_db(MAX(blend, 0.00001));
+					t->object->call(SNAME("set_volume_db"), db);
+				} break;
+				case Animation::TYPE_ANIMATION: {
+					TrackCacheAnimation *t = static_cast<TrackCacheAnimation *>(track);
 
-						AnimationPlayer *player2 = Object::cast_to<AnimationPlayer>(t->object);
+					AnimationPlayer *player2 = Object::cast_to<AnimationPlayer>(t->object);
 
-						if (!player2) {
+					if (!player2) {
+						continue;
+					}
+
+					if (seeked) {
+						//seek
+						int idx = a->track_find_key(i, time, !is_external_seeking);
+						if (idx < 0) {
 							continue;
 						}
 
-						if (seeked) {
-							//seek
-							int idx = a->track_find_key(i, time, !is_external_seeking);
-							if (idx < 0) {
-								continue;
-							}
+						double pos = a->track_get_key_time(i, idx);
 
-							double pos = a->track_get_key_time(i, idx);
+						StringName anim_name = a->animation_track_get_key_animation(i, idx);
+						if (String(anim_name) == "[stop]" || !player2->has_animation(anim_name)) {
+							continue;
+						}
 
-							StringName anim_name = a->animation_track_get_key_animation(i, idx);
-							if (String(anim_name) == "[stop]" || !player2->has_animation(anim_name)) {
-								continue;
-							}
+						Ref<Animation> anim = player2->get_animation(anim_name);
 
-							Ref<Animation> anim = player2->get_animation(anim_name);
-
-							double at_anim_pos = 0.0;
-
-							switch (anim->get_loop_mode()) {
-								case Animation::LOOP_NONE: {
-									at_anim_pos = MAX((double)anim->get_length(), time - pos); //seek to end
-								} break;
-								case Animation::LOOP_LINEAR: {
-									at_anim_pos = Math::fposmod(time - pos, (double)anim->get_length()); //seek to loop
-								} break;
-								case Animation::LOOP_PINGPONG: {
-									at_anim_pos = Math::pingpong(time - pos, (double)a->get_length());
-								} break;
-								default:
-									break;
-							}
+						double at_anim_pos = 0.0;
 
-							if (player2->is_playing() || seeked) {
+						switch (anim->get_loop_mode()) {
+							case Animation::LOOP_NONE: {
+								at_anim_pos = MAX((double)anim->get_length(), time - pos); //seek to end
+							} break;
+							case Animation::LOOP_LINEAR: {
+								at_anim_pos = Math::fposmod(time - pos, (double)anim->get_length()); //seek to loop
+							} break;
+							case Animation::LOOP_PINGPONG: {
+								at_anim_pos = Math::pingpong(time - pos, (double)a->get_length());
+							} break;
+							default:
+								break;
+						}
+
+						if (player2->is_playing() || seeked) {
+							player2->play(anim_name);
+							player2->seek(at_anim_pos);
+							t->playing = true;
+							playing_caches.insert(t);
+						} else {
+							player2->set_assigned_animation(anim_name);
+							player2->seek(at_anim_pos, true);
+						}
+					} else {
+						//find stuff to play
+						List<int> to_play;
+						a->track_get_key_indices_in_range(i, time, delta, &to_play, looped_flag);
+						if (to_play.size()) {
+							int idx = to_play.back()->get();
+
+							StringName anim_name = a->animation_track_get_key_animation(i, idx);
+							if (String(anim_name) == "[stop]" || !player2->has_animation(anim_name)) {
+								if (playing_caches.has(t)) {
+									playing_caches.erase(t);
+									player2->stop();
+									t->playing = false;
+								}
+							} else {
 								player2->play(anim_name);
-								player2->seek(at_anim_pos);
 								t->playing = true;
 								playing_caches.insert(t);
-							} else {
-								player2->set_assigned_animation(anim_name);
-								player2->seek(at_anim_pos, true);
-							}
-						} else {
-							//find stuff to play
-							List<int> to_play;
-							a->track_get_key_indices_in_range(i, time, delta, &to_play, looped_flag);
-							if (to_play.size()) {
-								int idx = to_play.back()->get();
-
-								StringName anim_name = a->animation_track_get_key_animation(i, idx);
-								if (String(anim_name) == "[stop]" || !player2->has_animation(anim_name)) {
-									if (playing_caches.has(t)) {
-										playing_caches.erase(t);
-										player2->stop();
-										t->playing = false;
-									}
-								} else {
-									player2->play(anim_name);
-									t->playing = true;
-									playing_caches.insert(t);
-								}
 							}
 						}
+					}
 
-					} break;
-				}
+				} break;
 			}
 		}
 	}
+}
 
-	{
-		// finally, set the tracks
-		for (const KeyValue<NodePath, TrackCache *> &K : track_cache) {
-			TrackCache *track = K.value;
+void AnimationTree::_apply_track_caches() {
+	// finally, set the tracks
+	for (const KeyValue<NodePath, TrackCache *> &K : track_cache) {
+		TrackCache *track = K.value;
 
-			switch (track->type) {
-				case Animation::TYPE_POSITION_3D: {
+		switch (track->type) {
+			case Animation::TYPE_POSITION_3D: {
 #ifndef _3D_DISABLED
-					TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
-
-					if (t->root_motion) {
-						root_motion_position = t->loc;
-						root_motion_rotation = t->rot;
-						root_motion_scale = t->scale - Vector3(1, 1, 1);
-
-					} else if (t->skeleton && t->bone_idx >= 0) {
-						if (t->loc_used) {
-							t->skeleton->set_bone_pose_position(t->bone_idx, t->loc);
-						}
-						if (t->rot_used) {
-							t->skeleton->set_bone_pose_rotation(t->bone_idx, t->rot);
-						}
-						if (t->scale_used) {
-							t->skeleton->set_bone_pose_scale(t->bone_idx, t->scale);
-						}
-
-					} else if (!t->skeleton) {
-						if (t->loc_used) {
-							t->node_3d->set_position(t->loc);
-						}
-						if (t->rot_used) {
-							t->node_3d->set_rotation(t->rot.get_euler());
-						}
-						if (t->scale_used) {
-							t->node_3d->set_scale(t->scale);
-						}
+				TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
+
+				if (t->root_motion) {
+					root_motion_position = t->loc;
+					root_motion_rotation = t->rot;
+					root_motion_scale = t->scale - Vector3(1, 1, 1);
+
+				} else if (t->skeleton && t->bone_idx >= 0) {
+					Skeleton3D::BonePoseUpdate pose;
+					pose.bone = t->bone_idx;
+					pose.position = t->loc;
+					pose.rotation = t->rot;
+					pose.scale = t->scale;
+					pose.set_position = t->loc_used;
+					pose.set_rotation = t->rot_used;
+					pose.set_scale = t->scale_used;
+					bone_pose_updates[t->skeleton].push_back(pose);
+
+				} else if (!t->skeleton) {
+					if (t->loc_used) {
+						t->node_3d->set_position(t->loc);
+					}
+					if (t->rot_used) {
+						t->node_3d->set_rotation(t->rot.get_euler());
 					}
+					if (t->scale_used) {
+						t->node_3d->set_scale(t->scale);
+					}
+				}
 #endif // _3D_DISABLED
-				} break;
-				case Animation::TYPE_BLEND_SHAPE: {
+			} break;
+			case Animation::TYPE_BLEND_SHAPE: {
 #ifndef _3D_DISABLED
-					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
+				TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 
-					if (t->mesh_3d) {
-						t->mesh_3d->set_blend_shape_value(t->shape_index, t->value);
-					}
+				if (t->mesh_3d) {
+					t->mesh_3d->set_blend_shape_value(t->shape_index, t->value);
+				}
 #endif // _3D_DISABLED
-				} break;
-				case Animation::TYPE_VALUE: {
-					TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
+			} break;
+			case Animation::TYPE_VALUE: {
+				TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
 
-					if (t->is_discrete) {
-						break; // Don't overwrite the value set by UPDATE_DISCRETE.
-					}
+				if (t->is_discrete) {
+					break; // Don't overwrite the value set by UPDATE_DISCRETE.
+				}
 
-					if (t->init_value.get_type() == Variant::BOOL) {
-						t->object->set_indexed(t->subpath, t->value.operator real_t() >= 0.5);
-					} else {
-						t->object->set_indexed(t->subpath, t->value);
-					}
+				if (t->init_value.get_type() == Variant::BOOL) {
+					t->object->set_indexed(t->subpath, t->value.operator real_t() >= 0.5);
+				} else {
+					t->object->set_indexed(t->subpath, t->value);
+				}
 
-				} break;
-				case Animation::TYPE_BEZIER: {
-					TrackCacheBezier *t = static_cast<TrackCacheBezier *>(track);
+			} break;
+			case Animation::TYPE_BEZIER: {
+				TrackCacheBezier *t = static_cast<TrackCacheBezier *>(track);
 
-					t->object->set_indexed(t->subpath, t->value);
+				t->object->set_indexed(t->subpath, t->value);
 
-				} break;
-				default: {
-				} //the rest don't matter
-			}
+			} break;
+			default: {
+			} //the rest don't matter
+		}
+	}
+
+#ifndef _3D_DISABLED
+	// Bone poses are applied per skeleton, so each one is only marked dirty once.
+	for (KeyValue<Skeleton3D *, LocalVector<Skeleton3D::BonePoseUpdate>> &E : bone_pose_updates) {
+		if (E.value.size()) {
+			E.key->set_bone_poses(E.value.ptr(), E.value.size());
+			E.value.clear();
+		}
+	}
+#endif // _3D_DISABLED
+}
+
+void AnimationTree::_process_graph(double p_delta) {
+	if (!_process_graph_begin(p_delta)) {
+		return;
+	}
+	_process_animation_states(true, true);
+	_apply_track_caches();
+}
+
+void AnimationTree::_process_graph_deferred(double p_delta) {
+	if (!_process_graph_begin(p_delta)) {
+		return;
+	}
+	// Method, audio and discrete tracks run right away, sampling waits for flush_parallel_processing().
+	_process_animation_states(false, true);
+	if (!parallel_queued) {
+		parallel_queued = true;
+		parallel_queue.push_back(this);
+	}
+}
+
+bool AnimationTree::parallel_processing = false;
+LocalVector<AnimationTree *> AnimationTree::parallel_queue;
+
+void AnimationTree::_dequeue_parallel_processing() {
+	if (parallel_queued) {
+		parallel_queue.erase(this);
+		parallel_queued = false;
+	}
+}
+
+void AnimationTree::_sample_parallel_queue_task(void *p_userdata, uint32_t p_index) {
+	AnimationTree **trees = static_cast<AnimationTree **>(p_userdata);
+	trees[p_index]->_process_animation_states(true, false);
+}
+
+void AnimationTree::flush_parallel_processing() {
+	if (parallel_queue.is_empty()) {
+		return;
+	}
+
+	if (parallel_queue.size() == 1) {
+		parallel_queue[0]->_process_animation_states(true, false);
+	} else {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationTree::_sample_parallel_queue_task, parallel_queue.ptr(), parallel_queue.size(), -1, true, SNAME("Sample AnimationTrees"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	}
+
+	// Writing the results back goes through the scene, so it stays on the main thread.
+	// Setters may free other trees, so they are looked up again before being applied.
+	LocalVector<ObjectID> trees;
+	trees.resize(parallel_queue.size());
+	for (uint32_t i = 0; i < parallel_queue.size(); i++) {
+		parallel_queue[i]->parallel_queued = false;
+		trees[i] = parallel_queue[i]->get_instance_id();
+	}
+	parallel_queue.clear();
+
+	for (uint32_t i = 0; i < trees.size(); i++) {
+		AnimationTree *tree = Object::cast_to<AnimationTree>(ObjectDB::get_instance(trees[i]));
+		if (tree) {
+			tree->_apply_track_caches();
 		}
 	}
 }
@@ -1729,6 +1827,7 @@ void AnimationTree::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_EXIT_TREE: {
+			_dequeue_parallel_processing();
 			_clear_caches();
 			if (last_animation_player.is_valid()) {
 				Object *player = ObjectDB::get_instance(last_animation_player);
@@ -1740,13 +1839,21 @@ void AnimationTree::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && process_callback == ANIMATION_PROCESS_IDLE) {
-				_process_graph(get_process_delta_time());
+				if (parallel_processing) {
+					_process_graph_deferred(get_process_delta_time());
+				} else {
+					_process_graph(get_process_delta_time());
+				}
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && process_callback == ANIMATION_PROCESS_PHYSICS) {
-				_process_graph(get_physics_process_delta_time());
+				if (parallel_processing) {
+					_process_graph_deferred(get_physics_process_delta_time());
+				} else {
+					_process_graph(get_physics_process_delta_time());
+				}
 			}
 		} break;
 	}
@@ -1995,6 +2102,8 @@ real_t AnimationTree::get_connection_activity(const StringName &p_path, int p_co
 }
 
 void AnimationTree::_bind_methods() {
+	parallel_processing = GLOBAL_DEF_RST("animation/animation_tree/parallel_processing", false) && !Engine::get_singleton()->is_editor_hint();
+
 	ClassDB::bind_method(D_METHOD("set_active", "active"), &AnimationTree::set_active);
 	ClassDB::bind_method(D_METHOD("is_active"), &AnimationTree::is_active);
 
@@ -2043,4 +2152,5 @@ AnimationTree::AnimationTree() {
 }
 
 AnimationTree::~AnimationTree() {
+	_dequeue_parallel_processing();
 }
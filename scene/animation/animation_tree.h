@@ -270,6 +270,10 @@ private:
 
 	HashMap<NodePath, TrackCache *> track_cache;
 	HashSet<TrackCache *> playing_caches;
+	HashMap<ObjectID, LocalVector<Animation::TrackSampleCursor>> sample_cursors; // Per animation, one per track.
+#ifndef _3D_DISABLED
+	HashMap<Skeleton3D *, LocalVector<Skeleton3D::BonePoseUpdate>> bone_pose_updates; // Applied to each skeleton at once.
+#endif // _3D_DISABLED
 
 	Ref<AnimationNode> root;
 	NodePath advance_expression_base_node = NodePath(String("."));
@@ -287,6 +291,17 @@ private:
 	void _clear_caches();
 	bool _update_caches(AnimationPlayer *player);
 	void _process_graph(double p_delta);
+	bool _process_graph_begin(double p_delta);
+	void _process_animation_states(bool p_sample, bool p_side_effects);
+	void _apply_track_caches();
+
+	// Trees processed with parallel processing are sampled together on the WorkerThreadPool.
+	static bool parallel_processing;
+	static LocalVector<AnimationTree *> parallel_queue;
+	bool parallel_queued = false;
+	void _process_graph_deferred(double p_delta);
+	void _dequeue_parallel_processing();
+	static void _sample_parallel_queue_task(void *p_userdata, uint32_t p_index);
 
 	uint64_t setup_pass = 1;
 	uint64_t process_pass = 1;
@@ -362,6 +377,9 @@ public:
 	void rename_parameter(const String &p_base, const String &p_new_base);
 
 	uint64_t get_last_process_pass() const;
+
+	static void flush_parallel_processing();
+
 	AnimationTree();
 	~AnimationTree();
 };
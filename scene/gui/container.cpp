@@ -83,6 +83,9 @@ void Container::remove_child_notify(Node *p_child) {
 	queue_sort();
 }
 
+LocalVector<ObjectID> Container::sort_queue;
+bool Container::sort_queue_flush_pending = false;
+
 void Container::_sort_children() {
 	if (!is_inside_tree()) {
 		return;
@@ -140,10 +143,54 @@ void Container::queue_sort() {
 		return;
 	}
 
-	MessageQueue::get_singleton()->push_callable(callable_mp(this, &Container::_sort_children));
+	sort_queue.push_back(get_instance_id());
+	if (!sort_queue_flush_pending) {
+		MessageQueue::get_singleton()->push_callable(callable_mp_static(&Container::_flush_sort_queue));
+		sort_queue_flush_pending = true;
+	}
 	pending_sort = true;
 }
 
+void Container::_flush_sort_queue() {
+	struct SortEntry {
+		ObjectID id;
+		int depth = 0;
+
+		bool operator<(const SortEntry &p_other) const { return depth < p_other.depth; }
+	};
+
+	// Sorting a container resizes its children, which queues them again. Sorting parents first (and the
+	// containers queued meanwhile in the next round) makes each of them sort once, instead of once per ancestor.
+	LocalVector<SortEntry> entries;
+	while (sort_queue.size()) {
+		entries.clear();
+		for (uint32_t i = 0; i < sort_queue.size(); i++) {
+			Container *container = Object::cast_to<Container>(ObjectDB::get_instance(sort_queue[i]));
+			if (!container || !container->pending_sort) {
+				continue;
+			}
+
+			SortEntry entry;
+			entry.id = sort_queue[i];
+			for (Node *n = container->get_parent(); n; n = n->get_parent()) {
+				entry.depth++;
+			}
+			entries.push_back(entry);
+		}
+		sort_queue.clear();
+
+		entries.sort();
+		for (uint32_t i = 0; i < entries.size(); i++) {
+			// Sorting an earlier container may have freed this one.
+			Container *container = Object::cast_to<Container>(ObjectDB::get_instance(entries[i].id));
+			if (container && container->pending_sort) {
+				container->_sort_children();
+			}
+		}
+	}
+	sort_queue_flush_pending = false;
+}
+
 Vector<int> Container::get_allowed_size_flags_horizontal() const {
 	Vector<int> flags;
 	if (GDVIRTUAL_CALL(_get_allowed_size_flags_horizontal, flags)) {
@@ -31,6 +31,7 @@
 #ifndef CONTAINER_H
 #define CONTAINER_H
 
+#include "core/templates/local_vector.h"
 #include "scene/gui/control.h"
 
 class Container : public Control {
@@ -40,6 +41,11 @@ class Container : public Control {
 	void _sort_children();
 	void _child_minsize_changed();
 
+	// Containers waiting to be sorted, flushed together so that parents are sorted before their children.
+	static LocalVector<ObjectID> sort_queue;
+	static bool sort_queue_flush_pending;
+	static void _flush_sort_queue();
+
 protected:
 	void queue_sort();
 	virtual void add_child_notify(Node *p_child) override;
@@ -637,7 +637,7 @@ Rect2 Control::get_parent_anchorable_rect() const {
 #ifdef TOOLS_ENABLED
 		Node *edited_root = get_tree()->get_edited_scene_root();
 		if (edited_root && (this == edited_root || edited_root->is_ancestor_of(this))) {
-			parent_rect.size = Size2(GLOBAL_GET("display/window/size/viewport_width"), GLOBAL_GET("display/window/size/viewport_height"));
+			parent_rect.size = Size2(GLOBAL_GET_CACHED(int, "display/window/size/viewport_width"), GLOBAL_GET_CACHED(int, "display/window/size/viewport_height"));
 		} else {
 			parent_rect = get_viewport()->get_visible_rect();
 		}
@@ -2338,6 +2338,7 @@ void Control::set_theme(const Ref<Theme> &p_theme) {
 	}
 
 	data.theme = p_theme;
+	ThemeDB::get_singleton()->invalidate_theme_lookups();
 	if (data.theme.is_valid()) {
 		data.theme_owner->propagate_theme_changed(this, this, is_inside_tree(), true);
 		data.theme->connect("changed", callable_mp(this, &Control::_theme_changed), CONNECT_DEFERRED);
@@ -2387,14 +2388,14 @@ Ref<Texture2D> Control::get_theme_icon(const StringName &p_name, const StringNam
 		}
 	}
 
-	if (data.theme_icon_cache.has(p_theme_type) && data.theme_icon_cache[p_theme_type].has(p_name)) {
-		return data.theme_icon_cache[p_theme_type][p_name];
+	Theme::ThemeIconMap &type_cache = data.theme_icon_cache[p_theme_type];
+	const Ref<Texture2D> *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
-	List<StringName> theme_types;
-	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	Ref<Texture2D> icon = data.theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_ICON, p_name, theme_types);
-	data.theme_icon_cache[p_theme_type][p_name] = icon;
+	Ref<Texture2D> icon = data.theme_owner->get_theme_item(Theme::DATA_TYPE_ICON, p_name, this, p_theme_type);
+	type_cache[p_name] = icon;
 	return icon;
 }
 
@@ -2406,14 +2407,14 @@ Ref<StyleBox> Control::get_theme_stylebox(const StringName &p_name, const String
 		}
 	}
 
-	if (data.theme_style_cache.has(p_theme_type) && data.theme_style_cache[p_theme_type].has(p_name)) {
-		return data.theme_style_cache[p_theme_type][p_name];
+	Theme::ThemeStyleMap &type_cache = data.theme_style_cache[p_theme_type];
+	const Ref<StyleBox> *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
-	List<StringName> theme_types;
-	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	Ref<StyleBox> style = data.theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_STYLEBOX, p_name, theme_types);
-	data.theme_style_cache[p_theme_type][p_name] = style;
+	Ref<StyleBox> style = data.theme_owner->get_theme_item(Theme::DATA_TYPE_STYLEBOX, p_name, this, p_theme_type);
+	type_cache[p_name] = style;
 	return style;
 }
 
@@ -2425,14 +2426,14 @@ Ref<Font> Control::get_theme_font(const StringName &p_name, const StringName &p_
 		}
 	}
 
-	if (data.theme_font_cache.has(p_theme_type) && data.theme_font_cache[p_theme_type].has(p_name)) {
-		return data.theme_font_cache[p_theme_type][p_name];
+	Theme::ThemeFontMap &type_cache = data.theme_font_cache[p_theme_type];
+	const Ref<Font> *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
-	List<StringName> theme_types;
-	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	Ref<Font> font = data.theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_FONT, p_name, theme_types);
-	data.theme_font_cache[p_theme_type][p_name] = font;
+	Ref<Font> font = data.theme_owner->get_theme_item(Theme::DATA_TYPE_FONT, p_name, this, p_theme_type);
+	type_cache[p_name] = font;
 	return font;
 }
 
@@ -2444,14 +2445,14 @@ int Control::get_theme_font_size(const StringName &p_name, const StringName &p_t
 		}
 	}
 
-	if (data.theme_font_size_cache.has(p_theme_type) && data.theme_font_size_cache[p_theme_type].has(p_name)) {
-		return data.theme_font_size_cache[p_theme_type][p_name];
+	Theme::ThemeFontSizeMap &type_cache = data.theme_font_size_cache[p_theme_type];
+	const int *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
-	List<StringName> theme_types;
-	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	int font_size = data.theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_FONT_SIZE, p_name, theme_types);
-	data.theme_font_size_cache[p_theme_type][p_name] = font_size;
+	int font_size = data.theme_owner->get_theme_item(Theme::DATA_TYPE_FONT_SIZE, p_name, this, p_theme_type);
+	type_cache[p_name] = font_size;
 	return font_size;
 }
 
@@ -2463,14 +2464,14 @@ Color Control::get_theme_color(const StringName &p_name, const StringName &p_the
 		}
 	}
 
-	if (data.theme_color_cache.has(p_theme_type) && data.theme_color_cache[p_theme_type].has(p_name)) {
-		return data.theme_color_cache[p_theme_type][p_name];
+	Theme::ThemeColorMap &type_cache = data.theme_color_cache[p_theme_type];
+	const Color *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
-	List<StringName> theme_types;
-	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	Color color = data.theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_COLOR, p_name, theme_types);
-	data.theme_color_cache[p_theme_type][p_name] = color;
+	Color color = data.theme_owner->get_theme_item(Theme::DATA_TYPE_COLOR, p_name, this, p_theme_type);
+	type_cache[p_name] = color;
 	return color;
 }
 
@@ -2482,14 +2483,14 @@ int Control::get_theme_constant(const StringName &p_name, const StringName &p_th
 		}
 	}
 
-	if (data.theme_constant_cache.has(p_theme_type) && data.theme_constant_cache[p_theme_type].has(p_name)) {
-		return data.theme_constant_cache[p_theme_type][p_name];
+	Theme::ThemeConstantMap &type_cache = data.theme_constant_cache[p_theme_type];
+	const int *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
-	List<StringName> theme_types;
-	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	int constant = data.theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_CONSTANT, p_name, theme_types);
-	data.theme_constant_cache[p_theme_type][p_name] = constant;
+	int constant = data.theme_owner->get_theme_item(Theme::DATA_TYPE_CONSTANT, p_name, this, p_theme_type);
+	type_cache[p_name] = constant;
 	return constant;
 }
 
@@ -2500,9 +2501,7 @@ bool Control::has_theme_icon(const StringName &p_name, const StringName &p_theme
 		}
 	}
 
-	List<StringName> theme_types;
-	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	return data.theme_owner->has_theme_item_in_types(Theme::DATA_TYPE_ICON, p_name, theme_types);
+	return data.theme_owner->has_theme_item(Theme::DATA_TYPE_ICON, p_name, this, p_theme_type);
 }
 
 bool Control::has_theme_stylebox(const StringName &p_name, const StringName &p_theme_type) const {
@@ -2512,9 +2511,7 @@ bool Control::has_theme_stylebox(const StringName &p_name, const StringName &p_t
 		}
 	}
 
-	List<StringName> theme_types;
-	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	return data.theme_owner->has_theme_item_in_types(Theme::DATA_TYPE_STYLEBOX, p_name, theme_types);
+	return data.theme_owner->has_theme_item(Theme::DATA_TYPE_STYLEBOX, p_name, this, p_theme_type);
 }
 
 bool Control::has_theme_font(const StringName &p_name, const StringName &p_theme_type) const {
@@ -2524,9 +2521,7 @@ bool Control::has_theme_font(const StringName &p_name, const StringName &p_theme
 		}
 	}
 
-	List<StringName> theme_types;
-	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	return data.theme_owner->has_theme_item_in_types(Theme::DATA_TYPE_FONT, p_name, theme_types);
+	return data.theme_owner->has_theme_item(Theme::DATA_TYPE_FONT, p_name, this, p_theme_type);
 }
 
 bool Control::has_theme_font_size(const StringName &p_name, const StringName &p_theme_type) const {
@@ -2536,9 +2531,7 @@ bool Control::has_theme_font_size(const StringName &p_name, const StringName &p_
 		}
 	}
 
-	List<StringName> theme_types;
-	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	return data.theme_owner->has_theme_item_in_types(Theme::DATA_TYPE_FONT_SIZE, p_name, theme_types);
+	return data.theme_owner->has_theme_item(Theme::DATA_TYPE_FONT_SIZE, p_name, this, p_theme_type);
 }
 
 bool Control::has_theme_color(const StringName &p_name, const StringName &p_theme_type) const {
@@ -2548,9 +2541,7 @@ bool Control::has_theme_color(const StringName &p_name, const StringName &p_them
 		}
 	}
 
-	List<StringName> theme_types;
-	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	return data.theme_owner->has_theme_item_in_types(Theme::DATA_TYPE_COLOR, p_name, theme_types);
+	return data.theme_owner->has_theme_item(Theme::DATA_TYPE_COLOR, p_name, this, p_theme_type);
 }
 
 bool Control::has_theme_constant(const StringName &p_name, const StringName &p_theme_type) const {
@@ -2560,9 +2551,7 @@ bool Control::has_theme_constant(const StringName &p_name, const StringName &p_t
 		}
 	}
 
-	List<StringName> theme_types;
-	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	return data.theme_owner->has_theme_item_in_types(Theme::DATA_TYPE_CONSTANT, p_name, theme_types);
+	return data.theme_owner->has_theme_item(Theme::DATA_TYPE_CONSTANT, p_name, this, p_theme_type);
 }
 
 /// Local property overrides.
@@ -2756,7 +2745,7 @@ bool Control::is_layout_rtl() const {
 			} else if (parent_window) {
 				const_cast<Control *>(this)->data.is_rtl = parent_window->is_layout_rtl();
 			} else {
-				if (GLOBAL_GET(SNAME("internationalization/rendering/force_right_to_left_layout_direction"))) {
+				if (GLOBAL_GET_CACHED(bool, "internationalization/rendering/force_right_to_left_layout_direction")) {
 					const_cast<Control *>(this)->data.is_rtl = true;
 				} else {
 					String locale = TranslationServer::get_singleton()->get_tool_locale();
@@ -2764,7 +2753,7 @@ bool Control::is_layout_rtl() const {
 				}
 			}
 		} else if (data.layout_dir == LAYOUT_DIRECTION_LOCALE) {
-			if (GLOBAL_GET(SNAME("internationalization/rendering/force_right_to_left_layout_direction"))) {
+			if (GLOBAL_GET_CACHED(bool, "internationalization/rendering/force_right_to_left_layout_direction")) {
 				const_cast<Control *>(this)->data.is_rtl = true;
 			} else {
 				String locale = TranslationServer::get_singleton()->get_tool_locale();
@@ -2805,6 +2794,33 @@ bool Control::is_auto_translating() const {
 	return data.auto_translate;
 }
 
+String Control::atr(const String p_string) const {
+	if (!is_auto_translating() || !can_translate_messages() || !TranslationServer::get_singleton()) {
+		return p_string;
+	}
+
+	const uint64_t version = TranslationServer::get_singleton()->get_translation_version();
+	if (data.atr_cache_version != version) {
+		data.atr_cache.clear();
+		data.atr_cache_version = version;
+	} else {
+		HashMap<String, String>::ConstIterator E = data.atr_cache.find(p_string);
+		if (E) {
+			return E->value;
+		}
+	}
+
+	String xl_string = tr(p_string);
+
+	// Most controls only translate a few strings, keep text that changes every frame from piling up.
+	if (data.atr_cache.size() >= 8) {
+		data.atr_cache.clear();
+	}
+	data.atr_cache.insert(p_string, xl_string);
+
+	return xl_string;
+}
+
 // Extra properties.
 
 void Control::set_tooltip_text(const String &p_hint) {
@@ -251,6 +251,10 @@ private:
 		bool auto_translate = true;
 		bool localize_numeral_system = true;
 
+		// Recently translated strings, valid while the TranslationServer version matches.
+		mutable HashMap<String, String> atr_cache;
+		mutable uint64_t atr_cache_version = 0;
+
 		// Extra properties.
 
 		String tooltip;
@@ -601,9 +605,7 @@ public:
 
 	void set_auto_translate(bool p_enable);
 	bool is_auto_translating() const;
-	_FORCE_INLINE_ String atr(const String p_string) const {
-		return is_auto_translating() ? tr(p_string) : p_string;
-	};
+	String atr(const String p_string) const;
 
 	// Extra properties.
 
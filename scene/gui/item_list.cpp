@@ -733,7 +733,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 				uint64_t now = OS::get_singleton()->get_ticks_msec();
 				uint64_t diff = now - search_time_msec;
 
-				if (diff < uint64_t(GLOBAL_GET("gui/timers/incremental_search_max_interval_msec")) * 2) {
+				if (diff < GLOBAL_GET_CACHED(uint64_t, "gui/timers/incremental_search_max_interval_msec") * 2) {
 					for (int i = current - 1; i >= 0; i--) {
 						if (CAN_SELECT(i) && items[i].text.begins_with(search_string)) {
 							set_current(i);
@@ -771,7 +771,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 				uint64_t now = OS::get_singleton()->get_ticks_msec();
 				uint64_t diff = now - search_time_msec;
 
-				if (diff < uint64_t(GLOBAL_GET("gui/timers/incremental_search_max_interval_msec")) * 2) {
+				if (diff < GLOBAL_GET_CACHED(uint64_t, "gui/timers/incremental_search_max_interval_msec") * 2) {
 					for (int i = current + 1; i < items.size(); i++) {
 						if (CAN_SELECT(i) && items[i].text.begins_with(search_string)) {
 							set_current(i);
@@ -896,7 +896,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 			if (k.is_valid() && k->get_unicode()) {
 				uint64_t now = OS::get_singleton()->get_ticks_msec();
 				uint64_t diff = now - search_time_msec;
-				uint64_t max_interval = uint64_t(GLOBAL_GET("gui/timers/incremental_search_max_interval_msec"));
+				uint64_t max_interval = GLOBAL_GET_CACHED(uint64_t, "gui/timers/incremental_search_max_interval_msec");
 				search_time_msec = now;
 
 				if (diff > max_interval) {
@@ -995,7 +995,7 @@ void ItemList::_update_theme_item_cache() {
 void ItemList::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_RESIZED: {
-			shape_changed = true;
+			fit_changed = true;
 			queue_redraw();
 		} break;
 
@@ -1040,7 +1040,7 @@ void ItemList::_notification(int p_what) {
 			}
 
 			if (shape_changed) {
-				float max_column_width = 0.0;
+				max_column_width = 0.0;
 
 				//1- compute item minimum sizes
 				for (int i = 0; i < items.size(); i++) {
@@ -1096,7 +1096,14 @@ void ItemList::_notification(int p_what) {
 					items.write[i].rect_cache.size = minsize;
 					items.write[i].min_rect_cache.size = minsize;
 				}
+			} else if (fit_changed) {
+				// Reuse the minimum sizes, they don't depend on the control size.
+				for (int i = 0; i < items.size(); i++) {
+					items.write[i].rect_cache.size = items[i].min_rect_cache.size;
+				}
+			}
 
+			if (shape_changed || fit_changed) {
 				int fit_size = size.x - theme_cache.panel_style->get_minimum_size().width - mw;
 
 				//2-attempt best fit
@@ -1171,6 +1178,7 @@ void ItemList::_notification(int p_what) {
 
 				update_minimum_size();
 				shape_changed = false;
+				fit_changed = false;
 			}
 
 			if (scroll_bar->is_visible()) {
@@ -85,6 +85,8 @@ private:
 	int current = -1;
 
 	bool shape_changed = true;
+	bool fit_changed = true; // Only the columns need to be fit again, item minimum sizes are still valid.
+	float max_column_width = 0.0;
 
 	bool ensure_selected_visible = false;
 	bool same_column_width = false;
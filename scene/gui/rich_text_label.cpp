@@ -1365,7 +1365,7 @@ void RichTextLabel::_find_click(ItemFrame *p_frame, const Point2i &p_click, Item
 	int vofs = vscroll->get_value();
 
 	// Search for the first line.
-	int to_line = main->first_invalid_line.load();
+	int to_line = MIN(main->first_invalid_line.load(), main->first_resized_line.load());
 	int from_line = _find_first_line(0, to_line, vofs);
 
 	Point2 ofs = text_rect.get_position() + Vector2(0, main->lines[from_line].offset.y - vofs);
@@ -1732,7 +1732,16 @@ void RichTextLabel::_notification(int p_what) {
 
 		case NOTIFICATION_RESIZED: {
 			_stop_thread();
-			main->first_resized_line.store(0); //invalidate ALL
+			Rect2 text_rect = _get_text_rect();
+			if (text_rect.size.width != resized_text_width || ((vscroll->get_max() > get_size().height && scroll_active) != scroll_visible)) {
+				main->first_resized_line.store(0); //invalidate ALL
+			} else {
+				// Only the height changed, the lines keep their wrapping.
+				vscroll->set_page(text_rect.size.height);
+				if (scroll_follow && scroll_following) {
+					vscroll->set_value(vscroll->get_max());
+				}
+			}
 			queue_redraw();
 		} break;
 
@@ -1808,8 +1817,8 @@ void RichTextLabel::_notification(int p_what) {
 			Rect2 text_rect = _get_text_rect();
 			float vofs = vscroll->get_value();
 
-			// Search for the first line.
-			int to_line = main->first_invalid_line.load();
+			// Search for the first line, lines still being wrapped in the background are skipped.
+			int to_line = MIN(main->first_invalid_line.load(), main->first_resized_line.load());
 			int from_line = _find_first_line(0, to_line, vofs);
 
 			Point2 shadow_ofs(theme_cache.shadow_offset_x, theme_cache.shadow_offset_y);
@@ -2682,9 +2691,6 @@ bool RichTextLabel::_validate_line_caches() {
 	}
 	if (main->first_invalid_line.load() == (int)main->lines.size()) {
 		MutexLock data_lock(data_mutex);
-		Rect2 text_rect = _get_text_rect();
-
-		int ctrl_height = get_size().height;
 
 		// Update fonts.
 		float old_scroll = vscroll->get_value();
@@ -2692,7 +2698,7 @@ bool RichTextLabel::_validate_line_caches() {
 			for (int i = main->first_invalid_font_line.load(); i < (int)main->lines.size(); i++) {
 				_update_line_font(main, i, theme_cache.normal_font, theme_cache.normal_font_size);
 			}
-			main->first_resized_line.store(main->first_invalid_font_line.load());
+			main->first_resized_line.store(MIN(main->first_resized_line.load(), main->first_invalid_font_line.load()));
 			main->first_invalid_font_line.store(main->lines.size());
 		}
 
@@ -2701,54 +2707,17 @@ bool RichTextLabel::_validate_line_caches() {
 			return true;
 		}
 
-		// Resize lines without reshaping.
-		int fi = main->first_resized_line.load();
-
-		float total_height = (fi == 0) ? 0 : _calculate_line_vertical_offset(main->lines[fi - 1]);
-		for (int i = fi; i < (int)main->lines.size(); i++) {
-			total_height = _resize_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height);
-
-			updating_scroll = true;
-			bool exceeds = total_height > ctrl_height && scroll_active;
-			if (exceeds != scroll_visible) {
-				if (exceeds) {
-					scroll_visible = true;
-					scroll_w = vscroll->get_combined_minimum_size().width;
-					vscroll->show();
-					vscroll->set_anchor_and_offset(SIDE_LEFT, ANCHOR_END, -scroll_w);
-				} else {
-					scroll_visible = false;
-					scroll_w = 0;
-					vscroll->hide();
-				}
-
-				main->first_resized_line.store(0);
-
-				total_height = 0;
-				for (int j = 0; j <= i; j++) {
-					total_height = _resize_line(main, j, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height);
-
-					main->first_resized_line.store(j);
-				}
-			}
-
-			vscroll->set_max(total_height);
-			vscroll->set_page(text_rect.size.height);
-			if (scroll_follow && scroll_following) {
-				vscroll->set_value(total_height);
-			} else {
-				vscroll->set_value(old_scroll);
-			}
-			updating_scroll = false;
-
-			main->first_resized_line.store(i);
+		if (threaded) {
+			// Wrap lines to the new width in the background, same as shaping.
+			stop_thread.store(false);
+			updating.store(true);
+			loaded.store(double(main->first_resized_line.load()) / double(main->lines.size()));
+			thread.start(RichTextLabel::_thread_function, reinterpret_cast<void *>(this));
+			loading_started = OS::get_singleton()->get_ticks_msec();
+			return false;
 		}
 
-		main->first_resized_line.store(main->lines.size());
-
-		if (fit_content_height) {
-			update_minimum_size();
-		}
+		_process_line_resizes();
 		return true;
 	}
 	stop_thread.store(false);
@@ -2765,18 +2734,103 @@ bool RichTextLabel::_validate_line_caches() {
 	}
 }
 
+bool RichTextLabel::_process_line_resizes(int p_to_line) {
+	// Resize lines without reshaping.
+	MutexLock data_lock(data_mutex);
+	Rect2 text_rect = _get_text_rect();
+
+	int ctrl_height = get_size().height;
+	int to_line = (p_to_line < 0) ? (int)main->lines.size() : p_to_line;
+	float old_scroll = vscroll->get_value();
+
+	int fi = main->first_resized_line.load();
+	float total_height = (fi == 0) ? 0 : _calculate_line_vertical_offset(main->lines[fi - 1]);
+	for (int i = fi; i < to_line; i++) {
+		total_height = _resize_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height);
+
+		updating_scroll = true;
+		bool exceeds = total_height > ctrl_height && scroll_active;
+		if (exceeds != scroll_visible) {
+			if (exceeds) {
+				scroll_visible = true;
+				scroll_w = vscroll->get_combined_minimum_size().width;
+				vscroll->show();
+				vscroll->set_anchor_and_offset(SIDE_LEFT, ANCHOR_END, -scroll_w);
+			} else {
+				scroll_visible = false;
+				scroll_w = 0;
+				vscroll->hide();
+			}
+
+			main->first_resized_line.store(0);
+
+			total_height = 0;
+			for (int j = 0; j <= i; j++) {
+				total_height = _resize_line(main, j, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height);
+
+				main->first_resized_line.store(j);
+			}
+		}
+
+		vscroll->set_max(total_height);
+		vscroll->set_page(text_rect.size.height);
+		if (scroll_follow && scroll_following) {
+			vscroll->set_value(total_height);
+		} else {
+			vscroll->set_value(old_scroll);
+		}
+		updating_scroll = false;
+
+		main->first_resized_line.store(i);
+
+		if (stop_thread.load()) {
+			return false;
+		}
+		loaded.store(double(i) / double(main->lines.size()));
+	}
+
+	main->first_resized_line.store(to_line);
+	resized_text_width = text_rect.size.width;
+
+	if (to_line == (int)main->lines.size() && fit_content_height) {
+		update_minimum_size();
+	}
+	return true;
+}
+
 void RichTextLabel::_process_line_caches() {
 	// Shape invalid lines.
 	if (!is_inside_tree()) {
 		return;
 	}
 
+	if (main->first_invalid_line.load() == (int)main->lines.size()) {
+		// Only the line widths are outdated.
+		_process_line_resizes();
+		return;
+	}
+
 	MutexLock data_lock(data_mutex);
+
+	// Lines before the first invalid one are kept, but may still need new fonts or widths.
+	int fi = main->first_invalid_line.load();
+	if (main->first_invalid_font_line.load() < fi) {
+		for (int i = main->first_invalid_font_line.load(); i < fi; i++) {
+			_update_line_font(main, i, theme_cache.normal_font, theme_cache.normal_font_size);
+		}
+		main->first_resized_line.store(MIN(main->first_resized_line.load(), main->first_invalid_font_line.load()));
+		main->first_invalid_font_line.store(fi);
+	}
+	if (main->first_resized_line.load() < fi) {
+		if (!_process_line_resizes(fi)) {
+			return;
+		}
+	}
+
 	Rect2 text_rect = _get_text_rect();
 
 	int ctrl_height = get_size().height;
-	int fi = main->first_invalid_line.load();
-	int total_chars = (fi == 0) ? 0 : (main->lines[fi].char_offset + main->lines[fi].char_count);
+	int total_chars = (fi == 0) ? 0 : (main->lines[fi - 1].char_offset + main->lines[fi - 1].char_count);
 
 	float total_height = (fi == 0) ? 0 : _calculate_line_vertical_offset(main->lines[fi - 1]);
 	for (int i = fi; i < (int)main->lines.size(); i++) {
@@ -2829,6 +2883,7 @@ void RichTextLabel::_process_line_caches() {
 	main->first_invalid_line.store(main->lines.size());
 	main->first_resized_line.store(main->lines.size());
 	main->first_invalid_font_line.store(main->lines.size());
+	resized_text_width = text_rect.size.width;
 
 	if (fit_content_height) {
 		update_minimum_size();
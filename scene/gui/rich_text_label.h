@@ -386,6 +386,7 @@ private:
 	bool scroll_following = false;
 	bool scroll_active = true;
 	int scroll_w = 0;
+	float resized_text_width = -1.0; // Text width the lines were last wrapped to.
 	bool scroll_updated = false;
 	bool updating_scroll = false;
 	int current_idx = 1;
@@ -410,6 +411,7 @@ private:
 	static void _thread_function(void *self);
 	void _stop_thread();
 	bool _validate_line_caches();
+	bool _process_line_resizes(int p_to_line = -1);
 	void _process_line_caches();
 
 	void _add_item(Item *p_item, bool p_enter = false, bool p_ensure_newline = false);
@@ -92,12 +92,54 @@ void TextEdit::Text::set_draw_control_chars(bool p_enabled) {
 	is_dirty = true;
 }
 
+void TextEdit::Text::set_lazy_shaping(bool p_enabled) {
+	if (lazy_shaping == p_enabled) {
+		return;
+	}
+	lazy_shaping = p_enabled;
+	is_dirty = true;
+}
+
+const Ref<TextParagraph> &TextEdit::Text::_get_line_buf(int p_line) const {
+	if (text[p_line].data_buf.is_null()) {
+		// Not shaped yet (or freed since), shape it on first use.
+		shaping_tick++;
+		text.write[p_line].data_buf.instantiate();
+		shaped_lines++;
+		const_cast<Text *>(this)->invalidate_cache(p_line, -1, true);
+		if (_is_lazy() && shaped_lines > max_shaped_lines) {
+			text.write[p_line].last_used = shaping_tick;
+			_free_unused_line_bufs();
+		}
+	}
+	if (lazy_shaping) {
+		text.write[p_line].last_used = shaping_tick;
+	}
+	return text[p_line].data_buf;
+}
+
+void TextEdit::Text::_free_unused_line_bufs() const {
+	// Keep the lines used during the last shaping passes, the others are shaped again when needed.
+	uint64_t threshold = shaping_tick - MIN(shaping_tick, uint64_t(max_shaped_lines / 2));
+	shaped_lines = 0;
+	for (int i = 0; i < text.size(); i++) {
+		if (text[i].data_buf.is_null()) {
+			continue;
+		}
+		if (text[i].last_used < threshold) {
+			text.write[i].data_buf.unref();
+		} else {
+			shaped_lines++;
+		}
+	}
+}
+
 int TextEdit::Text::get_line_width(int p_line, int p_wrap_index) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
 	if (p_wrap_index != -1) {
-		return text[p_line].data_buf->get_line_width(p_wrap_index);
+		return _get_line_buf(p_line)->get_line_width(p_wrap_index);
 	}
-	return text[p_line].data_buf->get_size().x;
+	return _get_line_buf(p_line)->get_size().x;
 }
 
 int TextEdit::Text::get_line_height() const {
@@ -115,22 +157,26 @@ float TextEdit::Text::get_width() const {
 int TextEdit::Text::get_line_wrap_amount(int p_line) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
 
-	return text[p_line].data_buf->get_line_count() - 1;
+	if (_is_lazy() && text[p_line].data_buf.is_null()) {
+		return 0; // Lines are only lazily shaped without wrapping, no need to shape it.
+	}
+	return _get_line_buf(p_line)->get_line_count() - 1;
 }
 
 Vector<Vector2i> TextEdit::Text::get_line_wrap_ranges(int p_line) const {
 	Vector<Vector2i> ret;
 	ERR_FAIL_INDEX_V(p_line, text.size(), ret);
 
-	for (int i = 0; i < text[p_line].data_buf->get_line_count(); i++) {
-		ret.push_back(text[p_line].data_buf->get_line_range(i));
+	const Ref<TextParagraph> &data_buf = _get_line_buf(p_line);
+	for (int i = 0; i < data_buf->get_line_count(); i++) {
+		ret.push_back(data_buf->get_line_range(i));
 	}
 	return ret;
 }
 
 const Ref<TextParagraph> TextEdit::Text::get_line_data(int p_line) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), Ref<TextParagraph>());
-	return text[p_line].data_buf;
+	return _get_line_buf(p_line);
 }
 
 _FORCE_INLINE_ const String &TextEdit::Text::operator[](int p_line) const {
@@ -174,6 +220,22 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_chan
 		return; // Not in tree?
 	}
 
+	if (text[p_line].data_buf.is_null()) {
+		if (_is_lazy() && p_ime_text.is_empty()) {
+			// Shaped on first use, assume a single line of the font height until then.
+			text.write[p_line].height = font_height;
+			line_height = MAX(font_height, line_height);
+			max_width = MAX(max_width, 0);
+			return;
+		}
+		text.write[p_line].data_buf.instantiate();
+		shaped_lines++;
+		p_text_changed = true;
+	}
+	if (lazy_shaping) {
+		text.write[p_line].last_used = shaping_tick;
+	}
+
 	if (p_text_changed) {
 		text.write[p_line].data_buf->clear();
 	}
@@ -246,6 +308,12 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_chan
 
 void TextEdit::Text::invalidate_all_lines() {
 	for (int i = 0; i < text.size(); i++) {
+		if (text[i].data_buf.is_null()) {
+			if (!_is_lazy()) {
+				invalidate_cache(i, -1, true); // Wrapping needs every line shaped.
+			}
+			continue;
+		}
 		text.write[i].data_buf->set_width(width);
 		if (tab_size_dirty) {
 			if (tab_size > 0) {
@@ -276,9 +344,19 @@ void TextEdit::Text::invalidate_font() {
 		font_height = font->get_height(font_size);
 	}
 
+	bool lazy = _is_lazy();
 	for (int i = 0; i < text.size(); i++) {
+		if (lazy) {
+			// Drop the shaped lines, the ones in use are shaped again with the new settings.
+			text.write[i].data_buf.unref();
+			text.write[i].width = 0;
+		}
 		invalidate_cache(i, -1, false);
 	}
+	if (lazy) {
+		shaped_lines = 0;
+		max_width = MAX(max_width, 0);
+	}
 	is_dirty = false;
 }
 
@@ -294,9 +372,19 @@ void TextEdit::Text::invalidate_all() {
 		font_height = font->get_height(font_size);
 	}
 
+	bool lazy = _is_lazy();
 	for (int i = 0; i < text.size(); i++) {
+		if (lazy) {
+			// Drop the shaped lines, the ones in use are shaped again with the new settings.
+			text.write[i].data_buf.unref();
+			text.write[i].width = 0;
+		}
 		invalidate_cache(i, -1, true);
 	}
+	if (lazy) {
+		shaped_lines = 0;
+		max_width = MAX(max_width, 0);
+	}
 	is_dirty = false;
 }
 
@@ -509,6 +597,7 @@ void TextEdit::_notification(int p_what) {
 			}
 
 			_update_scrollbars();
+			const int drawn_max_width = text.get_max_width();
 
 			RID ci = get_canvas_item();
 			RenderingServer::get_singleton()->canvas_item_set_clip(get_canvas_item(), true);
@@ -1467,6 +1556,11 @@ void TextEdit::_notification(int p_what) {
 				}
 			}
 
+			if (text.get_max_width() != drawn_max_width) {
+				// Lazily shaped lines changed the scrollable width, update the scrollbars.
+				call_deferred(SNAME("queue_redraw"));
+			}
+
 			if (has_focus()) {
 				if (get_viewport()->get_window_id() != DisplayServer::INVALID_WINDOW_ID && DisplayServer::get_singleton()->has_feature(DisplayServer::FEATURE_IME)) {
 					DisplayServer::get_singleton()->window_set_ime_active(true, get_viewport()->get_window_id());
@@ -5926,6 +6020,19 @@ bool TextEdit::get_draw_control_chars() const {
 	return draw_control_chars;
 }
 
+void TextEdit::set_lazy_shaping_enabled(bool p_enabled) {
+	if (text.is_lazy_shaping() != p_enabled) {
+		text.set_lazy_shaping(p_enabled);
+		text.invalidate_all();
+		_update_scrollbars();
+		queue_redraw();
+	}
+}
+
+bool TextEdit::is_lazy_shaping_enabled() const {
+	return text.is_lazy_shaping();
+}
+
 void TextEdit::set_draw_tabs(bool p_enabled) {
 	if (draw_tabs == p_enabled) {
 		return;
@@ -6330,6 +6437,9 @@ void TextEdit::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_draw_control_chars"), &TextEdit::get_draw_control_chars);
 	ClassDB::bind_method(D_METHOD("set_draw_control_chars", "enabled"), &TextEdit::set_draw_control_chars);
 
+	ClassDB::bind_method(D_METHOD("set_lazy_shaping_enabled", "enabled"), &TextEdit::set_lazy_shaping_enabled);
+	ClassDB::bind_method(D_METHOD("is_lazy_shaping_enabled"), &TextEdit::is_lazy_shaping_enabled);
+
 	ClassDB::bind_method(D_METHOD("set_draw_tabs", "enabled"), &TextEdit::set_draw_tabs);
 	ClassDB::bind_method(D_METHOD("is_drawing_tabs"), &TextEdit::is_drawing_tabs);
 
@@ -6353,6 +6463,7 @@ void TextEdit::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "virtual_keyboard_enabled"), "set_virtual_keyboard_enabled", "is_virtual_keyboard_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "middle_mouse_paste_enabled"), "set_middle_mouse_paste_enabled", "is_middle_mouse_paste_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "wrap_mode", PROPERTY_HINT_ENUM, "None,Boundary"), "set_line_wrapping_mode", "get_line_wrapping_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lazy_shaping"), "set_lazy_shaping_enabled", "is_lazy_shaping_enabled");
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "highlight_all_occurrences"), "set_highlight_all_occurrences", "is_highlight_all_occurrences_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "highlight_current_line"), "set_highlight_current_line", "is_highlight_current_line_enabled");
@@ -154,9 +154,7 @@ private:
 			int height = 0;
 			int width = 0;
 
-			Line() {
-				data_buf.instantiate();
-			}
+			uint64_t last_used = 0; // With lazy shaping, the shaping tick the buffer was last accessed on.
 		};
 
 	private:
@@ -179,9 +177,18 @@ private:
 		int tab_size = 4;
 		int gutter_count = 0;
 
+		bool lazy_shaping = false;
+		int max_shaped_lines = 4096;
+		mutable int shaped_lines = 0;
+		mutable uint64_t shaping_tick = 0;
+
 		void _calculate_line_height();
 		void _calculate_max_line_width();
 
+		_FORCE_INLINE_ bool _is_lazy() const { return lazy_shaping && width < 0; }
+		const Ref<TextParagraph> &_get_line_buf(int p_line) const;
+		void _free_unused_line_bufs() const;
+
 	public:
 		void set_tab_size(int p_tab_size);
 		int get_tab_size() const;
@@ -189,6 +196,8 @@ private:
 		void set_font_size(int p_font_size);
 		void set_direction_and_language(TextServer::Direction p_direction, const String &p_language);
 		void set_draw_control_chars(bool p_enabled);
+		void set_lazy_shaping(bool p_enabled);
+		bool is_lazy_shaping() const { return lazy_shaping; }
 
 		int get_line_height() const;
 		int get_line_width(int p_line, int p_wrap_index = -1) const;
@@ -998,6 +1007,9 @@ public:
 	void set_draw_control_chars(bool p_enabled);
 	bool get_draw_control_chars() const;
 
+	void set_lazy_shaping_enabled(bool p_enabled);
+	bool is_lazy_shaping_enabled() const;
+
 	void set_draw_tabs(bool p_enabled);
 	bool is_drawing_tabs() const;
 
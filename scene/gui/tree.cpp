@@ -67,6 +67,17 @@ void TreeItem::Cell::draw_icon(const RID &p_where, const Point2 &p_pos, const Si
 	}
 }
 
+void TreeItem::_layout_changed() {
+	cached_height = -1;
+	// Descendants of an item whose height is already invalid never have a valid one.
+	for (TreeItem *p = this; p && p->cached_subtree_height >= 0; p = p->parent) {
+		p->cached_subtree_height = -1;
+	}
+	if (tree) {
+		tree->column_minimum_widths_dirty = true;
+	}
+}
+
 void TreeItem::_changed_notify(int p_cell) {
 	tree->item_changed(p_cell, this);
 }
@@ -88,6 +99,9 @@ void TreeItem::_change_tree(Tree *p_tree) {
 		return;
 	}
 
+	cached_height = -1;
+	cached_subtree_height = -1;
+
 	TreeItem *c = first_child;
 	while (c) {
 		c->_change_tree(p_tree);
@@ -696,6 +710,7 @@ TreeItem *TreeItem::create_child(int p_idx) {
 	}
 
 	ti->parent = this;
+	_layout_changed();
 
 	return ti;
 }
@@ -929,6 +944,7 @@ void TreeItem::move_before(TreeItem *p_item) {
 	prev = item_prev;
 	next = p_item;
 	p_item->prev = this;
+	parent->_layout_changed();
 
 	if (tree && old_tree == tree) {
 		tree->queue_redraw();
@@ -973,6 +989,7 @@ void TreeItem::move_after(TreeItem *p_item) {
 			parent->children_cache.append(this);
 		}
 	}
+	parent->_layout_changed();
 
 	if (tree && old_tree == tree) {
 		tree->queue_redraw();
@@ -1654,7 +1671,7 @@ void Tree::_update_theme_item_cache() {
 	theme_cache.base_scale = get_theme_default_base_scale();
 }
 
-int Tree::compute_item_height(TreeItem *p_item) const {
+int Tree::_compute_item_height(TreeItem *p_item) const {
 	if ((p_item == root && hide_root) || !p_item->is_visible()) {
 		return 0;
 	}
@@ -1715,25 +1732,89 @@ int Tree::compute_item_height(TreeItem *p_item) const {
 	return height;
 }
 
+int Tree::compute_item_height(TreeItem *p_item) const {
+	if (p_item->layout_cache_version != layout_cache_version) {
+		p_item->layout_cache_version = layout_cache_version;
+		p_item->cached_height = -1;
+		p_item->cached_subtree_height = -1;
+	}
+
+	if (p_item->cached_height >= 0) {
+		// Cells can be marked dirty without notifying the tree, e.g. by the editor.
+		for (int i = 0; i < p_item->cells.size(); i++) {
+			if (p_item->cells[i].dirty) {
+				p_item->_layout_changed();
+				break;
+			}
+		}
+	}
+
+	if (p_item->cached_height < 0) {
+		p_item->cached_height = _compute_item_height(p_item);
+	}
+	return p_item->cached_height;
+}
+
 int Tree::get_item_height(TreeItem *p_item) const {
 	if (!p_item->is_visible()) {
 		return 0;
 	}
+
 	int height = compute_item_height(p_item);
+	if (p_item->cached_subtree_height >= 0) {
+		return p_item->cached_subtree_height;
+	}
+
 	height += theme_cache.v_separation;
 
+	p_item->children_offsets.clear();
 	if (!p_item->collapsed) { /* if not collapsed, check the children */
+		p_item->_create_children_cache();
 
-		TreeItem *c = p_item->first_child;
+		int children_height = 0;
+		for (int i = 0; i < p_item->children_cache.size(); i++) {
+			p_item->children_offsets.push_back(children_height);
+			children_height += get_item_height(p_item->children_cache[i]);
+		}
+		p_item->children_offsets.push_back(children_height);
 
-		while (c) {
-			height += get_item_height(c);
+		height += children_height;
+	}
 
-			c = c->next;
+	p_item->cached_subtree_height = height;
+	return height;
+}
+
+TreeItem *Tree::_find_first_child_below(TreeItem *p_item, int p_y, int &r_offset) const {
+	r_offset = 0;
+	if (p_y <= 0 || !p_item->first_child) {
+		return p_item->first_child;
+	}
+
+	get_item_height(p_item);
+	const LocalVector<int> &offsets = p_item->children_offsets;
+	if (p_item->cached_subtree_height < 0 || offsets.size() != uint32_t(p_item->children_cache.size() + 1)) {
+		return p_item->first_child;
+	}
+
+	// Binary search for the first child whose subtree ends below p_y.
+	int low = 0;
+	int high = p_item->children_cache.size();
+	while (low < high) {
+		int mid = (low + high) / 2;
+		if (offsets[mid + 1] <= p_y) {
+			low = mid + 1;
+		} else {
+			high = mid;
 		}
 	}
 
-	return height;
+	if (low >= p_item->children_cache.size()) {
+		r_offset = offsets[offsets.size() - 1];
+		return nullptr;
+	}
+	r_offset = offsets[low];
+	return p_item->children_cache[low];
 }
 
 void Tree::draw_item_rect(TreeItem::Cell &p_cell, const Rect2i &p_rect, const Color &p_color, const Color &p_icon_color, int p_ol_size, const Color &p_ol_color) {
@@ -2320,10 +2401,23 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
 		int prev_ofs = base_ofs;
 		int prev_hl_ofs = base_ofs;
 
+		if (theme_cache.draw_relationship_lines == 0 && htotal >= 0) {
+			// Jump over the children above the visible area, they don't draw anything.
+			int skipped_h = 0;
+			c = _find_first_child_below(p_item, theme_cache.offset.y - children_pos.y, skipped_h);
+			htotal += skipped_h;
+			children_pos.y += skipped_h;
+		}
+
 		while (c) {
 			int child_h = -1;
 			if (htotal >= 0) {
-				child_h = draw_item(children_pos, p_draw_ofs, p_draw_size, c);
+				int subtree_h = get_item_height(c);
+				if (children_pos.y + subtree_h - theme_cache.offset.y <= 0) {
+					child_h = subtree_h; // Entirely above the visible area.
+				} else {
+					child_h = draw_item(children_pos, p_draw_ofs, p_draw_size, c);
+				}
 			}
 
 			// Draw relationship lines.
@@ -2938,7 +3032,11 @@ int Tree::propagate_mouse_event(const Point2i &p_pos, int x_ofs, int y_ofs, int
 
 		if (!p_item->collapsed) { /* if not collapsed, check the children */
 
-			TreeItem *c = p_item->first_child;
+			int skipped_h = 0;
+			TreeItem *c = _find_first_child_below(p_item, new_pos.y, skipped_h);
+			new_pos.y -= skipped_h;
+			y_ofs += skipped_h;
+			item_h += skipped_h;
 
 			while (c) {
 				int child_h = propagate_mouse_event(new_pos, x_ofs, y_ofs, x_limit, p_double_click, c, p_button, p_mod);
@@ -4086,7 +4184,13 @@ void Tree::_notification(int p_what) {
 	}
 }
 
+void Tree::_invalidate_layout_cache() {
+	layout_cache_version++;
+	column_minimum_widths_dirty = true;
+}
+
 void Tree::_update_all() {
+	_invalidate_layout_cache();
 	for (int i = 0; i < columns.size(); i++) {
 		update_column(i);
 	}
@@ -4125,6 +4229,7 @@ TreeItem *Tree::create_item(TreeItem *p_parent, int p_idx) {
 			ti->cells.resize(columns.size());
 			ti->is_root = true;
 			root = ti;
+			_invalidate_layout_cache();
 		} else {
 			// Root exists, append or insert to root.
 			ti = create_item(root, p_idx);
@@ -4159,6 +4264,7 @@ void Tree::item_edited(int p_column, TreeItem *p_item, MouseButton p_custom_mous
 	edited_col = p_column;
 	if (p_item != nullptr && p_column >= 0 && p_column < p_item->cells.size()) {
 		edited_item->cells.write[p_column].dirty = true;
+		edited_item->_layout_changed();
 	}
 	emit_signal(SNAME("item_edited"));
 	if (p_custom_mouse_index != MouseButton::NONE) {
@@ -4170,6 +4276,9 @@ void Tree::item_changed(int p_column, TreeItem *p_item) {
 	if (p_item != nullptr && p_column >= 0 && p_column < p_item->cells.size()) {
 		p_item->cells.write[p_column].dirty = true;
 	}
+	if (p_item != nullptr) {
+		p_item->_layout_changed();
+	}
 	queue_redraw();
 }
 
@@ -4256,6 +4365,7 @@ void Tree::clear() {
 	popup_edited_item = nullptr;
 	popup_pressing_edited_item = nullptr;
 
+	_invalidate_layout_cache();
 	queue_redraw();
 };
 
@@ -4265,6 +4375,7 @@ void Tree::set_hide_root(bool p_enabled) {
 	}
 
 	hide_root = p_enabled;
+	_invalidate_layout_cache();
 	queue_redraw();
 }
 
@@ -4283,6 +4394,7 @@ void Tree::set_column_custom_minimum_width(int p_column, int p_min_width) {
 		return;
 	}
 	columns.write[p_column].custom_min_width = p_min_width;
+	column_minimum_widths_dirty = true;
 	queue_redraw();
 }
 
@@ -4316,6 +4428,7 @@ void Tree::set_column_clip_content(int p_column, bool p_fit) {
 	}
 
 	columns.write[p_column].clip_content = p_fit;
+	column_minimum_widths_dirty = true;
 	queue_redraw();
 }
 
@@ -4397,6 +4510,18 @@ TreeItem *Tree::get_next_selected(TreeItem *p_item) {
 int Tree::get_column_minimum_width(int p_column) const {
 	ERR_FAIL_INDEX_V(p_column, columns.size(), -1);
 
+	if (column_minimum_widths_dirty || column_minimum_widths.size() != uint32_t(columns.size())) {
+		column_minimum_widths.resize(columns.size());
+		for (int i = 0; i < columns.size(); i++) {
+			column_minimum_widths[i] = _compute_column_minimum_width(i);
+		}
+		column_minimum_widths_dirty = false;
+	}
+
+	return column_minimum_widths[p_column];
+}
+
+int Tree::_compute_column_minimum_width(int p_column) const {
 	// Use the custom minimum width.
 	int min_width = columns[p_column].custom_min_width;
 
@@ -4495,6 +4620,7 @@ void Tree::set_columns(int p_columns) {
 	if (selected_col >= p_columns) {
 		selected_col = p_columns - 1;
 	}
+	_invalidate_layout_cache();
 	queue_redraw();
 }
 
@@ -4652,6 +4778,7 @@ void Tree::set_column_titles_visible(bool p_show) {
 	}
 
 	show_column_titles = p_show;
+	_invalidate_layout_cache();
 	queue_redraw();
 }
 
@@ -4668,6 +4795,7 @@ void Tree::set_column_title(int p_column, const String &p_title) {
 
 	columns.write[p_column].title = p_title;
 	update_column(p_column);
+	column_minimum_widths_dirty = true;
 	queue_redraw();
 }
 
@@ -4893,7 +5021,10 @@ TreeItem *Tree::_find_item_at_pos(TreeItem *p_item, const Point2 &p_pos, int &r_
 		return nullptr; // do not try children, it's collapsed
 	}
 
-	TreeItem *n = p_item->get_first_child();
+	int skipped_h = 0;
+	TreeItem *n = _find_first_child_below(p_item, pos.y, skipped_h);
+	pos.y -= skipped_h;
+	h += skipped_h;
 	while (n) {
 		int ch;
 		TreeItem *r = _find_item_at_pos(n, pos, r_column, ch, section);
@@ -5100,6 +5231,7 @@ void Tree::set_hide_folding(bool p_hide) {
 	}
 
 	hide_folding = p_hide;
+	_invalidate_layout_cache();
 	queue_redraw();
 }
 
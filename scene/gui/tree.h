@@ -31,6 +31,7 @@
 #ifndef TREE_H
 #define TREE_H
 
+#include "core/templates/local_vector.h"
 #include "scene/gui/control.h"
 #include "scene/gui/line_edit.h"
 #include "scene/gui/popup_menu.h"
@@ -136,8 +137,15 @@ private:
 	bool is_root = false; // for tree root
 	Tree *tree = nullptr; // tree (for reference)
 
+	// Cached layout, valid while layout_cache_version matches the one of the tree (see Tree::get_item_height()).
+	int cached_height = -1; // Height of this item alone, -1 if it must be computed again.
+	int cached_subtree_height = -1; // Height of this item and its visible descendants, -1 if it must be computed again.
+	uint64_t layout_cache_version = 0;
+	LocalVector<int> children_offsets; // Offset of each child in children_cache from the first one, plus the total height of the children.
+
 	TreeItem(Tree *p_tree);
 
+	void _layout_changed();
 	void _changed_notify(int p_cell);
 	void _changed_notify();
 	void _cell_selected(int p_cell);
@@ -156,6 +164,9 @@ private:
 	}
 
 	_FORCE_INLINE_ void _unlink_from_tree() {
+		if (parent) {
+			parent->_layout_changed();
+		}
 		TreeItem *p = get_prev();
 		if (p) {
 			p->next = next;
@@ -461,6 +472,16 @@ private:
 	bool range_up_last = false;
 	void _range_click_timeout();
 
+	// Item heights and column widths are cached, so drawing and input only visit the visible items.
+	// Bumping the version invalidates the heights of all the items.
+	uint64_t layout_cache_version = 1;
+	mutable bool column_minimum_widths_dirty = true;
+	mutable LocalVector<int> column_minimum_widths;
+	void _invalidate_layout_cache();
+
+	int _compute_item_height(TreeItem *p_item) const;
+	int _compute_column_minimum_width(int p_column) const;
+	TreeItem *_find_first_child_below(TreeItem *p_item, int p_y, int &r_offset) const;
 	int compute_item_height(TreeItem *p_item) const;
 	int get_item_height(TreeItem *p_item) const;
 	void _update_all();
@@ -30,12 +30,151 @@
 
 #include "http_request.h"
 #include "core/io/compression.h"
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/timer.h"
 
+Mutex HTTPRequest::pool_mutex;
+HashMap<String, List<HTTPRequest::PooledConnection>> HTTPRequest::connection_pool;
+
+void HTTPRequest::_pool_prune(uint64_t p_now) {
+	// Must be called with pool_mutex locked.
+	LocalVector<String> empty_keys;
+	for (KeyValue<String, List<PooledConnection>> &E : connection_pool) {
+		// Connections are appended when released, so the oldest ones are at the front.
+		while (!E.value.is_empty() && p_now - E.value.front()->get().idle_since > POOL_IDLE_TIMEOUT_MSEC) {
+			E.value.front()->get().client->close();
+			E.value.pop_front();
+		}
+		if (E.value.is_empty()) {
+			empty_keys.push_back(E.key);
+		}
+	}
+	for (uint32_t i = 0; i < empty_keys.size(); i++) {
+		connection_pool.erase(empty_keys[i]);
+	}
+}
+
+Ref<HTTPClient> HTTPRequest::_pool_acquire(const String &p_key) {
+	MutexLock lock(pool_mutex);
+	_pool_prune(OS::get_singleton()->get_ticks_msec());
+
+	List<PooledConnection> *idle = connection_pool.getptr(p_key);
+	if (!idle) {
+		return Ref<HTTPClient>();
+	}
+
+	Ref<HTTPClient> pooled;
+	while (!idle->is_empty()) {
+		// The most recently released connection is the least likely to have been closed by the server.
+		Ref<HTTPClient> candidate = idle->back()->get().client;
+		idle->pop_back();
+		candidate->poll();
+		if (candidate->get_status() == HTTPClient::STATUS_CONNECTED) {
+			pooled = candidate;
+			break;
+		}
+		candidate->close();
+	}
+	if (idle->is_empty()) {
+		connection_pool.erase(p_key);
+	}
+	return pooled;
+}
+
+void HTTPRequest::_pool_release(const String &p_key, const Ref<HTTPClient> &p_client) {
+	MutexLock lock(pool_mutex);
+	uint64_t now = OS::get_singleton()->get_ticks_msec();
+	_pool_prune(now);
+
+	List<PooledConnection> &idle = connection_pool[p_key];
+	if (idle.size() >= POOL_MAX_IDLE_PER_HOST) {
+		idle.front()->get().client->close();
+		idle.pop_front();
+	}
+
+	PooledConnection conn;
+	conn.client = p_client;
+	conn.idle_since = now;
+	idle.push_back(conn);
+}
+
+void HTTPRequest::clear_connection_pool() {
+	MutexLock lock(pool_mutex);
+	for (KeyValue<String, List<PooledConnection>> &E : connection_pool) {
+		for (PooledConnection &conn : E.value) {
+			conn.client->close();
+		}
+	}
+	connection_pool.clear();
+}
+
+String HTTPRequest::_get_pool_key() const {
+	String key = url + ":" + itos(port);
+	if (use_tls) {
+		key += validate_tls ? ":tls" : ":tls-unverified";
+	}
+	return key;
+}
+
 Error HTTPRequest::_request() {
+	reused_connection = false;
+	if (use_connection_pool && !has_http_proxy && !has_https_proxy) {
+		Ref<HTTPClient> pooled = _pool_acquire(_get_pool_key());
+		if (pooled.is_valid()) {
+			client = pooled;
+			client->set_blocking_mode(use_threads.is_set());
+			client->set_read_chunk_size(download_chunk_size);
+			reused_connection = true;
+			return OK;
+		}
+	}
 	return client->connect_to_host(url, port, use_tls, validate_tls);
 }
 
+bool HTTPRequest::_can_retry_connection() const {
+	if (!reused_connection || got_response) {
+		return false;
+	}
+	// Only retry requests that are safe to send twice (RFC 7230, section 6.3.1).
+	switch (method) {
+		case HTTPClient::METHOD_GET:
+		case HTTPClient::METHOD_HEAD:
+		case HTTPClient::METHOD_PUT:
+		case HTTPClient::METHOD_DELETE:
+		case HTTPClient::METHOD_OPTIONS:
+		case HTTPClient::METHOD_TRACE:
+			return true;
+		default:
+			return false;
+	}
+}
+
+bool HTTPRequest::_retry_connection() {
+	if (!_can_retry_connection()) {
+		return false;
+	}
+	// The server closed the pooled connection while it was idle, try once more on a fresh one.
+	reused_connection = false;
+	request_sent = false;
+	client->close();
+	return client->connect_to_host(url, port, use_tls, validate_tls) == OK;
+}
+
+void HTTPRequest::_release_connection() {
+	if (!use_connection_pool || has_http_proxy || has_https_proxy || client->get_status() != HTTPClient::STATUS_CONNECTED) {
+		return;
+	}
+	if (get_header_value(response_headers, "Connection").to_lower() == "close" || get_header_value(headers, "Connection").to_lower() == "close") {
+		return;
+	}
+
+	_pool_release(_get_pool_key(), client);
+
+	client = Ref<HTTPClient>(HTTPClient::create());
+	client->set_read_chunk_size(download_chunk_size);
+}
+
 Error HTTPRequest::_parse_url(const String &p_url) {
 	use_tls = false;
 	request_string = "";
@@ -182,6 +321,10 @@ void HTTPRequest::_thread_func(void *p_userdata) {
 }
 
 void HTTPRequest::cancel_request() {
+	_cancel_request(false);
+}
+
+void HTTPRequest::_cancel_request(bool p_keep_connection) {
 	timer->stop();
 
 	if (!requesting) {
@@ -197,6 +340,9 @@ void HTTPRequest::cancel_request() {
 
 	file.unref();
 	decompressor.unref();
+	if (p_keep_connection) {
+		_release_connection();
+	}
 	client->close();
 	body.clear();
 	got_response = false;
@@ -207,6 +353,10 @@ void HTTPRequest::cancel_request() {
 
 bool HTTPRequest::_handle_response(bool *ret_value) {
 	if (!client->has_response()) {
+		if (_retry_connection()) {
+			*ret_value = false;
+			return true;
+		}
 		_defer_done(RESULT_NO_RESPONSE, 0, PackedStringArray(), PackedByteArray());
 		*ret_value = true;
 		return true;
@@ -288,6 +438,9 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 bool HTTPRequest::_update_connection() {
 	switch (client->get_status()) {
 		case HTTPClient::STATUS_DISCONNECTED: {
+			if (_retry_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CANT_CONNECT, 0, PackedStringArray(), PackedByteArray());
 			return true; // End it, since it's disconnected.
 		} break;
@@ -340,6 +493,9 @@ bool HTTPRequest::_update_connection() {
 				int size = request_data.size();
 				Error err = client->request(method, request_string, headers, size > 0 ? request_data.ptr() : nullptr, size);
 				if (err != OK) {
+					if (_retry_connection()) {
+						return false;
+					}
 					_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 					return true;
 				}
@@ -459,6 +615,9 @@ bool HTTPRequest::_update_connection() {
 
 		} break; // Request resulted in body: break which must be read.
 		case HTTPClient::STATUS_CONNECTION_ERROR: {
+			if (_retry_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 			return true;
 		} break;
@@ -476,7 +635,7 @@ void HTTPRequest::_defer_done(int p_status, int p_code, const PackedStringArray
 }
 
 void HTTPRequest::_request_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data) {
-	cancel_request();
+	_cancel_request(p_status == RESULT_SUCCESS);
 
 	emit_signal(SNAME("request_completed"), p_status, p_code, p_headers, p_data);
 }
@@ -518,6 +677,15 @@ bool HTTPRequest::is_accepting_gzip() const {
 	return accept_gzip;
 }
 
+void HTTPRequest::set_use_connection_pool(bool p_enable) {
+	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
+	use_connection_pool = p_enable;
+}
+
+bool HTTPRequest::is_using_connection_pool() const {
+	return use_connection_pool;
+}
+
 void HTTPRequest::set_body_size_limit(int p_bytes) {
 	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
 
@@ -541,11 +709,12 @@ String HTTPRequest::get_download_file() const {
 void HTTPRequest::set_download_chunk_size(int p_chunk_size) {
 	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
 
+	download_chunk_size = p_chunk_size;
 	client->set_read_chunk_size(p_chunk_size);
 }
 
 int HTTPRequest::get_download_chunk_size() const {
-	return client->get_read_chunk_size();
+	return download_chunk_size;
 }
 
 HTTPClient::Status HTTPRequest::get_http_client_status() const {
@@ -569,10 +738,12 @@ int HTTPRequest::get_body_size() const {
 }
 
 void HTTPRequest::set_http_proxy(const String &p_host, int p_port) {
+	has_http_proxy = !p_host.is_empty() && p_port != -1;
 	client->set_http_proxy(p_host, p_port);
 }
 
 void HTTPRequest::set_https_proxy(const String &p_host, int p_port) {
+	has_https_proxy = !p_host.is_empty() && p_port != -1;
 	client->set_https_proxy(p_host, p_port);
 }
 
@@ -603,6 +774,9 @@ void HTTPRequest::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_accept_gzip", "enable"), &HTTPRequest::set_accept_gzip);
 	ClassDB::bind_method(D_METHOD("is_accepting_gzip"), &HTTPRequest::is_accepting_gzip);
 
+	ClassDB::bind_method(D_METHOD("set_use_connection_pool", "enable"), &HTTPRequest::set_use_connection_pool);
+	ClassDB::bind_method(D_METHOD("is_using_connection_pool"), &HTTPRequest::is_using_connection_pool);
+
 	ClassDB::bind_method(D_METHOD("set_body_size_limit", "bytes"), &HTTPRequest::set_body_size_limit);
 	ClassDB::bind_method(D_METHOD("get_body_size_limit"), &HTTPRequest::get_body_size_limit);
 
@@ -630,6 +804,7 @@ void HTTPRequest::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "download_chunk_size", PROPERTY_HINT_RANGE, "256,16777216,suffix:B"), "set_download_chunk_size", "get_download_chunk_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threads"), "set_use_threads", "is_using_threads");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "accept_gzip"), "set_accept_gzip", "is_accepting_gzip");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_connection_pool"), "set_use_connection_pool", "is_using_connection_pool");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "body_size_limit", PROPERTY_HINT_RANGE, "-1,2000000000,suffix:B"), "set_body_size_limit", "get_body_size_limit");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_redirects", PROPERTY_HINT_RANGE, "-1,64"), "set_max_redirects", "get_max_redirects");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "timeout", PROPERTY_HINT_RANGE, "0,3600,0.1,or_greater,suffix:s"), "set_timeout", "get_timeout");
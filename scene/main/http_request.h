@@ -33,7 +33,9 @@
 
 #include "core/io/http_client.h"
 #include "core/io/stream_peer_gzip.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
@@ -62,6 +64,24 @@ public:
 	};
 
 private:
+	enum {
+		POOL_MAX_IDLE_PER_HOST = 6,
+		POOL_IDLE_TIMEOUT_MSEC = 15000,
+	};
+
+	struct PooledConnection {
+		Ref<HTTPClient> client;
+		uint64_t idle_since = 0;
+	};
+
+	// Idle keep-alive connections, shared by all HTTPRequest nodes and keyed by host, port and TLS settings.
+	static Mutex pool_mutex;
+	static HashMap<String, List<PooledConnection>> connection_pool;
+
+	static void _pool_prune(uint64_t p_now);
+	static Ref<HTTPClient> _pool_acquire(const String &p_key);
+	static void _pool_release(const String &p_key, const Ref<HTTPClient> &p_client);
+
 	bool requesting = false;
 
 	String request_string;
@@ -78,6 +98,11 @@ private:
 	PackedByteArray body;
 	SafeFlag use_threads;
 	bool accept_gzip = true;
+	bool use_connection_pool = false;
+	bool reused_connection = false;
+	bool has_http_proxy = false;
+	bool has_https_proxy = false;
+	int download_chunk_size = 65536;
 
 	bool got_response = false;
 	int response_code = 0;
@@ -108,6 +133,12 @@ private:
 	Error _parse_url(const String &p_url);
 	Error _request();
 
+	String _get_pool_key() const;
+	bool _can_retry_connection() const;
+	bool _retry_connection();
+	void _release_connection();
+	void _cancel_request(bool p_keep_connection);
+
 	bool has_header(const PackedStringArray &p_headers, const String &p_header_name);
 	String get_header_value(const PackedStringArray &p_headers, const String &header_name);
 
@@ -136,6 +167,9 @@ public:
 	void set_accept_gzip(bool p_gzip);
 	bool is_accepting_gzip() const;
 
+	void set_use_connection_pool(bool p_enable);
+	bool is_using_connection_pool() const;
+
 	void set_download_file(const String &p_file);
 	String get_download_file() const;
 
@@ -161,6 +195,8 @@ public:
 	void set_http_proxy(const String &p_host, int p_port);
 	void set_https_proxy(const String &p_host, int p_port);
 
+	static void clear_connection_pool();
+
 	HTTPRequest();
 };
 
@@ -135,6 +135,8 @@ private:
 		bool physics_process = false;
 		bool process = false;
 		int process_priority = 0;
+		bool process_thread_safe = false;
+		int process_thread_group = 0;
 
 		bool physics_process_internal = false;
 		bool process_internal = false;
@@ -406,6 +408,12 @@ public:
 	void set_process_priority(int p_priority);
 	int get_process_priority() const;
 
+	void set_process_thread_safe(bool p_enable);
+	bool is_process_thread_safe() const { return data.process_thread_safe; }
+
+	void set_process_thread_group(int p_group);
+	int get_process_thread_group() const { return data.process_thread_group; }
+
 	void set_process_input(bool p_enable);
 	bool is_processing_input() const;
 
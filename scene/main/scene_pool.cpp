@@ -0,0 +1,218 @@
+/*************************************************************************/
+/*  scene_pool.cpp                                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "scene_pool.h"
+
+Node *ScenePool::_instantiate() {
+	Node *node = scene->instantiate();
+	ERR_FAIL_NULL_V_MSG(node, nullptr, "Failed to instantiate the pooled scene.");
+
+	if (!defaults_captured) {
+		_capture_defaults(node, node);
+		defaults_captured = true;
+	}
+	return node;
+}
+
+void ScenePool::_capture_defaults(Node *p_root, Node *p_node) {
+	NodeDefaults nd;
+	nd.path = p_root->get_path_to(p_node);
+
+	List<PropertyInfo> plist;
+	p_node->get_property_list(&plist);
+	for (const PropertyInfo &E : plist) {
+		if (!(E.usage & PROPERTY_USAGE_STORAGE) || E.type == Variant::OBJECT) {
+			continue;
+		}
+		Variant value = p_node->get(E.name);
+		if (value.get_type() == Variant::OBJECT) {
+			// Resources (and local to scene ones in particular) are left to each instance.
+			continue;
+		}
+		nd.properties.push_back(Pair<StringName, Variant>(E.name, value.duplicate(true)));
+	}
+	defaults.push_back(nd);
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_capture_defaults(p_root, p_node->get_child(i));
+	}
+}
+
+void ScenePool::_reset_node(Node *p_root) {
+	for (uint32_t i = 0; i < defaults.size(); i++) {
+		const NodeDefaults &nd = defaults[i];
+		Node *node = p_root->get_node_or_null(nd.path);
+		if (!node) {
+			continue;
+		}
+		for (uint32_t j = 0; j < nd.properties.size(); j++) {
+			const Pair<StringName, Variant> &prop = nd.properties[j];
+			// Only touch what changed, setters may have side effects.
+			if (node->get(prop.first) == prop.second) {
+				continue;
+			}
+			Variant::Type type = prop.second.get_type();
+			node->set(prop.first, (type == Variant::ARRAY || type == Variant::DICTIONARY) ? prop.second.duplicate(true) : prop.second);
+		}
+	}
+}
+
+void ScenePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+	clear();
+	scene = p_scene;
+}
+
+Ref<PackedScene> ScenePool::get_scene() const {
+	return scene;
+}
+
+void ScenePool::set_max_size(int p_size) {
+	ERR_FAIL_COND(p_size < 0);
+	max_size = p_size;
+	while (max_size > 0 && available.size() > (uint32_t)max_size) {
+		memdelete(available[available.size() - 1]);
+		available.resize(available.size() - 1);
+	}
+}
+
+int ScenePool::get_max_size() const {
+	return max_size;
+}
+
+void ScenePool::prewarm(int p_count) {
+	ERR_FAIL_COND(scene.is_null());
+	ERR_FAIL_COND(p_count < 0);
+
+	if (max_size > 0) {
+		p_count = MIN(p_count, max_size);
+	}
+	while (available.size() < (uint32_t)p_count) {
+		Node *node = _instantiate();
+		ERR_FAIL_NULL(node);
+		available.push_back(node);
+	}
+}
+
+Node *ScenePool::acquire() {
+	ERR_FAIL_COND_V(scene.is_null(), nullptr);
+
+	Node *node = nullptr;
+	if (available.size()) {
+		node = available[available.size() - 1];
+		available.resize(available.size() - 1);
+		hit_count++;
+	} else {
+		node = _instantiate();
+		ERR_FAIL_NULL_V(node, nullptr);
+		miss_count++;
+	}
+
+	active.insert(node->get_instance_id());
+	return node;
+}
+
+void ScenePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(!active.has(p_node->get_instance_id()), "Node was not acquired from this ScenePool, or was already released.");
+
+	active.erase(p_node->get_instance_id());
+
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		parent->remove_child(p_node);
+	}
+
+	if (max_size > 0 && available.size() >= (uint32_t)max_size) {
+		p_node->queue_free();
+		return;
+	}
+
+	_reset_node(p_node);
+	available.push_back(p_node);
+}
+
+void ScenePool::clear() {
+	for (uint32_t i = 0; i < available.size(); i++) {
+		memdelete(available[i]);
+	}
+	available.clear();
+	active.clear();
+	defaults.clear();
+	defaults_captured = false;
+}
+
+int ScenePool::get_available_count() const {
+	return available.size();
+}
+
+int ScenePool::get_active_count() const {
+	return active.size();
+}
+
+uint64_t ScenePool::get_hit_count() const {
+	return hit_count;
+}
+
+uint64_t ScenePool::get_miss_count() const {
+	return miss_count;
+}
+
+void ScenePool::reset_statistics() {
+	hit_count = 0;
+	miss_count = 0;
+}
+
+void ScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &ScenePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &ScenePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_max_size", "size"), &ScenePool::set_max_size);
+	ClassDB::bind_method(D_METHOD("get_max_size"), &ScenePool::get_max_size);
+
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &ScenePool::prewarm);
+	ClassDB::bind_method(D_METHOD("acquire"), &ScenePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &ScenePool::release);
+	ClassDB::bind_method(D_METHOD("clear"), &ScenePool::clear);
+
+	ClassDB::bind_method(D_METHOD("get_available_count"), &ScenePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("get_active_count"), &ScenePool::get_active_count);
+	ClassDB::bind_method(D_METHOD("get_hit_count"), &ScenePool::get_hit_count);
+	ClassDB::bind_method(D_METHOD("get_miss_count"), &ScenePool::get_miss_count);
+	ClassDB::bind_method(D_METHOD("reset_statistics"), &ScenePool::reset_statistics);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_max_size", "get_max_size");
+}
+
+ScenePool::~ScenePool() {
+	clear();
+}
@@ -32,20 +32,25 @@
 
 #include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/trace_profiler.h"
 #include "core/input/input.h"
 #include "core/io/dir_access.h"
 #include "core/io/image_loader.h"
 #include "core/io/marshalls.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 #include "node.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
+#include "scene/animation/animation_tree.h"
 #include "scene/animation/tween.h"
 #include "scene/debugger/scene_debugger.h"
 #include "scene/gui/control.h"
 #include "scene/main/multiplayer_api.h"
+#include "scene/main/scene_pool.h"
 #include "scene/main/viewport.h"
 #include "scene/resources/environment.h"
 #include "scene/resources/font.h"
@@ -73,16 +78,41 @@ void SceneTreeTimer::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("timeout"));
 }
 
+int SceneTreeTimer::_get_queue_id() const {
+	int id = 0;
+	if (process_in_physics) {
+		id |= SceneTree::TIMER_QUEUE_PHYSICS;
+	}
+	if (process_always) {
+		id |= SceneTree::TIMER_QUEUE_PROCESS_ALWAYS;
+	}
+	if (ignore_time_scale) {
+		id |= SceneTree::TIMER_QUEUE_IGNORE_TIME_SCALE;
+	}
+	return id;
+}
+
 void SceneTreeTimer::set_time_left(double p_time) {
-	time_left = p_time;
+	if (queue >= 0) {
+		SceneTree::get_singleton()->_reschedule_timer(this, p_time);
+	} else {
+		time_left = p_time;
+	}
 }
 
 double SceneTreeTimer::get_time_left() const {
+	if (queue >= 0) {
+		return timeout_at - SceneTree::get_singleton()->timer_queues[queue].clock;
+	}
 	return time_left;
 }
 
 void SceneTreeTimer::set_process_always(bool p_process_always) {
+	double left = get_time_left();
 	process_always = p_process_always;
+	if (queue >= 0) {
+		SceneTree::get_singleton()->_reschedule_timer(this, left);
+	}
 }
 
 bool SceneTreeTimer::is_process_always() {
@@ -90,7 +120,11 @@ bool SceneTreeTimer::is_process_always() {
 }
 
 void SceneTreeTimer::set_process_in_physics(bool p_process_in_physics) {
+	double left = get_time_left();
 	process_in_physics = p_process_in_physics;
+	if (queue >= 0) {
+		SceneTree::get_singleton()->_reschedule_timer(this, left);
+	}
 }
 
 bool SceneTreeTimer::is_process_in_physics() {
@@ -98,7 +132,11 @@ bool SceneTreeTimer::is_process_in_physics() {
 }
 
 void SceneTreeTimer::set_ignore_time_scale(bool p_ignore) {
+	double left = get_time_left();
 	ignore_time_scale = p_ignore;
+	if (queue >= 0) {
+		SceneTree::get_singleton()->_reschedule_timer(this, left);
+	}
 }
 
 bool SceneTreeTimer::is_ignore_time_scale() {
@@ -116,6 +154,69 @@ void SceneTreeTimer::release_connections() {
 
 SceneTreeTimer::SceneTreeTimer() {}
 
+void SceneTree::TimerQueue::_swap(uint32_t p_a, uint32_t p_b) {
+	SWAP(heap[p_a], heap[p_b]);
+	heap[p_a]->queue_index = p_a;
+	heap[p_b]->queue_index = p_b;
+}
+
+void SceneTree::TimerQueue::_sift_up(uint32_t p_index) {
+	while (p_index > 0) {
+		uint32_t parent = (p_index - 1) / 2;
+		if (!_less(heap[p_index].ptr(), heap[parent].ptr())) {
+			break;
+		}
+		_swap(p_index, parent);
+		p_index = parent;
+	}
+}
+
+void SceneTree::TimerQueue::_sift_down(uint32_t p_index) {
+	while (true) {
+		uint32_t smallest = p_index;
+		uint32_t left = p_index * 2 + 1;
+		uint32_t right = left + 1;
+		if (left < heap.size() && _less(heap[left].ptr(), heap[smallest].ptr())) {
+			smallest = left;
+		}
+		if (right < heap.size() && _less(heap[right].ptr(), heap[smallest].ptr())) {
+			smallest = right;
+		}
+		if (smallest == p_index) {
+			break;
+		}
+		_swap(p_index, smallest);
+		p_index = smallest;
+	}
+}
+
+void SceneTree::TimerQueue::push(const Ref<SceneTreeTimer> &p_timer, int p_queue, double p_time_left) {
+	uint32_t index = heap.size();
+	heap.push_back(p_timer);
+	heap[index]->queue = p_queue;
+	heap[index]->queue_index = index;
+	heap[index]->timeout_at = clock + p_time_left;
+	_sift_up(index);
+}
+
+Ref<SceneTreeTimer> SceneTree::TimerQueue::remove(uint32_t p_index) {
+	Ref<SceneTreeTimer> timer = heap[p_index];
+	uint32_t last = heap.size() - 1;
+	if (p_index != last) {
+		heap[p_index] = heap[last];
+		heap[p_index]->queue_index = p_index;
+	}
+	heap.resize(last);
+	if (p_index < heap.size()) {
+		_sift_down(p_index);
+		_sift_up(p_index);
+	}
+
+	timer->time_left = timer->timeout_at - clock;
+	timer->queue = -1;
+	return timer;
+}
+
 void SceneTree::tree_changed() {
 	tree_version++;
 	emit_signal(tree_changed_name);
@@ -170,6 +271,9 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 }
 
 void SceneTree::flush_transform_notifications() {
+	bool batching = !xform_batching;
+	xform_batching = true;
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -178,6 +282,17 @@ void SceneTree::flush_transform_notifications() {
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
+
+	if (!batching) {
+		return; // Nested flush, the outermost one submits.
+	}
+
+	xform_batching = false;
+	if (xform_batch_instances.size()) {
+		RS::get_singleton()->instance_set_transforms(xform_batch_instances, xform_batch_transforms);
+		xform_batch_instances.clear();
+		xform_batch_transforms.clear();
+	}
 }
 
 void SceneTree::_flush_ugc() {
@@ -411,6 +526,14 @@ void SceneTree::initialize() {
 	MainLoop::initialize();
 }
 
+void SceneTree::iteration_prepare() {
+	if (physics_interpolation_enabled) {
+		// Transforms set before this point belong to the previous tick.
+		flush_transform_notifications();
+		RenderingServer::get_singleton()->tick();
+	}
+}
+
 bool SceneTree::physics_process(double p_time) {
 	root_lock++;
 
@@ -424,6 +547,7 @@ bool SceneTree::physics_process(double p_time) {
 	emit_signal(SNAME("physics_frame"));
 
 	_notify_group_pause(SNAME("_physics_process_internal"), Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
+	AnimationTree::flush_parallel_processing();
 	call_group(SNAME("_picking_viewports"), SNAME("_process_picking"));
 	_notify_group_pause(SNAME("_physics_process"), Node::NOTIFICATION_PHYSICS_PROCESS);
 	_flush_ugc();
@@ -443,6 +567,7 @@ bool SceneTree::physics_process(double p_time) {
 }
 
 bool SceneTree::process(double p_time) {
+	TRACE_ZONE("SceneTree::process");
 	root_lock++;
 
 	MainLoop::process(p_time);
@@ -460,9 +585,14 @@ bool SceneTree::process(double p_time) {
 
 	MessageQueue::get_singleton()->flush(); //small little hack
 
+#ifndef _3D_DISABLED
+	VisibleOnScreenNotifier3D::flush_screen_changes();
+#endif // _3D_DISABLED
+
 	flush_transform_notifications();
 
 	_notify_group_pause(SNAME("_process_internal"), Node::NOTIFICATION_INTERNAL_PROCESS);
+	AnimationTree::flush_parallel_processing();
 	_notify_group_pause(SNAME("_process"), Node::NOTIFICATION_PROCESS);
 
 	_flush_ugc();
@@ -512,61 +642,106 @@ bool SceneTree::process(double p_time) {
 }
 
 void SceneTree::process_timers(double p_delta, bool p_physics_frame) {
-	List<Ref<SceneTreeTimer>>::Element *L = timers.back(); //last element
-
-	for (List<Ref<SceneTreeTimer>>::Element *E = timers.front(); E;) {
-		List<Ref<SceneTreeTimer>>::Element *N = E->next();
-		if ((paused && !E->get()->is_process_always()) || (E->get()->is_process_in_physics() != p_physics_frame)) {
-			if (E == L) {
-				break; //break on last, so if new timers were added during list traversal, ignore them.
-			}
-			E = N;
+	for (int i = 0; i < TIMER_QUEUE_MAX; i++) {
+		if (bool(i & TIMER_QUEUE_PHYSICS) != p_physics_frame || (paused && !(i & TIMER_QUEUE_PROCESS_ALWAYS))) {
 			continue;
 		}
 
-		double time_left = E->get()->get_time_left();
-		if (E->get()->is_ignore_time_scale()) {
-			time_left -= Engine::get_singleton()->get_process_step();
+		TimerQueue &timer_queue = timer_queues[i];
+		if (i & TIMER_QUEUE_IGNORE_TIME_SCALE) {
+			timer_queue.clock += Engine::get_singleton()->get_process_step();
 		} else {
-			time_left -= p_delta;
+			timer_queue.clock += p_delta;
+		}
+
+		while (timer_queue.heap.size() && timer_queue.heap[0]->timeout_at <= timer_queue.clock) {
+			timed_out_timers.push_back(timer_queue.remove(0));
+		}
+	}
+
+	if (timed_out_timers.is_empty()) {
+		return;
+	}
+
+	// Emit in creation order, regardless of the queue. Timers created while emitting wait for the next frame.
+	struct TimerSequenceComparator {
+		_FORCE_INLINE_ bool operator()(const Ref<SceneTreeTimer> &p_a, const Ref<SceneTreeTimer> &p_b) const {
+			return p_a->sequence < p_b->sequence;
 		}
-		E->get()->set_time_left(time_left);
+	};
+	timed_out_timers.sort_custom<TimerSequenceComparator>();
+
+	LocalVector<Ref<SceneTreeTimer>> timed_out;
+	SWAP(timed_out, timed_out_timers);
 
-		if (time_left <= 0) {
-			E->get()->emit_signal(SNAME("timeout"));
-			timers.erase(E);
+	for (uint32_t i = 0; i < timed_out.size(); i++) {
+		Ref<SceneTreeTimer> &timer = timed_out[i];
+		if (timer->time_left > 0) {
+			// Given more time by an earlier timeout.
+			_add_timer(timer, timer->time_left);
+			continue;
 		}
-		if (E == L) {
-			break; //break on last, so if new timers were added during list traversal, ignore them.
+
+		timer->emit_signal(SNAME("timeout"));
+
+		// If nothing refers to the timer anymore, nobody can tell it apart from a new one.
+		if (timer->queue < 0 && timer->get_reference_count() == 1 && timer_pool.size() < TIMER_POOL_MAX_SIZE && !timer->get_script_instance()) {
+			List<StringName> meta;
+			timer->get_meta_list(&meta);
+			if (meta.is_empty()) {
+				timer->release_connections();
+				timer_pool.push_back(timer);
+			}
 		}
-		E = N;
 	}
+
+	timed_out.clear();
+	if (timed_out_timers.is_empty()) {
+		// Keep the allocation around for the next frame.
+		SWAP(timed_out, timed_out_timers);
+	}
+}
+
+void SceneTree::_add_timer(const Ref<SceneTreeTimer> &p_timer, double p_time_left) {
+	int queue = p_timer->_get_queue_id();
+	timer_queues[queue].push(p_timer, queue, p_time_left);
+}
+
+void SceneTree::_reschedule_timer(SceneTreeTimer *p_timer, double p_time_left) {
+	ERR_FAIL_COND(p_timer->queue < 0);
+	Ref<SceneTreeTimer> timer = timer_queues[p_timer->queue].remove(p_timer->queue_index);
+	_add_timer(timer, p_time_left);
 }
 
 void SceneTree::process_tweens(double p_delta, bool p_physics) {
-	// This methods works similarly to how SceneTreeTimers are handled.
-	List<Ref<Tween>>::Element *L = tweens.back();
+	// Tweens created while processing are only processed from the next frame on.
+	uint32_t tween_count = tweens.size();
+	uint32_t kept_count = 0;
 
-	for (List<Ref<Tween>>::Element *E = tweens.front(); E;) {
-		List<Ref<Tween>>::Element *N = E->next();
+	for (uint32_t i = 0; i < tween_count; i++) {
+		// Tweens may be created while stepping, so don't keep a reference into the array.
+		Ref<Tween> tween = tweens[i];
 		// Don't process if paused or process mode doesn't match.
-		if (!E->get()->can_process(paused) || (p_physics == (E->get()->get_process_mode() == Tween::TWEEN_PROCESS_IDLE))) {
-			if (E == L) {
-				break;
+		bool keep = true;
+		if (tween->can_process(paused) && (p_physics != (tween->get_process_mode() == Tween::TWEEN_PROCESS_IDLE))) {
+			if (!tween->step(p_delta)) {
+				tween->clear();
+				keep = false;
 			}
-			E = N;
-			continue;
 		}
-
-		if (!E->get()->step(p_delta)) {
-			E->get()->clear();
-			tweens.erase(E);
-		}
-		if (E == L) {
-			break;
+		if (keep) {
+			if (kept_count != i) {
+				tweens[kept_count] = tweens[i];
+			}
+			kept_count++;
 		}
-		E = N;
 	}
+
+	// Move the tweens created while processing over the finished ones.
+	for (uint32_t i = tween_count; i < tweens.size(); i++) {
+		tweens[kept_count++] = tweens[i];
+	}
+	tweens.resize(kept_count);
 }
 
 void SceneTree::finalize() {
@@ -585,15 +760,24 @@ void SceneTree::finalize() {
 		root = nullptr;
 	}
 
+	// Pooled nodes are not inside the tree, free them explicitly.
+	for (KeyValue<ObjectID, Ref<ScenePool>> &E : scene_pools) {
+		E.value->clear();
+	}
+	scene_pools.clear();
+
 	// In case deletion of some objects was queued when destructing the `root`.
 	// E.g. if `queue_free()` was called for some node outside the tree when handling NOTIFICATION_PREDELETE for some node in the tree.
 	_flush_delete_queue();
 
 	// Cleanup timers.
-	for (Ref<SceneTreeTimer> &timer : timers) {
-		timer->release_connections();
+	for (int i = 0; i < TIMER_QUEUE_MAX; i++) {
+		TimerQueue &timer_queue = timer_queues[i];
+		while (timer_queue.heap.size()) {
+			timer_queue.remove(timer_queue.heap.size() - 1)->release_connections();
+		}
 	}
-	timers.clear();
+	timer_pool.clear();
 }
 
 void SceneTree::quit(int p_exit_code) {
@@ -850,6 +1034,10 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
 	int gr_node_count = nodes_copy.size();
 	Node **gr_nodes = nodes_copy.ptrw();
 
+	// Nodes flagged as thread-safe only run their regular (non-internal) processing in parallel.
+	bool allow_threaded = p_notification == Node::NOTIFICATION_PROCESS || p_notification == Node::NOTIFICATION_PHYSICS_PROCESS;
+	LocalVector<Node *> thread_safe_nodes;
+
 	call_lock++;
 
 	for (int i = 0; i < gr_node_count; i++) {
@@ -865,16 +1053,77 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
 			continue;
 		}
 
+		if (allow_threaded && n->is_process_thread_safe()) {
+			thread_safe_nodes.push_back(n);
+			continue;
+		}
+
 		n->notification(p_notification);
 		//ERR_FAIL_COND(gr_node_count != g.nodes.size());
 	}
 
+	if (thread_safe_nodes.size()) {
+		// Processing the other nodes may have removed some of these.
+		// Nodes sharing a thread group are processed one after the other, in order, by the same task.
+		uint32_t count = 0;
+		LocalVector<LocalVector<Node *>> thread_groups;
+		HashMap<int, uint32_t> thread_group_indices;
+		for (uint32_t i = 0; i < thread_safe_nodes.size(); i++) {
+			Node *n = thread_safe_nodes[i];
+			if (call_skip.has(n)) {
+				continue;
+			}
+			int thread_group = n->get_process_thread_group();
+			if (thread_group == 0) {
+				thread_safe_nodes[count++] = n;
+				continue;
+			}
+			HashMap<int, uint32_t>::Iterator E = thread_group_indices.find(thread_group);
+			if (!E) {
+				E = thread_group_indices.insert(thread_group, thread_groups.size());
+				thread_groups.push_back(LocalVector<Node *>());
+			}
+			thread_groups[E->value].push_back(n);
+		}
+
+		if (count == 1 && thread_groups.is_empty()) {
+			thread_safe_nodes[0]->notification(p_notification);
+		} else if (count > 0 || thread_groups.size()) {
+			threaded_process_notification = p_notification;
+			WorkerThreadPool::GroupID node_task = 0;
+			WorkerThreadPool::GroupID thread_group_task = 0;
+			if (count > 0) {
+				node_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_thread_safe_node, thread_safe_nodes.ptr(), count, -1, true, SNAME("Process thread-safe nodes"));
+			}
+			if (thread_groups.size()) {
+				thread_group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_thread_group, thread_groups.ptr(), thread_groups.size(), -1, true, SNAME("Process thread groups"));
+			}
+			if (node_task) {
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(node_task);
+			}
+			if (thread_group_task) {
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(thread_group_task);
+			}
+		}
+	}
+
 	call_lock--;
 	if (call_lock == 0) {
 		call_skip.clear();
 	}
 }
 
+void SceneTree::_process_thread_safe_node(uint32_t p_index, Node **p_nodes) {
+	p_nodes[p_index]->notification(threaded_process_notification);
+}
+
+void SceneTree::_process_thread_group(uint32_t p_index, LocalVector<Node *> *p_groups) {
+	const LocalVector<Node *> &nodes = p_groups[p_index];
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		nodes[i]->notification(threaded_process_notification);
+	}
+}
+
 void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_call_type, const Ref<InputEvent> &p_input, Viewport *p_viewport) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
@@ -1145,12 +1394,17 @@ void SceneTree::add_current_scene(Node *p_current) {
 
 Ref<SceneTreeTimer> SceneTree::create_timer(double p_delay_sec, bool p_process_always, bool p_process_in_physics, bool p_ignore_time_scale) {
 	Ref<SceneTreeTimer> stt;
-	stt.instantiate();
-	stt->set_process_always(p_process_always);
-	stt->set_time_left(p_delay_sec);
-	stt->set_process_in_physics(p_process_in_physics);
-	stt->set_ignore_time_scale(p_ignore_time_scale);
-	timers.push_back(stt);
+	if (timer_pool.size()) {
+		stt = timer_pool[timer_pool.size() - 1];
+		timer_pool.resize(timer_pool.size() - 1);
+	} else {
+		stt.instantiate();
+	}
+	stt->process_always = p_process_always;
+	stt->process_in_physics = p_process_in_physics;
+	stt->ignore_time_scale = p_ignore_time_scale;
+	stt->sequence = timer_sequence++;
+	_add_timer(stt, p_delay_sec);
 	return stt;
 }
 
@@ -1160,14 +1414,27 @@ Ref<Tween> SceneTree::create_tween() {
 	return tween;
 }
 
+Ref<ScenePool> SceneTree::get_scene_pool(const Ref<PackedScene> &p_scene) {
+	ERR_FAIL_COND_V(p_scene.is_null(), Ref<ScenePool>());
+
+	Ref<ScenePool> *pool = scene_pools.getptr(p_scene->get_instance_id());
+	if (pool) {
+		return *pool;
+	}
+
+	Ref<ScenePool> new_pool;
+	new_pool.instantiate();
+	new_pool->set_scene(p_scene);
+	scene_pools.insert(p_scene->get_instance_id(), new_pool);
+	return new_pool;
+}
+
 TypedArray<Tween> SceneTree::get_processed_tweens() {
 	TypedArray<Tween> ret;
 	ret.resize(tweens.size());
 
-	int i = 0;
-	for (const Ref<Tween> &tween : tweens) {
-		ret[i] = tween;
-		i++;
+	for (uint32_t i = 0; i < tweens.size(); i++) {
+		ret[i] = tweens[i];
 	}
 
 	return ret;
@@ -1250,6 +1517,7 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("create_timer", "time_sec", "process_always", "process_in_physics", "ignore_time_scale"), &SceneTree::create_timer, DEFVAL(true), DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("create_tween"), &SceneTree::create_tween);
 	ClassDB::bind_method(D_METHOD("get_processed_tweens"), &SceneTree::get_processed_tweens);
+	ClassDB::bind_method(D_METHOD("get_scene_pool", "scene"), &SceneTree::get_scene_pool);
 
 	ClassDB::bind_method(D_METHOD("get_node_count"), &SceneTree::get_node_count);
 	ClassDB::bind_method(D_METHOD("get_frame"), &SceneTree::get_frame);
@@ -1379,6 +1647,8 @@ SceneTree::SceneTree() {
 	debug_paths_color = GLOBAL_DEF("debug/shapes/paths/geometry_color", Color(0.1, 1.0, 0.7, 0.4));
 	debug_paths_width = GLOBAL_DEF("debug/shapes/paths/geometry_width", 2.0);
 	collision_debug_contacts = GLOBAL_DEF("debug/shapes/collision/max_contacts_displayed", 10000);
+	// Editor viewports move nodes outside of physics ticks, so never interpolate them.
+	physics_interpolation_enabled = GLOBAL_DEF("physics/common/physics_interpolation", false) && !Engine::get_singleton()->is_editor_hint();
 	ProjectSettings::get_singleton()->set_custom_property_info("debug/shapes/collision/max_contacts_displayed", PropertyInfo(Variant::INT, "debug/shapes/collision/max_contacts_displayed", PROPERTY_HINT_RANGE, "0,20000,1")); // No negative
 
 	GLOBAL_DEF("debug/shapes/collision/draw_2d_outlines", true);
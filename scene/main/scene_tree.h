@@ -33,6 +33,7 @@
 
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/self_list.h"
 #include "scene/resources/mesh.h"
 
@@ -45,17 +46,29 @@ class Material;
 class Mesh;
 class MultiplayerAPI;
 class SceneDebugger;
+class ScenePool;
 class Tween;
 class Viewport;
 
 class SceneTreeTimer : public RefCounted {
 	GDCLASS(SceneTreeTimer, RefCounted);
 
+	friend class SceneTree;
+
 	double time_left = 0.0;
 	bool process_always = true;
 	bool process_in_physics = false;
 	bool ignore_time_scale = false;
 
+	// While running, the timer sits in one of the SceneTree timer queues and times out once the clock of that queue
+	// reaches timeout_at. time_left is only up to date while it is not queued.
+	int queue = -1;
+	uint32_t queue_index = 0;
+	double timeout_at = 0.0;
+	uint64_t sequence = 0;
+
+	int _get_queue_id() const;
+
 protected:
 	static void _bind_methods();
 
@@ -105,6 +118,7 @@ private:
 	bool debug_navigation_hint = false;
 #endif
 	bool paused = false;
+	bool physics_interpolation_enabled = false;
 	int root_lock = 0;
 
 	HashMap<StringName, Group> group_map;
@@ -164,8 +178,41 @@ private:
 
 	void _change_scene(Node *p_to);
 
-	List<Ref<SceneTreeTimer>> timers;
-	List<Ref<Tween>> tweens;
+	enum {
+		TIMER_QUEUE_PHYSICS = 1,
+		TIMER_QUEUE_PROCESS_ALWAYS = 2,
+		TIMER_QUEUE_IGNORE_TIME_SCALE = 4,
+		TIMER_QUEUE_MAX = 8,
+	};
+
+	static constexpr uint32_t TIMER_POOL_MAX_SIZE = 1024;
+
+	// Timers that advance at the same pace share a clock, and are kept in a binary min-heap ordered by the clock
+	// value they time out at. Each frame only the timers that actually time out are touched.
+	struct TimerQueue {
+		double clock = 0.0;
+		LocalVector<Ref<SceneTreeTimer>> heap;
+
+		_FORCE_INLINE_ static bool _less(const SceneTreeTimer *p_a, const SceneTreeTimer *p_b) {
+			return p_a->timeout_at < p_b->timeout_at || (p_a->timeout_at == p_b->timeout_at && p_a->sequence < p_b->sequence);
+		}
+		void _swap(uint32_t p_a, uint32_t p_b);
+		void _sift_up(uint32_t p_index);
+		void _sift_down(uint32_t p_index);
+
+		void push(const Ref<SceneTreeTimer> &p_timer, int p_queue, double p_time_left);
+		Ref<SceneTreeTimer> remove(uint32_t p_index);
+	};
+
+	TimerQueue timer_queues[TIMER_QUEUE_MAX];
+	uint64_t timer_sequence = 0;
+	// Timers nothing referred to anymore when they timed out, reused by create_timer().
+	LocalVector<Ref<SceneTreeTimer>> timer_pool;
+	LocalVector<Ref<SceneTreeTimer>> timed_out_timers;
+
+	LocalVector<Ref<Tween>> tweens;
+
+	HashMap<ObjectID, Ref<ScenePool>> scene_pools;
 
 	///network///
 
@@ -175,6 +222,7 @@ private:
 
 	static SceneTree *singleton;
 	friend class Node;
+	friend class SceneTreeTimer;
 
 	void tree_changed();
 	void node_added(Node *p_node);
@@ -182,12 +230,17 @@ private:
 	void node_renamed(Node *p_node);
 	void process_timers(double p_delta, bool p_physics_frame);
 	void process_tweens(double p_delta, bool p_physics_frame);
+	void _add_timer(const Ref<SceneTreeTimer> &p_timer, double p_time_left);
+	void _reschedule_timer(SceneTreeTimer *p_timer, double p_time_left);
 
 	Group *add_to_group(const StringName &p_group, Node *p_node);
 	void remove_from_group(const StringName &p_group, Node *p_node);
 	void make_group_changed(const StringName &p_group);
 
 	void _notify_group_pause(const StringName &p_group, int p_notification);
+	int threaded_process_notification = 0;
+	void _process_thread_safe_node(uint32_t p_index, Node **p_nodes);
+	void _process_thread_group(uint32_t p_index, LocalVector<Node *> *p_groups);
 	void _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	void _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
@@ -196,9 +249,16 @@ private:
 	friend class CanvasItem;
 	friend class Node3D;
 	friend class Viewport;
+	friend class VisualInstance3D;
 
 	SelfList<Node>::List xform_change_list;
 
+	// Instance transforms collected while flushing transform notifications,
+	// submitted to the RenderingServer as one batch.
+	bool xform_batching = false;
+	Vector<RID> xform_batch_instances;
+	Vector<Transform3D> xform_batch_transforms;
+
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
 #endif
@@ -277,11 +337,14 @@ public:
 
 	virtual void initialize() override;
 
+	virtual void iteration_prepare() override;
 	virtual bool physics_process(double p_time) override;
 	virtual bool process(double p_time) override;
 
 	virtual void finalize() override;
 
+	bool is_physics_interpolation_enabled() const { return physics_interpolation_enabled; }
+
 	bool is_auto_accept_quit() const;
 	void set_auto_accept_quit(bool p_enable);
 
@@ -366,6 +429,8 @@ public:
 	Ref<Tween> create_tween();
 	TypedArray<Tween> get_processed_tweens();
 
+	Ref<ScenePool> get_scene_pool(const Ref<PackedScene> &p_scene);
+
 	//used by Main::start, don't use otherwise
 	void add_current_scene(Node *p_current);
 
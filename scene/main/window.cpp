@@ -1559,6 +1559,7 @@ void Window::set_theme(const Ref<Theme> &p_theme) {
 	}
 
 	theme = p_theme;
+	ThemeDB::get_singleton()->invalidate_theme_lookups();
 	if (theme.is_valid()) {
 		theme_owner->propagate_theme_changed(this, this, is_inside_tree(), true);
 		theme->connect("changed", callable_mp(this, &Window::_theme_changed), CONNECT_DEFERRED);
@@ -1632,14 +1633,14 @@ Ref<Texture2D> Window::get_theme_icon(const StringName &p_name, const StringName
 		}
 	}
 
-	if (theme_icon_cache.has(p_theme_type) && theme_icon_cache[p_theme_type].has(p_name)) {
-		return theme_icon_cache[p_theme_type][p_name];
+	Theme::ThemeIconMap &type_cache = theme_icon_cache[p_theme_type];
+	const Ref<Texture2D> *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
-	List<StringName> theme_types;
-	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	Ref<Texture2D> icon = theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_ICON, p_name, theme_types);
-	theme_icon_cache[p_theme_type][p_name] = icon;
+	Ref<Texture2D> icon = theme_owner->get_theme_item(Theme::DATA_TYPE_ICON, p_name, this, p_theme_type);
+	type_cache[p_name] = icon;
 	return icon;
 }
 
@@ -1651,14 +1652,14 @@ Ref<StyleBox> Window::get_theme_stylebox(const StringName &p_name, const StringN
 		}
 	}
 
-	if (theme_style_cache.has(p_theme_type) && theme_style_cache[p_theme_type].has(p_name)) {
-		return theme_style_cache[p_theme_type][p_name];
+	Theme::ThemeStyleMap &type_cache = theme_style_cache[p_theme_type];
+	const Ref<StyleBox> *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
-	List<StringName> theme_types;
-	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	Ref<StyleBox> style = theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_STYLEBOX, p_name, theme_types);
-	theme_style_cache[p_theme_type][p_name] = style;
+	Ref<StyleBox> style = theme_owner->get_theme_item(Theme::DATA_TYPE_STYLEBOX, p_name, this, p_theme_type);
+	type_cache[p_name] = style;
 	return style;
 }
 
@@ -1670,14 +1671,14 @@ Ref<Font> Window::get_theme_font(const StringName &p_name, const StringName &p_t
 		}
 	}
 
-	if (theme_font_cache.has(p_theme_type) && theme_font_cache[p_theme_type].has(p_name)) {
-		return theme_font_cache[p_theme_type][p_name];
+	Theme::ThemeFontMap &type_cache = theme_font_cache[p_theme_type];
+	const Ref<Font> *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
-	List<StringName> theme_types;
-	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	Ref<Font> font = theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_FONT, p_name, theme_types);
-	theme_font_cache[p_theme_type][p_name] = font;
+	Ref<Font> font = theme_owner->get_theme_item(Theme::DATA_TYPE_FONT, p_name, this, p_theme_type);
+	type_cache[p_name] = font;
 	return font;
 }
 
@@ -1689,14 +1690,14 @@ int Window::get_theme_font_size(const StringName &p_name, const StringName &p_th
 		}
 	}
 
-	if (theme_font_size_cache.has(p_theme_type) && theme_font_size_cache[p_theme_type].has(p_name)) {
-		return theme_font_size_cache[p_theme_type][p_name];
+	Theme::ThemeFontSizeMap &type_cache = theme_font_size_cache[p_theme_type];
+	const int *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
-	List<StringName> theme_types;
-	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	int font_size = theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_FONT_SIZE, p_name, theme_types);
-	theme_font_size_cache[p_theme_type][p_name] = font_size;
+	int font_size = theme_owner->get_theme_item(Theme::DATA_TYPE_FONT_SIZE, p_name, this, p_theme_type);
+	type_cache[p_name] = font_size;
 	return font_size;
 }
 
@@ -1708,14 +1709,14 @@ Color Window::get_theme_color(const StringName &p_name, const StringName &p_them
 		}
 	}
 
-	if (theme_color_cache.has(p_theme_type) && theme_color_cache[p_theme_type].has(p_name)) {
-		return theme_color_cache[p_theme_type][p_name];
+	Theme::ThemeColorMap &type_cache = theme_color_cache[p_theme_type];
+	const Color *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
-	List<StringName> theme_types;
-	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	Color color = theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_COLOR, p_name, theme_types);
-	theme_color_cache[p_theme_type][p_name] = color;
+	Color color = theme_owner->get_theme_item(Theme::DATA_TYPE_COLOR, p_name, this, p_theme_type);
+	type_cache[p_name] = color;
 	return color;
 }
 
@@ -1727,14 +1728,14 @@ int Window::get_theme_constant(const StringName &p_name, const StringName &p_the
 		}
 	}
 
-	if (theme_constant_cache.has(p_theme_type) && theme_constant_cache[p_theme_type].has(p_name)) {
-		return theme_constant_cache[p_theme_type][p_name];
+	Theme::ThemeConstantMap &type_cache = theme_constant_cache[p_theme_type];
+	const int *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
-	List<StringName> theme_types;
-	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	int constant = theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_CONSTANT, p_name, theme_types);
-	theme_constant_cache[p_theme_type][p_name] = constant;
+	int constant = theme_owner->get_theme_item(Theme::DATA_TYPE_CONSTANT, p_name, this, p_theme_type);
+	type_cache[p_name] = constant;
 	return constant;
 }
 
@@ -1745,9 +1746,7 @@ bool Window::has_theme_icon(const StringName &p_name, const StringName &p_theme_
 		}
 	}
 
-	List<StringName> theme_types;
-	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	return theme_owner->has_theme_item_in_types(Theme::DATA_TYPE_ICON, p_name, theme_types);
+	return theme_owner->has_theme_item(Theme::DATA_TYPE_ICON, p_name, this, p_theme_type);
 }
 
 bool Window::has_theme_stylebox(const StringName &p_name, const StringName &p_theme_type) const {
@@ -1757,9 +1756,7 @@ bool Window::has_theme_stylebox(const StringName &p_name, const StringName &p_th
 		}
 	}
 
-	List<StringName> theme_types;
-	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	return theme_owner->has_theme_item_in_types(Theme::DATA_TYPE_STYLEBOX, p_name, theme_types);
+	return theme_owner->has_theme_item(Theme::DATA_TYPE_STYLEBOX, p_name, this, p_theme_type);
 }
 
 bool Window::has_theme_font(const StringName &p_name, const StringName &p_theme_type) const {
@@ -1769,9 +1766,7 @@ bool Window::has_theme_font(const StringName &p_name, const StringName &p_theme_
 		}
 	}
 
-	List<StringName> theme_types;
-	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	return theme_owner->has_theme_item_in_types(Theme::DATA_TYPE_FONT, p_name, theme_types);
+	return theme_owner->has_theme_item(Theme::DATA_TYPE_FONT, p_name, this, p_theme_type);
 }
 
 bool Window::has_theme_font_size(const StringName &p_name, const StringName &p_theme_type) const {
@@ -1781,9 +1776,7 @@ bool Window::has_theme_font_size(const StringName &p_name, const StringName &p_t
 		}
 	}
 
-	List<StringName> theme_types;
-	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	return theme_owner->has_theme_item_in_types(Theme::DATA_TYPE_FONT_SIZE, p_name, theme_types);
+	return theme_owner->has_theme_item(Theme::DATA_TYPE_FONT_SIZE, p_name, this, p_theme_type);
 }
 
 bool Window::has_theme_color(const StringName &p_name, const StringName &p_theme_type) const {
@@ -1793,9 +1786,7 @@ bool Window::has_theme_color(const StringName &p_name, const StringName &p_theme
 		}
 	}
 
-	List<StringName> theme_types;
-	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	return theme_owner->has_theme_item_in_types(Theme::DATA_TYPE_COLOR, p_name, theme_types);
+	return theme_owner->has_theme_item(Theme::DATA_TYPE_COLOR, p_name, this, p_theme_type);
 }
 
 bool Window::has_theme_constant(const StringName &p_name, const StringName &p_theme_type) const {
@@ -1805,9 +1796,7 @@ bool Window::has_theme_constant(const StringName &p_name, const StringName &p_th
 		}
 	}
 
-	List<StringName> theme_types;
-	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
-	return theme_owner->has_theme_item_in_types(Theme::DATA_TYPE_CONSTANT, p_name, theme_types);
+	return theme_owner->has_theme_item(Theme::DATA_TYPE_CONSTANT, p_name, this, p_theme_type);
 }
 
 /// Local property overrides.
@@ -2025,14 +2014,14 @@ bool Window::is_layout_rtl() const {
 		if (parent_w) {
 			return parent_w->is_layout_rtl();
 		} else {
-			if (GLOBAL_GET(SNAME("internationalization/rendering/force_right_to_left_layout_direction"))) {
+			if (GLOBAL_GET_CACHED(bool, "internationalization/rendering/force_right_to_left_layout_direction")) {
 				return true;
 			}
 			String locale = TranslationServer::get_singleton()->get_tool_locale();
 			return TS->is_locale_right_to_left(locale);
 		}
 	} else if (layout_dir == LAYOUT_DIRECTION_LOCALE) {
-		if (GLOBAL_GET(SNAME("internationalization/rendering/force_right_to_left_layout_direction"))) {
+		if (GLOBAL_GET_CACHED(bool, "internationalization/rendering/force_right_to_left_layout_direction")) {
 			return true;
 		}
 		String locale = TranslationServer::get_singleton()->get_tool_locale();
@@ -1078,7 +1078,7 @@ Error Animation::position_track_get_key(int p_track, int p_key, Vector3 *r_posit
 	return OK;
 }
 
-Error Animation::position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation) const {
+Error Animation::position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, TrackSampleCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_POSITION_3D, ERR_INVALID_PARAMETER);
@@ -1086,7 +1086,7 @@ Error Animation::position_track_interpolate(int p_track, double p_time, Vector3
 	PositionTrack *tt = static_cast<PositionTrack *>(t);
 
 	if (tt->compressed_track >= 0) {
-		if (_pos_scale_interpolate_compressed(tt->compressed_track, p_time, *r_interpolation)) {
+		if (_pos_scale_interpolate_compressed(tt->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1095,7 +1095,7 @@ Error Animation::position_track_interpolate(int p_track, double p_time, Vector3
 
 	bool ok = false;
 
-	Vector3 tk = _interpolate(tt->positions, p_time, tt->interpolation, tt->loop_wrap, &ok);
+	Vector3 tk = _interpolate(tt->positions, p_time, tt->interpolation, tt->loop_wrap, &ok, false, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1150,7 +1150,7 @@ Error Animation::rotation_track_get_key(int p_track, int p_key, Quaternion *r_ro
 	return OK;
 }
 
-Error Animation::rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation) const {
+Error Animation::rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation, TrackSampleCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_ROTATION_3D, ERR_INVALID_PARAMETER);
@@ -1158,7 +1158,7 @@ Error Animation::rotation_track_interpolate(int p_track, double p_time, Quaterni
 	RotationTrack *rt = static_cast<RotationTrack *>(t);
 
 	if (rt->compressed_track >= 0) {
-		if (_rotation_interpolate_compressed(rt->compressed_track, p_time, *r_interpolation)) {
+		if (_rotation_interpolate_compressed(rt->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1167,7 +1167,7 @@ Error Animation::rotation_track_interpolate(int p_track, double p_time, Quaterni
 
 	bool ok = false;
 
-	Quaternion tk = _interpolate(rt->rotations, p_time, rt->interpolation, rt->loop_wrap, &ok);
+	Quaternion tk = _interpolate(rt->rotations, p_time, rt->interpolation, rt->loop_wrap, &ok, false, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1222,7 +1222,7 @@ Error Animation::scale_track_get_key(int p_track, int p_key, Vector3 *r_scale) c
 	return OK;
 }
 
-Error Animation::scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation) const {
+Error Animation::scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, TrackSampleCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_SCALE_3D, ERR_INVALID_PARAMETER);
@@ -1230,7 +1230,7 @@ Error Animation::scale_track_interpolate(int p_track, double p_time, Vector3 *r_
 	ScaleTrack *st = static_cast<ScaleTrack *>(t);
 
 	if (st->compressed_track >= 0) {
-		if (_pos_scale_interpolate_compressed(st->compressed_track, p_time, *r_interpolation)) {
+		if (_pos_scale_interpolate_compressed(st->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1239,7 +1239,7 @@ Error Animation::scale_track_interpolate(int p_track, double p_time, Vector3 *r_
 
 	bool ok = false;
 
-	Vector3 tk = _interpolate(st->scales, p_time, st->interpolation, st->loop_wrap, &ok);
+	Vector3 tk = _interpolate(st->scales, p_time, st->interpolation, st->loop_wrap, &ok, false, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1292,7 +1292,7 @@ Error Animation::blend_shape_track_get_key(int p_track, int p_key, float *r_blen
 	return OK;
 }
 
-Error Animation::blend_shape_track_interpolate(int p_track, double p_time, float *r_interpolation) const {
+Error Animation::blend_shape_track_interpolate(int p_track, double p_time, float *r_interpolation, TrackSampleCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_BLEND_SHAPE, ERR_INVALID_PARAMETER);
@@ -1300,7 +1300,7 @@ Error Animation::blend_shape_track_interpolate(int p_track, double p_time, float
 	BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
 
 	if (bst->compressed_track >= 0) {
-		if (_blend_shape_interpolate_compressed(bst->compressed_track, p_time, *r_interpolation)) {
+		if (_blend_shape_interpolate_compressed(bst->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1309,7 +1309,7 @@ Error Animation::blend_shape_track_interpolate(int p_track, double p_time, float
 
 	bool ok = false;
 
-	float tk = _interpolate(bst->blend_shapes, p_time, bst->interpolation, bst->loop_wrap, &ok);
+	float tk = _interpolate(bst->blend_shapes, p_time, bst->interpolation, bst->loop_wrap, &ok, false, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -2258,12 +2258,37 @@ void Animation::track_set_key_transition(int p_track, int p_key_idx, real_t p_tr
 }
 
 template <class K>
-int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward) const {
+int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward, int *r_hint) const {
 	int len = p_keys.size();
 	if (len == 0) {
 		return -2;
 	}
 
+	const K *keys = &p_keys[0];
+
+	if (r_hint && *r_hint >= 0 && *r_hint < len) {
+		// Playback usually stays on the same key or moves to the adjacent one,
+		// so check those before falling back to the binary search.
+		int step = p_backward ? -1 : 1;
+		for (int i = 0, k = *r_hint; i < 2 && k >= 0 && k < len; i++, k += step) {
+			if (!p_backward) {
+				bool after_key = keys[k].time <= p_time || Math::is_equal_approx(p_time, (double)keys[k].time);
+				bool before_next = k + 1 == len || (keys[k + 1].time > p_time && !Math::is_equal_approx(p_time, (double)keys[k + 1].time));
+				if (after_key && before_next) {
+					*r_hint = k;
+					return k;
+				}
+			} else {
+				bool before_key = keys[k].time >= p_time || Math::is_equal_approx(p_time, (double)keys[k].time);
+				bool after_prev = k == 0 || (keys[k - 1].time < p_time && !Math::is_equal_approx(p_time, (double)keys[k - 1].time));
+				if (before_key && after_prev) {
+					*r_hint = k;
+					return k;
+				}
+			}
+		}
+	}
+
 	int low = 0;
 	int high = len - 1;
 	int middle = 0;
@@ -2274,12 +2299,13 @@ int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward) co
 	}
 #endif
 
-	const K *keys = &p_keys[0];
-
 	while (low <= high) {
 		middle = (low + high) / 2;
 
 		if (Math::is_equal_approx(p_time, (double)keys[middle].time)) { //match
+			if (r_hint) {
+				*r_hint = middle;
+			}
 			return middle;
 		} else if (p_time < keys[middle].time) {
 			high = middle - 1; //search low end of array
@@ -2298,6 +2324,10 @@ int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward) co
 		}
 	}
 
+	if (r_hint && middle >= 0 && middle < len) {
+		*r_hint = middle;
+	}
+
 	return middle;
 }
 
@@ -2442,8 +2472,8 @@ Variant Animation::_cubic_interpolate_angle_in_time(const Variant &p_pre_a, cons
 }
 
 template <class T>
-T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward) const {
-	int len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
+T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward, TrackSampleCursor *r_cursor) const {
+	int len = _find(p_keys, length, false, r_cursor ? &r_cursor->end_key : nullptr) + 1; // try to find last key (there may be more past the end)
 
 	if (len <= 0) {
 		// (-1 or -2 returned originally) (plus one above)
@@ -2460,7 +2490,7 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, Interpol
 		return p_keys[0].value;
 	}
 
-	int idx = _find(p_keys, p_time, p_backward);
+	int idx = _find(p_keys, p_time, p_backward, r_cursor ? &r_cursor->key : nullptr);
 
 	ERR_FAIL_COND_V(idx == -2, T());
 
@@ -5022,13 +5052,13 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 #endif
 }
 
-bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const {
+bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret, TrackSampleCursor *r_cursor) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, r_cursor)) {
 		return false; //some sort of problem
 	}
 
@@ -5046,13 +5076,13 @@ bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, do
 	return true;
 }
 
-bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret) const {
+bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret, TrackSampleCursor *r_cursor) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, r_cursor)) {
 		return false; //some sort of problem
 	}
 
@@ -5069,13 +5099,13 @@ bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, d
 
 	return true;
 }
-bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret) const {
+bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret, TrackSampleCursor *r_cursor) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, r_cursor)) {
 		return false; //some sort of problem
 	}
 
@@ -5094,7 +5124,7 @@ bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track,
 }
 
 template <uint32_t COMPONENTS>
-bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index) const {
+bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index, TrackSampleCursor *r_cursor) const {
 	ERR_FAIL_COND_V(!compression.enabled, false);
 	ERR_FAIL_UNSIGNED_INDEX_V(p_compressed_track, compression.bounds.size(), false);
 	p_time = CLAMP(p_time, 0, length);
@@ -5105,15 +5135,31 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	double frame_to_sec = 1.0 / double(compression.fps);
 
 	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
+	if (r_cursor && r_cursor->page >= 0) {
+		// Try the page of the previous sample and the one after it.
+		for (int32_t i = r_cursor->page; i < MIN(r_cursor->page + 2, (int32_t)compression.pages.size()); i++) {
+			if (compression.pages[i].time_offset <= p_time && (i + 1 == (int32_t)compression.pages.size() || compression.pages[i + 1].time_offset > p_time)) {
+				page_index = i;
+				break;
+			}
+		}
+	}
+	if (page_index == -1) {
+		for (uint32_t i = 0; i < compression.pages.size(); i++) {
+			if (compression.pages[i].time_offset > p_time) {
+				break;
+			}
+			page_index = i;
 		}
-		page_index = i;
 	}
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
 
+	if (r_cursor && r_cursor->page != page_index) {
+		r_cursor->page = page_index;
+		r_cursor->packet = -1;
+	}
+
 	double page_base_time = compression.pages[page_index].time_offset;
 	const uint8_t *page_data = compression.pages[page_index].data.ptr();
 	// Little endian assumed. No major big endian hardware exists any longer, but in case it does it will need to be supported.
@@ -5125,7 +5171,20 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
 	uint32_t base_frame = time_keys[0];
 
-	for (uint32_t i = 1; i < time_key_count; i++) {
+	// The cursor can't be used when the key index is requested, as that is accumulated while walking the packets.
+	uint32_t packet_from = 1;
+	if (r_cursor && !key_index && r_cursor->packet > 0 && (uint32_t)r_cursor->packet < time_key_count) {
+		uint32_t f = time_keys[r_cursor->packet * 2 + 0];
+		double frame_time = double(f) * frame_to_sec + page_base_time;
+		if (frame_time <= p_time) {
+			packet_idx = r_cursor->packet;
+			packet_time = frame_time;
+			base_frame = f;
+			packet_from = packet_idx + 1;
+		}
+	}
+
+	for (uint32_t i = packet_from; i < time_key_count; i++) {
 		uint32_t f = time_keys[i * 2 + 0];
 		double frame_time = double(f) * frame_to_sec + page_base_time;
 
@@ -5142,6 +5201,10 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 		base_frame = f;
 	}
 
+	if (r_cursor) {
+		r_cursor->packet = packet_idx;
+	}
+
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
 
 	uint16_t time_key_data = time_keys[packet_idx * 2 + 1];
@@ -254,6 +254,12 @@ void ImporterMesh::set_surface_material(int p_surface, const Ref<Material> &p_ma
 	mesh.unref();
 }
 
+void ImporterMesh::set_surface_format(int p_surface, uint32_t p_flags) {
+	ERR_FAIL_INDEX(p_surface, surfaces.size());
+	surfaces.write[p_surface].flags = p_flags;
+	mesh.unref();
+}
+
 #define VERTEX_SKIN_FUNC(bone_count, vert_idx, read_array, write_array, transform_array, bone_array, weight_array) \
 	Vector3 transformed_vert;                                                                                      \
 	for (unsigned int weight_idx = 0; weight_idx < bone_count; weight_idx++) {                                     \
@@ -655,6 +661,58 @@ void ImporterMesh::generate_lods(float p_normal_merge_angle, float p_normal_spli
 	}
 }
 
+void ImporterMesh::generate_meshlets() {
+	ERR_FAIL_COND_MSG(!SurfaceTool::build_meshlets_func || !SurfaceTool::build_meshlets_bound_func, "Meshoptimizer library is not initialized.");
+
+	// Limits commonly used for mesh shading hardware; the renderer only relies on
+	// the resulting triangle order, so these only affect cluster locality.
+	const size_t max_vertices = 64;
+	const size_t max_triangles = 124;
+	const float cone_weight = 0.25;
+
+	for (int i = 0; i < surfaces.size(); i++) {
+		if (surfaces[i].primitive != Mesh::PRIMITIVE_TRIANGLES) {
+			continue;
+		}
+
+		Vector<Vector3> vertices = surfaces[i].arrays[RS::ARRAY_VERTEX];
+		Vector<int> indices = surfaces[i].arrays[RS::ARRAY_INDEX];
+		size_t index_count = indices.size();
+		if (index_count < 3 || vertices.is_empty()) {
+			continue;
+		}
+
+		size_t max_meshlets = SurfaceTool::build_meshlets_bound_func(index_count, max_vertices, max_triangles);
+		LocalVector<SurfaceTool::Meshlet> meshlets;
+		meshlets.resize(max_meshlets);
+		LocalVector<unsigned int> meshlet_vertices;
+		meshlet_vertices.resize(max_meshlets * max_vertices);
+		LocalVector<unsigned char> meshlet_triangles;
+		meshlet_triangles.resize(max_meshlets * max_triangles * 3);
+
+		size_t meshlet_count = SurfaceTool::build_meshlets_func(meshlets.ptr(), meshlet_vertices.ptr(), meshlet_triangles.ptr(), (const unsigned int *)indices.ptr(), index_count, (const float *)vertices.ptr(), vertices.size(), sizeof(Vector3), max_vertices, max_triangles, cone_weight);
+
+		// Flatten the meshlets back into a regular index array, so triangles belonging
+		// to the same meshlet are contiguous.
+		Vector<int> new_indices;
+		new_indices.resize(index_count);
+		int *w = new_indices.ptrw();
+		size_t written = 0;
+		for (size_t j = 0; j < meshlet_count; j++) {
+			const SurfaceTool::Meshlet &meshlet = meshlets[j];
+			ERR_BREAK(written + meshlet.triangle_count * 3 > index_count);
+			for (uint32_t k = 0; k < meshlet.triangle_count * 3; k++) {
+				w[written++] = meshlet_vertices[meshlet.vertex_offset + meshlet_triangles[meshlet.triangle_offset + k]];
+			}
+		}
+		ERR_CONTINUE(written != index_count);
+
+		surfaces.write[i].arrays[RS::ARRAY_INDEX] = new_indices;
+	}
+
+	mesh.unref();
+}
+
 bool ImporterMesh::has_mesh() const {
 	return mesh.is_valid();
 }
@@ -924,7 +982,7 @@ Vector<Face3> ImporterMesh::get_faces() const {
 	return faces;
 }
 
-Vector<Ref<Shape3D>> ImporterMesh::convex_decompose(const Mesh::ConvexDecompositionSettings &p_settings) const {
+Vector<Ref<Shape3D>> ImporterMesh::convex_decompose(const Mesh::ConvexDecompositionSettings &p_settings, Mesh::ConvexDecompositionCache *p_cache) const {
 	ERR_FAIL_COND_V(!Mesh::convex_decomposition_function, Vector<Ref<Shape3D>>());
 
 	const Vector<Face3> faces = get_faces();
@@ -947,7 +1005,7 @@ Vector<Ref<Shape3D>> ImporterMesh::convex_decompose(const Mesh::ConvexDecomposit
 				if (found_vertex) {
 					index = found_vertex->value;
 				} else {
-					index = ++vertex_count;
+					index = vertex_count++;
 					vertex_map[vertex] = index;
 					vertex_w[index] = vertex;
 				}
@@ -957,18 +1015,7 @@ Vector<Ref<Shape3D>> ImporterMesh::convex_decompose(const Mesh::ConvexDecomposit
 	}
 	vertices.resize(vertex_count);
 
-	Vector<Vector<Vector3>> decomposed = Mesh::convex_decomposition_function((real_t *)vertices.ptr(), vertex_count, indices.ptr(), face_count, p_settings, nullptr);
-
-	Vector<Ref<Shape3D>> ret;
-
-	for (int i = 0; i < decomposed.size(); i++) {
-		Ref<ConvexPolygonShape3D> shape;
-		shape.instantiate();
-		shape->set_points(decomposed[i]);
-		ret.push_back(shape);
-	}
-
-	return ret;
+	return Mesh::make_convex_shapes(Mesh::decompose_convex_hulls(vertices, indices, p_settings, p_cache));
 }
 
 Ref<ConcavePolygonShape3D> ImporterMesh::create_trimesh_shape() const {
@@ -1282,8 +1329,10 @@ void ImporterMesh::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_surface_name", "surface_idx", "name"), &ImporterMesh::set_surface_name);
 	ClassDB::bind_method(D_METHOD("set_surface_material", "surface_idx", "material"), &ImporterMesh::set_surface_material);
+	ClassDB::bind_method(D_METHOD("set_surface_format", "surface_idx", "flags"), &ImporterMesh::set_surface_format);
 
 	ClassDB::bind_method(D_METHOD("generate_lods", "normal_merge_angle", "normal_split_angle", "bone_transform_array"), &ImporterMesh::generate_lods);
+	ClassDB::bind_method(D_METHOD("generate_meshlets"), &ImporterMesh::generate_meshlets);
 	ClassDB::bind_method(D_METHOD("get_mesh", "base_mesh"), &ImporterMesh::get_mesh, DEFVAL(Ref<ArrayMesh>()));
 	ClassDB::bind_method(D_METHOD("clear"), &ImporterMesh::clear);
 
@@ -30,7 +30,11 @@
 
 #include "mesh.h"
 
+#include "core/crypto/crypto_core.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
 #include "core/math/convex_hull.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/pair.h"
 #include "scene/resources/surface_tool.h"
 
@@ -687,6 +691,7 @@ void Mesh::_bind_methods() {
 	BIND_ENUM_CONSTANT(ARRAY_FLAG_USE_2D_VERTICES);
 	BIND_ENUM_CONSTANT(ARRAY_FLAG_USE_DYNAMIC_UPDATE);
 	BIND_ENUM_CONSTANT(ARRAY_FLAG_USE_8_BONE_WEIGHTS);
+	BIND_ENUM_CONSTANT(ARRAY_FLAG_COMPRESS_UVS);
 
 	BIND_ENUM_CONSTANT(BLEND_SHAPE_MODE_NORMALIZED);
 	BIND_ENUM_CONSTANT(BLEND_SHAPE_MODE_RELATIVE);
@@ -712,43 +717,207 @@ void Mesh::clear_cache() const {
 	debug_lines.clear();
 }
 
-Vector<Ref<Shape3D>> Mesh::convex_decompose(const ConvexDecompositionSettings &p_settings) const {
-	ERR_FAIL_COND_V(!convex_decomposition_function, Vector<Ref<Shape3D>>());
+String Mesh::ConvexDecompositionCache::make_key(const Vector<Vector3> &p_vertices, const Vector<uint32_t> &p_indices, const ConvexDecompositionSettings &p_settings) {
+	CryptoCore::MD5Context ctx;
+	ctx.start();
 
-	Ref<TriangleMesh> tm = generate_triangle_mesh();
-	ERR_FAIL_COND_V(!tm.is_valid(), Vector<Ref<Shape3D>>());
+	ctx.update((const unsigned char *)p_vertices.ptr(), sizeof(Vector3) * p_vertices.size());
+	ctx.update((const unsigned char *)p_indices.ptr(), sizeof(uint32_t) * p_indices.size());
 
-	const Vector<TriangleMesh::Triangle> &triangles = tm->get_triangles();
-	int triangle_count = triangles.size();
+	// Hash the settings one by one, the struct has padding.
+	const real_t reals[] = { p_settings.max_concavity, p_settings.symmetry_planes_clipping_bias, p_settings.revolution_axes_clipping_bias, p_settings.min_volume_per_convex_hull };
+	ctx.update((const unsigned char *)reals, sizeof(reals));
+	const uint32_t ints[] = { p_settings.resolution, p_settings.max_num_vertices_per_convex_hull, p_settings.plane_downsampling, p_settings.convexhull_downsampling, p_settings.normalize_mesh, uint32_t(p_settings.mode), p_settings.convexhull_approximation, p_settings.max_convex_hulls, p_settings.project_hull_vertices };
+	ctx.update((const unsigned char *)ints, sizeof(ints));
 
-	Vector<uint32_t> indices;
-	{
-		indices.resize(triangle_count * 3);
-		uint32_t *w = indices.ptrw();
-		for (int i = 0; i < triangle_count; i++) {
-			for (int j = 0; j < 3; j++) {
-				w[i * 3 + j] = triangles[i].indices[j];
-			}
+	unsigned char hash[16];
+	ctx.finish(hash);
+	return String::hex_encode_buffer(hash, 16);
+}
+
+bool Mesh::ConvexDecompositionCache::lookup(const String &p_key, Vector<Vector<Vector3>> &r_hulls) {
+	MutexLock lock(mutex);
+	HashMap<String, Vector<Vector<Vector3>>>::Iterator E = entries.find(p_key);
+	if (!E) {
+		return false;
+	}
+	used.insert(p_key);
+	r_hulls = E->value;
+	return true;
+}
+
+void Mesh::ConvexDecompositionCache::store(const String &p_key, const Vector<Vector<Vector3>> &p_hulls) {
+	MutexLock lock(mutex);
+	entries[p_key] = p_hulls;
+	used.insert(p_key);
+}
+
+Error Mesh::ConvexDecompositionCache::load(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	if (f.is_null()) {
+		return err;
+	}
+
+	Dictionary data = f->get_var();
+	MutexLock lock(mutex);
+	List<Variant> keys;
+	data.get_key_list(&keys);
+	for (const Variant &E : keys) {
+		Array arr = data[E];
+		Vector<Vector<Vector3>> hulls;
+		hulls.resize(arr.size());
+		for (int i = 0; i < arr.size(); i++) {
+			hulls.write[i] = arr[i];
 		}
+		entries[E] = hulls;
 	}
+	return OK;
+}
 
-	const Vector<Vector3> &vertices = tm->get_vertices();
-	int vertex_count = vertices.size();
+Error Mesh::ConvexDecompositionCache::save(const String &p_path) {
+	MutexLock lock(mutex);
+	if (used.is_empty()) {
+		if (FileAccess::exists(p_path)) {
+			return DirAccess::remove_absolute(p_path);
+		}
+		return OK;
+	}
+
+	Dictionary data;
+	for (const String &E : used) {
+		const Vector<Vector<Vector3>> &hulls = entries[E];
+		Array arr;
+		arr.resize(hulls.size());
+		for (int i = 0; i < hulls.size(); i++) {
+			arr[i] = hulls[i];
+		}
+		data[E] = arr;
+	}
 
-	Vector<Vector<Vector3>> decomposed = convex_decomposition_function((real_t *)vertices.ptr(), vertex_count, indices.ptr(), triangle_count, p_settings, nullptr);
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, "Cannot save convex decomposition cache to file '" + p_path + "'.");
+	f->store_var(data);
+	return OK;
+}
 
+static bool _convex_decomposition_task_progress(void *p_userdata, float p_progress) {
+	Mesh::ConvexDecompositionTask *task = (Mesh::ConvexDecompositionTask *)p_userdata;
+	task->progress.set(p_progress);
+	return !task->cancelled.is_set();
+}
+
+void Mesh::ConvexDecompositionTask::_run(void *p_task) {
+	ConvexDecompositionTask *task = (ConvexDecompositionTask *)p_task;
+	task->hulls = decompose_convex_hulls(task->vertices, task->indices, task->settings, task->cache, _convex_decomposition_task_progress, task);
+	task->progress.set(1.0);
+}
+
+Vector<Vector<Vector3>> Mesh::decompose_convex_hulls(const Vector<Vector3> &p_vertices, const Vector<uint32_t> &p_indices, const ConvexDecompositionSettings &p_settings, ConvexDecompositionCache *p_cache, ConvexDecompositionProgressFunc p_progress_func, void *p_progress_userdata) {
+	ERR_FAIL_COND_V(!convex_decomposition_function, Vector<Vector<Vector3>>());
+
+	String key;
+	Vector<Vector<Vector3>> hulls;
+	if (p_cache) {
+		key = ConvexDecompositionCache::make_key(p_vertices, p_indices, p_settings);
+		if (p_cache->lookup(key, hulls)) {
+			return hulls;
+		}
+	}
+
+	hulls = convex_decomposition_function((real_t *)p_vertices.ptr(), p_vertices.size(), p_indices.ptr(), p_indices.size() / 3, p_settings, nullptr, p_progress_func, p_progress_userdata);
+
+	// An empty result may come from a cancelled decomposition, don't keep it.
+	if (p_cache && hulls.size()) {
+		p_cache->store(key, hulls);
+	}
+	return hulls;
+}
+
+Vector<Ref<Shape3D>> Mesh::make_convex_shapes(const Vector<Vector<Vector3>> &p_hulls) {
 	Vector<Ref<Shape3D>> ret;
 
-	for (int i = 0; i < decomposed.size(); i++) {
+	for (int i = 0; i < p_hulls.size(); i++) {
 		Ref<ConvexPolygonShape3D> shape;
 		shape.instantiate();
-		shape->set_points(decomposed[i]);
+		shape->set_points(p_hulls[i]);
 		ret.push_back(shape);
 	}
 
 	return ret;
 }
 
+static bool _get_convex_decomposition_arrays(const Ref<TriangleMesh> &p_triangle_mesh, Vector<Vector3> &r_vertices, Vector<uint32_t> &r_indices) {
+	ERR_FAIL_COND_V(!p_triangle_mesh.is_valid(), false);
+
+	const Vector<TriangleMesh::Triangle> &triangles = p_triangle_mesh->get_triangles();
+	int triangle_count = triangles.size();
+
+	r_indices.resize(triangle_count * 3);
+	uint32_t *w = r_indices.ptrw();
+	for (int i = 0; i < triangle_count; i++) {
+		for (int j = 0; j < 3; j++) {
+			w[i * 3 + j] = triangles[i].indices[j];
+		}
+	}
+
+	r_vertices = p_triangle_mesh->get_vertices();
+	return true;
+}
+
+Vector<Ref<Shape3D>> Mesh::convex_decompose(const ConvexDecompositionSettings &p_settings, ConvexDecompositionCache *p_cache) const {
+	ERR_FAIL_COND_V(!convex_decomposition_function, Vector<Ref<Shape3D>>());
+
+	Vector<Vector3> vertices;
+	Vector<uint32_t> indices;
+	if (!_get_convex_decomposition_arrays(generate_triangle_mesh(), vertices, indices)) {
+		return Vector<Ref<Shape3D>>();
+	}
+
+	return make_convex_shapes(decompose_convex_hulls(vertices, indices, p_settings, p_cache));
+}
+
+Error Mesh::convex_decompose_start(const ConvexDecompositionSettings &p_settings, ConvexDecompositionTask *r_task, ConvexDecompositionCache *p_cache) const {
+	ERR_FAIL_NULL_V(r_task, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(r_task->task_id != -1, ERR_ALREADY_IN_USE);
+	ERR_FAIL_COND_V(!convex_decomposition_function, ERR_UNCONFIGURED);
+
+	if (!_get_convex_decomposition_arrays(generate_triangle_mesh(), r_task->vertices, r_task->indices)) {
+		return ERR_CANT_CREATE;
+	}
+
+	r_task->settings = p_settings;
+	r_task->cache = p_cache;
+	r_task->progress.set(0.0);
+	r_task->cancelled.clear();
+	r_task->hulls.clear();
+	r_task->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ConvexDecompositionTask::_run, r_task, false, SNAME("ConvexDecomposition"));
+	return OK;
+}
+
+bool Mesh::convex_decompose_is_done(ConvexDecompositionTask *p_task) {
+	ERR_FAIL_NULL_V(p_task, true);
+	return p_task->task_id == -1 || WorkerThreadPool::get_singleton()->is_task_completed(p_task->task_id);
+}
+
+Vector<Ref<Shape3D>> Mesh::convex_decompose_finish(ConvexDecompositionTask *p_task) {
+	ERR_FAIL_NULL_V(p_task, Vector<Ref<Shape3D>>());
+	ERR_FAIL_COND_V(p_task->task_id == -1, Vector<Ref<Shape3D>>());
+
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(p_task->task_id);
+	p_task->task_id = -1;
+	p_task->vertices.clear();
+	p_task->indices.clear();
+
+	if (p_task->cancelled.is_set()) {
+		p_task->hulls.clear();
+		return Vector<Ref<Shape3D>>();
+	}
+
+	return make_convex_shapes(p_task->hulls);
+}
+
 int Mesh::get_builtin_bind_pose_count() const {
 	return 0;
 }
@@ -1828,18 +1997,41 @@ Error ArrayMesh::lightmap_unwrap(const Transform3D &p_base_transform, float p_te
 	return lightmap_unwrap_cached(p_base_transform, p_texel_size, null_cache, null_cache, false);
 }
 
-Error ArrayMesh::lightmap_unwrap_cached(const Transform3D &p_base_transform, float p_texel_size, const Vector<uint8_t> &p_src_cache, Vector<uint8_t> &r_dst_cache, bool p_generate_cache) {
-	ERR_FAIL_COND_V(!array_mesh_lightmap_unwrap_callback, ERR_UNCONFIGURED);
-	ERR_FAIL_COND_V_MSG(blend_shapes.size() != 0, ERR_UNAVAILABLE, "Can't unwrap mesh with blend shapes.");
-	ERR_FAIL_COND_V_MSG(p_texel_size <= 0.0f, ERR_PARAMETER_RANGE_ERROR, "Texel size must be greater than 0.");
+// Everything one unwrap needs, gathered up front so xatlas can run without touching the mesh.
+struct ArrayMesh::LightmapUnwrap {
+	float texel_size = 0.0;
+	Vector<uint8_t> src_cache;
+	bool generate_cache = false;
 
 	LocalVector<float> vertices;
 	LocalVector<float> normals;
 	LocalVector<int> indices;
-	LocalVector<float> uv;
 	LocalVector<Pair<int, int>> uv_indices;
+	Vector<ArrayMeshLightmapSurface> surfaces;
+
+	bool ok = false;
+	bool use_cache = false; // Used to request cache generation and to know if cache was used
+	uint8_t *gen_cache = nullptr;
+	int gen_cache_size = 0;
+	float *gen_uvs = nullptr;
+	int *gen_vertices = nullptr;
+	int *gen_indices = nullptr;
+	int gen_vertex_count = 0;
+	int gen_index_count = 0;
+	int size_x = 0;
+	int size_y = 0;
+};
+
+Error ArrayMesh::_lightmap_unwrap_prepare(const Transform3D &p_base_transform, LightmapUnwrap &r_unwrap) const {
+	ERR_FAIL_COND_V(!array_mesh_lightmap_unwrap_callback, ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V_MSG(blend_shapes.size() != 0, ERR_UNAVAILABLE, "Can't unwrap mesh with blend shapes.");
+	ERR_FAIL_COND_V_MSG(r_unwrap.texel_size <= 0.0f, ERR_PARAMETER_RANGE_ERROR, "Texel size must be greater than 0.");
 
-	Vector<ArrayMeshLightmapSurface> lightmap_surfaces;
+	LocalVector<float> &vertices = r_unwrap.vertices;
+	LocalVector<float> &normals = r_unwrap.normals;
+	LocalVector<int> &indices = r_unwrap.indices;
+	LocalVector<Pair<int, int>> &uv_indices = r_unwrap.uv_indices;
+	Vector<ArrayMeshLightmapSurface> &lightmap_surfaces = r_unwrap.surfaces;
 
 	// Keep only the scale
 	Basis basis = p_base_transform.get_basis();
@@ -1924,25 +2116,35 @@ Error ArrayMesh::lightmap_unwrap_cached(const Transform3D &p_base_transform, flo
 		lightmap_surfaces.push_back(s);
 	}
 
-	//unwrap
+	return OK;
+}
 
-	bool use_cache = p_generate_cache; // Used to request cache generation and to know if cache was used
-	uint8_t *gen_cache;
-	int gen_cache_size;
-	float *gen_uvs;
-	int *gen_vertices;
-	int *gen_indices;
-	int gen_vertex_count;
-	int gen_index_count;
-	int size_x;
-	int size_y;
+void ArrayMesh::_lightmap_unwrap_run(LightmapUnwrap &r_unwrap) {
+	r_unwrap.use_cache = r_unwrap.generate_cache;
+	r_unwrap.ok = array_mesh_lightmap_unwrap_callback(r_unwrap.texel_size, r_unwrap.vertices.ptr(), r_unwrap.normals.ptr(), r_unwrap.vertices.size() / 3, r_unwrap.indices.ptr(), r_unwrap.indices.size(), r_unwrap.src_cache.ptr(), &r_unwrap.use_cache, &r_unwrap.gen_cache, &r_unwrap.gen_cache_size, &r_unwrap.gen_uvs, &r_unwrap.gen_vertices, &r_unwrap.gen_vertex_count, &r_unwrap.gen_indices, &r_unwrap.gen_index_count, &r_unwrap.size_x, &r_unwrap.size_y);
+}
 
-	bool ok = array_mesh_lightmap_unwrap_callback(p_texel_size, vertices.ptr(), normals.ptr(), vertices.size() / 3, indices.ptr(), indices.size(), p_src_cache.ptr(), &use_cache, &gen_cache, &gen_cache_size, &gen_uvs, &gen_vertices, &gen_vertex_count, &gen_indices, &gen_index_count, &size_x, &size_y);
+void ArrayMesh::_lightmap_unwrap_task(void *p_userdata, uint32_t p_index) {
+	LightmapUnwrap **unwraps = (LightmapUnwrap **)p_userdata;
+	if (unwraps[p_index]) {
+		_lightmap_unwrap_run(*unwraps[p_index]);
+	}
+}
 
-	if (!ok) {
+Error ArrayMesh::_lightmap_unwrap_apply(LightmapUnwrap &r_unwrap, Vector<uint8_t> &r_dst_cache) {
+	if (!r_unwrap.ok) {
 		return ERR_CANT_CREATE;
 	}
 
+	const LocalVector<Pair<int, int>> &uv_indices = r_unwrap.uv_indices;
+	const Vector<ArrayMeshLightmapSurface> &lightmap_surfaces = r_unwrap.surfaces;
+	const float *gen_uvs = r_unwrap.gen_uvs;
+	const int *gen_vertices = r_unwrap.gen_vertices;
+	const int *gen_indices = r_unwrap.gen_indices;
+	int gen_index_count = r_unwrap.gen_index_count;
+	int size_x = r_unwrap.size_x;
+	int size_y = r_unwrap.size_y;
+
 	clear_surfaces();
 
 	//create surfacetools for each surface..
@@ -2008,22 +2210,77 @@ Error ArrayMesh::lightmap_unwrap_cached(const Transform3D &p_base_transform, flo
 
 	set_lightmap_size_hint(Size2(size_x, size_y));
 
-	if (gen_cache_size > 0) {
-		r_dst_cache.resize(gen_cache_size);
-		memcpy(r_dst_cache.ptrw(), gen_cache, gen_cache_size);
-		memfree(gen_cache);
+	if (r_unwrap.gen_cache_size > 0) {
+		r_dst_cache.resize(r_unwrap.gen_cache_size);
+		memcpy(r_dst_cache.ptrw(), r_unwrap.gen_cache, r_unwrap.gen_cache_size);
+		memfree(r_unwrap.gen_cache);
 	}
 
-	if (!use_cache) {
+	if (!r_unwrap.use_cache) {
 		// Cache was not used, free the buffers
-		memfree(gen_vertices);
-		memfree(gen_indices);
-		memfree(gen_uvs);
+		memfree(r_unwrap.gen_vertices);
+		memfree(r_unwrap.gen_indices);
+		memfree(r_unwrap.gen_uvs);
 	}
 
 	return OK;
 }
 
+Error ArrayMesh::lightmap_unwrap_cached(const Transform3D &p_base_transform, float p_texel_size, const Vector<uint8_t> &p_src_cache, Vector<uint8_t> &r_dst_cache, bool p_generate_cache) {
+	LightmapUnwrap unwrap;
+	unwrap.texel_size = p_texel_size;
+	unwrap.src_cache = p_src_cache;
+	unwrap.generate_cache = p_generate_cache;
+
+	Error err = _lightmap_unwrap_prepare(p_base_transform, unwrap);
+	if (err != OK) {
+		return err;
+	}
+	_lightmap_unwrap_run(unwrap);
+	return _lightmap_unwrap_apply(unwrap, r_dst_cache);
+}
+
+void ArrayMesh::lightmap_unwrap_meshes(const Vector<Ref<ArrayMesh>> &p_meshes, const Transform3D &p_base_transform, float p_texel_size, Vector<Error> *r_errors) {
+	if (r_errors) {
+		r_errors->resize(p_meshes.size());
+	}
+
+	LocalVector<LightmapUnwrap> unwraps;
+	LocalVector<LightmapUnwrap *> valid_unwraps;
+	unwraps.resize(p_meshes.size());
+	valid_unwraps.resize(p_meshes.size());
+	for (int i = 0; i < p_meshes.size(); i++) {
+		unwraps[i].texel_size = p_texel_size;
+		Error err = p_meshes[i]->_lightmap_unwrap_prepare(p_base_transform, unwraps[i]);
+		valid_unwraps[i] = err == OK ? &unwraps[i] : nullptr;
+		if (r_errors) {
+			r_errors->write[i] = err;
+		}
+	}
+
+	if (p_meshes.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&ArrayMesh::_lightmap_unwrap_task, valid_unwraps.ptr(), valid_unwraps.size(), -1, true, SNAME("LightmapUnwrap"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < valid_unwraps.size(); i++) {
+			_lightmap_unwrap_task(valid_unwraps.ptr(), i);
+		}
+	}
+
+	// Rebuilding the surfaces talks to the RenderingServer, so it stays on this thread.
+	Vector<uint8_t> null_cache;
+	for (int i = 0; i < p_meshes.size(); i++) {
+		if (!valid_unwraps[i]) {
+			continue;
+		}
+		Ref<ArrayMesh> mesh = p_meshes[i];
+		Error err = mesh->_lightmap_unwrap_apply(unwraps[i], null_cache);
+		if (r_errors) {
+			r_errors->write[i] = err;
+		}
+	}
+}
+
 void ArrayMesh::set_shadow_mesh(const Ref<ArrayMesh> &p_mesh) {
 	shadow_mesh = p_mesh;
 	if (shadow_mesh.is_valid()) {
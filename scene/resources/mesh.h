@@ -34,6 +34,11 @@
 #include "core/io/resource.h"
 #include "core/math/face3.h"
 #include "core/math/triangle_mesh.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/resources/material.h"
 #include "servers/rendering_server.h"
 
@@ -148,6 +153,7 @@ public:
 		ARRAY_FLAG_USE_8_BONE_WEIGHTS = RS::ARRAY_FLAG_USE_8_BONE_WEIGHTS,
 
 		ARRAY_FLAG_USES_EMPTY_VERTEX_ARRAY = RS::ARRAY_FLAG_USES_EMPTY_VERTEX_ARRAY,
+		ARRAY_FLAG_COMPRESS_UVS = RS::ARRAY_FLAG_COMPRESS_UVS,
 	};
 
 	virtual int get_surface_count() const;
@@ -209,11 +215,53 @@ public:
 		uint32_t max_convex_hulls = 1;
 		bool project_hull_vertices = true;
 	};
-	typedef Vector<Vector<Vector3>> (*ConvexDecompositionFunc)(const real_t *p_vertices, int p_vertex_count, const uint32_t *p_triangles, int p_triangle_count, const ConvexDecompositionSettings &p_settings, Vector<Vector<uint32_t>> *r_convex_indices);
+	/// Called from the thread running the decomposition, with the overall progress
+	/// in the 0-1 range. Returning false cancels the decomposition.
+	typedef bool (*ConvexDecompositionProgressFunc)(void *p_userdata, float p_progress);
+	typedef Vector<Vector<Vector3>> (*ConvexDecompositionFunc)(const real_t *p_vertices, int p_vertex_count, const uint32_t *p_triangles, int p_triangle_count, const ConvexDecompositionSettings &p_settings, Vector<Vector<uint32_t>> *r_convex_indices, ConvexDecompositionProgressFunc p_progress_func, void *p_progress_userdata);
 
 	static ConvexDecompositionFunc convex_decomposition_function;
 
-	Vector<Ref<Shape3D>> convex_decompose(const ConvexDecompositionSettings &p_settings) const;
+	/// Decomposed hulls keyed by a hash of the input geometry and settings, so
+	/// importers can skip VHACD for meshes that did not change since the last import.
+	class ConvexDecompositionCache {
+		Mutex mutex;
+		HashMap<String, Vector<Vector<Vector3>>> entries;
+		HashSet<String> used;
+
+	public:
+		static String make_key(const Vector<Vector3> &p_vertices, const Vector<uint32_t> &p_indices, const ConvexDecompositionSettings &p_settings);
+		bool lookup(const String &p_key, Vector<Vector<Vector3>> &r_hulls);
+		void store(const String &p_key, const Vector<Vector<Vector3>> &p_hulls);
+
+		Error load(const String &p_path);
+		// Only entries looked up or stored since loading are saved, so stale meshes drop out.
+		Error save(const String &p_path);
+	};
+
+	/// Runs a decomposition on the WorkerThreadPool. The geometry is gathered
+	/// when starting, so the mesh is only read from the calling thread.
+	struct ConvexDecompositionTask {
+		Vector<Vector3> vertices;
+		Vector<uint32_t> indices;
+		ConvexDecompositionSettings settings;
+		ConvexDecompositionCache *cache = nullptr;
+		SafeNumeric<float> progress;
+		SafeFlag cancelled;
+		Vector<Vector<Vector3>> hulls;
+		WorkerThreadPool::TaskID task_id = -1;
+
+		static void _run(void *p_task);
+	};
+
+	static Vector<Vector<Vector3>> decompose_convex_hulls(const Vector<Vector3> &p_vertices, const Vector<uint32_t> &p_indices, const ConvexDecompositionSettings &p_settings, ConvexDecompositionCache *p_cache = nullptr, ConvexDecompositionProgressFunc p_progress_func = nullptr, void *p_progress_userdata = nullptr);
+	static Vector<Ref<Shape3D>> make_convex_shapes(const Vector<Vector<Vector3>> &p_hulls);
+
+	Vector<Ref<Shape3D>> convex_decompose(const ConvexDecompositionSettings &p_settings, ConvexDecompositionCache *p_cache = nullptr) const;
+	Error convex_decompose_start(const ConvexDecompositionSettings &p_settings, ConvexDecompositionTask *r_task, ConvexDecompositionCache *p_cache = nullptr) const;
+	static bool convex_decompose_is_done(ConvexDecompositionTask *p_task);
+	// Waits for the task, returns no shapes if it was cancelled.
+	static Vector<Ref<Shape3D>> convex_decompose_finish(ConvexDecompositionTask *p_task);
 	Ref<ConvexPolygonShape3D> create_convex_shape(bool p_clean = true, bool p_simplify = false) const;
 	Ref<ConcavePolygonShape3D> create_trimesh_shape() const;
 
@@ -256,6 +304,14 @@ private:
 	_FORCE_INLINE_ void _create_if_empty() const;
 	void _recompute_aabb();
 
+	// Lightmap unwrapping is split so the unwrap itself can run on worker threads,
+	// while reading and rebuilding the surfaces stays on the calling thread.
+	struct LightmapUnwrap;
+	Error _lightmap_unwrap_prepare(const Transform3D &p_base_transform, LightmapUnwrap &r_unwrap) const;
+	static void _lightmap_unwrap_run(LightmapUnwrap &r_unwrap);
+	static void _lightmap_unwrap_task(void *p_userdata, uint32_t p_index);
+	Error _lightmap_unwrap_apply(LightmapUnwrap &r_unwrap, Vector<uint8_t> &r_dst_cache);
+
 protected:
 	virtual bool _is_generated() const { return false; }
 
@@ -317,6 +373,8 @@ public:
 
 	Error lightmap_unwrap(const Transform3D &p_base_transform = Transform3D(), float p_texel_size = 0.05);
 	Error lightmap_unwrap_cached(const Transform3D &p_base_transform, float p_texel_size, const Vector<uint8_t> &p_src_cache, Vector<uint8_t> &r_dst_cache, bool p_generate_cache = true);
+	// Unwraps independent meshes in parallel on the WorkerThreadPool, must be called from the main thread.
+	static void lightmap_unwrap_meshes(const Vector<Ref<ArrayMesh>> &p_meshes, const Transform3D &p_base_transform, float p_texel_size, Vector<Error> *r_errors = nullptr);
 
 	virtual void reload_from_file() override;
 
@@ -117,6 +117,7 @@ protected:
 	bool filter_walkable_low_height_spans = false;
 	AABB filter_baking_aabb;
 	Vector3 filter_baking_aabb_offset;
+	int tile_size = 0;
 
 public:
 	// Recast settings
@@ -192,6 +193,9 @@ public:
 	void set_filter_baking_aabb_offset(const Vector3 &p_aabb_offset);
 	Vector3 get_filter_baking_aabb_offset() const;
 
+	void set_tile_size(int p_value);
+	int get_tile_size() const;
+
 	void create_from_mesh(const Ref<Mesh> &p_mesh);
 
 	void set_vertices(const Vector<Vector3> &p_vertices);
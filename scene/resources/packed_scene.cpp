@@ -70,7 +70,39 @@ static Array _sanitize_node_pinned_properties(Node *p_node) {
 	return pinned;
 }
 
-Node *SceneState::instantiate(GenEditState p_edit_state) const {
+void SceneState::_build_setter_cache() const {
+	setter_cache.resize(nodes.size());
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		LocalVector<CachedSetter> &cache = setter_cache[i];
+		cache.clear();
+
+		// Only nodes created from a class by this scene have a known type.
+		if (n.type == TYPE_INSTANTIATED || n.instance >= 0 || (i == 0 && base_scene_idx >= 0) || n.type < 0 || n.type >= names.size()) {
+			continue;
+		}
+		const StringName &type = names[n.type];
+		if (!ClassDB::class_exists(type)) {
+			continue;
+		}
+		ClassDB::APIType api = ClassDB::get_api_type(type);
+		if (api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION) {
+			// Extension instances may intercept set() before ClassDB does.
+			continue;
+		}
+
+		cache.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			int name = n.properties[j].name;
+			if (name & FLAG_PATH_PROPERTY_IS_NODE || name >= names.size()) {
+				continue;
+			}
+			cache[j].setter = ClassDB::get_property_setter_bind(type, names[name], &cache[j].index);
+		}
+	}
+}
+
+Node *SceneState::instantiate(GenEditState p_edit_state, SafeNumeric<uint32_t> *r_progress, const SafeFlag *p_cancel) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
 
@@ -111,7 +143,27 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	// The editor relies on Object::set() flagging objects as edited, so it always takes the generic path.
+	bool use_setter_cache = !Engine::get_singleton()->is_editor_hint();
+	if (use_setter_cache && !setter_cache_valid.is_set()) {
+		MutexLock lock(setter_cache_mutex);
+		if (!setter_cache_valid.is_set()) {
+			_build_setter_cache();
+			setter_cache_valid.set();
+		}
+	}
+
 	for (int i = 0; i < nc; i++) {
+		if (p_cancel && i > 0 && p_cancel->is_set()) {
+			// Every node built so far is either part of the root subtree or a stray instance.
+			while (stray_instances.size()) {
+				memdelete(stray_instances.front()->get());
+				stray_instances.pop_front();
+			}
+			memdelete(ret_nodes[0]);
+			return nullptr;
+		}
+
 		const NodeData &n = nd[i];
 
 		Node *parent = nullptr;
@@ -136,6 +188,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 		Node *node = nullptr;
 		MissingNode *missing_node = nullptr;
+		const CachedSetter *cached_setters = nullptr;
 
 		if (i == 0 && base_scene_idx >= 0) {
 			//scene inheritance on root node
@@ -185,6 +238,10 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 			node = Object::cast_to<Node>(obj);
 
+			if (node && use_setter_cache && setter_cache[i].size()) {
+				cached_setters = setter_cache[i].ptr();
+			}
+
 			if (!node) {
 				if (obj) {
 					memdelete(obj);
@@ -328,7 +385,22 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							if (cached_setters && cached_setters[j].setter && !node->get_script_instance()) {
+								// Same call ClassDB::set_property() would end up doing.
+								const CachedSetter &cs = cached_setters[j];
+								Callable::CallError ce;
+								if (cs.index >= 0) {
+									Variant index = cs.index;
+									const Variant *args[2] = { &index, &value };
+									cs.setter->call(node, args, 2, ce);
+								} else {
+									const Variant *args[1] = { &value };
+									cs.setter->call(node, args, 1, ce);
+								}
+								valid = ce.error == Callable::CallError::CALL_OK;
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 					}
 				}
@@ -400,6 +472,10 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			NodePath n2 = ret_nodes[0]->get_path_to(node);
 			node_path_cache[n2] = i;
 		}
+
+		if (r_progress) {
+			r_progress->set(i + 1);
+		}
 	}
 
 	for (uint32_t i = 0; i < deferred_node_paths.size(); i++) {
@@ -995,6 +1071,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	setter_cache_valid.clear();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1184,6 +1261,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	setter_cache_valid.clear();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1650,6 +1729,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.index = p_index;
 
 	nodes.push_back(nd);
+	setter_cache_valid.clear();
 
 	return nodes.size() - 1;
 }
@@ -1666,6 +1746,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	}
 	prop.value = p_value;
 	nodes.write[p_node].properties.push_back(prop);
+	setter_cache_valid.clear();
 }
 
 void SceneState::add_node_group(int p_node, int p_group) {
@@ -1677,6 +1758,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
 	base_scene_idx = p_idx;
+	setter_cache_valid.clear();
 }
 
 void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method, int p_flags, int p_unbinds, const Vector<int> &p_binds) {
@@ -1794,27 +1876,126 @@ bool PackedScene::can_instantiate() const {
 	return state->can_instantiate();
 }
 
+static Node *_instantiate_state(const Ref<SceneState> &p_state, PackedScene::GenEditState p_edit_state, const String &p_scene_file_path, SafeNumeric<uint32_t> *r_progress = nullptr, const SafeFlag *p_cancel = nullptr) {
+	Node *s = p_state->instantiate((SceneState::GenEditState)p_edit_state, r_progress, p_cancel);
+	if (!s) {
+		return nullptr;
+	}
+
+	if (p_edit_state != PackedScene::GEN_EDIT_STATE_DISABLED) {
+		s->set_scene_instance_state(p_state);
+	}
+
+	if (!p_scene_file_path.is_empty()) {
+		s->set_scene_file_path(p_scene_file_path);
+	}
+
+	s->notification(Node::NOTIFICATION_SCENE_INSTANTIATED);
+
+	return s;
+}
+
 Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 #ifndef TOOLS_ENABLED
 	ERR_FAIL_COND_V_MSG(p_edit_state != GEN_EDIT_STATE_DISABLED, nullptr, "Edit state is only for editors, does not work without tools compiled.");
 #endif
 
-	Node *s = state->instantiate((SceneState::GenEditState)p_edit_state);
-	if (!s) {
-		return nullptr;
+	return _instantiate_state(state, p_edit_state, is_built_in() ? String() : get_path());
+}
+
+struct PackedScene::ThreadedInstance {
+	Ref<SceneState> state;
+	GenEditState edit_state = GEN_EDIT_STATE_DISABLED;
+	String scene_file_path;
+	WorkerThreadPool::TaskID task_id = 0;
+	SafeNumeric<uint32_t> progress;
+	uint32_t node_count = 0;
+	SafeFlag cancel;
+	Node *result = nullptr;
+};
+
+void PackedScene::_threaded_instantiate_func(void *p_userdata) {
+	ThreadedInstance *ti = static_cast<ThreadedInstance *>(p_userdata);
+	ti->result = _instantiate_state(ti->state, ti->edit_state, ti->scene_file_path, &ti->progress, &ti->cancel);
+}
+
+int64_t PackedScene::instantiate_threaded_request(GenEditState p_edit_state) const {
+#ifndef TOOLS_ENABLED
+	ERR_FAIL_COND_V_MSG(p_edit_state != GEN_EDIT_STATE_DISABLED, -1, "Edit state is only for editors, does not work without tools compiled.");
+#endif
+	ERR_FAIL_COND_V_MSG(!can_instantiate(), -1, "Scene has no nodes to instantiate.");
+
+	ThreadedInstance *ti = memnew(ThreadedInstance);
+	ti->state = state;
+	ti->edit_state = p_edit_state;
+	ti->scene_file_path = is_built_in() ? String() : get_path();
+	ti->node_count = state->get_node_count();
+
+	MutexLock lock(threaded_mutex);
+	int64_t id = ++last_threaded_id;
+	threaded_instances.insert(id, ti);
+	ti->task_id = WorkerThreadPool::get_singleton()->add_native_task(&PackedScene::_threaded_instantiate_func, ti, false, "Instantiate scene: " + get_path());
+	return id;
+}
+
+PackedScene::ThreadInstantiateStatus PackedScene::instantiate_threaded_get_status(int64_t p_task_id, Array r_progress) const {
+	MutexLock lock(threaded_mutex);
+	ThreadedInstance **tip = threaded_instances.getptr(p_task_id);
+	if (!tip) {
+		return THREAD_INSTANTIATE_INVALID_TASK;
 	}
+	ThreadedInstance *ti = *tip;
 
-	if (p_edit_state != GEN_EDIT_STATE_DISABLED) {
-		s->set_scene_instance_state(state);
+	r_progress.resize(1);
+	if (!WorkerThreadPool::get_singleton()->is_task_completed(ti->task_id)) {
+		r_progress[0] = ti->node_count ? float(ti->progress.get()) / ti->node_count : 0.0;
+		return THREAD_INSTANTIATE_IN_PROGRESS;
 	}
 
-	if (!is_built_in()) {
-		s->set_scene_file_path(get_path());
+	r_progress[0] = 1.0;
+	// Join the task so the result is visible to this thread.
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(ti->task_id);
+	ti->task_id = 0;
+	return ti->result ? THREAD_INSTANTIATE_DONE : THREAD_INSTANTIATE_FAILED;
+}
+
+Node *PackedScene::instantiate_threaded_get(int64_t p_task_id) const {
+	ThreadedInstance *ti = nullptr;
+	{
+		MutexLock lock(threaded_mutex);
+		ThreadedInstance **tip = threaded_instances.getptr(p_task_id);
+		ERR_FAIL_COND_V_MSG(!tip, nullptr, "Invalid threaded instantiation task ID: " + itos(p_task_id) + ".");
+		ti = *tip;
+		threaded_instances.erase(p_task_id);
 	}
 
-	s->notification(Node::NOTIFICATION_SCENE_INSTANTIATED);
+	if (ti->task_id != 0) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(ti->task_id);
+	}
+	Node *result = ti->result;
+	memdelete(ti);
+	return result;
+}
 
-	return s;
+void PackedScene::instantiate_threaded_cancel(int64_t p_task_id) const {
+	ThreadedInstance *ti = nullptr;
+	{
+		MutexLock lock(threaded_mutex);
+		ThreadedInstance **tip = threaded_instances.getptr(p_task_id);
+		ERR_FAIL_COND_MSG(!tip, "Invalid threaded instantiation task ID: " + itos(p_task_id) + ".");
+		ti = *tip;
+		threaded_instances.erase(p_task_id);
+	}
+
+	// The task checks the flag between nodes, so this only waits for the node being built.
+	ti->cancel.set();
+	if (ti->task_id != 0) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(ti->task_id);
+	}
+	if (ti->result) {
+		memdelete(ti->result);
+	}
+	memdelete(ti);
 }
 
 void PackedScene::replace_state(Ref<SceneState> p_by) {
@@ -1848,6 +2029,10 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_threaded_request", "edit_state"), &PackedScene::instantiate_threaded_request, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_threaded_get_status", "task_id", "progress"), &PackedScene::instantiate_threaded_get_status, DEFVAL(Array()));
+	ClassDB::bind_method(D_METHOD("instantiate_threaded_get", "task_id"), &PackedScene::instantiate_threaded_get);
+	ClassDB::bind_method(D_METHOD("instantiate_threaded_cancel", "task_id"), &PackedScene::instantiate_threaded_cancel);
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
@@ -1859,8 +2044,19 @@ void PackedScene::_bind_methods() {
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_INSTANCE);
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_MAIN);
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_MAIN_INHERITED);
+
+	BIND_ENUM_CONSTANT(THREAD_INSTANTIATE_INVALID_TASK);
+	BIND_ENUM_CONSTANT(THREAD_INSTANTIATE_IN_PROGRESS);
+	BIND_ENUM_CONSTANT(THREAD_INSTANTIATE_FAILED);
+	BIND_ENUM_CONSTANT(THREAD_INSTANTIATE_DONE);
 }
 
 PackedScene::PackedScene() {
 	state = Ref<SceneState>(memnew(SceneState));
 }
+
+PackedScene::~PackedScene() {
+	while (!threaded_instances.is_empty()) {
+		instantiate_threaded_cancel(threaded_instances.begin()->key);
+	}
+}
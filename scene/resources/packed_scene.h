@@ -32,6 +32,10 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -77,6 +81,19 @@ class SceneState : public RefCounted {
 
 	Vector<NodeData> nodes;
 
+	struct CachedSetter {
+		MethodBind *setter = nullptr;
+		int index = -1;
+	};
+
+	// Property setters of every node created by this scene, resolved once so
+	// repeated instantiation can skip the ClassDB lookups done by Object::set().
+	mutable Mutex setter_cache_mutex;
+	mutable SafeFlag setter_cache_valid;
+	mutable LocalVector<LocalVector<CachedSetter>> setter_cache;
+
+	void _build_setter_cache() const;
+
 	struct ConnectionData {
 		int from = 0;
 		int to = 0;
@@ -146,7 +163,7 @@ public:
 	Error copy_from(const Ref<SceneState> &p_scene_state);
 
 	bool can_instantiate() const;
-	Node *instantiate(GenEditState p_edit_state) const;
+	Node *instantiate(GenEditState p_edit_state, SafeNumeric<uint32_t> *r_progress = nullptr, const SafeFlag *p_cancel = nullptr) const;
 
 	Ref<SceneState> get_base_scene_state() const;
 
@@ -213,6 +230,14 @@ class PackedScene : public Resource {
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
+	struct ThreadedInstance;
+
+	mutable Mutex threaded_mutex;
+	mutable HashMap<int64_t, ThreadedInstance *> threaded_instances;
+	mutable int64_t last_threaded_id = 0;
+
+	static void _threaded_instantiate_func(void *p_userdata);
+
 protected:
 	virtual bool editor_can_reload_from_file() override { return false; } // this is handled by editor better
 	static void _bind_methods();
@@ -226,6 +251,13 @@ public:
 		GEN_EDIT_STATE_MAIN_INHERITED,
 	};
 
+	enum ThreadInstantiateStatus {
+		THREAD_INSTANTIATE_INVALID_TASK,
+		THREAD_INSTANTIATE_IN_PROGRESS,
+		THREAD_INSTANTIATE_FAILED,
+		THREAD_INSTANTIATE_DONE,
+	};
+
 	Error pack(Node *p_scene);
 
 	void clear();
@@ -233,6 +265,11 @@ public:
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
+	int64_t instantiate_threaded_request(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	ThreadInstantiateStatus instantiate_threaded_get_status(int64_t p_task_id, Array r_progress = Array()) const;
+	Node *instantiate_threaded_get(int64_t p_task_id) const;
+	void instantiate_threaded_cancel(int64_t p_task_id) const;
+
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
@@ -248,8 +285,10 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
+VARIANT_ENUM_CAST(PackedScene::ThreadInstantiateStatus)
 
 #endif // PACKED_SCENE_H
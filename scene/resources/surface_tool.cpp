@@ -30,7 +30,10 @@
 
 #include "surface_tool.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #define EQ_VERTEX_DIST 0.00001
+#define VERTEX_HASH_MIN_PARALLEL_SIZE 16384
 
 SurfaceTool::OptimizeVertexCacheFunc SurfaceTool::optimize_vertex_cache_func = nullptr;
 SurfaceTool::SimplifyFunc SurfaceTool::simplify_func = nullptr;
@@ -40,6 +43,8 @@ SurfaceTool::SimplifySloppyFunc SurfaceTool::simplify_sloppy_func = nullptr;
 SurfaceTool::GenerateRemapFunc SurfaceTool::generate_remap_func = nullptr;
 SurfaceTool::RemapVertexFunc SurfaceTool::remap_vertex_func = nullptr;
 SurfaceTool::RemapIndexFunc SurfaceTool::remap_index_func = nullptr;
+SurfaceTool::BuildMeshletsFunc SurfaceTool::build_meshlets_func = nullptr;
+SurfaceTool::BuildMeshletsBoundFunc SurfaceTool::build_meshlets_bound_func = nullptr;
 
 void SurfaceTool::strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32Array &r_indices) {
 	ERR_FAIL_COND_MSG(!generate_remap_func || !remap_vertex_func || !remap_index_func, "Meshoptimizer library is not initialized.");
@@ -723,28 +728,88 @@ Ref<ArrayMesh> SurfaceTool::commit(const Ref<ArrayMesh> &p_existing, uint32_t p_
 	return mesh;
 }
 
+struct SurfaceToolVertexHashes {
+	const SurfaceTool::Vertex *vertices = nullptr;
+	uint32_t *hashes = nullptr;
+};
+
+void SurfaceTool::_hash_vertex_task(void *p_userdata, uint32_t p_index) {
+	SurfaceToolVertexHashes *data = static_cast<SurfaceToolVertexHashes *>(p_userdata);
+	data->hashes[p_index] = SurfaceTool::VertexHasher::hash(data->vertices[p_index]);
+}
+
+uint32_t SurfaceTool::_deduplicate_vertices(const LocalVector<Vertex> &p_vertices, LocalVector<int> &r_remap) {
+	// Maps every vertex to the first identical one, numbered in order of first appearance.
+	// Hashes are computed up front (in parallel for large arrays), so the table only compares
+	// full vertices when their hashes match.
+	const uint32_t vertex_count = p_vertices.size();
+	r_remap.resize(vertex_count);
+	if (vertex_count == 0) {
+		return 0;
+	}
+
+	LocalVector<uint32_t> hashes;
+	hashes.resize(vertex_count);
+
+	SurfaceToolVertexHashes hash_data;
+	hash_data.vertices = p_vertices.ptr();
+	hash_data.hashes = hashes.ptr();
+	if (vertex_count >= VERTEX_HASH_MIN_PARALLEL_SIZE) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(_hash_vertex_task, &hash_data, vertex_count, -1, true, SNAME("SurfaceToolHashVertices"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < vertex_count; i++) {
+			_hash_vertex_task(&hash_data, i);
+		}
+	}
+
+	// Open addressing table holding the first vertex of each unique group.
+	const uint32_t table_size = next_power_of_2(vertex_count * 2);
+	const uint32_t table_mask = table_size - 1;
+	LocalVector<uint32_t> table;
+	table.resize(table_size);
+	memset(table.ptr(), 0xFF, table_size * sizeof(uint32_t));
+
+	uint32_t unique_count = 0;
+	for (uint32_t i = 0; i < vertex_count; i++) {
+		const uint32_t h = hashes[i];
+		uint32_t slot = h & table_mask;
+		while (true) {
+			const uint32_t first = table[slot];
+			if (first == UINT32_MAX) {
+				table[slot] = i;
+				r_remap[i] = unique_count++;
+				break;
+			}
+			if (hashes[first] == h && p_vertices[first] == p_vertices[i]) {
+				r_remap[i] = r_remap[first];
+				break;
+			}
+			slot = (slot + 1) & table_mask;
+		}
+	}
+
+	return unique_count;
+}
+
 void SurfaceTool::index() {
 	if (index_array.size()) {
 		return; //already indexed
 	}
 
-	HashMap<Vertex, int, VertexHasher> indices;
-	LocalVector<Vertex> old_vertex_array = vertex_array;
-	vertex_array.clear();
+	_deduplicate_vertices(vertex_array, index_array);
 
-	for (uint32_t i = 0; i < old_vertex_array.size(); i++) {
-		int *idxptr = indices.getptr(old_vertex_array[i]);
-		int idx;
-		if (!idxptr) {
-			idx = indices.size();
-			vertex_array.push_back(old_vertex_array[i]);
-			indices[old_vertex_array[i]] = idx;
-		} else {
-			idx = *idxptr;
+	// Unique vertices are numbered in order of first appearance, so they can be compacted in place.
+	uint32_t unique_count = 0;
+	for (uint32_t i = 0; i < vertex_array.size(); i++) {
+		if (uint32_t(index_array[i]) == unique_count) {
+			if (unique_count != i) {
+				vertex_array[unique_count] = vertex_array[i];
+			}
+			unique_count++;
 		}
-
-		index_array.push_back(idx);
 	}
+	vertex_array.resize(unique_count);
 
 	format |= Mesh::ARRAY_FORMAT_INDEX;
 }
@@ -1154,7 +1219,14 @@ void SurfaceTool::generate_normals(bool p_flip) {
 
 	ERR_FAIL_COND((vertex_array.size() % 3) != 0);
 
-	HashMap<Vertex, Vector3, VertexHasher> vertex_hash;
+	LocalVector<int> vertex_ids;
+	uint32_t unique_count = _deduplicate_vertices(vertex_array, vertex_ids);
+
+	LocalVector<Vector3> normals;
+	normals.resize(unique_count);
+	for (uint32_t i = 0; i < unique_count; i++) {
+		normals[i] = Vector3();
+	}
 
 	for (uint32_t vi = 0; vi < vertex_array.size(); vi += 3) {
 		Vertex *v = &vertex_array[vi];
@@ -1167,22 +1239,12 @@ void SurfaceTool::generate_normals(bool p_flip) {
 		}
 
 		for (int i = 0; i < 3; i++) {
-			Vector3 *lv = vertex_hash.getptr(v[i]);
-			if (!lv) {
-				vertex_hash.insert(v[i], normal);
-			} else {
-				(*lv) += normal;
-			}
+			normals[vertex_ids[vi + i]] += normal;
 		}
 	}
 
 	for (uint32_t vi = 0; vi < vertex_array.size(); vi++) {
-		Vector3 *lv = vertex_hash.getptr(vertex_array[vi]);
-		if (!lv) {
-			vertex_array[vi].normal = Vector3();
-		} else {
-			vertex_array[vi].normal = lv->normalized();
-		}
+		vertex_array[vi].normal = normals[vertex_ids[vi]].normalized();
 	}
 
 	format |= Mesh::ARRAY_FORMAT_NORMAL;
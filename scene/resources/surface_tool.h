@@ -90,6 +90,16 @@ public:
 	static RemapVertexFunc remap_vertex_func;
 	typedef void (*RemapIndexFunc)(unsigned int *destination, const unsigned int *indices, size_t index_count, const unsigned int *remap);
 	static RemapIndexFunc remap_index_func;
+	struct Meshlet {
+		uint32_t vertex_offset;
+		uint32_t triangle_offset;
+		uint32_t vertex_count;
+		uint32_t triangle_count;
+	};
+	typedef size_t (*BuildMeshletsFunc)(Meshlet *r_meshlets, unsigned int *r_meshlet_vertices, unsigned char *r_meshlet_triangles, const unsigned int *indices, size_t index_count, const float *vertex_positions, size_t vertex_count, size_t vertex_positions_stride, size_t max_vertices, size_t max_triangles, float cone_weight);
+	static BuildMeshletsFunc build_meshlets_func;
+	typedef size_t (*BuildMeshletsBoundFunc)(size_t index_count, size_t max_vertices, size_t max_triangles);
+	static BuildMeshletsBoundFunc build_meshlets_bound_func;
 	static void strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32Array &r_indices);
 
 private:
@@ -135,6 +145,9 @@ private:
 
 	CustomFormat last_custom_format[RS::ARRAY_CUSTOM_COUNT];
 
+	static void _hash_vertex_task(void *p_userdata, uint32_t p_index);
+	static uint32_t _deduplicate_vertices(const LocalVector<Vertex> &p_vertices, LocalVector<int> &r_remap);
+
 	void _create_list_from_arrays(Array arr, LocalVector<Vertex> *r_vertex, LocalVector<int> *r_index, uint32_t &lformat);
 	void _create_list(const Ref<Mesh> &p_existing, int p_surface, LocalVector<Vertex> *r_vertex, LocalVector<int> *r_index, uint32_t &lformat);
 
@@ -52,16 +52,75 @@ Dictionary SyntaxHighlighter::get_line_syntax_highlighting(int p_line) {
 }
 
 void SyntaxHighlighter::_lines_edited_from(int p_from_line, int p_to_line) {
+	bool tracks_line_state = _lines_edited(p_from_line, p_to_line);
+
 	if (highlighting_cache.size() < 1) {
 		return;
 	}
 
-	int cache_size = highlighting_cache.back()->key();
-	for (int i = MIN(p_from_line, p_to_line) - 1; i <= cache_size; i++) {
-		if (highlighting_cache.has(i)) {
+	int first_line = MIN(p_from_line, p_to_line) - 1;
+	if (!tracks_line_state) {
+		int cache_size = highlighting_cache.back()->key();
+		for (int i = first_line; i <= cache_size; i++) {
+			if (highlighting_cache.has(i)) {
+				highlighting_cache.erase(i);
+			}
+		}
+		return;
+	}
+
+	// Only the edited lines need to be highlighted again, the lines below move with the edit.
+	int line_offset = p_to_line - p_from_line;
+	if (line_offset == 0) {
+		for (int i = first_line; i <= p_from_line; i++) {
 			highlighting_cache.erase(i);
 		}
+		return;
+	}
+
+	RBMap<int, Dictionary> shifted_cache;
+	for (const KeyValue<int, Dictionary> &E : highlighting_cache) {
+		if (E.key < first_line) {
+			shifted_cache.insert(E.key, E.value);
+		} else if (E.key > p_from_line) {
+			shifted_cache.insert(E.key + line_offset, E.value);
+		}
+	}
+	highlighting_cache = shifted_cache;
+}
+
+void SyntaxHighlighter::_invalidate_lines_after(int p_line) {
+	RBMap<int, Dictionary>::Element *E = highlighting_cache.find_closest(p_line);
+	E = E ? E->next() : highlighting_cache.front();
+	while (E) {
+		RBMap<int, Dictionary>::Element *N = E->next();
+		highlighting_cache.erase(E);
+		E = N;
+	}
+}
+
+void SyntaxHighlighter::_shift_line_states(HashMap<int, int> &r_states, int p_from_line, int p_to_line) {
+	int line_offset = p_to_line - p_from_line;
+	if (line_offset == 0) {
+		return;
+	}
+
+	// The last line of the edit ends like the edited line did, lines removed by the edit are dropped.
+	// States are kept for the edited lines, to compare them once highlighted again.
+	HashMap<int, int> shifted_states;
+	for (const KeyValue<int, int> &E : r_states) {
+		if (E.key < MIN(p_from_line, p_to_line)) {
+			shifted_states[E.key] = E.value;
+		} else if (E.key == p_from_line) {
+			shifted_states[p_to_line] = E.value;
+			if (line_offset > 0) {
+				shifted_states[p_from_line] = E.value;
+			}
+		} else if (E.key > p_from_line) {
+			shifted_states[E.key + line_offset] = E.value;
+		}
 	}
+	r_states = shifted_states;
 }
 
 void SyntaxHighlighter::clear_highlighting_cache() {
@@ -129,17 +188,20 @@ Dictionary CodeHighlighter::_get_line_syntax_highlighting_impl(int p_line) {
 	Color keyword_color;
 	Color color;
 
+	const int *prev_line_state = color_region_cache.getptr(p_line);
+	const int prev_region = prev_line_state ? *prev_line_state : -2;
+
 	color_region_cache[p_line] = -1;
 	int in_region = -1;
 	if (p_line != 0) {
 		int prev_region_line = p_line - 1;
-		while (prev_region_line > 0 && !color_region_cache.has(prev_region_line)) {
+		while (prev_region_line > 0 && !_is_line_highlighted(prev_region_line)) {
 			prev_region_line--;
 		}
 		for (int i = prev_region_line; i < p_line - 1; i++) {
 			get_line_syntax_highlighting(i);
 		}
-		if (!color_region_cache.has(p_line - 1)) {
+		if (!_is_line_highlighted(p_line - 1)) {
 			get_line_syntax_highlighting(p_line - 1);
 		}
 		in_region = color_region_cache[p_line - 1];
@@ -411,9 +473,19 @@ Dictionary CodeHighlighter::_get_line_syntax_highlighting_impl(int p_line) {
 		}
 	}
 
+	if (color_region_cache[p_line] != prev_region) {
+		// The following lines start in a different region now.
+		_invalidate_lines_after(p_line);
+	}
+
 	return color_map;
 }
 
+bool CodeHighlighter::_lines_edited(int p_from_line, int p_to_line) {
+	_shift_line_states(color_region_cache, p_from_line, p_to_line);
+	return true;
+}
+
 void CodeHighlighter::_clear_highlighting_cache() {
 	color_region_cache.clear();
 }
@@ -50,6 +50,13 @@ protected:
 
 	static void _bind_methods();
 
+	// Highlighters carrying state from one line to the next override this to keep it in sync with the edit and return true.
+	// Only the edited lines are highlighted again then, and the highlighter calls _invalidate_lines_after() when the state of a line changes.
+	virtual bool _lines_edited(int p_from_line, int p_to_line) { return false; }
+	bool _is_line_highlighted(int p_line) const { return highlighting_cache.has(p_line); }
+	void _invalidate_lines_after(int p_line);
+	static void _shift_line_states(HashMap<int, int> &r_states, int p_from_line, int p_to_line);
+
 	GDVIRTUAL1RC(Dictionary, _get_line_syntax_highlighting, int)
 	GDVIRTUAL0(_clear_highlighting_cache)
 	GDVIRTUAL0(_update_cache)
@@ -85,6 +92,8 @@ private:
 	Vector<ColorRegion> color_regions;
 	HashMap<int, int> color_region_cache;
 
+	virtual bool _lines_edited(int p_from_line, int p_to_line) override;
+
 	Dictionary keywords;
 	Dictionary member_keywords;
 
@@ -30,6 +30,8 @@
 
 #include "texture.h"
 
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
 #include "core/core_string_names.h"
 #include "core/io/image_loader.h"
 #include "core/io/marshalls.h"
@@ -658,7 +660,7 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			uint32_t size = f->get_32();
 
-			if (p_size_limit > 0 && i < (mipmaps - 1) && (sw > p_size_limit || sh > p_size_limit)) {
+			if (p_size_limit > 0 && i < mipmaps && (sw > p_size_limit || sh > p_size_limit)) {
 				//can't load this due to size limit
 				sw = MAX(sw >> 1, 1);
 				sh = MAX(sh >> 1, 1);
@@ -731,24 +733,24 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				}
 			}
 
-			image->set_data(w, h, true, mipmap_images[0]->get_format(), img_data);
+			image->set_data(mipmap_images[0]->get_width(), mipmap_images[0]->get_height(), true, mipmap_images[0]->get_format(), img_data);
 			return image;
 		}
 
 	} else if (data_format == DATA_FORMAT_IMAGE) {
 		int size = Image::get_image_data_size(w, h, format, mipmaps ? true : false);
+		uint64_t data_start = f->get_position();
 
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
-				if (ofs) {
-					f->seek(f->get_position() + ofs);
-				}
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
 				continue; //oops, size limit enforced, go to next
 			}
 
+			f->seek(data_start + ofs);
+
 			Vector<uint8_t> data;
 			data.resize(size - ofs);
 
@@ -803,9 +805,7 @@ Image::Format CompressedTexture2D::get_format() const {
 	return format;
 }
 
-Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit) {
-	alpha_cache.unref();
-
+Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit, bool *r_streamed) {
 	ERR_FAIL_COND_V(image.is_null(), ERR_INVALID_PARAMETER);
 
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
@@ -849,6 +849,9 @@ Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r
 	if (!(df & FORMAT_BIT_STREAM)) {
 		p_size_limit = 0;
 	}
+	if (r_streamed) {
+		*r_streamed = p_size_limit > 0;
+	}
 
 	image = load_image_from_file(f, p_size_limit);
 
@@ -869,7 +872,17 @@ Error CompressedTexture2D::load(const String &p_path) {
 	bool request_roughness;
 	int mipmap_limit;
 
-	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit);
+	// Streamed textures start small, the renderer requests larger mipmaps as they get close to the camera.
+	int size_limit = 0;
+	if (GLOBAL_GET("rendering/textures/streaming/enabled") && !Engine::get_singleton()->is_editor_hint()) {
+		size_limit = MAX(1, int(GLOBAL_GET("rendering/textures/streaming/initial_size")));
+	}
+	bool stream = false;
+
+	_stop_streaming();
+	alpha_cache.unref();
+
+	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, size_limit, &stream);
 	if (err) {
 		return err;
 	}
@@ -894,6 +907,15 @@ Error CompressedTexture2D::load(const String &p_path) {
 		RenderingServer::get_singleton()->texture_set_path(texture, p_path);
 	}
 
+	if (stream) {
+		MutexLock lock(stream_mutex);
+		streamed = true;
+		stream_closing = false;
+		stream_requested_size = size_limit;
+		stream_loaded_size = size_limit;
+		RS::get_singleton()->texture_set_stream_callback(texture, _requested_stream, this);
+	}
+
 #ifdef TOOLS_ENABLED
 
 	if (request_3d) {
@@ -1039,7 +1061,88 @@ void CompressedTexture2D::_bind_methods() {
 
 CompressedTexture2D::CompressedTexture2D() {}
 
+void CompressedTexture2D::_requested_stream(void *p_ud, int p_size) {
+	CompressedTexture2D *ct = (CompressedTexture2D *)p_ud;
+
+	MutexLock lock(ct->stream_mutex);
+	if (ct->stream_closing) {
+		return;
+	}
+	ct->stream_requested_size = p_size;
+	if (ct->stream_task_running) {
+		return; // The running task picks up the new size when done.
+	}
+	if (p_size == ct->stream_loaded_size) {
+		return;
+	}
+	if (ct->stream_task != WorkerThreadPool::INVALID_TASK_ID) {
+		// Finished, only needs to be released.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(ct->stream_task);
+	}
+	ct->stream_task_running = true;
+	ct->stream_task = WorkerThreadPool::get_singleton()->add_native_task(&CompressedTexture2D::_stream_task, ct, false, "Stream texture mipmaps");
+}
+
+void CompressedTexture2D::_stream_task(void *p_ud) {
+	CompressedTexture2D *ct = (CompressedTexture2D *)p_ud;
+
+	while (true) {
+		int size;
+		{
+			MutexLock lock(ct->stream_mutex);
+			size = ct->stream_requested_size;
+			if (ct->stream_closing || size == ct->stream_loaded_size) {
+				ct->stream_task_running = false;
+				return;
+			}
+		}
+
+		int lw, lh, mipmap_limit;
+		bool request_3d, request_normal, request_roughness;
+		Ref<Image> image;
+		image.instantiate();
+		Error err = ct->_load_data(ct->path_to_file, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, size);
+
+		{
+			MutexLock lock(ct->stream_mutex);
+			if (ct->stream_closing) {
+				ct->stream_task_running = false;
+				return;
+			}
+			ct->stream_loaded_size = size;
+		}
+
+		ERR_CONTINUE_MSG(err != OK, vformat("Unable to stream texture mipmaps from: %s.", ct->path_to_file));
+
+		RID new_texture = RS::get_singleton()->texture_2d_create(image);
+		RS::get_singleton()->texture_replace(ct->texture, new_texture);
+		RS::get_singleton()->texture_set_size_override(ct->texture, lw, lh);
+	}
+}
+
+void CompressedTexture2D::_stop_streaming() {
+	WorkerThreadPool::TaskID task;
+	{
+		MutexLock lock(stream_mutex);
+		if (!streamed) {
+			return;
+		}
+		streamed = false;
+		stream_closing = true;
+		task = stream_task;
+		stream_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+
+	if (texture.is_valid()) {
+		RS::get_singleton()->texture_set_stream_callback(texture, nullptr, nullptr);
+	}
+	if (task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+	}
+}
+
 CompressedTexture2D::~CompressedTexture2D() {
+	_stop_streaming();
 	if (texture.is_valid()) {
 		RS::get_singleton()->free(texture);
 	}
@@ -35,6 +35,7 @@
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/math/rect2.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 #include "core/os/rw_lock.h"
 #include "core/os/thread_safe.h"
@@ -235,7 +236,7 @@ public:
 	};
 
 private:
-	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0);
+	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0, bool *r_streamed = nullptr);
 	String path_to_file;
 	mutable RID texture;
 	Image::Format format = Image::FORMAT_L8;
@@ -243,6 +244,19 @@ private:
 	int h = 0;
 	mutable Ref<BitMap> alpha_cache;
 
+	// Mipmap streaming, sizes are the largest dimension resident (0 for full size).
+	Mutex stream_mutex;
+	bool streamed = false;
+	bool stream_closing = false;
+	bool stream_task_running = false;
+	int stream_requested_size = 0;
+	int stream_loaded_size = 0;
+	WorkerThreadPool::TaskID stream_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	static void _requested_stream(void *p_ud, int p_size);
+	static void _stream_task(void *p_ud);
+	void _stop_streaming();
+
 	virtual void reload_from_file() override;
 
 	static void _requested_3d(void *p_ud);
@@ -1525,6 +1525,11 @@ Vector<String> Theme::_get_type_list() const {
 
 // Theme bulk manipulations.
 void Theme::_emit_theme_changed(bool p_notify_list_changed) {
+	// Resolved lookups may point at items of this theme, even while change propagation is frozen.
+	if (ThemeDB::get_singleton()) {
+		ThemeDB::get_singleton()->invalidate_theme_lookups();
+	}
+
 	if (no_change_propagation) {
 		return;
 	}
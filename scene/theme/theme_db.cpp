@@ -103,6 +103,7 @@ void ThemeDB::initialize_theme_noproject() {
 
 void ThemeDB::set_default_theme(const Ref<Theme> &p_default) {
 	default_theme = p_default;
+	invalidate_theme_lookups();
 }
 
 Ref<Theme> ThemeDB::get_default_theme() {
@@ -111,6 +112,7 @@ Ref<Theme> ThemeDB::get_default_theme() {
 
 void ThemeDB::set_project_theme(const Ref<Theme> &p_project_default) {
 	project_theme = p_project_default;
+	invalidate_theme_lookups();
 }
 
 Ref<Theme> ThemeDB::get_project_theme() {
@@ -125,6 +127,7 @@ void ThemeDB::set_fallback_base_scale(float p_base_scale) {
 	}
 
 	fallback_base_scale = p_base_scale;
+	invalidate_theme_lookups();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -138,6 +141,7 @@ void ThemeDB::set_fallback_font(const Ref<Font> &p_font) {
 	}
 
 	fallback_font = p_font;
+	invalidate_theme_lookups();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -151,6 +155,7 @@ void ThemeDB::set_fallback_font_size(int p_font_size) {
 	}
 
 	fallback_font_size = p_font_size;
+	invalidate_theme_lookups();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -164,6 +169,7 @@ void ThemeDB::set_fallback_icon(const Ref<Texture2D> &p_icon) {
 	}
 
 	fallback_icon = p_icon;
+	invalidate_theme_lookups();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -177,6 +183,7 @@ void ThemeDB::set_fallback_stylebox(const Ref<StyleBox> &p_stylebox) {
 	}
 
 	fallback_stylebox = p_stylebox;
+	invalidate_theme_lookups();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -184,6 +191,29 @@ Ref<StyleBox> ThemeDB::get_fallback_stylebox() {
 	return fallback_stylebox;
 }
 
+// Theme lookup cache.
+void ThemeDB::invalidate_theme_lookups() {
+	theme_lookup_version++;
+}
+
+ThemeDB::ThemeLookup &ThemeDB::get_theme_lookup(const ThemeLookupKey &p_key) {
+	if (theme_lookup_cache_version != theme_lookup_version) {
+		theme_lookup_cache.clear();
+		theme_lookup_cache_version = theme_lookup_version;
+	}
+
+	ThemeLookup *lookup = theme_lookup_cache.getptr(p_key);
+	if (lookup) {
+		return *lookup;
+	}
+
+	// Owners come and go without telling the cache, so keep it from growing without bounds.
+	if (theme_lookup_cache.size() >= THEME_LOOKUP_CACHE_MAX_SIZE) {
+		theme_lookup_cache.clear();
+	}
+	return theme_lookup_cache.insert(p_key, ThemeLookup())->value;
+}
+
 // Object methods.
 void ThemeDB::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_default_theme"), &ThemeDB::get_default_theme);
@@ -226,6 +256,7 @@ ThemeDB::ThemeDB() {
 }
 
 ThemeDB::~ThemeDB() {
+	theme_lookup_cache.clear();
 	default_theme.unref();
 	project_theme.unref();
 
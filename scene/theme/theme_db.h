@@ -33,17 +33,51 @@
 
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
-
-class Font;
-class StyleBox;
-class Texture2D;
-class Theme;
+#include "scene/resources/theme.h"
 
 class ThemeDB : public Object {
 	GDCLASS(ThemeDB, Object);
 
+public:
+	// Theme items resolved through a theme owner chain. They are shared by every node with the same theme owner
+	// and theme types, so that many controls of the same kind only walk the chain once.
+	struct ThemeLookupKey {
+		ObjectID owner;
+		StringName theme_type;
+		StringName type_variation;
+
+		static uint32_t hash(const ThemeLookupKey &p_key) {
+			uint32_t h = hash_murmur3_one_64(p_key.owner);
+			h = hash_murmur3_one_32(p_key.theme_type.hash(), h);
+			h = hash_murmur3_one_32(p_key.type_variation.hash(), h);
+			return hash_fmix32(h);
+		}
+		bool operator==(const ThemeLookupKey &p_key) const {
+			return owner == p_key.owner && theme_type == p_key.theme_type && type_variation == p_key.type_variation;
+		}
+	};
+
+	struct ThemeLookupItem {
+		Variant value;
+		bool found = false;
+	};
+
+	struct ThemeLookup {
+		bool theme_types_resolved = false;
+		List<StringName> theme_types;
+		HashMap<StringName, ThemeLookupItem> items[Theme::DATA_TYPE_MAX];
+	};
+
+	static constexpr uint32_t THEME_LOOKUP_CACHE_MAX_SIZE = 4096;
+
+private:
 	static ThemeDB *singleton;
 
+	// The cache is dropped as a whole the next time it is used after anything it depends on changed.
+	HashMap<ThemeLookupKey, ThemeLookup, ThemeLookupKey> theme_lookup_cache;
+	uint64_t theme_lookup_version = 1;
+	uint64_t theme_lookup_cache_version = 1;
+
 	// Universal Theme resources used when no other theme has the item.
 	Ref<Theme> default_theme;
 	Ref<Theme> project_theme;
@@ -87,6 +121,11 @@ public:
 	void set_fallback_stylebox(const Ref<StyleBox> &p_stylebox);
 	Ref<StyleBox> get_fallback_stylebox();
 
+	// Theme lookup cache.
+
+	void invalidate_theme_lookups();
+	ThemeLookup &get_theme_lookup(const ThemeLookupKey &p_key);
+
 	static ThemeDB *get_singleton();
 	ThemeDB();
 	~ThemeDB();
@@ -78,10 +78,12 @@ void ThemeOwner::assign_theme_on_parented(Node *p_for_node) {
 
 	Control *parent_c = Object::cast_to<Control>(parent);
 	if (parent_c && parent_c->has_theme_owner_node()) {
+		ThemeDB::get_singleton()->invalidate_theme_lookups();
 		propagate_theme_changed(p_for_node, parent_c->get_theme_owner_node(), false, true);
 	} else {
 		Window *parent_w = Object::cast_to<Window>(parent);
 		if (parent_w && parent_w->has_theme_owner_node()) {
+			ThemeDB::get_singleton()->invalidate_theme_lookups();
 			propagate_theme_changed(p_for_node, parent_w->get_theme_owner_node(), false, true);
 		}
 	}
@@ -96,10 +98,12 @@ void ThemeOwner::clear_theme_on_unparented(Node *p_for_node) {
 
 	Control *parent_c = Object::cast_to<Control>(parent);
 	if (parent_c && parent_c->has_theme_owner_node()) {
+		ThemeDB::get_singleton()->invalidate_theme_lookups();
 		propagate_theme_changed(p_for_node, nullptr, false, true);
 	} else {
 		Window *parent_w = Object::cast_to<Window>(parent);
 		if (parent_w && parent_w->has_theme_owner_node()) {
+			ThemeDB::get_singleton()->invalidate_theme_lookups();
 			propagate_theme_changed(p_for_node, nullptr, false, true);
 		}
 	}
@@ -195,29 +199,32 @@ Node *ThemeOwner::_get_next_owner_node(Node *p_from_node) const {
 	return nullptr;
 }
 
-Variant ThemeOwner::get_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types) {
-	ERR_FAIL_COND_V_MSG(p_theme_types.size() == 0, Variant(), "At least one theme type must be specified.");
+bool ThemeOwner::_find_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types, Variant &r_value) {
+	ERR_FAIL_COND_V_MSG(p_theme_types.size() == 0, false, "At least one theme type must be specified.");
 
 	// First, look through each control or window node in the branch, until no valid parent can be found.
 	// Only nodes with a theme resource attached are considered.
 	Node *owner_node = get_owner_node();
 
 	while (owner_node) {
-		// For each theme resource check the theme types provided and see if p_name exists with any of them.
-		for (const StringName &E : p_theme_types) {
-			Ref<Theme> owner_theme;
+		Ref<Theme> owner_theme;
 
-			Control *owner_c = Object::cast_to<Control>(owner_node);
-			if (owner_c) {
-				owner_theme = owner_c->get_theme();
-			}
-			Window *owner_w = Object::cast_to<Window>(owner_node);
-			if (owner_w) {
-				owner_theme = owner_w->get_theme();
-			}
+		Control *owner_c = Object::cast_to<Control>(owner_node);
+		if (owner_c) {
+			owner_theme = owner_c->get_theme();
+		}
+		Window *owner_w = Object::cast_to<Window>(owner_node);
+		if (owner_w) {
+			owner_theme = owner_w->get_theme();
+		}
 
-			if (owner_theme.is_valid() && owner_theme->has_theme_item(p_data_type, p_name, E)) {
-				return owner_theme->get_theme_item(p_data_type, p_name, E);
+		// For each theme resource check the theme types provided and see if p_name exists with any of them.
+		if (owner_theme.is_valid()) {
+			for (const StringName &E : p_theme_types) {
+				if (owner_theme->has_theme_item(p_data_type, p_name, E)) {
+					r_value = owner_theme->get_theme_item(p_data_type, p_name, E);
+					return true;
+				}
 			}
 		}
 
@@ -225,71 +232,101 @@ Variant ThemeOwner::get_theme_item_in_types(Theme::DataType p_data_type, const S
 	}
 
 	// Secondly, check the project-defined Theme resource.
-	if (ThemeDB::get_singleton()->get_project_theme().is_valid()) {
+	Ref<Theme> project_theme = ThemeDB::get_singleton()->get_project_theme();
+	if (project_theme.is_valid()) {
 		for (const StringName &E : p_theme_types) {
-			if (ThemeDB::get_singleton()->get_project_theme()->has_theme_item(p_data_type, p_name, E)) {
-				return ThemeDB::get_singleton()->get_project_theme()->get_theme_item(p_data_type, p_name, E);
+			if (project_theme->has_theme_item(p_data_type, p_name, E)) {
+				r_value = project_theme->get_theme_item(p_data_type, p_name, E);
+				return true;
 			}
 		}
 	}
 
 	// Lastly, fall back on the items defined in the default Theme, if they exist.
+	Ref<Theme> default_theme = ThemeDB::get_singleton()->get_default_theme();
 	for (const StringName &E : p_theme_types) {
-		if (ThemeDB::get_singleton()->get_default_theme()->has_theme_item(p_data_type, p_name, E)) {
-			return ThemeDB::get_singleton()->get_default_theme()->get_theme_item(p_data_type, p_name, E);
+		if (default_theme->has_theme_item(p_data_type, p_name, E)) {
+			r_value = default_theme->get_theme_item(p_data_type, p_name, E);
+			return true;
 		}
 	}
 
 	// If they don't exist, use any type to return the default/empty value.
-	return ThemeDB::get_singleton()->get_default_theme()->get_theme_item(p_data_type, p_name, p_theme_types[0]);
+	r_value = default_theme->get_theme_item(p_data_type, p_name, p_theme_types.front()->get());
+	return false;
 }
 
-bool ThemeOwner::has_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types) {
-	ERR_FAIL_COND_V_MSG(p_theme_types.size() == 0, false, "At least one theme type must be specified.");
+ThemeDB::ThemeLookup &ThemeOwner::_get_theme_lookup(const Node *p_for_node, const StringName &p_theme_type) {
+	// Nodes sharing the theme owner and the resolved theme types see exactly the same items,
+	// so the key is normalized the same way as in get_theme_type_dependencies().
+	StringName type_variation;
+	const Control *for_c = Object::cast_to<Control>(p_for_node);
+	if (for_c) {
+		type_variation = for_c->get_theme_type_variation();
+	} else {
+		const Window *for_w = Object::cast_to<Window>(p_for_node);
+		if (for_w) {
+			type_variation = for_w->get_theme_type_variation();
+		}
+	}
 
-	// First, look through each control or window node in the branch, until no valid parent can be found.
-	// Only nodes with a theme resource attached are considered.
+	ThemeDB::ThemeLookupKey key;
 	Node *owner_node = get_owner_node();
+	if (owner_node) {
+		key.owner = owner_node->get_instance_id();
+	}
+	if (p_theme_type == StringName() || p_theme_type == p_for_node->get_class_name() || p_theme_type == type_variation) {
+		key.theme_type = p_for_node->get_class_name();
+		key.type_variation = type_variation;
+	} else {
+		key.theme_type = p_theme_type;
+	}
 
-	while (owner_node) {
-		// For each theme resource check the theme types provided and see if p_name exists with any of them.
-		for (const StringName &E : p_theme_types) {
-			Ref<Theme> owner_theme;
+	ThemeDB::ThemeLookup &lookup = ThemeDB::get_singleton()->get_theme_lookup(key);
+	if (!lookup.theme_types_resolved) {
+		get_theme_type_dependencies(p_for_node, p_theme_type, &lookup.theme_types);
+		lookup.theme_types_resolved = true;
+	}
+	return lookup;
+}
 
-			Control *owner_c = Object::cast_to<Control>(owner_node);
-			if (owner_c) {
-				owner_theme = owner_c->get_theme();
-			}
-			Window *owner_w = Object::cast_to<Window>(owner_node);
-			if (owner_w) {
-				owner_theme = owner_w->get_theme();
-			}
+Variant ThemeOwner::get_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types) {
+	ERR_FAIL_COND_V_MSG(p_theme_types.size() == 0, Variant(), "At least one theme type must be specified.");
 
-			if (owner_theme.is_valid() && owner_theme->has_theme_item(p_data_type, p_name, E)) {
-				return true;
-			}
-		}
+	Variant value;
+	_find_theme_item_in_types(p_data_type, p_name, p_theme_types, value);
+	return value;
+}
 
-		owner_node = _get_next_owner_node(owner_node);
-	}
+bool ThemeOwner::has_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types) {
+	ERR_FAIL_COND_V_MSG(p_theme_types.size() == 0, false, "At least one theme type must be specified.");
 
-	// Secondly, check the project-defined Theme resource.
-	if (ThemeDB::get_singleton()->get_project_theme().is_valid()) {
-		for (const StringName &E : p_theme_types) {
-			if (ThemeDB::get_singleton()->get_project_theme()->has_theme_item(p_data_type, p_name, E)) {
-				return true;
-			}
-		}
+	Variant value;
+	return _find_theme_item_in_types(p_data_type, p_name, p_theme_types, value);
+}
+
+const ThemeDB::ThemeLookupItem &ThemeOwner::_get_theme_lookup_item(Theme::DataType p_data_type, const StringName &p_name, const Node *p_for_node, const StringName &p_theme_type) {
+	ThemeDB::ThemeLookup &lookup = _get_theme_lookup(p_for_node, p_theme_type);
+	ThemeDB::ThemeLookupItem *item = lookup.items[p_data_type].getptr(p_name);
+	if (item) {
+		return *item;
 	}
 
-	// Lastly, fall back on the items defined in the default Theme, if they exist.
-	for (const StringName &E : p_theme_types) {
-		if (ThemeDB::get_singleton()->get_default_theme()->has_theme_item(p_data_type, p_name, E)) {
-			return true;
-		}
+	item = &lookup.items[p_data_type].insert(p_name, ThemeDB::ThemeLookupItem())->value;
+	if (!lookup.theme_types.is_empty()) {
+		item->found = _find_theme_item_in_types(p_data_type, p_name, lookup.theme_types, item->value);
 	}
+	return *item;
+}
 
-	return false;
+Variant ThemeOwner::get_theme_item(Theme::DataType p_data_type, const StringName &p_name, const Node *p_for_node, const StringName &p_theme_type) {
+	ERR_FAIL_INDEX_V(p_data_type, Theme::DATA_TYPE_MAX, Variant());
+	return _get_theme_lookup_item(p_data_type, p_name, p_for_node, p_theme_type).value;
+}
+
+bool ThemeOwner::has_theme_item(Theme::DataType p_data_type, const StringName &p_name, const Node *p_for_node, const StringName &p_theme_type) {
+	ERR_FAIL_INDEX_V(p_data_type, Theme::DATA_TYPE_MAX, false);
+	return _get_theme_lookup_item(p_data_type, p_name, p_for_node, p_theme_type).found;
 }
 
 float ThemeOwner::get_theme_default_base_scale() {
@@ -33,6 +33,7 @@
 
 #include "core/object/object.h"
 #include "scene/resources/theme.h"
+#include "scene/theme/theme_db.h"
 
 class Control;
 class Node;
@@ -44,6 +45,10 @@ class ThemeOwner : public Object {
 
 	Node *_get_next_owner_node(Node *p_from_node) const;
 
+	bool _find_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types, Variant &r_value);
+	ThemeDB::ThemeLookup &_get_theme_lookup(const Node *p_for_node, const StringName &p_theme_type);
+	const ThemeDB::ThemeLookupItem &_get_theme_lookup_item(Theme::DataType p_data_type, const StringName &p_name, const Node *p_for_node, const StringName &p_theme_type);
+
 public:
 	// Theme owner node.
 
@@ -64,6 +69,9 @@ public:
 	Variant get_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types);
 	bool has_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types);
 
+	Variant get_theme_item(Theme::DataType p_data_type, const StringName &p_name, const Node *p_for_node, const StringName &p_theme_type);
+	bool has_theme_item(Theme::DataType p_data_type, const StringName &p_name, const Node *p_for_node, const StringName &p_theme_type);
+
 	float get_theme_default_base_scale();
 	Ref<Font> get_theme_default_font();
 	int get_theme_default_font_size();
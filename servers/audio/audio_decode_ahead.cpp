@@ -0,0 +1,200 @@
+/*************************************************************************/
+/*  audio_decode_ahead.cpp                                               */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "audio_decode_ahead.h"
+
+#include "servers/audio_server.h"
+
+void AudioDecodeAhead::_decode_blocks(int p_max_blocks) {
+	for (int i = 0; i < p_max_blocks; i++) {
+		ring_lock.lock();
+		bool full = write_block - read_block >= BLOCK_COUNT;
+		bool stop = ended || released;
+		uint32_t index = write_block;
+		ring_lock.unlock();
+
+		if (full || stop) {
+			break;
+		}
+
+		// The consumer never touches the slot being written, so it's filled outside the ring lock.
+		Block &block = blocks[index % BLOCK_COUNT];
+		block.position = decoder->decode_ahead_get_position();
+		block.loops = decoder->decode_ahead_get_loop_count();
+		block.frame_count = MAX(decoder->decode_ahead_frames(block.frames, BLOCK_FRAMES), 0);
+
+		ring_lock.lock();
+		if (block.frame_count < BLOCK_FRAMES) {
+			ended = true;
+		}
+		if (block.frame_count > 0) {
+			write_block++;
+		}
+		ring_lock.unlock();
+	}
+}
+
+void AudioDecodeAhead::_request_fill() {
+	if (queued.is_set()) {
+		return;
+	}
+	queued.set();
+	AudioServer::get_singleton()->_queue_decode_ahead(this);
+}
+
+void AudioDecodeAhead::_fill() {
+	MutexLock lock(decoder_mutex);
+	queued.clear();
+	_decode_blocks(BLOCK_COUNT);
+}
+
+int AudioDecodeAhead::mix(AudioFrame *p_buffer, int p_frames) {
+	if (!blocks) {
+		MutexLock lock(decoder_mutex);
+		return decoder->decode_ahead_frames(p_buffer, p_frames);
+	}
+
+	int mixed = 0;
+	uint32_t filled = 0;
+	bool stream_ended = false;
+	while (mixed < p_frames) {
+		ring_lock.lock();
+		if (read_block == write_block) {
+			stream_ended = ended || released;
+			bool underrun = consumed;
+			ring_lock.unlock();
+
+			if (stream_ended) {
+				break;
+			}
+			if (underrun) {
+				AudioServer::get_singleton()->decode_ahead_underruns.increment();
+			}
+			// Nothing decoded yet (or the decode threads fell behind), decode here so the stream doesn't drop out.
+			MutexLock lock(decoder_mutex);
+			_decode_blocks(1);
+			continue;
+		}
+
+		const Block &block = blocks[read_block % BLOCK_COUNT];
+		int count = MIN(block.frame_count - read_offset, p_frames - mixed);
+		memcpy(p_buffer + mixed, block.frames + read_offset, sizeof(AudioFrame) * count);
+		mixed += count;
+		read_offset += count;
+		consumed = true;
+		if (read_offset == block.frame_count) {
+			read_block++;
+			read_offset = 0;
+		}
+		filled = write_block - read_block;
+		stream_ended = ended;
+		ring_lock.unlock();
+	}
+
+	for (int i = mixed; i < p_frames; i++) {
+		p_buffer[i] = AudioFrame(0, 0);
+	}
+
+	if (!stream_ended && filled <= BLOCK_COUNT / 2) {
+		_request_fill();
+	}
+
+	return mixed;
+}
+
+void AudioDecodeAhead::begin_restart() {
+	decoder_mutex.lock();
+}
+
+void AudioDecodeAhead::end_restart() {
+	ring_lock.lock();
+	read_block = 0;
+	write_block = 0;
+	read_offset = 0;
+	ended = false;
+	consumed = false;
+	ring_lock.unlock();
+
+	decoder_mutex.unlock();
+}
+
+bool AudioDecodeAhead::has_frames() const {
+	ring_lock.lock();
+	bool has = read_block != write_block;
+	ring_lock.unlock();
+	return has;
+}
+
+double AudioDecodeAhead::get_playback_position(double p_sampling_rate) const {
+	ring_lock.lock();
+	if (!blocks || read_block == write_block) {
+		ring_lock.unlock();
+		return decoder->decode_ahead_get_position();
+	}
+	const Block &block = blocks[read_block % BLOCK_COUNT];
+	double position = block.position + read_offset / p_sampling_rate;
+	ring_lock.unlock();
+	return position;
+}
+
+int AudioDecodeAhead::get_loop_count() const {
+	ring_lock.lock();
+	if (!blocks || read_block == write_block) {
+		ring_lock.unlock();
+		return decoder->decode_ahead_get_loop_count();
+	}
+	int loops = blocks[read_block % BLOCK_COUNT].loops;
+	ring_lock.unlock();
+	return loops;
+}
+
+void AudioDecodeAhead::release() {
+	ring_lock.lock();
+	released = true;
+	ring_lock.unlock();
+
+	if (blocks && AudioServer::get_singleton()) {
+		AudioServer::get_singleton()->_cancel_decode_ahead(this);
+	}
+}
+
+AudioDecodeAhead::AudioDecodeAhead(Decoder *p_decoder) {
+	decoder = p_decoder;
+	if (AudioServer::get_singleton() && AudioServer::get_singleton()->get_decode_ahead_thread_count() > 0) {
+		blocks = memnew_arr(Block, BLOCK_COUNT);
+	}
+}
+
+AudioDecodeAhead::~AudioDecodeAhead() {
+	release();
+	if (blocks) {
+		memdelete_arr(blocks);
+	}
+}
@@ -0,0 +1,109 @@
+/*************************************************************************/
+/*  audio_decode_ahead.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef AUDIO_DECODE_AHEAD_H
+#define AUDIO_DECODE_AHEAD_H
+
+#include "core/math/audio_frame.h"
+#include "core/os/mutex.h"
+#include "core/os/spin_lock.h"
+#include "core/templates/safe_refcount.h"
+
+// Keeps a few blocks of a compressed stream decoded ahead of the audio thread. The blocks are
+// decoded by AudioServer's decode-ahead threads, so mix() only has to copy them; when they run
+// out, the audio thread decodes in place instead and the underrun is counted.
+class AudioDecodeAhead {
+public:
+	class Decoder {
+	public:
+		// Produces up to p_frames, fewer means the stream ended. Always called with the decoder locked.
+		virtual int decode_ahead_frames(AudioFrame *p_buffer, int p_frames) = 0;
+		// Position (in seconds) and loop count of the next frame decode_ahead_frames() will produce.
+		virtual double decode_ahead_get_position() const = 0;
+		virtual int decode_ahead_get_loop_count() const = 0;
+
+		virtual ~Decoder() {}
+	};
+
+	enum {
+		BLOCK_FRAMES = 512,
+		BLOCK_COUNT = 16, // About 170 ms at 48 kHz.
+	};
+
+private:
+	friend class AudioServer;
+
+	struct Block {
+		AudioFrame frames[BLOCK_FRAMES];
+		int frame_count = 0;
+		double position = 0.0;
+		int loops = 0;
+	};
+
+	Decoder *decoder = nullptr;
+	Block *blocks = nullptr; // Null when decoding ahead is disabled, then mix() decodes directly.
+
+	// Guarded by ring_lock. Block indices only grow, the ring slot is the index modulo BLOCK_COUNT.
+	uint32_t read_block = 0;
+	uint32_t write_block = 0;
+	int read_offset = 0;
+	bool ended = false;
+	bool consumed = false;
+	bool released = false;
+	mutable SpinLock ring_lock;
+
+	Mutex decoder_mutex;
+	SafeFlag queued;
+	SafeFlag decoding;
+
+	void _decode_blocks(int p_max_blocks);
+	void _request_fill();
+	void _fill();
+
+public:
+	int mix(AudioFrame *p_buffer, int p_frames);
+
+	// The decoder state (seek position, loop counters...) may only be changed between these two
+	// calls, which discard everything decoded ahead so far.
+	void begin_restart();
+	void end_restart();
+
+	bool has_frames() const;
+	double get_playback_position(double p_sampling_rate) const;
+	int get_loop_count() const;
+
+	// Waits for pending decoding and stops any more, call before destroying the decoder state.
+	void release();
+
+	AudioDecodeAhead(Decoder *p_decoder);
+	~AudioDecodeAhead();
+};
+
+#endif // AUDIO_DECODE_AHEAD_H
@@ -0,0 +1,160 @@
+/*************************************************************************/
+/*  audio_mix.cpp                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "audio_mix.h"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUDIO_MIX_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define AUDIO_MIX_NEON
+#include <arm_neon.h>
+#endif
+
+// The vector paths load two frames (four floats) at a time.
+static_assert(sizeof(AudioFrame) == sizeof(float) * 2, "AudioFrame must be two packed floats.");
+
+void AudioMix::mix_ramp(AudioFrame *p_dst, const AudioFrame *p_src, const AudioFrame &p_vol_start, const AudioFrame &p_vol_final, uint32_t p_frames) {
+	if (p_frames == 0) {
+		return;
+	}
+
+	const AudioFrame vol_step = (p_vol_final - p_vol_start) / float(p_frames);
+	uint32_t i = 0;
+
+#if defined(AUDIO_MIX_SSE2)
+	float *dst = reinterpret_cast<float *>(p_dst);
+	const float *src = reinterpret_cast<const float *>(p_src);
+	const __m128 start = _mm_setr_ps(p_vol_start.l, p_vol_start.r, p_vol_start.l, p_vol_start.r);
+	const __m128 step = _mm_setr_ps(vol_step.l, vol_step.r, vol_step.l, vol_step.r);
+	const __m128 two = _mm_set1_ps(2.0f);
+	__m128 index = _mm_setr_ps(0.0f, 0.0f, 1.0f, 1.0f);
+	for (; i + 2 <= p_frames; i += 2) {
+		const __m128 vol = _mm_add_ps(start, _mm_mul_ps(step, index));
+		_mm_storeu_ps(dst + i * 2, _mm_add_ps(_mm_loadu_ps(dst + i * 2), _mm_mul_ps(vol, _mm_loadu_ps(src + i * 2))));
+		index = _mm_add_ps(index, two);
+	}
+#elif defined(AUDIO_MIX_NEON)
+	float *dst = reinterpret_cast<float *>(p_dst);
+	const float *src = reinterpret_cast<const float *>(p_src);
+	const float start_values[4] = { p_vol_start.l, p_vol_start.r, p_vol_start.l, p_vol_start.r };
+	const float step_values[4] = { vol_step.l, vol_step.r, vol_step.l, vol_step.r };
+	const float index_values[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+	const float32x4_t start = vld1q_f32(start_values);
+	const float32x4_t step = vld1q_f32(step_values);
+	const float32x4_t two = vdupq_n_f32(2.0f);
+	float32x4_t index = vld1q_f32(index_values);
+	for (; i + 2 <= p_frames; i += 2) {
+		const float32x4_t vol = vmlaq_f32(start, step, index);
+		vst1q_f32(dst + i * 2, vmlaq_f32(vld1q_f32(dst + i * 2), vol, vld1q_f32(src + i * 2)));
+		index = vaddq_f32(index, two);
+	}
+#endif
+
+	for (; i < p_frames; i++) {
+		p_dst[i] += (p_vol_start + vol_step * float(i)) * p_src[i];
+	}
+}
+
+void AudioMix::mix(AudioFrame *p_dst, const AudioFrame *p_src, uint32_t p_frames) {
+	uint32_t i = 0;
+
+#if defined(AUDIO_MIX_SSE2)
+	float *dst = reinterpret_cast<float *>(p_dst);
+	const float *src = reinterpret_cast<const float *>(p_src);
+	for (; i + 2 <= p_frames; i += 2) {
+		_mm_storeu_ps(dst + i * 2, _mm_add_ps(_mm_loadu_ps(dst + i * 2), _mm_loadu_ps(src + i * 2)));
+	}
+#elif defined(AUDIO_MIX_NEON)
+	float *dst = reinterpret_cast<float *>(p_dst);
+	const float *src = reinterpret_cast<const float *>(p_src);
+	for (; i + 2 <= p_frames; i += 2) {
+		vst1q_f32(dst + i * 2, vaddq_f32(vld1q_f32(dst + i * 2), vld1q_f32(src + i * 2)));
+	}
+#endif
+
+	for (; i < p_frames; i++) {
+		p_dst[i] += p_src[i];
+	}
+}
+
+AudioFrame AudioMix::scale_and_peak(AudioFrame *p_buf, float p_volume, uint32_t p_frames) {
+	AudioFrame peak = AudioFrame(0, 0);
+	uint32_t i = 0;
+
+#if defined(AUDIO_MIX_SSE2)
+	float *buf = reinterpret_cast<float *>(p_buf);
+	const __m128 volume = _mm_set1_ps(p_volume);
+	const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+	__m128 peak4 = _mm_setzero_ps();
+	for (; i + 2 <= p_frames; i += 2) {
+		const __m128 scaled = _mm_mul_ps(_mm_loadu_ps(buf + i * 2), volume);
+		_mm_storeu_ps(buf + i * 2, scaled);
+		peak4 = _mm_max_ps(peak4, _mm_and_ps(scaled, abs_mask));
+	}
+	// Fold the two frames in the register into one.
+	peak4 = _mm_max_ps(peak4, _mm_movehl_ps(peak4, peak4));
+	float peak_values[4];
+	_mm_storeu_ps(peak_values, peak4);
+	peak = AudioFrame(peak_values[0], peak_values[1]);
+#elif defined(AUDIO_MIX_NEON)
+	float *buf = reinterpret_cast<float *>(p_buf);
+	float32x4_t peak4 = vdupq_n_f32(0.0f);
+	for (; i + 2 <= p_frames; i += 2) {
+		const float32x4_t scaled = vmulq_n_f32(vld1q_f32(buf + i * 2), p_volume);
+		vst1q_f32(buf + i * 2, scaled);
+		peak4 = vmaxq_f32(peak4, vabsq_f32(scaled));
+	}
+	const float32x2_t peak2 = vmax_f32(vget_low_f32(peak4), vget_high_f32(peak4));
+	peak = AudioFrame(vget_lane_f32(peak2, 0), vget_lane_f32(peak2, 1));
+#endif
+
+	for (; i < p_frames; i++) {
+		p_buf[i] *= p_volume;
+
+		float l = ABS(p_buf[i].l);
+		if (l > peak.l) {
+			peak.l = l;
+		}
+		float r = ABS(p_buf[i].r);
+		if (r > peak.r) {
+			peak.r = r;
+		}
+	}
+
+	return peak;
+}
+
+void AudioMix::clear(AudioFrame *p_buf, uint32_t p_frames) {
+	// All-zero bits are 0.0f, so this is the same as assigning AudioFrame(0, 0).
+	memset(p_buf, 0, sizeof(AudioFrame) * p_frames);
+}
@@ -0,0 +1,51 @@
+/*************************************************************************/
+/*  audio_mix.h                                                          */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef AUDIO_MIX_H
+#define AUDIO_MIX_H
+
+#include "core/math/audio_frame.h"
+
+// Inner loops of the audio mixer. They process AudioFrame buffers as flat
+// interleaved float arrays, using SSE2 or NEON when the target has them
+// (both are part of the x86_64 and arm64 baselines) and plain loops otherwise.
+class AudioMix {
+public:
+	// p_dst += p_src * volume, where volume ramps linearly from p_vol_start at the
+	// first frame towards p_vol_final, which would be reached after p_frames.
+	static void mix_ramp(AudioFrame *p_dst, const AudioFrame *p_src, const AudioFrame &p_vol_start, const AudioFrame &p_vol_final, uint32_t p_frames);
+	// p_dst += p_src.
+	static void mix(AudioFrame *p_dst, const AudioFrame *p_src, uint32_t p_frames);
+	// p_buf *= p_volume, returns the highest absolute value of each channel after scaling.
+	static AudioFrame scale_and_peak(AudioFrame *p_buf, float p_volume, uint32_t p_frames);
+	static void clear(AudioFrame *p_buf, uint32_t p_frames);
+};
+
+#endif // AUDIO_MIX_H
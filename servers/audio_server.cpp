@@ -40,7 +40,9 @@
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
 #include "scene/resources/audio_stream_wav.h"
+#include "servers/audio/audio_decode_ahead.h"
 #include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_mix.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
 
 #include <cstring>
@@ -230,6 +232,7 @@ AudioDriver *AudioDriverManager::get_driver(int p_driver) {
 //////////////////////////////////////////////
 
 void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_AUDIO);
 	mix_count++;
 	int todo = p_frames;
 
@@ -474,131 +477,306 @@ void AudioServer::_mix_step() {
 		}
 	}
 
-	for (int i = buses.size() - 1; i >= 0; i--) {
-		//go bus by bus
-		Bus *bus = buses[i];
+	if (bus_workers.is_empty()) {
+		for (int i = buses.size() - 1; i >= 0; i--) {
+			//go bus by bus
+			_mix_step_bus(buses[i], temp_buffer, solo_mode);
+			_mix_step_bus_send(buses[i]);
+		}
+	} else {
+		_mix_step_bus_graph(solo_mode);
+	}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				//buffer was not used, but it's still active, so it must be cleaned
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
-				}
-			}
+AudioServer::Bus *AudioServer::_get_bus_send(const Bus *p_bus) {
+	if (p_bus->index_cache == 0) {
+		return nullptr; //everything has a send save for master bus
+	}
+	if (!bus_map.has(p_bus->send)) {
+		return buses[0];
+	}
+	Bus *send = bus_map[p_bus->send];
+	if (send->index_cache >= p_bus->index_cache) { //invalid, send to master
+		return buses[0];
+	}
+	return send;
+}
+
+bool AudioServer::_bus_reads_other_buses(const Bus *p_bus) const {
+	for (int i = 0; i < p_bus->effects.size(); i++) {
+		const AudioEffectCompressor *compressor = Object::cast_to<AudioEffectCompressor>(p_bus->effects[i].effect.ptr());
+		if (p_bus->effects[i].enabled && compressor && compressor->get_sidechain() != StringName()) {
+			return true;
 		}
+	}
+	return false;
+}
 
-		//process effects
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
-				}
+void AudioServer::_mix_step_bus(Bus *p_bus, Vector<Vector<AudioFrame>> &r_temp_buffer, bool p_solo_mode) {
+	for (int k = 0; k < p_bus->channels.size(); k++) {
+		if (p_bus->channels[k].active && !p_bus->channels[k].used) {
+			//buffer was not used, but it's still active, so it must be cleaned
+			AudioMix::clear(p_bus->channels.write[k].buffer.ptrw(), buffer_size);
+		}
+	}
+
+	//process effects
+	if (!p_bus->bypass) {
+		for (int j = 0; j < p_bus->effects.size(); j++) {
+			if (!p_bus->effects[j].enabled) {
+				continue;
+			}
 
 #ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 #endif
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
+			for (int k = 0; k < p_bus->channels.size(); k++) {
+				if (!(p_bus->channels[k].active || p_bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				p_bus->channels.write[k].effect_instances.write[j]->process(p_bus->channels[k].buffer.ptr(), r_temp_buffer.write[k].ptrw(), buffer_size);
+			}
 
-				//swap buffers, so internal buffer always has the right data
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
+			//swap buffers, so internal buffer always has the right data
+			for (int k = 0; k < p_bus->channels.size(); k++) {
+				if (!(p_bus->channels[k].active || p_bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				SWAP(p_bus->channels.write[k].buffer, r_temp_buffer.write[k]);
+			}
 
 #ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+			p_bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
 #endif
-			}
 		}
+	}
 
-		//process send
+	for (int k = 0; k < p_bus->channels.size(); k++) {
+		if (!p_bus->channels[k].active) {
+			p_bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
+		}
 
-		Bus *send = nullptr;
+		AudioFrame *buf = p_bus->channels.write[k].buffer.ptrw();
 
-		if (i > 0) {
-			//everything has a send save for master bus
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { //invalid, send to master
-					send = buses[0];
-				}
+		float volume = Math::db_to_linear(p_bus->volume_db);
+
+		if (p_solo_mode) {
+			if (!p_bus->soloed) {
+				volume = 0.0;
+			}
+		} else {
+			if (p_bus->mute) {
+				volume = 0.0;
 			}
 		}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
-				continue;
+		//apply volume and compute peak
+		AudioFrame peak = AudioMix::scale_and_peak(buf, volume, buffer_size);
+
+		p_bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.l + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.r + AUDIO_PEAK_OFFSET));
+
+		if (!p_bus->channels[k].used) {
+			//see if any audio is contained, because channel was not used
+
+			if (MAX(peak.r, peak.l) > Math::db_to_linear(channel_disable_threshold_db)) {
+				p_bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - p_bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				p_bus->channels.write[k].active = false; //went inactive, don't mix.
 			}
+		}
+	}
+}
 
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+void AudioServer::_mix_step_bus_send(Bus *p_bus) {
+	Bus *send = _get_bus_send(p_bus);
+	if (!send) {
+		return;
+	}
 
-			AudioFrame peak = AudioFrame(0, 0);
+	for (int k = 0; k < p_bus->channels.size(); k++) {
+		if (!p_bus->channels[k].active) {
+			continue;
+		}
+		AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+		AudioMix::mix(target_buf, p_bus->channels[k].buffer.ptr(), buffer_size);
+	}
+}
 
-			float volume = Math::db_to_linear(bus->volume_db);
+void AudioServer::_mix_step_bus_graph(bool p_solo_mode) {
+	// A bus only sends to a bus before it (or to master), so it sits one level below its send
+	// and all the buses feeding a level are done once the levels below it are.
+	bus_levels.resize(buses.size());
+	int max_level = 0;
+	for (int i = 0; i < buses.size(); i++) {
+		Bus *send = _get_bus_send(buses[i]);
+		bus_levels[i] = send ? bus_levels[send->index_cache] + 1 : 0;
+		max_level = MAX(max_level, bus_levels[i]);
+	}
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
+	bus_batch_solo_mode = p_solo_mode;
+
+	for (int level = max_level; level >= 0; level--) {
+		bus_batch.clear();
+		bus_batch_serial.clear();
+		for (int i = buses.size() - 1; i >= 0; i--) {
+			if (bus_levels[i] != level) {
+				continue;
+			}
+			if (_bus_reads_other_buses(buses[i])) {
+				bus_batch_serial.push_back(buses[i]);
 			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
+				bus_batch.push_back(buses[i]);
 			}
+		}
 
-			//apply volume and compute peak
-			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+		// Wake at most one worker per extra bus, the audio thread takes its share too.
+		uint32_t workers = MIN(bus_workers.size(), bus_batch.size() > 0 ? bus_batch.size() - 1 : 0);
+		bus_batch_next.set(0);
+		for (uint32_t i = 0; i < workers; i++) {
+			bus_work_semaphore.post();
+		}
+		_mix_step_bus_batch(temp_buffer);
+		for (uint32_t i = 0; i < workers; i++) {
+			bus_done_semaphore.wait();
+		}
 
-				float l = ABS(buf[j].l);
-				if (l > peak.l) {
-					peak.l = l;
-				}
-				float r = ABS(buf[j].r);
-				if (r > peak.r) {
-					peak.r = r;
-				}
-			}
+		for (uint32_t i = 0; i < bus_batch_serial.size(); i++) {
+			_mix_step_bus(bus_batch_serial[i], temp_buffer, p_solo_mode);
+		}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.l + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.r + AUDIO_PEAK_OFFSET));
+		// Sends accumulate into shared buffers, so they are done here rather than by the workers.
+		for (uint32_t i = 0; i < bus_batch.size(); i++) {
+			_mix_step_bus_send(bus_batch[i]);
+		}
+		for (uint32_t i = 0; i < bus_batch_serial.size(); i++) {
+			_mix_step_bus_send(bus_batch_serial[i]);
+		}
+	}
+}
 
-			if (!bus->channels[k].used) {
-				//see if any audio is contained, because channel was not used
+void AudioServer::_mix_step_bus_batch(Vector<Vector<AudioFrame>> &r_temp_buffer) {
+	while (true) {
+		uint32_t idx = bus_batch_next.postincrement();
+		if (idx >= bus_batch.size()) {
+			break;
+		}
+		_mix_step_bus(bus_batch[idx], r_temp_buffer, bus_batch_solo_mode);
+	}
+}
 
-				if (MAX(peak.r, peak.l) > Math::db_to_linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
-			}
+void AudioServer::_bus_worker_func(void *p_userdata) {
+	BusWorker *worker = static_cast<BusWorker *>(p_userdata);
 
-			if (send) {
-				//if not master bus, send
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+	while (true) {
+		singleton->bus_work_semaphore.wait();
+		if (singleton->bus_workers_exit.is_set()) {
+			break;
+		}
+		singleton->_mix_step_bus_batch(worker->temp_buffer);
+		singleton->bus_done_semaphore.post();
+	}
+}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
+void AudioServer::_start_bus_workers(int p_count) {
+	bus_workers_exit.clear();
+
+	Thread::Settings settings;
+	settings.priority = Thread::PRIORITY_HIGH;
+	for (int i = 0; i < p_count; i++) {
+		BusWorker *worker = memnew(BusWorker);
+		bus_workers.push_back(worker);
+		worker->thread.start(_bus_worker_func, worker, settings);
+	}
+}
+
+void AudioServer::_finish_bus_workers() {
+	bus_workers_exit.set();
+	for (uint32_t i = 0; i < bus_workers.size(); i++) {
+		bus_work_semaphore.post();
+	}
+	for (uint32_t i = 0; i < bus_workers.size(); i++) {
+		bus_workers[i]->thread.wait_to_finish();
+		memdelete(bus_workers[i]);
+	}
+	bus_workers.clear();
+}
+
+void AudioServer::_decode_ahead_thread_func(void *p_userdata) {
+	while (true) {
+		singleton->decode_ahead_semaphore.wait();
+		if (singleton->decode_ahead_exit.is_set()) {
+			break;
+		}
+
+		AudioDecodeAhead *decode_ahead = nullptr;
+		{
+			MutexLock lock(singleton->decode_ahead_mutex);
+			if (singleton->decode_ahead_queue.size()) {
+				decode_ahead = singleton->decode_ahead_queue[0];
+				singleton->decode_ahead_queue.remove_at(0);
+				// Set under the queue lock, so _cancel_decode_ahead() knows to wait for it.
+				decode_ahead->decoding.set();
 			}
 		}
+
+		if (decode_ahead) {
+			decode_ahead->_fill();
+			decode_ahead->decoding.clear();
+		}
 	}
+}
 
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
+void AudioServer::_start_decode_ahead_threads(int p_count) {
+	decode_ahead_exit.clear();
+
+	for (int i = 0; i < p_count; i++) {
+		Thread *thread = memnew(Thread);
+		decode_ahead_threads.push_back(thread);
+		thread->start(_decode_ahead_thread_func, nullptr);
+	}
+}
+
+void AudioServer::_finish_decode_ahead_threads() {
+	decode_ahead_exit.set();
+	for (uint32_t i = 0; i < decode_ahead_threads.size(); i++) {
+		decode_ahead_semaphore.post();
+	}
+	for (uint32_t i = 0; i < decode_ahead_threads.size(); i++) {
+		decode_ahead_threads[i]->wait_to_finish();
+		memdelete(decode_ahead_threads[i]);
+	}
+	decode_ahead_threads.clear();
+	decode_ahead_queue.clear();
+}
+
+void AudioServer::_queue_decode_ahead(AudioDecodeAhead *p_decode_ahead) {
+	if (decode_ahead_threads.is_empty()) {
+		return;
+	}
+	{
+		MutexLock lock(decode_ahead_mutex);
+		decode_ahead_queue.push_back(p_decode_ahead);
+	}
+	decode_ahead_semaphore.post();
+}
+
+void AudioServer::_cancel_decode_ahead(AudioDecodeAhead *p_decode_ahead) {
+	{
+		MutexLock lock(decode_ahead_mutex);
+		int64_t index = decode_ahead_queue.find(p_decode_ahead);
+		while (index != -1) {
+			decode_ahead_queue.remove_at(index);
+			index = decode_ahead_queue.find(p_decode_ahead);
+		}
+	}
+	while (p_decode_ahead->decoding.is_set()) {
+		OS::get_singleton()->delay_usec(10);
+	}
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
@@ -631,11 +809,8 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		}
 
 	} else {
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
-		}
+		// Make this buffer size invariant if buffer_size ever becomes a project setting.
+		AudioMix::mix_ramp(p_out_buf, p_source_buf, p_vol_start, p_vol_final, buffer_size);
 	}
 }
 
@@ -668,9 +843,7 @@ AudioFrame *AudioServer::thread_get_channel_mix_buffer(int p_bus, int p_buffer)
 		buses.write[p_bus]->channels.write[p_buffer].used = true;
 		buses.write[p_bus]->channels.write[p_buffer].active = true;
 		buses.write[p_bus]->channels.write[p_buffer].last_mix_with_audio = mix_frames;
-		for (uint32_t i = 0; i < buffer_size; i++) {
-			data[i] = AudioFrame(0, 0);
-		}
+		AudioMix::clear(data, buffer_size);
 	}
 
 	return data;
@@ -1335,6 +1508,13 @@ void AudioServer::init_channels_and_buffers() {
 		temp_buffer.write[i].resize(buffer_size);
 	}
 
+	for (uint32_t i = 0; i < bus_workers.size(); i++) {
+		bus_workers[i]->temp_buffer.resize(channel_count);
+		for (int j = 0; j < channel_count; j++) {
+			bus_workers[i]->temp_buffer.write[j].resize(buffer_size);
+		}
+	}
+
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
@@ -1350,6 +1530,14 @@ void AudioServer::init() {
 	ProjectSettings::get_singleton()->set_custom_property_info("audio/buses/channel_disable_time", PropertyInfo(Variant::FLOAT, "audio/buses/channel_disable_time", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"));
 	buffer_size = 512; //hardcoded for now
 
+	int worker_threads = GLOBAL_DEF_RST("audio/buses/worker_threads", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("audio/buses/worker_threads", PropertyInfo(Variant::INT, "audio/buses/worker_threads", PROPERTY_HINT_RANGE, "0,8,1"));
+	_start_bus_workers(CLAMP(worker_threads, 0, 8));
+
+	int decode_ahead_thread_count = GLOBAL_DEF_RST("audio/general/decode_ahead_threads", 1);
+	ProjectSettings::get_singleton()->set_custom_property_info("audio/general/decode_ahead_threads", PropertyInfo(Variant::INT, "audio/general/decode_ahead_threads", PROPERTY_HINT_RANGE, "0,8,1"));
+	_start_decode_ahead_threads(CLAMP(decode_ahead_thread_count, 0, 8));
+
 	init_channels_and_buffers();
 
 	mix_count = 0;
@@ -1469,6 +1657,9 @@ void AudioServer::finish() {
 		AudioDriverManager::get_driver(i)->finish();
 	}
 
+	_finish_bus_workers();
+	_finish_decode_ahead_threads();
+
 	for (int i = 0; i < buses.size(); i++) {
 		memdelete(buses[i]);
 	}
@@ -34,6 +34,9 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -41,6 +44,7 @@
 
 #include <atomic>
 
+class AudioDecodeAhead;
 class AudioDriverDummy;
 class AudioStream;
 class AudioStreamWAV;
@@ -267,13 +271,56 @@ private:
 	Vector<Bus *> buses;
 	HashMap<StringName, Bus *> bus_map;
 
+	// Buses on the same level of the send graph don't depend on each other, so their effects
+	// can run on a few dedicated worker threads while the audio thread processes its share.
+	struct BusWorker {
+		Thread thread;
+		Vector<Vector<AudioFrame>> temp_buffer;
+	};
+
+	LocalVector<BusWorker *> bus_workers;
+	Semaphore bus_work_semaphore;
+	Semaphore bus_done_semaphore;
+	SafeFlag bus_workers_exit;
+
+	LocalVector<int> bus_levels;
+	LocalVector<Bus *> bus_batch; // Buses of the current level that can be processed concurrently.
+	LocalVector<Bus *> bus_batch_serial; // Buses of the current level that read other buses (sidechains).
+	SafeNumeric<uint32_t> bus_batch_next;
+	bool bus_batch_solo_mode = false;
+
+	static void _bus_worker_func(void *p_userdata);
+	void _start_bus_workers(int p_count);
+	void _finish_bus_workers();
+
+	// Shared threads decoding compressed streams ahead of the mix, see AudioDecodeAhead.
+	friend class AudioDecodeAhead;
+	LocalVector<Thread *> decode_ahead_threads;
+	LocalVector<AudioDecodeAhead *> decode_ahead_queue;
+	Mutex decode_ahead_mutex;
+	Semaphore decode_ahead_semaphore;
+	SafeFlag decode_ahead_exit;
+	SafeNumeric<uint64_t> decode_ahead_underruns;
+
+	static void _decode_ahead_thread_func(void *p_userdata);
+	void _start_decode_ahead_threads(int p_count);
+	void _finish_decode_ahead_threads();
+	void _queue_decode_ahead(AudioDecodeAhead *p_decode_ahead);
+	void _cancel_decode_ahead(AudioDecodeAhead *p_decode_ahead);
+
 	void _update_bus_effects(int p_bus);
+	Bus *_get_bus_send(const Bus *p_bus);
+	bool _bus_reads_other_buses(const Bus *p_bus) const;
 
 	static AudioServer *singleton;
 
 	void init_channels_and_buffers();
 
 	void _mix_step();
+	void _mix_step_bus(Bus *p_bus, Vector<Vector<AudioFrame>> &r_temp_buffer, bool p_solo_mode);
+	void _mix_step_bus_send(Bus *p_bus);
+	void _mix_step_bus_graph(bool p_solo_mode);
+	void _mix_step_bus_batch(Vector<Vector<AudioFrame>> &r_temp_buffer);
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
 	// Should only be called on the main thread.
@@ -407,6 +454,10 @@ public:
 	virtual double get_time_to_next_mix() const;
 	virtual double get_time_since_last_mix() const;
 
+	int get_decode_ahead_thread_count() const { return decode_ahead_threads.size(); }
+	// Times a stream's decode-ahead buffer ran dry and the audio thread had to decode itself.
+	uint64_t get_decode_ahead_underrun_count() const { return decode_ahead_underruns.get(); }
+
 	void add_listener_changed_callback(AudioCallback p_callback, void *p_userdata);
 	void remove_listener_changed_callback(AudioCallback p_callback, void *p_userdata);
 
@@ -274,6 +274,8 @@ public:
 
 class ServersDebugger::ServersProfiler : public EngineProfiler {
 	bool skip_profile_frame = false;
+	int frame_interval = 1;
+	int frames_until_send = 0;
 	typedef ServersDebugger::ServerInfo ServerInfo;
 	typedef ServersDebugger::ServerFunctionInfo ServerFunctionInfo;
 
@@ -319,6 +321,8 @@ public:
 		skip_profile_frame = false;
 		if (p_enable) {
 			server_data.clear(); // Clear old profiling data.
+			frame_interval = MAX(1, int(GLOBAL_GET("debug/settings/profiler/frame_interval")));
+			frames_until_send = 0;
 		} else {
 			_send_frame_data(true); // Send final frame.
 		}
@@ -345,6 +349,13 @@ public:
 		process_time = p_process_time;
 		physics_time = p_physics_time;
 		physics_frame_time = p_physics_frame_time;
+		// Only every frame_interval-th frame is sent, the others are still collected and discarded.
+		if (frames_until_send > 0) {
+			frames_until_send--;
+			skip_profile_frame = true;
+		} else {
+			frames_until_send = frame_interval - 1;
+		}
 		_send_frame_data(false);
 	}
 
@@ -358,15 +369,25 @@ class ServersDebugger::VisualProfiler : public EngineProfiler {
 	typedef ServersDebugger::ServerFunctionInfo ServerFunctionInfo;
 
 	HashMap<StringName, ServerInfo> server_data;
+	int frame_interval = 1;
+	int frames_until_send = 0;
 
 public:
 	void toggle(bool p_enable, const Array &p_opts) {
 		RS::get_singleton()->set_frame_profiling_enabled(p_enable);
+		frame_interval = MAX(1, int(GLOBAL_GET("debug/settings/profiler/frame_interval")));
+		frames_until_send = 0;
 	}
 
 	void add(const Array &p_data) {}
 
 	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+		if (frames_until_send > 0) {
+			frames_until_send--;
+			return;
+		}
+		frames_until_send = frame_interval - 1;
+
 		Vector<RS::FrameProfileArea> profile_areas = RS::get_singleton()->get_frame_profile();
 		ServersDebugger::VisualProfilerFrame frame;
 		if (!profile_areas.size()) {
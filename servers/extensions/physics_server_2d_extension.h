@@ -236,6 +236,9 @@ public:
 	EXBIND1RC(Vector<Vector2>, space_get_contacts, RID)
 	EXBIND1RC(int, space_get_contact_count, RID)
 
+	EXBIND1RC(PackedByteArray, space_create_snapshot, RID)
+	EXBIND2R(bool, space_restore_snapshot, RID, const PackedByteArray &)
+
 	/* AREA API */
 
 	//EXBIND0RID(area);
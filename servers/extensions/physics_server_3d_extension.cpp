@@ -164,6 +164,9 @@ void PhysicsServer3DExtension::_bind_methods() {
 	GDVIRTUAL_BIND(_space_get_contacts, "space");
 	GDVIRTUAL_BIND(_space_get_contact_count, "space");
 
+	GDVIRTUAL_BIND(_space_create_snapshot, "space");
+	GDVIRTUAL_BIND(_space_restore_snapshot, "space", "snapshot");
+
 	/* AREA API */
 
 	GDVIRTUAL_BIND(_area_create);
@@ -203,6 +206,10 @@ void PhysicsServer3DExtension::_bind_methods() {
 
 	GDVIRTUAL_BIND(_area_set_monitor_callback, "area", "callback");
 	GDVIRTUAL_BIND(_area_set_area_monitor_callback, "area", "callback");
+	GDVIRTUAL_BIND(_area_set_monitor_batched, "area", "batched");
+
+	GDVIRTUAL_BIND(_area_get_overlapping_bodies, "area");
+	GDVIRTUAL_BIND(_area_get_overlapping_areas, "area");
 
 	/* BODY API */
 
@@ -242,6 +242,9 @@ public:
 	EXBIND1RC(Vector<Vector3>, space_get_contacts, RID)
 	EXBIND1RC(int, space_get_contact_count, RID)
 
+	EXBIND1RC(PackedByteArray, space_create_snapshot, RID)
+	EXBIND2R(bool, space_restore_snapshot, RID, const PackedByteArray &)
+
 	/* AREA API */
 
 	//EXBIND0RID(area);
@@ -282,6 +285,27 @@ public:
 
 	EXBIND2(area_set_monitor_callback, RID, const Callable &)
 	EXBIND2(area_set_area_monitor_callback, RID, const Callable &)
+	EXBIND2(area_set_monitor_batched, RID, bool)
+
+	GDVIRTUAL1RC(TypedArray<RID>, _area_get_overlapping_bodies, RID)
+
+	void area_get_overlapping_bodies(RID p_area, List<RID> *p_bodies) override {
+		TypedArray<RID> ret;
+		GDVIRTUAL_REQUIRED_CALL(_area_get_overlapping_bodies, p_area, ret);
+		for (int i = 0; i < ret.size(); i++) {
+			p_bodies->push_back(ret[i]);
+		}
+	}
+
+	GDVIRTUAL1RC(TypedArray<RID>, _area_get_overlapping_areas, RID)
+
+	void area_get_overlapping_areas(RID p_area, List<RID> *p_areas) override {
+		TypedArray<RID> ret;
+		GDVIRTUAL_REQUIRED_CALL(_area_get_overlapping_areas, p_area, ret);
+		for (int i = 0; i < ret.size(); i++) {
+			p_areas->push_back(ret[i]);
+		}
+	}
 
 	/* BODY API */
 
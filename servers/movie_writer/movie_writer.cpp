@@ -120,9 +120,39 @@ void MovieWriter::begin(const Size2i &p_movie_size, uint32_t p_fps, const String
 	audio_channels = AudioDriverDummy::get_dummy_singleton()->get_channels();
 	audio_mix_buffer.resize(mix_rate * audio_channels / fps);
 
+	encode_ring.clear();
+	encode_ring_head = 0;
+	encode_ring_count = 0;
+	if (has_threaded_encoder()) {
+		// Every frame in flight holds an uncompressed image, so don't queue more than the pool can encode.
+		int frames_in_flight = GLOBAL_GET("editor/movie_writer/max_frames_in_flight");
+		frames_in_flight = CLAMP(frames_in_flight, 1, MAX(WorkerThreadPool::get_singleton()->get_thread_count(), 1));
+		encode_ring.resize(frames_in_flight);
+	}
+
 	write_begin(p_movie_size, p_fps, p_base_path);
 }
 
+void MovieWriter::_encode_frame_task(EncodeJob *p_job) {
+	p_job->error = encode_frame(p_job->image, p_job->encoded);
+}
+
+void MovieWriter::_write_oldest_encoded_frame() {
+	EncodeJob &job = encode_ring[encode_ring_head];
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(job.task);
+	job.task = WorkerThreadPool::INVALID_TASK_ID;
+	job.image.unref();
+
+	if (job.error == OK) {
+		write_encoded_frame(job.encoded, job.audio.ptr());
+	} else {
+		ERR_PRINT(vformat("MovieWriter failed to encode a frame (error %d), it will be missing from the movie.", job.error));
+	}
+
+	encode_ring_head = (encode_ring_head + 1) % encode_ring.size();
+	encode_ring_count--;
+}
+
 void MovieWriter::_bind_methods() {
 	ClassDB::bind_static_method("MovieWriter", D_METHOD("add_writer", "writer"), &MovieWriter::add_writer);
 
@@ -139,6 +169,8 @@ void MovieWriter::_bind_methods() {
 	ProjectSettings::get_singleton()->set_custom_property_info("editor/movie_writer/mix_rate", PropertyInfo(Variant::INT, "editor/movie_writer/mix_rate", PROPERTY_HINT_RANGE, "8000,192000,1,suffix:Hz"));
 	GLOBAL_DEF("editor/movie_writer/speaker_mode", 0);
 	ProjectSettings::get_singleton()->set_custom_property_info("editor/movie_writer/speaker_mode", PropertyInfo(Variant::INT, "editor/movie_writer/speaker_mode", PROPERTY_HINT_ENUM, "Stereo,3.1,5.1,7.1"));
+	GLOBAL_DEF("editor/movie_writer/max_frames_in_flight", 8);
+	ProjectSettings::get_singleton()->set_custom_property_info("editor/movie_writer/max_frames_in_flight", PropertyInfo(Variant::INT, "editor/movie_writer/max_frames_in_flight", PROPERTY_HINT_RANGE, "1,64,1"));
 	GLOBAL_DEF("editor/movie_writer/mjpeg_quality", 0.75);
 	ProjectSettings::get_singleton()->set_custom_property_info("editor/movie_writer/mjpeg_quality", PropertyInfo(Variant::FLOAT, "editor/movie_writer/mjpeg_quality", PROPERTY_HINT_RANGE, "0.01,1.0,0.01"));
 	// used by the editor
@@ -182,11 +214,33 @@ void MovieWriter::add_frame(const Ref<Image> &p_image) {
 	DisplayServer::get_singleton()->window_set_title(vformat("MovieWriter: Frame %d (time: %s) - %s", Engine::get_singleton()->get_frames_drawn(), movie_time, project_name));
 #endif
 
-	AudioDriverDummy::get_dummy_singleton()->mix_audio(mix_rate / fps, audio_mix_buffer.ptr());
-	write_frame(p_image, audio_mix_buffer.ptr());
+	if (encode_ring.is_empty()) {
+		AudioDriverDummy::get_dummy_singleton()->mix_audio(mix_rate / fps, audio_mix_buffer.ptr());
+		write_frame(p_image, audio_mix_buffer.ptr());
+		return;
+	}
+
+	if (encode_ring_count == encode_ring.size()) {
+		_write_oldest_encoded_frame();
+	}
+
+	EncodeJob &job = encode_ring[(encode_ring_head + encode_ring_count) % encode_ring.size()];
+	job.image = p_image;
+	job.audio.resize(audio_mix_buffer.size());
+	AudioDriverDummy::get_dummy_singleton()->mix_audio(mix_rate / fps, job.audio.ptr());
+	job.task = WorkerThreadPool::get_singleton()->add_template_task(this, &MovieWriter::_encode_frame_task, &job, false, SNAME("MovieWriter frame encoding"));
+	encode_ring_count++;
+
+	// Write whatever is already done without stalling the main thread.
+	while (encode_ring_count && WorkerThreadPool::get_singleton()->is_task_completed(encode_ring[encode_ring_head].task)) {
+		_write_oldest_encoded_frame();
+	}
 }
 
 void MovieWriter::end() {
+	while (encode_ring_count) {
+		_write_oldest_encoded_frame();
+	}
 	write_end();
 
 	// Print a report with various statistics.
@@ -31,6 +31,7 @@
 #ifndef MOVIE_WRITER_H
 #define MOVIE_WRITER_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
 #include "servers/audio/audio_driver_dummy.h"
 #include "servers/audio_server.h"
@@ -46,6 +47,21 @@ class MovieWriter : public Object {
 
 	LocalVector<int32_t> audio_mix_buffer;
 
+	// Frames being encoded on the WorkerThreadPool, written out in order once done.
+	struct EncodeJob {
+		Ref<Image> image;
+		LocalVector<int32_t> audio;
+		Vector<uint8_t> encoded;
+		Error error = OK;
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+	};
+	LocalVector<EncodeJob> encode_ring;
+	uint32_t encode_ring_head = 0;
+	uint32_t encode_ring_count = 0;
+
+	void _encode_frame_task(EncodeJob *p_job);
+	void _write_oldest_encoded_frame();
+
 	enum {
 		MAX_WRITERS = 8
 	};
@@ -60,6 +76,12 @@ protected:
 	virtual Error write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data);
 	virtual void write_end();
 
+	// Writers returning true have their frames encoded on worker threads with encode_frame(),
+	// then passed in order to write_encoded_frame() on the main thread, instead of write_frame().
+	virtual bool has_threaded_encoder() const { return false; }
+	virtual Error encode_frame(const Ref<Image> &p_image, Vector<uint8_t> &r_encoded_frame) { return ERR_UNAVAILABLE; }
+	virtual Error write_encoded_frame(const Vector<uint8_t> &p_encoded_frame, const int32_t *p_audio_data) { return ERR_UNAVAILABLE; }
+
 	GDVIRTUAL0RC(uint32_t, _get_audio_mix_rate)
 	GDVIRTUAL0RC(AudioServer::SpeakerMode, _get_audio_speaker_mode)
 
@@ -138,12 +138,23 @@ Error MovieWriterPNGWAV::write_begin(const Size2i &p_movie_size, uint32_t p_fps,
 }
 
 Error MovieWriterPNGWAV::write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data) {
-	ERR_FAIL_COND_V(!f_wav.is_valid(), ERR_UNCONFIGURED);
+	Vector<uint8_t> png_buffer;
+	Error err = encode_frame(p_image, png_buffer);
+	ERR_FAIL_COND_V(err != OK, err);
+	return write_encoded_frame(png_buffer, p_audio_data);
+}
 
-	Vector<uint8_t> png_buffer = p_image->save_png_to_buffer();
+Error MovieWriterPNGWAV::encode_frame(const Ref<Image> &p_image, Vector<uint8_t> &r_encoded_frame) {
+	r_encoded_frame = p_image->save_png_to_buffer();
+	return r_encoded_frame.is_empty() ? ERR_CANT_CREATE : OK;
+}
+
+Error MovieWriterPNGWAV::write_encoded_frame(const Vector<uint8_t> &p_encoded_frame, const int32_t *p_audio_data) {
+	ERR_FAIL_COND_V(!f_wav.is_valid(), ERR_UNCONFIGURED);
 
 	Ref<FileAccess> fi = FileAccess::open(base_path + zeros_str(frame_count) + ".png", FileAccess::WRITE);
-	fi->store_buffer(png_buffer.ptr(), png_buffer.size());
+	ERR_FAIL_COND_V(fi.is_null(), ERR_CANT_OPEN);
+	fi->store_buffer(p_encoded_frame.ptr(), p_encoded_frame.size());
 	f_wav->store_buffer((const uint8_t *)p_audio_data, audio_block_size);
 
 	frame_count++;
@@ -260,6 +260,13 @@ public:
 
 	virtual NavigationUtilities::PathQueryResult _query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const = 0;
 
+	/// Queues a batch of path queries that are processed on worker threads.
+	/// Once all of them are done, the callback is called during `process` with
+	/// an array of `NavigationPathQueryResult3D`, in the same order as the queries.
+	void query_paths_async(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const Callable &p_callback) const;
+
+	virtual void _query_paths_async(const Vector<NavigationUtilities::PathQueryParameters> &p_parameters, const Callable &p_callback) const = 0;
+
 	NavigationServer3D();
 	virtual ~NavigationServer3D();
 
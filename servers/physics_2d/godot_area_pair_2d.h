@@ -49,6 +49,8 @@ public:
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual OrderKey get_order_key() const override { return OrderKey::from_pair(body->get_self(), body_shape, area->get_self(), area_shape); }
+
 	GodotAreaPair2D(GodotBody2D *p_body, int p_body_shape, GodotArea2D *p_area, int p_area_shape);
 	~GodotAreaPair2D();
 };
@@ -70,6 +72,8 @@ public:
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual OrderKey get_order_key() const override { return OrderKey::from_pair(area_a->get_self(), shape_a, area_b->get_self(), shape_b); }
+
 	GodotArea2Pair2D(GodotArea2D *p_area_a, int p_shape_a, GodotArea2D *p_area_b, int p_shape_b);
 	~GodotArea2Pair2D();
 };
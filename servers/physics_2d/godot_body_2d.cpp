@@ -148,6 +148,60 @@ void GodotBody2D::set_active(bool p_active) {
 	}
 }
 
+void GodotBody2D::save_snapshot(PhysicsSnapshotWriter &p_writer) const {
+	p_writer.put_u32(mode);
+	p_writer.put_transform_2d(get_transform());
+	p_writer.put_transform_2d(get_inv_transform());
+	p_writer.put_transform_2d(new_transform);
+	p_writer.put_vector2(linear_velocity);
+	p_writer.put_real(angular_velocity);
+	p_writer.put_vector2(prev_linear_velocity);
+	p_writer.put_real(prev_angular_velocity);
+	p_writer.put_vector2(constant_linear_velocity);
+	p_writer.put_real(constant_angular_velocity);
+	p_writer.put_vector2(applied_force);
+	p_writer.put_real(applied_torque);
+	p_writer.put_vector2(constant_force);
+	p_writer.put_real(constant_torque);
+	p_writer.put_real(still_time);
+	p_writer.put_u32((active ? 1 : 0) | (can_sleep ? 2 : 0) | (first_time_kinematic ? 4 : 0));
+}
+
+void GodotBody2D::restore_snapshot(PhysicsSnapshotReader &p_reader) {
+	uint32_t snapshot_mode = p_reader.get_u32();
+	ERR_FAIL_COND_MSG(snapshot_mode != uint32_t(mode), "Body mode changed since the snapshot was taken, its state can't be restored.");
+
+	Transform2D transform = p_reader.get_transform_2d();
+	Transform2D inv_transform = p_reader.get_transform_2d();
+	new_transform = p_reader.get_transform_2d();
+	linear_velocity = p_reader.get_vector2();
+	angular_velocity = p_reader.get_real();
+	prev_linear_velocity = p_reader.get_vector2();
+	prev_angular_velocity = p_reader.get_real();
+	constant_linear_velocity = p_reader.get_vector2();
+	constant_angular_velocity = p_reader.get_real();
+	applied_force = p_reader.get_vector2();
+	applied_torque = p_reader.get_real();
+	constant_force = p_reader.get_vector2();
+	constant_torque = p_reader.get_real();
+	still_time = p_reader.get_real();
+	uint32_t flags = p_reader.get_u32();
+	can_sleep = flags & 2;
+	first_time_kinematic = flags & 4;
+
+	_set_transform(transform);
+	_set_inv_transform(inv_transform);
+	if (mode >= PhysicsServer2D::BODY_MODE_RIGID) {
+		_update_transform_dependent();
+	}
+	set_active(flags & 1);
+
+	if (get_space() && !direct_state_query_list.in_list()) {
+		// Let the node pick up the restored transform.
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+}
+
 void GodotBody2D::set_param(PhysicsServer2D::BodyParameter p_param, const Variant &p_value) {
 	switch (p_param) {
 		case PhysicsServer2D::BODY_PARAM_BOUNCE: {
@@ -604,7 +658,8 @@ void GodotBody2D::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector2();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		pending_integration |= PENDING_SHAPES_MOTION;
+		pending_motion = motion;
 	}
 
 	contact_count = 0;
@@ -616,14 +671,14 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 	}
 
 	if (fi_callback_data || body_state_callback.get_object()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		pending_integration |= PENDING_STATE_QUERY;
 	}
 
 	if (mode == PhysicsServer2D::BODY_MODE_KINEMATIC) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.size() == 0 && linear_velocity == Vector2() && angular_velocity == 0) {
-			set_active(false); //stopped moving, deactivate
+			pending_integration |= PENDING_DEACTIVATE; //stopped moving, deactivate
 		}
 		return;
 	}
@@ -640,8 +695,11 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 		pos += center_of_mass - center_of_mass.rotated(angle_delta);
 	}
 
-	_set_transform(Transform2D(angle, pos), continuous_cd_mode == PhysicsServer2D::CCD_MODE_DISABLED);
+	_set_transform(Transform2D(angle, pos), false);
 	_set_inv_transform(get_transform().inverse());
+	if (continuous_cd_mode == PhysicsServer2D::CCD_MODE_DISABLED) {
+		pending_integration |= PENDING_SHAPES_UPDATE;
+	}
 
 	if (continuous_cd_mode != PhysicsServer2D::CCD_MODE_DISABLED) {
 		new_transform = get_transform();
@@ -650,6 +708,21 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 	_update_transform_dependent();
 }
 
+void GodotBody2D::finish_integration() {
+	if (pending_integration & PENDING_SHAPES_MOTION) {
+		_update_shapes_with_motion(pending_motion);
+	} else if (pending_integration & PENDING_SHAPES_UPDATE) {
+		_set_transform(get_transform());
+	}
+	if (pending_integration & PENDING_STATE_QUERY) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+	if (pending_integration & PENDING_DEACTIVATE) {
+		set_active(false);
+	}
+	pending_integration = 0;
+}
+
 void GodotBody2D::wakeup_neighbours() {
 	for (const Pair<GodotConstraint2D *, int> &E : constraint_list) {
 		const GodotConstraint2D *c = E.first;
@@ -37,6 +37,7 @@
 #include "core/templates/list.h"
 #include "core/templates/pair.h"
 #include "core/templates/vset.h"
+#include "servers/physics_snapshot.h"
 
 class GodotConstraint2D;
 class GodotPhysicsDirectBodyState2D;
@@ -137,6 +138,16 @@ class GodotBody2D : public GodotCollisionObject2D {
 	Vector<Contact> contacts; //no contacts by default
 	int contact_count = 0;
 
+	// Space updates left by the integration steps for finish_integration().
+	enum {
+		PENDING_SHAPES_MOTION = 1,
+		PENDING_SHAPES_UPDATE = 2,
+		PENDING_STATE_QUERY = 4,
+		PENDING_DEACTIVATE = 8,
+	};
+	uint32_t pending_integration = 0;
+	Vector2 pending_motion;
+
 	Callable body_state_callback;
 
 	struct ForceIntegrationCallbackData {
@@ -280,6 +291,10 @@ public:
 	real_t get_constant_torque() const { return constant_torque; }
 
 	void set_active(bool p_active);
+
+	// Space snapshots only hold the simulated state, the body configuration must match when restoring.
+	void save_snapshot(PhysicsSnapshotWriter &p_writer) const;
+	void restore_snapshot(PhysicsSnapshotReader &p_reader);
 	_FORCE_INLINE_ bool is_active() const { return active; }
 
 	_FORCE_INLINE_ void wakeup() {
@@ -313,8 +328,12 @@ public:
 	_FORCE_INLINE_ real_t get_friction() const { return friction; }
 	_FORCE_INLINE_ real_t get_bounce() const { return bounce; }
 
+	// The integration steps only modify the body itself, so they can run in parallel for
+	// different bodies. finish_integration() must then be called serially after each of
+	// them, to update the broadphase and the space lists.
 	void integrate_forces(real_t p_step);
 	void integrate_velocities(real_t p_step);
+	void finish_integration();
 
 	_FORCE_INLINE_ Vector2 get_velocity_in_local_point(const Vector2 &rel_pos) const {
 		return linear_velocity + Vector2(-angular_velocity * rel_pos.y, angular_velocity * rel_pos.x);
@@ -571,6 +571,46 @@ void GodotBodyPair2D::solve(real_t p_step) {
 	}
 }
 
+bool GodotBodyPair2D::save_snapshot(PhysicsSnapshotWriter &p_writer) const {
+	// Only what carries over to the next step is stored, the rest is rebuilt by setup().
+	p_writer.put_vector2(sep_axis);
+	p_writer.put_u32(contact_count);
+	for (int i = 0; i < contact_count; i++) {
+		const Contact &c = contacts[i];
+		p_writer.put_vector2(c.local_A);
+		p_writer.put_vector2(c.local_B);
+		p_writer.put_vector2(c.normal);
+		p_writer.put_real(c.acc_normal_impulse);
+		p_writer.put_real(c.acc_tangent_impulse);
+		p_writer.put_real(c.acc_bias_impulse);
+		p_writer.put_real(c.acc_bias_impulse_center_of_mass);
+		p_writer.put_u32(c.used);
+	}
+	return true;
+}
+
+void GodotBodyPair2D::restore_snapshot(PhysicsSnapshotReader &p_reader) {
+	sep_axis = p_reader.get_vector2();
+	contact_count = MIN(int(p_reader.get_u32()), int(MAX_CONTACTS));
+	for (int i = 0; i < contact_count; i++) {
+		Contact &c = contacts[i];
+		c = Contact();
+		c.local_A = p_reader.get_vector2();
+		c.local_B = p_reader.get_vector2();
+		c.normal = p_reader.get_vector2();
+		c.acc_normal_impulse = p_reader.get_real();
+		c.acc_tangent_impulse = p_reader.get_real();
+		c.acc_bias_impulse = p_reader.get_real();
+		c.acc_bias_impulse_center_of_mass = p_reader.get_real();
+		c.used = p_reader.get_u32();
+	}
+}
+
+void GodotBodyPair2D::reset_snapshot_state() {
+	sep_axis = Vector2();
+	contact_count = 0;
+}
+
 GodotBodyPair2D::GodotBodyPair2D(GodotBody2D *p_A, int p_shape_A, GodotBody2D *p_B, int p_shape_B) :
 		GodotConstraint2D(_arr, 2) {
 	A = p_A;
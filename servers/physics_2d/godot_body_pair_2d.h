@@ -93,6 +93,11 @@ public:
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual OrderKey get_order_key() const override { return OrderKey::from_pair(A->get_self(), shape_A, B->get_self(), shape_B); }
+	virtual bool save_snapshot(PhysicsSnapshotWriter &p_writer) const override;
+	virtual void restore_snapshot(PhysicsSnapshotReader &p_reader) override;
+	virtual void reset_snapshot_state() override;
+
 	GodotBodyPair2D(GodotBody2D *p_A, int p_shape_A, GodotBody2D *p_B, int p_shape_B);
 	~GodotBodyPair2D();
 };
@@ -33,6 +33,9 @@
 
 #include "godot_body_2d.h"
 
+#include "core/templates/hashfuncs.h"
+#include "servers/physics_snapshot.h"
+
 class GodotConstraint2D {
 	GodotBody2D **_body_ptr;
 	int _body_count;
@@ -48,6 +51,52 @@ protected:
 	}
 
 public:
+	// Identity that doesn't depend on creation order. Used to sort islands when the solver
+	// order must be deterministic, and to find constraints again when restoring snapshots.
+	struct OrderKey {
+		uint64_t a = 0;
+		uint64_t b = 0;
+		uint64_t shapes = 0;
+
+		_FORCE_INLINE_ bool operator<(const OrderKey &p_key) const {
+			if (a != p_key.a) {
+				return a < p_key.a;
+			}
+			if (b != p_key.b) {
+				return b < p_key.b;
+			}
+			return shapes < p_key.shapes;
+		}
+		_FORCE_INLINE_ bool operator==(const OrderKey &p_key) const { return a == p_key.a && b == p_key.b && shapes == p_key.shapes; }
+
+		static _FORCE_INLINE_ uint32_t hash(const OrderKey &p_key) {
+			uint32_t h = hash_murmur3_one_64(p_key.a);
+			h = hash_murmur3_one_64(p_key.b, h);
+			h = hash_murmur3_one_64(p_key.shapes, h);
+			return hash_fmix32(h);
+		}
+
+		static _FORCE_INLINE_ OrderKey from_pair(const RID &p_a, int p_shape_a, const RID &p_b, int p_shape_b) {
+			OrderKey key;
+			key.a = p_a.get_id();
+			key.b = p_b.get_id();
+			key.shapes = (uint64_t(uint32_t(p_shape_a)) << 32) | uint32_t(p_shape_b);
+			return key;
+		}
+	};
+
+	virtual OrderKey get_order_key() const {
+		OrderKey key;
+		key.a = self.get_id();
+		return key;
+	}
+
+	// State kept from one step to the next (such as cached contacts), for space snapshots.
+	// save_snapshot() returns false for constraints that don't keep any.
+	virtual bool save_snapshot(PhysicsSnapshotWriter &p_writer) const { return false; }
+	virtual void restore_snapshot(PhysicsSnapshotReader &p_reader) {}
+	virtual void reset_snapshot_state() {}
+
 	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
 	_FORCE_INLINE_ RID get_self() const { return self; }
 
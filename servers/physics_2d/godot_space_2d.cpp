@@ -35,6 +35,7 @@
 
 #include "core/os/os.h"
 #include "core/templates/pair.h"
+#include "core/templates/sort_array.h"
 
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
@@ -1019,6 +1020,13 @@ void *GodotSpace2D::_broadphase_pair(GodotCollisionObject2D *A, int p_subindex_A
 	}
 
 	GodotSpace2D *self = static_cast<GodotSpace2D *>(p_self);
+
+	if (self->deterministic_order && type_A == type_B && A->get_self().get_id() > B->get_self().get_id()) {
+		// Which object the broadphase reports first depends on the order they moved in.
+		SWAP(A, B);
+		SWAP(p_subindex_A, p_subindex_B);
+	}
+
 	self->collision_pairs++;
 
 	if (type_A == GodotCollisionObject2D::TYPE_AREA) {
@@ -1215,6 +1223,159 @@ GodotPhysicsDirectSpaceState2D *GodotSpace2D::get_direct_state() {
 	return direct_access;
 }
 
+#define SNAPSHOT_MAGIC 0x32535047 // "GPS2"
+#define SNAPSHOT_VERSION 1
+
+void GodotSpace2D::_get_snapshot_bodies(LocalVector<GodotBody2D *> &r_bodies) const {
+	struct BodyRIDCompare {
+		_FORCE_INLINE_ bool operator()(const GodotBody2D *p_a, const GodotBody2D *p_b) const {
+			return p_a->get_self().get_id() < p_b->get_self().get_id();
+		}
+	};
+
+	for (GodotCollisionObject2D *E : objects) {
+		if (E->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			r_bodies.push_back(static_cast<GodotBody2D *>(E));
+		}
+	}
+
+	SortArray<GodotBody2D *, BodyRIDCompare> sorter;
+	sorter.sort(r_bodies.ptr(), r_bodies.size());
+}
+
+void GodotSpace2D::_get_snapshot_constraints(const LocalVector<GodotBody2D *> &p_bodies, LocalVector<SnapshotConstraint> &r_constraints) const {
+	for (uint32_t i = 0; i < p_bodies.size(); i++) {
+		for (const Pair<GodotConstraint2D *, int> &E : p_bodies[i]->get_constraint_list()) {
+			// Only listed from their first body, as they're in the list of every body they link.
+			if (E.first->get_body_ptr()[0] != p_bodies[i]) {
+				continue;
+			}
+			SnapshotConstraint constraint;
+			constraint.key = E.first->get_order_key();
+			constraint.constraint = E.first;
+			r_constraints.push_back(constraint);
+		}
+	}
+
+	// Sorted, so that equal states always give equal snapshots.
+	r_constraints.sort();
+}
+
+Vector<uint8_t> GodotSpace2D::create_snapshot() const {
+	ERR_FAIL_COND_V_MSG(locked, Vector<uint8_t>(), "Can't take a snapshot of a space while it's being stepped.");
+
+	LocalVector<GodotBody2D *> bodies;
+	_get_snapshot_bodies(bodies);
+
+	PhysicsSnapshotWriter writer;
+	writer.put_u32(SNAPSHOT_MAGIC);
+	writer.put_u32(SNAPSHOT_VERSION);
+	writer.put_u32(sizeof(real_t));
+
+	// Records are prefixed with their size, so that restoring can skip the ones it has no use for.
+	writer.put_u32(bodies.size());
+	for (uint32_t i = 0; i < bodies.size(); i++) {
+		writer.put_u64(bodies[i]->get_self().get_id());
+		uint32_t size_position = writer.get_position();
+		writer.put_u32(0);
+		bodies[i]->save_snapshot(writer);
+		writer.set_u32(size_position, writer.get_position() - size_position - 4);
+	}
+
+	LocalVector<SnapshotConstraint> constraints;
+	_get_snapshot_constraints(bodies, constraints);
+
+	uint32_t count_position = writer.get_position();
+	writer.put_u32(0);
+	uint32_t constraint_count = 0;
+	for (uint32_t i = 0; i < constraints.size(); i++) {
+		uint32_t record_position = writer.get_position();
+		writer.put_u64(constraints[i].key.a);
+		writer.put_u64(constraints[i].key.b);
+		writer.put_u64(constraints[i].key.shapes);
+		uint32_t size_position = writer.get_position();
+		writer.put_u32(0);
+		if (!constraints[i].constraint->save_snapshot(writer)) {
+			writer.truncate(record_position);
+			continue;
+		}
+		writer.set_u32(size_position, writer.get_position() - size_position - 4);
+		constraint_count++;
+	}
+	writer.set_u32(count_position, constraint_count);
+
+	return writer.get_data();
+}
+
+bool GodotSpace2D::restore_snapshot(const Vector<uint8_t> &p_snapshot) {
+	ERR_FAIL_COND_V_MSG(locked, false, "Can't restore a snapshot of a space while it's being stepped.");
+
+	PhysicsSnapshotReader reader(p_snapshot.ptr(), p_snapshot.size());
+	ERR_FAIL_COND_V_MSG(reader.get_u32() != SNAPSHOT_MAGIC, false, "Invalid physics space snapshot.");
+	ERR_FAIL_COND_V_MSG(reader.get_u32() != SNAPSHOT_VERSION, false, "Unsupported physics space snapshot version.");
+	ERR_FAIL_COND_V_MSG(reader.get_u32() != sizeof(real_t), false, "Physics space snapshot was created with a different floating-point precision.");
+
+	HashMap<uint64_t, GodotBody2D *> bodies;
+	for (GodotCollisionObject2D *E : objects) {
+		if (E->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			bodies.insert(E->get_self().get_id(), static_cast<GodotBody2D *>(E));
+		}
+	}
+
+	// Check the bodies first, so that a snapshot that doesn't match the space is refused before changing anything.
+	uint32_t body_count = reader.get_u32();
+	uint32_t bodies_position = reader.get_position();
+	for (uint32_t i = 0; i < body_count && !reader.has_overflowed(); i++) {
+		uint64_t id = reader.get_u64();
+		uint32_t size = reader.get_u32();
+		ERR_FAIL_COND_V_MSG(!bodies.has(id), false, "Physics space snapshot refers to a body that isn't in this space anymore.");
+		reader.seek(reader.get_position() + size);
+	}
+	ERR_FAIL_COND_V_MSG(reader.has_overflowed(), false, "Physics space snapshot is truncated.");
+
+	reader.seek(bodies_position);
+	for (uint32_t i = 0; i < body_count; i++) {
+		GodotBody2D *body = bodies[reader.get_u64()];
+		uint32_t size = reader.get_u32();
+		uint32_t record_end = reader.get_position() + size;
+		body->restore_snapshot(reader);
+		reader.seek(record_end);
+	}
+
+	// Pair the restored positions right away, so the new pairs can get their cached state back too.
+	broadphase->update();
+
+	HashMap<GodotConstraint2D::OrderKey, GodotConstraint2D *, GodotConstraint2D::OrderKey> constraints;
+	for (const KeyValue<uint64_t, GodotBody2D *> &E : bodies) {
+		for (const Pair<GodotConstraint2D *, int> &C : E.value->get_constraint_list()) {
+			if (C.first->get_body_ptr()[0] == E.value) {
+				C.first->reset_snapshot_state();
+				constraints.insert(C.first->get_order_key(), C.first);
+			}
+		}
+	}
+
+	uint32_t constraint_count = reader.get_u32();
+	for (uint32_t i = 0; i < constraint_count && !reader.has_overflowed(); i++) {
+		GodotConstraint2D::OrderKey key;
+		key.a = reader.get_u64();
+		key.b = reader.get_u64();
+		key.shapes = reader.get_u64();
+		uint32_t size = reader.get_u32();
+		uint32_t record_end = reader.get_position() + size;
+
+		// Pairs that aren't overlapping anymore are gone, along with their state.
+		GodotConstraint2D **constraint = constraints.getptr(key);
+		if (constraint) {
+			(*constraint)->restore_snapshot(reader);
+		}
+		reader.seek(record_end);
+	}
+	ERR_FAIL_COND_V_MSG(reader.has_overflowed(), false, "Physics space snapshot is truncated.");
+
+	return true;
+}
+
 GodotSpace2D::GodotSpace2D() {
 	body_linear_velocity_sleep_threshold = GLOBAL_DEF("physics/2d/sleep_threshold_linear", 2.0);
 	body_angular_velocity_sleep_threshold = GLOBAL_DEF("physics/2d/sleep_threshold_angular", Math::deg_to_rad(8.0));
@@ -1224,6 +1385,8 @@ GodotSpace2D::GodotSpace2D() {
 	solver_iterations = GLOBAL_DEF("physics/2d/solver/solver_iterations", 16);
 	ProjectSettings::get_singleton()->set_custom_property_info("physics/2d/solver/solver_iterations", PropertyInfo(Variant::INT, "physics/2d/solver/solver_iterations", PROPERTY_HINT_RANGE, "1,32,1,or_greater"));
 
+	deterministic_order = GLOBAL_DEF("physics/2d/solver/deterministic_order", false);
+
 	contact_recycle_radius = GLOBAL_DEF("physics/2d/solver/contact_recycle_radius", 1.0);
 	ProjectSettings::get_singleton()->set_custom_property_info("physics/2d/solver/contact_recycle_radius", PropertyInfo(Variant::FLOAT, "physics/2d/solver/contact_recycle_radius", PROPERTY_HINT_RANGE, "0,10,0.01,or_greater"));
 
@@ -97,6 +97,7 @@ private:
 	GodotArea2D *area = nullptr;
 
 	int solver_iterations = 0;
+	bool deterministic_order = false;
 
 	real_t contact_recycle_radius = 0.0;
 	real_t contact_max_separation = 0.0;
@@ -125,6 +126,16 @@ private:
 
 	int _cull_aabb_for_body(GodotBody2D *p_body, const Rect2 &p_aabb);
 
+	struct SnapshotConstraint {
+		GodotConstraint2D::OrderKey key;
+		GodotConstraint2D *constraint = nullptr;
+
+		bool operator<(const SnapshotConstraint &p_other) const { return key < p_other.key; }
+	};
+
+	void _get_snapshot_bodies(LocalVector<GodotBody2D *> &r_bodies) const;
+	void _get_snapshot_constraints(const LocalVector<GodotBody2D *> &p_bodies, LocalVector<SnapshotConstraint> &r_constraints) const;
+
 	Vector<Vector2> contact_debug;
 	int contact_debug_count = 0;
 
@@ -159,6 +170,7 @@ public:
 	const HashSet<GodotCollisionObject2D *> &get_objects() const;
 
 	_FORCE_INLINE_ int get_solver_iterations() const { return solver_iterations; }
+	_FORCE_INLINE_ bool is_deterministic_order() const { return deterministic_order; }
 	_FORCE_INLINE_ real_t get_contact_recycle_radius() const { return contact_recycle_radius; }
 	_FORCE_INLINE_ real_t get_contact_max_separation() const { return contact_max_separation; }
 	_FORCE_INLINE_ real_t get_contact_max_allowed_penetration() const { return contact_max_allowed_penetration; }
@@ -204,6 +216,9 @@ public:
 
 	GodotPhysicsDirectSpaceState2D *get_direct_state();
 
+	Vector<uint8_t> create_snapshot() const;
+	bool restore_snapshot(const Vector<uint8_t> &p_snapshot);
+
 	void set_elapsed_time(ElapsedTime p_time, uint64_t p_msec) { elapsed_time[p_time] = p_msec; }
 	uint64_t get_elapsed_time(ElapsedTime p_time) const { return elapsed_time[p_time]; }
 
@@ -31,12 +31,20 @@
 #include "godot_step_2d.h"
 
 #include "core/os/os.h"
+#include "core/templates/sort_array.h"
 
 #define BODY_ISLAND_COUNT_RESERVE 128
 #define BODY_ISLAND_SIZE_RESERVE 512
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define BODY_INTEGRATION_MIN_PARALLEL_SIZE 64
+
+struct ConstraintOrderCompare {
+	_FORCE_INLINE_ bool operator()(const GodotConstraint2D *p_a, const GodotConstraint2D *p_b) const {
+		return p_a->get_order_key() < p_b->get_order_key();
+	}
+};
 
 void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -71,6 +79,21 @@ void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D
 	}
 }
 
+void GodotStep2D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void GodotStep2D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities(delta);
+}
+
+void GodotStep2D::_finish_integration() {
+	// Serially and in order, so the broadphase gets the same changes as when integrating serially.
+	for (uint32_t i = 0; i < active_bodies.size(); i++) {
+		active_bodies[i]->finish_integration();
+	}
+}
+
 void GodotStep2D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
 	GodotConstraint2D *constraint = all_constraints[p_constraint_index];
 	constraint->setup(delta);
@@ -143,12 +166,24 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	int active_count = 0;
 
+	// Bodies can deactivate while integrating, so the active list is copied first.
+	active_bodies.clear();
 	const SelfList<GodotBody2D> *b = body_list->first();
 	while (b) {
-		b->self()->integrate_forces(p_delta);
+		active_bodies.push_back(b->self());
 		b = b->next();
-		active_count++;
 	}
+	active_count += active_bodies.size();
+
+	if (active_bodies.size() >= BODY_INTEGRATION_MIN_PARALLEL_SIZE) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_integrate_forces, nullptr, active_bodies.size(), -1, true, SNAME("Physics2DIntegrateForces"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < active_bodies.size(); i++) {
+			_integrate_forces(i);
+		}
+	}
+	_finish_integration();
 
 	p_space->set_active_objects(active_count);
 
@@ -238,9 +273,27 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
-	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	WorkerThreadPool::GroupID group_task;
+	if (p_space->is_deterministic_order()) {
+		// The order islands are discovered in depends on the history of the space, sort them
+		// so they are solved the same way whatever the previous steps were.
+		SortArray<GodotConstraint2D *, ConstraintOrderCompare> sorter;
+		all_constraints.clear();
+		for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+			LocalVector<GodotConstraint2D *> &constraint_island = constraint_islands[island_index];
+			sorter.sort(constraint_island.ptr(), constraint_island.size());
+			for (uint32_t constraint_index = 0; constraint_index < constraint_island.size(); ++constraint_index) {
+				all_constraints.push_back(constraint_island[constraint_index]);
+			}
+		}
+		for (uint32_t constraint_index = 0; constraint_index < all_constraints.size(); ++constraint_index) {
+			_setup_constraint(constraint_index);
+		}
+	} else {
+		uint32_t total_constraint_count = all_constraints.size();
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
@@ -270,12 +323,23 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
+	// Solving may have woken up bodies.
+	active_bodies.clear();
 	b = body_list->first();
 	while (b) {
-		const SelfList<GodotBody2D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n; // in case it shuts itself down
+		active_bodies.push_back(b->self());
+		b = b->next();
+	}
+
+	if (active_bodies.size() >= BODY_INTEGRATION_MIN_PARALLEL_SIZE) {
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_integrate_velocities, nullptr, active_bodies.size(), -1, true, SNAME("Physics2DIntegrateVelocities"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < active_bodies.size(); i++) {
+			_integrate_velocities(i);
+		}
 	}
+	_finish_integration();
 
 	/* SLEEP / WAKE UP ISLANDS */
 
@@ -80,12 +80,18 @@ void GodotArea3D::set_space(GodotSpace3D *p_space) {
 		}
 	}
 
-	monitored_bodies.clear();
-	monitored_areas.clear();
+	_clear_monitored();
 
 	_set_space(p_space);
 }
 
+void GodotArea3D::_clear_monitored() {
+	monitored_bodies.clear();
+	monitored_areas.clear();
+	overlapping_bodies.clear();
+	overlapping_areas.clear();
+}
+
 void GodotArea3D::set_monitor_callback(const Callable &p_callback) {
 	ObjectID id = p_callback.get_object_id();
 	if (id == monitor_callback.get_object_id()) {
@@ -97,8 +103,7 @@ void GodotArea3D::set_monitor_callback(const Callable &p_callback) {
 
 	monitor_callback = p_callback;
 
-	monitored_bodies.clear();
-	monitored_areas.clear();
+	_clear_monitored();
 
 	_shape_changed();
 
@@ -118,8 +123,7 @@ void GodotArea3D::set_area_monitor_callback(const Callable &p_callback) {
 
 	area_monitor_callback = p_callback;
 
-	monitored_bodies.clear();
-	monitored_areas.clear();
+	_clear_monitored();
 
 	_shape_changed();
 
@@ -245,9 +249,83 @@ void GodotArea3D::set_monitorable(bool p_monitorable) {
 	_shapes_changed();
 }
 
+static void _update_overlapping(HashMap<RID, uint32_t> &r_overlapping, const RID &p_rid, int p_state) {
+	if (p_state > 0) {
+		HashMap<RID, uint32_t>::Iterator E = r_overlapping.find(p_rid);
+		if (E) {
+			E->value++;
+		} else {
+			r_overlapping.insert(p_rid, 1);
+		}
+	} else {
+		HashMap<RID, uint32_t>::Iterator E = r_overlapping.find(p_rid);
+		if (E && --E->value == 0) {
+			r_overlapping.remove(E);
+		}
+	}
+}
+
+void GodotArea3D::_call_queries_batched(HashMap<BodyKey, BodyState, BodyKey> &r_monitored, HashMap<RID, uint32_t> &r_overlapping, const Callable &p_callback) {
+	// All changes of this step are reported in a single call, as parallel arrays.
+	PackedInt32Array statuses;
+	Array rids;
+	PackedInt64Array instance_ids;
+	PackedInt32Array object_shapes;
+	PackedInt32Array self_shapes;
+
+	for (const KeyValue<BodyKey, BodyState> &E : r_monitored) {
+		if (E.value.state == 0) { // Nothing happened
+			continue;
+		}
+
+		_update_overlapping(r_overlapping, E.key.rid, E.value.state);
+
+		statuses.push_back(E.value.state > 0 ? PhysicsServer3D::AREA_BODY_ADDED : PhysicsServer3D::AREA_BODY_REMOVED);
+		rids.push_back(E.key.rid);
+		instance_ids.push_back(int64_t(uint64_t(E.key.instance_id)));
+		object_shapes.push_back(E.key.body_shape);
+		self_shapes.push_back(E.key.area_shape);
+	}
+
+	r_monitored.clear();
+
+	if (statuses.is_empty()) {
+		return;
+	}
+
+	Variant res[5] = { statuses, rids, instance_ids, object_shapes, self_shapes };
+	const Variant *resptr[5] = { &res[0], &res[1], &res[2], &res[3], &res[4] };
+
+	Callable::CallError ce;
+	Variant ret;
+	p_callback.callp(resptr, 5, ret, ce);
+
+	if (ce.error != Callable::CallError::CALL_OK) {
+		ERR_PRINT_ONCE("Error calling batched monitor callback method " + Variant::get_callable_error_text(p_callback, resptr, 5, ce));
+	}
+}
+
+void GodotArea3D::get_overlapping_bodies(List<RID> *p_bodies) const {
+	for (const KeyValue<RID, uint32_t> &E : overlapping_bodies) {
+		p_bodies->push_back(E.key);
+	}
+}
+
+void GodotArea3D::get_overlapping_areas(List<RID> *p_areas) const {
+	for (const KeyValue<RID, uint32_t> &E : overlapping_areas) {
+		p_areas->push_back(E.key);
+	}
+}
+
 void GodotArea3D::call_queries() {
 	if (!monitor_callback.is_null() && !monitored_bodies.is_empty()) {
-		if (monitor_callback.is_valid()) {
+		if (!monitor_callback.is_valid()) {
+			monitored_bodies.clear();
+			overlapping_bodies.clear();
+			monitor_callback = Callable();
+		} else if (monitor_batched) {
+			_call_queries_batched(monitored_bodies, overlapping_bodies, monitor_callback);
+		} else {
 			Variant res[5];
 			Variant *resptr[5];
 			for (int i = 0; i < 5; i++) {
@@ -263,6 +341,8 @@ void GodotArea3D::call_queries() {
 					continue;
 				}
 
+				_update_overlapping(overlapping_bodies, E->key.rid, E->value.state);
+
 				res[0] = E->value.state > 0 ? PhysicsServer3D::AREA_BODY_ADDED : PhysicsServer3D::AREA_BODY_REMOVED;
 				res[1] = E->key.rid;
 				res[2] = E->key.instance_id;
@@ -282,14 +362,17 @@ void GodotArea3D::call_queries() {
 					ERR_PRINT_ONCE("Error calling monitor callback method " + Variant::get_callable_error_text(monitor_callback, (const Variant **)resptr, 5, ce));
 				}
 			}
-		} else {
-			monitored_bodies.clear();
-			monitor_callback = Callable();
 		}
 	}
 
 	if (!area_monitor_callback.is_null() && !monitored_areas.is_empty()) {
-		if (area_monitor_callback.is_valid()) {
+		if (!area_monitor_callback.is_valid()) {
+			monitored_areas.clear();
+			overlapping_areas.clear();
+			area_monitor_callback = Callable();
+		} else if (monitor_batched) {
+			_call_queries_batched(monitored_areas, overlapping_areas, area_monitor_callback);
+		} else {
 			Variant res[5];
 			Variant *resptr[5];
 			for (int i = 0; i < 5; i++) {
@@ -305,6 +388,8 @@ void GodotArea3D::call_queries() {
 					continue;
 				}
 
+				_update_overlapping(overlapping_areas, E->key.rid, E->value.state);
+
 				res[0] = E->value.state > 0 ? PhysicsServer3D::AREA_BODY_ADDED : PhysicsServer3D::AREA_BODY_REMOVED;
 				res[1] = E->key.rid;
 				res[2] = E->key.instance_id;
@@ -324,9 +409,6 @@ void GodotArea3D::call_queries() {
 					ERR_PRINT_ONCE("Error calling area monitor callback method " + Variant::get_callable_error_text(area_monitor_callback, (const Variant **)resptr, 5, ce));
 				}
 			}
-		} else {
-			monitored_areas.clear();
-			area_monitor_callback = Callable();
 		}
 	}
 }
@@ -99,6 +99,12 @@ class GodotArea3D : public GodotCollisionObject3D {
 	HashMap<BodyKey, BodyState, BodyKey> monitored_bodies;
 	HashMap<BodyKey, BodyState, BodyKey> monitored_areas;
 
+	// Objects currently overlapping a monitoring area, with their number of overlapping shape pairs.
+	HashMap<RID, uint32_t> overlapping_bodies;
+	HashMap<RID, uint32_t> overlapping_areas;
+
+	bool monitor_batched = false;
+
 	HashSet<GodotConstraint3D *> constraints;
 
 	virtual void _shapes_changed() override;
@@ -106,6 +112,9 @@ class GodotArea3D : public GodotCollisionObject3D {
 
 	void _set_space_override_mode(PhysicsServer3D::AreaSpaceOverrideMode &r_mode, PhysicsServer3D::AreaSpaceOverrideMode p_new_mode);
 
+	void _clear_monitored();
+	void _call_queries_batched(HashMap<BodyKey, BodyState, BodyKey> &r_monitored, HashMap<RID, uint32_t> &r_overlapping, const Callable &p_callback);
+
 public:
 	void set_monitor_callback(const Callable &p_callback);
 	_FORCE_INLINE_ bool has_monitor_callback() const { return !monitor_callback.is_null(); }
@@ -113,6 +122,12 @@ public:
 	void set_area_monitor_callback(const Callable &p_callback);
 	_FORCE_INLINE_ bool has_area_monitor_callback() const { return !area_monitor_callback.is_null(); }
 
+	_FORCE_INLINE_ void set_monitor_batched(bool p_batched) { monitor_batched = p_batched; }
+	_FORCE_INLINE_ bool is_monitor_batched() const { return monitor_batched; }
+
+	void get_overlapping_bodies(List<RID> *p_bodies) const;
+	void get_overlapping_areas(List<RID> *p_areas) const;
+
 	_FORCE_INLINE_ void add_body_to_query(GodotBody3D *p_body, uint32_t p_body_shape, uint32_t p_area_shape);
 	_FORCE_INLINE_ void remove_body_from_query(GodotBody3D *p_body, uint32_t p_body_shape, uint32_t p_area_shape);
 
@@ -189,6 +189,60 @@ void GodotBody3D::set_active(bool p_active) {
 	}
 }
 
+void GodotBody3D::save_snapshot(PhysicsSnapshotWriter &p_writer) const {
+	p_writer.put_u32(mode);
+	p_writer.put_transform_3d(get_transform());
+	p_writer.put_transform_3d(get_inv_transform());
+	p_writer.put_transform_3d(new_transform);
+	p_writer.put_vector3(linear_velocity);
+	p_writer.put_vector3(angular_velocity);
+	p_writer.put_vector3(prev_linear_velocity);
+	p_writer.put_vector3(prev_angular_velocity);
+	p_writer.put_vector3(constant_linear_velocity);
+	p_writer.put_vector3(constant_angular_velocity);
+	p_writer.put_vector3(applied_force);
+	p_writer.put_vector3(applied_torque);
+	p_writer.put_vector3(constant_force);
+	p_writer.put_vector3(constant_torque);
+	p_writer.put_real(still_time);
+	p_writer.put_u32((active ? 1 : 0) | (can_sleep ? 2 : 0) | (first_time_kinematic ? 4 : 0));
+}
+
+void GodotBody3D::restore_snapshot(PhysicsSnapshotReader &p_reader) {
+	uint32_t snapshot_mode = p_reader.get_u32();
+	ERR_FAIL_COND_MSG(snapshot_mode != uint32_t(mode), "Body mode changed since the snapshot was taken, its state can't be restored.");
+
+	Transform3D transform = p_reader.get_transform_3d();
+	Transform3D inv_transform = p_reader.get_transform_3d();
+	new_transform = p_reader.get_transform_3d();
+	linear_velocity = p_reader.get_vector3();
+	angular_velocity = p_reader.get_vector3();
+	prev_linear_velocity = p_reader.get_vector3();
+	prev_angular_velocity = p_reader.get_vector3();
+	constant_linear_velocity = p_reader.get_vector3();
+	constant_angular_velocity = p_reader.get_vector3();
+	applied_force = p_reader.get_vector3();
+	applied_torque = p_reader.get_vector3();
+	constant_force = p_reader.get_vector3();
+	constant_torque = p_reader.get_vector3();
+	still_time = p_reader.get_real();
+	uint32_t flags = p_reader.get_u32();
+	can_sleep = flags & 2;
+	first_time_kinematic = flags & 4;
+
+	_set_transform(transform);
+	_set_inv_transform(inv_transform);
+	if (mode >= PhysicsServer3D::BODY_MODE_RIGID) {
+		_update_transform_dependent();
+	}
+	set_active(flags & 1);
+
+	if (get_space() && !direct_state_query_list.in_list()) {
+		// Let the node pick up the restored transform.
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+}
+
 void GodotBody3D::set_param(PhysicsServer3D::BodyParameter p_param, const Variant &p_value) {
 	switch (p_param) {
 		case PhysicsServer3D::BODY_PARAM_BOUNCE: {
@@ -663,7 +717,8 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector3();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		pending_integration |= PENDING_SHAPES_MOTION;
+		pending_motion = motion;
 	}
 
 	contact_count = 0;
@@ -675,7 +730,7 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 	}
 
 	if (fi_callback_data || body_state_callback.get_object()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		pending_integration |= PENDING_STATE_QUERY;
 	}
 
 	//apply axis lock linear
@@ -698,7 +753,7 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.size() == 0 && linear_velocity == Vector3() && angular_velocity == Vector3()) {
-			set_active(false); //stopped moving, deactivate
+			pending_integration |= PENDING_DEACTIVATE; //stopped moving, deactivate
 		}
 
 		return;
@@ -727,12 +782,28 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 
 	transform_new.origin += total_linear_velocity * p_step;
 
-	_set_transform(transform_new);
+	_set_transform(transform_new, false);
 	_set_inv_transform(get_transform().inverse());
+	pending_integration |= PENDING_SHAPES_UPDATE;
 
 	_update_transform_dependent();
 }
 
+void GodotBody3D::finish_integration() {
+	if (pending_integration & PENDING_SHAPES_MOTION) {
+		_update_shapes_with_motion(pending_motion);
+	} else if (pending_integration & PENDING_SHAPES_UPDATE) {
+		_set_transform(get_transform());
+	}
+	if (pending_integration & PENDING_STATE_QUERY) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+	if (pending_integration & PENDING_DEACTIVATE) {
+		set_active(false);
+	}
+	pending_integration = 0;
+}
+
 void GodotBody3D::wakeup_neighbours() {
 	for (const KeyValue<GodotConstraint3D *, int> &E : constraint_map) {
 		const GodotConstraint3D *c = E.key;
@@ -35,6 +35,7 @@
 #include "godot_collision_object_3d.h"
 
 #include "core/templates/vset.h"
+#include "servers/physics_snapshot.h"
 
 class GodotConstraint3D;
 class GodotPhysicsDirectBodyState3D;
@@ -131,6 +132,16 @@ class GodotBody3D : public GodotCollisionObject3D {
 	Vector<Contact> contacts; //no contacts by default
 	int contact_count = 0;
 
+	// Space updates left by the integration steps for finish_integration().
+	enum {
+		PENDING_SHAPES_MOTION = 1,
+		PENDING_SHAPES_UPDATE = 2,
+		PENDING_STATE_QUERY = 4,
+		PENDING_DEACTIVATE = 8,
+	};
+	uint32_t pending_integration = 0;
+	Vector3 pending_motion;
+
 	Callable body_state_callback;
 
 	struct ForceIntegrationCallbackData {
@@ -281,6 +292,10 @@ public:
 	void set_active(bool p_active);
 	_FORCE_INLINE_ bool is_active() const { return active; }
 
+	// Space snapshots only hold the simulated state, the body configuration must match when restoring.
+	void save_snapshot(PhysicsSnapshotWriter &p_writer) const;
+	void restore_snapshot(PhysicsSnapshotReader &p_reader);
+
 	_FORCE_INLINE_ void wakeup() {
 		if ((!get_space()) || mode == PhysicsServer3D::BODY_MODE_STATIC || mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
 			return;
@@ -314,8 +329,12 @@ public:
 	void set_axis_lock(PhysicsServer3D::BodyAxis p_axis, bool lock);
 	bool is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const;
 
+	// The integration steps only modify the body itself, so they can run in parallel for
+	// different bodies. finish_integration() must then be called serially after each of
+	// them, to update the broadphase and the space lists.
 	void integrate_forces(real_t p_step);
 	void integrate_velocities(real_t p_step);
+	void finish_integration();
 
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
@@ -161,50 +161,138 @@ void GodotBodyPair3D::validate_contacts() {
 	}
 }
 
-bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B) {
-	Vector3 motion = p_A->get_linear_velocity() * p_step;
-	real_t mlen = motion.length();
-	if (mlen < CMP_EPSILON) {
-		return false;
+Transform3D GodotBodyPair3D::CCDMotion::at(real_t p_t) const {
+	Transform3D xform = from;
+	if (angular > CMP_EPSILON) {
+		Basis rot(angular_axis, angular * p_t);
+		xform.basis = rot * from.basis;
+		xform.origin = rot.xform(from.origin - center) + center;
 	}
+	xform.origin += linear * p_t;
+	return xform;
+}
 
-	Vector3 mnormal = motion / mlen;
+// Returns the fraction of the step at which the shapes get closer than p_margin, or -1 if they don't.
+// Each iteration advances by the distance between the shapes divided by an upper bound of how fast
+// any point of A can approach B, so it can never step past the first contact, rotations included.
+real_t GodotBodyPair3D::_conservative_advancement(const GodotShape3D *p_shape_A, const CCDMotion &p_motion, const GodotShape3D *p_shape_B, const Transform3D &p_xform_B, real_t p_margin) {
+	const int max_iterations = 32;
+	const real_t angular_bound = p_motion.angular * p_motion.radius;
+
+	real_t t = 0.0;
+	for (int i = 0; i < max_iterations; i++) {
+		Vector3 point_A, point_B;
+		if (!GodotCollisionSolver3D::solve_distance(p_shape_A, p_motion.at(t), p_shape_B, p_xform_B, point_A, point_B, AABB())) {
+			// Already overlapping at the start is left to the contacts.
+			return t > 0.0 ? t : -1.0;
+		}
 
-	real_t min = 0.0, max = 0.0;
-	p_A->get_shape(p_shape_A)->project_range(mnormal, p_xform_A, min, max);
+		Vector3 dir = point_B - point_A;
+		real_t distance = dir.length();
+		if (distance <= p_margin) {
+			return t;
+		}
+		dir /= distance;
 
-	// Did it move enough in this direction to even attempt raycast?
-	// Let's say it should move more than 1/3 the size of the object in that axis.
-	bool fast_object = mlen > (max - min) * 0.3;
-	if (!fast_object) {
+		real_t approach_bound = p_motion.linear.dot(dir) + angular_bound;
+		if (approach_bound <= CMP_EPSILON) {
+			return -1.0; // Moving away.
+		}
+
+		t += (distance - p_margin * 0.5) / approach_bound;
+		if (t >= 1.0) {
+			return -1.0;
+		}
+	}
+
+	return t;
+}
+
+bool GodotBodyPair3D::_ccd_concave_callback(void *p_userdata, GodotShape3D *p_convex) {
+	CCDConcaveInfo &info = *(static_cast<CCDConcaveInfo *>(p_userdata));
+
+	real_t toi = _conservative_advancement(info.shape_A, *info.motion, p_convex, *info.transform_B, info.margin);
+	if (toi >= 0.0 && (info.toi < 0.0 || toi < info.toi)) {
+		info.toi = toi;
+	}
+
+	return info.toi == 0.0;
+}
+
+bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B) {
+	GodotShape3D *shape_A = p_A->get_shape(p_shape_A);
+	GodotShape3D *shape_B = p_B->get_shape(p_shape_B);
+	if (shape_A->is_concave()) {
 		return false;
 	}
 
-	// Going too fast in that direction.
+	Vector3 linear_velocity = p_A->get_linear_velocity();
+	Vector3 angular_velocity = p_A->get_angular_velocity();
+
+	CCDMotion motion;
+	motion.from = p_xform_A;
+	motion.linear = linear_velocity * p_step;
+
+	// The body rotates around its center of mass, not around the shape.
+	Transform3D body_xform = p_xform_A * p_A->get_shape_transform(p_shape_A).affine_inverse();
+	motion.center = body_xform.origin + p_A->get_center_of_mass();
 
-	// Cast a segment from support in motion normal, in the same direction of motion by motion length.
-	// Support is the worst case collision point, so real collision happened before.
-	Vector3 s = p_A->get_shape(p_shape_A)->get_support(p_xform_A.basis.xform(mnormal).normalized());
-	Vector3 from = p_xform_A.xform(s);
-	Vector3 to = from + motion;
+	AABB shape_aabb = p_xform_A.xform(shape_A->get_aabb());
+	motion.radius = motion.center.distance_to(shape_aabb.get_center()) + shape_aabb.size.length() * 0.5;
 
-	Transform3D from_inv = p_xform_B.affine_inverse();
+	real_t angular_speed = angular_velocity.length();
+	if (angular_speed > CMP_EPSILON) {
+		motion.angular_axis = angular_velocity / angular_speed;
+		motion.angular = angular_speed * p_step;
+	}
 
-	// Start from a little inside the bounding box.
-	Vector3 local_from = from_inv.xform(from - mnormal * mlen * 0.1);
-	Vector3 local_to = from_inv.xform(to);
+	real_t sweep = motion.linear.length() + motion.angular * motion.radius;
+	if (sweep < CMP_EPSILON) {
+		return false;
+	}
 
-	Vector3 rpos, rnorm;
-	if (!p_B->get_shape(p_shape_B)->intersect_segment(local_from, local_to, rpos, rnorm, true)) {
+	// Did it move enough to even attempt it?
+	// Let's say it should move more than 1/3 the size of the object in the direction of motion.
+	real_t min = 0.0, max = 0.0;
+	if (motion.linear.length_squared() > CMP_EPSILON2) {
+		shape_A->project_range(motion.linear.normalized(), p_xform_A, min, max);
+	} else {
+		max = shape_aabb.size[shape_aabb.get_shortest_axis_index()];
+	}
+	real_t extent = max - min;
+	bool fast_object = sweep > extent * 0.3;
+	if (!fast_object) {
 		return false;
 	}
 
-	// Shorten the linear velocity so it does not hit, but gets close enough,
-	// next frame will hit softly or soft enough.
-	Vector3 hitpos = p_xform_B.xform(rpos);
+	// Stop a little before touching, next step will hit softly or soft enough.
+	real_t margin = extent * 0.01;
+
+	real_t toi = -1.0;
+	if (shape_B->is_concave()) {
+		// Advance against each face close to the swept volume, faces are only valid in the callback.
+		AABB swept_aabb(motion.center - Vector3(motion.radius, motion.radius, motion.radius), Vector3(motion.radius, motion.radius, motion.radius) * 2.0);
+		swept_aabb.merge_with(AABB(swept_aabb.position + motion.linear, swept_aabb.size));
+
+		CCDConcaveInfo info;
+		info.shape_A = shape_A;
+		info.motion = &motion;
+		info.transform_B = &p_xform_B;
+		info.margin = margin;
+
+		static_cast<GodotConcaveShape3D *>(shape_B)->cull(p_xform_B.affine_inverse().xform(swept_aabb), _ccd_concave_callback, &info, false);
+		toi = info.toi;
+	} else {
+		toi = _conservative_advancement(shape_A, motion, shape_B, p_xform_B, margin);
+	}
 
-	real_t newlen = hitpos.distance_to(from) - (max - min) * 0.01;
-	p_A->set_linear_velocity((mnormal * newlen) / p_step);
+	if (toi < 0.0) {
+		return false;
+	}
+
+	// Shorten both velocities so the body doesn't reach B in this step.
+	p_A->set_linear_velocity(linear_velocity * toi);
+	p_A->set_angular_velocity(angular_velocity * toi);
 
 	return true;
 }
@@ -545,6 +633,50 @@ void GodotBodyPair3D::solve(real_t p_step) {
 	}
 }
 
+bool GodotBodyPair3D::save_snapshot(PhysicsSnapshotWriter &p_writer) const {
+	// Only what carries over to the next step is stored, the rest is rebuilt by setup().
+	p_writer.put_vector3(sep_axis);
+	p_writer.put_u32(contact_count);
+	for (int i = 0; i < contact_count; i++) {
+		const Contact &c = contacts[i];
+		p_writer.put_u32(c.index_A);
+		p_writer.put_u32(c.index_B);
+		p_writer.put_vector3(c.local_A);
+		p_writer.put_vector3(c.local_B);
+		p_writer.put_vector3(c.normal);
+		p_writer.put_real(c.acc_normal_impulse);
+		p_writer.put_vector3(c.acc_tangent_impulse);
+		p_writer.put_real(c.acc_bias_impulse);
+		p_writer.put_real(c.acc_bias_impulse_center_of_mass);
+		p_writer.put_u32(c.used);
+	}
+	return true;
+}
+
+void GodotBodyPair3D::restore_snapshot(PhysicsSnapshotReader &p_reader) {
+	sep_axis = p_reader.get_vector3();
+	contact_count = MIN(int(p_reader.get_u32()), int(MAX_CONTACTS));
+	for (int i = 0; i < contact_count; i++) {
+		Contact &c = contacts[i];
+		c = Contact();
+		c.index_A = p_reader.get_u32();
+		c.index_B = p_reader.get_u32();
+		c.local_A = p_reader.get_vector3();
+		c.local_B = p_reader.get_vector3();
+		c.normal = p_reader.get_vector3();
+		c.acc_normal_impulse = p_reader.get_real();
+		c.acc_tangent_impulse = p_reader.get_vector3();
+		c.acc_bias_impulse = p_reader.get_real();
+		c.acc_bias_impulse_center_of_mass = p_reader.get_real();
+		c.used = p_reader.get_u32();
+	}
+}
+
+void GodotBodyPair3D::reset_snapshot_state() {
+	sep_axis = Vector3();
+	contact_count = 0;
+}
+
 GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B) :
 		GodotBodyContact3D(_arr, 2) {
 	A = p_A;
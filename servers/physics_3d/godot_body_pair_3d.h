@@ -101,6 +101,29 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B);
 
 	void validate_contacts();
+
+	// Rigid motion of a shape over a step, rotating around the center of mass of its body.
+	struct CCDMotion {
+		Transform3D from;
+		Vector3 center;
+		Vector3 linear;
+		Vector3 angular_axis;
+		real_t angular = 0.0; // Angle over the whole step.
+		real_t radius = 0.0; // Distance from the center to the farthest point of the shape.
+
+		Transform3D at(real_t p_t) const;
+	};
+
+	struct CCDConcaveInfo {
+		const GodotShape3D *shape_A = nullptr;
+		const CCDMotion *motion = nullptr;
+		const Transform3D *transform_B = nullptr;
+		real_t margin = 0.0;
+		real_t toi = -1.0;
+	};
+
+	static real_t _conservative_advancement(const GodotShape3D *p_shape_A, const CCDMotion &p_motion, const GodotShape3D *p_shape_B, const Transform3D &p_xform_B, real_t p_margin);
+	static bool _ccd_concave_callback(void *p_userdata, GodotShape3D *p_convex);
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
 public:
@@ -108,6 +131,11 @@ public:
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual OrderKey get_order_key() const override { return OrderKey::from_pair(A->get_self(), shape_A, B->get_self(), shape_B); }
+	virtual bool save_snapshot(PhysicsSnapshotWriter &p_writer) const override;
+	virtual void restore_snapshot(PhysicsSnapshotReader &p_reader) override;
+	virtual void reset_snapshot_state() override;
+
 	GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B);
 	~GodotBodyPair3D();
 };
@@ -139,6 +167,8 @@ public:
 	virtual GodotSoftBody3D *get_soft_body_ptr(int p_index) const override { return soft_body; }
 	virtual int get_soft_body_count() const override { return 1; }
 
+	virtual OrderKey get_order_key() const override { return OrderKey::from_pair(body->get_self(), body_shape, soft_body->get_self(), 0); }
+
 	GodotBodySoftBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotSoftBody3D *p_B);
 	~GodotBodySoftBodyPair3D();
 };
@@ -61,6 +61,15 @@ public:
 	virtual int cull_segment(const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) = 0;
 	virtual int cull_aabb(const AABB &p_aabb, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) = 0;
 
+	enum {
+		SEGMENT_PACKET_SIZE = 32
+	};
+
+	// Culls up to SEGMENT_PACKET_SIZE segments at once, results for segment i start at p_results[i * p_max_results]
+	// and their amount is written to r_result_counts[i]. Doesn't modify the broadphase, so it can be called from
+	// several threads at once.
+	virtual void cull_segment_packet(const Vector3 *p_from, const Vector3 *p_to, int p_count, GodotCollisionObject3D **p_results, int *p_result_indices, int p_max_results, int *r_result_counts) = 0;
+
 	virtual void set_pair_callback(PairCallback p_pair_callback, void *p_userdata) = 0;
 	virtual void set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) = 0;
 
@@ -32,15 +32,66 @@
 
 #include "godot_collision_object_3d.h"
 
+// Below this amount, pending static items are inserted one by one, so frequent small
+// flushes don't stack up subtrees at the root.
+#define BULK_INSERT_MIN_ITEMS 256
+
+void GodotBroadPhase3DBVH::_remove_pending_static(ID p_id) {
+	uint32_t index = pending_static_indices[p_id];
+	pending_static_indices.erase(p_id);
+
+	uint32_t last = pending_statics.size() - 1;
+	if (index != last) {
+		pending_statics[index] = pending_statics[last];
+		pending_static_indices[pending_statics[index].id] = index;
+	}
+	pending_statics.resize(last);
+}
+
+void GodotBroadPhase3DBVH::_flush_pending_statics() {
+	if (pending_statics.is_empty()) {
+		return;
+	}
+
+	if (pending_statics.size() < BULK_INSERT_MIN_ITEMS) {
+		for (uint32_t i = 0; i < pending_statics.size(); i++) {
+			bvh.activate(pending_statics[i].id - 1, pending_statics[i].aabb);
+		}
+	} else {
+		LocalVector<BVHHandle> handles;
+		LocalVector<AABB> aabbs;
+		handles.resize(pending_statics.size());
+		aabbs.resize(pending_statics.size());
+		for (uint32_t i = 0; i < pending_statics.size(); i++) {
+			handles[i].set(pending_statics[i].id - 1);
+			aabbs[i] = pending_statics[i].aabb;
+		}
+		bvh.activate_bulk(handles.ptr(), aabbs.ptr(), handles.size());
+	}
+
+	pending_statics.clear();
+	pending_static_indices.clear();
+}
+
 GodotBroadPhase3DBVH::ID GodotBroadPhase3DBVH::create(GodotCollisionObject3D *p_object, int p_subindex, const AABB &p_aabb, bool p_static) {
 	uint32_t tree_id = p_static ? TREE_STATIC : TREE_DYNAMIC;
 	uint32_t tree_collision_mask = p_static ? TREE_FLAG_DYNAMIC : (TREE_FLAG_STATIC | TREE_FLAG_DYNAMIC);
-	ID oid = bvh.create(p_object, true, tree_id, tree_collision_mask, p_aabb, p_subindex); // Pair everything, don't care?
-	return oid + 1;
+	ID oid = bvh.create(p_object, !p_static, tree_id, tree_collision_mask, p_aabb, p_subindex) + 1; // Pair everything, don't care?
+
+	if (p_static) {
+		pending_static_indices[oid] = pending_statics.size();
+		pending_statics.push_back({ oid, p_aabb });
+	}
+	return oid;
 }
 
 void GodotBroadPhase3DBVH::move(ID p_id, const AABB &p_aabb) {
 	ERR_FAIL_COND(!p_id);
+	const uint32_t *pending_index = pending_static_indices.getptr(p_id);
+	if (pending_index) {
+		pending_statics[*pending_index].aabb = p_aabb;
+		return;
+	}
 	bvh.move(p_id - 1, p_aabb);
 }
 
@@ -48,11 +99,27 @@ void GodotBroadPhase3DBVH::set_static(ID p_id, bool p_static) {
 	ERR_FAIL_COND(!p_id);
 	uint32_t tree_id = p_static ? TREE_STATIC : TREE_DYNAMIC;
 	uint32_t tree_collision_mask = p_static ? TREE_FLAG_DYNAMIC : (TREE_FLAG_STATIC | TREE_FLAG_DYNAMIC);
+
+	const uint32_t *pending_index = pending_static_indices.getptr(p_id);
+	if (pending_index) {
+		if (p_static) {
+			return; // Already in the static tree.
+		}
+		AABB aabb = pending_statics[*pending_index].aabb;
+		_remove_pending_static(p_id);
+		bvh.set_tree(p_id - 1, tree_id, tree_collision_mask, false);
+		bvh.activate(p_id - 1, aabb);
+		return;
+	}
+
 	bvh.set_tree(p_id - 1, tree_id, tree_collision_mask, false);
 }
 
 void GodotBroadPhase3DBVH::remove(ID p_id) {
 	ERR_FAIL_COND(!p_id);
+	if (pending_static_indices.has(p_id)) {
+		_remove_pending_static(p_id);
+	}
 	bvh.erase(p_id - 1);
 }
 
@@ -75,14 +142,30 @@ int GodotBroadPhase3DBVH::get_subindex(ID p_id) const {
 }
 
 int GodotBroadPhase3DBVH::cull_point(const Vector3 &p_point, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices) {
+	_flush_pending_statics();
 	return bvh.cull_point(p_point, p_results, p_max_results, nullptr, 0xFFFFFFFF, p_result_indices);
 }
 
 int GodotBroadPhase3DBVH::cull_segment(const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices) {
+	_flush_pending_statics();
 	return bvh.cull_segment(p_from, p_to, p_results, p_max_results, nullptr, 0xFFFFFFFF, p_result_indices);
 }
 
+void GodotBroadPhase3DBVH::cull_segment_packet(const Vector3 *p_from, const Vector3 *p_to, int p_count, GodotCollisionObject3D **p_results, int *p_result_indices, int p_max_results, int *r_result_counts) {
+	static_assert(SEGMENT_PACKET_SIZE <= BVHCommon::SEGMENT_PACKET_SIZE, "Broadphase segment packets must fit in a BVH packet.");
+	ERR_FAIL_COND(p_count > SEGMENT_PACKET_SIZE);
+	_flush_pending_statics();
+
+	BVH_ABB<AABB, Vector3>::Segment segments[SEGMENT_PACKET_SIZE];
+	for (int i = 0; i < p_count; i++) {
+		segments[i].from = p_from[i];
+		segments[i].to = p_to[i];
+	}
+	bvh.cull_segment_packet(segments, p_count, p_results, p_result_indices, p_max_results, r_result_counts, nullptr);
+}
+
 int GodotBroadPhase3DBVH::cull_aabb(const AABB &p_aabb, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices) {
+	_flush_pending_statics();
 	return bvh.cull_aabb(p_aabb, p_results, p_max_results, nullptr, 0xFFFFFFFF, p_result_indices);
 }
 
@@ -115,6 +198,7 @@ void GodotBroadPhase3DBVH::set_unpair_callback(UnpairCallback p_unpair_callback,
 }
 
 void GodotBroadPhase3DBVH::update() {
+	_flush_pending_statics();
 	bvh.update();
 }
 
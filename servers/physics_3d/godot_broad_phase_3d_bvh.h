@@ -68,6 +68,18 @@ class GodotBroadPhase3DBVH : public GodotBroadPhase3D {
 	static void *_pair_callback(void *, uint32_t, GodotCollisionObject3D *, int, uint32_t, GodotCollisionObject3D *, int);
 	static void _unpair_callback(void *, uint32_t, GodotCollisionObject3D *, int, uint32_t, GodotCollisionObject3D *, int, void *);
 
+	// Static items are added to the tree in batches, so loading a level doesn't insert its collision
+	// one shape at a time. They are flushed before the tree is used for queries or pairing.
+	struct PendingStatic {
+		ID id;
+		AABB aabb;
+	};
+	LocalVector<PendingStatic> pending_statics;
+	HashMap<ID, uint32_t> pending_static_indices;
+
+	void _remove_pending_static(ID p_id);
+	void _flush_pending_statics();
+
 	PairCallback pair_callback = nullptr;
 	void *pair_userdata = nullptr;
 	UnpairCallback unpair_callback = nullptr;
@@ -87,6 +99,7 @@ public:
 	virtual int cull_point(const Vector3 &p_point, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) override;
 	virtual int cull_segment(const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) override;
 	virtual int cull_aabb(const AABB &p_aabb, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) override;
+	virtual void cull_segment_packet(const Vector3 *p_from, const Vector3 *p_to, int p_count, GodotCollisionObject3D **p_results, int *p_result_indices, int p_max_results, int *r_result_counts) override;
 
 	virtual void set_pair_callback(PairCallback p_pair_callback, void *p_userdata) override;
 	virtual void set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) override;
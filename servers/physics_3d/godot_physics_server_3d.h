@@ -114,6 +114,9 @@ public:
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) override;
 
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override;
+
+	virtual PackedByteArray space_create_snapshot(RID p_space) const override;
+	virtual bool space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) override;
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
@@ -158,6 +161,10 @@ public:
 
 	virtual void area_set_monitor_callback(RID p_area, const Callable &p_callback) override;
 	virtual void area_set_area_monitor_callback(RID p_area, const Callable &p_callback) override;
+	virtual void area_set_monitor_batched(RID p_area, bool p_batched) override;
+
+	virtual void area_get_overlapping_bodies(RID p_area, List<RID> *p_bodies) override;
+	virtual void area_get_overlapping_areas(RID p_area, List<RID> *p_areas) override;
 
 	/* BODY API */
 
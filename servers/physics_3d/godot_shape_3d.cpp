@@ -35,6 +35,16 @@
 #include "core/math/geometry_3d.h"
 #include "core/templates/sort_array.h"
 
+#ifndef REAL_T_IS_DOUBLE
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SHAPE_3D_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define SHAPE_3D_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
 // GodotHeightMapShape3D is based on Bullet btHeightfieldTerrainShape.
 
 /*
@@ -812,6 +822,160 @@ Variant GodotCylinderShape3D::get_data() const {
 
 GodotCylinderShape3D::GodotCylinderShape3D() {}
 
+/********** VERTEX ARRAY *************/
+
+void GodotVertexArray3D::set(const Vector3 *p_vertices, uint32_t p_count) {
+	count = p_count;
+	uint32_t padded = (p_count + 3) & ~3u;
+	x.resize(padded);
+	y.resize(padded);
+	z.resize(padded);
+	for (uint32_t i = 0; i < padded; i++) {
+		const Vector3 &v = p_vertices[i < p_count ? i : 0];
+		x[i] = v.x;
+		y[i] = v.y;
+		z[i] = v.z;
+	}
+}
+
+uint32_t GodotVertexArray3D::find_support(const Vector3 &p_dir, real_t &r_max) const {
+	ERR_FAIL_COND_V(count == 0, 0);
+
+	uint32_t best = 0;
+	real_t max_support = p_dir.x * x[0] + p_dir.y * y[0] + p_dir.z * z[0];
+	uint32_t i = 0;
+
+#if defined(SHAPE_3D_SSE2)
+	if (count >= 8) {
+		const __m128 dx = _mm_set1_ps(p_dir.x);
+		const __m128 dy = _mm_set1_ps(p_dir.y);
+		const __m128 dz = _mm_set1_ps(p_dir.z);
+		const __m128i four = _mm_set1_epi32(4);
+		__m128 best_values = _mm_set1_ps(max_support);
+		__m128i best_indices = _mm_setzero_si128();
+		__m128i indices = _mm_setr_epi32(0, 1, 2, 3);
+		for (; i < count; i += 4) {
+			const __m128 s = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, _mm_loadu_ps(x.ptr() + i)), _mm_mul_ps(dy, _mm_loadu_ps(y.ptr() + i))), _mm_mul_ps(dz, _mm_loadu_ps(z.ptr() + i)));
+			const __m128i greater = _mm_castps_si128(_mm_cmpgt_ps(s, best_values));
+			best_values = _mm_max_ps(s, best_values);
+			best_indices = _mm_or_si128(_mm_and_si128(greater, indices), _mm_andnot_si128(greater, best_indices));
+			indices = _mm_add_epi32(indices, four);
+		}
+		float values[4];
+		int32_t lanes[4];
+		_mm_storeu_ps(values, best_values);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), best_indices);
+		for (int j = 0; j < 4; j++) {
+			if (values[j] > max_support || (values[j] == max_support && uint32_t(lanes[j]) < best)) {
+				max_support = values[j];
+				best = lanes[j];
+			}
+		}
+	}
+#elif defined(SHAPE_3D_NEON)
+	if (count >= 8) {
+		const float32x4_t dx = vdupq_n_f32(p_dir.x);
+		const float32x4_t dy = vdupq_n_f32(p_dir.y);
+		const float32x4_t dz = vdupq_n_f32(p_dir.z);
+		const uint32x4_t four = vdupq_n_u32(4);
+		const uint32_t index_values[4] = { 0, 1, 2, 3 };
+		float32x4_t best_values = vdupq_n_f32(max_support);
+		uint32x4_t best_indices = vdupq_n_u32(0);
+		uint32x4_t indices = vld1q_u32(index_values);
+		for (; i < count; i += 4) {
+			float32x4_t s = vmulq_f32(dx, vld1q_f32(x.ptr() + i));
+			s = vmlaq_f32(s, dy, vld1q_f32(y.ptr() + i));
+			s = vmlaq_f32(s, dz, vld1q_f32(z.ptr() + i));
+			const uint32x4_t greater = vcgtq_f32(s, best_values);
+			best_values = vbslq_f32(greater, s, best_values);
+			best_indices = vbslq_u32(greater, indices, best_indices);
+			indices = vaddq_u32(indices, four);
+		}
+		float values[4];
+		uint32_t lanes[4];
+		vst1q_f32(values, best_values);
+		vst1q_u32(lanes, best_indices);
+		for (int j = 0; j < 4; j++) {
+			if (values[j] > max_support || (values[j] == max_support && lanes[j] < best)) {
+				max_support = values[j];
+				best = lanes[j];
+			}
+		}
+	}
+#endif
+
+	for (; i < count; i++) {
+		real_t s = p_dir.x * x[i] + p_dir.y * y[i] + p_dir.z * z[i];
+		if (s > max_support) {
+			best = i;
+			max_support = s;
+		}
+	}
+
+	r_max = max_support;
+	return best;
+}
+
+void GodotVertexArray3D::project_range(const Vector3 &p_dir, real_t &r_min, real_t &r_max) const {
+	ERR_FAIL_COND(count == 0);
+
+	r_min = r_max = p_dir.x * x[0] + p_dir.y * y[0] + p_dir.z * z[0];
+	uint32_t i = 0;
+
+#if defined(SHAPE_3D_SSE2)
+	if (count >= 8) {
+		const __m128 dx = _mm_set1_ps(p_dir.x);
+		const __m128 dy = _mm_set1_ps(p_dir.y);
+		const __m128 dz = _mm_set1_ps(p_dir.z);
+		__m128 min_values = _mm_set1_ps(r_min);
+		__m128 max_values = min_values;
+		// Padding repeats the first vertex, so whole blocks can be scanned.
+		for (; i < count; i += 4) {
+			const __m128 s = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, _mm_loadu_ps(x.ptr() + i)), _mm_mul_ps(dy, _mm_loadu_ps(y.ptr() + i))), _mm_mul_ps(dz, _mm_loadu_ps(z.ptr() + i)));
+			min_values = _mm_min_ps(s, min_values);
+			max_values = _mm_max_ps(s, max_values);
+		}
+		float mins[4];
+		float maxs[4];
+		_mm_storeu_ps(mins, min_values);
+		_mm_storeu_ps(maxs, max_values);
+		for (int j = 0; j < 4; j++) {
+			r_min = MIN(r_min, mins[j]);
+			r_max = MAX(r_max, maxs[j]);
+		}
+	}
+#elif defined(SHAPE_3D_NEON)
+	if (count >= 8) {
+		const float32x4_t dx = vdupq_n_f32(p_dir.x);
+		const float32x4_t dy = vdupq_n_f32(p_dir.y);
+		const float32x4_t dz = vdupq_n_f32(p_dir.z);
+		float32x4_t min_values = vdupq_n_f32(r_min);
+		float32x4_t max_values = min_values;
+		for (; i < count; i += 4) {
+			float32x4_t s = vmulq_f32(dx, vld1q_f32(x.ptr() + i));
+			s = vmlaq_f32(s, dy, vld1q_f32(y.ptr() + i));
+			s = vmlaq_f32(s, dz, vld1q_f32(z.ptr() + i));
+			min_values = vminq_f32(s, min_values);
+			max_values = vmaxq_f32(s, max_values);
+		}
+		float mins[4];
+		float maxs[4];
+		vst1q_f32(mins, min_values);
+		vst1q_f32(maxs, max_values);
+		for (int j = 0; j < 4; j++) {
+			r_min = MIN(r_min, mins[j]);
+			r_max = MAX(r_max, maxs[j]);
+		}
+	}
+#endif
+
+	for (; i < count; i++) {
+		real_t s = p_dir.x * x[i] + p_dir.y * y[i] + p_dir.z * z[i];
+		r_min = MIN(r_min, s);
+		r_max = MAX(r_max, s);
+	}
+}
+
 /********** CONVEX POLYGON *************/
 
 void GodotConvexPolygonShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
@@ -820,8 +984,6 @@ void GodotConvexPolygonShape3D::project_range(const Vector3 &p_normal, const Tra
 		return;
 	}
 
-	const Vector3 *vrts = &mesh.vertices[0];
-
 	if (vertex_count > 3 * extreme_vertices.size()) {
 		// For a large mesh, two calls to get_support() is faster than a full
 		// scan over all vertices.
@@ -830,16 +992,13 @@ void GodotConvexPolygonShape3D::project_range(const Vector3 &p_normal, const Tra
 		r_min = p_normal.dot(p_transform.xform(get_support(-n)));
 		r_max = p_normal.dot(p_transform.xform(get_support(n)));
 	} else {
-		for (uint32_t i = 0; i < vertex_count; i++) {
-			real_t d = p_normal.dot(p_transform.xform(vrts[i]));
-
-			if (i == 0 || d > r_max) {
-				r_max = d;
-			}
-			if (i == 0 || d < r_min) {
-				r_min = d;
-			}
-		}
+		// dot(n, B * v + o) == dot(B^T * n, v) + dot(n, o), so the vertices
+		// can be projected in local space without transforming each one.
+		Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
+		real_t offset = p_normal.dot(p_transform.origin);
+		vertex_array.project_range(local_normal, r_min, r_max);
+		r_min += offset;
+		r_max += offset;
 	}
 }
 
@@ -851,15 +1010,8 @@ Vector3 GodotConvexPolygonShape3D::get_support(const Vector3 &p_normal) const {
 	// Find an initial guess for the support vertex by checking the ones we
 	// found in _setup().
 
-	int best_vertex = -1;
 	real_t max_support = 0.0;
-	for (uint32_t i = 0; i < extreme_vertices.size(); i++) {
-		real_t s = p_normal.dot(mesh.vertices[extreme_vertices[i]]);
-		if (best_vertex == -1 || s > max_support) {
-			best_vertex = extreme_vertices[i];
-			max_support = s;
-		}
-	}
+	int best_vertex = extreme_vertices[extreme_vertex_array.find_support(p_normal, max_support)];
 	if (extreme_vertices.size() == mesh.vertices.size()) {
 		// We've already checked every vertex, so we can return now.
 		return mesh.vertices[best_vertex];
@@ -1096,6 +1248,14 @@ void GodotConvexPolygonShape3D::_setup(const Vector<Vector3> &p_vertices) {
 
 	configure(_aabb);
 
+	extreme_vertices.clear();
+	vertex_neighbors.clear();
+	vertex_array.set(mesh.vertices.ptr(), mesh.vertices.size());
+	if (mesh.vertices.size() == 0) {
+		extreme_vertex_array.set(nullptr, 0);
+		return;
+	}
+
 	// Pre-compute the extreme vertices in 26 directions.  This will be used
 	// to speed up get_support() by letting us quickly get a good guess for
 	// the support vertex.
@@ -1107,14 +1267,7 @@ void GodotConvexPolygonShape3D::_setup(const Vector<Vector3> &p_vertices) {
 					Vector3 dir(x, y, z);
 					dir.normalize();
 					real_t max_support = 0.0;
-					int best_vertex = -1;
-					for (uint32_t i = 0; i < mesh.vertices.size(); i++) {
-						real_t s = dir.dot(mesh.vertices[i]);
-						if (best_vertex == -1 || s > max_support) {
-							best_vertex = i;
-							max_support = s;
-						}
-					}
+					int best_vertex = vertex_array.find_support(dir, max_support);
 					if (extreme_vertices.find(best_vertex) == -1)
 						extreme_vertices.push_back(best_vertex);
 				}
@@ -1122,6 +1275,13 @@ void GodotConvexPolygonShape3D::_setup(const Vector<Vector3> &p_vertices) {
 		}
 	}
 
+	LocalVector<Vector3> extreme_positions;
+	extreme_positions.resize(extreme_vertices.size());
+	for (uint32_t i = 0; i < extreme_vertices.size(); i++) {
+		extreme_positions[i] = mesh.vertices[extreme_vertices[i]];
+	}
+	extreme_vertex_array.set(extreme_positions.ptr(), extreme_positions.size());
+
 	// Record all the neighbors of each vertex.  This is used in get_support().
 
 	if (extreme_vertices.size() < mesh.vertices.size()) {
@@ -1331,36 +1491,34 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
 	const BVH *params_bvh = &p_params->bvh[p_idx];
 
-	if (!params_bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
+	if (!_get_node_aabb(*params_bvh).intersects_segment(p_params->from, p_params->to)) {
 		return;
 	}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-
-		Vector3 res;
-		Vector3 normal;
-		if (face->intersect_segment(p_params->from, p_params->to, res, normal, true)) {
-			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
-			if ((d > 0) && (d < p_params->min_d)) {
-				p_params->min_d = d;
-				p_params->result = res;
-				p_params->normal = normal;
-				p_params->collisions++;
+	if (params_bvh->face_count > 0) {
+		for (uint32_t i = 0; i < params_bvh->face_count; i++) {
+			const Face *f = &p_params->faces[p_params->bvh_faces[params_bvh->index + i]];
+			GodotFaceShape3D *face = p_params->face;
+			face->normal = f->normal;
+			face->vertex[0] = p_params->vertices[f->indices[0]];
+			face->vertex[1] = p_params->vertices[f->indices[1]];
+			face->vertex[2] = p_params->vertices[f->indices[2]];
+
+			Vector3 res;
+			Vector3 normal;
+			if (face->intersect_segment(p_params->from, p_params->to, res, normal, true)) {
+				real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
+				if ((d > 0) && (d < p_params->min_d)) {
+					p_params->min_d = d;
+					p_params->result = res;
+					p_params->normal = normal;
+					p_params->collisions++;
+				}
 			}
 		}
 	} else {
-		if (params_bvh->left >= 0) {
-			_cull_segment(params_bvh->left, p_params);
-		}
-		if (params_bvh->right >= 0) {
-			_cull_segment(params_bvh->right, p_params);
-		}
+		_cull_segment(p_idx + 1, p_params);
+		_cull_segment(params_bvh->index, p_params);
 	}
 }
 
@@ -1385,6 +1543,7 @@ bool GodotConcavePolygonShape3D::intersect_segment(const Vector3 &p_begin, const
 	params.faces = fr;
 	params.vertices = vr;
 	params.bvh = br;
+	params.bvh_faces = bvh_faces.ptr();
 
 	params.face = &face;
 
@@ -1411,31 +1570,31 @@ Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point)
 bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
 	const BVH *params_bvh = &p_params->bvh[p_idx];
 
-	if (!p_params->aabb.intersects(params_bvh->aabb)) {
-		return false;
+	for (int i = 0; i < 3; i++) {
+		if (p_params->min[i] > params_bvh->max[i] || p_params->max[i] < params_bvh->min[i]) {
+			return false;
+		}
 	}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-		if (p_params->callback(p_params->userdata, face)) {
-			return true;
-		}
-	} else {
-		if (params_bvh->left >= 0) {
-			if (_cull(params_bvh->left, p_params)) {
+	if (params_bvh->face_count > 0) {
+		for (uint32_t i = 0; i < params_bvh->face_count; i++) {
+			const Face *f = &p_params->faces[p_params->bvh_faces[params_bvh->index + i]];
+			GodotFaceShape3D *face = p_params->face;
+			face->normal = f->normal;
+			face->vertex[0] = p_params->vertices[f->indices[0]];
+			face->vertex[1] = p_params->vertices[f->indices[1]];
+			face->vertex[2] = p_params->vertices[f->indices[2]];
+			if (p_params->callback(p_params->userdata, face)) {
 				return true;
 			}
 		}
+	} else {
+		if (_cull(p_idx + 1, p_params)) {
+			return true;
+		}
 
-		if (params_bvh->right >= 0) {
-			if (_cull(params_bvh->right, p_params)) {
-				return true;
-			}
+		if (_cull(params_bvh->index, p_params)) {
+			return true;
 		}
 	}
 
@@ -1448,7 +1607,9 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 		return;
 	}
 
-	AABB local_aabb = p_local_aabb;
+	if (!bvh_bounds.intersects_inclusive(p_local_aabb)) {
+		return;
+	}
 
 	// unlock data
 	const Face *fr = faces.ptr();
@@ -1460,11 +1621,12 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	face.invert_backface_collision = p_invert_backface_collision;
 
 	_CullParams params;
-	params.aabb = local_aabb;
+	_quantize_aabb(p_local_aabb, params.min, params.max, 0);
 	params.face = &face;
 	params.faces = fr;
 	params.vertices = vr;
 	params.bvh = br;
+	params.bvh_faces = bvh_faces.ptr();
 	params.callback = p_callback;
 	params.userdata = p_userdata;
 
@@ -1506,87 +1668,48 @@ struct _Volume_BVH_CompareZ {
 	}
 };
 
-struct _Volume_BVH {
-	AABB aabb;
-	_Volume_BVH *left = nullptr;
-	_Volume_BVH *right = nullptr;
-
-	int face_index = 0;
-};
+void GodotConcavePolygonShape3D::_build_bvh(_Volume_BVH_Element *p_elements, int p_count) {
+	uint32_t idx = bvh.size();
+	bvh.push_back(BVH());
 
-_Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int &count) {
-	_Volume_BVH *bvh = memnew(_Volume_BVH);
-
-	if (p_size == 1) {
-		//leaf
-		bvh->aabb = p_elements[0].aabb;
-		bvh->left = nullptr;
-		bvh->right = nullptr;
-		bvh->face_index = p_elements->face_index;
-		count++;
-		return bvh;
-	} else {
-		bvh->face_index = -1;
+	AABB aabb = p_elements[0].aabb;
+	AABB centers(p_elements[0].center, Vector3());
+	for (int i = 1; i < p_count; i++) {
+		aabb.merge_with(p_elements[i].aabb);
+		centers.expand_to(p_elements[i].center);
 	}
+	// Pad by one step, so rounding errors while quantizing queries can't miss a face.
+	_quantize_aabb(aabb, bvh[idx].min, bvh[idx].max, 1);
 
-	AABB aabb;
-	for (int i = 0; i < p_size; i++) {
-		if (i == 0) {
-			aabb = p_elements[i].aabb;
-		} else {
-			aabb.merge_with(p_elements[i].aabb);
+	if (p_count <= BVH_MAX_LEAF_FACES) {
+		bvh[idx].index = bvh_faces.size();
+		bvh[idx].face_count = p_count;
+		for (int i = 0; i < p_count; i++) {
+			bvh_faces.push_back(p_elements[i].face_index);
 		}
+		return;
 	}
-	bvh->aabb = aabb;
-	switch (aabb.get_longest_axis_index()) {
+
+	// Partitioning around the median is enough, the halves don't need to be sorted.
+	int split = p_count / 2;
+	switch (centers.get_longest_axis_index()) {
 		case 0: {
 			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareX> sort_x;
-			sort_x.sort(p_elements, p_size);
-
+			sort_x.nth_element(0, p_count, split, p_elements);
 		} break;
 		case 1: {
 			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareY> sort_y;
-			sort_y.sort(p_elements, p_size);
+			sort_y.nth_element(0, p_count, split, p_elements);
 		} break;
 		case 2: {
 			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareZ> sort_z;
-			sort_z.sort(p_elements, p_size);
+			sort_z.nth_element(0, p_count, split, p_elements);
 		} break;
 	}
 
-	int split = p_size / 2;
-	bvh->left = _volume_build_bvh(p_elements, split, count);
-	bvh->right = _volume_build_bvh(&p_elements[split], p_size - split, count);
-
-	//printf("branch at %p - %i: %i\n",bvh,count,bvh->face_index);
-	count++;
-	return bvh;
-}
-
-void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
-	int idx = p_idx;
-
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
-
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].left = -1;
-	}
-
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
-		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].right = -1;
-	}
-
-	memdelete(p_bvh_tree);
+	_build_bvh(p_elements, split);
+	bvh[idx].index = bvh.size();
+	_build_bvh(&p_elements[split], p_count - split);
 }
 
 void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
@@ -1634,15 +1757,18 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		}
 	}
 
-	int count = 0;
-	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
-
-	bvh.resize(count + 1);
-
-	BVH *bvh_arrayw2 = bvh.ptrw();
+	bvh_bounds = _aabb;
+	for (int i = 0; i < 3; i++) {
+		bvh_quantize_scale[i] = _aabb.size[i] > 0 ? BVH_QUANTIZE_MAX / _aabb.size[i] : 0;
+		bvh_dequantize_scale[i] = _aabb.size[i] / BVH_QUANTIZE_MAX;
+	}
 
-	int idx = 0;
-	_fill_bvh(bvh_tree, bvh_arrayw2, idx);
+	bvh.clear();
+	bvh_faces.clear();
+	// Leaves hold at least two faces, so there are never more nodes than faces.
+	bvh.reserve(src_face_count);
+	bvh_faces.reserve(src_face_count);
+	_build_bvh(bvh_arrayw, src_face_count);
 
 	backface_collision = p_backface_collision;
 
@@ -1996,13 +2122,100 @@ void GodotHeightMapShape3D::_get_cell(const Vector3 &p_point, int &r_x, int &r_y
 	Vector3 clamped_point(p_point);
 	clamped_point.x = CLAMP(p_point.x, pos_local.x, pos_local.x + shape_aabb.size.x);
 	clamped_point.y = CLAMP(p_point.y, pos_local.y, pos_local.y + shape_aabb.size.y);
-	clamped_point.z = CLAMP(p_point.z, pos_local.z, pos_local.x + shape_aabb.size.z);
+	clamped_point.z = CLAMP(p_point.z, pos_local.z, pos_local.z + shape_aabb.size.z);
 
 	r_x = (clamped_point.x < 0.0) ? (clamped_point.x - 0.5) : (clamped_point.x + 0.5);
 	r_y = (clamped_point.y < 0.0) ? (clamped_point.y - 0.5) : (clamped_point.y + 0.5);
 	r_z = (clamped_point.z < 0.0) ? (clamped_point.z - 0.5) : (clamped_point.z + 0.5);
 }
 
+struct _HeightmapCullParams {
+	// Cell ranges, end exclusive.
+	int start_x = 0;
+	int end_x = 0;
+	int start_z = 0;
+	int end_z = 0;
+
+	real_t min_y = 0.0;
+	real_t max_y = 0.0;
+
+	GodotConcaveShape3D::QueryCallback callback = nullptr;
+	void *userdata = nullptr;
+
+	const GodotHeightMapShape3D *heightmap = nullptr;
+	GodotFaceShape3D *face = nullptr;
+};
+
+static bool _heightmap_cull_cells(_HeightmapCullParams &p_params, int p_start_x, int p_end_x, int p_start_z, int p_end_z) {
+	const GodotHeightMapShape3D *heightmap = p_params.heightmap;
+	GodotFaceShape3D &face = *p_params.face;
+
+	for (int z = p_start_z; z < p_end_z; z++) {
+		for (int x = p_start_x; x < p_end_x; x++) {
+			real_t h00 = heightmap->_get_height(x, z);
+			real_t h10 = heightmap->_get_height(x + 1, z);
+			real_t h01 = heightmap->_get_height(x, z + 1);
+			real_t h11 = heightmap->_get_height(x + 1, z + 1);
+			if (MAX(MAX(h00, h10), MAX(h01, h11)) < p_params.min_y || MIN(MIN(h00, h10), MIN(h01, h11)) > p_params.max_y) {
+				continue;
+			}
+
+			// First triangle.
+			heightmap->_get_point(x, z, face.vertex[0]);
+			heightmap->_get_point(x + 1, z, face.vertex[1]);
+			heightmap->_get_point(x, z + 1, face.vertex[2]);
+			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
+			if (p_params.callback(p_params.userdata, &face)) {
+				return true;
+			}
+
+			// Second triangle.
+			face.vertex[0] = face.vertex[1];
+			heightmap->_get_point(x + 1, z + 1, face.vertex[1]);
+			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
+			if (p_params.callback(p_params.userdata, &face)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+static bool _heightmap_cull_bounds(_HeightmapCullParams &p_params, int p_level, int p_x, int p_z) {
+	const GodotHeightMapShape3D *heightmap = p_params.heightmap;
+
+	const GodotHeightMapShape3D::Range &range = heightmap->_get_bounds(p_level, p_x, p_z);
+	if (range.max < p_params.min_y || range.min > p_params.max_y) {
+		return false;
+	}
+
+	int span = GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE << p_level;
+	int start_x = MAX(p_x * span, p_params.start_x);
+	int end_x = MIN((p_x + 1) * span, p_params.end_x);
+	int start_z = MAX(p_z * span, p_params.start_z);
+	int end_z = MIN((p_z + 1) * span, p_params.end_z);
+	if (start_x >= end_x || start_z >= end_z) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		return _heightmap_cull_cells(p_params, start_x, end_x, start_z, end_z);
+	}
+
+	int child_width = heightmap->_get_bounds_width(p_level - 1);
+	int child_depth = heightmap->_get_bounds_depth(p_level - 1);
+	for (int z = p_z * 2; z < MIN(p_z * 2 + 2, child_depth); z++) {
+		for (int x = p_x * 2; x < MIN(p_x * 2 + 2, child_width); x++) {
+			if (_heightmap_cull_bounds(p_params, p_level - 1, x, z)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
 void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callback, void *p_userdata, bool p_invert_backface_collision) const {
 	if (heights.is_empty()) {
 		return;
@@ -2024,31 +2237,32 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 		aabb_max[i]++;
 	}
 
-	int start_x = MAX(0, aabb_min[0]);
-	int end_x = MIN(width - 1, aabb_max[0]);
-	int start_z = MAX(0, aabb_min[2]);
-	int end_z = MIN(depth - 1, aabb_max[2]);
-
 	GodotFaceShape3D face;
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
-	for (int z = start_z; z < end_z; z++) {
-		for (int x = start_x; x < end_x; x++) {
-			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
-			}
+	_HeightmapCullParams params;
+	params.start_x = MAX(0, aabb_min[0]);
+	params.end_x = MIN(width - 1, aabb_max[0]);
+	params.start_z = MAX(0, aabb_min[2]);
+	params.end_z = MIN(depth - 1, aabb_max[2]);
+	params.min_y = local_aabb.position.y;
+	params.max_y = local_aabb.position.y + local_aabb.size.y;
+	params.callback = p_callback;
+	params.userdata = p_userdata;
+	params.heightmap = this;
+	params.face = &face;
 
-			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
+	if (bounds_grid.is_empty()) {
+		_heightmap_cull_cells(params, params.start_x, params.end_x, params.start_z, params.end_z);
+		return;
+	}
+
+	// Descend the min/max quadtree from its top level, skipping regions outside the aabb height.
+	int top_level = bounds_levels.size();
+	for (int z = 0; z < _get_bounds_depth(top_level); z++) {
+		for (int x = 0; x < _get_bounds_width(top_level); x++) {
+			if (_heightmap_cull_bounds(params, top_level, x, z)) {
 				return;
 			}
 		}
@@ -2067,6 +2281,7 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 
 void GodotHeightMapShape3D::_build_accelerator() {
 	bounds_grid.clear();
+	bounds_levels.clear();
 
 	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
 	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
@@ -2132,6 +2347,36 @@ void GodotHeightMapShape3D::_build_accelerator() {
 			bounds_grid[cx + cz * bounds_grid_width] = r;
 		}
 	}
+
+	// Merge chunks 2x2 into coarser levels, up to a single range for the whole terrain.
+	const LocalVector<Range> *child_ranges = &bounds_grid;
+	int child_width = bounds_grid_width;
+	int child_depth = bounds_grid_depth;
+	while (child_width > 1 || child_depth > 1) {
+		BoundsLevel level;
+		level.width = (child_width + 1) / 2;
+		level.depth = (child_depth + 1) / 2;
+		level.ranges.resize(level.width * level.depth);
+
+		for (int z = 0; z < level.depth; z++) {
+			for (int x = 0; x < level.width; x++) {
+				Range r = (*child_ranges)[(z * 2) * child_width + (x * 2)];
+				for (int cz = z * 2; cz < MIN(z * 2 + 2, child_depth); cz++) {
+					for (int cx = x * 2; cx < MIN(x * 2 + 2, child_width); cx++) {
+						const Range &child = (*child_ranges)[cz * child_width + cx];
+						r.min = MIN(r.min, child.min);
+						r.max = MAX(r.max, child.max);
+					}
+				}
+				level.ranges[z * level.width + x] = r;
+			}
+		}
+
+		bounds_levels.push_back(level);
+		child_ranges = &bounds_levels[bounds_levels.size() - 1].ranges;
+		child_width = level.width;
+		child_depth = level.depth;
+	}
 }
 
 void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
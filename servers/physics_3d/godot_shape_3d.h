@@ -275,11 +275,28 @@ public:
 	GodotCylinderShape3D();
 };
 
+// Vertex positions split into separate x, y and z arrays, padded to a multiple of four
+// with copies of the first vertex, so that support scans can test four vertices at once.
+struct GodotVertexArray3D {
+	LocalVector<real_t> x;
+	LocalVector<real_t> y;
+	LocalVector<real_t> z;
+	uint32_t count = 0;
+
+	void set(const Vector3 *p_vertices, uint32_t p_count);
+	// Index of the vertex furthest along p_dir; the lowest index wins ties.
+	uint32_t find_support(const Vector3 &p_dir, real_t &r_max) const;
+	void project_range(const Vector3 &p_dir, real_t &r_min, real_t &r_max) const;
+};
+
 struct GodotConvexPolygonShape3D : public GodotShape3D {
 	Geometry3D::MeshData mesh;
 	LocalVector<int> extreme_vertices;
 	LocalVector<LocalVector<int>> vertex_neighbors;
 
+	GodotVertexArray3D vertex_array;
+	GodotVertexArray3D extreme_vertex_array;
+
 	void _setup(const Vector<Vector3> &p_vertices);
 
 public:
@@ -302,7 +319,7 @@ public:
 	GodotConvexPolygonShape3D();
 };
 
-struct _Volume_BVH;
+struct _Volume_BVH_Element;
 struct GodotFaceShape3D;
 
 struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
@@ -316,23 +333,51 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
 
+	// Nodes are stored depth first, so the first child of a branch always follows it
+	// and only the second child needs to be referenced.
 	struct BVH {
-		AABB aabb;
-		int left = 0;
-		int right = 0;
-
-		int face_index = 0;
+		// Bounds quantized to bvh_bounds, rounded outwards.
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
+		// Branches: index of the second child. Leaves: first entry in bvh_faces.
+		uint32_t index = 0;
+		// Zero for branches.
+		uint32_t face_count = 0;
 	};
 
-	Vector<BVH> bvh;
+	static const int BVH_MAX_LEAF_FACES = 4;
+	static const int BVH_QUANTIZE_MAX = 65535;
+
+	LocalVector<BVH> bvh;
+	LocalVector<uint32_t> bvh_faces;
+	AABB bvh_bounds;
+	Vector3 bvh_quantize_scale;
+	Vector3 bvh_dequantize_scale;
+
+	_FORCE_INLINE_ void _quantize_aabb(const AABB &p_aabb, uint16_t *r_min, uint16_t *r_max, int p_padding) const {
+		Vector3 min = (p_aabb.position - bvh_bounds.position) * bvh_quantize_scale;
+		Vector3 max = (p_aabb.position + p_aabb.size - bvh_bounds.position) * bvh_quantize_scale;
+		for (int i = 0; i < 3; i++) {
+			r_min[i] = CLAMP(int(Math::floor(min[i])) - p_padding, 0, BVH_QUANTIZE_MAX);
+			r_max[i] = CLAMP(int(Math::ceil(max[i])) + p_padding, 0, BVH_QUANTIZE_MAX);
+		}
+	}
+
+	_FORCE_INLINE_ AABB _get_node_aabb(const BVH &p_node) const {
+		Vector3 min(p_node.min[0], p_node.min[1], p_node.min[2]);
+		Vector3 max(p_node.max[0], p_node.max[1], p_node.max[2]);
+		return AABB(bvh_bounds.position + min * bvh_dequantize_scale, (max - min) * bvh_dequantize_scale);
+	}
 
 	struct _CullParams {
-		AABB aabb;
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
 		QueryCallback callback = nullptr;
 		void *userdata = nullptr;
 		const Face *faces = nullptr;
 		const Vector3 *vertices = nullptr;
 		const BVH *bvh = nullptr;
+		const uint32_t *bvh_faces = nullptr;
 		GodotFaceShape3D *face = nullptr;
 	};
 
@@ -343,6 +388,7 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 		const Face *faces = nullptr;
 		const Vector3 *vertices = nullptr;
 		const BVH *bvh = nullptr;
+		const uint32_t *bvh_faces = nullptr;
 		GodotFaceShape3D *face = nullptr;
 
 		Vector3 result;
@@ -356,7 +402,7 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
 	bool _cull(int p_idx, _CullParams *p_params) const;
 
-	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
+	void _build_bvh(_Volume_BVH_Element *p_elements, int p_count);
 
 	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision);
 
@@ -397,12 +443,38 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 	int bounds_grid_width = 0;
 	int bounds_grid_depth = 0;
 
+	// Min/max quadtree over bounds_grid: each level halves the size of the one below it,
+	// the last one being a single range for the whole terrain.
+	struct BoundsLevel {
+		LocalVector<Range> ranges;
+		int width = 0;
+		int depth = 0;
+	};
+	LocalVector<BoundsLevel> bounds_levels;
+
 	static const int BOUNDS_CHUNK_SIZE = 16;
 
 	_FORCE_INLINE_ const Range &_get_bounds_chunk(int p_x, int p_z) const {
 		return bounds_grid[(p_z * bounds_grid_width) + p_x];
 	}
 
+	// Level 0 is bounds_grid.
+	_FORCE_INLINE_ const Range &_get_bounds(int p_level, int p_x, int p_z) const {
+		if (p_level == 0) {
+			return _get_bounds_chunk(p_x, p_z);
+		}
+		const BoundsLevel &level = bounds_levels[p_level - 1];
+		return level.ranges[(p_z * level.width) + p_x];
+	}
+
+	_FORCE_INLINE_ int _get_bounds_width(int p_level) const {
+		return p_level == 0 ? bounds_grid_width : bounds_levels[p_level - 1].width;
+	}
+
+	_FORCE_INLINE_ int _get_bounds_depth(int p_level) const {
+		return p_level == 0 ? bounds_grid_depth : bounds_levels[p_level - 1].depth;
+	}
+
 	_FORCE_INLINE_ real_t _get_height(int p_x, int p_z) const {
 		return heights[(p_z * width) + p_x];
 	}
@@ -33,11 +33,15 @@
 #include "godot_space_3d.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rb_map.h"
 #include "servers/rendering_server.h"
 
 // Based on Bullet soft body.
 
+#define SOFT_BODY_LINK_COLOR_MAX 64
+#define SOFT_BODY_LINK_MIN_PARALLEL_SIZE 4096
+
 /*
 Bullet Continuous Collision Detection and Physics Library
 Copyright (c) 2003-2006 Erwin Coumans  http://continuousphysics.com/Bullet/
@@ -832,6 +836,8 @@ void GodotSoftBody3D::reoptimize_link_order() {
 	memdelete_arr(link_dep_free_list);
 	memdelete_arr(link_dep_list_starts);
 	memdelete_arr(link_buffer);
+
+	link_colors_dirty = true;
 }
 
 void GodotSoftBody3D::append_link(uint32_t p_node1, uint32_t p_node2) {
@@ -848,6 +854,8 @@ void GodotSoftBody3D::append_link(uint32_t p_node1, uint32_t p_node2) {
 	link.rl = (node1->x - node2->x).length();
 
 	links.push_back(link);
+
+	link_colors_dirty = true;
 }
 
 void GodotSoftBody3D::append_face(uint32_t p_node1, uint32_t p_node2, uint32_t p_node3) {
@@ -1085,7 +1093,7 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 	face_tree.optimize_incremental(1);
 }
 
-void GodotSoftBody3D::solve_constraints(real_t p_delta) {
+void GodotSoftBody3D::solve_constraints(real_t p_delta, bool p_parallel) {
 	const real_t inv_delta = 1.0 / p_delta;
 
 	uint32_t i, ni;
@@ -1103,9 +1111,17 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	}
 
 	// Solve positions.
-	for (int isolve = 0; isolve < iteration_count; ++isolve) {
-		const real_t ti = isolve / (real_t)iteration_count;
-		solve_links(1.0, ti);
+	if (p_parallel && links.size() >= SOFT_BODY_LINK_MIN_PARALLEL_SIZE) {
+		// Colored order changes the Gauss-Seidel sweep order, only used for large bodies.
+		update_link_colors();
+		for (int isolve = 0; isolve < iteration_count; ++isolve) {
+			solve_links_colored(1.0);
+		}
+	} else {
+		for (int isolve = 0; isolve < iteration_count; ++isolve) {
+			const real_t ti = isolve / (real_t)iteration_count;
+			solve_links(1.0, ti);
+		}
 	}
 	const real_t vc = (1.0 - damping_coefficient) * inv_delta;
 	for (i = 0, ni = nodes.size(); i < ni; ++i) {
@@ -1124,18 +1140,88 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 
 void GodotSoftBody3D::solve_links(real_t kst, real_t ti) {
 	for (uint32_t i = 0, ni = links.size(); i < ni; ++i) {
-		Link &link = links[i];
-		if (link.c0 > 0) {
-			Node &node_a = *link.n[0];
-			Node &node_b = *link.n[1];
-			const Vector3 del = node_b.x - node_a.x;
-			const real_t len = del.length_squared();
-			if (link.c1 + len > CMP_EPSILON) {
-				const real_t k = ((link.c1 - len) / (link.c0 * (link.c1 + len))) * kst;
-				node_a.x -= del * (k * node_a.im);
-				node_b.x += del * (k * node_b.im);
+		solve_link(links[i], kst);
+	}
+}
+
+void GodotSoftBody3D::update_link_colors() {
+	if (!link_colors_dirty) {
+		return;
+	}
+	link_colors_dirty = false;
+
+	const uint32_t link_count = links.size();
+	const Node *node_base = nodes.ptr();
+
+	// Greedy coloring, each node keeps a mask of the colors already used by its links.
+	LocalVector<uint64_t> node_colors;
+	node_colors.resize(nodes.size());
+	memset(node_colors.ptr(), 0, nodes.size() * sizeof(uint64_t));
+
+	LocalVector<uint32_t> link_color;
+	link_color.resize(link_count);
+
+	uint32_t color_counts[SOFT_BODY_LINK_COLOR_MAX + 1] = {};
+	for (uint32_t i = 0; i < link_count; ++i) {
+		const uint32_t a = links[i].n[0] - node_base;
+		const uint32_t b = links[i].n[1] - node_base;
+		const uint64_t used = node_colors[a] | node_colors[b];
+		uint32_t color = SOFT_BODY_LINK_COLOR_MAX;
+		if (used != UINT64_MAX) {
+			color = 0;
+			while (used & (uint64_t(1) << color)) {
+				color++;
+			}
+			node_colors[a] |= uint64_t(1) << color;
+			node_colors[b] |= uint64_t(1) << color;
+		}
+		link_color[i] = color;
+		color_counts[color]++;
+	}
+
+	link_color_offsets.resize(SOFT_BODY_LINK_COLOR_MAX + 2);
+	link_color_offsets[0] = 0;
+	for (uint32_t c = 0; c <= SOFT_BODY_LINK_COLOR_MAX; ++c) {
+		link_color_offsets[c + 1] = link_color_offsets[c] + color_counts[c];
+	}
+
+	// Stable fill keeps the reoptimized link order inside each color.
+	link_color_order.resize(link_count);
+	uint32_t fill[SOFT_BODY_LINK_COLOR_MAX + 1];
+	for (uint32_t c = 0; c <= SOFT_BODY_LINK_COLOR_MAX; ++c) {
+		fill[c] = link_color_offsets[c];
+	}
+	for (uint32_t i = 0; i < link_count; ++i) {
+		link_color_order[fill[link_color[i]]++] = i;
+	}
+}
+
+void GodotSoftBody3D::_solve_link_color(uint32_t p_index, void *p_userdata) {
+	solve_link(links[link_color_order[link_color_offsets[link_solve_color] + p_index]], link_solve_kst);
+}
+
+void GodotSoftBody3D::solve_links_colored(real_t kst) {
+	link_solve_kst = kst;
+
+	for (uint32_t c = 0; c < SOFT_BODY_LINK_COLOR_MAX; ++c) {
+		const uint32_t count = link_color_offsets[c + 1] - link_color_offsets[c];
+		if (count == 0) {
+			continue;
+		}
+		if (count < SOFT_BODY_LINK_MIN_PARALLEL_SIZE / 4) {
+			for (uint32_t i = link_color_offsets[c], ni = link_color_offsets[c + 1]; i < ni; ++i) {
+				solve_link(links[link_color_order[i]], kst);
 			}
+			continue;
 		}
+		link_solve_color = c;
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotSoftBody3D::_solve_link_color, nullptr, count, -1, true, SNAME("SoftBody3DSolveLinks"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// Links that ran out of colors.
+	for (uint32_t i = link_color_offsets[SOFT_BODY_LINK_COLOR_MAX], ni = link_color_offsets[SOFT_BODY_LINK_COLOR_MAX + 1]; i < ni; ++i) {
+		solve_link(links[link_color_order[i]], kst);
 	}
 }
 
@@ -1252,6 +1338,10 @@ void GodotSoftBody3D::destroy() {
 	links.clear();
 	faces.clear();
 
+	link_color_order.clear();
+	link_color_offsets.clear();
+	link_colors_dirty = true;
+
 	bounds = AABB();
 	deinitialize_shape();
 }
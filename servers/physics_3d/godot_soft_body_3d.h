@@ -82,6 +82,14 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	LocalVector<Link> links;
 	LocalVector<Face> faces;
 
+	// Link indices grouped by color, links of the same color share no node and can be solved in parallel.
+	// The last group holds the links left over once colors run out and is solved serially.
+	LocalVector<uint32_t> link_color_order;
+	LocalVector<uint32_t> link_color_offsets;
+	bool link_colors_dirty = true;
+	uint32_t link_solve_color = 0;
+	real_t link_solve_kst = 1.0;
+
 	DynamicBVH node_tree;
 	DynamicBVH face_tree;
 
@@ -202,7 +210,7 @@ public:
 	_FORCE_INLINE_ real_t get_drag_coefficient() const { return drag_coefficient; }
 
 	void predict_motion(real_t p_delta);
-	void solve_constraints(real_t p_delta);
+	void solve_constraints(real_t p_delta, bool p_parallel = false);
 
 	_FORCE_INLINE_ uint32_t get_node_index(void *p_node) const { return static_cast<Node *>(p_node)->index; }
 	_FORCE_INLINE_ uint32_t get_face_index(void *p_face) const { return static_cast<Face *>(p_face)->index; }
@@ -237,7 +245,24 @@ private:
 	void append_link(uint32_t p_node1, uint32_t p_node2);
 	void append_face(uint32_t p_node1, uint32_t p_node2, uint32_t p_node3);
 
+	_FORCE_INLINE_ static void solve_link(Link &p_link, real_t p_kst) {
+		if (p_link.c0 > 0) {
+			Node &node_a = *p_link.n[0];
+			Node &node_b = *p_link.n[1];
+			const Vector3 del = node_b.x - node_a.x;
+			const real_t len = del.length_squared();
+			if (p_link.c1 + len > CMP_EPSILON) {
+				const real_t k = ((p_link.c1 - len) / (p_link.c0 * (p_link.c1 + len))) * p_kst;
+				node_a.x -= del * (k * node_a.im);
+				node_b.x += del * (k * node_b.im);
+			}
+		}
+	}
+
 	void solve_links(real_t kst, real_t ti);
+	void solve_links_colored(real_t kst);
+	void update_link_colors();
+	void _solve_link_color(uint32_t p_index, void *p_userdata);
 
 	void initialize_face_tree();
 	void update_face_tree(real_t p_delta);
@@ -34,6 +34,7 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/templates/sort_array.h"
 
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
@@ -105,17 +106,13 @@ int GodotPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_par
 	return cc;
 }
 
-bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
-	ERR_FAIL_COND_V(space->locked, false);
-
+bool GodotPhysicsDirectSpaceState3D::_intersect_ray_candidates(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D *const *p_candidates, const int *p_candidate_shapes, int p_candidate_count, RayResult &r_result) const {
 	Vector3 begin, end;
 	Vector3 normal;
-	begin = p_parameters.from;
-	end = p_parameters.to;
+	begin = p_from;
+	end = p_to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
-
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
 	bool collided = false;
@@ -124,22 +121,22 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	const GodotCollisionObject3D *res_obj = nullptr;
 	real_t min_d = 1e10;
 
-	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+	for (int i = 0; i < p_candidate_count; i++) {
+		if (!_can_collide_with(p_candidates[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(p_candidates[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_candidates[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = p_candidates[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = p_candidate_shapes[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -201,6 +198,59 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	return true;
 }
 
+bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	ERR_FAIL_COND_V(space->locked, false);
+
+	int amount = space->broadphase->cull_segment(p_parameters.from, p_parameters.to, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+
+	return _intersect_ray_candidates(p_parameters, p_parameters.from, p_parameters.to, space->intersection_query_results, space->intersection_query_subindex_results, amount, r_result);
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_ray_packet(uint32_t p_packet_index, RayBatch *p_batch) {
+	int first = p_packet_index * GodotBroadPhase3D::SEGMENT_PACKET_SIZE;
+	int count = MIN(GodotBroadPhase3D::SEGMENT_PACKET_SIZE, p_batch->ray_count - first);
+
+	// Each packet has its own candidate buffers, so packets can be processed concurrently.
+	LocalVector<GodotCollisionObject3D *> candidates;
+	LocalVector<int> candidate_shapes;
+	candidates.resize(count * RAY_PACKET_CANDIDATES_MAX);
+	candidate_shapes.resize(count * RAY_PACKET_CANDIDATES_MAX);
+	int candidate_counts[GodotBroadPhase3D::SEGMENT_PACKET_SIZE];
+
+	space->broadphase->cull_segment_packet(&p_batch->from[first], &p_batch->to[first], count, candidates.ptr(), candidate_shapes.ptr(), RAY_PACKET_CANDIDATES_MAX, candidate_counts);
+
+	for (int i = 0; i < count; i++) {
+		int ray_index = first + i;
+		int offset = i * RAY_PACKET_CANDIDATES_MAX;
+		p_batch->hits[ray_index] = _intersect_ray_candidates(*p_batch->parameters, p_batch->from[ray_index], p_batch->to[ray_index], &candidates[offset], &candidate_shapes[offset], candidate_counts[i], p_batch->results[ray_index]);
+	}
+}
+
+void GodotPhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_hits) {
+	ERR_FAIL_COND(space->locked);
+	if (p_ray_count <= 0) {
+		return;
+	}
+
+	RayBatch batch;
+	batch.parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.ray_count = p_ray_count;
+	batch.results = r_results;
+	batch.hits = r_hits;
+
+	uint32_t packet_count = (p_ray_count + GodotBroadPhase3D::SEGMENT_PACKET_SIZE - 1) / GodotBroadPhase3D::SEGMENT_PACKET_SIZE;
+	if (packet_count == 1) {
+		_intersect_ray_packet(0, &batch);
+		return;
+	}
+
+	// The space can't change while this runs, since it's only stepped from the thread that called this.
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_ray_packet, &batch, packet_count, -1, true, SNAME("Physics3DIntersectRays"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	if (p_result_max <= 0) {
 		return 0;
@@ -1034,6 +1084,12 @@ void *GodotSpace3D::_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A
 
 	GodotSpace3D *self = static_cast<GodotSpace3D *>(p_self);
 
+	if (self->deterministic_order && type_A == type_B && A->get_self().get_id() > B->get_self().get_id()) {
+		// Which object the broadphase reports first depends on the order they moved in.
+		SWAP(A, B);
+		SWAP(p_subindex_A, p_subindex_B);
+	}
+
 	self->collision_pairs++;
 
 	if (type_A == GodotCollisionObject3D::TYPE_AREA) {
@@ -1248,6 +1304,159 @@ GodotPhysicsDirectSpaceState3D *GodotSpace3D::get_direct_state() {
 	return direct_access;
 }
 
+#define SNAPSHOT_MAGIC 0x33535047 // "GPS3"
+#define SNAPSHOT_VERSION 1
+
+void GodotSpace3D::_get_snapshot_bodies(LocalVector<GodotBody3D *> &r_bodies) const {
+	struct BodyRIDCompare {
+		_FORCE_INLINE_ bool operator()(const GodotBody3D *p_a, const GodotBody3D *p_b) const {
+			return p_a->get_self().get_id() < p_b->get_self().get_id();
+		}
+	};
+
+	for (GodotCollisionObject3D *E : objects) {
+		if (E->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			r_bodies.push_back(static_cast<GodotBody3D *>(E));
+		}
+	}
+
+	SortArray<GodotBody3D *, BodyRIDCompare> sorter;
+	sorter.sort(r_bodies.ptr(), r_bodies.size());
+}
+
+void GodotSpace3D::_get_snapshot_constraints(const LocalVector<GodotBody3D *> &p_bodies, LocalVector<SnapshotConstraint> &r_constraints) const {
+	for (uint32_t i = 0; i < p_bodies.size(); i++) {
+		for (const KeyValue<GodotConstraint3D *, int> &E : p_bodies[i]->get_constraint_map()) {
+			// Only listed from their first body, as they're in the map of every body they link.
+			if (E.key->get_body_ptr()[0] != p_bodies[i]) {
+				continue;
+			}
+			SnapshotConstraint constraint;
+			constraint.key = E.key->get_order_key();
+			constraint.constraint = E.key;
+			r_constraints.push_back(constraint);
+		}
+	}
+
+	// Sorted, so that equal states always give equal snapshots.
+	r_constraints.sort();
+}
+
+Vector<uint8_t> GodotSpace3D::create_snapshot() const {
+	ERR_FAIL_COND_V_MSG(locked, Vector<uint8_t>(), "Can't take a snapshot of a space while it's being stepped.");
+
+	LocalVector<GodotBody3D *> bodies;
+	_get_snapshot_bodies(bodies);
+
+	PhysicsSnapshotWriter writer;
+	writer.put_u32(SNAPSHOT_MAGIC);
+	writer.put_u32(SNAPSHOT_VERSION);
+	writer.put_u32(sizeof(real_t));
+
+	// Records are prefixed with their size, so that restoring can skip the ones it has no use for.
+	writer.put_u32(bodies.size());
+	for (uint32_t i = 0; i < bodies.size(); i++) {
+		writer.put_u64(bodies[i]->get_self().get_id());
+		uint32_t size_position = writer.get_position();
+		writer.put_u32(0);
+		bodies[i]->save_snapshot(writer);
+		writer.set_u32(size_position, writer.get_position() - size_position - 4);
+	}
+
+	LocalVector<SnapshotConstraint> constraints;
+	_get_snapshot_constraints(bodies, constraints);
+
+	uint32_t count_position = writer.get_position();
+	writer.put_u32(0);
+	uint32_t constraint_count = 0;
+	for (uint32_t i = 0; i < constraints.size(); i++) {
+		uint32_t record_position = writer.get_position();
+		writer.put_u64(constraints[i].key.a);
+		writer.put_u64(constraints[i].key.b);
+		writer.put_u64(constraints[i].key.shapes);
+		uint32_t size_position = writer.get_position();
+		writer.put_u32(0);
+		if (!constraints[i].constraint->save_snapshot(writer)) {
+			writer.truncate(record_position);
+			continue;
+		}
+		writer.set_u32(size_position, writer.get_position() - size_position - 4);
+		constraint_count++;
+	}
+	writer.set_u32(count_position, constraint_count);
+
+	return writer.get_data();
+}
+
+bool GodotSpace3D::restore_snapshot(const Vector<uint8_t> &p_snapshot) {
+	ERR_FAIL_COND_V_MSG(locked, false, "Can't restore a snapshot of a space while it's being stepped.");
+
+	PhysicsSnapshotReader reader(p_snapshot.ptr(), p_snapshot.size());
+	ERR_FAIL_COND_V_MSG(reader.get_u32() != SNAPSHOT_MAGIC, false, "Invalid physics space snapshot.");
+	ERR_FAIL_COND_V_MSG(reader.get_u32() != SNAPSHOT_VERSION, false, "Unsupported physics space snapshot version.");
+	ERR_FAIL_COND_V_MSG(reader.get_u32() != sizeof(real_t), false, "Physics space snapshot was created with a different floating-point precision.");
+
+	HashMap<uint64_t, GodotBody3D *> bodies;
+	for (GodotCollisionObject3D *E : objects) {
+		if (E->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			bodies.insert(E->get_self().get_id(), static_cast<GodotBody3D *>(E));
+		}
+	}
+
+	// Check the bodies first, so that a snapshot that doesn't match the space is refused before changing anything.
+	uint32_t body_count = reader.get_u32();
+	uint32_t bodies_position = reader.get_position();
+	for (uint32_t i = 0; i < body_count && !reader.has_overflowed(); i++) {
+		uint64_t id = reader.get_u64();
+		uint32_t size = reader.get_u32();
+		ERR_FAIL_COND_V_MSG(!bodies.has(id), false, "Physics space snapshot refers to a body that isn't in this space anymore.");
+		reader.seek(reader.get_position() + size);
+	}
+	ERR_FAIL_COND_V_MSG(reader.has_overflowed(), false, "Physics space snapshot is truncated.");
+
+	reader.seek(bodies_position);
+	for (uint32_t i = 0; i < body_count; i++) {
+		GodotBody3D *body = bodies[reader.get_u64()];
+		uint32_t size = reader.get_u32();
+		uint32_t record_end = reader.get_position() + size;
+		body->restore_snapshot(reader);
+		reader.seek(record_end);
+	}
+
+	// Pair the restored positions right away, so the new pairs can get their cached state back too.
+	broadphase->update();
+
+	HashMap<GodotConstraint3D::OrderKey, GodotConstraint3D *, GodotConstraint3D::OrderKey> constraints;
+	for (const KeyValue<uint64_t, GodotBody3D *> &E : bodies) {
+		for (const KeyValue<GodotConstraint3D *, int> &C : E.value->get_constraint_map()) {
+			if (C.key->get_body_ptr()[0] == E.value) {
+				C.key->reset_snapshot_state();
+				constraints.insert(C.key->get_order_key(), C.key);
+			}
+		}
+	}
+
+	uint32_t constraint_count = reader.get_u32();
+	for (uint32_t i = 0; i < constraint_count && !reader.has_overflowed(); i++) {
+		GodotConstraint3D::OrderKey key;
+		key.a = reader.get_u64();
+		key.b = reader.get_u64();
+		key.shapes = reader.get_u64();
+		uint32_t size = reader.get_u32();
+		uint32_t record_end = reader.get_position() + size;
+
+		// Pairs that aren't overlapping anymore are gone, along with their state.
+		GodotConstraint3D **constraint = constraints.getptr(key);
+		if (constraint) {
+			(*constraint)->restore_snapshot(reader);
+		}
+		reader.seek(record_end);
+	}
+	ERR_FAIL_COND_V_MSG(reader.has_overflowed(), false, "Physics space snapshot is truncated.");
+
+	return true;
+}
+
 GodotSpace3D::GodotSpace3D() {
 	body_linear_velocity_sleep_threshold = GLOBAL_DEF("physics/3d/sleep_threshold_linear", 0.1);
 	body_angular_velocity_sleep_threshold = GLOBAL_DEF("physics/3d/sleep_threshold_angular", Math::deg_to_rad(8.0));
@@ -1257,6 +1466,11 @@ GodotSpace3D::GodotSpace3D() {
 	solver_iterations = GLOBAL_DEF("physics/3d/solver/solver_iterations", 16);
 	ProjectSettings::get_singleton()->set_custom_property_info("physics/3d/solver/solver_iterations", PropertyInfo(Variant::INT, "physics/3d/solver/solver_iterations", PROPERTY_HINT_RANGE, "1,32,1,or_greater"));
 
+	parallel_island_constraint_threshold = GLOBAL_DEF("physics/3d/solver/parallel_island_constraint_threshold", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("physics/3d/solver/parallel_island_constraint_threshold", PropertyInfo(Variant::INT, "physics/3d/solver/parallel_island_constraint_threshold", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"));
+
+	deterministic_order = GLOBAL_DEF("physics/3d/solver/deterministic_order", false);
+
 	contact_recycle_radius = GLOBAL_DEF("physics/3d/solver/contact_recycle_radius", 0.01);
 	ProjectSettings::get_singleton()->set_custom_property_info("physics/3d/solver/contact_recycle_radius", PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_recycle_radius", PROPERTY_HINT_RANGE, "0,0.1,0.01,or_greater"));
 
@@ -46,11 +46,28 @@
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	enum {
+		RAY_PACKET_CANDIDATES_MAX = 256, // Broadphase results kept per ray in batched queries.
+	};
+
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		int ray_count = 0;
+		RayResult *results = nullptr;
+		bool *hits = nullptr;
+	};
+
+	bool _intersect_ray_candidates(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D *const *p_candidates, const int *p_candidate_shapes, int p_candidate_count, RayResult &r_result) const;
+	void _intersect_ray_packet(uint32_t p_packet_index, RayBatch *p_batch);
+
 public:
 	GodotSpace3D *space = nullptr;
 
 	virtual int intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) override;
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_hits) override;
 	virtual int intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info = nullptr) override;
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) override;
@@ -94,6 +111,8 @@ private:
 	GodotArea3D *area = nullptr;
 
 	int solver_iterations = 0;
+	int parallel_island_constraint_threshold = 0;
+	bool deterministic_order = false;
 
 	real_t contact_recycle_radius = 0.0;
 	real_t contact_max_separation = 0.0;
@@ -121,6 +140,16 @@ private:
 
 	RID static_global_body;
 
+	struct SnapshotConstraint {
+		GodotConstraint3D::OrderKey key;
+		GodotConstraint3D *constraint = nullptr;
+
+		bool operator<(const SnapshotConstraint &p_other) const { return key < p_other.key; }
+	};
+
+	void _get_snapshot_bodies(LocalVector<GodotBody3D *> &r_bodies) const;
+	void _get_snapshot_constraints(const LocalVector<GodotBody3D *> &p_bodies, LocalVector<SnapshotConstraint> &r_constraints) const;
+
 	Vector<Vector3> contact_debug;
 	int contact_debug_count = 0;
 
@@ -161,6 +190,8 @@ public:
 	const HashSet<GodotCollisionObject3D *> &get_objects() const;
 
 	_FORCE_INLINE_ int get_solver_iterations() const { return solver_iterations; }
+	_FORCE_INLINE_ int get_parallel_island_constraint_threshold() const { return parallel_island_constraint_threshold; }
+	_FORCE_INLINE_ bool is_deterministic_order() const { return deterministic_order; }
 	_FORCE_INLINE_ real_t get_contact_recycle_radius() const { return contact_recycle_radius; }
 	_FORCE_INLINE_ real_t get_contact_max_separation() const { return contact_max_separation; }
 	_FORCE_INLINE_ real_t get_contact_max_allowed_penetration() const { return contact_max_allowed_penetration; }
@@ -193,6 +224,9 @@ public:
 
 	GodotPhysicsDirectSpaceState3D *get_direct_state();
 
+	Vector<uint8_t> create_snapshot() const;
+	bool restore_snapshot(const Vector<uint8_t> &p_snapshot);
+
 	void set_debug_contacts(int p_amount) { contact_debug.resize(p_amount); }
 	_FORCE_INLINE_ bool is_debugging_contacts() const { return !contact_debug.is_empty(); }
 	_FORCE_INLINE_ void add_debug_contact(const Vector3 &p_contact) {
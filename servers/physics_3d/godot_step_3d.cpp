@@ -32,13 +32,24 @@
 
 #include "godot_joint_3d.h"
 
+#include "core/debugger/trace_profiler.h"
 #include "core/os/os.h"
+#include "core/templates/sort_array.h"
 
 #define BODY_ISLAND_COUNT_RESERVE 128
 #define BODY_ISLAND_SIZE_RESERVE 512
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define ISLAND_BATCH_COLOR_MAX 64
+#define ISLAND_BATCH_MIN_PARALLEL_SIZE 32
+#define BODY_INTEGRATION_MIN_PARALLEL_SIZE 64
+
+struct ConstraintOrderCompare {
+	_FORCE_INLINE_ bool operator()(const GodotConstraint3D *p_a, const GodotConstraint3D *p_b) const {
+		return p_a->get_order_key() < p_b->get_order_key();
+	}
+};
 
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -111,6 +122,21 @@ void GodotStep3D::_populate_island_soft_body(GodotSoftBody3D *p_soft_body, Local
 	}
 }
 
+void GodotStep3D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void GodotStep3D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities(delta);
+}
+
+void GodotStep3D::_finish_integration() {
+	// Serially and in order, so the broadphase gets the same changes as when integrating serially.
+	for (uint32_t i = 0; i < active_bodies.size(); i++) {
+		active_bodies[i]->finish_integration();
+	}
+}
+
 void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
 	GodotConstraint3D *constraint = all_constraints[p_constraint_index];
 	constraint->setup(delta);
@@ -132,6 +158,10 @@ void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constrai
 void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
 
+	if (_is_large_island(constraint_island)) {
+		return; // Solved separately in parallel batches, see _solve_large_island().
+	}
+
 	int current_priority = 1;
 
 	uint32_t constraint_count = constraint_island.size();
@@ -157,6 +187,114 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
+void GodotStep3D::_color_large_island(const LocalVector<GodotConstraint3D *> &p_constraint_island) {
+	// Greedy graph coloring, constraints with the same color don't share any rigid body,
+	// so they can be solved concurrently. Static and kinematic bodies are only read.
+	body_colors.clear();
+	for (uint32_t batch_index = 0; batch_index < island_batches.size(); ++batch_index) {
+		island_batches[batch_index].clear();
+	}
+	island_batches.resize(ISLAND_BATCH_COLOR_MAX + 1);
+	LocalVector<GodotConstraint3D *> &serial_batch = island_batches[ISLAND_BATCH_COLOR_MAX];
+
+	uint32_t constraint_count = p_constraint_island.size();
+	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+		GodotConstraint3D *constraint = p_constraint_island[constraint_index];
+
+		if (constraint->get_soft_body_count() > 0) {
+			// Soft body constraints touch many shared nodes, keep them serial.
+			serial_batch.push_back(constraint);
+			continue;
+		}
+
+		GodotBody3D **bodies = constraint->get_body_ptr();
+		int body_count = constraint->get_body_count();
+
+		uint64_t used_colors = 0;
+		for (int i = 0; i < body_count; i++) {
+			if (bodies[i]->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				const uint64_t *colors = body_colors.getptr(bodies[i]);
+				if (colors) {
+					used_colors |= *colors;
+				}
+			}
+		}
+
+		uint32_t color = 0;
+		while (color < ISLAND_BATCH_COLOR_MAX && (used_colors & (uint64_t(1) << color))) {
+			color++;
+		}
+
+		if (color == ISLAND_BATCH_COLOR_MAX) {
+			// Out of colors, this constraint involves a heavily shared body.
+			serial_batch.push_back(constraint);
+			continue;
+		}
+
+		for (int i = 0; i < body_count; i++) {
+			if (bodies[i]->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				uint64_t *colors = body_colors.getptr(bodies[i]);
+				if (colors) {
+					*colors |= uint64_t(1) << color;
+				} else {
+					body_colors.insert(bodies[i], uint64_t(1) << color);
+				}
+			}
+		}
+		island_batches[color].push_back(constraint);
+	}
+}
+
+void GodotStep3D::_solve_batch_constraint(uint32_t p_constraint_index, LocalVector<GodotConstraint3D *> *p_batch) {
+	(*p_batch)[p_constraint_index]->solve(delta);
+}
+
+void GodotStep3D::_solve_large_island(const LocalVector<GodotConstraint3D *> &p_constraint_island) {
+	_color_large_island(p_constraint_island);
+
+	int current_priority = 1;
+
+	uint32_t batch_count = island_batches.size();
+	uint32_t constraint_count = p_constraint_island.size();
+	while (constraint_count > 0) {
+		for (int i = 0; i < iterations; i++) {
+			// Go through all iterations, each batch must be complete before the next one starts.
+			for (uint32_t batch_index = 0; batch_index < batch_count; ++batch_index) {
+				LocalVector<GodotConstraint3D *> &batch = island_batches[batch_index];
+				if (batch_index < ISLAND_BATCH_COLOR_MAX && batch.size() >= ISLAND_BATCH_MIN_PARALLEL_SIZE) {
+					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_batch_constraint, &batch, batch.size(), -1, true, SNAME("Physics3DConstraintSolveBatch"));
+					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+				} else {
+					for (uint32_t constraint_index = 0; constraint_index < batch.size(); ++constraint_index) {
+						batch[constraint_index]->solve(delta);
+					}
+				}
+			}
+		}
+
+		// Check priority to keep only higher priority constraints.
+		constraint_count = 0;
+		++current_priority;
+		for (uint32_t batch_index = 0; batch_index < batch_count; ++batch_index) {
+			LocalVector<GodotConstraint3D *> &batch = island_batches[batch_index];
+			uint32_t priority_constraint_count = 0;
+			for (uint32_t constraint_index = 0; constraint_index < batch.size(); ++constraint_index) {
+				GodotConstraint3D *constraint = batch[constraint_index];
+				if (constraint->get_priority() >= current_priority) {
+					// Keep this constraint for the next iteration.
+					batch[priority_constraint_count++] = constraint;
+				}
+			}
+			batch.resize(priority_constraint_count);
+			constraint_count += priority_constraint_count;
+		}
+	}
+}
+
+void GodotStep3D::_solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata) {
+	active_soft_bodies[p_soft_body_index]->solve_constraints(delta);
+}
+
 void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -182,6 +320,7 @@ void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island
 }
 
 void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
+	TRACE_ZONE("GodotStep3D::step");
 	p_space->lock(); // can't access space during this
 
 	p_space->setup(); //update inertias, etc
@@ -189,6 +328,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	p_space->set_last_step(p_delta);
 
 	iterations = p_space->get_solver_iterations();
+	parallel_island_threshold = p_space->get_parallel_island_constraint_threshold();
 	delta = p_delta;
 
 	const SelfList<GodotBody3D>::List *body_list = &p_space->get_active_body_list();
@@ -202,12 +342,24 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	int active_count = 0;
 
+	// Bodies can deactivate while integrating, so the active list is copied first.
+	active_bodies.clear();
 	const SelfList<GodotBody3D> *b = body_list->first();
 	while (b) {
-		b->self()->integrate_forces(p_delta);
+		active_bodies.push_back(b->self());
 		b = b->next();
-		active_count++;
 	}
+	active_count += active_bodies.size();
+
+	if (active_bodies.size() >= BODY_INTEGRATION_MIN_PARALLEL_SIZE) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_forces, nullptr, active_bodies.size(), -1, true, SNAME("Physics3DIntegrateForces"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < active_bodies.size(); i++) {
+			_integrate_forces(i);
+		}
+	}
+	_finish_integration();
 
 	/* UPDATE SOFT BODY MOTION */
 
@@ -342,9 +494,28 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
-	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	WorkerThreadPool::GroupID group_task;
+	if (p_space->is_deterministic_order()) {
+		// The order islands are discovered in depends on the history of the space, sort them
+		// so they are solved the same way whatever the previous steps were.
+		// Setup runs serially too, as continuous collision detection adjusts body velocities.
+		SortArray<GodotConstraint3D *, ConstraintOrderCompare> sorter;
+		all_constraints.clear();
+		for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+			LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[island_index];
+			sorter.sort(constraint_island.ptr(), constraint_island.size());
+			for (uint32_t constraint_index = 0; constraint_index < constraint_island.size(); ++constraint_index) {
+				all_constraints.push_back(constraint_island[constraint_index]);
+			}
+		}
+		for (uint32_t constraint_index = 0; constraint_index < all_constraints.size(); ++constraint_index) {
+			_setup_constraint(constraint_index);
+		}
+	} else {
+		uint32_t total_constraint_count = all_constraints.size();
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
@@ -363,7 +534,21 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	// Warning: _solve_island modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
+	large_islands.clear();
+	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+		if (_is_large_island(constraint_islands[island_index])) {
+			large_islands.push_back(island_index);
+		}
+	}
+
 	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
+
+	// Large islands are skipped by _solve_island, their colored batches are dispatched
+	// from here while the worker threads go through the regular islands.
+	for (uint32_t large_island_index = 0; large_island_index < large_islands.size(); ++large_island_index) {
+		_solve_large_island(constraint_islands[large_islands[large_island_index]]);
+	}
+
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -374,13 +559,24 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
+	// Solving may have woken up bodies.
+	active_bodies.clear();
 	b = body_list->first();
 	while (b) {
-		const SelfList<GodotBody3D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n;
+		active_bodies.push_back(b->self());
+		b = b->next();
 	}
 
+	if (active_bodies.size() >= BODY_INTEGRATION_MIN_PARALLEL_SIZE) {
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_velocities, nullptr, active_bodies.size(), -1, true, SNAME("Physics3DIntegrateVelocities"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < active_bodies.size(); i++) {
+			_integrate_velocities(i);
+		}
+	}
+	_finish_integration();
+
 	/* SLEEP / WAKE UP ISLANDS */
 
 	for (uint32_t island_index = 0; island_index < body_island_count; ++island_index) {
@@ -389,12 +585,22 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY CONSTRAINTS */
 
+	active_soft_bodies.clear();
 	sb = soft_body_list->first();
 	while (sb) {
-		sb->self()->solve_constraints(p_delta);
+		active_soft_bodies.push_back(sb->self());
 		sb = sb->next();
 	}
 
+	if (active_soft_bodies.size() > 1) {
+		// Soft bodies only touch their own nodes and links, solve one per task.
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_soft_body_constraints, nullptr, active_soft_bodies.size(), -1, true, SNAME("Physics3DSoftBodySolve"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (active_soft_bodies.size() == 1) {
+		// A single body splits its own link solve across threads instead.
+		active_soft_bodies[0]->solve_constraints(p_delta, true);
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_INTEGRATE_VELOCITIES, profile_endtime - profile_begtime);
@@ -42,15 +42,32 @@ class GodotStep3D {
 	int iterations = 0;
 	real_t delta = 0.0;
 
+	LocalVector<GodotBody3D *> active_bodies;
+	LocalVector<GodotSoftBody3D *> active_soft_bodies;
 	LocalVector<LocalVector<GodotBody3D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
 
+	uint32_t parallel_island_threshold = 0;
+	LocalVector<uint32_t> large_islands;
+	LocalVector<LocalVector<GodotConstraint3D *>> island_batches; // Constraints grouped by color, last one is solved serially.
+	HashMap<const GodotBody3D *, uint64_t> body_colors;
+
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
+	void _integrate_forces(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _integrate_velocities(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata = nullptr);
+	void _finish_integration();
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	_FORCE_INLINE_ bool _is_large_island(const LocalVector<GodotConstraint3D *> &p_constraint_island) const {
+		return parallel_island_threshold > 0 && p_constraint_island.size() >= parallel_island_threshold;
+	}
+	void _color_large_island(const LocalVector<GodotConstraint3D *> &p_constraint_island);
+	void _solve_batch_constraint(uint32_t p_constraint_index, LocalVector<GodotConstraint3D *> *p_batch);
+	void _solve_large_island(const LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
 
 public:
@@ -274,6 +274,10 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// For rollback, only works outside of the physics step.
+	virtual PackedByteArray space_create_snapshot(RID p_space) const = 0;
+	virtual bool space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) = 0;
+
 	//missing space parameters
 
 	/* AREA API */
@@ -125,6 +125,16 @@ public:
 		return physics_server_2d->space_get_contact_count(p_space);
 	}
 
+	virtual PackedByteArray space_create_snapshot(RID p_space) const override {
+		ERR_FAIL_COND_V(main_thread != Thread::get_caller_id(), PackedByteArray());
+		return physics_server_2d->space_create_snapshot(p_space);
+	}
+
+	virtual bool space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) override {
+		ERR_FAIL_COND_V(main_thread != Thread::get_caller_id(), false);
+		return physics_server_2d->space_restore_snapshot(p_space, p_snapshot);
+	}
+
 	/* AREA API */
 
 	//FUNC0RID(area);
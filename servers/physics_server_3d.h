@@ -122,6 +122,7 @@ class PhysicsDirectSpaceState3D : public Object {
 
 private:
 	Dictionary _intersect_ray(const Ref<PhysicsRayQueryParameters3D> &p_ray_query);
+	Dictionary _intersect_rays(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_origins, const PackedVector3Array &p_directions);
 	TypedArray<Dictionary> _intersect_point(const Ref<PhysicsPointQueryParameters3D> &p_point_query, int p_max_results = 32);
 	TypedArray<Dictionary> _intersect_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
 	Vector<real_t> _cast_motion(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
@@ -157,6 +158,9 @@ public:
 	};
 
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) = 0;
+	// Casts p_ray_count rays sharing p_parameters, except for from and to. r_hits[i] tells whether r_results[i] is set.
+	// Servers should override this to share the broadphase traversal and spread the rays over threads.
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_hits);
 
 	struct ShapeResult {
 		RID rid;
@@ -305,6 +309,10 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// For rollback, only works outside of the physics step.
+	virtual PackedByteArray space_create_snapshot(RID p_space) const = 0;
+	virtual bool space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) = 0;
+
 	//missing space parameters
 
 	/* AREA API */
@@ -374,6 +382,10 @@ public:
 
 	virtual void area_set_monitor_callback(RID p_area, const Callable &p_callback) = 0;
 	virtual void area_set_area_monitor_callback(RID p_area, const Callable &p_callback) = 0;
+	virtual void area_set_monitor_batched(RID p_area, bool p_batched) = 0;
+
+	virtual void area_get_overlapping_bodies(RID p_area, List<RID> *p_bodies) = 0;
+	virtual void area_get_overlapping_areas(RID p_area, List<RID> *p_areas) = 0;
 
 	virtual void area_set_ray_pickable(RID p_area, bool p_enable) = 0;
 
@@ -129,6 +129,16 @@ public:
 		return physics_server_3d->space_get_contact_count(p_space);
 	}
 
+	virtual PackedByteArray space_create_snapshot(RID p_space) const override {
+		ERR_FAIL_COND_V(main_thread != Thread::get_caller_id(), PackedByteArray());
+		return physics_server_3d->space_create_snapshot(p_space);
+	}
+
+	virtual bool space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) override {
+		ERR_FAIL_COND_V(main_thread != Thread::get_caller_id(), false);
+		return physics_server_3d->space_restore_snapshot(p_space, p_snapshot);
+	}
+
 	/* AREA API */
 
 	//FUNC0RID(area);
@@ -168,6 +178,10 @@ public:
 
 	FUNC2(area_set_monitor_callback, RID, const Callable &);
 	FUNC2(area_set_area_monitor_callback, RID, const Callable &);
+	FUNC2(area_set_monitor_batched, RID, bool);
+
+	FUNC2S(area_get_overlapping_bodies, RID, List<RID> *);
+	FUNC2S(area_get_overlapping_areas, RID, List<RID> *);
 
 	/* BODY API */
 
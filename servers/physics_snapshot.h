@@ -0,0 +1,190 @@
+/*************************************************************************/
+/*  physics_snapshot.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef PHYSICS_SNAPSHOT_H
+#define PHYSICS_SNAPSHOT_H
+
+#include "core/io/marshalls.h"
+#include "core/math/transform_2d.h"
+#include "core/math/transform_3d.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/vector.h"
+
+// Little-endian writer and reader for the space snapshots of the built-in physics
+// servers. Reals are stored with the precision of real_t, so a snapshot can only be
+// restored by a build using the same precision.
+
+class PhysicsSnapshotWriter {
+	LocalVector<uint8_t> data;
+
+	_FORCE_INLINE_ uint8_t *_grow(uint32_t p_size) {
+		uint32_t offset = data.size();
+		data.resize(offset + p_size);
+		return data.ptr() + offset;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_position() const { return data.size(); }
+
+	_FORCE_INLINE_ void put_u32(uint32_t p_value) { encode_uint32(p_value, _grow(4)); }
+	_FORCE_INLINE_ void put_u64(uint64_t p_value) { encode_uint64(p_value, _grow(8)); }
+	_FORCE_INLINE_ void put_real(real_t p_value) {
+#ifdef REAL_T_IS_DOUBLE
+		encode_double(p_value, _grow(8));
+#else
+		encode_float(p_value, _grow(4));
+#endif
+	}
+
+	void put_vector2(const Vector2 &p_value) {
+		put_real(p_value.x);
+		put_real(p_value.y);
+	}
+
+	void put_vector3(const Vector3 &p_value) {
+		put_real(p_value.x);
+		put_real(p_value.y);
+		put_real(p_value.z);
+	}
+
+	void put_transform_2d(const Transform2D &p_value) {
+		for (int i = 0; i < 3; i++) {
+			put_vector2(p_value.columns[i]);
+		}
+	}
+
+	void put_transform_3d(const Transform3D &p_value) {
+		for (int i = 0; i < 3; i++) {
+			put_vector3(p_value.basis.rows[i]);
+		}
+		put_vector3(p_value.origin);
+	}
+
+	// Drops everything written after p_position.
+	void truncate(uint32_t p_position) {
+		ERR_FAIL_COND(p_position > data.size());
+		data.resize(p_position);
+	}
+
+	// Writes p_value at a position that was reserved earlier, used for record sizes.
+	void set_u32(uint32_t p_position, uint32_t p_value) {
+		ERR_FAIL_COND(p_position + 4 > data.size());
+		encode_uint32(p_value, data.ptr() + p_position);
+	}
+
+	Vector<uint8_t> get_data() const {
+		Vector<uint8_t> result;
+		result.resize(data.size());
+		if (data.size()) {
+			memcpy(result.ptrw(), data.ptr(), data.size());
+		}
+		return result;
+	}
+};
+
+class PhysicsSnapshotReader {
+	const uint8_t *data = nullptr;
+	uint32_t size = 0;
+	uint32_t position = 0;
+	bool overflowed = false;
+
+	_FORCE_INLINE_ const uint8_t *_advance(uint32_t p_size) {
+		if (overflowed || position + p_size > size) {
+			overflowed = true;
+			static const uint8_t zero[8] = {};
+			return zero;
+		}
+		const uint8_t *ptr = data + position;
+		position += p_size;
+		return ptr;
+	}
+
+public:
+	// True if a read went past the end of the data, in which case every read after it returns zero.
+	_FORCE_INLINE_ bool has_overflowed() const { return overflowed; }
+	_FORCE_INLINE_ uint32_t get_position() const { return position; }
+
+	void seek(uint32_t p_position) {
+		if (p_position > size) {
+			overflowed = true;
+			return;
+		}
+		position = p_position;
+	}
+
+	_FORCE_INLINE_ uint32_t get_u32() { return decode_uint32(_advance(4)); }
+	_FORCE_INLINE_ uint64_t get_u64() { return decode_uint64(_advance(8)); }
+	_FORCE_INLINE_ real_t get_real() {
+#ifdef REAL_T_IS_DOUBLE
+		return decode_double(_advance(8));
+#else
+		return decode_float(_advance(4));
+#endif
+	}
+
+	Vector2 get_vector2() {
+		Vector2 v;
+		v.x = get_real();
+		v.y = get_real();
+		return v;
+	}
+
+	Vector3 get_vector3() {
+		Vector3 v;
+		v.x = get_real();
+		v.y = get_real();
+		v.z = get_real();
+		return v;
+	}
+
+	Transform2D get_transform_2d() {
+		Transform2D t;
+		for (int i = 0; i < 3; i++) {
+			t.columns[i] = get_vector2();
+		}
+		return t;
+	}
+
+	Transform3D get_transform_3d() {
+		Transform3D t;
+		for (int i = 0; i < 3; i++) {
+			t.basis.rows[i] = get_vector3();
+		}
+		t.origin = get_vector3();
+		return t;
+	}
+
+	PhysicsSnapshotReader(const uint8_t *p_data, uint32_t p_size) {
+		data = p_data;
+		size = p_size;
+	}
+};
+
+#endif // PHYSICS_SNAPSHOT_H
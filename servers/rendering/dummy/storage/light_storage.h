@@ -165,7 +165,8 @@ public:
 	void lightmap_instance_set_transform(RID p_lightmap, const Transform3D &p_transform) override {}
 
 	/* SHADOW ATLAS API */
-	virtual RID shadow_atlas_create() override { return RID(); }
+	virtual RID shadow_atlas_allocate() override { return RID(); }
+	virtual void shadow_atlas_initialize(RID p_rid) override {}
 	virtual void shadow_atlas_free(RID p_atlas) override {}
 	virtual void shadow_atlas_set_size(RID p_atlas, int p_size, bool p_16_bits = true) override {}
 	virtual void shadow_atlas_set_quadrant_subdivision(RID p_atlas, int p_quadrant, int p_subdivision) override {}
@@ -1971,6 +1971,15 @@ void RendererCanvasCull::canvas_item_set_default_texture_repeat(RID p_item, RS::
 	ci->texture_repeat = p_repeat;
 }
 
+// Called when a viewport skips drawing because no 2D state changed, so the notifiers visible in it stay visible.
+void RendererCanvasCull::retain_visibility_notifiers() {
+	SelfList<Item::VisibilityNotifierData> *E = visibility_notifier_list.first();
+	while (E) {
+		E->self()->visible_in_frame = RSG::rasterizer->get_frame_number();
+		E = E->next();
+	}
+}
+
 void RendererCanvasCull::update_visibility_notifiers() {
 	SelfList<Item::VisibilityNotifierData> *E = visibility_notifier_list.first();
 	while (E) {
@@ -316,6 +316,7 @@ public:
 	void canvas_item_set_default_texture_repeat(RID p_item, RS::CanvasItemTextureRepeat p_repeat);
 
 	void update_visibility_notifiers();
+	void retain_visibility_notifiers();
 
 	bool free(RID p_rid);
 	RendererCanvasCull();
@@ -0,0 +1,176 @@
+/*************************************************************************/
+/*  hiz_occlusion.cpp                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "hiz_occlusion.h"
+#include "core/config/project_settings.h"
+#include "servers/rendering/renderer_rd/storage_rd/material_storage.h"
+#include "servers/rendering/renderer_rd/uniform_set_cache_rd.h"
+
+using namespace RendererRD;
+
+void HiZOcclusion::HiZBuffers::ReadbackHZBuffer::set_depth(const Size2i &p_size, const float *p_depth) {
+	resize(p_size);
+	memcpy(mips[0], p_depth, sizeof(float) * p_size.x * p_size.y);
+	update_mips();
+}
+
+void HiZOcclusion::HiZBuffers::_readback_completed(const Vector<uint8_t> &p_data) {
+	ERR_FAIL_COND(pending_readbacks.is_empty());
+
+	PendingReadback readback = pending_readbacks.front()->get();
+	pending_readbacks.pop_front();
+
+	if (p_data.size() != int(readback.size.x * readback.size.y * sizeof(float))) {
+		return; // Buffer was resized while this was in flight.
+	}
+
+	hz_buffer.set_depth(readback.size, (const float *)p_data.ptr());
+	hz_cam_transform = readback.cam_transform;
+	hz_cam_projection = readback.cam_projection;
+}
+
+void HiZOcclusion::HiZBuffers::request_readback(const Transform3D &p_cam_transform, const Projection &p_cam_projection) {
+	Error err = RD::get_singleton()->buffer_get_data_async(depth_buffer, callable_mp(this, &HiZBuffers::_readback_completed));
+	ERR_FAIL_COND(err != OK);
+
+	PendingReadback readback;
+	readback.cam_transform = p_cam_transform;
+	readback.cam_projection = p_cam_projection;
+	readback.size = size;
+	pending_readbacks.push_back(readback);
+}
+
+const RendererSceneOcclusionCull::HZBuffer *HiZOcclusion::HiZBuffers::get_hz_buffer(Transform3D &r_cam_transform, Projection &r_cam_projection) const {
+	if (hz_buffer.is_empty()) {
+		return nullptr;
+	}
+
+	r_cam_transform = hz_cam_transform;
+	r_cam_projection = hz_cam_projection;
+	return &hz_buffer;
+}
+
+void HiZOcclusion::HiZBuffers::free_data() {
+	if (depth_buffer.is_valid()) {
+		RD::get_singleton()->free(depth_buffer);
+		depth_buffer = RID();
+	}
+	size = Size2i();
+	hz_buffer.clear();
+}
+
+HiZOcclusion::HiZBuffers::~HiZBuffers() {
+	free_data();
+}
+
+HiZOcclusion::HiZOcclusion() {
+	Vector<String> hiz_modes;
+	hiz_modes.push_back("\n");
+
+	hiz.shader.initialize(hiz_modes);
+
+	hiz.shader_version = hiz.shader.version_create();
+
+	hiz.pipeline = RD::get_singleton()->compute_pipeline_create(hiz.shader.version_get_shader(hiz.shader_version, 0));
+
+	size_divisor = MAX(1, int(GLOBAL_GET("rendering/occlusion_culling/gpu_hiz/size_divisor")));
+}
+
+HiZOcclusion::~HiZOcclusion() {
+	hiz.shader.version_free(hiz.shader_version);
+}
+
+void HiZOcclusion::update(Ref<RenderSceneBuffersRD> p_render_buffers, const Transform3D &p_cam_transform, const Projection &p_cam_projection) {
+	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
+	ERR_FAIL_NULL(uniform_set_cache);
+	MaterialStorage *material_storage = MaterialStorage::get_singleton();
+	ERR_FAIL_NULL(material_storage);
+	ERR_FAIL_COND(p_render_buffers.is_null());
+
+	if (!p_render_buffers->has_custom_data(RB_SCOPE_HIZ_OCCLUSION)) {
+		p_render_buffers->set_custom_data(RB_SCOPE_HIZ_OCCLUSION, memnew(HiZBuffers));
+	}
+	Ref<HiZBuffers> hiz_buffers = p_render_buffers->get_custom_data(RB_SCOPE_HIZ_OCCLUSION);
+
+	Size2i source_size = p_render_buffers->get_internal_size();
+	Size2i dest_size = Size2i(MAX(1, source_size.x / size_divisor), MAX(1, source_size.y / size_divisor));
+
+	if (hiz_buffers->size != dest_size) {
+		hiz_buffers->free_data();
+		hiz_buffers->depth_buffer = RD::get_singleton()->storage_buffer_create(dest_size.x * dest_size.y * sizeof(float));
+		hiz_buffers->size = dest_size;
+	}
+
+	// Same projection the scene was rendered with, see RenderSceneDataRD::update_ubo().
+	Projection correction;
+	correction.set_depth_correction(true);
+	Projection inv_projection = (correction * p_cam_projection).inverse();
+
+	HiZOcclusionPushConstant push_constant;
+	for (int i = 0; i < 4; i++) {
+		push_constant.inv_projection_z[i] = inv_projection.columns[i][2];
+		push_constant.inv_projection_w[i] = inv_projection.columns[i][3];
+	}
+	push_constant.source_size[0] = source_size.x;
+	push_constant.source_size[1] = source_size.y;
+	push_constant.dest_size[0] = dest_size.x;
+	push_constant.dest_size[1] = dest_size.y;
+
+	// setup our uniforms
+	RID default_sampler = material_storage->sampler_rd_get_default(RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED);
+
+	RD::Uniform u_source_depth(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 0, Vector<RID>({ default_sampler, p_render_buffers->get_depth_texture() }));
+	RD::Uniform u_dest_depth(RD::UNIFORM_TYPE_STORAGE_BUFFER, 0, hiz_buffers->depth_buffer);
+
+	RID shader = hiz.shader.version_get_shader(hiz.shader_version, 0);
+	ERR_FAIL_COND(shader.is_null());
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, hiz.pipeline);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 0, u_source_depth), 0);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 1, u_dest_depth), 1);
+
+	RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(HiZOcclusionPushConstant));
+
+	RD::get_singleton()->compute_list_dispatch_threads(compute_list, dest_size.x, dest_size.y, 1);
+
+	RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_TRANSFER);
+
+	hiz_buffers->request_readback(p_cam_transform, p_cam_projection);
+}
+
+const RendererSceneOcclusionCull::HZBuffer *HiZOcclusion::get_occlusion_buffer(Ref<RenderSceneBuffersRD> p_render_buffers, Transform3D &r_cam_transform, Projection &r_cam_projection) const {
+	if (p_render_buffers.is_null() || !p_render_buffers->has_custom_data(RB_SCOPE_HIZ_OCCLUSION)) {
+		return nullptr;
+	}
+
+	Ref<HiZBuffers> hiz_buffers = p_render_buffers->get_custom_data(RB_SCOPE_HIZ_OCCLUSION);
+	return hiz_buffers->get_hz_buffer(r_cam_transform, r_cam_projection);
+}
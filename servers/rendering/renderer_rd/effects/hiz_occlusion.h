@@ -0,0 +1,112 @@
+/*************************************************************************/
+/*  hiz_occlusion.h                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef HIZ_OCCLUSION_RD_H
+#define HIZ_OCCLUSION_RD_H
+
+#include "core/templates/list.h"
+#include "servers/rendering/renderer_rd/shaders/effects/hiz_occlusion.glsl.gen.h"
+#include "servers/rendering/renderer_rd/storage_rd/render_buffer_custom_data_rd.h"
+#include "servers/rendering/renderer_rd/storage_rd/render_scene_buffers_rd.h"
+#include "servers/rendering/renderer_scene_occlusion_cull.h"
+
+#include "servers/rendering_server.h"
+
+#define RB_SCOPE_HIZ_OCCLUSION SNAME("hiz_occlusion")
+
+namespace RendererRD {
+
+// Builds a Hi-Z buffer from the depth of the rendered scene and reads it back
+// asynchronously, so the next frames can be occlusion culled on the CPU without
+// any occluders set up in the scene.
+class HiZOcclusion {
+private:
+	struct HiZOcclusionPushConstant {
+		float inv_projection_z[4];
+		float inv_projection_w[4];
+		int32_t source_size[2];
+		int32_t dest_size[2];
+	};
+
+	struct HiZOcclusionShader {
+		HizOcclusionShaderRD shader;
+		RID shader_version;
+		RID pipeline;
+	} hiz;
+
+	int size_divisor = 8;
+
+public:
+	class HiZBuffers : public RenderBufferCustomDataRD {
+		GDCLASS(HiZBuffers, RenderBufferCustomDataRD)
+
+		class ReadbackHZBuffer : public RendererSceneOcclusionCull::HZBuffer {
+		public:
+			void set_depth(const Size2i &p_size, const float *p_depth);
+		};
+
+		// Camera used for each readback still in flight, in request order.
+		struct PendingReadback {
+			Transform3D cam_transform;
+			Projection cam_projection;
+			Size2i size;
+		};
+
+		List<PendingReadback> pending_readbacks;
+
+		ReadbackHZBuffer hz_buffer;
+		Transform3D hz_cam_transform;
+		Projection hz_cam_projection;
+
+		void _readback_completed(const Vector<uint8_t> &p_data);
+
+	public:
+		RID depth_buffer;
+		Size2i size;
+
+		void request_readback(const Transform3D &p_cam_transform, const Projection &p_cam_projection);
+		const RendererSceneOcclusionCull::HZBuffer *get_hz_buffer(Transform3D &r_cam_transform, Projection &r_cam_projection) const;
+
+		virtual void configure(RenderSceneBuffersRD *p_render_buffers) override{};
+		virtual void free_data() override;
+
+		~HiZBuffers();
+	};
+
+	HiZOcclusion();
+	~HiZOcclusion();
+
+	void update(Ref<RenderSceneBuffersRD> p_render_buffers, const Transform3D &p_cam_transform, const Projection &p_cam_projection);
+	const RendererSceneOcclusionCull::HZBuffer *get_occlusion_buffer(Ref<RenderSceneBuffersRD> p_render_buffers, Transform3D &r_cam_transform, Projection &r_cam_projection) const;
+};
+
+} // namespace RendererRD
+
+#endif // HIZ_OCCLUSION_RD_H
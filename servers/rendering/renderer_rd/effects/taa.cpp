@@ -38,9 +38,12 @@ using namespace RendererRD;
 TAA::TAA() {
 	Vector<String> taa_modes;
 	taa_modes.push_back("\n#define MODE_TAA_RESOLVE");
+	taa_modes.push_back("\n#define MODE_TAA_UPSCALE");
 	taa_shader.initialize(taa_modes);
 	shader_version = taa_shader.version_create();
-	pipeline = RD::get_singleton()->compute_pipeline_create(taa_shader.version_get_shader(shader_version, 0));
+	for (int i = 0; i < TAA_MODE_MAX; i++) {
+		pipelines[i] = RD::get_singleton()->compute_pipeline_create(taa_shader.version_get_shader(shader_version, i));
+	}
 }
 
 TAA::~TAA() {
@@ -61,13 +64,28 @@ void TAA::msaa_resolve(Ref<RenderSceneBuffersRD> p_render_buffers) {
 	}
 }
 
-void TAA::resolve(RID p_frame, RID p_temp, RID p_depth, RID p_velocity, RID p_prev_velocity, RID p_history, Size2 p_resolution, float p_z_near, float p_z_far) {
+bool TAA::uses_upscale(const Ref<RenderSceneBuffersRD> &p_render_buffers) {
+	Size2i internal_size = p_render_buffers->get_internal_size();
+	Size2i target_size = p_render_buffers->get_target_size();
+	return p_render_buffers->get_use_taa() && (internal_size.x < target_size.x || internal_size.y < target_size.y);
+}
+
+RID TAA::get_upscaled_texture(const Ref<RenderSceneBuffersRD> &p_render_buffers) {
+	if (!uses_upscale(p_render_buffers) || !p_render_buffers->has_texture(SNAME("taa"), SNAME("history"))) {
+		return RID();
+	}
+	return p_render_buffers->get_texture(SNAME("taa"), SNAME("history"));
+}
+
+void TAA::resolve(RID p_frame, RID p_temp, RID p_depth, RID p_velocity, RID p_prev_velocity, RID p_history, Size2 p_resolution, Size2 p_output_resolution, const Vector2 &p_jitter, float p_z_near, float p_z_far) {
 	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
 	ERR_FAIL_NULL(uniform_set_cache);
 	MaterialStorage *material_storage = MaterialStorage::get_singleton();
 	ERR_FAIL_NULL(material_storage);
 
-	RID shader = taa_shader.version_get_shader(shader_version, 0);
+	TAAMode mode = p_output_resolution != p_resolution ? TAA_MODE_UPSCALE : TAA_MODE_RESOLVE;
+
+	RID shader = taa_shader.version_get_shader(shader_version, mode);
 	ERR_FAIL_COND(shader.is_null());
 
 	RID default_sampler = material_storage->sampler_rd_get_default(RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED);
@@ -78,9 +96,13 @@ void TAA::resolve(RID p_frame, RID p_temp, RID p_depth, RID p_velocity, RID p_pr
 	push_constant.resolution_height = p_resolution.height;
 	push_constant.disocclusion_threshold = 0.025f;
 	push_constant.disocclusion_scale = 10.0f;
+	push_constant.output_width = p_output_resolution.width;
+	push_constant.output_height = p_output_resolution.height;
+	push_constant.jitter_x = p_jitter.x;
+	push_constant.jitter_y = p_jitter.y;
 
 	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
-	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, pipeline);
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, pipelines[mode]);
 
 	RD::Uniform u_frame_source(RD::UNIFORM_TYPE_IMAGE, 0, { p_frame });
 	RD::Uniform u_depth(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 1, { default_sampler, p_depth });
@@ -91,30 +113,38 @@ void TAA::resolve(RID p_frame, RID p_temp, RID p_depth, RID p_velocity, RID p_pr
 
 	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 0, u_frame_source, u_depth, u_velocity, u_prev_velocity, u_history, u_frame_dest), 0);
 	RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(TAAResolvePushConstant));
-	RD::get_singleton()->compute_list_dispatch_threads(compute_list, p_resolution.width, p_resolution.height, 1);
+	RD::get_singleton()->compute_list_dispatch_threads(compute_list, p_output_resolution.width, p_output_resolution.height, 1);
 	RD::get_singleton()->compute_list_end();
 }
 
-void TAA::process(Ref<RenderSceneBuffersRD> p_render_buffers, RD::DataFormat p_format, float p_z_near, float p_z_far) {
+void TAA::process(Ref<RenderSceneBuffersRD> p_render_buffers, RD::DataFormat p_format, float p_z_near, float p_z_far, const Vector2 &p_jitter) {
 	CopyEffects *copy_effects = CopyEffects::get_singleton();
 
 	uint32_t view_count = p_render_buffers->get_view_count();
 	Size2i internal_size = p_render_buffers->get_internal_size();
 	Size2i target_size = p_render_buffers->get_target_size();
 
+	// When upscaling, history and the resolved output live at the target size and
+	// the tonemapper reads the history directly instead of our internal texture.
+	bool upscale = uses_upscale(p_render_buffers);
+	Size2i history_size = upscale ? target_size : internal_size;
+
 	bool just_allocated = false;
 	if (!p_render_buffers->has_texture(SNAME("taa"), SNAME("history"))) {
 		uint32_t usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_STORAGE_BIT;
+		if (upscale) {
+			usage_bits |= RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
+		}
 
-		p_render_buffers->create_texture(SNAME("taa"), SNAME("history"), p_format, usage_bits);
-		p_render_buffers->create_texture(SNAME("taa"), SNAME("temp"), p_format, usage_bits);
+		p_render_buffers->create_texture(SNAME("taa"), SNAME("history"), p_format, usage_bits, RD::TEXTURE_SAMPLES_1, history_size);
+		p_render_buffers->create_texture(SNAME("taa"), SNAME("temp"), p_format, usage_bits, RD::TEXTURE_SAMPLES_1, history_size, 0, 1, false);
 
 		p_render_buffers->create_texture(SNAME("taa"), SNAME("prev_velocity"), RD::DATA_FORMAT_R16G16_SFLOAT, usage_bits);
 
 		just_allocated = true;
 	}
 
-	RD::get_singleton()->draw_command_begin_label("TAA");
+	RD::get_singleton()->draw_command_begin_label(upscale ? "TAA Upscale" : "TAA");
 
 	for (uint32_t v = 0; v < view_count; v++) {
 		// Get our (cached) slices
@@ -122,15 +152,24 @@ void TAA::process(Ref<RenderSceneBuffersRD> p_render_buffers, RD::DataFormat p_f
 		RID velocity_buffer = p_render_buffers->get_velocity_buffer(false, v);
 		RID taa_history = p_render_buffers->get_texture_slice(SNAME("taa"), SNAME("history"), v, 0);
 		RID taa_prev_velocity = p_render_buffers->get_texture_slice(SNAME("taa"), SNAME("prev_velocity"), v, 0);
-
-		if (!just_allocated) {
-			RID depth_texture = p_render_buffers->get_depth_texture(v);
-			RID taa_temp = p_render_buffers->get_texture_slice(SNAME("taa"), SNAME("temp"), v, 0);
-			resolve(internal_texture, taa_temp, depth_texture, velocity_buffer, taa_prev_velocity, taa_history, Size2(internal_size.x, internal_size.y), p_z_near, p_z_far);
-			copy_effects->copy_to_rect(taa_temp, internal_texture, Rect2(0, 0, internal_size.x, internal_size.y));
+		RID depth_texture = p_render_buffers->get_depth_texture(v);
+		RID taa_temp = p_render_buffers->get_texture_slice(SNAME("taa"), SNAME("temp"), v, 0);
+
+		if (upscale) {
+			if (just_allocated) {
+				// Nothing accumulated yet, the neighborhood clip pulls the history in over the next frames.
+				RD::get_singleton()->texture_clear(taa_history, Color(0, 0, 0, 0), 0, 1, 0, 1);
+			}
+			resolve(internal_texture, taa_temp, depth_texture, velocity_buffer, taa_prev_velocity, taa_history, Size2(internal_size.x, internal_size.y), Size2(target_size.x, target_size.y), p_jitter, p_z_near, p_z_far);
+			copy_effects->copy_to_rect(taa_temp, taa_history, Rect2(0, 0, target_size.x, target_size.y));
+		} else {
+			if (!just_allocated) {
+				resolve(internal_texture, taa_temp, depth_texture, velocity_buffer, taa_prev_velocity, taa_history, Size2(internal_size.x, internal_size.y), Size2(internal_size.x, internal_size.y), p_jitter, p_z_near, p_z_far);
+				copy_effects->copy_to_rect(taa_temp, internal_texture, Rect2(0, 0, internal_size.x, internal_size.y));
+			}
+
+			copy_effects->copy_to_rect(internal_texture, taa_history, Rect2(0, 0, internal_size.x, internal_size.y));
 		}
-
-		copy_effects->copy_to_rect(internal_texture, taa_history, Rect2(0, 0, internal_size.x, internal_size.y));
 		copy_effects->copy_to_rect(velocity_buffer, taa_prev_velocity, Rect2(0, 0, target_size.x, target_size.y));
 	}
 
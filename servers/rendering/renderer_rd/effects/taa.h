@@ -46,7 +46,12 @@ public:
 	~TAA();
 
 	void msaa_resolve(Ref<RenderSceneBuffersRD> p_render_buffers);
-	void process(Ref<RenderSceneBuffersRD> p_render_buffers, RD::DataFormat p_format, float p_z_near, float p_z_far);
+	void process(Ref<RenderSceneBuffersRD> p_render_buffers, RD::DataFormat p_format, float p_z_near, float p_z_far, const Vector2 &p_jitter = Vector2());
+
+	// When TAA is enabled with a reduced 3D resolution scale, the resolve reconstructs
+	// directly at the target size and its history doubles as the upscaled output.
+	static bool uses_upscale(const Ref<RenderSceneBuffersRD> &p_render_buffers);
+	static RID get_upscaled_texture(const Ref<RenderSceneBuffersRD> &p_render_buffers);
 
 private:
 	struct TAAResolvePushConstant {
@@ -54,13 +59,23 @@ private:
 		float resolution_height;
 		float disocclusion_threshold;
 		float disocclusion_scale;
+		float output_width;
+		float output_height;
+		float jitter_x;
+		float jitter_y;
+	};
+
+	enum TAAMode {
+		TAA_MODE_RESOLVE,
+		TAA_MODE_UPSCALE,
+		TAA_MODE_MAX
 	};
 
 	TaaResolveShaderRD taa_shader;
 	RID shader_version;
-	RID pipeline;
+	RID pipelines[TAA_MODE_MAX];
 
-	void resolve(RID p_frame, RID p_temp, RID p_depth, RID p_velocity, RID p_prev_velocity, RID p_history, Size2 p_resolution, float p_z_near, float p_z_far);
+	void resolve(RID p_frame, RID p_temp, RID p_depth, RID p_velocity, RID p_prev_velocity, RID p_history, Size2 p_resolution, Size2 p_output_resolution, const Vector2 &p_jitter, float p_z_near, float p_z_far);
 };
 
 } // namespace RendererRD
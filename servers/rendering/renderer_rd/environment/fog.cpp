@@ -1128,6 +1128,7 @@ void Fog::volumetric_fog_update(const VolumetricFogSettings &p_settings, const P
 
 	params.use_temporal_reprojection = RendererSceneRenderRD::get_singleton()->environment_get_volumetric_fog_temporal_reprojection(p_settings.env);
 	params.temporal_blend = RendererSceneRenderRD::get_singleton()->environment_get_volumetric_fog_temporal_reprojection_amount(p_settings.env);
+	params.use_interleaved_updates = p_settings.volumetric_fog_interleaved_updates;
 
 	{
 		uint32_t cluster_size = p_settings.cluster_builder->get_cluster_size();
@@ -172,6 +172,9 @@ private:
 			float cam_rotation[12];
 			float to_prev_view[16];
 			float radiance_inverse_xform[12];
+
+			uint32_t use_interleaved_updates;
+			uint32_t pad[3];
 		};
 
 		VolumetricFogProcessShaderRD process_shader;
@@ -335,6 +338,7 @@ public:
 		bool is_using_radiance_cubemap_array;
 		uint32_t max_cluster_elements;
 		bool volumetric_fog_filter_active;
+		bool volumetric_fog_interleaved_updates;
 		RID shadow_sampler;
 		RID voxel_gi_buffer;
 		RID shadow_atlas_depth;
@@ -1198,9 +1198,12 @@ void GI::SDFGI::update(RID p_env, const Vector3 &p_world_position) {
 
 	int32_t drag_margin = (cascade_size / SDFGI::PROBE_DIVISOR) / 2;
 
+	Vector3i previous_positions[SDFGI::MAX_CASCADES];
+
 	for (uint32_t i = 0; i < cascades.size(); i++) {
 		SDFGI::Cascade &cascade = cascades[i];
 		cascade.dirty_regions = Vector3i();
+		previous_positions[i] = cascade.position;
 
 		Vector3 probe_half_size = Vector3(1, 1, 1) * cascade.cell_size * float(cascade_size / SDFGI::PROBE_DIVISOR) * 0.5;
 		probe_half_size = Vector3(0, 0, 0);
@@ -1245,6 +1248,46 @@ void GI::SDFGI::update(RID p_env, const Vector3 &p_world_position) {
 			}
 		}
 	}
+
+	uint32_t max_updates = gi->sdfgi_max_cascade_updates_per_frame;
+	if (max_updates == 0) {
+		return;
+	}
+
+	// Every scrolled cascade re-voxelizes the cells it moved over, so scrolling many of them in the same frame
+	// causes spikes on fast camera motion. Only the allowed number of cascades scrolls per frame, nearest first.
+	// The others keep their previous position for now, and gain priority for every frame they wait.
+	uint32_t dirty[SDFGI::MAX_CASCADES];
+	int32_t priority[SDFGI::MAX_CASCADES];
+	uint32_t dirty_count = 0;
+
+	for (uint32_t i = 0; i < cascades.size(); i++) {
+		if (cascades[i].dirty_regions == Vector3i()) {
+			continue;
+		}
+		// Insertion sort, keeping nearer cascades first on equal priority.
+		int32_t p = int32_t(i) - int32_t(cascades[i].update_deferred_frames);
+		uint32_t j = dirty_count;
+		while (j > 0 && priority[j - 1] > p) {
+			dirty[j] = dirty[j - 1];
+			priority[j] = priority[j - 1];
+			j--;
+		}
+		dirty[j] = i;
+		priority[j] = p;
+		dirty_count++;
+	}
+
+	for (uint32_t i = 0; i < dirty_count; i++) {
+		SDFGI::Cascade &cascade = cascades[dirty[i]];
+		if (i < max_updates) {
+			cascade.update_deferred_frames = 0;
+		} else {
+			cascade.position = previous_positions[dirty[i]];
+			cascade.dirty_regions = Vector3i();
+			cascade.update_deferred_frames++;
+		}
+	}
 }
 
 void GI::SDFGI::update_light() {
@@ -3348,6 +3391,7 @@ GI::GI() {
 	sdfgi_ray_count = RS::EnvironmentSDFGIRayCount(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/probe_ray_count")), 0, int32_t(RS::ENV_SDFGI_RAY_COUNT_MAX - 1)));
 	sdfgi_frames_to_converge = RS::EnvironmentSDFGIFramesToConverge(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_converge")), 0, int32_t(RS::ENV_SDFGI_CONVERGE_MAX - 1)));
 	sdfgi_frames_to_update_light = RS::EnvironmentSDFGIFramesToUpdateLight(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_update_lights")), 0, int32_t(RS::ENV_SDFGI_UPDATE_LIGHT_MAX - 1)));
+	sdfgi_max_cascade_updates_per_frame = MAX(0, int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/max_cascade_updates_per_frame")));
 }
 
 GI::~GI() {
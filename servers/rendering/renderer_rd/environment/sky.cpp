@@ -526,8 +526,14 @@ void SkyRD::ReflectionData::create_reflection_importance_sample(bool p_use_array
 	ERR_FAIL_NULL_MSG(copy_effects, "Effects haven't been initialized");
 	bool prefer_raster_effects = copy_effects->get_prefer_raster_effects();
 
+	// Side 10 filters all faces at once, otherwise only the given face is filtered.
+	// The downsampled source only needs refreshing once, when starting on the first layer.
+	int side_from = p_cube_side < 6 ? p_cube_side : 0;
+	int side_to = p_cube_side < 6 ? p_cube_side + 1 : 6;
+	bool downsample = p_base_layer == 1 && side_from == 0;
+
 	if (prefer_raster_effects) {
-		if (p_base_layer == 1) {
+		if (downsample) {
 			RD::get_singleton()->draw_command_begin_label("Downsample radiance map");
 			for (int k = 0; k < 6; k++) {
 				copy_effects->cubemap_downsample_raster(radiance_base_cubemap, downsampled_layer.mipmaps[0].framebuffers[k], k, downsampled_layer.mipmaps[0].size);
@@ -543,7 +549,7 @@ void SkyRD::ReflectionData::create_reflection_importance_sample(bool p_use_array
 
 		RD::get_singleton()->draw_command_begin_label("High Quality filter radiance");
 		if (p_use_arrays) {
-			for (int k = 0; k < 6; k++) {
+			for (int k = side_from; k < side_to; k++) {
 				copy_effects->cubemap_roughness_raster(
 						downsampled_radiance_cubemap,
 						layers[p_base_layer].mipmaps[0].framebuffers[k],
@@ -553,7 +559,7 @@ void SkyRD::ReflectionData::create_reflection_importance_sample(bool p_use_array
 						layers[p_base_layer].mipmaps[0].size.x);
 			}
 		} else {
-			for (int k = 0; k < 6; k++) {
+			for (int k = side_from; k < side_to; k++) {
 				copy_effects->cubemap_roughness_raster(
 						downsampled_radiance_cubemap,
 						layers[0].mipmaps[p_base_layer].framebuffers[k],
@@ -564,7 +570,7 @@ void SkyRD::ReflectionData::create_reflection_importance_sample(bool p_use_array
 			}
 		}
 	} else {
-		if (p_base_layer == 1) {
+		if (downsample) {
 			RD::get_singleton()->draw_command_begin_label("Downsample radiance map");
 			copy_effects->cubemap_downsample(radiance_base_cubemap, downsampled_layer.mipmaps[0].view, downsampled_layer.mipmaps[0].size);
 
@@ -1483,19 +1489,29 @@ void SkyRD::update(RID p_env, const Projection &p_projection, const Transform3D
 				}
 			}
 			sky->processing_layer = 1;
+			sky->processing_side = 0;
 		}
 		sky->baked_exposure = p_luminance_multiplier;
 		sky->reflection.dirty = false;
 
 	} else {
 		if (sky_mode == RS::SKY_MODE_INCREMENTAL && sky->processing_layer < max_processing_layer) {
-			sky->reflection.create_reflection_importance_sample(sky_use_cubemap_array, 10, sky->processing_layer, sky_ggx_samples_quality);
+			// Large layers are filtered one face per frame, so the GGX convolution cost is spread evenly
+			// instead of spiking on the first layers. Small layers are cheap enough to do in one go.
+			int layer_size = sky_use_cubemap_array ? sky->reflection.layers[sky->processing_layer].mipmaps[0].size.x : sky->reflection.layers[0].mipmaps[sky->processing_layer].size.x;
+			bool split_faces = layer_size > 32;
 
-			if (sky_use_cubemap_array) {
-				sky->reflection.update_reflection_mipmaps(sky->processing_layer, sky->processing_layer + 1);
-			}
+			sky->reflection.create_reflection_importance_sample(sky_use_cubemap_array, split_faces ? sky->processing_side : 10, sky->processing_layer, sky_ggx_samples_quality);
 
-			sky->processing_layer++;
+			sky->processing_side = split_faces ? sky->processing_side + 1 : 6;
+			if (sky->processing_side == 6) {
+				if (sky_use_cubemap_array) {
+					sky->reflection.update_reflection_mipmaps(sky->processing_layer, sky->processing_layer + 1);
+				}
+
+				sky->processing_side = 0;
+				sky->processing_layer++;
+			}
 		}
 	}
 }
@@ -1870,6 +1886,7 @@ void SkyRD::update_dirty_skys() {
 
 		sky->reflection.dirty = true;
 		sky->processing_layer = 0;
+		sky->processing_side = 0;
 
 		Sky *next = sky->dirty_list;
 		sky->dirty_list = nullptr;
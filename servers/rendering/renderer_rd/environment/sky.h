@@ -266,6 +266,7 @@ public:
 		ReflectionData reflection;
 		bool dirty = false;
 		int processing_layer = 0;
+		int processing_side = 0; // Next cubemap face to filter when a layer is split across frames.
 		Sky *dirty_list = nullptr;
 		float baked_exposure = 1.0;
 
@@ -54,11 +54,11 @@ void RenderForwardClustered::RenderBufferDataForwardClustered::ensure_specular()
 			usage_bits |= RD::TEXTURE_USAGE_COLOR_ATTACHMENT_BIT;
 		}
 
-		render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_SPECULAR, format, usage_bits);
+		render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_SPECULAR, format, usage_bits, RD::TEXTURE_SAMPLES_1, Size2i(), 0, 1, false);
 
 		if (render_buffers->get_msaa_3d() != RS::VIEWPORT_MSAA_DISABLED) {
 			usage_bits = RD::TEXTURE_USAGE_COLOR_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT;
-			render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_SPECULAR_MSAA, format, usage_bits, texture_samples);
+			render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_SPECULAR_MSAA, format, usage_bits, texture_samples, Size2i(), 0, 1, false);
 		}
 	}
 }
@@ -80,7 +80,7 @@ void RenderForwardClustered::RenderBufferDataForwardClustered::ensure_normal_rou
 
 		if (render_buffers->get_msaa_3d() != RS::VIEWPORT_MSAA_DISABLED) {
 			usage_bits = RD::TEXTURE_USAGE_COLOR_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT | RD::TEXTURE_USAGE_SAMPLING_BIT;
-			render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_ROUGHNESS_MSAA, format, usage_bits, texture_samples);
+			render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_ROUGHNESS_MSAA, format, usage_bits, texture_samples, Size2i(), 0, 1, false);
 		}
 	}
 }
@@ -95,11 +95,11 @@ void RenderForwardClustered::RenderBufferDataForwardClustered::ensure_voxelgi()
 			usage_bits |= RD::TEXTURE_USAGE_COLOR_ATTACHMENT_BIT;
 		}
 
-		render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_VOXEL_GI, format, usage_bits);
+		render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_VOXEL_GI, format, usage_bits, RD::TEXTURE_SAMPLES_1, Size2i(), 0, 1, false);
 
 		if (render_buffers->get_msaa_3d() != RS::VIEWPORT_MSAA_DISABLED) {
 			usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_COLOR_ATTACHMENT_BIT;
-			render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_VOXEL_GI_MSAA, format, usage_bits, texture_samples);
+			render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_VOXEL_GI_MSAA, format, usage_bits, texture_samples, Size2i(), 0, 1, false);
 		}
 	}
 }
@@ -159,12 +159,12 @@ void RenderForwardClustered::RenderBufferDataForwardClustered::configure(RenderS
 
 		texture_samples = ts[msaa_3d];
 
-		p_render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_COLOR_MSAA, format, usage_bits, texture_samples);
+		p_render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_COLOR_MSAA, format, usage_bits, texture_samples, Size2i(), 0, 1, false);
 
 		format = RD::get_singleton()->texture_is_format_supported_for_usage(RD::DATA_FORMAT_D24_UNORM_S8_UINT, RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_SAMPLING_BIT) ? RD::DATA_FORMAT_D24_UNORM_S8_UINT : RD::DATA_FORMAT_D32_SFLOAT_S8_UINT;
 		usage_bits = RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT | RD::TEXTURE_USAGE_SAMPLING_BIT;
 
-		p_render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_DEPTH_MSAA, format, usage_bits, texture_samples);
+		p_render_buffers->create_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_DEPTH_MSAA, format, usage_bits, texture_samples, Size2i(), 0, 1, false);
 	}
 
 	if (cluster_builder == nullptr) {
@@ -282,16 +282,19 @@ bool RenderForwardClustered::free(RID p_rid) {
 
 /// RENDERING ///
 
-template <RenderForwardClustered::PassMode p_pass_mode, uint32_t p_color_pass_flags>
+template <RenderForwardClustered::PassMode p_pass_mode, uint32_t p_color_pass_flags, bool p_prepare_only>
 void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p_draw_list, RenderingDevice::FramebufferFormatID p_framebuffer_Format, RenderListParameters *p_params, uint32_t p_from_element, uint32_t p_to_element) {
 	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
+	RendererRD::ParticlesStorage *particles_storage = RendererRD::ParticlesStorage::get_singleton();
 	RD::DrawListID draw_list = p_draw_list;
 	RD::FramebufferFormatID framebuffer_format = p_framebuffer_Format;
 
-	//global scope bindings
-	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, render_base_uniform_set, SCENE_UNIFORM_SET);
-	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, p_params->render_pass_uniform_set, RENDER_PASS_UNIFORM_SET);
-	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, scene_shader.default_vec4_xform_uniform_set, TRANSFORMS_UNIFORM_SET);
+	if constexpr (!p_prepare_only) {
+		//global scope bindings
+		RD::get_singleton()->draw_list_bind_uniform_set(draw_list, render_base_uniform_set, SCENE_UNIFORM_SET);
+		RD::get_singleton()->draw_list_bind_uniform_set(draw_list, p_params->render_pass_uniform_set, RENDER_PASS_UNIFORM_SET);
+		RD::get_singleton()->draw_list_bind_uniform_set(draw_list, scene_shader.default_vec4_xform_uniform_set, TRANSFORMS_UNIFORM_SET);
+	}
 
 	RID prev_material_uniform_set;
 
@@ -468,7 +471,32 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 			mesh_storage->mesh_surface_get_vertex_arrays_and_format(mesh_surface, pipeline->get_vertex_input_mask(), vertex_array_rd, vertex_format);
 		}
 
-		index_array_rd = mesh_storage->mesh_surface_get_index_array(mesh_surface, element_info.lod_index);
+		if constexpr (p_prepare_only) {
+			// Only make sure the vertex array version and the pipeline exist, creating them
+			// takes the RenderingDevice lock, which is held while split draw lists are recorded.
+			pipeline->get_render_pipeline(vertex_format, framebuffer_format, p_params->force_wireframe, 0, pipeline_specialization);
+			i += element_info.repeat - 1; //skip equal elements
+			continue;
+		}
+
+		bool use_clusters = p_params->use_cluster_culling && surf->cluster_pass == cluster_pass;
+		if (!use_clusters) {
+			index_array_rd = mesh_storage->mesh_surface_get_index_array(mesh_surface, element_info.lod_index);
+		}
+
+		// Multimeshes culled on the GPU draw the compacted visible instances, with the count the GPU wrote.
+		// Their draw commands are built for their own mesh, so shadow meshes draw all instances.
+		RID multimesh_cull_command;
+		uint32_t multimesh_cull_command_offset = 0;
+		if (p_params->use_cluster_culling && surf->owner->multimesh_cull_pass == cluster_pass && (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_MULTIMESH_CULLING) && mesh_surface == surf->surface) {
+			multimesh_cull_command = mesh_storage->multimesh_get_cull_draw_command(surf->owner->data->base, surf->surface_index, element_info.lod_index, multimesh_cull_command_offset);
+			RID culled_xforms_uniform_set = multimesh_cull_command.is_valid() ? mesh_storage->multimesh_get_cull_3d_uniform_set(surf->owner->data->base, scene_shader.default_shader_rd, TRANSFORMS_UNIFORM_SET) : RID();
+			if (culled_xforms_uniform_set.is_valid()) {
+				xforms_uniform_set = culled_xforms_uniform_set;
+			} else {
+				multimesh_cull_command = RID();
+			}
+		}
 
 		if (prev_vertex_array_rd != vertex_array_rd) {
 			RD::get_singleton()->draw_list_bind_vertex_array(draw_list, vertex_array_rd);
@@ -519,23 +547,47 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 			instance_count /= surf->owner->trail_steps;
 		}
 
-		RD::get_singleton()->draw_list_draw(draw_list, index_array_rd.is_valid(), instance_count);
+		// Sorted particles only draw their active particles, the GPU writes how many there are.
+		// The draw command is built for the base LOD of the surface, so other meshes and LODs use the full amount.
+		RID draw_command_buffer;
+		uint32_t draw_command_offset = 0;
+		if (multimesh_cull_command.is_valid()) {
+			draw_command_buffer = multimesh_cull_command;
+			draw_command_offset = multimesh_cull_command_offset;
+		} else if (surf->particles_draw_command >= 0 && mesh_surface == surf->surface && element_info.lod_index == 0 && !(surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_PARTICLE_TRAILS)) {
+			draw_command_buffer = particles_storage->particles_get_draw_command(surf->owner->data->base, surf->particles_draw_command, draw_command_offset);
+		}
+
+		if (use_clusters) {
+			// Only the clusters that passed culling in _fill_render_list are drawn.
+			for (uint32_t j = 0; j < surf->cluster_draw_count; j++) {
+				index_array_rd = cluster_draws[surf->cluster_draw_offset + j];
+				RD::get_singleton()->draw_list_bind_index_array(draw_list, index_array_rd);
+				RD::get_singleton()->draw_list_draw(draw_list, true, instance_count);
+			}
+			prev_index_array_rd = index_array_rd;
+		} else if (draw_command_buffer.is_valid()) {
+			RD::get_singleton()->draw_list_draw_indirect(draw_list, index_array_rd.is_valid(), draw_command_buffer, draw_command_offset);
+		} else {
+			RD::get_singleton()->draw_list_draw(draw_list, index_array_rd.is_valid(), instance_count);
+		}
 		i += element_info.repeat - 1; //skip equal elements
 	}
 
 	// Make the actual redraw request
-	if (should_request_redraw) {
+	if (!p_prepare_only && should_request_redraw) {
 		RenderingServerDefault::redraw_request();
 	}
 }
 
+template <bool p_prepare_only>
 void RenderForwardClustered::_render_list(RenderingDevice::DrawListID p_draw_list, RenderingDevice::FramebufferFormatID p_framebuffer_Format, RenderListParameters *p_params, uint32_t p_from_element, uint32_t p_to_element) {
 	//use template for faster performance (pass mode comparisons are inlined)
 
 	switch (p_params->pass_mode) {
 #define VALID_FLAG_COMBINATION(f)                                                                                             \
 	case f: {                                                                                                                 \
-		_render_list_template<PASS_MODE_COLOR, f>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element); \
+		_render_list_template<PASS_MODE_COLOR, f, p_prepare_only>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element); \
 	} break;
 
 		case PASS_MODE_COLOR: {
@@ -557,34 +609,53 @@ void RenderForwardClustered::_render_list(RenderingDevice::DrawListID p_draw_lis
 
 		} break;
 		case PASS_MODE_SHADOW: {
-			_render_list_template<PASS_MODE_SHADOW>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
+			_render_list_template<PASS_MODE_SHADOW, 0, p_prepare_only>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
 		} break;
 		case PASS_MODE_SHADOW_DP: {
-			_render_list_template<PASS_MODE_SHADOW_DP>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
+			_render_list_template<PASS_MODE_SHADOW_DP, 0, p_prepare_only>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
 		} break;
 		case PASS_MODE_DEPTH: {
-			_render_list_template<PASS_MODE_DEPTH>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
+			_render_list_template<PASS_MODE_DEPTH, 0, p_prepare_only>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
 		} break;
 		case PASS_MODE_DEPTH_NORMAL_ROUGHNESS: {
-			_render_list_template<PASS_MODE_DEPTH_NORMAL_ROUGHNESS>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
+			_render_list_template<PASS_MODE_DEPTH_NORMAL_ROUGHNESS, 0, p_prepare_only>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
 		} break;
 		case PASS_MODE_DEPTH_NORMAL_ROUGHNESS_VOXEL_GI: {
-			_render_list_template<PASS_MODE_DEPTH_NORMAL_ROUGHNESS_VOXEL_GI>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
+			_render_list_template<PASS_MODE_DEPTH_NORMAL_ROUGHNESS_VOXEL_GI, 0, p_prepare_only>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
 		} break;
 		case PASS_MODE_DEPTH_MATERIAL: {
-			_render_list_template<PASS_MODE_DEPTH_MATERIAL>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
+			_render_list_template<PASS_MODE_DEPTH_MATERIAL, 0, p_prepare_only>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
 		} break;
 		case PASS_MODE_SDF: {
-			_render_list_template<PASS_MODE_SDF>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
+			_render_list_template<PASS_MODE_SDF, 0, p_prepare_only>(p_draw_list, p_framebuffer_Format, p_params, p_from_element, p_to_element);
 		} break;
 	}
 }
 
-void RenderForwardClustered::_render_list_thread_function(uint32_t p_thread, RenderListParameters *p_params) {
+uint32_t RenderForwardClustered::_render_list_thread_split(uint32_t p_thread, uint32_t p_total_threads, const RenderListParameters *p_params) {
 	uint32_t render_total = p_params->element_count;
-	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
-	uint32_t render_from = p_thread * render_total / total_threads;
-	uint32_t render_to = (p_thread + 1 == total_threads) ? render_total : ((p_thread + 1) * render_total / total_threads);
+	if (p_thread >= p_total_threads) {
+		return render_total;
+	}
+	uint32_t split = p_thread * render_total / p_total_threads;
+	// Never split inside a run of repeated elements, the first element of the run draws all the instances.
+	while (split > 0 && split < render_total && p_params->element_info[split - 1].repeat > 1) {
+		split++;
+	}
+	return split;
+}
+
+void RenderForwardClustered::_render_list_prepare_thread_function(uint32_t p_thread, RenderListParameters *p_params) {
+	uint32_t total_threads = thread_draw_lists.size();
+	uint32_t render_from = _render_list_thread_split(p_thread, total_threads, p_params);
+	uint32_t render_to = _render_list_thread_split(p_thread + 1, total_threads, p_params);
+	_render_list<true>(RD::INVALID_ID, p_params->framebuffer_format, p_params, render_from, render_to);
+}
+
+void RenderForwardClustered::_render_list_thread_function(uint32_t p_thread, RenderListParameters *p_params) {
+	uint32_t total_threads = thread_draw_lists.size();
+	uint32_t render_from = _render_list_thread_split(p_thread, total_threads, p_params);
+	uint32_t render_to = _render_list_thread_split(p_thread + 1, total_threads, p_params);
 	_render_list(thread_draw_lists[p_thread], p_params->framebuffer_format, p_params, render_from, render_to);
 }
 
@@ -592,9 +663,15 @@ void RenderForwardClustered::_render_list_with_threads(RenderListParameters *p_p
 	RD::FramebufferFormatID fb_format = RD::get_singleton()->framebuffer_get_format(p_framebuffer);
 	p_params->framebuffer_format = fb_format;
 
-	if ((uint32_t)p_params->element_count > render_list_thread_threshold && false) { // secondary command buffers need more testing at this time
+	if (render_list_threaded && (uint32_t)p_params->element_count > render_list_thread_threshold) {
 		//multi threaded
 		thread_draw_lists.resize(WorkerThreadPool::get_singleton()->get_thread_count());
+
+		// Resolve pipelines and vertex array versions first, as creating any of them while the
+		// split draw lists are open would block on the RenderingDevice lock.
+		WorkerThreadPool::GroupID prepare_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RenderForwardClustered::_render_list_prepare_thread_function, p_params, thread_draw_lists.size(), -1, true, SNAME("ForwardClusteredRenderListPrepare"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(prepare_task);
+
 		RD::get_singleton()->draw_list_begin_split(p_framebuffer, thread_draw_lists.size(), thread_draw_lists.ptr(), p_initial_color_action, p_final_color_action, p_initial_depth_action, p_final_depth_action, p_clear_color_values, p_clear_depth, p_clear_stencil, p_region, p_storage_textures);
 		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RenderForwardClustered::_render_list_thread_function, p_params, thread_draw_lists.size(), -1, true, SNAME("ForwardClusteredRenderList"));
 		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
@@ -703,7 +780,7 @@ void RenderForwardClustered::_update_instance_data_buffer(RenderListType p_rende
 		RD::get_singleton()->buffer_update(scene_state.instance_buffer[p_render_list], 0, sizeof(SceneState::InstanceData) * scene_state.instance_data[p_render_list].size(), scene_state.instance_data[p_render_list].ptr(), RD::BARRIER_MASK_RASTER);
 	}
 }
-void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, int *p_render_info, uint32_t p_offset, int32_t p_max_elements, bool p_update_buffer) {
+void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, int *p_render_info, uint32_t p_offset, int32_t p_max_elements, bool p_update_buffer, bool p_use_shadow_sort_keys) {
 	RenderList *rl = &render_list[p_render_list];
 	uint32_t element_total = p_max_elements >= 0 ? uint32_t(p_max_elements) : rl->elements.size();
 
@@ -716,6 +793,8 @@ void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, i
 	uint64_t frame = RSG::rasterizer->get_frame_number();
 	uint32_t repeats = 0;
 	GeometryInstanceSurfaceDataCache *prev_surface = nullptr;
+	uint64_t prev_key1 = 0;
+	uint64_t prev_key2 = 0;
 	for (uint32_t i = 0; i < element_total; i++) {
 		GeometryInstanceSurfaceDataCache *surface = rl->elements[i + p_offset];
 		GeometryInstanceForwardClustered *inst = surface->owner;
@@ -752,9 +831,17 @@ void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, i
 		RendererRD::MaterialStorage::split_double(inst->transform.origin.z, &instance_data.transform[14], &instance_data.transform[11]);
 #endif
 
-		bool cant_repeat = instance_data.flags & INSTANCE_DATA_FLAG_MULTIMESH || inst->mesh_instance.is_valid();
+		bool cant_repeat = instance_data.flags & INSTANCE_DATA_FLAG_MULTIMESH || inst->mesh_instance.is_valid() || (p_render_list != RENDER_LIST_SECONDARY && surface->cluster_pass == cluster_pass);
 
-		if (prev_surface != nullptr && !cant_repeat && prev_surface->sort.sort_key1 == surface->sort.sort_key1 && prev_surface->sort.sort_key2 == surface->sort.sort_key2 && inst->mirror == prev_surface->owner->mirror && repeats < RenderElementInfo::MAX_REPEATS) {
+		uint64_t key1, key2;
+		if (p_use_shadow_sort_keys) {
+			surface->get_shadow_sort_keys(key1, key2);
+		} else {
+			key1 = surface->sort.sort_key1;
+			key2 = surface->sort.sort_key2;
+		}
+
+		if (prev_surface != nullptr && !cant_repeat && prev_key1 == key1 && prev_key2 == key2 && inst->mirror == prev_surface->owner->mirror && repeats < RenderElementInfo::MAX_REPEATS) {
 			//this element is the same as the previous one, count repeats to draw it using instancing
 			repeats++;
 		} else {
@@ -781,6 +868,8 @@ void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, i
 			prev_surface = nullptr;
 		} else {
 			prev_surface = surface;
+			prev_key1 = key1;
+			prev_key2 = key2;
 		}
 	}
 
@@ -800,6 +889,51 @@ _FORCE_INLINE_ static uint32_t _indices_to_primitives(RS::PrimitiveType p_primit
 	static const uint32_t subtractor[RS::PRIMITIVE_MAX] = { 0, 0, 1, 0, 1 };
 	return (p_indices - subtractor[p_primitive]) / divisor[p_primitive];
 }
+void RenderForwardClustered::_cull_surface_clusters(GeometryInstanceSurfaceDataCache *p_surface, const RenderDataRD *p_render_data) {
+	GeometryInstanceForwardClustered *inst = p_surface->owner;
+
+	// Cull in mesh space, so cluster bounds don't need to be transformed.
+	Transform3D inverse = inst->transform.affine_inverse();
+	Basis basis_transpose = inst->transform.basis.transposed();
+
+	Plane local_planes[6];
+	int plane_count = MIN(cluster_frustum_planes.size(), 6);
+	for (int i = 0; i < plane_count; i++) {
+		local_planes[i] = Transform3D::xform_inv_fast(cluster_frustum_planes[i], inverse, basis_transpose);
+	}
+	Vector3 local_camera = inverse.xform(p_render_data->scene_data->cam_transform.origin);
+
+	// Mirrored instances flip the winding, and orthogonal cameras have no single eye position.
+	bool cull_backfaces = (p_surface->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_CLUSTER_BACKFACE_CULLING) && !inst->mirror && !p_render_data->scene_data->cam_orthogonal;
+
+	const RendererRD::MeshStorage::ClusterOcclusion *occlusion = nullptr;
+	if (cluster_occlusion.buffer && !(inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH)) {
+		cluster_occlusion.transform = inst->transform;
+		occlusion = &cluster_occlusion;
+	}
+
+	p_surface->cluster_draw_offset = cluster_draws.size();
+	RendererRD::MeshStorage::get_singleton()->mesh_surface_cull_clusters(p_surface->surface, local_planes, plane_count, local_camera, cull_backfaces, occlusion, cluster_draws);
+	p_surface->cluster_draw_count = cluster_draws.size() - p_surface->cluster_draw_offset;
+	p_surface->cluster_pass = cluster_pass;
+}
+
+void RenderForwardClustered::_cull_multimesh_instances(GeometryInstanceForwardClustered *p_instance) {
+	// Instance transforms are in multimesh space, so cull against the frustum in that space.
+	Transform3D inverse = p_instance->transform.affine_inverse();
+	Basis basis_transpose = p_instance->transform.basis.transposed();
+
+	Plane local_planes[6];
+	int plane_count = MIN(cluster_frustum_planes.size(), 6);
+	for (int i = 0; i < plane_count; i++) {
+		local_planes[i] = Transform3D::xform_inv_fast(cluster_frustum_planes[i], inverse, basis_transpose);
+	}
+
+	if (RendererRD::MeshStorage::get_singleton()->multimesh_cull(p_instance->data->base, local_planes, plane_count)) {
+		p_instance->multimesh_cull_pass = cluster_pass;
+	}
+}
+
 void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, const RenderDataRD *p_render_data, PassMode p_pass_mode, uint32_t p_color_pass_flags = 0, bool p_using_sdfgi, bool p_using_opaque_gi, bool p_append) {
 	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
 
@@ -825,6 +959,25 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 		}
 	}
 
+	// Clusters are culled against a single view, so they are not used for multiview rendering.
+	bool cull_clusters = p_render_list == RENDER_LIST_OPAQUE && p_pass_mode == PASS_MODE_COLOR && !p_append && p_render_data->scene_data->view_count == 1;
+	if (cull_clusters) {
+		cluster_pass++;
+		cluster_draws.clear();
+		cluster_frustum_planes = p_render_data->scene_data->cam_projection.get_projection_planes(p_render_data->scene_data->cam_transform);
+
+		// The depth based occlusion buffer is lagging a few frames, but it is the same one instances are culled against.
+		cluster_occlusion.buffer = nullptr;
+		if (p_render_data->reflection_probe.is_null() && p_render_data->render_buffers.is_valid()) {
+			cluster_occlusion.buffer = render_buffers_get_occlusion_buffer(p_render_data->render_buffers, cluster_occlusion.cam_transform, cluster_occlusion.cam_projection);
+			if (cluster_occlusion.buffer) {
+				cluster_occlusion.cam_inv_transform = cluster_occlusion.cam_transform.affine_inverse();
+				cluster_occlusion.cam_view_projection = cluster_occlusion.cam_projection * Projection(cluster_occlusion.cam_inv_transform);
+				cluster_occlusion.z_near = cluster_occlusion.cam_projection.get_z_near();
+			}
+		}
+	}
+
 	//fill list
 
 	for (int i = 0; i < (int)p_render_data->instances->size(); i++) {
@@ -931,6 +1084,10 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 		}
 		inst->flags_cache = flags;
 
+		if (cull_clusters && (flags & (INSTANCE_DATA_FLAG_MULTIMESH | INSTANCE_DATA_FLAG_PARTICLES)) == INSTANCE_DATA_FLAG_MULTIMESH && inst->instance_count > 0) {
+			_cull_multimesh_instances(inst);
+		}
+
 		GeometryInstanceSurfaceDataCache *surf = inst->surface_caches;
 
 		while (surf) {
@@ -999,6 +1156,14 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 					force_alpha = true;
 				}
 
+				if (!surf->material->streamed_textures.is_empty()) {
+					_texture_stream_feedback(p_render_data, surf->material->streamed_textures, inst->transformed_aabb, inst->depth);
+				}
+
+				if (cull_clusters && (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_CLUSTER_CULLING) && surf->sort.lod_index == 0 && inst->mesh_instance.is_null()) {
+					_cull_surface_clusters(surf, p_render_data);
+				}
+
 				if (!force_alpha && (surf->flags & (GeometryInstanceSurfaceDataCache::FLAG_PASS_DEPTH | GeometryInstanceSurfaceDataCache::FLAG_PASS_OPAQUE))) {
 					rl->add_element(surf);
 				}
@@ -1197,6 +1362,7 @@ void RenderForwardClustered::_update_volumetric_fog(Ref<RenderSceneBuffersRD> p_
 		settings.is_using_radiance_cubemap_array = is_using_radiance_cubemap_array();
 		settings.max_cluster_elements = RendererRD::LightStorage::get_singleton()->get_max_cluster_elements();
 		settings.volumetric_fog_filter_active = get_volumetric_fog_filter_active();
+		settings.volumetric_fog_interleaved_updates = get_volumetric_fog_interleaved_updates();
 
 		settings.shadow_sampler = shadow_sampler;
 		settings.shadow_atlas_depth = RendererRD::LightStorage::get_singleton()->owns_shadow_atlas(p_shadow_atlas) ? RendererRD::LightStorage::get_singleton()->shadow_atlas_get_texture(p_shadow_atlas) : RID();
@@ -1355,6 +1521,27 @@ void RenderForwardClustered::_pre_opaque_render(RenderDataRD *p_render_data, boo
 			_render_shadow_pass(p_render_data->render_shadows[p_render_data->cube_shadows[i]].light, p_render_data->shadow_atlas, p_render_data->render_shadows[p_render_data->cube_shadows[i]].pass, p_render_data->render_shadows[p_render_data->cube_shadows[i]].instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, true, true, true, p_render_data->render_info);
 		}
 
+		//redraw static shadow caches whose casters changed, the regular positional pass starts from a copy of them
+		LocalVector<int> static_shadows;
+		for (uint32_t i = 0; i < p_render_data->shadows.size(); i++) {
+			const RendererSceneRender::RenderShadowData &shadow = p_render_data->render_shadows[p_render_data->shadows[i]];
+			if (shadow.use_static_cache && light_storage->shadow_atlas_update_static_shadow(p_render_data->shadow_atlas, shadow.light, shadow.pass, shadow.static_version)) {
+				static_shadows.push_back(p_render_data->shadows[i]);
+			}
+		}
+
+		if (static_shadows.size()) {
+			RENDER_TIMESTAMP("Render Static Shadows");
+
+			_render_shadow_begin();
+			for (uint32_t i = 0; i < static_shadows.size(); i++) {
+				const RendererSceneRender::RenderShadowData &shadow = p_render_data->render_shadows[static_shadows[i]];
+				_render_shadow_pass(shadow.light, p_render_data->shadow_atlas, shadow.pass, shadow.static_instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, i == 0, i == static_shadows.size() - 1, true, p_render_data->render_info, STATIC_SHADOW_RENDER);
+			}
+			_render_shadow_process();
+			_render_shadow_end();
+		}
+
 		if (p_render_data->directional_shadows.size()) {
 			//open the pass for directional shadows
 			light_storage->update_directional_shadow_atlas();
@@ -1386,7 +1573,7 @@ void RenderForwardClustered::_pre_opaque_render(RenderDataRD *p_render_data, boo
 		}
 		//render positional shadows
 		for (uint32_t i = 0; i < p_render_data->shadows.size(); i++) {
-			_render_shadow_pass(p_render_data->render_shadows[p_render_data->shadows[i]].light, p_render_data->shadow_atlas, p_render_data->render_shadows[p_render_data->shadows[i]].pass, p_render_data->render_shadows[p_render_data->shadows[i]].instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, i == 0, i == p_render_data->shadows.size() - 1, true, p_render_data->render_info);
+			_render_shadow_pass(p_render_data->render_shadows[p_render_data->shadows[i]].light, p_render_data->shadow_atlas, p_render_data->render_shadows[p_render_data->shadows[i]].pass, p_render_data->render_shadows[p_render_data->shadows[i]].instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, i == 0, i == p_render_data->shadows.size() - 1, true, p_render_data->render_info, p_render_data->render_shadows[p_render_data->shadows[i]].use_static_cache ? STATIC_SHADOW_COPY : STATIC_SHADOW_NONE);
 		}
 
 		_render_shadow_process();
@@ -1836,6 +2023,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 
 		bool finish_depth = using_ssao || using_sdfgi || using_voxelgi;
 		RenderListParameters render_list_params(render_list[RENDER_LIST_OPAQUE].elements.ptr(), render_list[RENDER_LIST_OPAQUE].element_info.ptr(), render_list[RENDER_LIST_OPAQUE].elements.size(), reverse_cull, depth_pass_mode, 0, rb_data.is_null(), p_render_data->directional_light_soft_shadows, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, p_render_data->scene_data->view_count);
+		render_list_params.use_cluster_culling = true;
 		_render_list_with_threads(&render_list_params, depth_framebuffer, needs_pre_resolve ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_READ, needs_pre_resolve ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_CLEAR, finish_depth ? RD::FINAL_ACTION_READ : RD::FINAL_ACTION_CONTINUE, needs_pre_resolve ? Vector<Color>() : depth_pass_clear);
 
 		RD::get_singleton()->draw_command_end_label();
@@ -1906,6 +2094,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 		}
 
 		RenderListParameters render_list_params(render_list[RENDER_LIST_OPAQUE].elements.ptr(), render_list[RENDER_LIST_OPAQUE].element_info.ptr(), render_list[RENDER_LIST_OPAQUE].elements.size(), reverse_cull, PASS_MODE_COLOR, color_pass_flags, rb_data.is_null(), p_render_data->directional_light_soft_shadows, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, p_render_data->scene_data->view_count);
+		render_list_params.use_cluster_culling = true;
 		_render_list_with_threads(&render_list_params, color_framebuffer, keep_color ? RD::INITIAL_ACTION_KEEP : RD::INITIAL_ACTION_CLEAR, will_continue_color ? RD::FINAL_ACTION_CONTINUE : RD::FINAL_ACTION_READ, depth_pre_pass ? (continue_depth ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_KEEP) : RD::INITIAL_ACTION_CLEAR, will_continue_depth ? RD::FINAL_ACTION_CONTINUE : RD::FINAL_ACTION_READ, c, 1.0, 0);
 		if (will_continue_color && using_separate_specular) {
 			// close the specular framebuffer, as it's no longer used
@@ -2027,6 +2216,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 		uint32_t transparent_color_pass_flags = (color_pass_flags | COLOR_PASS_FLAG_TRANSPARENT) & ~(COLOR_PASS_FLAG_SEPARATE_SPECULAR);
 		RID alpha_framebuffer = rb_data.is_valid() ? rb_data->get_color_pass_fb(transparent_color_pass_flags) : color_only_framebuffer;
 		RenderListParameters render_list_params(render_list[RENDER_LIST_ALPHA].elements.ptr(), render_list[RENDER_LIST_ALPHA].element_info.ptr(), render_list[RENDER_LIST_ALPHA].elements.size(), false, PASS_MODE_COLOR, transparent_color_pass_flags, rb_data.is_null(), p_render_data->directional_light_soft_shadows, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, p_render_data->scene_data->view_count);
+		render_list_params.use_cluster_culling = true;
 		_render_list_with_threads(&render_list_params, alpha_framebuffer, can_continue_color ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, can_continue_depth ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ);
 	}
 
@@ -2057,7 +2247,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 
 	if (rb.is_valid() && taa && rb->get_use_taa()) {
 		RENDER_TIMESTAMP("TAA")
-		taa->process(rb, _render_buffers_get_color_format(), p_render_data->scene_data->z_near, p_render_data->scene_data->z_far);
+		taa->process(rb, _render_buffers_get_color_format(), p_render_data->scene_data->z_near, p_render_data->scene_data->z_far, p_render_data->scene_data->taa_jitter);
 	}
 
 	if (rb.is_valid()) {
@@ -2116,7 +2306,7 @@ void RenderForwardClustered::_render_buffers_debug_draw(Ref<RenderSceneBuffersRD
 	}
 }
 
-void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane, float p_lod_distance_multiplier, float p_screen_mesh_lod_threshold, bool p_open_pass, bool p_close_pass, bool p_clear_region, RenderingMethod::RenderInfo *p_render_info) {
+void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane, float p_lod_distance_multiplier, float p_screen_mesh_lod_threshold, bool p_open_pass, bool p_close_pass, bool p_clear_region, RenderingMethod::RenderInfo *p_render_info, StaticShadowMode p_static_shadow_mode) {
 	RendererRD::LightStorage *light_storage = RendererRD::LightStorage::get_singleton();
 
 	ERR_FAIL_COND(!light_storage->owns_light_instance(p_light));
@@ -2266,6 +2456,15 @@ void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas
 
 			flip_y = true;
 		}
+
+		if (!render_cubemap && p_static_shadow_mode == STATIC_SHADOW_RENDER) {
+			render_fb = light_storage->shadow_atlas_get_static_fb(p_shadow_atlas);
+		} else if (!render_cubemap && p_static_shadow_mode == STATIC_SHADOW_COPY) {
+			//static casters are already drawn, only add the dynamic ones on top
+			Vector3 rect_pos = Vector3(atlas_rect.position.x, atlas_rect.position.y, 0);
+			RD::get_singleton()->texture_copy(light_storage->shadow_atlas_get_static_texture(p_shadow_atlas), light_storage->shadow_atlas_get_texture(p_shadow_atlas), rect_pos, rect_pos, Vector3(atlas_rect.size.x, atlas_rect.size.y, 1), 0, 0, 0, 0);
+			p_clear_region = false;
+		}
 	}
 
 	if (render_cubemap) {
@@ -2338,8 +2537,8 @@ void RenderForwardClustered::_render_shadow_append(RID p_framebuffer, const Page
 	uint32_t render_list_from = render_list[RENDER_LIST_SECONDARY].elements.size();
 	_fill_render_list(RENDER_LIST_SECONDARY, &render_data, pass_mode, 0, false, false, true);
 	uint32_t render_list_size = render_list[RENDER_LIST_SECONDARY].elements.size() - render_list_from;
-	render_list[RENDER_LIST_SECONDARY].sort_by_key_range(render_list_from, render_list_size);
-	_fill_instance_data(RENDER_LIST_SECONDARY, p_render_info ? p_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW] : (int *)nullptr, render_list_from, render_list_size, false);
+	render_list[RENDER_LIST_SECONDARY].sort_by_shadow_key_range(render_list_from, render_list_size);
+	_fill_instance_data(RENDER_LIST_SECONDARY, p_render_info ? p_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW] : (int *)nullptr, render_list_from, render_list_size, false, true);
 
 	{
 		//regular forward for now
@@ -2359,7 +2558,7 @@ void RenderForwardClustered::_render_shadow_append(RID p_framebuffer, const Page
 		shadow_pass.lod_distance_multiplier = scene_data.lod_distance_multiplier;
 
 		shadow_pass.framebuffer = p_framebuffer;
-		shadow_pass.initial_depth_action = p_begin ? (p_clear_region ? RD::INITIAL_ACTION_CLEAR_REGION : RD::INITIAL_ACTION_CLEAR) : (p_clear_region ? RD::INITIAL_ACTION_CLEAR_REGION_CONTINUE : RD::INITIAL_ACTION_CONTINUE);
+		shadow_pass.initial_depth_action = p_begin ? (p_clear_region ? RD::INITIAL_ACTION_CLEAR_REGION : RD::INITIAL_ACTION_KEEP) : (p_clear_region ? RD::INITIAL_ACTION_CLEAR_REGION_CONTINUE : RD::INITIAL_ACTION_CONTINUE);
 		shadow_pass.final_depth_action = p_end ? RD::FINAL_ACTION_READ : RD::FINAL_ACTION_CONTINUE;
 		shadow_pass.rect = p_rect;
 
@@ -3357,8 +3556,25 @@ void RenderForwardClustered::_geometry_instance_add_surface_with_material(Geomet
 		flags |= GeometryInstanceSurfaceDataCache::FLAG_USES_PARTICLE_TRAILS;
 	}
 
+	// Multimesh instances are culled with the bounds of their mesh, so the vertex shader must not move vertices.
+	if (ginstance->data->base_type == RS::INSTANCE_MULTIMESH && !p_material->shader_data->uses_vertex && !p_material->shader_data->uses_position && !p_material->shader_data->writes_modelview_or_projection) {
+		flags |= GeometryInstanceSurfaceDataCache::FLAG_USES_MULTIMESH_CULLING;
+	}
+
+	// Cluster bounds are computed from the mesh data, so the vertex shader must not move vertices.
+	void *mesh_surface = mesh_storage->mesh_get_surface(p_mesh, p_surface);
+	if (mesh_storage->mesh_surface_has_clusters(mesh_surface) && ginstance->data->base_type == RS::INSTANCE_MESH && !p_material->shader_data->uses_vertex && !p_material->shader_data->uses_position && !p_material->shader_data->writes_modelview_or_projection && !p_material->shader_data->uses_particle_trails) {
+		flags |= GeometryInstanceSurfaceDataCache::FLAG_USES_CLUSTER_CULLING;
+		if (p_material->shader_data->cull_mode == SceneShaderForwardClustered::ShaderData::CULL_BACK) {
+			flags |= GeometryInstanceSurfaceDataCache::FLAG_USES_CLUSTER_BACKFACE_CULLING;
+		}
+	}
+
 	SceneShaderForwardClustered::MaterialData *material_shadow = nullptr;
 	void *surface_shadow = nullptr;
+	RID geometry_shadow = p_mesh;
+	uint32_t material_shadow_id = p_material_id;
+	uint32_t shader_shadow_id = p_shader_id;
 	if (!p_material->shader_data->uses_particle_trails && !p_material->shader_data->writes_modelview_or_projection && !p_material->shader_data->uses_vertex && !p_material->shader_data->uses_position && !p_material->shader_data->uses_discard && !p_material->shader_data->uses_depth_pre_pass && !p_material->shader_data->uses_alpha_clip && p_material->shader_data->cull_mode == SceneShaderForwardClustered::ShaderData::CULL_BACK && !p_material->shader_data->uses_point_size) {
 		flags |= GeometryInstanceSurfaceDataCache::FLAG_USES_SHARED_SHADOW_MATERIAL;
 		material_shadow = static_cast<SceneShaderForwardClustered::MaterialData *>(RendererRD::MaterialStorage::get_singleton()->material_get_data(scene_shader.default_material, RendererRD::MaterialStorage::SHADER_TYPE_3D));
@@ -3367,7 +3583,12 @@ void RenderForwardClustered::_geometry_instance_add_surface_with_material(Geomet
 
 		if (shadow_mesh.is_valid()) {
 			surface_shadow = mesh_storage->mesh_get_surface(shadow_mesh, p_surface);
+			if (surface_shadow) {
+				geometry_shadow = shadow_mesh;
+			}
 		}
+		material_shadow_id = scene_shader.default_material.get_local_index();
+		shader_shadow_id = RendererRD::MaterialStorage::get_singleton()->material_get_shader_id(scene_shader.default_material);
 
 	} else {
 		material_shadow = p_material;
@@ -3378,8 +3599,9 @@ void RenderForwardClustered::_geometry_instance_add_surface_with_material(Geomet
 	sdcache->flags = flags;
 
 	sdcache->shader = p_material->shader_data;
+	sdcache->material = p_material;
 	sdcache->material_uniform_set = p_material->uniform_set;
-	sdcache->surface = mesh_storage->mesh_get_surface(p_mesh, p_surface);
+	sdcache->surface = mesh_surface;
 	sdcache->primitive = mesh_storage->mesh_surface_get_primitive(sdcache->surface);
 	sdcache->surface_index = p_surface;
 
@@ -3412,6 +3634,10 @@ void RenderForwardClustered::_geometry_instance_add_surface_with_material(Geomet
 	sdcache->sort.priority = p_material->priority;
 	sdcache->sort.uses_projector = ginstance->using_projectors;
 	sdcache->sort.uses_softshadow = ginstance->using_softshadows;
+
+	sdcache->shadow_geometry_id = geometry_shadow.get_local_index();
+	sdcache->shadow_material_id = material_shadow_id;
+	sdcache->shadow_shader_id = shader_shadow_id;
 }
 
 void RenderForwardClustered::_geometry_instance_add_surface_with_material_chain(GeometryInstanceForwardClustered *ginstance, uint32_t p_surface, SceneShaderForwardClustered::MaterialData *p_material, RID p_mat_src, RID p_mesh) {
@@ -3535,6 +3761,7 @@ void RenderForwardClustered::_geometry_instance_update(RenderGeometryInstance *p
 #endif
 		case RS::INSTANCE_PARTICLES: {
 			int draw_passes = particles_storage->particles_get_draw_passes(ginstance->data->base);
+			int32_t draw_command = 0;
 
 			for (int j = 0; j < draw_passes; j++) {
 				RID mesh = particles_storage->particles_get_draw_pass_mesh(ginstance->data->base, j);
@@ -3548,7 +3775,13 @@ void RenderForwardClustered::_geometry_instance_update(RenderGeometryInstance *p
 				materials = mesh_storage->mesh_get_surface_count_and_materials(mesh, surface_count);
 				if (materials) {
 					for (uint32_t k = 0; k < surface_count; k++) {
+						GeometryInstanceSurfaceDataCache *prev_surface_caches = ginstance->surface_caches;
 						_geometry_instance_add_surface(ginstance, k, materials[k], mesh);
+						// Next passes of the material add more surfaces, all of them share the draw command.
+						for (GeometryInstanceSurfaceDataCache *sdcache = ginstance->surface_caches; sdcache != prev_surface_caches; sdcache = sdcache->next) {
+							sdcache->particles_draw_command = draw_command;
+						}
+						draw_command++;
 					}
 				}
 			}
@@ -3843,6 +4076,7 @@ RenderForwardClustered::RenderForwardClustered() {
 		shadow_sampler = RD::get_singleton()->sampler_create(sampler);
 	}
 
+	render_list_threaded = GLOBAL_GET("rendering/limits/forward_renderer/threaded_render");
 	render_list_thread_threshold = GLOBAL_GET("rendering/limits/forward_renderer/threaded_render_minimum_instances");
 
 	_update_shader_quality_settings();
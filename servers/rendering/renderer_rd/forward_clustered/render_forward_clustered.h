@@ -40,6 +40,7 @@
 #include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
 #include "servers/rendering/renderer_rd/renderer_scene_render_rd.h"
 #include "servers/rendering/renderer_rd/shaders/forward_clustered/scene_forward_clustered.glsl.gen.h"
+#include "servers/rendering/renderer_rd/storage_rd/mesh_storage.h"
 #include "servers/rendering/renderer_rd/storage_rd/utilities.h"
 
 #define RB_SCOPE_FORWARD_CLUSTERED SNAME("forward_clustered")
@@ -212,6 +213,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		uint32_t element_offset = 0;
 		uint32_t barrier = RD::BARRIER_MASK_ALL_BARRIERS;
 		bool use_directional_soft_shadow = false;
+		bool use_cluster_culling = false;
 
 		RenderListParameters(GeometryInstanceSurfaceDataCache **p_elements, RenderElementInfo *p_element_info, int p_element_count, bool p_reverse_cull, PassMode p_pass_mode, uint32_t p_color_pass_flags, bool p_no_gi, bool p_use_directional_soft_shadows, RID p_render_pass_uniform_set, bool p_force_wireframe = false, const Vector2 &p_uv_offset = Vector2(), float p_lod_distance_multiplier = 0.0, float p_screen_mesh_lod_threshold = 0.0, uint32_t p_view_count = 1, uint32_t p_element_offset = 0, uint32_t p_barrier = RD::BARRIER_MASK_ALL_BARRIERS) {
 			elements = p_elements;
@@ -372,21 +374,32 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		uint32_t lod_index : 8;
 	};
 
-	template <PassMode p_pass_mode, uint32_t p_color_pass_flags = 0>
+	template <PassMode p_pass_mode, uint32_t p_color_pass_flags = 0, bool p_prepare_only = false>
 	_FORCE_INLINE_ void _render_list_template(RenderingDevice::DrawListID p_draw_list, RenderingDevice::FramebufferFormatID p_framebuffer_Format, RenderListParameters *p_params, uint32_t p_from_element, uint32_t p_to_element);
 
+	template <bool p_prepare_only = false>
 	void _render_list(RenderingDevice::DrawListID p_draw_list, RenderingDevice::FramebufferFormatID p_framebuffer_Format, RenderListParameters *p_params, uint32_t p_from_element, uint32_t p_to_element);
 
 	LocalVector<RD::DrawListID> thread_draw_lists;
+	uint32_t _render_list_thread_split(uint32_t p_thread, uint32_t p_total_threads, const RenderListParameters *p_params);
+	void _render_list_prepare_thread_function(uint32_t p_thread, RenderListParameters *p_params);
 	void _render_list_thread_function(uint32_t p_thread, RenderListParameters *p_params);
 	void _render_list_with_threads(RenderListParameters *p_params, RID p_framebuffer, RD::InitialAction p_initial_color_action, RD::FinalAction p_final_color_action, RD::InitialAction p_initial_depth_action, RD::FinalAction p_final_depth_action, const Vector<Color> &p_clear_color_values = Vector<Color>(), float p_clear_depth = 1.0, uint32_t p_clear_stencil = 0, const Rect2 &p_region = Rect2(), const Vector<RID> &p_storage_textures = Vector<RID>());
 
+	bool render_list_threaded = false;
 	uint32_t render_list_thread_threshold = 500;
 
 	void _update_instance_data_buffer(RenderListType p_render_list);
-	void _fill_instance_data(RenderListType p_render_list, int *p_render_info = nullptr, uint32_t p_offset = 0, int32_t p_max_elements = -1, bool p_update_buffer = true);
+	void _fill_instance_data(RenderListType p_render_list, int *p_render_info = nullptr, uint32_t p_offset = 0, int32_t p_max_elements = -1, bool p_update_buffer = true, bool p_use_shadow_sort_keys = false);
 	void _fill_render_list(RenderListType p_render_list, const RenderDataRD *p_render_data, PassMode p_pass_mode, uint32_t p_color_pass_flags, bool p_using_sdfgi = false, bool p_using_opaque_gi = false, bool p_append = false);
 
+	// Visible clusters of surfaces drawn in the main opaque and alpha passes, filled by _fill_render_list.
+	LocalVector<RID> cluster_draws;
+	uint64_t cluster_pass = 0;
+	Vector<Plane> cluster_frustum_planes;
+	RendererRD::MeshStorage::ClusterOcclusion cluster_occlusion;
+	void _cull_surface_clusters(GeometryInstanceSurfaceDataCache *p_surface, const RenderDataRD *p_render_data);
+
 	HashMap<Size2i, RID> sdfgi_framebuffer_size_cache;
 
 	struct GeometryInstanceData;
@@ -404,6 +417,9 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			FLAG_PASS_ALPHA = 4,
 			FLAG_PASS_SHADOW = 8,
 			FLAG_USES_SHARED_SHADOW_MATERIAL = 128,
+			FLAG_USES_CLUSTER_CULLING = 256,
+			FLAG_USES_CLUSTER_BACKFACE_CULLING = 512,
+			FLAG_USES_MULTIMESH_CULLING = 1024,
 			FLAG_USES_SUBSURFACE_SCATTERING = 2048,
 			FLAG_USES_SCREEN_TEXTURE = 4096,
 			FLAG_USES_DEPTH_TEXTURE = 8192,
@@ -434,6 +450,30 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			};
 		} sort;
 
+		// Shadow passes draw surfaces with their shadow material and geometry. When that is the shared shadow
+		// material, their own material is left out of the key, so they batch and instance with any surface of
+		// the same geometry. Per-frame fields that don't affect shadows are left out as well.
+		uint32_t shadow_geometry_id = 0;
+		uint32_t shadow_material_id = 0;
+		uint32_t shadow_shader_id = 0;
+
+		_FORCE_INLINE_ void get_shadow_sort_keys(uint64_t &r_key1, uint64_t &r_key2) const {
+			decltype(sort) key = sort;
+			key.geometry_id = shadow_geometry_id;
+			key.material_id_low = shadow_material_id & 0xFFFF;
+			key.material_id_hi = shadow_material_id >> 16;
+			key.shader_id = shadow_shader_id;
+			key.uses_softshadow = 0;
+			key.uses_projector = 0;
+			key.uses_forward_gi = 0;
+			key.uses_lightmap = 0;
+			if (flags & FLAG_USES_SHARED_SHADOW_MATERIAL) {
+				key.priority = 0;
+			}
+			r_key1 = key.sort_key1;
+			r_key2 = key.sort_key2;
+		}
+
 		RS::PrimitiveType primitive = RS::PRIMITIVE_MAX;
 		uint32_t flags = 0;
 		uint32_t surface_index = 0;
@@ -441,11 +481,18 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		void *surface = nullptr;
 		RID material_uniform_set;
 		SceneShaderForwardClustered::ShaderData *shader = nullptr;
+		SceneShaderForwardClustered::MaterialData *material = nullptr;
 
 		void *surface_shadow = nullptr;
 		RID material_uniform_set_shadow;
 		SceneShaderForwardClustered::ShaderData *shader_shadow = nullptr;
 
+		uint64_t cluster_pass = 0;
+		uint32_t cluster_draw_offset = 0;
+		uint32_t cluster_draw_count = 0;
+
+		int32_t particles_draw_command = -1; // Index of the indirect draw command of particle draw pass surfaces.
+
 		GeometryInstanceSurfaceDataCache *next = nullptr;
 		GeometryInstanceForwardClustered *owner = nullptr;
 	};
@@ -464,6 +511,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		bool store_transform_cache = true;
 		RID transforms_uniform_set;
 		uint32_t instance_count = 0;
+		uint64_t multimesh_cull_pass = 0; // Equal to cluster_pass when the multimesh instances were culled on the GPU.
 		uint32_t trail_steps = 1;
 		bool can_sdfgi = false;
 		bool using_projectors = false;
@@ -508,6 +556,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 	void _geometry_instance_add_surface(GeometryInstanceForwardClustered *ginstance, uint32_t p_surface, RID p_material, RID p_mesh);
 	void _geometry_instance_update(RenderGeometryInstance *p_geometry_instance);
 	void _update_dirty_geometry_instances();
+	void _cull_multimesh_instances(GeometryInstanceForwardClustered *p_instance);
 
 	/* Render List */
 
@@ -538,6 +587,20 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			sorter.sort(elements.ptr() + p_from, p_size);
 		}
 
+		struct SortByShadowKey {
+			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
+				uint64_t a_key1, a_key2, b_key1, b_key2;
+				A->get_shadow_sort_keys(a_key1, a_key2);
+				B->get_shadow_sort_keys(b_key1, b_key2);
+				return (a_key2 == b_key2) ? (a_key1 < b_key1) : (a_key2 < b_key2);
+			}
+		};
+
+		void sort_by_shadow_key_range(uint32_t p_from, uint32_t p_size) { //used for shadows
+			SortArray<GeometryInstanceSurfaceDataCache *, SortByShadowKey> sorter;
+			sorter.sort(elements.ptr() + p_from, p_size);
+		}
+
 		struct SortByDepth {
 			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
 				return (A->owner->depth < B->owner->depth);
@@ -592,7 +655,13 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 
 	/* Render shadows */
 
-	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0, float p_screen_mesh_lod_threshold = 0.0, bool p_open_pass = true, bool p_close_pass = true, bool p_clear_region = true, RenderingMethod::RenderInfo *p_render_info = nullptr);
+	enum StaticShadowMode {
+		STATIC_SHADOW_NONE,
+		STATIC_SHADOW_RENDER, // draw into the static shadow atlas
+		STATIC_SHADOW_COPY, // start from the static shadow atlas contents instead of clearing
+	};
+
+	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0, float p_screen_mesh_lod_threshold = 0.0, bool p_open_pass = true, bool p_close_pass = true, bool p_clear_region = true, RenderingMethod::RenderInfo *p_render_info = nullptr, StaticShadowMode p_static_shadow_mode = STATIC_SHADOW_NONE);
 	void _render_shadow_begin();
 	void _render_shadow_append(RID p_framebuffer, const PagedArray<RenderGeometryInstance *> &p_instances, const Projection &p_projection, const Transform3D &p_transform, float p_zfar, float p_bias, float p_normal_bias, bool p_use_dp, bool p_use_dp_flip, bool p_use_pancake, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0.0, float p_screen_mesh_lod_threshold = 0.0, const Rect2i &p_rect = Rect2i(), bool p_flip_y = false, bool p_clear_region = true, bool p_begin = true, bool p_end = true, RenderingMethod::RenderInfo *p_render_info = nullptr);
 	void _render_shadow_process();
@@ -654,6 +723,8 @@ public:
 
 	virtual uint32_t geometry_instance_get_pair_mask() override;
 
+	virtual bool is_static_shadow_cache_supported() const override { return true; }
+
 	virtual bool free(RID p_rid) override;
 
 	RenderForwardClustered();
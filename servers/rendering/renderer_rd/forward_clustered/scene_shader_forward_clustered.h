@@ -134,6 +134,7 @@ public:
 		};
 
 		bool valid = false;
+		bool compiling = false;
 		RID version;
 		uint32_t vertex_input_mask = 0;
 		PipelineCacheRD pipelines[CULL_VARIANT_MAX][RS::PRIMITIVE_MAX][PIPELINE_VERSION_MAX];
@@ -150,8 +151,11 @@ public:
 		String code;
 		HashMap<StringName, HashMap<int, RID>> default_texture_params;
 
+		BlendMode blend_mode = BLEND_MODE_MIX;
+		AlphaAntiAliasing alpha_antialiasing_mode = ALPHA_ANTIALIASING_OFF;
 		DepthDraw depth_draw = DEPTH_DRAW_OPAQUE;
 		DepthTest depth_test = DEPTH_TEST_ENABLED;
+		bool wireframe = false;
 
 		bool uses_point_size = false;
 		bool uses_alpha = false;
@@ -182,7 +186,10 @@ public:
 		uint64_t last_pass = 0;
 		uint32_t index = 0;
 
+		void _setup_pipelines();
+
 		virtual void set_code(const String &p_Code);
+		virtual bool poll_compilation();
 		virtual void set_path_hint(const String &p_path);
 		virtual void set_default_texture_parameter(const StringName &p_name, RID p_texture, int p_index);
 		virtual void get_shader_uniform_list(List<PropertyInfo> *p_param_list) const;
@@ -152,12 +152,12 @@ void RenderForwardMobile::RenderBufferDataForwardMobile::configure(RenderSceneBu
 
 		texture_samples = ts[msaa_3d];
 
-		render_buffers->create_texture(RB_SCOPE_MOBILE, RB_TEX_COLOR_MSAA, format, usage_bits, texture_samples);
+		render_buffers->create_texture(RB_SCOPE_MOBILE, RB_TEX_COLOR_MSAA, format, usage_bits, texture_samples, Size2i(), 0, 1, false);
 
 		format = RD::get_singleton()->texture_is_format_supported_for_usage(RD::DATA_FORMAT_D24_UNORM_S8_UINT, RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ? RD::DATA_FORMAT_D24_UNORM_S8_UINT : RD::DATA_FORMAT_D32_SFLOAT_S8_UINT;
 		usage_bits = RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT | RD::TEXTURE_USAGE_SAMPLING_BIT;
 
-		render_buffers->create_texture(RB_SCOPE_MOBILE, RB_TEX_DEPTH_MSAA, format, usage_bits, texture_samples);
+		render_buffers->create_texture(RB_SCOPE_MOBILE, RB_TEX_DEPTH_MSAA, format, usage_bits, texture_samples, Size2i(), 0, 1, false);
 	}
 }
 
@@ -505,6 +505,19 @@ RID RenderForwardMobile::_setup_render_pass_uniform_set(RenderListType p_render_
 		u.append_id(texture);
 		uniforms.push_back(u);
 	}
+	{
+		RD::Uniform u;
+		u.binding = 11;
+		u.uniform_type = RD::UNIFORM_TYPE_TEXTURE;
+		RID texture;
+		if (light_tiles_active && rb.is_valid() && rb->has_texture(RB_SCOPE_MOBILE, RB_TEX_LIGHT_TILES)) {
+			texture = rb->get_texture(RB_SCOPE_MOBILE, RB_TEX_LIGHT_TILES);
+		} else {
+			texture = light_tiles_default;
+		}
+		u.append_id(texture);
+		uniforms.push_back(u);
+	}
 
 	if (p_index >= (int)render_pass_uniform_sets.size()) {
 		render_pass_uniform_sets.resize(p_index + 1);
@@ -550,6 +563,91 @@ void RenderForwardMobile::_setup_lightmaps(const RenderDataRD *p_render_data, co
 	}
 }
 
+/* Light tiles */
+
+void RenderForwardMobile::setup_added_light(const RS::LightType p_type, const Transform3D &p_transform, float p_radius, float p_spot_aperture) {
+	if (light_tiles_active) {
+		LightTileLight light;
+		light.type = p_type;
+		light.position = p_transform.origin;
+		light.radius = p_radius;
+		light_tile_lights.push_back(light);
+	}
+}
+
+void RenderForwardMobile::_update_light_tiles(RenderDataRD *p_render_data) {
+	Ref<RenderSceneBuffersRD> rb = p_render_data->render_buffers;
+	ERR_FAIL_COND(rb.is_null());
+
+	Size2i screen_size = rb->get_internal_size();
+	Size2i tile_count = Size2i((screen_size.x + LIGHT_TILE_SIZE - 1) / LIGHT_TILE_SIZE, (screen_size.y + LIGHT_TILE_SIZE - 1) / LIGHT_TILE_SIZE);
+
+	RID tiles;
+	if (rb->has_texture(RB_SCOPE_MOBILE, RB_TEX_LIGHT_TILES)) {
+		tiles = rb->get_texture(RB_SCOPE_MOBILE, RB_TEX_LIGHT_TILES);
+	} else {
+		tiles = rb->create_texture(RB_SCOPE_MOBILE, RB_TEX_LIGHT_TILES, RD::DATA_FORMAT_R32G32B32A32_UINT, RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_CAN_UPDATE_BIT, RD::TEXTURE_SAMPLES_1, tile_count, 1);
+	}
+
+	// Each tile stores two 64 bit masks, omni lights in RG and spot lights in BA.
+	light_tile_data.resize(tile_count.x * tile_count.y * 4 * sizeof(uint32_t));
+	uint32_t *tile_data = (uint32_t *)light_tile_data.ptrw();
+	memset(tile_data, 0, light_tile_data.size());
+
+	const Projection &projection = p_render_data->scene_data->cam_projection;
+	Transform3D view_xform = p_render_data->scene_data->cam_transform.affine_inverse();
+	bool is_orthogonal = projection.is_orthogonal();
+	real_t z_near = projection.get_z_near();
+
+	uint32_t omni_index = 0;
+	uint32_t spot_index = 0;
+
+	for (uint32_t i = 0; i < light_tile_lights.size(); i++) {
+		const LightTileLight &light = light_tile_lights[i];
+		uint32_t index = light.type == RS::LIGHT_SPOT ? spot_index++ : omni_index++;
+		if (index >= MAX_LIGHT_TILE_LIGHTS) {
+			continue; // lights are sorted by distance, so only the farthest ones get dropped
+		}
+
+		// Conservative screen rect, from the corners of the box around the light range.
+		Vector3 center = view_xform.xform(light.position);
+		Vector2 from = Vector2(1, 1);
+		Vector2 to = Vector2(-1, -1);
+		for (int j = 0; j < 8; j++) {
+			Vector3 corner = center + Vector3((j & 1) ? light.radius : -light.radius, (j & 2) ? light.radius : -light.radius, (j & 4) ? light.radius : -light.radius);
+			if (!is_orthogonal && corner.z > -z_near) {
+				// Crosses the near plane, can't be projected.
+				from = Vector2(-1, -1);
+				to = Vector2(1, 1);
+				break;
+			}
+			Vector3 ndc = projection.xform(corner);
+			from = from.min(Vector2(ndc.x, ndc.y));
+			to = to.max(Vector2(ndc.x, ndc.y));
+		}
+
+		if (from.x > 1.0 || from.y > 1.0 || to.x < -1.0 || to.y < -1.0) {
+			continue;
+		}
+
+		// Tiles start at the top of the screen.
+		int tile_from_x = CLAMP(int(Math::floor((from.x * 0.5 + 0.5) * screen_size.x)) / LIGHT_TILE_SIZE, 0, tile_count.x - 1);
+		int tile_to_x = CLAMP(int(Math::floor((to.x * 0.5 + 0.5) * screen_size.x)) / LIGHT_TILE_SIZE, 0, tile_count.x - 1);
+		int tile_from_y = CLAMP(int(Math::floor((0.5 - to.y * 0.5) * screen_size.y)) / LIGHT_TILE_SIZE, 0, tile_count.y - 1);
+		int tile_to_y = CLAMP(int(Math::floor((0.5 - from.y * 0.5) * screen_size.y)) / LIGHT_TILE_SIZE, 0, tile_count.y - 1);
+
+		uint32_t word = (light.type == RS::LIGHT_SPOT ? 2 : 0) + (index >> 5);
+		uint32_t bit = 1 << (index & 31);
+		for (int y = tile_from_y; y <= tile_to_y; y++) {
+			for (int x = tile_from_x; x <= tile_to_x; x++) {
+				tile_data[(y * tile_count.x + x) * 4 + word] |= bit;
+			}
+		}
+	}
+
+	RD::get_singleton()->texture_update(tiles, 0, light_tile_data, RD::BARRIER_MASK_RASTER);
+}
+
 void RenderForwardMobile::_pre_opaque_render(RenderDataRD *p_render_data) {
 	RendererRD::LightStorage *light_storage = RendererRD::LightStorage::get_singleton();
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
@@ -627,9 +725,14 @@ void RenderForwardMobile::_pre_opaque_render(RenderDataRD *p_render_data) {
 
 	uint32_t directional_light_count = 0;
 	uint32_t positional_light_count = 0;
+	light_tile_lights.clear();
 	light_storage->update_light_buffers(p_render_data, *p_render_data->lights, p_render_data->scene_data->cam_transform, p_render_data->shadow_atlas, using_shadows, directional_light_count, positional_light_count, p_render_data->directional_light_soft_shadows);
 	texture_storage->update_decal_buffer(*p_render_data->decals, p_render_data->scene_data->cam_transform.affine_inverse());
 
+	if (light_tiles_active) {
+		_update_light_tiles(p_render_data);
+	}
+
 	p_render_data->directional_light_count = directional_light_count;
 }
 
@@ -735,6 +838,9 @@ void RenderForwardMobile::_render_scene(RenderDataRD *p_render_data, const Color
 		ERR_FAIL(); //bug?
 	}
 
+	// Multiview would need tiles for each view, those fall back to the per object lights.
+	light_tiles_active = light_tiles_enabled && rb_data.is_valid() && p_render_data->scene_data->view_count == 1;
+
 	p_render_data->scene_data->emissive_exposure_normalization = -1.0;
 
 	RD::get_singleton()->draw_command_begin_label("Render Setup");
@@ -1067,6 +1173,8 @@ void RenderForwardMobile::_render_scene(RenderDataRD *p_render_data, const Color
 	if (rb.is_valid()) {
 		_render_buffers_debug_draw(rb, p_render_data->shadow_atlas, p_render_data->occluder_debug_tex);
 	}
+
+	light_tiles_active = false;
 }
 
 /* these are being called from RendererSceneRenderRD::_pre_opaque_render */
@@ -1872,6 +1980,9 @@ void RenderForwardMobile::_fill_render_list(RenderListType p_render_list, const
 #else
 				bool force_alpha = false;
 #endif
+				if (!surf->material->streamed_textures.is_empty()) {
+					_texture_stream_feedback(p_render_data, surf->material->streamed_textures, inst->transformed_aabb, inst->depth);
+				}
 				if (!force_alpha && (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_PASS_OPAQUE)) {
 					rl->add_element(surf);
 				}
@@ -2080,6 +2191,9 @@ void RenderForwardMobile::_render_list_template(RenderingDevice::DrawListID p_dr
 				base_spec_constants |= 1 << SPEC_CONSTANT_USING_SOFT_SHADOWS;
 			}
 			forward_id_storage_mobile->fill_push_constant_instance_indices(&push_constant, base_spec_constants, inst);
+			if (light_tiles_active && inst->light_tiles_needed) {
+				base_spec_constants |= 1 << SPEC_CONSTANT_USE_LIGHT_TILES;
+			}
 
 #ifdef DEBUG_ENABLED
 			if (unlikely(get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_LIGHTING)) {
@@ -2279,6 +2393,7 @@ uint32_t RenderForwardMobile::geometry_instance_get_pair_mask() {
 void RenderForwardMobile::GeometryInstanceForwardMobile::pair_light_instances(const RID *p_light_instances, uint32_t p_light_instance_count) {
 	omni_light_count = 0;
 	spot_light_count = 0;
+	light_tiles_needed = false;
 
 	for (uint32_t i = 0; i < p_light_instance_count; i++) {
 		RS::LightType type = RendererRD::LightStorage::get_singleton()->light_instance_get_type(p_light_instances[i]);
@@ -2287,12 +2402,16 @@ void RenderForwardMobile::GeometryInstanceForwardMobile::pair_light_instances(co
 				if (omni_light_count < (uint32_t)MAX_RDL_CULL) {
 					omni_lights[omni_light_count] = RendererRD::LightStorage::get_singleton()->light_instance_get_forward_id(p_light_instances[i]);
 					omni_light_count++;
+				} else {
+					light_tiles_needed = true;
 				}
 			} break;
 			case RS::LIGHT_SPOT: {
 				if (spot_light_count < (uint32_t)MAX_RDL_CULL) {
 					spot_lights[spot_light_count] = RendererRD::LightStorage::get_singleton()->light_instance_get_forward_id(p_light_instances[i]);
 					spot_light_count++;
+				} else {
+					light_tiles_needed = true;
 				}
 			} break;
 			default:
@@ -2407,6 +2526,7 @@ void RenderForwardMobile::_geometry_instance_add_surface_with_material(GeometryI
 	sdcache->flags = flags;
 
 	sdcache->shader = p_material->shader_data;
+	sdcache->material = p_material;
 	sdcache->material_uniform_set = p_material->uniform_set;
 	sdcache->surface = mesh_storage->mesh_get_surface(p_mesh, p_surface);
 	sdcache->primitive = mesh_storage->mesh_surface_get_primitive(sdcache->surface);
@@ -2750,6 +2870,7 @@ RenderForwardMobile::RenderForwardMobile() {
 	}
 	// defines += "\n#define SDFGI_OCT_SIZE " + itos(gi.sdfgi_get_lightprobe_octahedron_size()) + "\n";
 	defines += "\n#define MAX_DIRECTIONAL_LIGHT_DATA_STRUCTS " + itos(MAX_DIRECTIONAL_LIGHTS) + "\n";
+	defines += "\n#define LIGHT_TILE_SIZE " + itos(LIGHT_TILE_SIZE) + "\n";
 
 	{
 		//lightmaps
@@ -2779,6 +2900,23 @@ RenderForwardMobile::RenderForwardMobile() {
 	// !BAS! maybe we need a mobile version of this setting?
 	render_list_thread_threshold = GLOBAL_GET("rendering/limits/forward_renderer/threaded_render_minimum_instances");
 
+	light_tiles_enabled = GLOBAL_GET("rendering/lights_and_shadows/mobile_light_tiles");
+	{
+		// bound instead of the light tiles when those are not used
+		RD::TextureFormat tf;
+		tf.format = RD::DATA_FORMAT_R32G32B32A32_UINT;
+		tf.width = 1;
+		tf.height = 1;
+		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT;
+
+		Vector<uint8_t> data;
+		data.resize(4 * sizeof(uint32_t));
+		memset(data.ptrw(), 0, data.size());
+		Vector<Vector<uint8_t>> texture_data;
+		texture_data.push_back(data);
+		light_tiles_default = RD::get_singleton()->texture_create(tf, RD::TextureView(), texture_data);
+	}
+
 	_update_shader_quality_settings();
 }
 
@@ -2800,4 +2938,6 @@ RenderForwardMobile::~RenderForwardMobile() {
 		RD::get_singleton()->free(scene_state.lightmap_capture_buffer);
 		memdelete_arr(scene_state.lightmap_captures);
 	}
+
+	RD::get_singleton()->free(light_tiles_default);
 }
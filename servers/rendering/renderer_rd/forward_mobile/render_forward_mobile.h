@@ -39,6 +39,8 @@
 
 #define RB_SCOPE_MOBILE SNAME("mobile")
 
+#define RB_TEX_LIGHT_TILES SNAME("light_tiles")
+
 namespace RendererSceneRenderImplementation {
 
 class RenderForwardMobile : public RendererSceneRenderRD {
@@ -81,11 +83,15 @@ private:
 		SPEC_CONSTANT_DISABLE_DECALS = 13,
 		SPEC_CONSTANT_DISABLE_FOG = 14,
 
+		SPEC_CONSTANT_USE_LIGHT_TILES = 16,
+
 	};
 
 	enum {
 		MAX_LIGHTMAPS = 8,
 		MAX_RDL_CULL = 8, // maximum number of reflection probes, decals or lights we can cull per geometry instance
+		LIGHT_TILE_SIZE = 32, // size in pixels of the screen tiles lights are binned into
+		MAX_LIGHT_TILE_LIGHTS = 64, // maximum number of omni and of spot lights stored per tile
 		INSTANCE_DATA_BUFFER_MIN_SIZE = 4096
 	};
 
@@ -349,6 +355,23 @@ private:
 
 	RenderList render_list[RENDER_LIST_MAX];
 
+	/* Light tiles */
+
+	// Objects paired with more lights than fit in their push constant read the lights from a texture of screen tiles instead.
+	struct LightTileLight {
+		RS::LightType type;
+		Vector3 position;
+		float radius;
+	};
+
+	bool light_tiles_enabled = false;
+	bool light_tiles_active = false; // for the scene being rendered
+	LocalVector<LightTileLight> light_tile_lights; // in light buffer order, filled from setup_added_light()
+	Vector<uint8_t> light_tile_data;
+	RID light_tiles_default;
+
+	void _update_light_tiles(RenderDataRD *p_render_data);
+
 protected:
 	/* setup */
 	virtual void _update_shader_quality_settings() override;
@@ -440,6 +463,7 @@ protected:
 		void *surface = nullptr;
 		RID material_uniform_set;
 		SceneShaderForwardMobile::ShaderData *shader = nullptr;
+		SceneShaderForwardMobile::MaterialData *material = nullptr;
 
 		void *surface_shadow = nullptr;
 		RID material_uniform_set_shadow;
@@ -491,6 +515,7 @@ protected:
 		RendererRD::ForwardID spot_lights[MAX_RDL_CULL];
 		uint32_t decals_count = 0;
 		RendererRD::ForwardID decals[MAX_RDL_CULL];
+		bool light_tiles_needed = false; // paired with more than MAX_RDL_CULL omni or spot lights
 
 		GeometryInstanceSurfaceDataCache *surface_caches = nullptr;
 
@@ -574,6 +599,8 @@ public:
 
 	virtual uint32_t geometry_instance_get_pair_mask() override;
 
+	virtual void setup_added_light(const RS::LightType p_type, const Transform3D &p_transform, float p_radius, float p_spot_aperture) override;
+
 	virtual bool free(RID p_rid) override;
 
 	virtual void base_uniforms_changed() override;
@@ -348,7 +348,207 @@ void RendererCanvasRenderRD::free_polygon(PolygonID p_polygon) {
 
 ////////////////////
 
-void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size) {
+void RendererCanvasRenderRD::_batch_begin() {
+	batches.commands.clear();
+	batches.push_constants.clear();
+	batches.instances.clear();
+
+	batches.pipeline = RID();
+	for (int i = 0; i < 4; i++) {
+		batches.uniform_sets[i] = RID();
+	}
+	// Bound by _render_items before the commands are drawn.
+	batches.uniform_sets[TRANSFORMS_UNIFORM_SET] = state.default_transforms_uniform_set;
+	batches.index_array = RID();
+	batches.vertex_array = RID();
+	batches.blend_constants_set = false;
+
+	batches.open_draw = -1;
+}
+
+void RendererCanvasRenderRD::_batch_bind_pipeline(RID p_pipeline) {
+	if (batches.pipeline == p_pipeline) {
+		return;
+	}
+	batches.pipeline = p_pipeline;
+
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_BIND_PIPELINE;
+	command.rid = p_pipeline;
+	batches.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_batch_bind_uniform_set(RID p_uniform_set, uint32_t p_set) {
+	if (batches.uniform_sets[p_set] == p_uniform_set) {
+		return;
+	}
+	batches.uniform_sets[p_set] = p_uniform_set;
+
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_BIND_UNIFORM_SET;
+	command.rid = p_uniform_set;
+	command.index = p_set;
+	batches.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_batch_bind_index_array(RID p_index_array) {
+	if (batches.index_array == p_index_array) {
+		return;
+	}
+	batches.index_array = p_index_array;
+
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_BIND_INDEX_ARRAY;
+	command.rid = p_index_array;
+	batches.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_batch_bind_vertex_array(RID p_vertex_array) {
+	if (batches.vertex_array == p_vertex_array) {
+		return;
+	}
+	batches.vertex_array = p_vertex_array;
+
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_BIND_VERTEX_ARRAY;
+	command.rid = p_vertex_array;
+	batches.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_batch_set_blend_constants(const Color &p_color) {
+	if (batches.blend_constants_set && batches.blend_constants == p_color) {
+		return;
+	}
+	batches.blend_constants = p_color;
+	batches.blend_constants_set = true;
+
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_SET_BLEND_CONSTANTS;
+	command.data[0] = p_color.r;
+	command.data[1] = p_color.g;
+	command.data[2] = p_color.b;
+	command.data[3] = p_color.a;
+	batches.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_batch_set_push_constant(const PushConstant &p_push_constant) {
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_SET_PUSH_CONSTANT;
+	command.index = batches.push_constants.size();
+	batches.push_constants.push_back(p_push_constant);
+	batches.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_batch_draw(bool p_use_indices, uint32_t p_instances) {
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_DRAW;
+	command.use_indices = p_use_indices;
+	command.index = p_instances;
+	batches.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_batch_add_quad(const PushConstant &p_instance) {
+	// Any state change since the last quad was recorded as a command, so the batch is only
+	// still open if its draw is the last command.
+	if (batches.open_draw < 0 || batches.open_draw != int64_t(batches.commands.size()) - 1) {
+		DrawCommand offset;
+		offset.type = DrawCommand::TYPE_SET_BATCH_OFFSET;
+		offset.index = batches.instances.size();
+		batches.commands.push_back(offset);
+
+		_batch_bind_index_array(shader.quad_index_array);
+		_batch_draw(true, 0);
+		batches.open_draw = batches.commands.size() - 1;
+	}
+
+	batches.instances.push_back(p_instance);
+	batches.commands[batches.open_draw].index++;
+}
+
+void RendererCanvasRenderRD::_batch_enable_scissor(const Rect2 &p_rect) {
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_ENABLE_SCISSOR;
+	command.data[0] = p_rect.position.x;
+	command.data[1] = p_rect.position.y;
+	command.data[2] = p_rect.size.width;
+	command.data[3] = p_rect.size.height;
+	batches.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_batch_disable_scissor() {
+	DrawCommand command;
+	command.type = DrawCommand::TYPE_DISABLE_SCISSOR;
+	batches.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_batch_upload_instances(uint32_t &r_offset) {
+	uint64_t frame = RendererCompositorRD::singleton->get_frame_number();
+	if (state.instance_buffer_frame != frame) {
+		state.instance_buffer_frame = frame;
+		state.instance_buffer_used = 0;
+	}
+
+	uint32_t count = batches.instances.size();
+	if (state.instance_buffer_used + count > state.instance_buffer_size) {
+		// Draws recorded earlier in this frame keep the old buffer alive until the frame is done.
+		// Freeing it also frees the base uniform sets using it, these are recreated when needed.
+		RD::get_singleton()->free(state.instance_buffer);
+		state.instance_buffer_size = next_power_of_2(MAX(count, state.instance_buffer_size * 2));
+		state.instance_buffer = RD::get_singleton()->storage_buffer_create(state.instance_buffer_size * sizeof(PushConstant));
+		state.instance_buffer_used = 0;
+	}
+
+	r_offset = state.instance_buffer_used;
+	if (count) {
+		RD::get_singleton()->buffer_update(state.instance_buffer, r_offset * sizeof(PushConstant), count * sizeof(PushConstant), batches.instances.ptr());
+		state.instance_buffer_used += count;
+	}
+}
+
+void RendererCanvasRenderRD::_batch_draw_commands(RD::DrawListID p_draw_list, uint32_t p_instance_offset) {
+	RenderingDevice *rd = RD::get_singleton();
+
+	for (uint32_t i = 0; i < batches.commands.size(); i++) {
+		const DrawCommand &command = batches.commands[i];
+
+		switch (command.type) {
+			case DrawCommand::TYPE_BIND_PIPELINE: {
+				rd->draw_list_bind_render_pipeline(p_draw_list, command.rid);
+			} break;
+			case DrawCommand::TYPE_BIND_UNIFORM_SET: {
+				rd->draw_list_bind_uniform_set(p_draw_list, command.rid, command.index);
+			} break;
+			case DrawCommand::TYPE_BIND_INDEX_ARRAY: {
+				rd->draw_list_bind_index_array(p_draw_list, command.rid);
+			} break;
+			case DrawCommand::TYPE_BIND_VERTEX_ARRAY: {
+				rd->draw_list_bind_vertex_array(p_draw_list, command.rid);
+			} break;
+			case DrawCommand::TYPE_SET_BLEND_CONSTANTS: {
+				rd->draw_list_set_blend_constants(p_draw_list, Color(command.data[0], command.data[1], command.data[2], command.data[3]));
+			} break;
+			case DrawCommand::TYPE_SET_PUSH_CONSTANT: {
+				rd->draw_list_set_push_constant(p_draw_list, &batches.push_constants[command.index], sizeof(PushConstant));
+			} break;
+			case DrawCommand::TYPE_SET_BATCH_OFFSET: {
+				BatchPushConstant push_constant = {};
+				push_constant.instance_offset = p_instance_offset + command.index;
+				rd->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(BatchPushConstant));
+			} break;
+			case DrawCommand::TYPE_DRAW: {
+				rd->draw_list_draw(p_draw_list, command.use_indices, command.index);
+			} break;
+			case DrawCommand::TYPE_ENABLE_SCISSOR: {
+				rd->draw_list_enable_scissor(p_draw_list, Rect2(command.data[0], command.data[1], command.data[2], command.data[3]));
+			} break;
+			case DrawCommand::TYPE_DISABLE_SCISSOR: {
+				rd->draw_list_disable_scissor(p_draw_list);
+			} break;
+		}
+	}
+}
+
+void RendererCanvasRenderRD::_bind_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size) {
 	if (p_texture == RID()) {
 		p_texture = default_canvas_texture;
 	}
@@ -366,11 +566,11 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	bool success = RendererRD::TextureStorage::get_singleton()->canvas_texture_get_uniform_set(p_texture, p_base_filter, p_base_repeat, shader.default_version_rd_shader, CANVAS_TEXTURE_UNIFORM_SET, uniform_set, size, specular_shininess, use_normal, use_specular);
 	//something odd happened
 	if (!success) {
-		_bind_canvas_texture(p_draw_list, default_canvas_texture, p_base_filter, p_base_repeat, r_last_texture, push_constant, r_texpixel_size);
+		_bind_canvas_texture(default_canvas_texture, p_base_filter, p_base_repeat, r_last_texture, push_constant, r_texpixel_size);
 		return;
 	}
 
-	RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
+	_batch_bind_uniform_set(uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
 
 	if (specular_shininess.a < 0.999) {
 		push_constant.flags |= FLAGS_DEFAULT_SPECULAR_MAP_USED;
@@ -398,7 +598,7 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	r_last_texture = p_texture;
 }
 
-void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used) {
+void RendererCanvasRenderRD::_render_item(RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used) {
 	//create an empty push constant
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
 	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
@@ -496,16 +696,16 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				//bind pipeline
 				if (rect->flags & CANVAS_RECT_LCD) {
 					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD_LCD_BLEND].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
-					RD::get_singleton()->draw_list_set_blend_constants(p_draw_list, rect->modulate);
+					_batch_bind_pipeline(pipeline);
+					_batch_set_blend_constants(rect->modulate);
 				} else {
 					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_batch_bind_pipeline(pipeline);
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, rect->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(rect->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
 				Rect2 src_rect;
 				Rect2 dst_rect;
@@ -579,9 +779,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				push_constant.dst_rect[2] = dst_rect.size.width;
 				push_constant.dst_rect[3] = dst_rect.size.height;
 
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				_batch_add_quad(push_constant);
 
 			} break;
 
@@ -591,12 +789,12 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				//bind pipeline
 				{
 					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_NINEPATCH].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_batch_bind_pipeline(pipeline);
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, np->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(np->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
 				Rect2 src_rect;
 				Rect2 dst_rect(np->rect.position.x, np->rect.position.y, np->rect.size.x, np->rect.size.y);
@@ -643,9 +841,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				push_constant.ninepatch_margins[2] = np->margin[SIDE_RIGHT];
 				push_constant.ninepatch_margins[3] = np->margin[SIDE_BOTTOM];
 
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				_batch_add_quad(push_constant);
 
 				// Restore if overridden.
 				push_constant.color_texture_pixel_size[0] = texpixel_size.x;
@@ -662,7 +858,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					static const PipelineVariant variant[RS::PRIMITIVE_MAX] = { PIPELINE_VARIANT_ATTRIBUTE_POINTS, PIPELINE_VARIANT_ATTRIBUTE_LINES, PIPELINE_VARIANT_ATTRIBUTE_LINES_STRIP, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLES, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLE_STRIP };
 					ERR_CONTINUE(polygon->primitive < 0 || polygon->primitive >= RS::PRIMITIVE_MAX);
 					RID pipeline = pipeline_variants->variants[light_mode][variant[polygon->primitive]].get_render_pipeline(pb->vertex_format_id, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_batch_bind_pipeline(pipeline);
 				}
 
 				if (polygon->primitive == RS::PRIMITIVE_LINES) {
@@ -672,7 +868,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, polygon->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(polygon->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
 				push_constant.modulation[0] = base_color.r;
 				push_constant.modulation[1] = base_color.g;
@@ -685,12 +881,12 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					push_constant.ninepatch_margins[j] = 0;
 				}
 
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_vertex_array(p_draw_list, pb->vertex_array);
+				_batch_set_push_constant(push_constant);
+				_batch_bind_vertex_array(pb->vertex_array);
 				if (pb->indices.is_valid()) {
-					RD::get_singleton()->draw_list_bind_index_array(p_draw_list, pb->indices);
+					_batch_bind_index_array(pb->indices);
 				}
-				RD::get_singleton()->draw_list_draw(p_draw_list, pb->indices.is_valid());
+				_batch_draw(pb->indices.is_valid());
 
 			} break;
 			case Item::Command::TYPE_PRIMITIVE: {
@@ -701,14 +897,14 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					static const PipelineVariant variant[4] = { PIPELINE_VARIANT_PRIMITIVE_POINTS, PIPELINE_VARIANT_PRIMITIVE_LINES, PIPELINE_VARIANT_PRIMITIVE_TRIANGLES, PIPELINE_VARIANT_PRIMITIVE_TRIANGLES };
 					ERR_CONTINUE(primitive->point_count == 0 || primitive->point_count > 4);
 					RID pipeline = pipeline_variants->variants[light_mode][variant[primitive->point_count - 1]].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_batch_bind_pipeline(pipeline);
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, primitive->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(primitive->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, primitive_arrays.index_array[MIN(3u, primitive->point_count) - 1]);
+				_batch_bind_index_array(primitive_arrays.index_array[MIN(3u, primitive->point_count) - 1]);
 
 				for (uint32_t j = 0; j < MIN(3u, primitive->point_count); j++) {
 					push_constant.points[j * 2 + 0] = primitive->points[j].x;
@@ -719,8 +915,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					push_constant.colors[j * 2 + 0] = (uint32_t(Math::make_half_float(col.g)) << 16) | Math::make_half_float(col.r);
 					push_constant.colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
 				}
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				_batch_set_push_constant(push_constant);
+				_batch_draw(true);
 
 				if (primitive->point_count == 4) {
 					for (uint32_t j = 1; j < 3; j++) {
@@ -734,8 +930,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 						push_constant.colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
 					}
 
-					RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-					RD::get_singleton()->draw_list_draw(p_draw_list, true);
+					_batch_set_push_constant(push_constant);
+					_batch_draw(true);
 				}
 
 			} break;
@@ -777,7 +973,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					}
 
 					RID uniform_set = mesh_storage->multimesh_get_2d_uniform_set(multimesh, shader.default_version_rd_shader, TRANSFORMS_UNIFORM_SET);
-					RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, TRANSFORMS_UNIFORM_SET);
+					_batch_bind_uniform_set(uniform_set, TRANSFORMS_UNIFORM_SET);
 					push_constant.flags |= 1; //multimesh, trails disabled
 					if (mesh_storage->multimesh_uses_colors(multimesh)) {
 						push_constant.flags |= FLAGS_INSTANCING_HAS_COLORS;
@@ -804,7 +1000,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					instance_count = particles_storage->particles_get_amount(pt->particles, divisor);
 
 					RID uniform_set = particles_storage->particles_get_instance_buffer_uniform_set(pt->particles, shader.default_version_rd_shader, TRANSFORMS_UNIFORM_SET);
-					RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, TRANSFORMS_UNIFORM_SET);
+					_batch_bind_uniform_set(uniform_set, TRANSFORMS_UNIFORM_SET);
 
 					push_constant.flags |= divisor;
 					instance_count /= divisor;
@@ -842,7 +1038,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					break;
 				}
 
-				_bind_canvas_texture(p_draw_list, texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
 				uint32_t surf_count = mesh_storage->mesh_get_surface_count(mesh);
 				static const PipelineVariant variant[RS::PRIMITIVE_MAX] = { PIPELINE_VARIANT_ATTRIBUTE_POINTS, PIPELINE_VARIANT_ATTRIBUTE_LINES, PIPELINE_VARIANT_ATTRIBUTE_LINES_STRIP, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLES, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLE_STRIP };
@@ -876,18 +1072,18 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					}
 
 					RID pipeline = pipeline_variants->variants[light_mode][variant[primitive]].get_render_pipeline(vertex_format, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_batch_bind_pipeline(pipeline);
 
 					RID index_array = mesh_storage->mesh_surface_get_index_array(surface, 0);
 
 					if (index_array.is_valid()) {
-						RD::get_singleton()->draw_list_bind_index_array(p_draw_list, index_array);
+						_batch_bind_index_array(index_array);
 					}
 
-					RD::get_singleton()->draw_list_bind_vertex_array(p_draw_list, vertex_array);
-					RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
+					_batch_bind_vertex_array(vertex_array);
+					_batch_set_push_constant(push_constant);
 
-					RD::get_singleton()->draw_list_draw(p_draw_list, index_array.is_valid(), instance_count);
+					_batch_draw(index_array.is_valid(), instance_count);
 				}
 
 				for (int j = 0; j < 6; j++) {
@@ -905,10 +1101,10 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				if (current_clip) {
 					if (ci->ignore != reclip) {
 						if (ci->ignore) {
-							RD::get_singleton()->draw_list_disable_scissor(p_draw_list);
+							_batch_disable_scissor();
 							reclip = true;
 						} else {
-							RD::get_singleton()->draw_list_enable_scissor(p_draw_list, current_clip->final_clip_rect);
+							_batch_enable_scissor(current_clip->final_clip_rect);
 							reclip = false;
 						}
 					}
@@ -1038,6 +1234,14 @@ RID RendererCanvasRenderRD::_create_base_uniform_set(RID p_to_render_target, boo
 		uniforms.push_back(u);
 	}
 
+	{
+		RD::Uniform u;
+		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+		u.binding = 10;
+		u.append_id(state.instance_buffer);
+		uniforms.push_back(u);
+	}
+
 	RID uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shader.default_version_rd_shader, BASE_UNIFORM_SET);
 	if (p_backbuffer) {
 		texture_storage->render_target_set_backbuffer_uniform_set(p_to_render_target, uniform_set);
@@ -1076,16 +1280,9 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		fb_uniform_set = texture_storage->render_target_get_framebuffer_uniform_set(p_to_render_target);
 	}
 
-	if (fb_uniform_set.is_null() || !RD::get_singleton()->uniform_set_is_valid(fb_uniform_set)) {
-		fb_uniform_set = _create_base_uniform_set(p_to_render_target, p_to_backbuffer);
-	}
-
 	RD::FramebufferFormatID fb_format = RD::get_singleton()->framebuffer_get_format(framebuffer);
 
-	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, clear ? RD::INITIAL_ACTION_CLEAR : RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_DISCARD, clear_colors);
-
-	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, fb_uniform_set, BASE_UNIFORM_SET);
-	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, state.default_transforms_uniform_set, TRANSFORMS_UNIFORM_SET);
+	_batch_begin();
 
 	RID prev_material;
 
@@ -1099,10 +1296,10 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 
 			//setup clip
 			if (current_clip) {
-				RD::get_singleton()->draw_list_enable_scissor(draw_list, current_clip->final_clip_rect);
+				_batch_enable_scissor(current_clip->final_clip_rect);
 
 			} else {
-				RD::get_singleton()->draw_list_disable_scissor(draw_list);
+				_batch_disable_scissor();
 			}
 		}
 
@@ -1135,7 +1332,7 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 					pipeline_variants = &material_data->shader_data->pipeline_variants;
 					// Update uniform set.
 					if (material_data->uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(material_data->uniform_set)) { // Material may not have a uniform set.
-						RD::get_singleton()->draw_list_bind_uniform_set(draw_list, material_data->uniform_set, MATERIAL_UNIFORM_SET);
+						_batch_bind_uniform_set(material_data->uniform_set, MATERIAL_UNIFORM_SET);
 					}
 				} else {
 					pipeline_variants = &shader.pipeline_variants;
@@ -1145,11 +1342,26 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 			}
 		}
 
-		_render_item(draw_list, p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used);
+		_render_item(p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used);
 
 		prev_material = material;
 	}
 
+	// Buffers can't be updated while a draw list is being created, so upload first.
+	uint32_t instance_offset = 0;
+	_batch_upload_instances(instance_offset);
+
+	if (fb_uniform_set.is_null() || !RD::get_singleton()->uniform_set_is_valid(fb_uniform_set)) {
+		fb_uniform_set = _create_base_uniform_set(p_to_render_target, p_to_backbuffer);
+	}
+
+	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, clear ? RD::INITIAL_ACTION_CLEAR : RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_DISCARD, clear_colors);
+
+	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, fb_uniform_set, BASE_UNIFORM_SET);
+	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, state.default_transforms_uniform_set, TRANSFORMS_UNIFORM_SET);
+
+	_batch_draw_commands(draw_list, instance_offset);
+
 	RD::get_singleton()->draw_list_end();
 }
 
@@ -1594,6 +1806,11 @@ void RendererCanvasRenderRD::_update_shadow_atlas() {
 		}
 
 		state.shadow_fb = RD::get_singleton()->framebuffer_create(fb_textures);
+
+		state.shadow_row_hashes.resize(state.max_lights_per_render);
+		for (uint32_t i = 0; i < state.shadow_row_hashes.size(); i++) {
+			state.shadow_row_hashes[i] = 0;
+		}
 	}
 }
 void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index, const Transform2D &p_light_xform, int p_light_mask, float p_near, float p_far, LightOccluderInstance *p_occluders) {
@@ -1604,6 +1821,45 @@ void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index,
 
 	cl->shadow.z_far = p_far;
 	cl->shadow.y_offset = float(p_shadow_index * 2 + 1) / float(state.max_lights_per_render * 2);
+
+	// Only occluders within the light range can cast a shadow, and only those need to be unchanged to reuse the row.
+	Rect2 light_rect(-p_far, -p_far, p_far * 2.0, p_far * 2.0);
+	uint32_t h = hash_murmur3_one_64(p_rid.get_id());
+	h = hash_murmur3_one_32(p_light_mask, h);
+	h = hash_murmur3_one_float(p_near, h);
+	h = hash_murmur3_one_float(p_far, h);
+	for (int i = 0; i < 3; i++) {
+		h = hash_murmur3_one_real(p_light_xform.columns[i].x, h);
+		h = hash_murmur3_one_real(p_light_xform.columns[i].y, h);
+	}
+
+	state.shadow_occluders.clear();
+	for (LightOccluderInstance *instance = p_occluders; instance; instance = instance->next) {
+		OccluderPolygon *co = occluder_polygon_owner.get_or_null(instance->occluder);
+		if (!co || co->index_array.is_null() || !(p_light_mask & instance->light_mask)) {
+			continue;
+		}
+
+		Transform2D modelview = p_light_xform * instance->xform_cache;
+		if (!light_rect.intersects(modelview.xform(instance->aabb_cache))) {
+			continue;
+		}
+
+		state.shadow_occluders.push_back(instance);
+		h = hash_murmur3_one_64(co->vertex_array.get_id(), h); // Recreated when the polygon changes.
+		h = hash_murmur3_one_32(co->cull_mode, h);
+		for (int i = 0; i < 3; i++) {
+			h = hash_murmur3_one_real(modelview.columns[i].x, h);
+			h = hash_murmur3_one_real(modelview.columns[i].y, h);
+		}
+	}
+	h = MAX(hash_fmix32(h), 1u);
+
+	if (state.shadow_row_hashes[p_shadow_index] == h) {
+		return;
+	}
+	state.shadow_row_hashes[p_shadow_index] = h;
+
 	Vector<Color> cc;
 	cc.push_back(Color(p_far, p_far, p_far, 1.0));
 
@@ -1646,16 +1902,10 @@ void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index,
 		push_constant.z_far = p_far;
 		push_constant.pad = 0;
 
-		LightOccluderInstance *instance = p_occluders;
-
-		while (instance) {
+		for (uint32_t j = 0; j < state.shadow_occluders.size(); j++) {
+			LightOccluderInstance *instance = state.shadow_occluders[j];
 			OccluderPolygon *co = occluder_polygon_owner.get_or_null(instance->occluder);
 
-			if (!co || co->index_array.is_null() || !(p_light_mask & instance->light_mask)) {
-				instance = instance->next;
-				continue;
-			}
-
 			_update_transform_2d_to_mat2x4(p_light_xform * instance->xform_cache, push_constant.modelview);
 
 			RD::get_singleton()->draw_list_bind_render_pipeline(draw_list, shadow_render.render_pipelines[co->cull_mode]);
@@ -1664,8 +1914,6 @@ void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index,
 			RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(ShadowRenderPushConstant));
 
 			RD::get_singleton()->draw_list_draw(draw_list, true);
-
-			instance = instance->next;
 		}
 
 		RD::get_singleton()->draw_list_end();
@@ -1690,6 +1938,7 @@ void RendererCanvasRenderRD::light_update_directional_shadow(RID p_rid, int p_sh
 
 	cl->shadow.z_far = distance;
 	cl->shadow.y_offset = float(p_shadow_index * 2 + 1) / float(state.max_lights_per_render * 2);
+	state.shadow_row_hashes[p_shadow_index] = 0; // Directional shadows are always rendered.
 
 	Transform2D to_light_xform;
 
@@ -2558,7 +2807,7 @@ RendererCanvasRenderRD::RendererCanvasRenderRD() {
 		actions.base_uniform_string = "material.";
 		actions.default_filter = ShaderLanguage::FILTER_LINEAR;
 		actions.default_repeat = ShaderLanguage::REPEAT_DISABLE;
-		actions.base_varying_index = 4;
+		actions.base_varying_index = 5;
 
 		actions.global_buffer_array_variable = "global_shader_uniforms.data";
 
@@ -2639,6 +2888,9 @@ RendererCanvasRenderRD::RendererCanvasRenderRD() {
 		state.canvas_state_buffer = RD::get_singleton()->uniform_buffer_create(sizeof(State::Buffer));
 		state.lights_uniform_buffer = RD::get_singleton()->uniform_buffer_create(sizeof(LightUniform) * state.max_lights_per_render);
 
+		state.instance_buffer_size = DEFAULT_INSTANCE_BUFFER_SIZE;
+		state.instance_buffer = RD::get_singleton()->storage_buffer_create(state.instance_buffer_size * sizeof(PushConstant));
+
 		RD::SamplerState shadow_sampler_state;
 		shadow_sampler_state.mag_filter = RD::SAMPLER_FILTER_LINEAR;
 		shadow_sampler_state.min_filter = RD::SAMPLER_FILTER_LINEAR;
@@ -2821,6 +3073,7 @@ RendererCanvasRenderRD::~RendererCanvasRenderRD() {
 
 		memdelete_arr(state.light_uniforms);
 		RD::get_singleton()->free(state.lights_uniform_buffer);
+		RD::get_singleton()->free(state.instance_buffer);
 	}
 
 	//shadow rendering
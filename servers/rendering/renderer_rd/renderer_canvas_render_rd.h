@@ -31,6 +31,7 @@
 #ifndef RENDERER_CANVAS_RENDER_RD_H
 #define RENDERER_CANVAS_RENDER_RD_H
 
+#include "core/templates/local_vector.h"
 #include "servers/rendering/renderer_canvas_render.h"
 #include "servers/rendering/renderer_compositor.h"
 #include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
@@ -105,7 +106,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		MAX_RENDER_ITEMS = 256 * 1024,
 		MAX_LIGHT_TEXTURES = 1024,
 		MAX_LIGHTS_PER_ITEM = 16,
-		DEFAULT_MAX_LIGHTS_PER_RENDER = 256
+		DEFAULT_MAX_LIGHTS_PER_RENDER = 256,
+		DEFAULT_INSTANCE_BUFFER_SIZE = 4096
 	};
 
 	/****************/
@@ -369,11 +371,22 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		RID shadow_fb;
 		int shadow_texture_size = 2048;
 
+		// Hash of the light and occluders last rendered to each row of the shadow texture, 0 if unknown.
+		// Rows whose hash matches are not rendered again, so static lights don't redraw static occluders.
+		LocalVector<uint32_t> shadow_row_hashes;
+		LocalVector<LightOccluderInstance *> shadow_occluders;
+
 		RID default_transforms_uniform_set;
 
 		uint32_t max_lights_per_render;
 		uint32_t max_lights_per_item;
 
+		// Quad instances for the current frame, rects and nine-patches are read from here.
+		RID instance_buffer;
+		uint32_t instance_buffer_size = 0;
+		uint32_t instance_buffer_used = 0;
+		uint64_t instance_buffer_frame = 0;
+
 		double time;
 
 	} state;
@@ -405,6 +418,70 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		uint32_t lights[4];
 	};
 
+	static_assert(sizeof(PushConstant) == 128, "PushConstant must match the InstanceData and BatchData sizes in canvas_uniforms_inc.glsl.");
+
+	struct BatchPushConstant {
+		uint32_t instance_offset;
+		uint32_t pad[31];
+	};
+
+	/*****************/
+	/**** BATCHES ****/
+	/*****************/
+
+	// Items are recorded before the draw list begins so the quad instances can be uploaded
+	// first, consecutive quads that share all draw state are merged into one instanced draw.
+
+	struct DrawCommand {
+		enum Type : uint8_t {
+			TYPE_BIND_PIPELINE,
+			TYPE_BIND_UNIFORM_SET,
+			TYPE_BIND_INDEX_ARRAY,
+			TYPE_BIND_VERTEX_ARRAY,
+			TYPE_SET_BLEND_CONSTANTS,
+			TYPE_SET_PUSH_CONSTANT,
+			TYPE_SET_BATCH_OFFSET,
+			TYPE_DRAW,
+			TYPE_ENABLE_SCISSOR,
+			TYPE_DISABLE_SCISSOR,
+		};
+
+		Type type;
+		bool use_indices = false;
+		uint32_t index = 0; // Uniform set, push constant, batch offset or instance count.
+		RID rid;
+		float data[4] = {}; // Blend constants or scissor rect.
+	};
+
+	struct Batches {
+		LocalVector<DrawCommand> commands;
+		LocalVector<PushConstant> push_constants;
+		LocalVector<PushConstant> instances;
+
+		RID pipeline;
+		RID uniform_sets[4];
+		RID index_array;
+		RID vertex_array;
+		Color blend_constants;
+		bool blend_constants_set = false;
+
+		int64_t open_draw = -1; // Quad draw that can still take instances, if it is the last command.
+	} batches;
+
+	void _batch_begin();
+	void _batch_bind_pipeline(RID p_pipeline);
+	void _batch_bind_uniform_set(RID p_uniform_set, uint32_t p_set);
+	void _batch_bind_index_array(RID p_index_array);
+	void _batch_bind_vertex_array(RID p_vertex_array);
+	void _batch_set_blend_constants(const Color &p_color);
+	void _batch_set_push_constant(const PushConstant &p_push_constant);
+	void _batch_draw(bool p_use_indices, uint32_t p_instances = 1);
+	void _batch_add_quad(const PushConstant &p_instance);
+	void _batch_enable_scissor(const Rect2 &p_rect);
+	void _batch_disable_scissor();
+	void _batch_upload_instances(uint32_t &r_offset);
+	void _batch_draw_commands(RD::DrawListID p_draw_list, uint32_t p_instance_offset);
+
 	Item *items[MAX_RENDER_ITEMS];
 
 	bool using_directional_lights = false;
@@ -420,8 +497,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 	RID _create_base_uniform_set(RID p_to_render_target, bool p_backbuffer);
 
-	inline void _bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size); //recursive, so regular inline used instead.
-	void _render_item(RenderingDevice::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RenderingDevice::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used);
+	inline void _bind_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size); //recursive, so regular inline used instead.
+	void _render_item(RID p_render_target, const Item *p_item, RenderingDevice::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used);
 	void _render_items(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer = false);
 
 	_FORCE_INLINE_ void _update_transform_2d_to_mat2x4(const Transform2D &p_transform, float *p_mat2x4);
@@ -99,6 +99,10 @@ void RendererCompositorRD::begin_frame(double frame_step) {
 
 	canvas->set_time(time);
 	scene->set_time(time, frame_step);
+
+	// Act on the mipmap and LOD feedback gathered while rendering the previous frame.
+	texture_storage->update_texture_streaming();
+	mesh_storage->update_mesh_streaming();
 }
 
 void RendererCompositorRD::end_frame(bool p_swap_buffers) {
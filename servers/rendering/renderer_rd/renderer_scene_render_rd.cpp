@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/os/os.h"
 #include "renderer_compositor_rd.h"
+#include "servers/rendering/renderer_rd/effects/taa.h"
 #include "servers/rendering/renderer_rd/environment/fog.h"
 #include "servers/rendering/renderer_rd/storage_rd/material_storage.h"
 #include "servers/rendering/renderer_rd/storage_rd/texture_storage.h"
@@ -668,6 +669,13 @@ void RendererSceneRenderRD::_render_buffers_post_process_and_tonemap(const Rende
 		tonemap.use_debanding = rb->get_use_debanding();
 		tonemap.texture_size = Vector2i(rb->get_internal_size().x, rb->get_internal_size().y);
 
+		// TAA already reconstructed our image at the target size, tonemap that instead.
+		RID taa_upscaled_texture = can_use_effects ? RendererRD::TAA::get_upscaled_texture(rb) : RID();
+		if (taa_upscaled_texture.is_valid()) {
+			internal_texture = taa_upscaled_texture;
+			tonemap.texture_size = Vector2i(target_size.x, target_size.y);
+		}
+
 		if (p_render_data->environment.is_valid()) {
 			tonemap.tonemap_mode = environment_get_tone_mapper(p_render_data->environment);
 			tonemap.white = environment_get_white(p_render_data->environment);
@@ -694,10 +702,10 @@ void RendererSceneRenderRD::_render_buffers_post_process_and_tonemap(const Rende
 		tonemap.view_count = rb->get_view_count();
 
 		RID dest_fb;
-		if (fsr && can_use_effects && (internal_size.x != target_size.x || internal_size.y != target_size.y)) {
+		if (fsr && can_use_effects && taa_upscaled_texture.is_null() && (internal_size.x != target_size.x || internal_size.y != target_size.y)) {
 			// If we use FSR to upscale we need to write our result into an intermediate buffer.
 			// Note that this is cached so we only create the texture the first time.
-			RID dest_texture = rb->create_texture(SNAME("Tonemapper"), SNAME("destination"), _render_buffers_get_color_format(), RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_STORAGE_BIT | RD::TEXTURE_USAGE_COLOR_ATTACHMENT_BIT);
+			RID dest_texture = rb->create_texture(SNAME("Tonemapper"), SNAME("destination"), _render_buffers_get_color_format(), RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_STORAGE_BIT | RD::TEXTURE_USAGE_COLOR_ATTACHMENT_BIT, RD::TEXTURE_SAMPLES_1, Size2i(), 0, 1, false);
 			dest_fb = FramebufferCacheRD::get_singleton()->get_cache(dest_texture);
 		} else {
 			// If we do a bilinear upscale we just render into our render target and our shader will upscale automatically.
@@ -711,7 +719,7 @@ void RendererSceneRenderRD::_render_buffers_post_process_and_tonemap(const Rende
 		RD::get_singleton()->draw_command_end_label();
 	}
 
-	if (fsr && can_use_effects && (internal_size.x != target_size.x || internal_size.y != target_size.y)) {
+	if (fsr && can_use_effects && !RendererRD::TAA::uses_upscale(rb) && (internal_size.x != target_size.x || internal_size.y != target_size.y)) {
 		// TODO Investigate? Does this work? We never write into our render target and we've already done so up above in our tonemapper.
 		// I think FSR should either work before our tonemapper or as an alternative of our tonemapper.
 
@@ -1005,6 +1013,24 @@ bool RendererSceneRenderRD::is_using_radiance_cubemap_array() const {
 	return sky.sky_use_cubemap_array;
 }
 
+void RendererSceneRenderRD::_texture_stream_feedback(const RenderDataRD *p_render_data, const LocalVector<RID> &p_textures, const AABB &p_aabb, float p_depth) {
+	if (p_render_data->render_buffers.is_null() || p_render_data->scene_data->lod_distance_multiplier <= 0.0) {
+		return;
+	}
+
+	// Approximate the on-screen size of the instance from its bounds, the same way mesh LOD does,
+	// and assume its textures are mapped once across it.
+	float z_near = p_render_data->scene_data->cam_projection.get_z_near();
+	float distance = p_render_data->scene_data->cam_orthogonal ? 1.0 : MAX(p_depth + z_near, z_near);
+	float screen_fraction = p_aabb.get_longest_axis_size() / (distance * p_render_data->scene_data->lod_distance_multiplier);
+	uint32_t size = uint32_t(MIN(screen_fraction * p_render_data->render_buffers->get_internal_size().x, 16384.0f));
+
+	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
+	for (uint32_t i = 0; i < p_textures.size(); i++) {
+		texture_storage->texture_stream_feedback(p_textures[i], size);
+	}
+}
+
 void RendererSceneRenderRD::_update_vrs(Ref<RenderSceneBuffersRD> p_render_buffers) {
 	if (p_render_buffers.is_valid() && vrs) {
 		RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
@@ -1169,6 +1195,22 @@ void RendererSceneRenderRD::render_scene(const Ref<RenderSceneBuffers> &p_render
 
 	//calls _pre_opaque_render between depth pre-pass and opaque pass
 	_render_scene(&render_data, clear_color);
+
+	if (hiz_occlusion && rb.is_valid() && p_reflection_probe.is_null() && scene_data.view_count == 1 && rb->get_msaa_3d() == RS::VIEWPORT_MSAA_DISABLED) {
+		// Depth of this frame is used to occlusion cull the next ones.
+		hiz_occlusion->update(rb, scene_data.cam_transform, scene_data.cam_projection);
+	}
+}
+
+const RendererSceneOcclusionCull::HZBuffer *RendererSceneRenderRD::render_buffers_get_occlusion_buffer(const Ref<RenderSceneBuffers> &p_render_buffers, Transform3D &r_cam_transform, Projection &r_cam_projection) {
+	if (!hiz_occlusion || p_render_buffers.is_null()) {
+		return nullptr;
+	}
+
+	Ref<RenderSceneBuffersRD> rb = p_render_buffers;
+	ERR_FAIL_COND_V(rb.is_null(), nullptr);
+
+	return hiz_occlusion->get_occlusion_buffer(rb, r_cam_transform, r_cam_projection);
 }
 
 void RendererSceneRenderRD::render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) {
@@ -1412,6 +1454,7 @@ void RendererSceneRenderRD::init() {
 
 	environment_set_volumetric_fog_volume_size(GLOBAL_GET("rendering/environment/volumetric_fog/volume_size"), GLOBAL_GET("rendering/environment/volumetric_fog/volume_depth"));
 	environment_set_volumetric_fog_filter_active(GLOBAL_GET("rendering/environment/volumetric_fog/use_filter"));
+	volumetric_fog_interleaved_updates = GLOBAL_GET("rendering/environment/volumetric_fog/interleaved_updates");
 
 	decals_set_filter(RS::DecalFilter(int(GLOBAL_GET("rendering/textures/decals/filter"))));
 	light_projectors_set_filter(RS::LightProjectorFilter(int(GLOBAL_GET("rendering/textures/light_projectors/filter"))));
@@ -1429,6 +1472,9 @@ void RendererSceneRenderRD::init() {
 	if (can_use_storage) {
 		fsr = memnew(RendererRD::FSR);
 	}
+	if (can_use_storage && GLOBAL_GET("rendering/occlusion_culling/gpu_hiz/enabled")) {
+		hiz_occlusion = memnew(RendererRD::HiZOcclusion);
+	}
 }
 
 RendererSceneRenderRD::~RendererSceneRenderRD() {
@@ -1451,6 +1497,9 @@ RendererSceneRenderRD::~RendererSceneRenderRD() {
 	if (fsr) {
 		memdelete(fsr);
 	}
+	if (hiz_occlusion) {
+		memdelete(hiz_occlusion);
+	}
 
 	if (sky.sky_scene_state.uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(sky.sky_scene_state.uniform_set)) {
 		RD::get_singleton()->free(sky.sky_scene_state.uniform_set);
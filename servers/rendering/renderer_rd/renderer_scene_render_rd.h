@@ -38,6 +38,7 @@
 #include "servers/rendering/renderer_rd/effects/bokeh_dof.h"
 #include "servers/rendering/renderer_rd/effects/copy_effects.h"
 #include "servers/rendering/renderer_rd/effects/fsr.h"
+#include "servers/rendering/renderer_rd/effects/hiz_occlusion.h"
 #include "servers/rendering/renderer_rd/effects/tone_mapper.h"
 #include "servers/rendering/renderer_rd/effects/vrs.h"
 #include "servers/rendering/renderer_rd/environment/fog.h"
@@ -108,6 +109,7 @@ protected:
 	RendererRD::ToneMapper *tone_mapper = nullptr;
 	RendererRD::FSR *fsr = nullptr;
 	RendererRD::VRS *vrs = nullptr;
+	RendererRD::HiZOcclusion *hiz_occlusion = nullptr;
 	double time = 0.0;
 	double time_step = 0.0;
 
@@ -123,6 +125,7 @@ protected:
 	virtual RendererRD::ForwardIDStorage *create_forward_id_storage() { return memnew(RendererRD::ForwardIDStorage); };
 
 	void _update_vrs(Ref<RenderSceneBuffersRD> p_render_buffers);
+	void _texture_stream_feedback(const RenderDataRD *p_render_data, const LocalVector<RID> &p_textures, const AABB &p_aabb, float p_depth);
 
 	virtual void setup_render_buffer_data(Ref<RenderSceneBuffersRD> p_render_buffers) = 0;
 
@@ -200,6 +203,7 @@ private:
 	uint32_t volumetric_fog_size = 128;
 	uint32_t volumetric_fog_depth = 128;
 	bool volumetric_fog_filter_active = true;
+	bool volumetric_fog_interleaved_updates = false;
 
 public:
 	static RendererSceneRenderRD *get_singleton() { return singleton; }
@@ -263,6 +267,7 @@ public:
 	uint32_t get_volumetric_fog_size() const { return volumetric_fog_size; }
 	uint32_t get_volumetric_fog_depth() const { return volumetric_fog_depth; }
 	bool get_volumetric_fog_filter_active() const { return volumetric_fog_filter_active; }
+	bool get_volumetric_fog_interleaved_updates() const { return volumetric_fog_interleaved_updates; }
 
 	virtual RID fog_volume_instance_create(RID p_fog_volume) override;
 	virtual void fog_volume_instance_set_transform(RID p_fog_volume_instance, const Transform3D &p_transform) override;
@@ -284,6 +289,7 @@ public:
 	virtual RD::DataFormat _render_buffers_get_color_format();
 	virtual bool _render_buffers_can_be_storage();
 	virtual Ref<RenderSceneBuffers> render_buffers_create() override;
+	virtual const RendererSceneOcclusionCull::HZBuffer *render_buffers_get_occlusion_buffer(const Ref<RenderSceneBuffers> &p_render_buffers, Transform3D &r_cam_transform, Projection &r_cam_projection) override;
 	virtual void gi_set_use_half_resolution(bool p_enable) override;
 
 	RID render_buffers_get_default_voxel_gi_buffer();
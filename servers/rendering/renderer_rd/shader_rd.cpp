@@ -143,10 +143,16 @@ RID ShaderRD::version_create() {
 }
 
 void ShaderRD::_clear_version(Version *p_version) {
+	if (p_version->compiling) {
+		// Results are discarded, but the variants must not be written to after this.
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(p_version->compile_group);
+		p_version->compiling = false;
+	}
+
 	//clear versions if they exist
 	if (p_version->variants) {
 		for (int i = 0; i < variant_defines.size(); i++) {
-			if (variants_enabled[i]) {
+			if (variants_enabled[i] && p_version->variants[i].is_valid()) {
 				RD::get_singleton()->free(p_version->variants[i]);
 			}
 		}
@@ -475,16 +481,26 @@ void ShaderRD::_compile_version(Version *p_version) {
 		}
 	}
 
-#if 1
+	// Asynchronous compilation runs at low priority, so it doesn't take over the threads the frame needs.
+	p_version->compile_group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderRD::_compile_variant, p_version, variant_defines.size(), -1, !async_compilation, SNAME("ShaderCompilation"));
+	p_version->compiling = true;
 
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderRD::_compile_variant, p_version, variant_defines.size(), -1, true, SNAME("ShaderCompilation"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	if (!async_compilation) {
+		_finish_compile_version(p_version, true);
+	}
+}
 
-#else
-	for (int i = 0; i < variant_defines.size(); i++) {
-		_compile_variant(i, p_version);
+bool ShaderRD::_finish_compile_version(Version *p_version, bool p_wait) {
+	if (!p_version->compiling) {
+		return true;
 	}
-#endif
+
+	if (!p_wait && !WorkerThreadPool::get_singleton()->is_group_task_completed(p_version->compile_group)) {
+		return false;
+	}
+
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(p_version->compile_group);
+	p_version->compiling = false;
 
 	bool all_valid = true;
 	for (int i = 0; i < variant_defines.size(); i++) {
@@ -513,7 +529,7 @@ void ShaderRD::_compile_version(Version *p_version) {
 		}
 		p_version->variants = nullptr;
 		p_version->variant_data = nullptr;
-		return;
+		return true;
 	} else if (shader_cache_dir_valid) {
 		//save shader cache
 		_save_to_cache(p_version);
@@ -523,6 +539,7 @@ void ShaderRD::_compile_version(Version *p_version) {
 	p_version->variant_data = nullptr;
 
 	p_version->valid = true;
+	return true;
 }
 
 void ShaderRD::version_set_code(RID p_version, const HashMap<String, String> &p_code, const String &p_uniforms, const String &p_vertex_globals, const String &p_fragment_globals, const Vector<String> &p_custom_defines) {
@@ -584,9 +601,22 @@ bool ShaderRD::version_is_valid(RID p_version) {
 		_compile_version(version);
 	}
 
+	_finish_compile_version(version, true);
+
 	return version->valid;
 }
 
+bool ShaderRD::version_is_compiling(RID p_version) {
+	Version *version = version_owner.get_or_null(p_version);
+	ERR_FAIL_COND_V(!version, false);
+
+	if (version->dirty) {
+		_compile_version(version);
+	}
+
+	return !_finish_compile_version(version, false);
+}
+
 bool ShaderRD::version_free(RID p_version) {
 	if (version_owner.owns(p_version)) {
 		Version *version = version_owner.get_or_null(p_version);
@@ -610,6 +640,14 @@ bool ShaderRD::is_variant_enabled(int p_variant) const {
 	return variants_enabled[p_variant];
 }
 
+void ShaderRD::set_async_compilation(bool p_enable) {
+	async_compilation = p_enable;
+}
+
+bool ShaderRD::is_async_compilation_enabled() const {
+	return async_compilation;
+}
+
 bool ShaderRD::shader_cache_cleanup_on_start = false;
 
 ShaderRD::ShaderRD() {
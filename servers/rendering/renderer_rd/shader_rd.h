@@ -31,6 +31,7 @@
 #ifndef SHADER_RD_H
 #define SHADER_RD_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 #include "core/string/string_builder.h"
 #include "core/templates/hash_map.h"
@@ -60,14 +61,19 @@ class ShaderRD {
 		bool valid;
 		bool dirty;
 		bool initialize_needed;
+		bool compiling = false;
+		WorkerThreadPool::GroupID compile_group = -1;
 	};
 
 	Mutex variant_set_mutex;
 
+	bool async_compilation = false;
+
 	void _compile_variant(uint32_t p_variant, Version *p_version);
 
 	void _clear_version(Version *p_version);
 	void _compile_version(Version *p_version);
+	bool _finish_compile_version(Version *p_version, bool p_wait);
 
 	RID_Owner<Version> version_owner;
 
@@ -143,6 +149,10 @@ public:
 			_compile_version(version);
 		}
 
+		if (version->compiling && !_finish_compile_version(version, false)) {
+			return RID();
+		}
+
 		if (!version->valid) {
 			return RID();
 		}
@@ -151,12 +161,18 @@ public:
 	}
 
 	bool version_is_valid(RID p_version);
+	bool version_is_compiling(RID p_version);
 
 	bool version_free(RID p_version);
 
 	void set_variant_enabled(int p_variant, bool p_enabled);
 	bool is_variant_enabled(int p_variant) const;
 
+	// When enabled, versions compile on the WorkerThreadPool without blocking.
+	// version_get_shader() returns an empty RID until the compilation is done.
+	void set_async_compilation(bool p_enable);
+	bool is_async_compilation_enabled() const;
+
 	static void set_shader_cache_dir(const String &p_dir);
 	static void set_shader_cache_save_compressed(bool p_enable);
 	static void set_shader_cache_save_compressed_zstd(bool p_enable);
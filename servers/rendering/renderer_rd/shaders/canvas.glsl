@@ -26,6 +26,10 @@ layout(location = 3) out vec2 pixel_size_interp;
 
 #endif
 
+#ifdef USE_INSTANCE_BUFFER
+layout(location = 4) flat out uint instance_index_interp;
+#endif
+
 #ifdef MATERIAL_UNIFORMS_USED
 layout(set = 1, binding = 0, std140) uniform MaterialUniforms{
 
@@ -37,6 +41,11 @@ layout(set = 1, binding = 0, std140) uniform MaterialUniforms{
 #GLOBALS
 
 void main() {
+#ifdef USE_INSTANCE_BUFFER
+	instance_index_interp = uint(gl_InstanceIndex);
+	draw_data = instances.data[batch_data.instance_offset + instance_index_interp];
+#endif
+
 	vec4 instance_custom = vec4(0.0);
 #ifdef USE_PRIMITIVE
 
@@ -221,6 +230,10 @@ layout(location = 3) in vec2 pixel_size_interp;
 
 #endif
 
+#ifdef USE_INSTANCE_BUFFER
+layout(location = 4) flat in uint instance_index_interp;
+#endif
+
 layout(location = 0) out vec4 frag_color;
 
 #ifdef MATERIAL_UNIFORMS_USED
@@ -428,6 +441,11 @@ float msdf_median(float r, float g, float b, float a) {
 }
 
 void main() {
+#ifdef USE_INSTANCE_BUFFER
+	// Also reads the push constant here, so its range covers both stages in every variant.
+	draw_data = instances.data[batch_data.instance_offset + instance_index_interp];
+#endif
+
 	vec4 color = color_interp;
 	vec2 uv = uv_interp;
 	vec2 vertex = vertex_interp;
@@ -40,8 +40,41 @@
 #define SAMPLER_NEAREST_WITH_MIPMAPS_ANISOTROPIC_REPEAT 10
 #define SAMPLER_LINEAR_WITH_MIPMAPS_ANISOTROPIC_REPEAT 11
 
+#if !defined(USE_PRIMITIVE) && !defined(USE_ATTRIBUTES)
+// Rects and nine-patches are batched, their draw data comes from the instance buffer.
+#define USE_INSTANCE_BUFFER
+#endif
+
+struct InstanceData {
+	vec2 world_x;
+	vec2 world_y;
+	vec2 world_ofs;
+	uint flags;
+	uint specular_shininess;
+	vec4 modulation;
+	vec4 ninepatch_margins;
+	vec4 dst_rect; //for built-in rect and UV
+	vec4 src_rect;
+	vec2 pad;
+	vec2 color_texture_pixel_size;
+	uint lights[4];
+};
+
 // Push Constant
 
+#ifdef USE_INSTANCE_BUFFER
+
+// Must match the size of DrawData, so all variants share the same pipeline layout.
+layout(push_constant, std430) uniform BatchData {
+	uint instance_offset;
+	uint pad[31];
+}
+batch_data;
+
+InstanceData draw_data;
+
+#else
+
 layout(push_constant, std430) uniform DrawData {
 	vec2 world_x;
 	vec2 world_y;
@@ -65,6 +98,8 @@ layout(push_constant, std430) uniform DrawData {
 }
 draw_data;
 
+#endif
+
 // In vulkan, sets should always be ordered using the following logic:
 // Lower Sets: Sets that change format and layout less often
 // Higher sets: Sets that change format and layout very often
@@ -144,6 +179,11 @@ layout(set = 0, binding = 9, std430) restrict readonly buffer GlobalShaderUnifor
 }
 global_shader_uniforms;
 
+layout(set = 0, binding = 10, std430) restrict readonly buffer InstanceBuffer {
+	InstanceData data[];
+}
+instances;
+
 /* SET1: Is reserved for the material */
 
 //
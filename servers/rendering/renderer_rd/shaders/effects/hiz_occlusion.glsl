@@ -0,0 +1,47 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+layout(set = 0, binding = 0) uniform sampler2D source_depth;
+
+layout(set = 1, binding = 0, std430) restrict writeonly buffer DestDepth {
+	float data[];
+}
+dest_depth;
+
+layout(push_constant, std430) uniform Params {
+	vec4 inv_projection_z; // Rows of the inverse projection needed to linearize depth.
+	vec4 inv_projection_w;
+	ivec2 source_size;
+	ivec2 dest_size;
+}
+params;
+
+void main() {
+	// Hi-Z texel being computed
+	ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+	if (any(greaterThanEqual(pos, params.dest_size))) { //too large, do nothing
+		return;
+	}
+
+	ivec2 from = (pos * params.source_size) / params.dest_size;
+	ivec2 to = max(((pos + ivec2(1)) * params.source_size) / params.dest_size, from + ivec2(1));
+
+	// Keep the farthest depth of the block, so the result stays conservative.
+	float max_depth = 0.0;
+	for (int y = from.y; y < to.y; y++) {
+		for (int x = from.x; x < to.x; x++) {
+			float depth = texelFetch(source_depth, ivec2(x, y), 0).r;
+			vec4 ndc = vec4((vec2(x, y) + 0.5) / vec2(params.source_size) * 2.0 - 1.0, depth, 1.0);
+			float linear_depth = -dot(params.inv_projection_z, ndc) / dot(params.inv_projection_w, ndc);
+			max_depth = max(max_depth, linear_depth);
+		}
+	}
+
+	// The depth buffer is rendered with a flipped Y, while the Hi-Z buffer starts at the bottom of the screen.
+	dest_depth.data[(params.dest_size.y - 1 - pos.y) * params.dest_size.x + pos.x] = max_depth;
+}
@@ -30,11 +30,14 @@
 #VERSION_DEFINES
 
 // Based on Spartan Engine's TAA implementation (without TAA upscale).
+// MODE_TAA_UPSCALE extends it to reconstruct at a higher output resolution.
 // <https://github.com/PanosK92/SpartanEngine/blob/a8338d0609b85dc32f3732a5c27fb4463816a3b9/Data/shaders/temporal_antialiasing.hlsl>
 
-#ifndef MOLTENVK_USED
+#if !defined(MOLTENVK_USED) && !defined(MODE_TAA_UPSCALE)
+// The shared memory tile is laid out in input pixels, which no longer map 1:1
+// to invocations when upscaling.
 #define USE_SUBGROUPS
-#endif // MOLTENVK_USED
+#endif
 
 #define GROUP_SIZE 8
 #define FLT_MIN 0.00000001
@@ -42,7 +45,7 @@
 #define RPC_9 0.11111111111
 #define RPC_16 0.0625
 
-#ifdef USE_SUBGROUPS
+#if defined(USE_SUBGROUPS) || (defined(MODE_TAA_UPSCALE) && !defined(MOLTENVK_USED))
 layout(local_size_x = GROUP_SIZE, local_size_y = GROUP_SIZE, local_size_z = 1) in;
 #endif
 
@@ -57,6 +60,8 @@ layout(push_constant, std430) uniform Params {
 	vec2 resolution;
 	float disocclusion_threshold; // 0.1 / max(params.resolution.x, params.resolution.y
 	float disocclusion_scale;
+	vec2 output_resolution; // Equal to resolution unless upscaling.
+	vec2 jitter; // Projection jitter of the current frame, in NDC.
 }
 params;
 
@@ -326,7 +331,7 @@ vec3 temporal_antialiasing(uvec2 pos_group_top_left, uvec2 pos_group, uvec2 pos_
 	vec3 color_input = load_color(pos_group);
 
 	// Get history color (catmull-rom reduces a lot of the blurring that you get under motion)
-	vec3 color_history = sample_catmull_rom_9(tex_history, uv_reprojected, params.resolution).rgb;
+	vec3 color_history = sample_catmull_rom_9(tex_history, uv_reprojected, params.output_resolution).rgb;
 
 	// Clip history to the neighbourhood of the current sample (fixes a lot of the ghosting).
 	vec2 velocity_closest = vec2(0.0); // This is best done by using the velocity with the closest depth.
@@ -342,6 +347,14 @@ vec3 temporal_antialiasing(uvec2 pos_group_top_left, uvec2 pos_group, uvec2 pos_
 		// Increase blend factor when there is disocclusion (fixes a lot of the remaining ghosting).
 		float factor_disocclusion = get_factor_disocclusion(uv_reprojected, velocity);
 
+#ifdef MODE_TAA_UPSCALE
+		// Weigh the input sample by how close its jittered center landed to this output pixel,
+		// so that over the jitter sequence each output pixel accumulates its own subpixel detail.
+		vec2 sample_uv = (vec2(pos_screen) + 0.5) / params.resolution - params.jitter * vec2(0.5, -0.5); // NDC Y points up, UV Y points down.
+		vec2 sample_offset = (sample_uv - uv) * params.output_resolution;
+		blend_factor *= exp(-2.29 * dot(sample_offset, sample_offset));
+#endif
+
 		// Add to the blend factor
 		blend_factor = clamp(blend_factor + factor_screen + factor_disocclusion, 0.0, 1.0);
 	}
@@ -377,10 +390,18 @@ void main() {
 #endif
 
 	// Out of bounds check
-	if (any(greaterThanEqual(vec2(gl_GlobalInvocationID.xy), params.resolution))) {
+	if (any(greaterThanEqual(vec2(gl_GlobalInvocationID.xy), params.output_resolution))) {
 		return;
 	}
 
+#ifdef MODE_TAA_UPSCALE
+	// One invocation per output pixel, reading the input pixel that covers it.
+	const vec2 uv = (gl_GlobalInvocationID.xy + 0.5f) / params.output_resolution;
+	const uvec2 pos_screen = uvec2(clamp(ivec2(uv * params.resolution), ivec2(0), ivec2(params.resolution) - 1));
+	const uvec2 pos_group = pos_screen;
+	const uvec2 pos_group_top_left = uvec2(0, 0);
+#else
+
 #ifdef USE_SUBGROUPS
 	const uvec2 pos_group = gl_LocalInvocationID.xy;
 	const uvec2 pos_group_top_left = gl_WorkGroupID.xy * kGroupSize - kBorderSize;
@@ -390,6 +411,7 @@ void main() {
 #endif
 	const uvec2 pos_screen = gl_GlobalInvocationID.xy;
 	const vec2 uv = (gl_GlobalInvocationID.xy + 0.5f) / params.resolution;
+#endif
 
 	vec3 result = temporal_antialiasing(pos_group_top_left, pos_group, pos_screen, uv, history_buffer);
 	imageStore(output_buffer, ivec2(gl_GlobalInvocationID.xy), vec4(result, 1.0));
@@ -185,6 +185,11 @@ layout(set = 0, binding = 14, std140) uniform Params {
 	mat4 to_prev_view;
 
 	mat3 radiance_inverse_xform;
+
+	bool use_interleaved_updates;
+	uint pad1;
+	uint pad2;
+	uint pad3;
 }
 params;
 #ifndef MODE_COPY
@@ -345,6 +350,21 @@ void main() {
 			view_pos.xy = (fog_unit_pos.xy * 2.0 - 1.0) * mix(params.fog_frustum_size_begin, params.fog_frustum_size_end, vec2(fog_unit_pos.z));
 			view_pos.z = -params.fog_frustum_end * fog_unit_pos.z;
 			view_pos.y = -view_pos.y;
+
+			if (params.use_interleaved_updates && ((pos.x + pos.y + pos.z + int(params.temporal_frame)) & 1) != 0) {
+				// Checkerboard update, this froxel reuses its reprojected value and is lit again next frame.
+				imageStore(density_map, pos, reprojected_density);
+#ifdef MOLTENVK_USED
+				density_only_map[lpos] = 0;
+				light_only_map[lpos] = 0;
+				emissive_only_map[lpos] = 0;
+#else
+				imageStore(density_only_map, pos, uvec4(0));
+				imageStore(light_only_map, pos, uvec4(0));
+				imageStore(emissive_only_map, pos, uvec4(0));
+#endif
+				return;
+			}
 		}
 	}
 
@@ -472,6 +472,8 @@ layout(constant_id = 10) const bool sc_disable_spot_lights = false;
 layout(constant_id = 11) const bool sc_disable_reflection_probes = false;
 layout(constant_id = 12) const bool sc_disable_directional_lights = false;
 
+layout(constant_id = 16) const bool sc_use_light_tiles = false;
+
 #endif //!MODE_UNSHADED
 
 layout(constant_id = 7) const bool sc_decal_use_mipmaps = true;
@@ -1549,16 +1551,38 @@ void main() {
 
 	if (!sc_disable_omni_lights) { //omni lights
 		uint light_indices = draw_call.omni_lights.x;
-		for (uint i = 0; i < 8; i++) {
-			uint light_index = light_indices & 0xFF;
-			if (i == 4) {
-				light_indices = draw_call.omni_lights.y;
+		uvec2 tile_lights = uvec2(0);
+		if (sc_use_light_tiles) {
+			tile_lights = texelFetch(usampler2D(light_tiles, material_samplers[SAMPLER_NEAREST_CLAMP]), ivec2(gl_FragCoord.xy) / LIGHT_TILE_SIZE, 0).xy;
+		}
+		uint light_count = sc_use_light_tiles ? 64u : 8u;
+		for (uint i = 0; i < light_count; i++) {
+			uint light_index;
+			if (sc_use_light_tiles) {
+				if (tile_lights.x != 0) {
+					light_index = uint(findLSB(tile_lights.x));
+					tile_lights.x &= tile_lights.x - 1;
+				} else if (tile_lights.y != 0) {
+					light_index = 32 + uint(findLSB(tile_lights.y));
+					tile_lights.y &= tile_lights.y - 1;
+				} else {
+					break;
+				}
+
+				if (!bool(omni_lights.data[light_index].mask & draw_call.layer_mask)) {
+					continue; //not masked
+				}
 			} else {
-				light_indices = light_indices >> 8;
-			}
+				light_index = light_indices & 0xFF;
+				if (i == 4) {
+					light_indices = draw_call.omni_lights.y;
+				} else {
+					light_indices = light_indices >> 8;
+				}
 
-			if (light_index == 0xFF) {
-				break;
+				if (light_index == 0xFF) {
+					break;
+				}
 			}
 
 			float shadow = light_process_omni_shadow(light_index, vertex, normal);
@@ -1594,16 +1618,38 @@ void main() {
 	if (!sc_disable_spot_lights) { //spot lights
 
 		uint light_indices = draw_call.spot_lights.x;
-		for (uint i = 0; i < 8; i++) {
-			uint light_index = light_indices & 0xFF;
-			if (i == 4) {
-				light_indices = draw_call.spot_lights.y;
+		uvec2 tile_lights = uvec2(0);
+		if (sc_use_light_tiles) {
+			tile_lights = texelFetch(usampler2D(light_tiles, material_samplers[SAMPLER_NEAREST_CLAMP]), ivec2(gl_FragCoord.xy) / LIGHT_TILE_SIZE, 0).zw;
+		}
+		uint light_count = sc_use_light_tiles ? 64u : 8u;
+		for (uint i = 0; i < light_count; i++) {
+			uint light_index;
+			if (sc_use_light_tiles) {
+				if (tile_lights.x != 0) {
+					light_index = uint(findLSB(tile_lights.x));
+					tile_lights.x &= tile_lights.x - 1;
+				} else if (tile_lights.y != 0) {
+					light_index = 32 + uint(findLSB(tile_lights.y));
+					tile_lights.y &= tile_lights.y - 1;
+				} else {
+					break;
+				}
+
+				if (!bool(spot_lights.data[light_index].mask & draw_call.layer_mask)) {
+					continue; //not masked
+				}
 			} else {
-				light_indices = light_indices >> 8;
-			}
+				light_index = light_indices & 0xFF;
+				if (i == 4) {
+					light_indices = draw_call.spot_lights.y;
+				} else {
+					light_indices = light_indices >> 8;
+				}
 
-			if (light_index == 0xFF) {
-				break;
+				if (light_index == 0xFF) {
+					break;
+				}
 			}
 
 			float shadow = light_process_spot_shadow(light_index, vertex, normal);
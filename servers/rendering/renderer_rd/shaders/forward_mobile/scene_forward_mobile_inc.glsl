@@ -157,6 +157,9 @@ layout(set = 1, binding = 6) uniform texture2DArray lightmap_textures[MAX_LIGHTM
 layout(set = 1, binding = 9) uniform highp texture2D depth_buffer;
 layout(set = 1, binding = 10) uniform mediump texture2D color_buffer;
 
+// Bitmasks of the omni (xy) and spot (zw) lights touching each LIGHT_TILE_SIZE screen tile.
+layout(set = 1, binding = 11) uniform highp utexture2D light_tiles;
+
 /* Set 2 Skeleton & Instancing (can change per item) */
 
 layout(set = 2, binding = 0, std430) restrict readonly buffer Transforms {
@@ -0,0 +1,80 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+layout(set = 0, binding = 0, std430) buffer restrict readonly SrcInstances {
+	vec4 data[];
+}
+src_instances;
+
+layout(set = 0, binding = 1, std430) buffer restrict writeonly DstInstances {
+	vec4 data[];
+}
+dst_instances;
+
+layout(set = 0, binding = 2, std430) buffer restrict DrawCommands {
+	uint visible_instances;
+	uint command_count;
+	uint pad[2];
+	uint data[]; // Indirect draw commands, five uints each with the instance count in the second one.
+}
+draw_commands;
+
+#define DRAW_COMMAND_SIZE 5
+
+layout(push_constant, std430) uniform Params {
+	vec4 planes[6]; // Frustum planes in multimesh space, normal and distance, facing out.
+	vec4 sphere; // Mesh bounding sphere, center and radius.
+
+	uint instance_count;
+	uint stride; // In vec4s.
+	uint plane_count;
+	uint pad;
+}
+params;
+
+void main() {
+#ifdef MODE_CULL
+
+	uint instance = gl_GlobalInvocationID.x;
+	if (instance >= params.instance_count) {
+		return;
+	}
+
+	uint src_offset = instance * params.stride;
+
+	// The transform is stored as the three rows of a 3x4 matrix.
+	mat4 xform = transpose(mat4(src_instances.data[src_offset + 0], src_instances.data[src_offset + 1], src_instances.data[src_offset + 2], vec4(0.0, 0.0, 0.0, 1.0)));
+
+	vec3 center = (xform * vec4(params.sphere.xyz, 1.0)).xyz;
+	float scale = max(length(xform[0].xyz), max(length(xform[1].xyz), length(xform[2].xyz)));
+	float radius = params.sphere.w * scale;
+
+	for (uint i = 0; i < params.plane_count; i++) {
+		if (dot(params.planes[i].xyz, center) - params.planes[i].w > radius) {
+			return;
+		}
+	}
+
+	uint dst_offset = atomicAdd(draw_commands.visible_instances, 1) * params.stride;
+	for (uint i = 0; i < params.stride; i++) {
+		dst_instances.data[dst_offset + i] = src_instances.data[src_offset + i];
+	}
+
+#endif
+
+#ifdef MODE_WRITE_COMMANDS
+
+	uint command = gl_GlobalInvocationID.x;
+	if (command >= draw_commands.command_count) {
+		return;
+	}
+
+	draw_commands.data[command * DRAW_COMMAND_SIZE + 1] = draw_commands.visible_instances;
+
+#endif
+}
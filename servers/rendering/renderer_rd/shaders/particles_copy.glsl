@@ -38,6 +38,17 @@ layout(set = 1, binding = 0, std430) restrict buffer SortBuffer {
 }
 sort_buffer;
 
+layout(set = 3, binding = 0, std430) restrict buffer DrawCommands {
+	uint active_particles;
+	uint command_count;
+	uint pad[2];
+	uint data[]; // Indirect draw commands, five uints each with the instance count in the second one.
+}
+draw_commands;
+
+#define DRAW_COMMAND_SIZE 5
+#define SORT_KEY_INACTIVE 1e30 // Sorts inactive particles to the end of the buffer, after the active ones.
+
 #endif // USE_SORT_BUFFER
 
 layout(set = 2, binding = 0, std430) restrict readonly buffer TrailBindPoses {
@@ -85,12 +96,29 @@ void main() {
 	}
 	sort_buffer.data[particle].x = dot(params.sort_direction, particles.data[src_particle].xform[3].xyz);
 	sort_buffer.data[particle].y = float(particle);
+
+	if (params.trail_size == 1) {
+		if (bool(particles.data[src_particle].flags & PARTICLE_FLAG_ACTIVE) || bool(particles.data[src_particle].flags & PARTICLE_FLAG_TRAILED)) {
+			atomicAdd(draw_commands.active_particles, 1);
+		} else {
+			sort_buffer.data[particle].x = SORT_KEY_INACTIVE;
+		}
+	}
 #endif
 
 #ifdef MODE_FILL_INSTANCES
 
 	uint particle = gl_GlobalInvocationID.x;
 
+#ifdef USE_SORT_BUFFER
+	if (particle == 0) {
+		// Only the active particles, which the sort moved to the front of the instances, get drawn.
+		for (uint i = 0; i < draw_commands.command_count; i++) {
+			draw_commands.data[i * DRAW_COMMAND_SIZE + 1] = draw_commands.active_particles;
+		}
+	}
+#endif
+
 	if (particle >= params.total_particles) {
 		return; //discard
 	}
@@ -1919,8 +1919,12 @@ void LightStorage::lightmap_instance_set_transform(RID p_lightmap, const Transfo
 
 /* SHADOW ATLAS API */
 
-RID LightStorage::shadow_atlas_create() {
-	return shadow_atlas_owner.make_rid(ShadowAtlas());
+RID LightStorage::shadow_atlas_allocate() {
+	return shadow_atlas_owner.allocate_rid();
+}
+
+void LightStorage::shadow_atlas_initialize(RID p_rid) {
+	shadow_atlas_owner.initialize_rid(p_rid, ShadowAtlas());
 }
 
 void LightStorage::shadow_atlas_free(RID p_atlas) {
@@ -1934,7 +1938,7 @@ void LightStorage::_update_shadow_atlas(ShadowAtlas *shadow_atlas) {
 		tf.format = shadow_atlas->use_16_bits ? RD::DATA_FORMAT_D16_UNORM : RD::DATA_FORMAT_D32_SFLOAT;
 		tf.width = shadow_atlas->size;
 		tf.height = shadow_atlas->size;
-		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
 
 		shadow_atlas->depth = RD::get_singleton()->texture_create(tf, RD::TextureView());
 		Vector<RID> fb_tex;
@@ -1943,6 +1947,21 @@ void LightStorage::_update_shadow_atlas(ShadowAtlas *shadow_atlas) {
 	}
 }
 
+void LightStorage::_update_shadow_atlas_static(ShadowAtlas *shadow_atlas) {
+	if (shadow_atlas->size > 0 && shadow_atlas->static_depth.is_null()) {
+		RD::TextureFormat tf;
+		tf.format = shadow_atlas->use_16_bits ? RD::DATA_FORMAT_D16_UNORM : RD::DATA_FORMAT_D32_SFLOAT;
+		tf.width = shadow_atlas->size;
+		tf.height = shadow_atlas->size;
+		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT;
+
+		shadow_atlas->static_depth = RD::get_singleton()->texture_create(tf, RD::TextureView());
+		Vector<RID> fb_tex;
+		fb_tex.push_back(shadow_atlas->static_depth);
+		shadow_atlas->static_fb = RD::get_singleton()->framebuffer_create(fb_tex);
+	}
+}
+
 void LightStorage::shadow_atlas_set_size(RID p_atlas, int p_size, bool p_16_bits) {
 	ShadowAtlas *shadow_atlas = shadow_atlas_owner.get_or_null(p_atlas);
 	ERR_FAIL_COND(!shadow_atlas);
@@ -1958,6 +1977,10 @@ void LightStorage::shadow_atlas_set_size(RID p_atlas, int p_size, bool p_16_bits
 		RD::get_singleton()->free(shadow_atlas->depth);
 		shadow_atlas->depth = RID();
 	}
+	if (shadow_atlas->static_depth.is_valid()) {
+		RD::get_singleton()->free(shadow_atlas->static_depth);
+		shadow_atlas->static_depth = RID();
+	}
 	for (int i = 0; i < 4; i++) {
 		//clear subdivisions
 		shadow_atlas->quadrants[i].shadows.clear();
@@ -1969,6 +1992,7 @@ void LightStorage::shadow_atlas_set_size(RID p_atlas, int p_size, bool p_16_bits
 		LightInstance *li = light_instance_owner.get_or_null(E.key);
 		ERR_CONTINUE(!li);
 		li->shadow_atlases.erase(p_atlas);
+		li->static_shadows.erase(p_atlas);
 	}
 
 	//clear owners
@@ -2004,6 +2028,7 @@ void LightStorage::shadow_atlas_set_quadrant_subdivision(RID p_atlas, int p_quad
 			LightInstance *li = light_instance_owner.get_or_null(shadow_atlas->quadrants[p_quadrant].shadows[i].owner);
 			ERR_CONTINUE(!li);
 			li->shadow_atlases.erase(p_atlas);
+			li->static_shadows.erase(p_atlas);
 		}
 	}
 
@@ -2309,7 +2334,42 @@ void LightStorage::_shadow_atlas_invalidate_shadow(ShadowAtlas::Quadrant::Shadow
 		p_shadow->version = 0;
 		p_shadow->owner = RID();
 		sli->shadow_atlases.erase(p_atlas);
+		sli->static_shadows.erase(p_atlas);
+	}
+}
+
+bool LightStorage::shadow_atlas_update_static_shadow(RID p_atlas, RID p_light_instance, int p_pass, uint64_t p_static_version) {
+	ShadowAtlas *shadow_atlas = shadow_atlas_owner.get_or_null(p_atlas);
+	ERR_FAIL_COND_V(!shadow_atlas, false);
+	LightInstance *li = light_instance_owner.get_or_null(p_light_instance);
+	ERR_FAIL_COND_V(!li, false);
+	ERR_FAIL_INDEX_V(p_pass, 2, false);
+	ERR_FAIL_COND_V(!shadow_atlas->shadow_owners.has(p_light_instance), false);
+
+	_update_shadow_atlas_static(shadow_atlas);
+
+	uint32_t key = shadow_atlas->shadow_owners[p_light_instance];
+	uint32_t quadrant = (key >> QUADRANT_SHIFT) & 0x3;
+	uint32_t shadow = key & SHADOW_INDEX_MASK;
+	ERR_FAIL_COND_V(shadow >= (uint32_t)shadow_atlas->quadrants[quadrant].shadows.size(), false);
+	uint64_t alloc_tick = shadow_atlas->quadrants[quadrant].shadows[shadow].alloc_tick;
+
+	LightInstance::StaticShadow &static_shadow = li->static_shadows[p_atlas];
+	if (static_shadow.static_depth != shadow_atlas->static_depth || static_shadow.key != key || static_shadow.alloc_tick != alloc_tick) {
+		// The light moved to another place in the atlas (or the atlas was recreated), nothing cached is valid.
+		static_shadow.static_depth = shadow_atlas->static_depth;
+		static_shadow.key = key;
+		static_shadow.alloc_tick = alloc_tick;
+		static_shadow.version[0] = 0;
+		static_shadow.version[1] = 0;
 	}
+
+	if (static_shadow.version[p_pass] == p_static_version) {
+		return false;
+	}
+
+	static_shadow.version[p_pass] = p_static_version;
+	return true;
 }
 
 void LightStorage::shadow_atlas_update(RID p_atlas) {
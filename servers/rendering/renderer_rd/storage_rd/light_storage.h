@@ -125,6 +125,15 @@ private:
 
 		HashSet<RID> shadow_atlases; //shadow atlases where this light is registered
 
+		struct StaticShadow {
+			RID static_depth; // static atlas texture the casters were rendered into
+			uint32_t key = SHADOW_INVALID;
+			uint64_t alloc_tick = 0;
+			uint64_t version[2] = {};
+		};
+
+		HashMap<RID, StaticShadow> static_shadows; //static shadow cache state, per shadow atlas
+
 		ForwardID forward_id = -1;
 
 		LightInstance() {}
@@ -397,12 +406,16 @@ private:
 		RID depth;
 		RID fb; //for copying
 
+		RID static_depth; //only casters that did not change, copied to depth before drawing the rest
+		RID static_fb;
+
 		HashMap<RID, uint32_t> shadow_owners;
 	};
 
-	RID_Owner<ShadowAtlas> shadow_atlas_owner;
+	RID_Owner<ShadowAtlas, true> shadow_atlas_owner;
 
 	void _update_shadow_atlas(ShadowAtlas *shadow_atlas);
+	void _update_shadow_atlas_static(ShadowAtlas *shadow_atlas);
 
 	void _shadow_atlas_invalidate_shadow(ShadowAtlas::Quadrant::Shadow *p_shadow, RID p_atlas, ShadowAtlas *p_shadow_atlas, uint32_t p_quadrant, uint32_t p_shadow_idx);
 	bool _shadow_atlas_find_shadow(ShadowAtlas *shadow_atlas, int *p_in_quadrants, int p_quadrant_count, int p_current_subdiv, uint64_t p_tick, int &r_quadrant, int &r_shadow);
@@ -994,7 +1007,8 @@ public:
 
 	bool owns_shadow_atlas(RID p_rid) { return shadow_atlas_owner.owns(p_rid); };
 
-	virtual RID shadow_atlas_create() override;
+	virtual RID shadow_atlas_allocate() override;
+	virtual void shadow_atlas_initialize(RID p_rid) override;
 	virtual void shadow_atlas_free(RID p_atlas) override;
 
 	virtual void shadow_atlas_set_size(RID p_atlas, int p_size, bool p_16_bits = true) override;
@@ -1043,6 +1057,20 @@ public:
 		return atlas->fb;
 	}
 
+	_FORCE_INLINE_ RID shadow_atlas_get_static_texture(RID p_atlas) {
+		ShadowAtlas *atlas = shadow_atlas_owner.get_or_null(p_atlas);
+		ERR_FAIL_COND_V(!atlas, RID());
+		return atlas->static_depth;
+	}
+
+	_FORCE_INLINE_ RID shadow_atlas_get_static_fb(RID p_atlas) {
+		ShadowAtlas *atlas = shadow_atlas_owner.get_or_null(p_atlas);
+		ERR_FAIL_COND_V(!atlas, RID());
+		return atlas->static_fb;
+	}
+
+	bool shadow_atlas_update_static_shadow(RID p_atlas, RID p_light_instance, int p_pass, uint64_t p_static_version);
+
 	virtual void shadow_atlas_update(RID p_atlas) override;
 
 	/* DIRECTIONAL SHADOW */
@@ -1053,6 +1053,7 @@ void MaterialStorage::MaterialData::update_textures(const HashMap<StringName, Va
 
 	bool uses_global_textures = false;
 	global_textures_pass++;
+	streamed_textures.clear();
 
 	for (int i = 0, k = 0; i < p_texture_uniforms.size(); i++) {
 		const StringName &uniform_name = p_texture_uniforms[i].name;
@@ -1206,6 +1207,9 @@ void MaterialStorage::MaterialData::update_textures(const HashMap<StringName, Va
 
 				if (tex) {
 					rd_texture = (srgb && tex->rd_texture_srgb.is_valid()) ? tex->rd_texture_srgb : tex->rd_texture;
+					if (texture_storage->texture_is_streamed(textures[j])) {
+						streamed_textures.push_back(textures[j]);
+					}
 #ifdef TOOLS_ENABLED
 					if (tex->detect_3d_callback && p_use_linear_color) {
 						tex->detect_3d_callback(tex->detect_3d_callback_ud);
@@ -2332,11 +2336,10 @@ RID MaterialStorage::shader_allocate() {
 }
 
 void MaterialStorage::shader_initialize(RID p_rid) {
-	Shader shader;
-	shader.data = nullptr;
-	shader.type = SHADER_TYPE_MAX;
-
-	shader_owner.initialize_rid(p_rid, shader);
+	shader_owner.initialize_rid(p_rid);
+	Shader *shader = shader_owner.get_or_null(p_rid);
+	shader->data = nullptr;
+	shader->type = SHADER_TYPE_MAX;
 }
 
 void MaterialStorage::shader_free(RID p_rid) {
@@ -2423,6 +2426,11 @@ void MaterialStorage::shader_set_code(RID p_shader, const String &p_code) {
 	if (shader->data) {
 		shader->data->set_path_hint(shader->path_hint);
 		shader->data->set_code(p_code);
+
+		if (!shader->data->poll_compilation() && !shader->compile_element.in_list()) {
+			// Materials are notified again once compilation finishes.
+			shader_compile_list.add(&shader->compile_element);
+		}
 	}
 
 	for (Material *E : shader->owners) {
@@ -2543,6 +2551,20 @@ void MaterialStorage::_material_queue_update(Material *material, bool p_uniform,
 }
 
 void MaterialStorage::_update_queued_materials() {
+	SelfList<Shader> *shader_element = shader_compile_list.first();
+	while (shader_element) {
+		SelfList<Shader> *next = shader_element->next();
+		Shader *shader = shader_element->self();
+		if (!shader->data || shader->data->poll_compilation()) {
+			shader_compile_list.remove(shader_element);
+			for (Material *material : shader->owners) {
+				material->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_MATERIAL);
+				_material_queue_update(material, true, true);
+			}
+		}
+		shader_element = next;
+	}
+
 	while (material_update_list.first()) {
 		Material *material = material_update_list.first()->self();
 		bool uniforms_changed = false;
@@ -65,6 +65,8 @@ public:
 		virtual bool casts_shadows() const = 0;
 		virtual Variant get_default_parameter(const StringName &p_parameter) const = 0;
 		virtual RS::ShaderNativeSourceCode get_native_source_code() const { return RS::ShaderNativeSourceCode(); }
+		// Returns false while the shader is still being compiled in the background.
+		virtual bool poll_compilation() { return true; }
 
 		virtual ~ShaderData() {}
 	};
@@ -78,6 +80,9 @@ public:
 		virtual bool update_parameters(const HashMap<StringName, Variant> &p_parameters, bool p_uniform_dirty, bool p_textures_dirty) = 0;
 		virtual ~MaterialData();
 
+		// Textures with a stream callback, which need mipmap feedback when this material is drawn.
+		LocalVector<RID> streamed_textures;
+
 		//to be used internally by update_parameters, in the most common configuration of material parameters
 		bool update_parameters_uniform_set(const HashMap<StringName, Variant> &p_parameters, bool p_uniform_dirty, bool p_textures_dirty, const HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> &p_uniforms, const uint32_t *p_uniform_offsets, const Vector<ShaderCompiler::GeneratedCode::Texture> &p_texture_uniforms, const HashMap<StringName, HashMap<int, RID>> &p_default_texture_params, uint32_t p_ubo_size, RID &uniform_set, RID p_shader, uint32_t p_shader_uniform_set, bool p_use_linear_color, uint32_t p_barrier = RD::BARRIER_MASK_ALL_BARRIERS);
 		void free_parameters_uniform_set(RID p_uniform_set);
@@ -185,6 +190,10 @@ private:
 		ShaderType type;
 		HashMap<StringName, HashMap<int, RID>> default_texture_parameter;
 		HashSet<Material *> owners;
+		SelfList<Shader> compile_element;
+
+		Shader() :
+				compile_element(this) {}
 	};
 
 	typedef ShaderData *(*ShaderDataRequestFunction)();
@@ -222,6 +231,7 @@ private:
 	Material *get_material(RID p_rid) { return material_owner.get_or_null(p_rid); };
 
 	SelfList<Material>::List material_update_list;
+	SelfList<Shader>::List shader_compile_list;
 
 	static void _material_uniform_set_erased(void *p_material);
 
@@ -30,6 +30,7 @@
 
 #include "mesh_storage.h"
 #include "../../rendering_server_globals.h"
+#include "core/config/project_settings.h"
 
 using namespace RendererRD;
 
@@ -42,6 +43,14 @@ MeshStorage *MeshStorage::get_singleton() {
 MeshStorage::MeshStorage() {
 	singleton = this;
 
+	mesh_stream_enabled = GLOBAL_GET("rendering/mesh_lod/streaming/enabled");
+	mesh_stream_memory_budget = uint64_t(MAX(0, int(GLOBAL_GET("rendering/mesh_lod/streaming/memory_budget_mb")))) * 1024 * 1024;
+	skinning_share_identical_poses = GLOBAL_GET("rendering/skinning/share_identical_poses");
+	mesh_clusters_enabled = GLOBAL_GET("rendering/mesh_clusters/enabled");
+	mesh_clusters_min_triangles = MAX(0, int(GLOBAL_GET("rendering/mesh_clusters/min_triangles")));
+	multimesh_gpu_culling_enabled = GLOBAL_GET("rendering/multimesh/gpu_culling/enabled");
+	multimesh_gpu_culling_min_instances = MAX(int(MULTIMESH_CULL_MIN_INSTANCES), int(GLOBAL_GET("rendering/multimesh/gpu_culling/min_instances")));
+
 	default_rd_storage_buffer = RD::get_singleton()->storage_buffer_create(sizeof(uint32_t) * 4);
 
 	//default rd buffers
@@ -182,6 +191,19 @@ MeshStorage::MeshStorage() {
 			skeleton_shader.default_skeleton_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, skeleton_shader.version_shader[0], SkeletonShader::UNIFORM_SET_SKELETON);
 		}
 	}
+
+	{
+		Vector<String> multimesh_cull_modes;
+		multimesh_cull_modes.push_back("\n#define MODE_CULL\n");
+		multimesh_cull_modes.push_back("\n#define MODE_WRITE_COMMANDS\n");
+
+		multimesh_cull_shader.shader.initialize(multimesh_cull_modes);
+		multimesh_cull_shader.version = multimesh_cull_shader.shader.version_create();
+		for (int i = 0; i < MultiMeshCullShader::SHADER_MODE_MAX; i++) {
+			multimesh_cull_shader.version_shader[i] = multimesh_cull_shader.shader.version_get_shader(multimesh_cull_shader.version, i);
+			multimesh_cull_shader.pipeline[i] = RD::get_singleton()->compute_pipeline_create(multimesh_cull_shader.version_shader[i]);
+		}
+	}
 }
 
 MeshStorage::~MeshStorage() {
@@ -191,6 +213,7 @@ MeshStorage::~MeshStorage() {
 	}
 
 	skeleton_shader.shader.version_free(skeleton_shader.version);
+	multimesh_cull_shader.shader.version_free(multimesh_cull_shader.version);
 
 	RD::get_singleton()->free(default_rd_storage_buffer);
 
@@ -292,12 +315,13 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 					case RS::ARRAY_COLOR: {
 						attrib_stride += sizeof(uint32_t);
 					} break;
-					case RS::ARRAY_TEX_UV: {
-						attrib_stride += sizeof(float) * 2;
-
-					} break;
+					case RS::ARRAY_TEX_UV:
 					case RS::ARRAY_TEX_UV2: {
-						attrib_stride += sizeof(float) * 2;
+						if (p_surface.format & RS::ARRAY_FLAG_COMPRESS_UVS) {
+							attrib_stride += sizeof(uint16_t) * 2;
+						} else {
+							attrib_stride += sizeof(float) * 2;
+						}
 
 					} break;
 					case RS::ARRAY_CUSTOM0:
@@ -382,6 +406,27 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 				s->lods[i].edge_length = p_surface.lods[i].edge_length;
 				s->lods[i].index_count = indices;
 			}
+
+			if (mesh_stream_enabled) {
+				// Keep the index data around, so every level but the coarsest can be evicted.
+				s->stream_levels.resize(s->lod_count + 1);
+				s->stream_levels[0].index_data = p_surface.index_data;
+				s->stream_levels[0].index_count = s->index_count;
+				for (uint32_t i = 0; i < s->lod_count; i++) {
+					s->stream_levels[i + 1].index_data = p_surface.lods[i].index_data;
+					s->stream_levels[i + 1].index_count = s->lods[i].index_count;
+				}
+				for (uint32_t i = 0; i < s->stream_levels.size(); i++) {
+					s->stream_levels[i].last_used_frame = mesh_stream_frame;
+				}
+				streamed_surfaces.push_back(s);
+			}
+		}
+
+		// Deformed surfaces would need their cluster bounds updated every frame, and streamed ones may lose their full index buffer.
+		bool deformed = (p_surface.format & RS::ARRAY_FORMAT_BONES) || mesh->blend_shape_count > 0;
+		if (mesh_clusters_enabled && s->primitive == RS::PRIMITIVE_TRIANGLES && !deformed && s->stream_levels.is_empty() && !(p_surface.format & RS::ARRAY_FLAG_USE_2D_VERTICES) && s->index_count / 3 >= MAX(mesh_clusters_min_triangles, uint32_t(MESH_CLUSTER_MIN_TRIANGLES) * 2)) {
+			_mesh_surface_build_clusters(s, p_surface, is_index_16);
 		}
 	}
 
@@ -576,13 +621,13 @@ RS::SurfaceData MeshStorage::mesh_get_surface(RID p_mesh, int p_surface) const {
 	sd.primitive = s.primitive;
 
 	if (sd.index_count) {
-		sd.index_data = RD::get_singleton()->buffer_get_data(s.index_buffer);
+		sd.index_data = s.stream_levels.is_empty() ? RD::get_singleton()->buffer_get_data(s.index_buffer) : s.stream_levels[0].index_data;
 	}
 	sd.aabb = s.aabb;
 	for (uint32_t i = 0; i < s.lod_count; i++) {
 		RS::SurfaceData::LOD lod;
 		lod.edge_length = s.lods[i].edge_length;
-		lod.index_data = RD::get_singleton()->buffer_get_data(s.lods[i].index_buffer);
+		lod.index_data = s.stream_levels.is_empty() ? RD::get_singleton()->buffer_get_data(s.lods[i].index_buffer) : s.stream_levels[i + 1].index_data;
 		sd.lods.push_back(lod);
 	}
 
@@ -738,6 +783,110 @@ void MeshStorage::mesh_set_shadow_mesh(RID p_mesh, RID p_shadow_mesh) {
 	mesh->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_MESH);
 }
 
+void MeshStorage::_mesh_surface_build_clusters(Mesh::Surface *s, const RS::SurfaceData &p_surface, bool p_index_16) {
+	uint32_t stride = RS::get_singleton()->mesh_surface_get_format_vertex_stride(s->format, s->vertex_count);
+	ERR_FAIL_COND(uint64_t(stride) * s->vertex_count > uint64_t(p_surface.vertex_data.size()));
+	ERR_FAIL_COND(uint64_t(s->index_count) * (p_index_16 ? 2 : 4) > uint64_t(p_surface.index_data.size()));
+
+	const uint8_t *vr = p_surface.vertex_data.ptr();
+	const uint8_t *ir = p_surface.index_data.ptr();
+
+	uint32_t triangle_count = s->index_count / 3;
+	uint32_t cluster_triangles = MAX(uint32_t(MESH_CLUSTER_MIN_TRIANGLES), (triangle_count + MESH_CLUSTER_MAX_COUNT - 1) / MESH_CLUSTER_MAX_COUNT);
+
+	LocalVector<Vector3> face_normals;
+	face_normals.reserve(cluster_triangles);
+
+	for (uint32_t from = 0; from < triangle_count; from += cluster_triangles) {
+		uint32_t to = MIN(from + cluster_triangles, triangle_count);
+
+		Mesh::Surface::Cluster cluster;
+		bool first = true;
+		Vector3 normal_sum;
+		face_normals.clear();
+
+		for (uint32_t i = from; i < to; i++) {
+			Vector3 v[3];
+			for (uint32_t j = 0; j < 3; j++) {
+				uint32_t index;
+				if (p_index_16) {
+					index = reinterpret_cast<const uint16_t *>(ir)[i * 3 + j];
+				} else {
+					index = reinterpret_cast<const uint32_t *>(ir)[i * 3 + j];
+				}
+				ERR_FAIL_COND(index >= s->vertex_count);
+				const float *pos = reinterpret_cast<const float *>(vr + uint64_t(index) * stride);
+				v[j] = Vector3(pos[0], pos[1], pos[2]);
+				if (first) {
+					cluster.aabb.position = v[j];
+					first = false;
+				} else {
+					cluster.aabb.expand_to(v[j]);
+				}
+			}
+
+			Vector3 normal = Plane(v[0], v[1], v[2]).normal;
+			if (normal.is_normalized()) {
+				normal_sum += normal;
+				face_normals.push_back(normal);
+			}
+		}
+
+		if (normal_sum.length_squared() > CMP_EPSILON2) {
+			cluster.cone_axis = normal_sum.normalized();
+			float min_dot = 1.0;
+			for (uint32_t i = 0; i < face_normals.size(); i++) {
+				min_dot = MIN(min_dot, cluster.cone_axis.dot(face_normals[i]));
+			}
+			// Only bother with cones narrower than ~84 degrees, wider ones almost never cull.
+			if (min_dot > 0.1) {
+				cluster.cone_cutoff = Math::sqrt(1.0 - min_dot * min_dot);
+			}
+		}
+
+		cluster.index_array = RD::get_singleton()->index_array_create(s->index_buffer, from * 3, (to - from) * 3);
+		s->clusters.push_back(cluster);
+	}
+}
+
+void MeshStorage::mesh_surface_cull_clusters(void *p_surface, const Plane *p_planes, int p_plane_count, const Vector3 &p_camera, bool p_cull_backfaces, const ClusterOcclusion *p_occlusion, LocalVector<RID> &r_index_arrays) const {
+	Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
+
+	for (uint32_t i = 0; i < s->clusters.size(); i++) {
+		const Mesh::Surface::Cluster &cluster = s->clusters[i];
+
+		bool outside = false;
+		for (int j = 0; j < p_plane_count; j++) {
+			if (p_planes[j].is_point_over(cluster.aabb.get_support(-p_planes[j].normal))) {
+				outside = true;
+				break;
+			}
+		}
+		if (outside) {
+			continue;
+		}
+
+		if (p_cull_backfaces && cluster.cone_cutoff < 1.0) {
+			Vector3 center = cluster.aabb.get_center();
+			Vector3 to_center = center - p_camera;
+			float radius = cluster.aabb.size.length() * 0.5;
+			if (to_center.dot(cluster.cone_axis) >= cluster.cone_cutoff * to_center.length() + radius) {
+				continue;
+			}
+		}
+
+		if (p_occlusion) {
+			AABB world_aabb = p_occlusion->transform.xform(cluster.aabb);
+			real_t bounds[6] = { world_aabb.position.x, world_aabb.position.y, world_aabb.position.z, world_aabb.position.x + world_aabb.size.x, world_aabb.position.y + world_aabb.size.y, world_aabb.position.z + world_aabb.size.z };
+			if (p_occlusion->buffer->is_occluded_view_projection(bounds, p_occlusion->cam_transform.origin, p_occlusion->cam_inv_transform, p_occlusion->cam_view_projection, p_occlusion->z_near)) {
+				continue;
+			}
+		}
+
+		r_index_arrays.push_back(cluster.index_array);
+	}
+}
+
 void MeshStorage::mesh_clear(RID p_mesh) {
 	Mesh *mesh = mesh_owner.get_or_null(p_mesh);
 	ERR_FAIL_COND(!mesh);
@@ -762,11 +911,17 @@ void MeshStorage::mesh_clear(RID p_mesh) {
 
 		if (s.lod_count) {
 			for (uint32_t j = 0; j < s.lod_count; j++) {
-				RD::get_singleton()->free(s.lods[j].index_buffer);
+				if (s.lods[j].index_buffer.is_valid()) {
+					RD::get_singleton()->free(s.lods[j].index_buffer);
+				}
 			}
 			memdelete_arr(s.lods);
 		}
 
+		if (!s.stream_levels.is_empty()) {
+			streamed_surfaces.erase(mesh->surfaces[i]);
+		}
+
 		if (s.blend_shape_buffer.is_valid()) {
 			RD::get_singleton()->free(s.blend_shape_buffer);
 		}
@@ -859,6 +1014,9 @@ void MeshStorage::mesh_instance_set_blend_shape_weight(RID p_mesh_instance, int
 }
 
 void MeshStorage::_mesh_instance_clear(MeshInstance *mi) {
+	_mesh_instance_release_skin_followers(mi);
+	_mesh_instance_set_skin_source(mi, nullptr);
+
 	for (uint32_t i = 0; i < mi->surfaces.size(); i++) {
 		if (mi->surfaces[i].versions) {
 			for (uint32_t j = 0; j < mi->surfaces[i].version_count; j++) {
@@ -921,6 +1079,53 @@ void MeshStorage::_mesh_instance_add_surface(MeshInstance *mi, Mesh *mesh, uint3
 	mi->dirty = true;
 }
 
+void MeshStorage::_mesh_instance_set_skin_source(MeshInstance *mi, MeshInstance *p_source) {
+	if (mi->skin_source == p_source) {
+		return;
+	}
+	if (mi->skin_source) {
+		mi->skin_source->skin_followers.erase(mi);
+	}
+	mi->skin_source = p_source;
+	if (p_source) {
+		p_source->skin_followers.push_back(mi);
+	}
+}
+
+void MeshStorage::_mesh_instance_release_skin_followers(MeshInstance *mi) {
+	// Followers have to be skinned again, either on their own or sharing another instance.
+	for (uint32_t i = 0; i < mi->skin_followers.size(); i++) {
+		MeshInstance *follower = mi->skin_followers[i];
+		follower->skin_source = nullptr;
+		follower->dirty = true;
+		if (!follower->array_update_list.in_list()) {
+			dirty_mesh_instance_arrays.add(&follower->array_update_list);
+		}
+	}
+	mi->skin_followers.clear();
+}
+
+bool MeshStorage::_mesh_instance_has_same_skin(const MeshInstance *mi, const MeshInstance *p_other) const {
+	if (mi->mesh != p_other->mesh || mi->surfaces.size() != p_other->surfaces.size()) {
+		return false;
+	}
+
+	if (mi->blend_weights.size() != p_other->blend_weights.size() || memcmp(mi->blend_weights.ptr(), p_other->blend_weights.ptr(), mi->blend_weights.size() * sizeof(float)) != 0) {
+		return false;
+	}
+
+	const Skeleton *sk = skeleton_owner.get_or_null(mi->skeleton);
+	const Skeleton *other_sk = skeleton_owner.get_or_null(p_other->skeleton);
+	if (!sk || !other_sk) {
+		return false;
+	}
+	if (sk == other_sk) {
+		return true;
+	}
+	// The pose hash only narrows the search, compare the actual bone data.
+	return sk->use_2d == other_sk->use_2d && sk->data.size() == other_sk->data.size() && memcmp(sk->data.ptr(), other_sk->data.ptr(), sk->data.size() * sizeof(float)) == 0;
+}
+
 void MeshStorage::mesh_instance_check_for_update(RID p_mesh_instance) {
 	MeshInstance *mi = mesh_instance_owner.get_or_null(p_mesh_instance);
 
@@ -964,12 +1169,35 @@ void MeshStorage::update_mesh_instances() {
 	//process skeletons and blend shapes
 	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 
+	// Instances of the same mesh in the same pose only need to be skinned once, the others draw its result.
+	HashMap<uint32_t, MeshInstance *> skin_leaders;
+
 	while (dirty_mesh_instance_arrays.first()) {
 		MeshInstance *mi = dirty_mesh_instance_arrays.first()->self();
 
 		Skeleton *sk = skeleton_owner.get_or_null(mi->skeleton);
 
-		for (uint32_t i = 0; i < mi->surfaces.size(); i++) {
+		_mesh_instance_release_skin_followers(mi);
+
+		MeshInstance *skin_source = nullptr;
+		if (skinning_share_identical_poses && sk && !sk->use_2d && mi->mesh->has_bone_weights) {
+			uint32_t hash = hash_murmur3_one_64(uint64_t(mi->mesh));
+			hash = hash_murmur3_one_32(sk->pose_hash, hash);
+			if (mi->blend_weights.size()) {
+				hash = hash_murmur3_buffer(mi->blend_weights.ptr(), mi->blend_weights.size() * sizeof(float), hash);
+			}
+			hash = hash_fmix32(hash);
+
+			MeshInstance **leader = skin_leaders.getptr(hash);
+			if (!leader) {
+				skin_leaders.insert(hash, mi);
+			} else if (_mesh_instance_has_same_skin(mi, *leader)) {
+				skin_source = *leader;
+			}
+		}
+		_mesh_instance_set_skin_source(mi, skin_source);
+
+		for (uint32_t i = 0; i < mi->surfaces.size() && !skin_source; i++) {
 			if (mi->surfaces[i].uniform_set == RID() || mi->mesh->surfaces[i]->uniform_set == RID()) {
 				continue;
 			}
@@ -1019,6 +1247,109 @@ void MeshStorage::update_mesh_instances() {
 	RD::get_singleton()->compute_list_end();
 }
 
+/* LOD STREAMING */
+
+RID &MeshStorage::_mesh_surface_stream_level_index_buffer(Mesh::Surface *s, uint32_t p_level) {
+	return p_level == 0 ? s->index_buffer : s->lods[p_level - 1].index_buffer;
+}
+
+RID &MeshStorage::_mesh_surface_stream_level_index_array(Mesh::Surface *s, uint32_t p_level) {
+	return p_level == 0 ? s->index_array : s->lods[p_level - 1].index_array;
+}
+
+void MeshStorage::_mesh_surface_stream_level_upload(Mesh::Surface *s, uint32_t p_level) {
+	const Mesh::Surface::StreamLevel &level = s->stream_levels[p_level];
+	bool is_index_16 = s->vertex_count <= 65536 && s->vertex_count > 0;
+
+	RID &index_buffer = _mesh_surface_stream_level_index_buffer(s, p_level);
+	index_buffer = RD::get_singleton()->index_buffer_create(level.index_count, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, level.index_data);
+	_mesh_surface_stream_level_index_array(s, p_level) = RD::get_singleton()->index_array_create(index_buffer, 0, level.index_count);
+}
+
+void MeshStorage::_mesh_surface_stream_level_evict(Mesh::Surface *s, uint32_t p_level) {
+	RID &index_buffer = _mesh_surface_stream_level_index_buffer(s, p_level);
+	RD::get_singleton()->free(index_buffer); //frees the index array as dependency
+	index_buffer = RID();
+	_mesh_surface_stream_level_index_array(s, p_level) = RID();
+}
+
+RID MeshStorage::_mesh_surface_get_streamed_index_array(Mesh::Surface *s, uint32_t p_lod) const {
+	// Request the level for the next update, and draw with the closest resident one until it is uploaded.
+	s->stream_levels[p_lod].last_used_frame = mesh_stream_frame;
+
+	for (uint32_t i = p_lod; i <= s->lod_count; i++) {
+		RID index_array = _mesh_surface_stream_level_index_array(s, i);
+		if (index_array.is_valid()) {
+			return index_array;
+		}
+	}
+
+	return RID();
+}
+
+void MeshStorage::update_mesh_streaming() {
+	mesh_stream_frame++;
+
+	if (streamed_surfaces.is_empty()) {
+		return;
+	}
+
+	struct ResidentLevel {
+		Mesh::Surface *surface = nullptr;
+		uint32_t level = 0;
+		uint64_t last_used_frame = 0;
+
+		bool operator<(const ResidentLevel &p_other) const {
+			return last_used_frame < p_other.last_used_frame;
+		}
+	};
+
+	LocalVector<ResidentLevel> resident_levels;
+	uint64_t last_frame = mesh_stream_frame - 1;
+	uint64_t total_size = 0;
+
+	for (uint32_t i = 0; i < streamed_surfaces.size(); i++) {
+		Mesh::Surface *s = streamed_surfaces[i];
+
+		// The coarsest level always stays resident, so there is something to draw.
+		for (uint32_t j = 0; j < s->lod_count; j++) {
+			const Mesh::Surface::StreamLevel &level = s->stream_levels[j];
+
+			if (_mesh_surface_stream_level_index_buffer(s, j).is_null()) {
+				if (level.last_used_frame < last_frame) {
+					continue;
+				}
+				_mesh_surface_stream_level_upload(s, j);
+			} else if (mesh_stream_frame - level.last_used_frame > MESH_STREAM_UNUSED_FRAMES) {
+				_mesh_surface_stream_level_evict(s, j);
+				continue;
+			}
+
+			ResidentLevel resident;
+			resident.surface = s;
+			resident.level = j;
+			resident.last_used_frame = level.last_used_frame;
+			resident_levels.push_back(resident);
+			total_size += level.index_data.size();
+		}
+	}
+
+	if (mesh_stream_memory_budget == 0 || total_size <= mesh_stream_memory_budget) {
+		return;
+	}
+
+	// Over budget, evict the levels that were drawn least recently, but never one drawn in the last frame.
+	resident_levels.sort();
+	for (uint32_t i = 0; i < resident_levels.size() && total_size > mesh_stream_memory_budget; i++) {
+		const ResidentLevel &resident = resident_levels[i];
+		if (resident.last_used_frame >= last_frame) {
+			break;
+		}
+		_mesh_surface_stream_level_evict(resident.surface, resident.level);
+		total_size -= resident.surface->stream_levels[resident.level].index_data.size();
+	}
+}
+
 void MeshStorage::_mesh_surface_generate_version_for_input_mask(Mesh::Surface::Version &v, Mesh::Surface *s, uint32_t p_input_mask, MeshInstance::Surface *mis) {
 	Vector<RD::VertexAttribute> attributes;
 	Vector<RID> buffers;
@@ -1127,19 +1458,18 @@ void MeshStorage::_mesh_surface_generate_version_for_input_mask(Mesh::Surface::V
 					attribute_stride += sizeof(int8_t) * 4;
 					buffer = s->attribute_buffer;
 				} break;
-				case RS::ARRAY_TEX_UV: {
-					vd.offset = attribute_stride;
-
-					vd.format = RD::DATA_FORMAT_R32G32_SFLOAT;
-					attribute_stride += sizeof(float) * 2;
-					buffer = s->attribute_buffer;
-
-				} break;
+				case RS::ARRAY_TEX_UV:
 				case RS::ARRAY_TEX_UV2: {
 					vd.offset = attribute_stride;
 
-					vd.format = RD::DATA_FORMAT_R32G32_SFLOAT;
-					attribute_stride += sizeof(float) * 2;
+					// Half floats are expanded by the vertex fetch, shaders need no changes.
+					if (s->format & RS::ARRAY_FLAG_COMPRESS_UVS) {
+						vd.format = RD::DATA_FORMAT_R16G16_SFLOAT;
+						attribute_stride += sizeof(uint16_t) * 2;
+					} else {
+						vd.format = RD::DATA_FORMAT_R32G32_SFLOAT;
+						attribute_stride += sizeof(float) * 2;
+					}
 					buffer = s->attribute_buffer;
 				} break;
 				case RS::ARRAY_CUSTOM0:
@@ -1235,6 +1565,8 @@ void MeshStorage::multimesh_allocate_data(RID p_multimesh, int p_instances, RS::
 		multimesh->uniform_set_3d = RID(); //cleared by dependency
 	}
 
+	_multimesh_free_cull_buffers(multimesh);
+
 	if (multimesh->data_cache_dirty_regions) {
 		memdelete_arr(multimesh->data_cache_dirty_regions);
 		multimesh->data_cache_dirty_regions = nullptr;
@@ -1302,6 +1634,7 @@ bool MeshStorage::_multimesh_enable_motion_vectors(RID p_multimesh) {
 		}
 
 		RD::get_singleton()->free(multimesh->buffer);
+		_multimesh_free_cull_buffers(multimesh); // Instances with motion vectors are not culled.
 		uint32_t buffer_size = multimesh->instances * multimesh->stride_cache * sizeof(float) * 2;
 		multimesh->buffer = RD::get_singleton()->storage_buffer_create(buffer_size);
 		RD::get_singleton()->buffer_update(multimesh->buffer, 0, buffer_data.size(), buffer_data.ptr(), RD::BARRIER_MASK_NO_BARRIER);
@@ -1322,6 +1655,151 @@ void MeshStorage::_multimesh_get_motion_vectors_offsets(RID p_multimesh, uint32_
 	r_prev_offset = multimesh->motion_vectors_previous_offset;
 }
 
+void MeshStorage::_multimesh_free_cull_buffers(MultiMesh *multimesh) {
+	if (multimesh->cull_buffer.is_valid()) {
+		RD::get_singleton()->free(multimesh->cull_buffer);
+		multimesh->cull_buffer = RID();
+		multimesh->cull_uniform_set_3d = RID(); // Cleared by dependency.
+	}
+	if (multimesh->cull_commands_buffer.is_valid()) {
+		RD::get_singleton()->free(multimesh->cull_commands_buffer);
+		multimesh->cull_commands_buffer = RID();
+		multimesh->cull_command_count = 0;
+	}
+	multimesh->cull_uniform_set = RID(); // Cleared by dependency.
+	multimesh->cull_valid = false;
+}
+
+bool MeshStorage::multimesh_cull(RID p_multimesh, const Plane *p_planes, int p_plane_count) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_COND_V(!multimesh, false);
+	ERR_FAIL_COND_V(p_plane_count > 6, false);
+
+	multimesh->cull_valid = false;
+
+	// Motion vectors need the previous transforms of the same instances, so those are drawn in full.
+	if (!multimesh_gpu_culling_enabled || multimesh->xform_format != RS::MULTIMESH_TRANSFORM_3D || multimesh->motion_vectors_enabled || multimesh->buffer.is_null()) {
+		return false;
+	}
+
+	uint32_t instance_count = multimesh->visible_instances >= 0 ? multimesh->visible_instances : multimesh->instances;
+	if (instance_count < multimesh_gpu_culling_min_instances) {
+		return false;
+	}
+
+	Mesh *mesh = mesh_owner.get_or_null(multimesh->mesh);
+	if (!mesh || mesh->surface_count == 0) {
+		return false;
+	}
+
+	// One indirect draw command per LOD of each surface. Streamed surfaces may draw a coarser LOD than the
+	// requested one, so the index count of their commands is not known here.
+	multimesh->cull_commands_data.resize(MULTIMESH_CULL_COMMANDS_HEADER_SIZE);
+	multimesh->cull_surface_commands.resize(mesh->surface_count + 1);
+	uint32_t command_count = 0;
+	for (uint32_t i = 0; i < mesh->surface_count; i++) {
+		const Mesh::Surface *s = mesh->surfaces[i];
+		if (!s->stream_levels.is_empty()) {
+			return false;
+		}
+
+		multimesh->cull_surface_commands[i] = command_count;
+		for (uint32_t j = 0; j <= s->lod_count; j++) {
+			// Index (or vertex) count, instance count, and zeroed offsets.
+			multimesh->cull_commands_data.push_back(j == 0 ? (s->index_count ? s->index_count : s->vertex_count) : s->lods[j - 1].index_count);
+			for (uint32_t k = 1; k < MULTIMESH_CULL_COMMAND_SIZE; k++) {
+				multimesh->cull_commands_data.push_back(0);
+			}
+			command_count++;
+		}
+	}
+	multimesh->cull_surface_commands[mesh->surface_count] = command_count;
+
+	if (multimesh->cull_buffer.is_null()) {
+		multimesh->cull_buffer = RD::get_singleton()->storage_buffer_create(multimesh->instances * multimesh->stride_cache * sizeof(float));
+		multimesh->cull_uniform_set = RID(); // Cleared by dependency.
+	}
+
+	if (multimesh->cull_commands_buffer.is_null() || multimesh->cull_command_count != command_count) {
+		if (multimesh->cull_commands_buffer.is_valid()) {
+			RD::get_singleton()->free(multimesh->cull_commands_buffer);
+		}
+		uint32_t size = multimesh->cull_commands_data.size() * sizeof(uint32_t);
+		multimesh->cull_commands_buffer = RD::get_singleton()->storage_buffer_create(size, Vector<uint8_t>(), RD::STORAGE_BUFFER_USAGE_DISPATCH_INDIRECT);
+		multimesh->cull_command_count = command_count;
+		multimesh->cull_uniform_set = RID(); // Cleared by dependency.
+	}
+
+	if (multimesh->cull_uniform_set.is_null() || !RD::get_singleton()->uniform_set_is_valid(multimesh->cull_uniform_set)) {
+		Vector<RD::Uniform> uniforms;
+		{
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 0;
+			u.append_id(multimesh->buffer);
+			uniforms.push_back(u);
+		}
+		{
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 1;
+			u.append_id(multimesh->cull_buffer);
+			uniforms.push_back(u);
+		}
+		{
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 2;
+			u.append_id(multimesh->cull_commands_buffer);
+			uniforms.push_back(u);
+		}
+		multimesh->cull_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, multimesh_cull_shader.version_shader[MultiMeshCullShader::SHADER_MODE_CULL], 0);
+	}
+
+	// Reset the visible instance count, the cull shader counts and writes it to the commands again.
+	multimesh->cull_commands_data[0] = 0;
+	multimesh->cull_commands_data[1] = command_count;
+	multimesh->cull_commands_data[2] = 0;
+	multimesh->cull_commands_data[3] = 0;
+	RD::get_singleton()->buffer_update(multimesh->cull_commands_buffer, 0, multimesh->cull_commands_data.size() * sizeof(uint32_t), multimesh->cull_commands_data.ptr(), RD::BARRIER_MASK_COMPUTE);
+
+	MultiMeshCullShader::PushConstant push_constant;
+	memset(&push_constant, 0, sizeof(MultiMeshCullShader::PushConstant));
+	for (int i = 0; i < p_plane_count; i++) {
+		push_constant.planes[i][0] = p_planes[i].normal.x;
+		push_constant.planes[i][1] = p_planes[i].normal.y;
+		push_constant.planes[i][2] = p_planes[i].normal.z;
+		push_constant.planes[i][3] = p_planes[i].d;
+	}
+
+	// Instances are culled with the bounding sphere of the mesh, so rotated instances don't need their box transformed.
+	AABB aabb = mesh->custom_aabb != AABB() ? mesh->custom_aabb : mesh->aabb;
+	Vector3 center = aabb.get_center();
+	push_constant.sphere[0] = center.x;
+	push_constant.sphere[1] = center.y;
+	push_constant.sphere[2] = center.z;
+	push_constant.sphere[3] = aabb.size.length() * 0.5;
+	push_constant.instance_count = instance_count;
+	push_constant.stride = multimesh->stride_cache / 4;
+	push_constant.plane_count = p_plane_count;
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, multimesh_cull_shader.pipeline[MultiMeshCullShader::SHADER_MODE_CULL]);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, multimesh->cull_uniform_set, 0);
+	RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(MultiMeshCullShader::PushConstant));
+	RD::get_singleton()->compute_list_dispatch_threads(compute_list, instance_count, 1, 1);
+	RD::get_singleton()->compute_list_add_barrier(compute_list);
+
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, multimesh_cull_shader.pipeline[MultiMeshCullShader::SHADER_MODE_WRITE_COMMANDS]);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, multimesh->cull_uniform_set, 0);
+	RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(MultiMeshCullShader::PushConstant));
+	RD::get_singleton()->compute_list_dispatch_threads(compute_list, command_count, 1, 1);
+	RD::get_singleton()->compute_list_end();
+
+	multimesh->cull_valid = true;
+	return true;
+}
+
 int MeshStorage::multimesh_get_instance_count(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_COND_V(!multimesh, 0);
@@ -2061,6 +2539,10 @@ void MeshStorage::_update_dirty_skeletons() {
 			RD::get_singleton()->buffer_update(skeleton->buffer, 0, skeleton->data.size() * sizeof(float), skeleton->data.ptr());
 		}
 
+		if (skinning_share_identical_poses) {
+			skeleton->pose_hash = hash_murmur3_buffer(skeleton->data.ptr(), skeleton->data.size() * sizeof(float));
+		}
+
 		skeleton_dirty_list = skeleton->dirty_list;
 
 		skeleton->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_SKELETON_BONES);
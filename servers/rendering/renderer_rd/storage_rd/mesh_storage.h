@@ -34,7 +34,9 @@
 #include "core/templates/local_vector.h"
 #include "core/templates/rid_owner.h"
 #include "core/templates/self_list.h"
+#include "servers/rendering/renderer_rd/shaders/multimesh_cull.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/skeleton.glsl.gen.h"
+#include "servers/rendering/renderer_scene_occlusion_cull.h"
 #include "servers/rendering/storage/mesh_storage.h"
 #include "servers/rendering/storage/utilities.h"
 
@@ -112,6 +114,26 @@ private:
 			LOD *lods = nullptr;
 			uint32_t lod_count = 0;
 
+			// Index data of surfaces with LOD streaming. Level 0 is the full index buffer and level N is LOD N - 1.
+			// Every level except the coarsest can be evicted from VRAM and uploaded again from the CPU copy.
+			struct StreamLevel {
+				Vector<uint8_t> index_data;
+				uint32_t index_count = 0;
+				uint64_t last_used_frame = 0;
+			};
+
+			LocalVector<StreamLevel> stream_levels;
+
+			// Contiguous triangle ranges of large static surfaces, culled individually when drawn.
+			struct Cluster {
+				AABB aabb;
+				Vector3 cone_axis;
+				float cone_cutoff = 1.0; // 1 means the cluster can't be backface culled.
+				RID index_array;
+			};
+
+			LocalVector<Cluster> clusters;
+
 			AABB aabb;
 
 			Vector<AABB> bone_aabbs;
@@ -180,14 +202,53 @@ private:
 		bool weights_dirty = false;
 		SelfList<MeshInstance> weight_update_list;
 		SelfList<MeshInstance> array_update_list;
+
+		// When sharing identical poses, instance whose skinned vertices are drawn instead of our own.
+		MeshInstance *skin_source = nullptr;
+		LocalVector<MeshInstance *> skin_followers;
+
 		MeshInstance() :
 				weight_update_list(this), array_update_list(this) {}
 	};
 
+	bool skinning_share_identical_poses = false;
+
 	void _mesh_surface_generate_version_for_input_mask(Mesh::Surface::Version &v, Mesh::Surface *s, uint32_t p_input_mask, MeshInstance::Surface *mis = nullptr);
 
+	/* LOD STREAMING */
+
+	enum {
+		MESH_STREAM_UNUSED_FRAMES = 300, // Frames a level may go undrawn before it is evicted.
+	};
+
+	bool mesh_stream_enabled = false;
+	uint64_t mesh_stream_memory_budget = 0;
+	uint64_t mesh_stream_frame = 0;
+	LocalVector<Mesh::Surface *> streamed_surfaces;
+
+	static RID &_mesh_surface_stream_level_index_buffer(Mesh::Surface *s, uint32_t p_level);
+	static RID &_mesh_surface_stream_level_index_array(Mesh::Surface *s, uint32_t p_level);
+	void _mesh_surface_stream_level_upload(Mesh::Surface *s, uint32_t p_level);
+	void _mesh_surface_stream_level_evict(Mesh::Surface *s, uint32_t p_level);
+	RID _mesh_surface_get_streamed_index_array(Mesh::Surface *s, uint32_t p_lod) const;
+
+	/* CLUSTER CULLING */
+
+	enum {
+		MESH_CLUSTER_MIN_TRIANGLES = 512, // Smaller clusters cost more in draw calls than they save.
+		MESH_CLUSTER_MAX_COUNT = 256,
+	};
+
+	bool mesh_clusters_enabled = false;
+	uint32_t mesh_clusters_min_triangles = 0;
+
+	void _mesh_surface_build_clusters(Mesh::Surface *s, const RS::SurfaceData &p_surface, bool p_index_16);
+
 	void _mesh_instance_clear(MeshInstance *mi);
 	void _mesh_instance_add_surface(MeshInstance *mi, Mesh *mesh, uint32_t p_surface);
+	void _mesh_instance_set_skin_source(MeshInstance *mi, MeshInstance *p_source);
+	void _mesh_instance_release_skin_followers(MeshInstance *mi);
+	bool _mesh_instance_has_same_skin(const MeshInstance *mi, const MeshInstance *p_other) const;
 
 	mutable RID_Owner<MeshInstance> mesh_instance_owner;
 
@@ -224,6 +285,17 @@ private:
 		RID uniform_set_3d;
 		RID uniform_set_2d;
 
+		// Visible instances compacted by multimesh_cull(), and the indirect draw commands drawing them.
+		// There is one command per LOD of each mesh surface, in surface order.
+		RID cull_buffer;
+		RID cull_commands_buffer;
+		RID cull_uniform_set;
+		RID cull_uniform_set_3d;
+		uint32_t cull_command_count = 0;
+		LocalVector<uint32_t> cull_commands_data;
+		LocalVector<uint32_t> cull_surface_commands; // First command of each mesh surface, then the command count.
+		bool cull_valid = false;
+
 		bool dirty = false;
 		MultiMesh *dirty_list = nullptr;
 
@@ -240,6 +312,42 @@ private:
 	_FORCE_INLINE_ void _multimesh_mark_all_dirty(MultiMesh *multimesh, bool p_data, bool p_aabb);
 	_FORCE_INLINE_ void _multimesh_re_create_aabb(MultiMesh *multimesh, const float *p_data, int p_instances);
 
+	/* MultiMesh GPU culling */
+
+	enum {
+		MULTIMESH_CULL_MIN_INSTANCES = 64, // Fewer instances are cheaper to draw than to cull.
+		MULTIMESH_CULL_COMMANDS_HEADER_SIZE = 4, // Visible instance count, command count and padding, in uint32s.
+		MULTIMESH_CULL_COMMAND_SIZE = 5, // Large enough for both indexed and non indexed commands, in uint32s.
+	};
+
+	struct MultiMeshCullShader {
+		struct PushConstant {
+			float planes[6][4];
+			float sphere[4];
+
+			uint32_t instance_count;
+			uint32_t stride;
+			uint32_t plane_count;
+			uint32_t pad;
+		};
+
+		enum {
+			SHADER_MODE_CULL,
+			SHADER_MODE_WRITE_COMMANDS,
+			SHADER_MODE_MAX
+		};
+
+		MultimeshCullShaderRD shader;
+		RID version;
+		RID version_shader[SHADER_MODE_MAX];
+		RID pipeline[SHADER_MODE_MAX];
+	} multimesh_cull_shader;
+
+	bool multimesh_gpu_culling_enabled = false;
+	uint32_t multimesh_gpu_culling_min_instances = 0;
+
+	void _multimesh_free_cull_buffers(MultiMesh *multimesh);
+
 	/* Skeleton */
 
 	struct SkeletonShader {
@@ -293,6 +401,7 @@ private:
 		RID uniform_set_mi;
 
 		uint64_t version = 1;
+		uint32_t pose_hash = 0; // Only kept when sharing identical poses.
 
 		Dependency dependency;
 	};
@@ -422,6 +531,10 @@ public:
 	_FORCE_INLINE_ RID mesh_surface_get_index_array(void *p_surface, uint32_t p_lod) const {
 		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
 
+		if (unlikely(!s->stream_levels.is_empty())) {
+			return _mesh_surface_get_streamed_index_array(s, p_lod);
+		}
+
 		if (p_lod == 0) {
 			return s->index_array;
 		} else {
@@ -429,6 +542,24 @@ public:
 		}
 	}
 
+	_FORCE_INLINE_ bool mesh_surface_has_clusters(void *p_surface) const {
+		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
+		return !s->clusters.is_empty();
+	}
+
+	struct ClusterOcclusion {
+		const RendererSceneOcclusionCull::HZBuffer *buffer = nullptr;
+		Transform3D transform; // Mesh space to world space.
+		Transform3D cam_transform;
+		Transform3D cam_inv_transform;
+		Projection cam_projection;
+		Projection cam_view_projection; // cam_projection * cam_inv_transform.
+		real_t z_near = 0.0;
+	};
+
+	// Appends the index arrays of the clusters inside the (mesh space) planes, skipping fully back-facing clusters and, if p_occlusion is given, occluded ones.
+	void mesh_surface_cull_clusters(void *p_surface, const Plane *p_planes, int p_plane_count, const Vector3 &p_camera, bool p_cull_backfaces, const ClusterOcclusion *p_occlusion, LocalVector<RID> &r_index_arrays) const;
+
 	_FORCE_INLINE_ void mesh_surface_get_vertex_arrays_and_format(void *p_surface, uint32_t p_input_mask, RID &r_vertex_array_rd, RD::VertexFormatID &r_vertex_format) {
 		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
 
@@ -462,6 +593,9 @@ public:
 	_FORCE_INLINE_ void mesh_instance_surface_get_vertex_arrays_and_format(RID p_mesh_instance, uint32_t p_surface_index, uint32_t p_input_mask, RID &r_vertex_array_rd, RD::VertexFormatID &r_vertex_format) {
 		MeshInstance *mi = mesh_instance_owner.get_or_null(p_mesh_instance);
 		ERR_FAIL_COND(!mi);
+		if (mi->skin_source) {
+			mi = mi->skin_source;
+		}
 		Mesh *mesh = mi->mesh;
 		ERR_FAIL_UNSIGNED_INDEX(p_surface_index, mesh->surface_count);
 
@@ -552,6 +686,8 @@ public:
 	virtual void mesh_instance_check_for_update(RID p_mesh_instance) override;
 	virtual void update_mesh_instances() override;
 
+	void update_mesh_streaming();
+
 	/* MULTIMESH API */
 
 	bool owns_multimesh(RID p_rid) { return multimesh_owner.owns(p_rid); };
@@ -632,6 +768,45 @@ public:
 		return multimesh->uniform_set_3d;
 	}
 
+	// Frustum culls the instances of a 3D multimesh on the GPU against planes in multimesh space, and compacts the
+	// visible ones for the draws using multimesh_get_cull_3d_uniform_set() and multimesh_get_cull_draw_command().
+	// Returns false if the multimesh can't be culled and must be drawn with all its instances.
+	bool multimesh_cull(RID p_multimesh, const Plane *p_planes, int p_plane_count);
+
+	_FORCE_INLINE_ RID multimesh_get_cull_3d_uniform_set(RID p_multimesh, RID p_shader, uint32_t p_set) const {
+		MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+		if (multimesh == nullptr || !multimesh->cull_valid) {
+			return RID();
+		}
+		if (!multimesh->cull_uniform_set_3d.is_valid()) {
+			Vector<RD::Uniform> uniforms;
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 0;
+			u.append_id(multimesh->cull_buffer);
+			uniforms.push_back(u);
+			multimesh->cull_uniform_set_3d = RD::get_singleton()->uniform_set_create(uniforms, p_shader, p_set);
+		}
+
+		return multimesh->cull_uniform_set_3d;
+	}
+
+	// Returns the buffer holding the indirect draw command of the given surface and LOD of the culled multimesh,
+	// or an invalid RID if it must be drawn with all its instances.
+	_FORCE_INLINE_ RID multimesh_get_cull_draw_command(RID p_multimesh, uint32_t p_surface, uint32_t p_lod, uint32_t &r_offset) const {
+		MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+		if (multimesh == nullptr || !multimesh->cull_valid || p_surface + 1 >= multimesh->cull_surface_commands.size()) {
+			return RID();
+		}
+		uint32_t command = multimesh->cull_surface_commands[p_surface] + p_lod;
+		if (command >= multimesh->cull_surface_commands[p_surface + 1]) {
+			return RID();
+		}
+
+		r_offset = (MULTIMESH_CULL_COMMANDS_HEADER_SIZE + command * MULTIMESH_CULL_COMMAND_SIZE) * sizeof(uint32_t);
+		return multimesh->cull_commands_buffer;
+	}
+
 	_FORCE_INLINE_ RID multimesh_get_2d_uniform_set(RID p_multimesh, RID p_shader, uint32_t p_set) const {
 		MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 		if (multimesh == nullptr) {
@@ -304,6 +304,13 @@ void ParticlesStorage::_particles_free_data(Particles *particles) {
 		particles->particles_sort_buffer = RID();
 		particles->particles_sort_uniform_set = RID();
 	}
+	if (particles->draw_commands_buffer.is_valid()) {
+		RD::get_singleton()->free(particles->draw_commands_buffer);
+		particles->draw_commands_buffer = RID();
+		particles->draw_commands_uniform_set = RID();
+		particles->draw_command_count = 0;
+		particles->draw_commands_valid = false;
+	}
 
 	if (particles->emission_buffer != nullptr) {
 		particles->emission_buffer = nullptr;
@@ -697,7 +704,7 @@ void ParticlesStorage::particles_set_canvas_sdf_collision(RID p_particles, bool
 	particles->sdf_collision_texture = p_texture;
 }
 
-void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta) {
+void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta, BitField<RD::BarrierMask> p_post_barrier) {
 	TextureStorage *texture_storage = TextureStorage::get_singleton();
 	MaterialStorage *material_storage = MaterialStorage::get_singleton();
 
@@ -1098,7 +1105,6 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 
 	p_particles->has_collision_cache = m->shader_data->uses_collision;
 
-	//todo should maybe compute all particle systems together?
 	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, m->shader_data->pipeline);
 	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles_shader.base_uniform_set, 0);
@@ -1124,7 +1130,7 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 		RD::get_singleton()->compute_list_dispatch_threads(compute_list, process_amount, 1, 1);
 	}
 
-	RD::get_singleton()->compute_list_end();
+	RD::get_singleton()->compute_list_end(p_post_barrier);
 }
 
 void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis) {
@@ -1141,6 +1147,53 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 
 	bool do_sort = particles->draw_order == RS::PARTICLES_DRAW_ORDER_VIEW_DEPTH;
 
+	if (do_sort) {
+		// One indirect draw command per draw pass surface, in the same order the renderers add them.
+		MeshStorage *mesh_storage = MeshStorage::get_singleton();
+		particles->draw_commands_data.resize(DRAW_COMMANDS_HEADER_SIZE);
+		for (int i = 0; i < particles->draw_passes.size(); i++) {
+			RID mesh = particles->draw_passes[i];
+			if (!mesh_storage->owns_mesh(mesh)) {
+				continue;
+			}
+			uint32_t surface_count = mesh_storage->mesh_get_surface_count(mesh);
+			for (uint32_t j = 0; j < surface_count; j++) {
+				uint32_t drawn_count = mesh_storage->mesh_surface_get_vertices_drawn_count(mesh_storage->mesh_get_surface(mesh, j));
+				// Index (or vertex) count, instance count, and zeroed offsets.
+				particles->draw_commands_data.push_back(drawn_count);
+				for (uint32_t k = 1; k < DRAW_COMMAND_SIZE; k++) {
+					particles->draw_commands_data.push_back(0);
+				}
+			}
+		}
+
+		uint32_t command_count = (particles->draw_commands_data.size() - DRAW_COMMANDS_HEADER_SIZE) / DRAW_COMMAND_SIZE;
+		if (particles->draw_commands_buffer.is_null() || particles->draw_command_count != command_count) {
+			if (particles->draw_commands_buffer.is_valid()) {
+				RD::get_singleton()->free(particles->draw_commands_buffer);
+			}
+			uint32_t size = (DRAW_COMMANDS_HEADER_SIZE + MAX(command_count, 1u) * DRAW_COMMAND_SIZE) * sizeof(uint32_t);
+			particles->draw_commands_buffer = RD::get_singleton()->storage_buffer_create(size, Vector<uint8_t>(), RD::STORAGE_BUFFER_USAGE_DISPATCH_INDIRECT);
+			particles->draw_command_count = command_count;
+
+			Vector<RD::Uniform> uniforms;
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 0;
+			u.append_id(particles->draw_commands_buffer);
+			uniforms.push_back(u);
+			particles->draw_commands_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, particles_shader.copy_shader.version_get_shader(particles_shader.copy_shader_version, ParticlesShader::COPY_MODE_FILL_SORT_BUFFER), 3);
+		}
+
+		// Reset the active particle count, the copy shaders count and write it again.
+		particles->draw_commands_data[0] = 0;
+		particles->draw_commands_data[1] = command_count;
+		particles->draw_commands_data[2] = 0;
+		particles->draw_commands_data[3] = 0;
+		RD::get_singleton()->buffer_update(particles->draw_commands_buffer, 0, particles->draw_commands_data.size() * sizeof(uint32_t), particles->draw_commands_data.ptr(), RD::BARRIER_MASK_COMPUTE);
+		particles->draw_commands_valid = true;
+	}
+
 	//copy to sort buffer
 	if (do_sort && particles->particles_sort_buffer == RID()) {
 		uint32_t size = particles->amount;
@@ -1213,6 +1266,7 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_copy_uniform_set, 0);
 		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_sort_uniform_set, 1);
 		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->trail_bind_pose_uniform_set, 2);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->draw_commands_uniform_set, 3);
 		RD::get_singleton()->compute_list_set_push_constant(compute_list, &copy_push_constant, sizeof(ParticlesShader::CopyPushConstant));
 
 		RD::get_singleton()->compute_list_dispatch_threads(compute_list, particles->amount, 1, 1);
@@ -1235,6 +1289,9 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_sort_uniform_set, 1);
 	}
 	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->trail_bind_pose_uniform_set, 2);
+	if (do_sort) {
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->draw_commands_uniform_set, 3);
+	}
 
 	RD::get_singleton()->compute_list_set_push_constant(compute_list, &copy_push_constant, sizeof(ParticlesShader::CopyPushConstant));
 
@@ -1295,6 +1352,16 @@ void ParticlesStorage::_particles_update_buffers(Particles *particles) {
 	}
 }
 void ParticlesStorage::update_particles() {
+	// Particle systems that aren't linked through sub-emitters don't depend on each other, so their last
+	// process pass of the frame is left unbarriered and overlaps with the next system's. A single barrier
+	// is placed before the instance buffers are filled, and the copy passes are batched in the same way.
+	struct ParticlesCopy {
+		Particles *particles = nullptr;
+		ParticlesShader::CopyPushConstant push_constant;
+	};
+	LocalVector<ParticlesCopy> copies;
+	bool process_barrier_pending = false;
+
 	while (particle_update_list) {
 		//use transform feedback to process particles
 
@@ -1406,6 +1473,10 @@ void ParticlesStorage::update_particles() {
 
 		bool zero_time_scale = Engine::get_singleton()->get_time_scale() <= 0.0;
 
+		bool independent = particles->sub_emitter.is_null() && particles->emission_buffer == nullptr;
+		BitField<RD::BarrierMask> last_process_barrier = independent ? RD::BARRIER_MASK_NO_BARRIER : RD::BARRIER_MASK_ALL_BARRIERS;
+		process_barrier_pending = process_barrier_pending || independent;
+
 		if (particles->clear && particles->pre_process_time > 0.0) {
 			double frame_time;
 			if (fixed_fps > 0) {
@@ -1441,17 +1512,17 @@ void ParticlesStorage::update_particles() {
 			double todo = particles->frame_remainder + delta;
 
 			while (todo >= frame_time) {
-				_particles_process(particles, frame_time);
 				todo -= decr;
+				_particles_process(particles, frame_time, todo >= frame_time ? RD::BARRIER_MASK_ALL_BARRIERS : last_process_barrier);
 			}
 
 			particles->frame_remainder = todo;
 
 		} else {
 			if (zero_time_scale) {
-				_particles_process(particles, 0.0);
+				_particles_process(particles, 0.0, last_process_barrier);
 			} else {
-				_particles_process(particles, RendererCompositorRD::singleton->get_frame_delta_time());
+				_particles_process(particles, RendererCompositorRD::singleton->get_frame_delta_time(), last_process_barrier);
 			}
 		}
 
@@ -1501,21 +1572,37 @@ void ParticlesStorage::update_particles() {
 			copy_push_constant.order_by_lifetime = (particles->draw_order == RS::PARTICLES_DRAW_ORDER_LIFETIME || particles->draw_order == RS::PARTICLES_DRAW_ORDER_REVERSE_LIFETIME);
 			copy_push_constant.lifetime_split = MIN(particles->amount * particles->phase, particles->amount - 1);
 			copy_push_constant.lifetime_reverse = particles->draw_order == RS::PARTICLES_DRAW_ORDER_REVERSE_LIFETIME;
-
-			RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 			copy_push_constant.copy_mode_2d = particles->mode == RS::PARTICLES_MODE_2D ? 1 : 0;
-			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, particles_shader.copy_pipelines[ParticlesShader::COPY_MODE_FILL_INSTANCES + particles->userdata_count * ParticlesShader::COPY_MODE_MAX]);
-			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_copy_uniform_set, 0);
-			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->trail_bind_pose_uniform_set, 2);
-			RD::get_singleton()->compute_list_set_push_constant(compute_list, &copy_push_constant, sizeof(ParticlesShader::CopyPushConstant));
-
-			RD::get_singleton()->compute_list_dispatch_threads(compute_list, total_amount, 1, 1);
 
-			RD::get_singleton()->compute_list_end();
+			ParticlesCopy copy;
+			copy.particles = particles;
+			copy.push_constant = copy_push_constant;
+			copies.push_back(copy);
 		}
 
 		particles->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_AABB);
 	}
+
+	if (process_barrier_pending) {
+		RD::get_singleton()->barrier(RD::BARRIER_MASK_COMPUTE, RD::BARRIER_MASK_ALL_BARRIERS);
+	}
+
+	if (copies.is_empty()) {
+		return;
+	}
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	for (uint32_t i = 0; i < copies.size(); i++) {
+		const ParticlesCopy &copy = copies[i];
+		Particles *particles = copy.particles;
+		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, particles_shader.copy_pipelines[ParticlesShader::COPY_MODE_FILL_INSTANCES + particles->userdata_count * ParticlesShader::COPY_MODE_MAX]);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_copy_uniform_set, 0);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->trail_bind_pose_uniform_set, 2);
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &copy.push_constant, sizeof(ParticlesShader::CopyPushConstant));
+
+		RD::get_singleton()->compute_list_dispatch_threads(compute_list, copy.push_constant.total_particles, 1, 1);
+	}
+	RD::get_singleton()->compute_list_end();
 }
 
 Dependency *ParticlesStorage::particles_get_dependency(RID p_particles) const {
@@ -193,6 +193,15 @@ private:
 		RID particles_sort_buffer;
 		RID particles_sort_uniform_set;
 
+		// Indirect draw commands for every draw pass surface, with the instance count set by the GPU to the
+		// amount of active particles. Only available for view depth sorted particles without trails, as the
+		// sort is what moves the active particles to the front of the instance buffer.
+		RID draw_commands_buffer;
+		RID draw_commands_uniform_set;
+		uint32_t draw_command_count = 0;
+		bool draw_commands_valid = false;
+		LocalVector<uint32_t> draw_commands_data;
+
 		bool dirty = false;
 		Particles *update_list = nullptr;
 
@@ -237,7 +246,7 @@ private:
 		}
 	};
 
-	void _particles_process(Particles *p_particles, double p_delta);
+	void _particles_process(Particles *p_particles, double p_delta, BitField<RD::BarrierMask> p_post_barrier = RD::BARRIER_MASK_ALL_BARRIERS);
 	void _particles_allocate_emission_buffer(Particles *particles);
 	void _particles_free_data(Particles *particles);
 	void _particles_update_buffers(Particles *particles);
@@ -491,6 +500,24 @@ public:
 		return particles->use_local_coords;
 	}
 
+	enum {
+		DRAW_COMMANDS_HEADER_SIZE = 4, // Active particle count, command count and padding, in uint32s.
+		DRAW_COMMAND_SIZE = 5, // Large enough for both indexed and non indexed commands, in uint32s.
+	};
+
+	// Returns the buffer holding the indirect draw command of the given draw pass surface, or an invalid
+	// RID if the particles must be drawn with their full amount.
+	_FORCE_INLINE_ RID particles_get_draw_command(RID p_particles, uint32_t p_command, uint32_t &r_offset) {
+		Particles *particles = particles_owner.get_or_null(p_particles);
+		ERR_FAIL_COND_V(!particles, RID());
+		if (!particles->draw_commands_valid || p_command >= particles->draw_command_count || particles->draw_order != RS::PARTICLES_DRAW_ORDER_VIEW_DEPTH || (particles->trails_enabled && particles->trail_bind_poses.size() > 1)) {
+			return RID();
+		}
+
+		r_offset = (DRAW_COMMANDS_HEADER_SIZE + p_command * DRAW_COMMAND_SIZE) * sizeof(uint32_t);
+		return particles->draw_commands_buffer;
+	}
+
 	_FORCE_INLINE_ RID particles_get_instance_buffer_uniform_set(RID p_particles, RID p_shader, uint32_t p_set) {
 		Particles *particles = particles_owner.get_or_null(p_particles);
 		ERR_FAIL_COND_V(!particles, RID());
@@ -76,6 +76,11 @@ void RenderSceneBuffersRD::update_sizes(NamedTexture &p_named_texture) {
 }
 
 void RenderSceneBuffersRD::free_named_texture(NamedTexture &p_named_texture) {
+	if (!p_named_texture.is_unique) {
+		_release_transient_texture(p_named_texture);
+		return;
+	}
+
 	if (p_named_texture.texture.is_valid()) {
 		RD::get_singleton()->free(p_named_texture.texture);
 	}
@@ -83,6 +88,68 @@ void RenderSceneBuffersRD::free_named_texture(NamedTexture &p_named_texture) {
 	p_named_texture.slices.clear(); // slices should be freed automatically as dependents...
 }
 
+HashMap<RenderSceneBuffersRD::TransientKey, RenderSceneBuffersRD::TransientTexture, RenderSceneBuffersRD::TransientKey> RenderSceneBuffersRD::transient_textures;
+
+RID RenderSceneBuffersRD::_acquire_transient_texture(NamedTexture &p_named_texture, RD::TextureView p_view, const String &p_name) {
+	// Use the first index of this format that none of our other textures uses.
+	// Two of our own textures must never alias, as they may be in use at the same time.
+	uint32_t index = 0;
+	bool index_used = true;
+	while (index_used) {
+		index_used = false;
+		for (const KeyValue<NTKey, NamedTexture> &E : named_textures) {
+			if (&E.value != &p_named_texture && !E.value.is_unique && E.value.texture.is_valid() && E.value.transient_index == index && E.value.format == p_named_texture.format) {
+				index_used = true;
+				index++;
+				break;
+			}
+		}
+	}
+
+	TransientKey key;
+	key.format = p_named_texture.format;
+	key.index = index;
+
+	TransientTexture *transient = transient_textures.getptr(key);
+	if (!transient) {
+		transient = &transient_textures.insert(key, TransientTexture())->value;
+		transient->texture = RD::get_singleton()->texture_create(p_named_texture.format, p_view);
+		RD::get_singleton()->set_resource_name(transient->texture, vformat("Transient RenderBuffer %s #%d", p_name, index));
+	}
+	transient->users++;
+
+	p_named_texture.transient_index = index;
+	return transient->texture;
+}
+
+void RenderSceneBuffersRD::_release_transient_texture(NamedTexture &p_named_texture) {
+	if (p_named_texture.texture.is_null()) {
+		return;
+	}
+
+	// The texture outlives us, so our slices won't be freed as its dependents.
+	for (const RID &slice : p_named_texture.slices) {
+		if (slice.is_valid()) {
+			RD::get_singleton()->free(slice);
+		}
+	}
+	p_named_texture.slices.clear();
+
+	TransientKey key;
+	key.format = p_named_texture.format;
+	key.index = p_named_texture.transient_index;
+
+	TransientTexture *transient = transient_textures.getptr(key);
+	if (transient) {
+		transient->users--;
+		if (transient->users == 0) {
+			RD::get_singleton()->free(transient->texture);
+			transient_textures.erase(key);
+		}
+	}
+	p_named_texture.texture = RID();
+}
+
 void RenderSceneBuffersRD::cleanup() {
 	// Free our data buffers (but don't destroy them)
 	for (KeyValue<StringName, Ref<RenderBufferCustomDataRD>> &E : data_buffers) {
@@ -253,25 +320,28 @@ RID RenderSceneBuffersRD::create_texture(const StringName &p_context, const Stri
 }
 
 RID RenderSceneBuffersRD::create_texture_from_format(const StringName &p_context, const StringName &p_texture_name, const RD::TextureFormat &p_texture_format, RD::TextureView p_view, bool p_unique) {
-	// TODO p_unique, if p_unique is true, this is a texture that can be shared. This will be implemented later as an optimisation.
-
 	NTKey key(p_context, p_texture_name);
 
 	// check if this is a known texture
-	if (named_textures.has(key)) {
-		return named_textures[key].texture;
+	NamedTexture *existing = named_textures.getptr(key);
+	if (existing) {
+		return existing->texture;
 	}
 
 	// Add a new entry..
 	NamedTexture &named_texture = named_textures[key];
 	named_texture.format = p_texture_format;
 	named_texture.is_unique = p_unique;
-	named_texture.texture = RD::get_singleton()->texture_create(p_texture_format, p_view);
 
 	Array arr;
 	arr.push_back(p_context);
 	arr.push_back(p_texture_name);
-	RD::get_singleton()->set_resource_name(named_texture.texture, String("RenderBuffer {0}/{1}").format(arr));
+	if (p_unique) {
+		named_texture.texture = RD::get_singleton()->texture_create(p_texture_format, p_view);
+		RD::get_singleton()->set_resource_name(named_texture.texture, String("RenderBuffer {0}/{1}").format(arr));
+	} else {
+		named_texture.texture = _acquire_transient_texture(named_texture, p_view, String("{0}/{1}").format(arr));
+	}
 
 	update_sizes(named_texture);
 
@@ -296,7 +366,7 @@ RID RenderSceneBuffersRD::create_texture_view(const StringName &p_context, const
 	NamedTexture &view_texture = named_textures[view_key];
 
 	view_texture.format = named_texture.format;
-	view_texture.is_unique = named_texture.is_unique;
+	view_texture.is_unique = true; // The view itself is ours, even if the texture it views is shared.
 
 	view_texture.texture = RD::get_singleton()->texture_create_shared(p_view, named_texture.texture);
 
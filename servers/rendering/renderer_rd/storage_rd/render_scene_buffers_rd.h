@@ -108,7 +108,8 @@ private:
 	struct NamedTexture {
 		// Cache the data used to create our texture
 		RD::TextureFormat format;
-		bool is_unique; // If marked as unique, we return it into our pool
+		bool is_unique; // If not marked as unique, the texture comes from the shared transient pool.
+		uint32_t transient_index = 0; // Which of our transient textures with this format we use.
 
 		// Our texture objects, slices are lazy (i.e. only created when requested).
 		RID texture;
@@ -120,6 +121,43 @@ private:
 	void update_sizes(NamedTexture &p_named_texture);
 	void free_named_texture(NamedTexture &p_named_texture);
 
+	// Transient textures
+
+	// Textures that aren't unique are fully written and consumed while rendering a single viewport.
+	// Viewports render one after the other, so all render buffers share them: the n-th transient texture
+	// with a given format is the same texture in every viewport that uses one.
+
+	struct TransientKey {
+		RD::TextureFormat format;
+		uint32_t index = 0;
+
+		bool operator==(const TransientKey &p_val) const {
+			return index == p_val.index && format == p_val.format;
+		}
+
+		static uint32_t hash(const TransientKey &p_val) {
+			uint32_t h = hash_murmur3_one_32(p_val.index);
+			h = hash_murmur3_one_32(p_val.format.format, h);
+			h = hash_murmur3_one_32(p_val.format.width, h);
+			h = hash_murmur3_one_32(p_val.format.height, h);
+			h = hash_murmur3_one_32(p_val.format.array_layers, h);
+			h = hash_murmur3_one_32(p_val.format.mipmaps, h);
+			h = hash_murmur3_one_32(p_val.format.samples, h);
+			h = hash_murmur3_one_32(p_val.format.usage_bits, h);
+			return hash_fmix32(h);
+		}
+	};
+
+	struct TransientTexture {
+		RID texture;
+		uint32_t users = 0;
+	};
+
+	static HashMap<TransientKey, TransientTexture, TransientKey> transient_textures;
+
+	RID _acquire_transient_texture(NamedTexture &p_named_texture, RD::TextureView p_view, const String &p_name);
+	void _release_transient_texture(NamedTexture &p_named_texture);
+
 	// Data buffers
 	mutable HashMap<StringName, Ref<RenderBufferCustomDataRD>> data_buffers;
 
@@ -147,6 +185,8 @@ public:
 	// Named Textures
 
 	bool has_texture(const StringName &p_context, const StringName &p_texture_name) const;
+	// Textures created with p_unique set to false must be fully rewritten each time the viewport renders,
+	// and must not be read after it finished rendering, as other viewports reuse their memory.
 	RID create_texture(const StringName &p_context, const StringName &p_texture_name, const RD::DataFormat p_data_format, const uint32_t p_usage_bits, const RD::TextureSamples p_texture_samples = RD::TEXTURE_SAMPLES_1, const Size2i p_size = Size2i(0, 0), const uint32_t p_layers = 0, const uint32_t p_mipmaps = 1, bool p_unique = true);
 	RID create_texture_from_format(const StringName &p_context, const StringName &p_texture_name, const RD::TextureFormat &p_texture_format, RD::TextureView p_view = RD::TextureView(), bool p_unique = true);
 	RID create_texture_view(const StringName &p_context, const StringName &p_texture_name, const StringName p_view_name, RD::TextureView p_view = RD::TextureView());
@@ -157,6 +197,8 @@ public:
 
 	void clear_context(const StringName &p_context);
 
+	static uint32_t get_transient_texture_count() { return transient_textures.size(); }
+
 	// Allocate shared buffers
 	void allocate_blur_textures();
 
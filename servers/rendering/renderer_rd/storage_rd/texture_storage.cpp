@@ -32,6 +32,7 @@
 
 #include "../effects/copy_effects.h"
 #include "../framebuffer_cache_rd.h"
+#include "core/config/project_settings.h"
 #include "material_storage.h"
 #include "servers/rendering/renderer_rd/renderer_scene_render_rd.h"
 
@@ -87,6 +88,9 @@ TextureStorage *TextureStorage::get_singleton() {
 TextureStorage::TextureStorage() {
 	singleton = this;
 
+	texture_stream_min_size = MAX(1, int(GLOBAL_GET("rendering/textures/streaming/initial_size")));
+	texture_stream_memory_budget = uint64_t(MAX(0, int(GLOBAL_GET("rendering/textures/streaming/memory_budget_mb")))) * 1024 * 1024;
+
 	{ //create default textures
 
 		RD::TextureFormat tformat;
@@ -687,6 +691,7 @@ void TextureStorage::texture_free(RID p_texture) {
 	}
 
 	decal_atlas_remove_texture(p_texture);
+	texture_streams.erase(p_texture);
 
 	for (int i = 0; i < t->proxies.size(); i++) {
 		Texture *p = texture_owner.get_or_null(t->proxies[i]);
@@ -1327,6 +1332,98 @@ void TextureStorage::texture_set_detect_roughness_callback(RID p_texture, RS::Te
 	tex->detect_roughness_callback = p_callback;
 }
 
+void TextureStorage::texture_set_stream_callback(RID p_texture, RS::TextureStreamCallback p_callback, void *p_userdata) {
+	Texture *tex = texture_owner.get_or_null(p_texture);
+	ERR_FAIL_COND(!tex);
+	ERR_FAIL_COND(tex->type != TextureStorage::TYPE_2D);
+
+	if (!p_callback) {
+		texture_streams.erase(p_texture);
+		return;
+	}
+
+	TextureStream &stream = texture_streams[p_texture];
+	stream.callback = p_callback;
+	stream.callback_ud = p_userdata;
+	stream.requested_size = 0;
+	stream.size = MAX(tex->width, tex->height);
+	stream.last_used_frame = texture_stream_frame;
+}
+
+uint64_t TextureStorage::_texture_stream_get_data_size(const TextureStreamCandidate &p_candidate, uint32_t p_size) {
+	const Texture *tex = p_candidate.texture;
+	int w = MAX(1, int(uint64_t(tex->width_2d) * p_size / p_candidate.full_size));
+	int h = MAX(1, int(uint64_t(tex->height_2d) * p_size / p_candidate.full_size));
+	return Image::get_image_data_size(w, h, tex->format, tex->mipmaps > 1);
+}
+
+void TextureStorage::update_texture_streaming() {
+	texture_stream_frame++;
+
+	if (texture_streams.is_empty()) {
+		return;
+	}
+
+	LocalVector<TextureStreamCandidate> candidates;
+	candidates.reserve(texture_streams.size());
+	uint64_t total_size = 0;
+
+	for (KeyValue<RID, TextureStream> &E : texture_streams) {
+		Texture *tex = texture_owner.get_or_null(E.key);
+		if (!tex) {
+			continue;
+		}
+
+		TextureStream &stream = E.value;
+		TextureStreamCandidate candidate;
+		candidate.stream = &stream;
+		candidate.texture = tex;
+		// The size override holds the dimensions of the full resolution texture on disk.
+		candidate.full_size = MAX(1, MAX(tex->width_2d, tex->height_2d));
+
+		uint32_t wanted = stream.requested_size;
+		if (texture_stream_frame - stream.last_used_frame > TEXTURE_STREAM_UNUSED_FRAMES) {
+			wanted = 0;
+		} else if (wanted == 0) {
+			// Not drawn this frame, but recently enough to keep what is resident.
+			wanted = stream.size;
+		}
+		wanted = MAX(wanted, texture_stream_min_size);
+
+		// Pick the smallest mipmap that still covers the wanted size.
+		uint32_t size = candidate.full_size;
+		while (size / 2 >= wanted) {
+			size /= 2;
+		}
+		candidate.size = size;
+
+		total_size += _texture_stream_get_data_size(candidate, size);
+		stream.requested_size = 0;
+		candidates.push_back(candidate);
+	}
+
+	if (texture_stream_memory_budget > 0 && total_size > texture_stream_memory_budget) {
+		// Over budget, drop detail from the least recently used textures first.
+		candidates.sort();
+		for (uint32_t i = 0; i < candidates.size() && total_size > texture_stream_memory_budget; i++) {
+			TextureStreamCandidate &candidate = candidates[i];
+			while (candidate.size / 2 >= texture_stream_min_size && total_size > texture_stream_memory_budget) {
+				total_size -= _texture_stream_get_data_size(candidate, candidate.size) - _texture_stream_get_data_size(candidate, candidate.size / 2);
+				candidate.size /= 2;
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < candidates.size(); i++) {
+		TextureStreamCandidate &candidate = candidates[i];
+		if (candidate.size == candidate.stream->size) {
+			continue;
+		}
+		candidate.stream->size = candidate.size;
+		candidate.stream->callback(candidate.stream->callback_ud, candidate.size >= candidate.full_size ? 0 : candidate.size);
+	}
+}
+
 void TextureStorage::texture_debug_usage(List<RS::TextureInfo> *r_info) {
 }
 
@@ -190,6 +190,39 @@ private:
 	Ref<Image> _validate_texture_format(const Ref<Image> &p_image, TextureToRDFormat &r_format);
 	void _texture_2d_update(RID p_texture, const Ref<Image> &p_image, int p_layer = 0, bool p_immediate = false);
 
+	/* TEXTURE STREAMING */
+
+	enum {
+		TEXTURE_STREAM_UNUSED_FRAMES = 300, // Frames without feedback before a texture drops back to its initial size.
+	};
+
+	// Kept apart from Texture, as texture_replace() overwrites the whole Texture struct.
+	struct TextureStream {
+		RS::TextureStreamCallback callback = nullptr;
+		void *callback_ud = nullptr;
+		uint32_t requested_size = 0; // Largest size asked for by the renderer since the last update.
+		uint32_t size = 0; // Size last sent to the callback.
+		uint64_t last_used_frame = 0;
+	};
+
+	struct TextureStreamCandidate {
+		TextureStream *stream = nullptr;
+		Texture *texture = nullptr;
+		uint32_t full_size = 0;
+		uint32_t size = 0;
+
+		bool operator<(const TextureStreamCandidate &p_other) const {
+			return stream->last_used_frame < p_other.stream->last_used_frame;
+		}
+	};
+
+	HashMap<RID, TextureStream> texture_streams;
+	uint64_t texture_stream_frame = 0;
+	uint32_t texture_stream_min_size = 0;
+	uint64_t texture_stream_memory_budget = 0;
+
+	static uint64_t _texture_stream_get_data_size(const TextureStreamCandidate &p_candidate, uint32_t p_size);
+
 	/* DECAL API */
 
 	struct DecalAtlas {
@@ -485,6 +518,8 @@ public:
 	virtual void texture_set_detect_normal_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) override;
 	virtual void texture_set_detect_roughness_callback(RID p_texture, RS::TextureDetectRoughnessCallback p_callback, void *p_userdata) override;
 
+	virtual void texture_set_stream_callback(RID p_texture, RS::TextureStreamCallback p_callback, void *p_userdata) override;
+
 	virtual void texture_debug_usage(List<RS::TextureInfo> *r_info) override;
 
 	virtual void texture_set_force_redraw_if_visible(RID p_texture, bool p_enable) override;
@@ -536,6 +571,19 @@ public:
 		return Size2i(tex->width_2d, tex->height_2d);
 	}
 
+	bool texture_is_streamed(RID p_texture) const { return texture_streams.has(p_texture); }
+
+	_FORCE_INLINE_ void texture_stream_feedback(RID p_texture, uint32_t p_size) {
+		TextureStream *stream = texture_streams.getptr(p_texture);
+		if (!stream) {
+			return;
+		}
+		stream->requested_size = MAX(stream->requested_size, p_size);
+		stream->last_used_frame = texture_stream_frame;
+	}
+
+	void update_texture_streaming();
+
 	/* DECAL API */
 
 	void update_decal_atlas();
@@ -31,6 +31,7 @@
 #include "renderer_scene_cull.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/trace_profiler.h"
 #include "core/os/os.h"
 #include "rendering_server_default.h"
 #include "rendering_server_globals.h"
@@ -357,7 +358,8 @@ void RendererSceneCull::scenario_initialize(RID p_rid) {
 	Scenario *scenario = scenario_owner.get_or_null(p_rid);
 	scenario->self = p_rid;
 
-	scenario->reflection_probe_shadow_atlas = RSG::light_storage->shadow_atlas_create();
+	scenario->reflection_probe_shadow_atlas = RSG::light_storage->shadow_atlas_allocate();
+	RSG::light_storage->shadow_atlas_initialize(scenario->reflection_probe_shadow_atlas);
 	RSG::light_storage->shadow_atlas_set_size(scenario->reflection_probe_shadow_atlas, 1024); //make enough shadows for close distance, don't bother with rest
 	RSG::light_storage->shadow_atlas_set_quadrant_subdivision(scenario->reflection_probe_shadow_atlas, 0, 4);
 	RSG::light_storage->shadow_atlas_set_quadrant_subdivision(scenario->reflection_probe_shadow_atlas, 1, 4);
@@ -678,6 +680,7 @@ void RendererSceneCull::instance_set_base(RID p_instance, RID p_base) {
 			case RS::INSTANCE_VISIBLITY_NOTIFIER: {
 				InstanceVisibilityNotifierData *vnd = memnew(InstanceVisibilityNotifierData);
 				vnd->base = p_base;
+				vnd->owner = instance;
 				instance->base_data = vnd;
 			} break;
 			case RS::INSTANCE_REFLECTION_PROBE: {
@@ -857,11 +860,12 @@ void RendererSceneCull::instance_geometry_set_transparency(RID p_instance, float
 	}
 }
 
-void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D &p_transform) {
-	Instance *instance = instance_owner.get_or_null(p_instance);
-	ERR_FAIL_COND(!instance);
-
-	if (instance->transform == p_transform) {
+void RendererSceneCull::_instance_set_transform(Instance *p_instance, const Transform3D &p_transform) {
+	if (p_instance->interpolated) {
+		if (p_instance->transform_curr == p_transform) {
+			return;
+		}
+	} else if (p_instance->transform == p_transform) {
 		return; //must be checked to avoid worst evil
 	}
 
@@ -873,8 +877,72 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	}
 
 #endif
-	instance->transform = p_transform;
-	_instance_queue_update(instance, true);
+
+	if (p_instance->interpolated) {
+		// The rendered transform is blended every frame in update_interpolation_frame().
+		p_instance->transform_curr = p_transform;
+
+		if (!p_instance->on_interpolate_list) {
+			interpolation_data.instance_interpolate_update_list.push_back(p_instance->self);
+			p_instance->on_interpolate_list = true;
+		}
+		if (!p_instance->on_interpolate_transform_list) {
+			interpolation_data.instance_transform_update_list_curr->push_back(p_instance->self);
+			p_instance->on_interpolate_transform_list = true;
+		}
+		return;
+	}
+
+	p_instance->transform = p_transform;
+	_instance_queue_update(p_instance, true);
+}
+
+void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D &p_transform) {
+	Instance *instance = instance_owner.get_or_null(p_instance);
+	ERR_FAIL_COND(!instance);
+
+	_instance_set_transform(instance, p_transform);
+}
+
+void RendererSceneCull::instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	const RID *instances = p_instances.ptr();
+	const Transform3D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(instances[i]);
+		ERR_CONTINUE(!instance);
+
+		_instance_set_transform(instance, transforms[i]);
+	}
+}
+
+void RendererSceneCull::instance_set_interpolated(RID p_instance, bool p_interpolated) {
+	Instance *instance = instance_owner.get_or_null(p_instance);
+	ERR_FAIL_COND(!instance);
+
+	if (instance->interpolated == p_interpolated) {
+		return;
+	}
+
+	instance->interpolated = p_interpolated;
+	instance->transform_prev = instance->transform;
+	instance->transform_curr = instance->transform;
+}
+
+void RendererSceneCull::instance_reset_physics_interpolation(RID p_instance) {
+	Instance *instance = instance_owner.get_or_null(p_instance);
+	ERR_FAIL_COND(!instance);
+
+	if (!instance->interpolated) {
+		return;
+	}
+
+	instance->transform_prev = instance->transform_curr;
+	if (instance->transform != instance->transform_curr) {
+		instance->transform = instance->transform_curr;
+		_instance_queue_update(instance, true);
+	}
 }
 
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
@@ -1509,6 +1577,7 @@ void RendererSceneCull::instance_geometry_get_shader_parameter_list(RID p_instan
 
 void RendererSceneCull::_update_instance(Instance *p_instance) {
 	p_instance->version++;
+	p_instance->last_update_frame = RSG::rasterizer->get_frame_number();
 
 	if (p_instance->base_type == RS::INSTANCE_LIGHT) {
 		InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
@@ -2246,6 +2315,11 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 	bool animated_material_found = false;
 
+	// Casters that have not changed for a while are rendered into a separate static shadow atlas, which is only
+	// redrawn when static_version changes. Cube shadows are not cached.
+	bool use_static_cache = positional_shadow_static_cache && scene_render->is_static_shadow_cache_supported();
+	uint64_t frame = RSG::rasterizer->get_frame_number();
+
 	switch (RSG::light_storage->light_get_type(p_instance->base)) {
 		case RS::LIGHT_DIRECTIONAL: {
 		} break;
@@ -2291,6 +2365,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
 
 					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+					uint64_t static_version = p_instance->version;
 
 					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
 						Instance *instance = instance_shadow_cull_result[j];
@@ -2306,7 +2381,12 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 							}
 						}
 
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						if (use_static_cache && _instance_is_static_shadow_caster(instance, frame)) {
+							shadow_data.static_instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+							static_version += hash_murmur3_one_64(instance->version, hash_murmur3_one_64((uint64_t)instance));
+						} else {
+							shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						}
 					}
 
 					RSG::mesh_storage->update_mesh_instances();
@@ -2314,6 +2394,8 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					RSG::light_storage->light_instance_set_shadow_transform(light->instance, Projection(), light_transform, radius, 0, i, 0);
 					shadow_data.light = light->instance;
 					shadow_data.pass = i;
+					shadow_data.use_static_cache = use_static_cache;
+					shadow_data.static_version = static_version;
 				}
 			} else { //shadow cube
 
@@ -2432,6 +2514,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 			p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
 
 			RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+			uint64_t static_version = p_instance->version;
 
 			for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
 				Instance *instance = instance_shadow_cull_result[j];
@@ -2446,7 +2529,12 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 						RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
 					}
 				}
-				shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+				if (use_static_cache && _instance_is_static_shadow_caster(instance, frame)) {
+					shadow_data.static_instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+					static_version += hash_murmur3_one_64(instance->version, hash_murmur3_one_64((uint64_t)instance));
+				} else {
+					shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+				}
 			}
 
 			RSG::mesh_storage->update_mesh_instances();
@@ -2454,6 +2542,8 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 			RSG::light_storage->light_instance_set_shadow_transform(light->instance, cm, light_transform, radius, 0, 0, 0);
 			shadow_data.light = light->instance;
 			shadow_data.pass = 0;
+			shadow_data.use_static_cache = use_static_cache;
+			shadow_data.static_version = static_version;
 
 		} break;
 	}
@@ -2462,6 +2552,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 }
 
 void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_buffers, RID p_camera, RID p_scenario, RID p_viewport, Size2 p_viewport_size, bool p_use_taa, float p_screen_mesh_lod_threshold, RID p_shadow_atlas, Ref<XRInterface> &p_xr_interface, RenderInfo *r_render_info) {
+	TRACE_ZONE("RendererSceneCull::render_camera");
 #ifndef _3D_DISABLED
 
 	Camera *camera = camera_owner.get_or_null(p_camera);
@@ -2666,8 +2757,9 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 
 	RID instance_pair_buffer[MAX_INSTANCE_PAIRS];
 
-	Transform3D inv_cam_transform = cull_data.cam_transform.inverse();
-	float z_near = cull_data.camera_matrix->get_z_near();
+	Transform3D inv_cam_transform = cull_data.occlusion_cam_transform.inverse();
+	float z_near = cull_data.occlusion_camera_matrix->get_z_near();
+	Projection occlusion_view_projection = *cull_data.occlusion_camera_matrix * Projection(inv_cam_transform);
 
 	for (uint64_t i = p_from; i < p_to; i++) {
 		bool mesh_visible = false;
@@ -2682,7 +2774,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #define VIS_RANGE_CHECK ((idata.visibility_index == -1) || _visibility_range_check<false>(cull_data.scenario->instance_visibility[idata.visibility_index], cull_data.cam_transform.origin, cull_data.visibility_viewport_mask) == 0)
 #define VIS_PARENT_CHECK (_visibility_parent_check(cull_data, idata))
 #define VIS_CHECK (visibility_check < 0 ? (visibility_check = (visibility_flags != InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK || (VIS_RANGE_CHECK && VIS_PARENT_CHECK))) : visibility_check)
-#define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near))
+#define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded_view_projection(cull_data.scenario->instance_aabbs[i].bounds, cull_data.occlusion_cam_transform.origin, inv_cam_transform, occlusion_view_projection, z_near))
 
 		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
 			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
@@ -2700,6 +2792,10 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 
 						if ((idata.flags & InstanceData::FLAG_REFLECTION_PROBE_DIRTY) || RSG::light_storage->reflection_probe_instance_needs_redraw(RID::from_uint64(idata.instance_data_rid))) {
 							InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(idata.instance->base_data);
+							// Angular size approximates screen coverage, closer and larger probes update first.
+							const AABB &probe_aabb = idata.instance->transformed_aabb;
+							real_t probe_distance = MAX(probe_aabb.get_center().distance_to(cull_data.cam_transform.origin), (real_t)0.01);
+							reflection_probe->update_priority = probe_aabb.get_longest_axis_size() / probe_distance;
 							cull_data.cull->lock.lock();
 							if (!reflection_probe->update_list.in_list()) {
 								reflection_probe->render_step = 0;
@@ -3050,7 +3146,20 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		cull_data.visible_layers = p_visible_layers;
 		cull_data.render_reflection_probe = render_reflection_probe;
 		cull_data.occlusion_buffer = RendererSceneOcclusionCull::get_singleton()->buffer_get_ptr(p_viewport);
+		cull_data.occlusion_cam_transform = p_camera_data->main_transform;
+		cull_data.occlusion_camera_matrix = &p_camera_data->main_projection;
 		cull_data.camera_matrix = &p_camera_data->main_projection;
+
+		Projection gpu_occlusion_projection;
+		if (cull_data.occlusion_buffer == nullptr && p_reflection_probe.is_null() && p_camera_data->view_count == 1) {
+			// Fall back to the buffer the renderer builds from the depth of a previous frame, if any.
+			cull_data.occlusion_buffer = scene_render->render_buffers_get_occlusion_buffer(p_render_buffers, cull_data.occlusion_cam_transform, gpu_occlusion_projection);
+			if (cull_data.occlusion_buffer != nullptr) {
+				cull_data.occlusion_camera_matrix = &gpu_occlusion_projection;
+			} else {
+				cull_data.occlusion_cam_transform = p_camera_data->main_transform;
+			}
+		}
 		cull_data.visibility_viewport_mask = scenario->viewport_visibility_masks.has(p_viewport) ? scenario->viewport_visibility_masks[p_viewport] : 0;
 //#define DEBUG_CULL_TIME
 #ifdef DEBUG_CULL_TIME
@@ -3275,6 +3384,8 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 	for (uint32_t i = 0; i < max_shadows_used; i++) {
 		render_shadow_data[i].instances.clear();
+		render_shadow_data[i].static_instances.clear();
+		render_shadow_data[i].use_static_cache = false;
 	}
 	max_shadows_used = 0;
 
@@ -3411,6 +3522,10 @@ void RendererSceneCull::render_probes() {
 
 	bool busy = false;
 
+	// With a budget, UPDATE_ALWAYS probes are time-sliced: each step renders one cubemap face
+	// or runs the filter, and probes keep their progress across frames until they are done.
+	LocalVector<InstanceReflectionProbeData *> budgeted_probes;
+
 	while (ref_probe) {
 		SelfList<InstanceReflectionProbeData> *next = ref_probe->next();
 		RID base = ref_probe->self()->owner->base;
@@ -3431,6 +3546,11 @@ void RendererSceneCull::render_probes() {
 				busy = true; //do not render another one of this kind
 			} break;
 			case RS::REFLECTION_PROBE_UPDATE_ALWAYS: {
+				if (reflection_probe_update_budget > 0) {
+					budgeted_probes.push_back(ref_probe->self());
+					break;
+				}
+
 				int step = 0;
 				bool done = false;
 				while (!done) {
@@ -3445,6 +3565,42 @@ void RendererSceneCull::render_probes() {
 		ref_probe = next;
 	}
 
+	if (budgeted_probes.size()) {
+		struct ProbeUpdateSort {
+			_FORCE_INLINE_ bool operator()(const InstanceReflectionProbeData *p_a, const InstanceReflectionProbeData *p_b) const {
+				// Finish probes that are already mid-update so they don't show mixed faces for long,
+				// then favor apparent size, scaled by waiting time so distant probes still get their turn.
+				if ((p_a->render_step > 0) != (p_b->render_step > 0)) {
+					return p_a->render_step > 0;
+				}
+				return p_a->update_priority * (p_a->update_wait_frames + 1) > p_b->update_priority * (p_b->update_wait_frames + 1);
+			}
+		};
+
+		budgeted_probes.sort_custom<ProbeUpdateSort>();
+
+		uint32_t steps_left = reflection_probe_update_budget;
+		for (uint32_t i = 0; i < budgeted_probes.size(); i++) {
+			InstanceReflectionProbeData *probe = budgeted_probes[i];
+			if (steps_left == 0) {
+				probe->update_wait_frames++;
+				continue;
+			}
+
+			probe->update_wait_frames = 0;
+			bool done = false;
+			while (!done && steps_left > 0) {
+				done = _render_reflection_probe_step(probe->owner, probe->render_step);
+				probe->render_step++;
+				steps_left--;
+			}
+
+			if (done) {
+				reflection_probe_render_list.remove(&probe->update_list);
+			}
+		}
+	}
+
 	/* VOXEL GIS */
 
 	SelfList<InstanceVoxelGIData> *voxel_gi = voxel_gi_update_list.first();
@@ -4032,7 +4188,65 @@ TypedArray<Image> RendererSceneCull::bake_render_uv2(RID p_base, const TypedArra
 	return scene_render->bake_render_uv2(p_base, p_material_overrides, p_image_size);
 }
 
+void RendererSceneCull::tick() {
+	// Instances moved on the previous tick but not on this one have come to rest,
+	// snap them to their final transform and stop interpolating them.
+	LocalVector<RID> &prev_list = *interpolation_data.instance_transform_update_list_prev;
+	for (uint32_t i = 0; i < prev_list.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(prev_list[i]);
+		if (!instance || instance->on_interpolate_transform_list) {
+			continue;
+		}
+
+		instance->transform_prev = instance->transform_curr;
+		if (instance->interpolated && instance->transform != instance->transform_curr) {
+			instance->transform = instance->transform_curr;
+			_instance_queue_update(instance, true);
+		}
+		instance->on_interpolate_list = false;
+	}
+
+	LocalVector<RID> &curr_list = *interpolation_data.instance_transform_update_list_curr;
+	for (uint32_t i = 0; i < curr_list.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(curr_list[i]);
+		if (!instance) {
+			continue;
+		}
+
+		instance->transform_prev = instance->transform_curr;
+		instance->on_interpolate_transform_list = false;
+	}
+
+	SWAP(interpolation_data.instance_transform_update_list_curr, interpolation_data.instance_transform_update_list_prev);
+	interpolation_data.instance_transform_update_list_curr->clear();
+}
+
+void RendererSceneCull::update_interpolation_frame(double p_fraction) {
+	LocalVector<RID> &list = interpolation_data.instance_interpolate_update_list;
+	uint32_t i = 0;
+	while (i < list.size()) {
+		Instance *instance = instance_owner.get_or_null(list[i]);
+		if (!instance || !instance->interpolated || !instance->on_interpolate_list) {
+			if (instance) {
+				instance->on_interpolate_list = false;
+			}
+			list.remove_at_unordered(i);
+			continue;
+		}
+
+		Transform3D transform = instance->transform_prev.interpolate_with(instance->transform_curr, p_fraction);
+		if (transform != instance->transform) {
+			instance->transform = transform;
+			_instance_queue_update(instance, true);
+		}
+		i++;
+	}
+}
+
 void RendererSceneCull::update_visibility_notifiers() {
+	MutexLock lock(visibility_notifier_changes_mutex);
+	uint32_t change_count = visibility_notifier_changes.size();
+
 	SelfList<InstanceVisibilityNotifierData> *E = visible_notifier_list.first();
 	while (E) {
 		SelfList<InstanceVisibilityNotifierData> *N = E->next();
@@ -4042,16 +4256,77 @@ void RendererSceneCull::update_visibility_notifiers() {
 			visibility_notifier->just_visible = false;
 
 			RSG::utilities->visibility_notifier_call(visibility_notifier->base, true, RSG::threaded);
+			if (visibility_notifier_changes_enabled && visibility_notifier->owner->object_id.is_valid()) {
+				visibility_notifier_changes.push_back({ visibility_notifier->owner->object_id, true });
+			}
 		} else {
 			if (visibility_notifier->visible_in_frame != RSG::rasterizer->get_frame_number()) {
 				visible_notifier_list.remove(E);
 
 				RSG::utilities->visibility_notifier_call(visibility_notifier->base, false, RSG::threaded);
+				if (visibility_notifier_changes_enabled && visibility_notifier->owner->object_id.is_valid()) {
+					visibility_notifier_changes.push_back({ visibility_notifier->owner->object_id, false });
+				}
 			}
 		}
 
 		E = N;
 	}
+
+	if (visibility_notifier_changes.size() != change_count) {
+		visibility_notifier_change_frames++;
+	}
+}
+
+void RendererSceneCull::visibility_notifier_take_changes(Vector<ObjectID> &r_entered, Vector<ObjectID> &r_exited) {
+	LocalVector<VisibilityNotifierChange> changes;
+	uint32_t change_frames;
+	{
+		MutexLock lock(visibility_notifier_changes_mutex);
+		visibility_notifier_changes_enabled = true;
+		SWAP(changes, visibility_notifier_changes);
+		change_frames = visibility_notifier_change_frames;
+		visibility_notifier_change_frames = 0;
+	}
+
+	r_entered.clear();
+	r_exited.clear();
+
+	if (change_frames <= 1) {
+		// A notifier changes at most once per frame, so there is nothing to merge.
+		for (uint32_t i = 0; i < changes.size(); i++) {
+			if (changes[i].entered) {
+				r_entered.push_back(changes[i].object_id);
+			} else {
+				r_exited.push_back(changes[i].object_id);
+			}
+		}
+		return;
+	}
+
+	// Changes from several frames were queued. Enter and exit alternate for each notifier,
+	// so only notifiers with an odd number of changes end up in a different state.
+	HashMap<ObjectID, uint32_t> change_counts;
+	for (uint32_t i = 0; i < changes.size(); i++) {
+		HashMap<ObjectID, uint32_t>::Iterator E = change_counts.find(changes[i].object_id);
+		if (E) {
+			E->value++;
+		} else {
+			change_counts.insert(changes[i].object_id, 1);
+		}
+	}
+	// Walk backwards so the first change seen for a notifier is its last one.
+	for (int64_t i = int64_t(changes.size()) - 1; i >= 0; i--) {
+		uint32_t &count = change_counts[changes[i].object_id];
+		if (count % 2 == 1) {
+			if (changes[i].entered) {
+				r_entered.push_back(changes[i].object_id);
+			} else {
+				r_exited.push_back(changes[i].object_id);
+			}
+		}
+		count = 0;
+	}
 }
 
 /*******************************/
@@ -4087,6 +4362,7 @@ RendererSceneCull::RendererSceneCull() {
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
+		render_shadow_data[i].static_instances.set_page_pool(&geometry_instance_cull_page_pool);
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
@@ -4101,6 +4377,8 @@ RendererSceneCull::RendererSceneCull() {
 	indexer_update_iterations = GLOBAL_GET("rendering/limits/spatial_indexer/update_iterations_per_frame");
 	thread_cull_threshold = GLOBAL_GET("rendering/limits/spatial_indexer/threaded_cull_minimum_instances");
 	thread_cull_threshold = MAX(thread_cull_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); //make sure there is at least one thread per CPU
+	positional_shadow_static_cache = GLOBAL_GET("rendering/lights_and_shadows/positional_shadow/static_cache");
+	reflection_probe_update_budget = GLOBAL_GET("rendering/reflections/probes/update_always_steps_per_frame");
 
 	taa_jitter_array.resize(TAA_JITTER_COUNT);
 	for (int i = 0; i < TAA_JITTER_COUNT; i++) {
@@ -4117,6 +4395,7 @@ RendererSceneCull::~RendererSceneCull() {
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.reset();
+		render_shadow_data[i].static_instances.reset();
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.reset();
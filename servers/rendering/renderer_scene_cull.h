@@ -53,7 +53,8 @@ public:
 		SDFGI_MAX_CASCADES = 8,
 		SDFGI_MAX_REGIONS_PER_CASCADE = 3,
 		MAX_INSTANCE_PAIRS = 32,
-		MAX_UPDATE_SHADOWS = 512
+		MAX_UPDATE_SHADOWS = 512,
+		STATIC_SHADOW_CASTER_FRAMES = 8, // Frames a caster has to stay untouched before it goes to the static shadow cache.
 	};
 
 	uint64_t render_pass;
@@ -391,6 +392,13 @@ public:
 
 		Transform3D transform;
 
+		// Physics interpolation, the rendered transform is blended between these two.
+		Transform3D transform_prev;
+		Transform3D transform_curr;
+		bool interpolated = false;
+		bool on_interpolate_list = false;
+		bool on_interpolate_transform_list = false;
+
 		float lod_bias;
 
 		bool ignore_occlusion_culling;
@@ -464,6 +472,7 @@ public:
 		uint64_t last_frame_pass;
 
 		uint64_t version; // changes to this, and changes to base increase version
+		uint64_t last_update_frame;
 
 		InstanceBaseData *base_data = nullptr;
 
@@ -552,6 +561,7 @@ public:
 
 			last_frame_pass = 0;
 			version = 1;
+			last_update_frame = 0;
 			base_data = nullptr;
 
 			custom_aabb = nullptr;
@@ -575,6 +585,16 @@ public:
 	};
 
 	SelfList<Instance>::List _instance_update_list;
+
+	struct InterpolationData {
+		// Instances whose rendered transform is interpolated every frame.
+		LocalVector<RID> instance_interpolate_update_list;
+		// Instances moved during the current and the previous physics tick.
+		LocalVector<RID> instance_transform_update_lists[2];
+		LocalVector<RID> *instance_transform_update_list_curr = &instance_transform_update_lists[0];
+		LocalVector<RID> *instance_transform_update_list_prev = &instance_transform_update_lists[1];
+	} interpolation_data;
+
 	void _instance_queue_update(Instance *p_instance, bool p_update_aabb, bool p_update_dependencies = false);
 
 	struct InstanceGeometryData : public InstanceBaseData {
@@ -605,6 +625,8 @@ public:
 		SelfList<InstanceReflectionProbeData> update_list;
 
 		int render_step;
+		float update_priority = 0.0; // Apparent size from the last camera that saw it.
+		uint32_t update_wait_frames = 0; // Frames spent queued without being granted a step.
 
 		InstanceReflectionProbeData() :
 				update_list(this) {
@@ -637,6 +659,7 @@ public:
 		bool just_visible = false;
 		uint64_t visible_in_frame = 0;
 		RID base;
+		Instance *owner = nullptr;
 		SelfList<InstanceVisibilityNotifierData> list_element;
 		InstanceVisibilityNotifierData() :
 				list_element(this) {}
@@ -645,6 +668,18 @@ public:
 	SpinLock visible_notifier_list_lock;
 	SelfList<InstanceVisibilityNotifierData>::List visible_notifier_list;
 
+	struct VisibilityNotifierChange {
+		ObjectID object_id;
+		bool entered = false;
+	};
+
+	// Screen enter/exit changes of notifier owners, queued on the render side and
+	// taken by the main thread in one batch. Only queued once somebody takes them.
+	Mutex visibility_notifier_changes_mutex;
+	LocalVector<VisibilityNotifierChange> visibility_notifier_changes;
+	uint32_t visibility_notifier_change_frames = 0;
+	bool visibility_notifier_changes_enabled = false;
+
 	struct InstanceLightData : public InstanceBaseData {
 		RID instance;
 		uint64_t last_version;
@@ -919,6 +954,8 @@ public:
 	RendererSceneRender::RenderSDFGIUpdateData sdfgi_update_data;
 
 	uint32_t thread_cull_threshold = 200;
+	bool positional_shadow_static_cache = false;
+	uint32_t reflection_probe_update_budget = 0; // Steps per frame for UPDATE_ALWAYS probes, 0 is unlimited.
 
 	RID_Owner<Instance, true> instance_owner;
 
@@ -933,7 +970,11 @@ public:
 	virtual void instance_set_base(RID p_instance, RID p_base);
 	virtual void instance_set_scenario(RID p_instance, RID p_scenario);
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
+	_FORCE_INLINE_ void _instance_set_transform(Instance *p_instance, const Transform3D &p_transform);
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform);
+	virtual void instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms);
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated);
+	virtual void instance_reset_physics_interpolation(RID p_instance);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material);
@@ -983,6 +1024,9 @@ public:
 
 	void _light_instance_setup_directional_shadow(int p_shadow_index, Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect);
 
+	_FORCE_INLINE_ bool _instance_is_static_shadow_caster(const Instance *p_instance, uint64_t p_frame) const {
+		return p_instance->base_type == RS::INSTANCE_MESH && p_instance->mesh_instance.is_null() && !static_cast<const InstanceGeometryData *>(p_instance->base_data)->material_is_animated && p_frame - p_instance->last_update_frame > STATIC_SHADOW_CASTER_FRAMES;
+	}
 	_FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_scren_mesh_lod_threshold);
 
 	RID _render_get_environment(RID p_camera, RID p_scenario);
@@ -1046,6 +1090,8 @@ public:
 		uint32_t visible_layers;
 		Instance *render_reflection_probe = nullptr;
 		const RendererSceneOcclusionCull::HZBuffer *occlusion_buffer;
+		Transform3D occlusion_cam_transform; // Camera the occlusion buffer was generated from.
+		const Projection *occlusion_camera_matrix;
 		const Projection *camera_matrix;
 		uint64_t visibility_viewport_mask;
 	};
@@ -1270,6 +1316,10 @@ public:
 	void set_scene_render(RendererSceneRender *p_scene_render);
 
 	virtual void update_visibility_notifiers();
+	virtual void visibility_notifier_take_changes(Vector<ObjectID> &r_entered, Vector<ObjectID> &r_exited);
+
+	virtual void tick();
+	virtual void update_interpolation_frame(double p_fraction);
 
 	RendererSceneCull();
 	virtual ~RendererSceneCull();
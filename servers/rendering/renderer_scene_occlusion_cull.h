@@ -61,6 +61,12 @@ public:
 		void update_mips();
 
 		_FORCE_INLINE_ bool is_occluded(const real_t p_bounds[6], const Vector3 &p_cam_position, const Transform3D &p_cam_inv_transform, const Projection &p_cam_projection, real_t p_near) const {
+			return is_occluded_view_projection(p_bounds, p_cam_position, p_cam_inv_transform, p_cam_projection * Projection(p_cam_inv_transform), p_near);
+		}
+
+		// Same test, with p_cam_view_projection being the camera projection times p_cam_inv_transform.
+		// Callers testing many bounds against the same camera compute it once.
+		_FORCE_INLINE_ bool is_occluded_view_projection(const real_t p_bounds[6], const Vector3 &p_cam_position, const Transform3D &p_cam_inv_transform, const Projection &p_cam_view_projection, real_t p_near) const {
 			if (is_empty()) {
 				return false;
 			}
@@ -71,33 +77,37 @@ public:
 				return false;
 			}
 
-			Vector3 closest_point_view = p_cam_inv_transform.xform(closest_point);
-			if (closest_point_view.z > -p_near) {
+			// Only the view depth is needed here.
+			const Basis &inv_basis = p_cam_inv_transform.basis;
+			real_t closest_point_view_z = inv_basis.rows[2].dot(closest_point) + p_cam_inv_transform.origin.z;
+			if (closest_point_view_z > -p_near) {
 				return false;
 			}
 
-			float min_depth = -closest_point_view.z * 0.95f;
+			float min_depth = -closest_point_view_z * 0.95f;
 
 			Vector2 rect_min = Vector2(FLT_MAX, FLT_MAX);
 			Vector2 rect_max = Vector2(FLT_MIN, FLT_MIN);
 
-			for (int j = 0; j < 8; j++) {
-				const Vector3 &c = RendererSceneOcclusionCull::HZBuffer::corners[j];
-				Vector3 nc = Vector3(1, 1, 1) - c;
-				Vector3 corner = Vector3(p_bounds[0] * c.x + p_bounds[3] * nc.x, p_bounds[1] * c.y + p_bounds[4] * nc.y, p_bounds[2] * c.z + p_bounds[5] * nc.z);
-				Vector3 view = p_cam_inv_transform.xform(corner);
+			// The projection is linear, so each corner is the sum of one of two precomputed terms per axis.
+			const Vector4 *columns = p_cam_view_projection.columns;
+			const Vector4 axis_terms[3][2] = {
+				{ columns[0] * p_bounds[0], columns[0] * p_bounds[3] },
+				{ columns[1] * p_bounds[1], columns[1] * p_bounds[4] },
+				{ columns[2] * p_bounds[2], columns[2] * p_bounds[5] },
+			};
 
-				Plane vp = Plane(view, 1.0);
-				Plane projected = p_cam_projection.xform4(vp);
+			for (int j = 0; j < 8; j++) {
+				Vector4 projected = axis_terms[0][(j >> 2) & 1] + axis_terms[1][(j >> 1) & 1] + axis_terms[2][j & 1] + columns[3];
 
-				float w = projected.d;
+				float w = projected.w;
 				if (w < 1.0) {
 					rect_min = Vector2(0.0f, 0.0f);
 					rect_max = Vector2(1.0f, 1.0f);
 					break;
 				}
 
-				Vector2 normalized = Vector2(projected.normal.x / w * 0.5f + 0.5f, projected.normal.y / w * 0.5f + 0.5f);
+				Vector2 normalized = Vector2(projected.x / w * 0.5f + 0.5f, projected.y / w * 0.5f + 0.5f);
 				rect_min = rect_min.min(normalized);
 				rect_max = rect_max.max(normalized);
 			}
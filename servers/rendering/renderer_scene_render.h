@@ -34,6 +34,7 @@
 #include "core/math/projection.h"
 #include "core/templates/paged_array.h"
 #include "servers/rendering/renderer_geometry_instance.h"
+#include "servers/rendering/renderer_scene_occlusion_cull.h"
 #include "servers/rendering/rendering_method.h"
 #include "servers/rendering/storage/environment_storage.h"
 #include "storage/render_scene_buffers.h"
@@ -246,8 +247,15 @@ public:
 		RID light;
 		int pass = 0;
 		PagedArray<RenderGeometryInstance *> instances;
+
+		// Only filled when use_static_cache is set, static_version changes whenever these need to be redrawn.
+		PagedArray<RenderGeometryInstance *> static_instances;
+		uint64_t static_version = 0;
+		bool use_static_cache = false;
 	};
 
+	virtual bool is_static_shadow_cache_supported() const { return false; }
+
 	struct RenderSDFGIData {
 		int region = 0;
 		PagedArray<RenderGeometryInstance *> instances;
@@ -293,6 +301,8 @@ public:
 	virtual void set_debug_draw_mode(RS::ViewportDebugDraw p_debug_draw) = 0;
 
 	virtual Ref<RenderSceneBuffers> render_buffers_create() = 0;
+	// Occlusion buffer built by the renderer itself from a previous frame, with the camera it was rendered from.
+	virtual const RendererSceneOcclusionCull::HZBuffer *render_buffers_get_occlusion_buffer(const Ref<RenderSceneBuffers> &p_render_buffers, Transform3D &r_cam_transform, Projection &r_cam_projection) { return nullptr; }
 	virtual void gi_set_use_half_resolution(bool p_enable) = 0;
 
 	virtual void screen_space_roughness_limiter_set_active(bool p_enable, float p_amount, float p_limit) = 0;
@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "renderer_canvas_cull.h"
 #include "renderer_scene_cull.h"
+#include "rendering_server_default.h"
 #include "rendering_server_globals.h"
 #include "storage/texture_storage.h"
 
@@ -656,6 +657,9 @@ void RendererViewport::draw_viewports() {
 	int objects_drawn = 0;
 	int draw_calls_used = 0;
 
+	uint64_t canvas_changes = RenderingServerDefault::get_canvas_changes();
+	bool any_viewport_drawn = false; // Viewports drawn this frame may be shown by the following ones through a ViewportTexture.
+
 	for (int i = 0; i < sorted_active_viewports.size(); i++) {
 		Viewport *vp = sorted_active_viewports[i];
 
@@ -663,6 +667,8 @@ void RendererViewport::draw_viewports() {
 			continue; //should not draw
 		}
 
+		bool skip_draw = false;
+
 		RENDER_TIMESTAMP("> Render Viewport " + itos(i));
 
 		RSG::texture_storage->render_target_set_as_unused(vp->render_target);
@@ -682,6 +688,7 @@ void RendererViewport::draw_viewports() {
 
 				// and draw viewport
 				_draw_viewport(vp);
+				any_viewport_drawn = true;
 
 				// commit our eyes
 				Vector<BlitToScreen> blits = xr_interface->post_draw_viewport(vp->render_target, vp->viewport_to_screen_rect);
@@ -707,8 +714,17 @@ void RendererViewport::draw_viewports() {
 
 			RSG::scene->set_debug_draw_mode(vp->debug_draw);
 
-			// render standard mono camera
-			_draw_viewport(vp);
+			// 2D viewports keep the contents of their render target when nothing they may show changed since they were
+			// last drawn, only the blit to screen is done again.
+			if (redraw_2d_on_demand && vp->last_drawn_canvas_changes == canvas_changes && !any_viewport_drawn && !vp->viewport_render_direct_to_screen && (vp->disable_3d || !RSG::scene->is_camera(vp->camera))) {
+				skip_draw = true;
+				RSG::canvas->retain_visibility_notifiers();
+			} else {
+				// render standard mono camera
+				_draw_viewport(vp);
+				vp->last_drawn_canvas_changes = canvas_changes;
+				any_viewport_drawn = true;
+			}
 
 			if (vp->viewport_to_screen != DisplayServer::INVALID_WINDOW_ID && (!vp->viewport_render_direct_to_screen || !RSG::rasterizer->is_low_end())) {
 				//copy to screen if set as such
@@ -742,6 +758,10 @@ void RendererViewport::draw_viewports() {
 
 		RENDER_TIMESTAMP("< Render Viewport " + itos(i));
 
+		if (skip_draw) {
+			continue;
+		}
+
 		objects_drawn += vp->render_info.info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME] + vp->render_info.info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME];
 		vertices_drawn += vp->render_info.info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] + vp->render_info.info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME];
 		draw_calls_used += vp->render_info.info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME] + vp->render_info.info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME];
@@ -770,7 +790,8 @@ void RendererViewport::viewport_initialize(RID p_rid) {
 	Viewport *viewport = viewport_owner.get_or_null(p_rid);
 	viewport->self = p_rid;
 	viewport->render_target = RSG::texture_storage->render_target_create();
-	viewport->shadow_atlas = RSG::light_storage->shadow_atlas_create();
+	viewport->shadow_atlas = RSG::light_storage->shadow_atlas_allocate();
+	RSG::light_storage->shadow_atlas_initialize(viewport->shadow_atlas);
 	viewport->viewport_render_direct_to_screen = false;
 
 	viewport->fsr_enabled = !RSG::rasterizer->is_low_end() && !viewport->disable_3d;
@@ -1378,4 +1399,5 @@ int RendererViewport::get_total_draw_calls_used() const {
 
 RendererViewport::RendererViewport() {
 	occlusion_rays_per_thread = GLOBAL_GET("rendering/occlusion_culling/occlusion_rays_per_thread");
+	redraw_2d_on_demand = GLOBAL_GET("rendering/2d/redraw_on_demand");
 }
@@ -107,6 +107,7 @@ public:
 		float mesh_lod_threshold = 1.0;
 
 		uint64_t last_pass = 0;
+		uint64_t last_drawn_canvas_changes = UINT64_MAX; // RenderingServerDefault::get_canvas_changes() when last drawn.
 
 		RS::ViewportDebugDraw debug_draw = RenderingServer::VIEWPORT_DEBUG_DRAW_DISABLED;
 
@@ -204,6 +205,7 @@ private:
 	void _draw_viewport(Viewport *p_viewport);
 
 	int occlusion_rays_per_thread = 512;
+	bool redraw_2d_on_demand = false;
 
 	void _resize_occlusion_culling_buffer(const Size2i &p_size);
 
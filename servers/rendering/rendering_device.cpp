@@ -64,7 +64,25 @@ Vector<uint8_t> RenderingDevice::shader_compile_spirv_from_source(ShaderStage p_
 
 	ERR_FAIL_COND_V(!compile_to_spirv_function, Vector<uint8_t>());
 
-	return compile_to_spirv_function(p_stage, p_source_code, p_language, r_error, this);
+	if (!p_allow_cache) {
+		return compile_to_spirv_function(p_stage, p_source_code, p_language, r_error, this);
+	}
+
+	String key = itos(p_stage) + ":" + itos(p_language) + ":" + p_source_code;
+	{
+		MutexLock lock(spirv_cache_mutex);
+		const Vector<uint8_t> *cached = spirv_cache.getptr(key);
+		if (cached) {
+			return *cached;
+		}
+	}
+
+	Vector<uint8_t> spirv = compile_to_spirv_function(p_stage, p_source_code, p_language, r_error, this);
+	if (spirv.size()) {
+		MutexLock lock(spirv_cache_mutex);
+		spirv_cache.insert(key, spirv);
+	}
+	return spirv;
 }
 
 String RenderingDevice::shader_get_spirv_cache_key() const {
@@ -420,6 +438,7 @@ void RenderingDevice::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("buffer_update", "buffer", "offset", "size_bytes", "data", "post_barrier"), &RenderingDevice::_buffer_update, DEFVAL(BARRIER_MASK_ALL_BARRIERS));
 	ClassDB::bind_method(D_METHOD("buffer_clear", "buffer", "offset", "size_bytes", "post_barrier"), &RenderingDevice::buffer_clear, DEFVAL(BARRIER_MASK_ALL_BARRIERS));
 	ClassDB::bind_method(D_METHOD("buffer_get_data", "buffer"), &RenderingDevice::buffer_get_data);
+	ClassDB::bind_method(D_METHOD("buffer_get_data_async", "buffer", "callback"), &RenderingDevice::buffer_get_data_async);
 
 	ClassDB::bind_method(D_METHOD("render_pipeline_create", "shader", "framebuffer_format", "vertex_format", "primitive", "rasterization_state", "multisample_state", "stencil_state", "color_blend_state", "dynamic_state_flags", "for_render_pass", "specialization_constants"), &RenderingDevice::_render_pipeline_create, DEFVAL(0), DEFVAL(0), DEFVAL(TypedArray<RDPipelineSpecializationConstant>()));
 	ClassDB::bind_method(D_METHOD("render_pipeline_is_valid", "render_pipeline"), &RenderingDevice::render_pipeline_is_valid);
@@ -992,7 +1011,8 @@ void RenderingDevice::_bind_methods() {
 	BIND_CONSTANT(INVALID_FORMAT_ID);
 }
 
-RenderingDevice::RenderingDevice() {
+RenderingDevice::RenderingDevice() :
+		spirv_cache(SPIRV_CACHE_SIZE) {
 	if (singleton == nullptr) { // there may be more rendering devices later
 		singleton = this;
 	}
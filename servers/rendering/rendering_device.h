@@ -32,6 +32,8 @@
 #define RENDERING_DEVICE_H
 
 #include "core/object/class_db.h"
+#include "core/os/mutex.h"
+#include "core/templates/lru.h"
 #include "core/variant/typed_array.h"
 #include "servers/display_server.h"
 
@@ -136,6 +138,11 @@ private:
 	static ShaderCacheFunction cache_function;
 	static ShaderSPIRVGetCacheKeyFunction get_spirv_cache_key_function;
 
+	// Recently compiled SPIR-V keyed by stage, language and source, so identical sources only compile once.
+	static const int SPIRV_CACHE_SIZE = 256;
+	Mutex spirv_cache_mutex;
+	LRUCache<String, Vector<uint8_t>> spirv_cache;
+
 	static RenderingDevice *singleton;
 
 protected:
@@ -829,6 +836,7 @@ public:
 	virtual Error buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS) = 0;
 	virtual Error buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS) = 0;
 	virtual Vector<uint8_t> buffer_get_data(RID p_buffer) = 0; //this causes stall, only use to retrieve large buffers for saving
+	virtual Error buffer_get_data_async(RID p_buffer, const Callable &p_callback) = 0; //callback receives the data once the GPU is done with the frame, no stall
 
 	/******************************************/
 	/**** PIPELINE SPECIALIZATION CONSTANT ****/
@@ -1165,6 +1173,7 @@ public:
 	virtual void draw_list_set_push_constant(DrawListID p_list, const void *p_data, uint32_t p_data_size) = 0;
 
 	virtual void draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances = 1, uint32_t p_procedural_vertices = 0) = 0;
+	virtual void draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset = 0, uint32_t p_draw_count = 1, uint32_t p_stride = 0) = 0;
 
 	virtual void draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect) = 0;
 	virtual void draw_list_disable_scissor(DrawListID p_list) = 0;
@@ -1269,6 +1278,7 @@ public:
 	virtual void swap_buffers() = 0;
 
 	virtual uint32_t get_frame_delay() const = 0;
+	virtual uint64_t get_frame_wait_time_usec() const = 0; // Time the CPU last spent blocked on the GPU before reusing a frame.
 
 	virtual void submit() = 0;
 	virtual void sync() = 0;
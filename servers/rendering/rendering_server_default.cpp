@@ -30,6 +30,7 @@
 
 #include "rendering_server_default.h"
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
@@ -41,6 +42,7 @@
 // careful, these may run in different threads than the rendering server
 
 int RenderingServerDefault::changes = 0;
+uint64_t RenderingServerDefault::canvas_changes = 0;
 
 /* FREE */
 
@@ -68,7 +70,8 @@ void RenderingServerDefault::request_frame_drawn_callback(const Callable &p_call
 	frame_drawn_callbacks.push_back(p_callable);
 }
 
-void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
+void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step, uint64_t p_frame_begin_ticks, double p_interpolation_fraction) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_RENDER);
 	//needs to be done before changes is reset to 0, to not force the editor to redraw
 	RS::get_singleton()->emit_signal(SNAME("frame_pre_draw"));
 
@@ -80,6 +83,7 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 
 	uint64_t time_usec = OS::get_singleton()->get_ticks_usec();
 
+	RSG::scene->update_interpolation_frame(p_interpolation_fraction);
 	RSG::scene->update(); //update scenes stuff before updating instances
 
 	frame_setup_time = double(OS::get_singleton()->get_ticks_usec() - time_usec) / 1000.0;
@@ -96,6 +100,9 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 		RSG::rasterizer->end_frame(p_swap_buffers);
 	}
 
+	uint64_t present_ticks = OS::get_singleton()->get_ticks_usec();
+	frame_wait_time = RenderingDevice::get_singleton() ? double(RenderingDevice::get_singleton()->get_frame_wait_time_usec()) / 1000.0 : 0.0;
+
 	XRServer *xr_server = XRServer::get_singleton();
 	if (xr_server != nullptr) {
 		// let our XR server know we're done so we can get our frame timing
@@ -149,6 +156,16 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 
 	frame_profile_frame = RSG::utilities->get_captured_timestamps_frame();
 
+	// Time from the start of the main loop iteration (where input is flushed) until the frame was handed to the swapchain,
+	// plus the GPU time of the last profiled frame, as the GPU results only come back a few frames later.
+	if (p_frame_begin_ticks == 0 || p_frame_begin_ticks > present_ticks) {
+		p_frame_begin_ticks = time_usec;
+	}
+	frame_latency_estimate = double(present_ticks - p_frame_begin_ticks) / 1000.0;
+	if (RSG::utilities->capturing_timestamps && frame_profile.size()) {
+		frame_latency_estimate += frame_profile[frame_profile.size() - 1].gpu_msec;
+	}
+
 	if (print_gpu_profile) {
 		if (print_frame_profile_ticks_from == 0) {
 			print_frame_profile_ticks_from = OS::get_singleton()->get_ticks_usec();
@@ -201,6 +218,18 @@ double RenderingServerDefault::get_frame_setup_time_cpu() const {
 	return frame_setup_time;
 }
 
+double RenderingServerDefault::get_frame_sync_time_cpu() const {
+	return frame_sync_time;
+}
+
+double RenderingServerDefault::get_frame_wait_time_cpu() const {
+	return frame_wait_time;
+}
+
+double RenderingServerDefault::get_frame_latency_estimate() const {
+	return frame_latency_estimate;
+}
+
 bool RenderingServerDefault::has_changed() const {
 	return changes > 0;
 }
@@ -343,8 +372,8 @@ void RenderingServerDefault::_thread_exit() {
 	exit.set();
 }
 
-void RenderingServerDefault::_thread_draw(bool p_swap_buffers, double frame_step) {
-	_draw(p_swap_buffers, frame_step);
+void RenderingServerDefault::_thread_draw(bool p_swap_buffers, double frame_step, uint64_t p_frame_begin_ticks, double p_interpolation_fraction) {
+	_draw(p_swap_buffers, frame_step, p_frame_begin_ticks, p_interpolation_fraction);
 }
 
 void RenderingServerDefault::_thread_flush() {
@@ -377,18 +406,22 @@ void RenderingServerDefault::_thread_loop() {
 /* EVENT QUEUING */
 
 void RenderingServerDefault::sync() {
+	uint64_t sync_begin = OS::get_singleton()->get_ticks_usec();
 	if (create_thread) {
 		command_queue.push_and_sync(this, &RenderingServerDefault::_thread_flush);
 	} else {
 		command_queue.flush_all(); //flush all pending from other threads
 	}
+	frame_sync_time = double(OS::get_singleton()->get_ticks_usec() - sync_begin) / 1000.0;
 }
 
 void RenderingServerDefault::draw(bool p_swap_buffers, double frame_step) {
+	uint64_t frame_begin_ticks = Engine::get_singleton()->get_frame_ticks();
+	double interpolation_fraction = Engine::get_singleton()->get_physics_interpolation_fraction();
 	if (create_thread) {
-		command_queue.push(this, &RenderingServerDefault::_thread_draw, p_swap_buffers, frame_step);
+		command_queue.push(this, &RenderingServerDefault::_thread_draw, p_swap_buffers, frame_step, frame_begin_ticks, interpolation_fraction);
 	} else {
-		_draw(p_swap_buffers, frame_step);
+		_draw(p_swap_buffers, frame_step, frame_begin_ticks, interpolation_fraction);
 	}
 }
 
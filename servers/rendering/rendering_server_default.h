@@ -55,6 +55,7 @@ class RenderingServerDefault : public RenderingServer {
 	};
 
 	static int changes;
+	static uint64_t canvas_changes; // Changes that can affect 2D rendering, never reset.
 	RID test_cube;
 
 	List<Callable> frame_drawn_callbacks;
@@ -65,6 +66,9 @@ class RenderingServerDefault : public RenderingServer {
 	Vector<FrameProfileArea> frame_profile;
 
 	double frame_setup_time = 0;
+	double frame_sync_time = 0;
+	double frame_wait_time = 0;
+	double frame_latency_estimate = 0;
 
 	//for printing
 	bool print_gpu_profile = false;
@@ -83,14 +87,14 @@ class RenderingServerDefault : public RenderingServer {
 	SafeFlag draw_thread_up;
 	bool create_thread;
 
-	void _thread_draw(bool p_swap_buffers, double frame_step);
+	void _thread_draw(bool p_swap_buffers, double frame_step, uint64_t p_frame_begin_ticks, double p_interpolation_fraction);
 	void _thread_flush();
 
 	void _thread_exit();
 
 	Mutex alloc_mutex;
 
-	void _draw(bool p_swap_buffers, double frame_step);
+	void _draw(bool p_swap_buffers, double frame_step, uint64_t p_frame_begin_ticks, double p_interpolation_fraction);
 	void _init();
 	void _finish();
 
@@ -101,8 +105,11 @@ public:
 	//#define DEBUG_CHANGES
 
 #ifdef DEBUG_CHANGES
-	_FORCE_INLINE_ static void redraw_request() {
+	_FORCE_INLINE_ static void redraw_request(bool p_affects_2d = true) {
 		changes++;
+		if (p_affects_2d) {
+			canvas_changes++;
+		}
 		_changes_changed();
 	}
 
@@ -111,11 +118,19 @@ public:
 	_changes_changed();
 
 #else
-	_FORCE_INLINE_ static void redraw_request() {
+	_FORCE_INLINE_ static void redraw_request(bool p_affects_2d = true) {
 		changes++;
+		if (p_affects_2d) {
+			canvas_changes++;
+		}
 	}
 #endif
 
+	// Used by RendererViewport to skip redrawing 2D viewports when nothing they may show changed.
+	_FORCE_INLINE_ static uint64_t get_canvas_changes() {
+		return canvas_changes;
+	}
+
 #define WRITE_ACTION redraw_request();
 
 #ifdef DEBUG_SYNC
@@ -206,6 +221,7 @@ public:
 	FUNC3(texture_set_detect_3d_callback, RID, TextureDetectCallback, void *)
 	FUNC3(texture_set_detect_normal_callback, RID, TextureDetectCallback, void *)
 	FUNC3(texture_set_detect_roughness_callback, RID, TextureDetectRoughnessCallback, void *)
+	FUNC3(texture_set_stream_callback, RID, TextureStreamCallback, void *)
 
 	FUNC2(texture_set_path, RID, const String &)
 	FUNC1RC(String, texture_get_path, RID)
@@ -353,6 +369,9 @@ public:
 #undef ServerName
 #undef server_name
 
+// Changes to 3D only servers don't make 2D viewports redraw.
+#undef WRITE_ACTION
+#define WRITE_ACTION redraw_request(false);
 #define ServerName RendererLightStorage
 #define server_name RSG::light_storage
 
@@ -412,7 +431,7 @@ public:
 	FUNC1(lightmap_set_probe_capture_update_speed, float)
 
 	/* Shadow Atlas */
-	FUNC0R(RID, shadow_atlas_create)
+	FUNCRIDSPLIT(shadow_atlas)
 	FUNC3(shadow_atlas_set_size, RID, int, bool)
 	FUNC3(shadow_atlas_set_quadrant_subdivision, RID, int, int)
 
@@ -423,6 +442,8 @@ public:
 #undef ServerName
 #undef server_name
 
+#undef WRITE_ACTION
+#define WRITE_ACTION redraw_request();
 #define ServerName RendererTextureStorage
 #define server_name RSG::texture_storage
 
@@ -444,6 +465,8 @@ public:
 #undef ServerName
 #undef server_name
 
+#undef WRITE_ACTION
+#define WRITE_ACTION redraw_request(false);
 #define ServerName RendererGI
 #define server_name RSG::gi
 
@@ -473,6 +496,8 @@ public:
 #undef ServerName
 #undef server_name
 
+#undef WRITE_ACTION
+#define WRITE_ACTION redraw_request();
 #define ServerName RendererParticlesStorage
 #define server_name RSG::particles_storage
 
@@ -534,6 +559,8 @@ public:
 #undef ServerName
 #undef server_name
 
+#undef WRITE_ACTION
+#define WRITE_ACTION redraw_request(false);
 #define ServerName RendererFog
 #define server_name RSG::fog
 
@@ -548,6 +575,8 @@ public:
 #undef ServerName
 #undef server_name
 
+#undef WRITE_ACTION
+#define WRITE_ACTION redraw_request();
 #define ServerName RendererUtilities
 #define server_name RSG::utilities
 
@@ -558,6 +587,8 @@ public:
 #undef server_name
 #undef ServerName
 //from now on, calls forwarded to this singleton
+#undef WRITE_ACTION
+#define WRITE_ACTION redraw_request(false);
 #define ServerName RenderingMethod
 #define server_name RSG::scene
 
@@ -580,6 +611,8 @@ public:
 #undef server_name
 #undef ServerName
 //from now on, calls forwarded to this singleton
+#undef WRITE_ACTION
+#define WRITE_ACTION redraw_request();
 #define ServerName RendererViewport
 #define server_name RSG::viewport
 
@@ -659,6 +692,8 @@ public:
 #undef server_name
 #undef ServerName
 //from now on, calls forwarded to this singleton
+#undef WRITE_ACTION
+#define WRITE_ACTION redraw_request(false);
 #define ServerName RenderingMethod
 #define server_name RSG::scene
 
@@ -764,6 +799,10 @@ public:
 	FUNC2(instance_set_scenario, RID, RID)
 	FUNC2(instance_set_layer_mask, RID, uint32_t)
 	FUNC2(instance_set_transform, RID, const Transform3D &)
+	FUNC2(instance_set_transforms, const Vector<RID> &, const Vector<Transform3D> &)
+	FUNC2(instance_set_interpolated, RID, bool)
+	FUNC1(instance_reset_physics_interpolation, RID)
+	FUNC0(tick)
 	FUNC2(instance_attach_object_instance_id, RID, ObjectID)
 	FUNC3(instance_set_blend_shape_weight, RID, int, float)
 	FUNC3(instance_set_surface_override_material, RID, int, RID)
@@ -804,6 +843,8 @@ public:
 #undef server_name
 #undef ServerName
 //from now on, calls forwarded to this singleton
+#undef WRITE_ACTION
+#define WRITE_ACTION redraw_request();
 #define ServerName RendererCanvasCull
 #define server_name RSG::canvas
 
@@ -961,6 +1002,11 @@ public:
 
 	virtual void request_frame_drawn_callback(const Callable &p_callable) override;
 
+	virtual void visibility_notifier_take_changes(Vector<ObjectID> &r_entered, Vector<ObjectID> &r_exited) override {
+		// Thread safe, the render side queues the changes under a lock.
+		RSG::scene->visibility_notifier_take_changes(r_entered, r_exited);
+	}
+
 	virtual void draw(bool p_swap_buffers, double frame_step) override;
 	virtual void sync() override;
 	virtual bool has_changed() const override;
@@ -984,6 +1030,9 @@ public:
 	/* TESTING */
 
 	virtual double get_frame_setup_time_cpu() const override;
+	virtual double get_frame_sync_time_cpu() const override;
+	virtual double get_frame_wait_time_cpu() const override;
+	virtual double get_frame_latency_estimate() const override;
 
 	virtual void set_boot_image(const Ref<Image> &p_image, const Color &p_color, bool p_scale, bool p_use_filter = true) override;
 	virtual void set_default_clear_color(const Color &p_color) override;
@@ -1401,7 +1401,54 @@ ShaderLanguage::DataType ShaderCompiler::_get_global_shader_uniform_type(const S
 	return (ShaderLanguage::DataType)RS::global_shader_uniform_type_get_shader_datatype(gvt);
 }
 
+void ShaderCompiler::_apply_cached_code(const CachedCode &p_cached, IdentifierActions *p_actions, GeneratedCode &r_gen_code) {
+	r_gen_code = p_cached.gen_code;
+
+	for (int i = 0; i < p_cached.render_modes.size(); i++) {
+		const StringName &mode = p_cached.render_modes[i];
+		if (p_actions->render_mode_flags.has(mode)) {
+			*p_actions->render_mode_flags[mode] = true;
+		}
+		if (p_actions->render_mode_values.has(mode)) {
+			Pair<int *, int> &p = p_actions->render_mode_values[mode];
+			*p.first = p.second;
+		}
+	}
+
+	for (int i = 0; i < p_cached.usage_flags.size(); i++) {
+		bool **flag = p_actions->usage_flag_pointers.getptr(p_cached.usage_flags[i]);
+		if (flag) {
+			**flag = true;
+		}
+	}
+
+	for (int i = 0; i < p_cached.write_flags.size(); i++) {
+		bool **flag = p_actions->write_flag_pointers.getptr(p_cached.write_flags[i]);
+		if (flag) {
+			**flag = true;
+		}
+	}
+
+	if (p_actions->uniforms) {
+		for (int i = 0; i < p_cached.uniforms.size(); i++) {
+			p_actions->uniforms->insert(p_cached.uniforms[i].first, p_cached.uniforms[i].second);
+		}
+	}
+}
+
 Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+	const CachedCode *cached = code_cache.getptr(p_code);
+	if (cached && cached->mode == p_mode) {
+		bool valid = true;
+		for (int i = 0; i < cached->global_uniforms.size() && valid; i++) {
+			valid = _get_global_shader_uniform_type(cached->global_uniforms[i].first) == cached->global_uniforms[i].second;
+		}
+		if (valid) {
+			_apply_cached_code(*cached, p_actions, r_gen_code);
+			return OK;
+		}
+	}
+
 	SL::ShaderCompileInfo info;
 	info.functions = ShaderTypes::get_singleton()->get_functions(p_mode);
 	info.render_modes = ShaderTypes::get_singleton()->get_modes(p_mode);
@@ -1501,11 +1548,54 @@ Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, Ident
 
 	shader = parser.get_shader();
 	function = nullptr;
-	_dump_node_code(shader, 1, r_gen_code, *p_actions, actions, false);
+
+	// Generate with flags and uniforms redirected to local storage, so they can be cached by name.
+	IdentifierActions recording_actions;
+	recording_actions.entry_point_stages = p_actions->entry_point_stages;
+	HashMap<StringName, bool> usage_flags;
+	HashMap<StringName, bool> write_flags;
+	for (const KeyValue<StringName, bool *> &E : p_actions->usage_flag_pointers) {
+		recording_actions.usage_flag_pointers[E.key] = &usage_flags.insert(E.key, false)->value;
+	}
+	for (const KeyValue<StringName, bool *> &E : p_actions->write_flag_pointers) {
+		recording_actions.write_flag_pointers[E.key] = &write_flags.insert(E.key, false)->value;
+	}
+	HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
+	recording_actions.uniforms = &uniforms;
+
+	_dump_node_code(shader, 1, r_gen_code, recording_actions, actions, false);
+
+	CachedCode entry;
+	entry.mode = p_mode;
+	entry.gen_code = r_gen_code;
+	for (int i = 0; i < shader->render_modes.size(); i++) {
+		entry.render_modes.push_back(shader->render_modes[i]);
+	}
+	for (const KeyValue<StringName, bool> &E : usage_flags) {
+		if (E.value) {
+			entry.usage_flags.push_back(E.key);
+		}
+	}
+	for (const KeyValue<StringName, bool> &E : write_flags) {
+		if (E.value) {
+			entry.write_flags.push_back(E.key);
+		}
+	}
+	for (const KeyValue<StringName, ShaderLanguage::ShaderNode::Uniform> &E : uniforms) {
+		entry.uniforms.push_back(Pair<StringName, ShaderLanguage::ShaderNode::Uniform>(E.key, E.value));
+	}
+	for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : shader->uniforms) {
+		if (E.value.scope == SL::ShaderNode::Uniform::SCOPE_GLOBAL) {
+			entry.global_uniforms.push_back(Pair<StringName, ShaderLanguage::DataType>(E.key, E.value.type));
+		}
+	}
+
+	_apply_cached_code(*code_cache.insert(p_code, entry), p_actions, r_gen_code);
 
 	return OK;
 }
 
+
 void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
 	actions = p_actions;
 
@@ -1531,5 +1621,6 @@ void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
 	texture_functions.insert("texelFetch");
 }
 
-ShaderCompiler::ShaderCompiler() {
+ShaderCompiler::ShaderCompiler() :
+		code_cache(CODE_CACHE_SIZE) {
 }
@@ -31,6 +31,7 @@
 #ifndef SHADER_COMPILER_H
 #define SHADER_COMPILER_H
 
+#include "core/templates/lru.h"
 #include "core/templates/pair.h"
 #include "servers/rendering/shader_language.h"
 #include "servers/rendering_server.h"
@@ -122,6 +123,24 @@ private:
 
 	DefaultIdentifierActions actions;
 
+	// Results of previous compilations, keyed by the shader code, so shaders sharing code
+	// (duplicated shaders, VisualShader previews) skip parsing and code generation.
+	// The side effects on IdentifierActions are stored by name and replayed on a hit.
+	struct CachedCode {
+		RS::ShaderMode mode = RS::SHADER_MAX;
+		GeneratedCode gen_code;
+		Vector<StringName> render_modes;
+		Vector<StringName> usage_flags;
+		Vector<StringName> write_flags;
+		Vector<Pair<StringName, ShaderLanguage::ShaderNode::Uniform>> uniforms;
+		Vector<Pair<StringName, ShaderLanguage::DataType>> global_uniforms; // Invalidates the entry if their types change.
+	};
+
+	static const int CODE_CACHE_SIZE = 64;
+	LRUCache<String, CachedCode> code_cache;
+
+	void _apply_cached_code(const CachedCode &p_cached, IdentifierActions *p_actions, GeneratedCode &r_gen_code);
+
 	static ShaderLanguage::DataType _get_global_shader_uniform_type(const StringName &p_name);
 
 public:
@@ -173,7 +173,8 @@ public:
 
 	/* SHADOW ATLAS */
 
-	virtual RID shadow_atlas_create() = 0;
+	virtual RID shadow_atlas_allocate() = 0;
+	virtual void shadow_atlas_initialize(RID p_rid) = 0;
 	virtual void shadow_atlas_free(RID p_atlas) = 0;
 
 	virtual void shadow_atlas_set_size(RID p_atlas, int p_size, bool p_use_16_bits = true) = 0;
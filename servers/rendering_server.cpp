@@ -471,10 +471,17 @@ Error RenderingServer::_surface_set_data(Array p_arrays, uint32_t p_format, uint
 
 				const Vector2 *src = array.ptr();
 
-				for (int i = 0; i < p_vertex_array_len; i++) {
-					float uv[2] = { (float)src[i].x, (float)src[i].y };
+				if (p_format & ARRAY_FLAG_COMPRESS_UVS) {
+					for (int i = 0; i < p_vertex_array_len; i++) {
+						uint16_t uv[2] = { Math::make_half_float(src[i].x), Math::make_half_float(src[i].y) };
+						memcpy(&aw[p_offsets[ai] + i * p_attrib_stride], uv, 2 * 2);
+					}
+				} else {
+					for (int i = 0; i < p_vertex_array_len; i++) {
+						float uv[2] = { (float)src[i].x, (float)src[i].y };
 
-					memcpy(&aw[p_offsets[ai] + i * p_attrib_stride], uv, 2 * 4);
+						memcpy(&aw[p_offsets[ai] + i * p_attrib_stride], uv, 2 * 4);
+					}
 				}
 
 			} break;
@@ -488,9 +495,16 @@ Error RenderingServer::_surface_set_data(Array p_arrays, uint32_t p_format, uint
 
 				const Vector2 *src = array.ptr();
 
-				for (int i = 0; i < p_vertex_array_len; i++) {
-					float uv[2] = { (float)src[i].x, (float)src[i].y };
-					memcpy(&aw[p_offsets[ai] + i * p_attrib_stride], uv, 2 * 4);
+				if (p_format & ARRAY_FLAG_COMPRESS_UVS) {
+					for (int i = 0; i < p_vertex_array_len; i++) {
+						uint16_t uv[2] = { Math::make_half_float(src[i].x), Math::make_half_float(src[i].y) };
+						memcpy(&aw[p_offsets[ai] + i * p_attrib_stride], uv, 2 * 2);
+					}
+				} else {
+					for (int i = 0; i < p_vertex_array_len; i++) {
+						float uv[2] = { (float)src[i].x, (float)src[i].y };
+						memcpy(&aw[p_offsets[ai] + i * p_attrib_stride], uv, 2 * 4);
+					}
 				}
 			} break;
 			case RS::ARRAY_CUSTOM0:
@@ -782,11 +796,9 @@ void RenderingServer::mesh_surface_make_offsets_from_format(uint32_t p_format, i
 			case RS::ARRAY_COLOR: {
 				elem_size = 4;
 			} break;
-			case RS::ARRAY_TEX_UV: {
-				elem_size = 8;
-			} break;
+			case RS::ARRAY_TEX_UV:
 			case RS::ARRAY_TEX_UV2: {
-				elem_size = 8;
+				elem_size = (p_format & ARRAY_FLAG_COMPRESS_UVS) ? 4 : 8;
 			} break;
 			case RS::ARRAY_CUSTOM0:
 			case RS::ARRAY_CUSTOM1:
@@ -933,6 +945,11 @@ Error RenderingServer::mesh_create_surface_data_from_arrays(SurfaceData *r_surfa
 		}
 	}
 
+	if (p_compress_format & RS::ARRAY_FLAG_COMPRESS_UVS) {
+		// Changes the attribute layout, so it must be part of the format before offsets are computed.
+		format |= RS::ARRAY_FLAG_COMPRESS_UVS;
+	}
+
 	uint32_t offsets[RS::ARRAY_MAX];
 
 	uint32_t vertex_element_size;
@@ -1166,9 +1183,16 @@ Array RenderingServer::_get_array_from_surface(uint32_t p_format, Vector<uint8_t
 
 				Vector2 *w = arr.ptrw();
 
-				for (int j = 0; j < p_vertex_len; j++) {
-					const float *v = reinterpret_cast<const float *>(&ar[j * attrib_elem_size + offsets[i]]);
-					w[j] = Vector2(v[0], v[1]);
+				if (p_format & ARRAY_FLAG_COMPRESS_UVS) {
+					for (int j = 0; j < p_vertex_len; j++) {
+						const uint16_t *v = reinterpret_cast<const uint16_t *>(&ar[j * attrib_elem_size + offsets[i]]);
+						w[j] = Vector2(Math::half_to_float(v[0]), Math::half_to_float(v[1]));
+					}
+				} else {
+					for (int j = 0; j < p_vertex_len; j++) {
+						const float *v = reinterpret_cast<const float *>(&ar[j * attrib_elem_size + offsets[i]]);
+						w[j] = Vector2(v[0], v[1]);
+					}
 				}
 
 				ret[i] = arr;
@@ -1180,9 +1204,16 @@ Array RenderingServer::_get_array_from_surface(uint32_t p_format, Vector<uint8_t
 
 				Vector2 *w = arr.ptrw();
 
-				for (int j = 0; j < p_vertex_len; j++) {
-					const float *v = reinterpret_cast<const float *>(&ar[j * attrib_elem_size + offsets[i]]);
-					w[j] = Vector2(v[0], v[1]);
+				if (p_format & ARRAY_FLAG_COMPRESS_UVS) {
+					for (int j = 0; j < p_vertex_len; j++) {
+						const uint16_t *v = reinterpret_cast<const uint16_t *>(&ar[j * attrib_elem_size + offsets[i]]);
+						w[j] = Vector2(Math::half_to_float(v[0]), Math::half_to_float(v[1]));
+					}
+				} else {
+					for (int j = 0; j < p_vertex_len; j++) {
+						const float *v = reinterpret_cast<const float *>(&ar[j * attrib_elem_size + offsets[i]]);
+						w[j] = Vector2(v[0], v[1]);
+					}
 				}
 
 				ret[i] = arr;
@@ -1643,6 +1674,22 @@ TypedArray<Dictionary> RenderingServer::_instance_geometry_get_shader_parameter_
 	return convert_property_list(&params);
 }
 
+void RenderingServer::_instance_set_transforms(const TypedArray<RID> &p_instances, const TypedArray<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	Vector<RID> instances;
+	Vector<Transform3D> transforms;
+	instances.resize(p_instances.size());
+	transforms.resize(p_transforms.size());
+	RID *instances_ptrw = instances.ptrw();
+	Transform3D *transforms_ptrw = transforms.ptrw();
+	for (int i = 0; i < p_instances.size(); i++) {
+		instances_ptrw[i] = p_instances[i];
+		transforms_ptrw[i] = p_transforms[i];
+	}
+	instance_set_transforms(instances, transforms);
+}
+
 TypedArray<Image> RenderingServer::_bake_render_uv2(RID p_base, const TypedArray<RID> &p_material_overrides, const Size2i &p_image_size) {
 	TypedArray<RID> mat_overrides;
 	for (int i = 0; i < p_material_overrides.size(); i++) {
@@ -1660,6 +1707,20 @@ void RenderingServer::_particles_set_trail_bind_poses(RID p_particles, const Typ
 	particles_set_trail_bind_poses(p_particles, tbposes);
 }
 
+TypedArray<Dictionary> RenderingServer::_get_frame_profile() {
+	Vector<FrameProfileArea> profile = get_frame_profile();
+	TypedArray<Dictionary> ret;
+	ret.resize(profile.size());
+	for (int i = 0; i < profile.size(); i++) {
+		Dictionary area;
+		area["name"] = profile[i].name;
+		area["cpu_msec"] = profile[i].cpu_msec;
+		area["gpu_msec"] = profile[i].gpu_msec;
+		ret[i] = area;
+	}
+	return ret;
+}
+
 void RenderingServer::_bind_methods() {
 	BIND_CONSTANT(NO_INDEX_ARRAY);
 	BIND_CONSTANT(ARRAY_WEIGHTS_SIZE);
@@ -1826,6 +1887,7 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(ARRAY_FLAG_USE_2D_VERTICES);
 	BIND_ENUM_CONSTANT(ARRAY_FLAG_USE_DYNAMIC_UPDATE);
 	BIND_ENUM_CONSTANT(ARRAY_FLAG_USE_8_BONE_WEIGHTS);
+	BIND_ENUM_CONSTANT(ARRAY_FLAG_COMPRESS_UVS);
 
 	BIND_ENUM_CONSTANT(PRIMITIVE_POINTS);
 	BIND_ENUM_CONSTANT(PRIMITIVE_LINES);
@@ -2482,6 +2544,9 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_set_scenario", "instance", "scenario"), &RenderingServer::instance_set_scenario);
 	ClassDB::bind_method(D_METHOD("instance_set_layer_mask", "instance", "mask"), &RenderingServer::instance_set_layer_mask);
 	ClassDB::bind_method(D_METHOD("instance_set_transform", "instance", "transform"), &RenderingServer::instance_set_transform);
+	ClassDB::bind_method(D_METHOD("instance_set_transforms", "instances", "transforms"), &RenderingServer::_instance_set_transforms);
+	ClassDB::bind_method(D_METHOD("instance_set_interpolated", "instance", "interpolated"), &RenderingServer::instance_set_interpolated);
+	ClassDB::bind_method(D_METHOD("instance_reset_physics_interpolation", "instance"), &RenderingServer::instance_reset_physics_interpolation);
 	ClassDB::bind_method(D_METHOD("instance_attach_object_instance_id", "instance", "id"), &RenderingServer::instance_attach_object_instance_id);
 	ClassDB::bind_method(D_METHOD("instance_set_blend_shape_weight", "instance", "shape", "weight"), &RenderingServer::instance_set_blend_shape_weight);
 	ClassDB::bind_method(D_METHOD("instance_set_surface_override_material", "instance", "surface", "material"), &RenderingServer::instance_set_surface_override_material);
@@ -2773,6 +2838,13 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_render_loop_enabled", "enabled"), &RenderingServer::set_render_loop_enabled);
 
 	ClassDB::bind_method(D_METHOD("get_frame_setup_time_cpu"), &RenderingServer::get_frame_setup_time_cpu);
+	ClassDB::bind_method(D_METHOD("get_frame_sync_time_cpu"), &RenderingServer::get_frame_sync_time_cpu);
+	ClassDB::bind_method(D_METHOD("get_frame_wait_time_cpu"), &RenderingServer::get_frame_wait_time_cpu);
+	ClassDB::bind_method(D_METHOD("get_frame_latency_estimate"), &RenderingServer::get_frame_latency_estimate);
+
+	ClassDB::bind_method(D_METHOD("set_frame_profiling_enabled", "enable"), &RenderingServer::set_frame_profiling_enabled);
+	ClassDB::bind_method(D_METHOD("get_frame_profile"), &RenderingServer::_get_frame_profile);
+	ClassDB::bind_method(D_METHOD("get_frame_profile_frame"), &RenderingServer::get_frame_profile_frame);
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "render_loop_enabled"), "set_render_loop_enabled", "is_render_loop_enabled");
 
@@ -2861,6 +2933,25 @@ void RenderingServer::init() {
 	GLOBAL_DEF("rendering/textures/webp_compression/lossless_compression_factor", 25);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/textures/webp_compression/lossless_compression_factor", PropertyInfo(Variant::FLOAT, "rendering/textures/webp_compression/lossless_compression_factor", PROPERTY_HINT_RANGE, "0,100,1"));
 
+	GLOBAL_DEF_RST("rendering/textures/streaming/enabled", false);
+	GLOBAL_DEF_RST("rendering/textures/streaming/initial_size", 128);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/textures/streaming/initial_size", PropertyInfo(Variant::INT, "rendering/textures/streaming/initial_size", PROPERTY_HINT_RANGE, "16,4096,1"));
+	GLOBAL_DEF("rendering/textures/streaming/memory_budget_mb", 1024);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/textures/streaming/memory_budget_mb", PropertyInfo(Variant::INT, "rendering/textures/streaming/memory_budget_mb", PROPERTY_HINT_RANGE, "0,16384,1,or_greater"));
+
+	GLOBAL_DEF_RST("rendering/skinning/share_identical_poses", false);
+
+	GLOBAL_DEF_RST("rendering/mesh_lod/streaming/enabled", false);
+	GLOBAL_DEF_RST("rendering/mesh_lod/streaming/memory_budget_mb", 256);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/mesh_lod/streaming/memory_budget_mb", PropertyInfo(Variant::INT, "rendering/mesh_lod/streaming/memory_budget_mb", PROPERTY_HINT_RANGE, "0,16384,1,or_greater"));
+
+	GLOBAL_DEF_RST("rendering/mesh_clusters/enabled", false);
+	GLOBAL_DEF_RST("rendering/mesh_clusters/min_triangles", 16384);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/mesh_clusters/min_triangles", PropertyInfo(Variant::INT, "rendering/mesh_clusters/min_triangles", PROPERTY_HINT_RANGE, "1024,1048576,1,or_greater"));
+	GLOBAL_DEF_RST("rendering/multimesh/gpu_culling/enabled", false);
+	GLOBAL_DEF_RST("rendering/multimesh/gpu_culling/min_instances", 1024);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/multimesh/gpu_culling/min_instances", PropertyInfo(Variant::INT, "rendering/multimesh/gpu_culling/min_instances", PROPERTY_HINT_RANGE, "64,65536,1,or_greater"));
+
 	GLOBAL_DEF("rendering/limits/time/time_rollover_secs", 3600);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/time/time_rollover_secs", PropertyInfo(Variant::FLOAT, "rendering/limits/time/time_rollover_secs", PROPERTY_HINT_RANGE, "0,10000,1,or_greater"));
 
@@ -2874,21 +2965,27 @@ void RenderingServer::init() {
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/lights_and_shadows/directional_shadow/soft_shadow_filter_quality", PropertyInfo(Variant::INT, "rendering/lights_and_shadows/directional_shadow/soft_shadow_filter_quality", PROPERTY_HINT_ENUM, "Hard (Fastest),Soft Very Low (Faster),Soft Low (Fast),Soft Medium (Average),Soft High (Slow),Soft Ultra (Slowest)"));
 	GLOBAL_DEF("rendering/lights_and_shadows/directional_shadow/16_bits", true);
 
+	GLOBAL_DEF_RST("rendering/lights_and_shadows/mobile_light_tiles", false);
+
 	GLOBAL_DEF("rendering/lights_and_shadows/positional_shadow/soft_shadow_filter_quality", 2);
 	GLOBAL_DEF("rendering/lights_and_shadows/positional_shadow/soft_shadow_filter_quality.mobile", 0);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/lights_and_shadows/positional_shadow/soft_shadow_filter_quality", PropertyInfo(Variant::INT, "rendering/lights_and_shadows/positional_shadow/soft_shadow_filter_quality", PROPERTY_HINT_ENUM, "Hard (Fastest),Soft Very Low (Faster),Soft Low (Fast),Soft Medium (Average),Soft High (Slow),Soft Ultra (Slowest)"));
+	GLOBAL_DEF_RST("rendering/lights_and_shadows/positional_shadow/static_cache", false);
 
 	GLOBAL_DEF("rendering/2d/shadow_atlas/size", 2048);
+	GLOBAL_DEF_RST("rendering/2d/redraw_on_demand", false);
 
 	// Number of commands that can be drawn per frame.
 	GLOBAL_DEF_RST("rendering/gl_compatibility/item_buffer_size", 16384);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/gl_compatibility/item_buffer_size", PropertyInfo(Variant::INT, "rendering/gl_compatibility/item_buffer_size", PROPERTY_HINT_RANGE, "1024,1048576,1"));
+	GLOBAL_DEF_RST("rendering/gl_compatibility/automatic_instancing", true);
 
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/enabled", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/compress", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/use_zstd_compression", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/strip_debug", false);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/strip_debug.release", true);
+	GLOBAL_DEF("rendering/shader_compiler/async_compilation", false);
 
 	GLOBAL_DEF_RST("rendering/reflections/sky_reflections/roughness_layers", 8); // Assumes a 256x256 cubemap
 	GLOBAL_DEF_RST("rendering/reflections/sky_reflections/texture_array_reflections", true);
@@ -2896,6 +2993,8 @@ void RenderingServer::init() {
 	GLOBAL_DEF_RST("rendering/reflections/sky_reflections/ggx_samples", 32);
 	GLOBAL_DEF("rendering/reflections/sky_reflections/ggx_samples.mobile", 16);
 	GLOBAL_DEF("rendering/reflections/sky_reflections/fast_filter_high_quality", false);
+	GLOBAL_DEF_RST("rendering/reflections/probes/update_always_steps_per_frame", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/reflections/probes/update_always_steps_per_frame", PropertyInfo(Variant::INT, "rendering/reflections/probes/update_always_steps_per_frame", PROPERTY_HINT_RANGE, "0,64,1"));
 	GLOBAL_DEF("rendering/reflections/reflection_atlas/reflection_size", 256);
 	GLOBAL_DEF("rendering/reflections/reflection_atlas/reflection_size.mobile", 128);
 	GLOBAL_DEF("rendering/reflections/reflection_atlas/reflection_count", 64);
@@ -2983,6 +3082,9 @@ void RenderingServer::init() {
 
 	GLOBAL_DEF_RST("rendering/occlusion_culling/occlusion_rays_per_thread", 512);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/occlusion_culling/bvh_build_quality", PropertyInfo(Variant::INT, "rendering/occlusion_culling/bvh_build_quality", PROPERTY_HINT_ENUM, "Low,Medium,High"));
+	GLOBAL_DEF_RST("rendering/occlusion_culling/gpu_hiz/enabled", false);
+	GLOBAL_DEF_RST("rendering/occlusion_culling/gpu_hiz/size_divisor", 8);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/occlusion_culling/gpu_hiz/size_divisor", PropertyInfo(Variant::INT, "rendering/occlusion_culling/gpu_hiz/size_divisor", PROPERTY_HINT_RANGE, "1,32,1"));
 
 	GLOBAL_DEF("rendering/environment/glow/upscale_mode", 1);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/environment/glow/upscale_mode", PropertyInfo(Variant::INT, "rendering/environment/glow/upscale_mode", PROPERTY_HINT_ENUM, "Linear (Fast),Bicubic (Slow)"));
@@ -3010,6 +3112,8 @@ void RenderingServer::init() {
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/global_illumination/sdfgi/frames_to_converge", PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/frames_to_converge", PROPERTY_HINT_ENUM, "5 (Less Latency but Lower Quality),10,15,20,25,30 (More Latency but Higher Quality)"));
 	GLOBAL_DEF("rendering/global_illumination/sdfgi/frames_to_update_lights", 2);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/global_illumination/sdfgi/frames_to_update_lights", PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/frames_to_update_lights", PROPERTY_HINT_ENUM, "1 (Slower),2,4,8,16 (Faster)"));
+	GLOBAL_DEF("rendering/global_illumination/sdfgi/max_cascade_updates_per_frame", 2);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/global_illumination/sdfgi/max_cascade_updates_per_frame", PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/max_cascade_updates_per_frame", PROPERTY_HINT_RANGE, "0,8,1"));
 
 	GLOBAL_DEF("rendering/environment/volumetric_fog/volume_size", 64);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/environment/volumetric_fog/volume_size", PropertyInfo(Variant::INT, "rendering/environment/volumetric_fog/volume_size", PROPERTY_HINT_RANGE, "16,512,1"));
@@ -3017,11 +3121,13 @@ void RenderingServer::init() {
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/environment/volumetric_fog/volume_depth", PropertyInfo(Variant::INT, "rendering/environment/volumetric_fog/volume_depth", PROPERTY_HINT_RANGE, "16,512,1"));
 	GLOBAL_DEF("rendering/environment/volumetric_fog/use_filter", 1);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/environment/volumetric_fog/use_filter", PropertyInfo(Variant::INT, "rendering/environment/volumetric_fog/use_filter", PROPERTY_HINT_ENUM, "No (Faster),Yes (Higher Quality)"));
+	GLOBAL_DEF("rendering/environment/volumetric_fog/interleaved_updates", false);
 
 	GLOBAL_DEF("rendering/limits/spatial_indexer/update_iterations_per_frame", 10);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/spatial_indexer/update_iterations_per_frame", PropertyInfo(Variant::INT, "rendering/limits/spatial_indexer/update_iterations_per_frame", PROPERTY_HINT_RANGE, "0,1024,1"));
 	GLOBAL_DEF("rendering/limits/spatial_indexer/threaded_cull_minimum_instances", 1000);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/spatial_indexer/threaded_cull_minimum_instances", PropertyInfo(Variant::INT, "rendering/limits/spatial_indexer/threaded_cull_minimum_instances", PROPERTY_HINT_RANGE, "32,65536,1"));
+	GLOBAL_DEF("rendering/limits/forward_renderer/threaded_render", true);
 	GLOBAL_DEF("rendering/limits/forward_renderer/threaded_render_minimum_instances", 500);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/forward_renderer/threaded_render_minimum_instances", PropertyInfo(Variant::INT, "rendering/limits/forward_renderer/threaded_render_minimum_instances", PROPERTY_HINT_RANGE, "32,65536,1"));
 
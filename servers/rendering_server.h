@@ -142,6 +142,10 @@ public:
 	typedef void (*TextureDetectRoughnessCallback)(void *, const String &, TextureDetectRoughnessChannel);
 	virtual void texture_set_detect_roughness_callback(RID p_texture, TextureDetectRoughnessCallback p_callback, void *p_userdata) = 0;
 
+	// Called by the renderer with the largest dimension the texture should be resident at (0 means the full size).
+	typedef void (*TextureStreamCallback)(void *, int);
+	virtual void texture_set_stream_callback(RID p_texture, TextureStreamCallback p_callback, void *p_userdata) = 0;
+
 	struct TextureInfo {
 		RID texture;
 		uint32_t width;
@@ -280,6 +284,7 @@ public:
 		ARRAY_FLAG_USE_8_BONE_WEIGHTS = 1 << (ARRAY_COMPRESS_FLAGS_BASE + 2),
 
 		ARRAY_FLAG_USES_EMPTY_VERTEX_ARRAY = 1 << (ARRAY_INDEX + 1 + 15),
+		ARRAY_FLAG_COMPRESS_UVS = 1 << (ARRAY_COMPRESS_FLAGS_BASE + 4), // UV and UV2 stored as RG16F instead of RG32F.
 	};
 
 	enum PrimitiveType {
@@ -758,6 +763,8 @@ public:
 	virtual RID visibility_notifier_create() = 0;
 	virtual void visibility_notifier_set_aabb(RID p_notifier, const AABB &p_aabb) = 0;
 	virtual void visibility_notifier_set_callbacks(RID p_notifier, const Callable &p_enter_callbable, const Callable &p_exit_callable) = 0;
+	// Returns the object IDs of notifier instances that entered or exited the screen since the last call.
+	virtual void visibility_notifier_take_changes(Vector<ObjectID> &r_entered, Vector<ObjectID> &r_exited) = 0;
 
 	/* OCCLUDER API */
 
@@ -1211,6 +1218,9 @@ public:
 	virtual void instance_set_scenario(RID p_instance, RID p_scenario) = 0;
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask) = 0;
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform) = 0;
+	virtual void instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) = 0;
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated) = 0;
+	virtual void instance_reset_physics_interpolation(RID p_instance) = 0;
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id) = 0;
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight) = 0;
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material) = 0;
@@ -1509,6 +1519,7 @@ public:
 
 	virtual void draw(bool p_swap_buffers = true, double frame_step = 0.0) = 0;
 	virtual void sync() = 0;
+	virtual void tick() = 0;
 	virtual bool has_changed() const = 0;
 	virtual void init();
 	virtual void finish() = 0;
@@ -1542,6 +1553,9 @@ public:
 	virtual uint64_t get_frame_profile_frame() = 0;
 
 	virtual double get_frame_setup_time_cpu() const = 0;
+	virtual double get_frame_sync_time_cpu() const = 0;
+	virtual double get_frame_wait_time_cpu() const = 0;
+	virtual double get_frame_latency_estimate() const = 0;
 
 	virtual void gi_set_use_half_resolution(bool p_enable) = 0;
 
@@ -1601,8 +1615,10 @@ private:
 	void _mesh_add_surface(RID p_mesh, const Dictionary &p_surface);
 	Dictionary _mesh_get_surface(RID p_mesh, int p_idx);
 	TypedArray<Dictionary> _instance_geometry_get_shader_parameter_list(RID p_instance) const;
+	void _instance_set_transforms(const TypedArray<RID> &p_instances, const TypedArray<Transform3D> &p_transforms);
 	TypedArray<Image> _bake_render_uv2(RID p_base, const TypedArray<RID> &p_material_overrides, const Size2i &p_image_size);
 	void _particles_set_trail_bind_poses(RID p_particles, const TypedArray<Transform3D> &p_bind_poses);
+	TypedArray<Dictionary> _get_frame_profile();
 };
 
 // Make variant understand the enums.
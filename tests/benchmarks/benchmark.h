@@ -0,0 +1,67 @@
+/*************************************************************************/
+/*  benchmark.h                                                          */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "core/typedefs.h"
+
+#include <stdint.h>
+
+// Microbenchmarks, built with `benchmarks=yes` and run with `godot --test benchmark`.
+//
+// A benchmark is a function running its measured work p_iterations times. The harness
+// picks the iteration count so a sample lasts long enough to time reliably, then reports
+// the time per iteration as JSON (see run_benchmarks()).
+// Setup that shouldn't be measured goes before the loop, the harness subtracts nothing.
+
+typedef void (*BenchmarkFunc)(uint64_t p_iterations);
+
+int register_benchmark(const char *p_name, BenchmarkFunc p_function);
+void run_benchmarks();
+
+#define REGISTER_BENCHMARK(m_name, m_function) \
+	static int _benchmark_registrar_##m_function = register_benchmark(m_name, m_function)
+
+// Keeps the compiler from optimizing away a value the benchmark computes but never uses.
+template <class T>
+_FORCE_INLINE_ void benchmark_do_not_optimize(const T &p_value) {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile(""
+				 :
+				 : "r,m"(p_value)
+				 : "memory");
+#else
+	static const volatile void *sink;
+	sink = &p_value;
+#endif
+}
+
+#endif // BENCHMARK_H
@@ -0,0 +1,104 @@
+/*************************************************************************/
+/*  benchmark_bvh.h                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef BENCHMARK_BVH_H
+#define BENCHMARK_BVH_H
+
+#include "core/math/bvh.h"
+#include "core/math/random_pcg.h"
+
+#include "tests/benchmarks/benchmark.h"
+
+namespace BenchmarkBVH {
+
+struct BVHItem {
+	uint32_t id = 0;
+};
+
+class BVHItemTest {
+public:
+	static bool user_pair_check(const BVHItem *p_a, const BVHItem *p_b) { return true; }
+	static bool user_cull_check(const BVHItem *p_a, const BVHItem *p_b) { return true; }
+};
+
+typedef BVH_Manager<BVHItem, 1, false, 32, BVHItemTest, BVHItemTest, AABB, Vector3, false> BenchmarkBVHManager;
+
+static const int ITEM_COUNT = 10000;
+static const int RESULT_MAX = 1024;
+
+// A world of small boxes scattered over 1000 units, culled with a box about the size of a view volume.
+static void bvh_cull_aabb(uint64_t p_iterations) {
+	BenchmarkBVHManager bvh;
+	LocalVector<BVHItem> items;
+	items.resize(ITEM_COUNT);
+	RandomPCG rng(1234);
+	for (int i = 0; i < ITEM_COUNT; i++) {
+		items[i].id = i;
+		Vector3 pos(rng.randf() * 1000.0, rng.randf() * 100.0, rng.randf() * 1000.0);
+		bvh.create(&items[i], true, 0, 1, AABB(pos, Vector3(2, 2, 2)));
+	}
+	bvh.update();
+
+	BVHItem *results[RESULT_MAX];
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		Vector3 origin(float(i % 10) * 90.0, 0, float((i / 10) % 10) * 90.0);
+		int count = bvh.cull_aabb(AABB(origin, Vector3(100, 100, 100)), results, RESULT_MAX, nullptr);
+		benchmark_do_not_optimize(count);
+	}
+}
+
+static void bvh_move(uint64_t p_iterations) {
+	BenchmarkBVHManager bvh;
+	LocalVector<BVHItem> items;
+	LocalVector<BVHHandle> handles;
+	items.resize(ITEM_COUNT);
+	RandomPCG rng(1234);
+	for (int i = 0; i < ITEM_COUNT; i++) {
+		items[i].id = i;
+		Vector3 pos(rng.randf() * 1000.0, rng.randf() * 100.0, rng.randf() * 1000.0);
+		handles.push_back(bvh.create(&items[i], true, 0, 1, AABB(pos, Vector3(2, 2, 2))));
+	}
+	bvh.update();
+
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		Vector3 pos(rng.randf() * 1000.0, rng.randf() * 100.0, rng.randf() * 1000.0);
+		bvh.move(handles[i % ITEM_COUNT], AABB(pos, Vector3(2, 2, 2)));
+		if ((i & 255) == 255) {
+			bvh.update();
+		}
+	}
+}
+
+REGISTER_BENCHMARK("BVH_Manager/cull_aabb_10000", bvh_cull_aabb);
+REGISTER_BENCHMARK("BVH_Manager/move", bvh_move);
+
+} // namespace BenchmarkBVH
+
+#endif // BENCHMARK_BVH_H
@@ -0,0 +1,169 @@
+/*************************************************************************/
+/*  benchmark_containers.h                                               */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef BENCHMARK_CONTAINERS_H
+#define BENCHMARK_CONTAINERS_H
+
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/oa_hash_map.h"
+#include "core/templates/rb_map.h"
+#include "core/templates/vector.h"
+
+#include "tests/benchmarks/benchmark.h"
+
+namespace BenchmarkContainers {
+
+// Maps are filled with this many scattered keys, an iteration of the insert benchmarks fills a whole map.
+static const int MAP_SIZE = 1000;
+static const int COPY_SIZE = 4096;
+
+_FORCE_INLINE_ static uint32_t scattered_key(uint32_t p_index) {
+	return p_index * 2654435761u;
+}
+
+static void hash_map_insert(uint64_t p_iterations) {
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		HashMap<uint32_t, uint32_t> map;
+		for (int j = 0; j < MAP_SIZE; j++) {
+			map.insert(scattered_key(j), j);
+		}
+		benchmark_do_not_optimize(map);
+	}
+}
+
+static void hash_map_lookup(uint64_t p_iterations) {
+	HashMap<uint32_t, uint32_t> map;
+	for (int j = 0; j < MAP_SIZE; j++) {
+		map.insert(scattered_key(j), j);
+	}
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		const uint32_t *value = map.getptr(scattered_key(i % (MAP_SIZE * 2))); // Half of them miss.
+		benchmark_do_not_optimize(value);
+	}
+}
+
+static void oa_hash_map_insert(uint64_t p_iterations) {
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		OAHashMap<uint32_t, uint32_t> map;
+		for (int j = 0; j < MAP_SIZE; j++) {
+			map.insert(scattered_key(j), j);
+		}
+		benchmark_do_not_optimize(map);
+	}
+}
+
+static void oa_hash_map_lookup(uint64_t p_iterations) {
+	OAHashMap<uint32_t, uint32_t> map;
+	for (int j = 0; j < MAP_SIZE; j++) {
+		map.insert(scattered_key(j), j);
+	}
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		uint32_t value = 0;
+		bool found = map.lookup(scattered_key(i % (MAP_SIZE * 2)), value);
+		benchmark_do_not_optimize(found);
+		benchmark_do_not_optimize(value);
+	}
+}
+
+static void rb_map_insert(uint64_t p_iterations) {
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		RBMap<uint32_t, uint32_t> map;
+		for (int j = 0; j < MAP_SIZE; j++) {
+			map.insert(scattered_key(j), j);
+		}
+		benchmark_do_not_optimize(map);
+	}
+}
+
+static void rb_map_lookup(uint64_t p_iterations) {
+	RBMap<uint32_t, uint32_t> map;
+	for (int j = 0; j < MAP_SIZE; j++) {
+		map.insert(scattered_key(j), j);
+	}
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		const RBMap<uint32_t, uint32_t>::Element *E = map.find(scattered_key(i % (MAP_SIZE * 2)));
+		benchmark_do_not_optimize(E);
+	}
+}
+
+// Writing to a shared Vector is what actually copies its CowData.
+static void vector_copy_on_write(uint64_t p_iterations) {
+	Vector<uint32_t> source;
+	source.resize(COPY_SIZE);
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		Vector<uint32_t> copy = source;
+		copy.write[0] = i;
+		benchmark_do_not_optimize(copy);
+	}
+}
+
+static void vector_shared_copy(uint64_t p_iterations) {
+	Vector<uint32_t> source;
+	source.resize(COPY_SIZE);
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		Vector<uint32_t> copy = source;
+		benchmark_do_not_optimize(copy);
+	}
+}
+
+static void local_vector_copy(uint64_t p_iterations) {
+	LocalVector<uint32_t> source;
+	source.resize(COPY_SIZE);
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		LocalVector<uint32_t> copy = source;
+		benchmark_do_not_optimize(copy);
+	}
+}
+
+static void local_vector_push_back(uint64_t p_iterations) {
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		LocalVector<uint32_t> vector;
+		for (int j = 0; j < COPY_SIZE; j++) {
+			vector.push_back(j);
+		}
+		benchmark_do_not_optimize(vector);
+	}
+}
+
+REGISTER_BENCHMARK("HashMap/insert_1000", hash_map_insert);
+REGISTER_BENCHMARK("HashMap/lookup", hash_map_lookup);
+REGISTER_BENCHMARK("OAHashMap/insert_1000", oa_hash_map_insert);
+REGISTER_BENCHMARK("OAHashMap/lookup", oa_hash_map_lookup);
+REGISTER_BENCHMARK("RBMap/insert_1000", rb_map_insert);
+REGISTER_BENCHMARK("RBMap/lookup", rb_map_lookup);
+REGISTER_BENCHMARK("Vector/copy_on_write_4096", vector_copy_on_write);
+REGISTER_BENCHMARK("Vector/shared_copy", vector_shared_copy);
+REGISTER_BENCHMARK("LocalVector/copy_4096", local_vector_copy);
+REGISTER_BENCHMARK("LocalVector/push_back_4096", local_vector_push_back);
+
+} // namespace BenchmarkContainers
+
+#endif // BENCHMARK_CONTAINERS_H
@@ -0,0 +1,140 @@
+/*************************************************************************/
+/*  benchmark_gdscript.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef BENCHMARK_GDSCRIPT_H
+#define BENCHMARK_GDSCRIPT_H
+
+#include "modules/modules_enabled.gen.h" // For gdscript.
+
+#ifdef MODULE_GDSCRIPT_ENABLED
+
+#include "modules/gdscript/gdscript.h"
+
+#include "tests/benchmarks/benchmark.h"
+
+namespace BenchmarkGDScript {
+
+// Each function runs its loop body once per iteration, so the results are the cost of
+// the opcodes in a single pass of the loop.
+static const char *source = R"(
+static func typed_arithmetic(n: int) -> int:
+	var total := 0
+	for i in n:
+		total += i * 3 - (i >> 1)
+	return total
+
+static func untyped_arithmetic(n):
+	var total = 0.0
+	for i in n:
+		total += i * 0.5
+	return total
+
+static func _add(a: int, b: int) -> int:
+	return a + b
+
+static func function_calls(n: int) -> int:
+	var total := 0
+	for i in n:
+		total += _add(i, 1)
+	return total
+
+static func array_access(n: int) -> int:
+	var array := [1, 2, 3, 4, 5, 6, 7, 8]
+	var total := 0
+	for i in n:
+		total += array[i & 7]
+	return total
+
+static func builtin_methods(n: int) -> float:
+	var v := Vector3(1, 2, 3)
+	var total := 0.0
+	for i in n:
+		total += v.length()
+	return total
+
+static func string_building(n: int) -> int:
+	var s := ""
+	for i in n:
+		s += "a"
+	return s.length()
+)";
+
+static void _run(const StringName &p_function, uint64_t p_iterations) {
+	static bool language_initialized = false;
+	if (!language_initialized) {
+		GDScriptLanguage::get_singleton()->init();
+		language_initialized = true;
+	}
+
+	Ref<GDScript> script;
+	script.instantiate();
+	script->set_source_code(source);
+	ERR_FAIL_COND(script->reload() != OK);
+
+	Variant result = script->call(p_function, int64_t(p_iterations));
+	benchmark_do_not_optimize(result);
+}
+
+static void gdscript_typed_arithmetic(uint64_t p_iterations) {
+	_run("typed_arithmetic", p_iterations);
+}
+
+static void gdscript_untyped_arithmetic(uint64_t p_iterations) {
+	_run("untyped_arithmetic", p_iterations);
+}
+
+static void gdscript_function_calls(uint64_t p_iterations) {
+	_run("function_calls", p_iterations);
+}
+
+static void gdscript_array_access(uint64_t p_iterations) {
+	_run("array_access", p_iterations);
+}
+
+static void gdscript_builtin_methods(uint64_t p_iterations) {
+	_run("builtin_methods", p_iterations);
+}
+
+static void gdscript_string_building(uint64_t p_iterations) {
+	_run("string_building", p_iterations);
+}
+
+REGISTER_BENCHMARK("GDScript/typed_arithmetic", gdscript_typed_arithmetic);
+REGISTER_BENCHMARK("GDScript/untyped_arithmetic", gdscript_untyped_arithmetic);
+REGISTER_BENCHMARK("GDScript/function_calls", gdscript_function_calls);
+REGISTER_BENCHMARK("GDScript/array_access", gdscript_array_access);
+REGISTER_BENCHMARK("GDScript/builtin_methods", gdscript_builtin_methods);
+REGISTER_BENCHMARK("GDScript/string_building", gdscript_string_building);
+
+} // namespace BenchmarkGDScript
+
+#endif // MODULE_GDSCRIPT_ENABLED
+
+#endif // BENCHMARK_GDSCRIPT_H
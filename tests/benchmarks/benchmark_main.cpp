@@ -0,0 +1,162 @@
+/*************************************************************************/
+/*  benchmark_main.cpp                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "benchmark.h"
+
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
+#include "core/version.h"
+
+#include "tests/benchmarks/benchmark_bvh.h"
+#include "tests/benchmarks/benchmark_containers.h"
+#include "tests/benchmarks/benchmark_gdscript.h"
+#include "tests/benchmarks/benchmark_navigation.h"
+#include "tests/benchmarks/benchmark_physics.h"
+#include "tests/benchmarks/benchmark_variant.h"
+
+struct BenchmarkEntry {
+	const char *name = nullptr;
+	BenchmarkFunc function = nullptr;
+};
+
+// Registration happens during static initialization, so the list can't be a global object.
+static LocalVector<BenchmarkEntry> *benchmarks = nullptr;
+
+int register_benchmark(const char *p_name, BenchmarkFunc p_function) {
+	if (!benchmarks) {
+		benchmarks = new LocalVector<BenchmarkEntry>;
+	}
+	BenchmarkEntry entry;
+	entry.name = p_name;
+	entry.function = p_function;
+	benchmarks->push_back(entry);
+	return 0;
+}
+
+static uint64_t _time_iterations(BenchmarkFunc p_function, uint64_t p_iterations) {
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	p_function(p_iterations);
+	return OS::get_singleton()->get_ticks_usec() - begin;
+}
+
+// Command line:
+//   --benchmark-filter <text>      Only run the benchmarks with <text> in their name.
+//   --benchmark-output <file>      Write the JSON report to <file> instead of stdout.
+//   --benchmark-min-time <sec>     Minimum duration of a sample (0.1 by default).
+//   --benchmark-samples <count>    Samples taken per benchmark (5 by default).
+void run_benchmarks() {
+	String filter;
+	String output_path;
+	double min_time = 0.1;
+	int sample_count = 5;
+
+	List<String> args = OS::get_singleton()->get_cmdline_args();
+	for (List<String>::Element *E = args.front(); E; E = E->next()) {
+		if (!E->next()) {
+			break;
+		}
+		if (E->get() == "--benchmark-filter") {
+			filter = E->next()->get();
+		} else if (E->get() == "--benchmark-output") {
+			output_path = E->next()->get();
+		} else if (E->get() == "--benchmark-min-time") {
+			min_time = MAX(E->next()->get().to_float(), 0.001);
+		} else if (E->get() == "--benchmark-samples") {
+			sample_count = MAX(E->next()->get().to_int(), 1);
+		}
+	}
+
+	const uint64_t min_time_usec = uint64_t(min_time * 1000000.0);
+	Array results;
+
+	for (uint32_t i = 0; benchmarks && i < benchmarks->size(); i++) {
+		const BenchmarkEntry &entry = (*benchmarks)[i];
+		if (!filter.is_empty() && String(entry.name).find(filter) == -1) {
+			continue;
+		}
+		OS::get_singleton()->print("Running %s...\n", entry.name);
+
+		// Grow the iteration count until a single sample lasts at least the minimum time.
+		uint64_t iterations = 1;
+		while (true) {
+			uint64_t elapsed = _time_iterations(entry.function, iterations);
+			if (elapsed >= min_time_usec || iterations >= (uint64_t(1) << 40)) {
+				break;
+			}
+			uint64_t estimate = elapsed > 0 ? uint64_t(double(iterations) * 1.2 * double(min_time_usec) / double(elapsed)) : iterations * 10;
+			iterations = CLAMP(estimate, iterations * 2, iterations * 10);
+		}
+
+		Vector<double> samples;
+		for (int j = 0; j < sample_count; j++) {
+			samples.push_back(double(_time_iterations(entry.function, iterations)) * 1000.0 / double(iterations));
+		}
+		samples.sort();
+		double mean = 0.0;
+		for (int j = 0; j < samples.size(); j++) {
+			mean += samples[j];
+		}
+		mean /= samples.size();
+
+		Dictionary result;
+		result["name"] = entry.name;
+		result["iterations"] = iterations;
+		result["samples"] = samples.size();
+		result["ns_per_iteration_min"] = samples[0];
+		result["ns_per_iteration_median"] = samples[samples.size() / 2];
+		result["ns_per_iteration_mean"] = mean;
+		results.push_back(result);
+	}
+
+	Dictionary report;
+	report["engine_version"] = VERSION_FULL_BUILD;
+	report["engine_hash"] = VERSION_HASH;
+#ifdef DEBUG_ENABLED
+	report["debug"] = true;
+#else
+	report["debug"] = false;
+#endif
+	report["processor_count"] = OS::get_singleton()->get_processor_count();
+	report["benchmarks"] = results;
+
+	String json = JSON::stringify(report, "\t", false);
+	if (output_path.is_empty()) {
+		OS::get_singleton()->print("%s\n", json.utf8().get_data());
+	} else {
+		Ref<FileAccess> f = FileAccess::open(output_path, FileAccess::WRITE);
+		ERR_FAIL_COND_MSG(f.is_null(), "Can't open benchmark output file: " + output_path);
+		f->store_string(json);
+	}
+
+	delete benchmarks;
+	benchmarks = nullptr;
+}
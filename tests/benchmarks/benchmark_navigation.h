@@ -0,0 +1,100 @@
+/*************************************************************************/
+/*  benchmark_navigation.h                                               */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef BENCHMARK_NAVIGATION_H
+#define BENCHMARK_NAVIGATION_H
+
+#include "modules/modules_enabled.gen.h" // For navigation.
+
+#ifdef MODULE_NAVIGATION_ENABLED
+
+#include "modules/navigation/nav_map.h"
+#include "modules/navigation/nav_region.h"
+#include "scene/resources/navigation_mesh.h"
+
+#include "tests/benchmarks/benchmark.h"
+
+namespace BenchmarkNavigation {
+
+static const int GRID_SIZE = 64;
+
+// A flat grid of GRID_SIZE² quads with a wall in the middle, so paths have to go around it.
+static Ref<NavigationMesh> _make_grid_mesh() {
+	Ref<NavigationMesh> mesh;
+	mesh.instantiate();
+	Vector<Vector3> vertices;
+	for (int z = 0; z <= GRID_SIZE; z++) {
+		for (int x = 0; x <= GRID_SIZE; x++) {
+			vertices.push_back(Vector3(x, 0, z));
+		}
+	}
+	mesh->set_vertices(vertices);
+	for (int z = 0; z < GRID_SIZE; z++) {
+		for (int x = 0; x < GRID_SIZE; x++) {
+			if (x == GRID_SIZE / 2 && z > 0) {
+				continue; // The wall, open at z == 0.
+			}
+			const int a = z * (GRID_SIZE + 1) + x;
+			Vector<int> polygon;
+			polygon.push_back(a);
+			polygon.push_back(a + GRID_SIZE + 1);
+			polygon.push_back(a + GRID_SIZE + 2);
+			polygon.push_back(a + 1);
+			mesh->add_polygon(polygon);
+		}
+	}
+	return mesh;
+}
+
+static void nav_map_get_path(uint64_t p_iterations) {
+	NavMap map;
+	NavRegion region;
+	region.set_mesh(_make_grid_mesh());
+	region.set_map(&map);
+	map.add_region(&region);
+	map.sync();
+
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		const real_t offset = real_t(i % 16);
+		Vector<Vector3> path = map.get_path(Vector3(2 + offset, 0, GRID_SIZE - 2), Vector3(GRID_SIZE - 2 - offset, 0, GRID_SIZE - 2), true);
+		benchmark_do_not_optimize(path);
+	}
+
+	map.remove_region(&region);
+	region.set_map(nullptr);
+}
+
+REGISTER_BENCHMARK("NavMap/get_path_64x64", nav_map_get_path);
+
+} // namespace BenchmarkNavigation
+
+#endif // MODULE_NAVIGATION_ENABLED
+
+#endif // BENCHMARK_NAVIGATION_H
@@ -0,0 +1,103 @@
+/*************************************************************************/
+/*  benchmark_physics.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef BENCHMARK_PHYSICS_H
+#define BENCHMARK_PHYSICS_H
+
+#ifndef _3D_DISABLED
+
+#include "servers/physics_3d/godot_physics_server_3d.h"
+
+#include "tests/benchmarks/benchmark.h"
+
+namespace BenchmarkPhysics {
+
+// An iteration is a 60 Hz physics step of a stack of spheres falling on a floor.
+static void _physics_3d_step(uint64_t p_iterations, int p_body_count) {
+	GodotPhysicsServer3D *ps = memnew(GodotPhysicsServer3D);
+	ps->init();
+	ps->set_active(true);
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(200, 1, 200));
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_add_shape(floor, floor_shape);
+	ps->body_set_space(floor, space);
+
+	RID sphere_shape = ps->sphere_shape_create();
+	ps->shape_set_data(sphere_shape, 0.5);
+	LocalVector<RID> bodies;
+	const int side = Math::ceil(Math::sqrt(double(p_body_count)));
+	for (int i = 0; i < p_body_count; i++) {
+		RID body = ps->body_create();
+		ps->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+		ps->body_add_shape(body, sphere_shape);
+		Vector3 origin((i % side) * 1.2, 2.0 + (i / (side * side)) * 1.2, ((i / side) % side) * 1.2);
+		ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), origin));
+		ps->body_set_space(body, space);
+		bodies.push_back(body);
+	}
+
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		ps->step(1.0 / 60.0);
+		ps->flush_queries();
+	}
+
+	for (uint32_t i = 0; i < bodies.size(); i++) {
+		ps->free(bodies[i]);
+	}
+	ps->free(floor);
+	ps->free(sphere_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+	ps->finish();
+	memdelete(ps);
+}
+
+static void physics_3d_step_100(uint64_t p_iterations) {
+	_physics_3d_step(p_iterations, 100);
+}
+
+static void physics_3d_step_1000(uint64_t p_iterations) {
+	_physics_3d_step(p_iterations, 1000);
+}
+
+REGISTER_BENCHMARK("Physics3D/step_100_bodies", physics_3d_step_100);
+REGISTER_BENCHMARK("Physics3D/step_1000_bodies", physics_3d_step_1000);
+
+} // namespace BenchmarkPhysics
+
+#endif // _3D_DISABLED
+
+#endif // BENCHMARK_PHYSICS_H
@@ -0,0 +1,158 @@
+/*************************************************************************/
+/*  benchmark_variant.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef BENCHMARK_VARIANT_H
+#define BENCHMARK_VARIANT_H
+
+#include "core/object/callable_method_pointer.h"
+#include "core/object/ref_counted.h"
+#include "core/string/string_name.h"
+#include "core/variant/callable.h"
+#include "core/variant/variant.h"
+
+#include "tests/benchmarks/benchmark.h"
+
+namespace BenchmarkVariant {
+
+static const int NAME_COUNT = 1024;
+
+// Interning a name that already exists, which is what most StringName constructions do.
+static void string_name_intern_existing(uint64_t p_iterations) {
+	Vector<String> strings;
+	Vector<StringName> names; // Keeps the names alive.
+	for (int i = 0; i < NAME_COUNT; i++) {
+		strings.push_back(vformat("benchmark_name_%d", i));
+		names.push_back(StringName(strings[i]));
+	}
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		StringName name(strings[i % NAME_COUNT]);
+		benchmark_do_not_optimize(name);
+	}
+}
+
+static void string_name_intern_new(uint64_t p_iterations) {
+	Vector<String> strings;
+	for (int i = 0; i < NAME_COUNT; i++) {
+		strings.push_back(vformat("benchmark_unique_name_%d", i));
+	}
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		// Destroyed right away, so the next construction of the same string interns it again.
+		StringName name(strings[i % NAME_COUNT]);
+		benchmark_do_not_optimize(name);
+	}
+}
+
+static void string_name_compare(uint64_t p_iterations) {
+	StringName a = "benchmark_a";
+	StringName b = "benchmark_b";
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		bool equal = (i & 1) ? a == b : a == a;
+		benchmark_do_not_optimize(equal);
+	}
+}
+
+static void variant_evaluate_add(uint64_t p_iterations) {
+	Variant a = 1.5;
+	Variant b = 2;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		Variant r;
+		bool valid = false;
+		Variant::evaluate(Variant::OP_ADD, a, b, r, valid);
+		benchmark_do_not_optimize(r);
+	}
+}
+
+static void variant_validated_add(uint64_t p_iterations) {
+	Variant a = Vector3(1, 2, 3);
+	Variant b = Vector3(4, 5, 6);
+	Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator(Variant::OP_ADD, Variant::VECTOR3, Variant::VECTOR3);
+	Variant r = Vector3();
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		evaluator(&a, &b, &r);
+		benchmark_do_not_optimize(r);
+	}
+}
+
+static void variant_construct_string(uint64_t p_iterations) {
+	String s = "benchmark";
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		Variant v = s;
+		benchmark_do_not_optimize(v);
+	}
+}
+
+static void variant_call_method(uint64_t p_iterations) {
+	Variant v = Vector3(1, 2, 3);
+	StringName method = "length";
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		Callable::CallError ce;
+		Variant r;
+		v.callp(method, nullptr, 0, r, ce);
+		benchmark_do_not_optimize(r);
+	}
+}
+
+static void callable_call_method_bind(uint64_t p_iterations) {
+	Ref<RefCounted> object;
+	object.instantiate();
+	Callable callable(object.ptr(), "get_reference_count");
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		Callable::CallError ce;
+		Variant r;
+		callable.callp(nullptr, 0, r, ce);
+		benchmark_do_not_optimize(r);
+	}
+}
+
+static void callable_call_method_pointer(uint64_t p_iterations) {
+	Ref<RefCounted> object;
+	object.instantiate();
+	Callable callable = callable_mp(object.ptr(), &RefCounted::get_reference_count);
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		Callable::CallError ce;
+		Variant r;
+		callable.callp(nullptr, 0, r, ce);
+		benchmark_do_not_optimize(r);
+	}
+}
+
+REGISTER_BENCHMARK("StringName/intern_existing", string_name_intern_existing);
+REGISTER_BENCHMARK("StringName/intern_new", string_name_intern_new);
+REGISTER_BENCHMARK("StringName/compare", string_name_compare);
+REGISTER_BENCHMARK("Variant/evaluate_add", variant_evaluate_add);
+REGISTER_BENCHMARK("Variant/validated_add_vector3", variant_validated_add);
+REGISTER_BENCHMARK("Variant/construct_string", variant_construct_string);
+REGISTER_BENCHMARK("Variant/call_builtin_method", variant_call_method);
+REGISTER_BENCHMARK("Callable/call_method_bind", callable_call_method_bind);
+REGISTER_BENCHMARK("Callable/call_method_pointer", callable_call_method_pointer);
+
+} // namespace BenchmarkVariant
+
+#endif // BENCHMARK_VARIANT_H
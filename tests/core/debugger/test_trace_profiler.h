@@ -0,0 +1,93 @@
+/*************************************************************************/
+/*  test_trace_profiler.h                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_TRACE_PROFILER_H
+#define TEST_TRACE_PROFILER_H
+
+#include "core/debugger/trace_profiler.h"
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTraceProfiler {
+
+static void thread_zone(void *p_userdata) {
+	TraceProfiler::Zone zone("test_thread_zone");
+}
+
+TEST_CASE("[TraceProfiler] Record zones from several threads") {
+	const String path = OS::get_singleton()->get_cache_path().path_join("test_trace.json");
+	REQUIRE(TraceProfiler::start(path) == OK);
+	CHECK(TraceProfiler::is_active());
+
+	{
+		TraceProfiler::Zone zone("test_main_zone");
+	}
+	Thread thread;
+	thread.start(thread_zone, nullptr);
+	thread.wait_to_finish();
+
+	TraceProfiler::stop();
+	CHECK_FALSE(TraceProfiler::is_active());
+
+	{
+		// Not recorded, the trace was stopped.
+		TraceProfiler::Zone zone("test_late_zone");
+	}
+
+	JSON json;
+	REQUIRE(json.parse(FileAccess::get_file_as_string(path)) == OK);
+	const Array events = json.get_data();
+
+	int main_tid = -1;
+	int thread_tid = -1;
+	for (int i = 0; i < events.size(); i++) {
+		const Dictionary event = events[i];
+		CHECK_MESSAGE(String(event["name"]) != "test_late_zone", "Zones closed after stopping should be dropped.");
+		if (String(event["ph"]) != "X") {
+			continue;
+		}
+		CHECK(double(event["dur"]) >= 0.0);
+		if (String(event["name"]) == "test_main_zone") {
+			main_tid = event["tid"];
+		} else if (String(event["name"]) == "test_thread_zone") {
+			thread_tid = event["tid"];
+		}
+	}
+	CHECK_MESSAGE(main_tid != -1, "The zone on the main thread should be recorded.");
+	CHECK_MESSAGE(thread_tid != -1, "The zone on the other thread should be recorded.");
+	CHECK_MESSAGE(main_tid != thread_tid, "Zones should be recorded with the ID of their own thread.");
+}
+
+} // namespace TestTraceProfiler
+
+#endif // TEST_TRACE_PROFILER_H
@@ -0,0 +1,151 @@
+/*************************************************************************/
+/*  test_compact_variant.h                                               */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_COMPACT_VARIANT_H
+#define TEST_COMPACT_VARIANT_H
+
+#include "core/io/compact_variant.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCompactVariant {
+
+TEST_CASE("[CompactVariant] Round trip") {
+	Dictionary d;
+	d["int"] = -123456789012;
+	d["float"] = 0.5;
+	d["double"] = 0.1;
+	d["string"] = String::utf8("Hello Godot ✓");
+	d[StringName("name")] = NodePath("A/B:c");
+	d[Vector2i(1, -2)] = Transform3D(Basis(Vector3(0, 1, 0), 0.5), Vector3(1, 2, 3));
+	d["color"] = Color(0.25, 0.5, 0.75, 1);
+	d["bool"] = true;
+	d["nil"] = Variant();
+
+	Array a;
+	a.push_back(Rect2i(1, 2, -3, 4));
+	a.push_back(d.duplicate());
+	d["array"] = a;
+
+	PackedInt32Array ints;
+	ints.push_back(7);
+	ints.push_back(-8);
+	d["ints"] = ints;
+	PackedStringArray strings;
+	strings.push_back("string");
+	strings.push_back("other");
+	d["strings"] = strings;
+
+	const PackedByteArray data = CompactVariant::encode(d);
+	CHECK(data.size() > 0);
+	const Variant decoded = CompactVariant::decode(data);
+	CHECK(decoded.get_type() == Variant::DICTIONARY);
+	CHECK(decoded == Variant(d));
+}
+
+TEST_CASE("[CompactVariant] Integers and floats are compact") {
+	CHECK(CompactVariant::encode(5).size() == 4 + 1 + 2);
+	CHECK(CompactVariant::encode(0.5).size() == 4 + 1 + 5);
+	CHECK(CompactVariant::encode(0.1).size() == 4 + 1 + 9);
+	CHECK(double(CompactVariant::decode(CompactVariant::encode(0.1))) == 0.1);
+}
+
+TEST_CASE("[CompactVariant] Lazy reading") {
+	Dictionary inner;
+	inner["x"] = 10;
+	PackedVector3Array points;
+	points.push_back(Vector3(1, 2, 3));
+	points.push_back(Vector3(4, 5, 6));
+	inner["points"] = points;
+	Array list;
+	list.push_back("first");
+	list.push_back(inner);
+	Dictionary root;
+	root["list"] = list;
+	root["count"] = 2;
+
+	Ref<CompactVariant> reader;
+	reader.instantiate();
+	CHECK(!reader->is_open());
+	REQUIRE(reader->open(CompactVariant::encode(root)) == OK);
+	CHECK(reader->is_open());
+	CHECK(reader->get_type() == Variant::DICTIONARY);
+	CHECK(reader->size() == 2);
+	CHECK(reader->get_keys().size() == 2);
+	CHECK(reader->has("count"));
+	CHECK(!reader->has("missing"));
+	CHECK(int(reader->get("count")) == 2);
+	CHECK(int(reader->get("missing", -1)) == -1);
+
+	Ref<CompactVariant> list_reader = reader->get_reader("list");
+	REQUIRE(list_reader.is_valid());
+	CHECK(list_reader->get_type() == Variant::ARRAY);
+	CHECK(list_reader->size() == 2);
+	CHECK(String(list_reader->get(0)) == "first");
+	CHECK(list_reader->get(2) == Variant());
+
+	Ref<CompactVariant> inner_reader = list_reader->get_reader(1);
+	REQUIRE(inner_reader.is_valid());
+	CHECK(int(inner_reader->get("x")) == 10);
+	CHECK(inner_reader->get_value() == Variant(inner));
+
+	Ref<CompactVariant> points_reader = inner_reader->get_reader("points");
+	REQUIRE(points_reader.is_valid());
+	CHECK(points_reader->get_type() == Variant::PACKED_VECTOR3_ARRAY);
+	CHECK(points_reader->size() == 2);
+	CHECK(Vector3(points_reader->get(1)) == Vector3(4, 5, 6));
+}
+
+TEST_CASE("[CompactVariant] Invalid data") {
+	Array a;
+	a.push_back("text");
+	a.push_back(PackedFloat64Array());
+	a.push_back(Vector3(1, 2, 3));
+	const PackedByteArray data = CompactVariant::encode(a);
+
+	ERR_PRINT_OFF;
+	// Every truncation of a valid buffer must be rejected.
+	for (int i = 0; i < data.size(); i++) {
+		CHECK(CompactVariant::decode(data.slice(0, i)) == Variant());
+	}
+
+	Ref<CompactVariant> reader;
+	reader.instantiate();
+	CHECK(reader->open(PackedByteArray()) == ERR_FILE_UNRECOGNIZED);
+	CHECK(!reader->is_open());
+
+	Object object;
+	CHECK(CompactVariant::encode(&object).is_empty());
+	ERR_PRINT_ON;
+}
+
+} // namespace TestCompactVariant
+
+#endif // TEST_COMPACT_VARIANT_H
@@ -32,6 +32,8 @@
 #define TEST_FILE_ACCESS_H
 
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -101,6 +103,59 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+
+TEST_CASE("[FileAccess] Positional and asynchronous reads") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("line_endings_lf.test.txt"), FileAccess::READ);
+	f->seek(3);
+
+	uint8_t word[8] = {};
+	CHECK(f->get_buffer_at(6, word, 8) == 8);
+	CHECK(String::utf8((const char *)word, 8) == "darkness");
+	CHECK_MESSAGE(f->get_position() == 3, "Positional reads should not move the file position.");
+
+	uint8_t bytes[2][5] = {};
+	WorkerThreadPool::TaskID tasks[2];
+	tasks[0] = f->get_buffer_async(0, bytes[0], 5);
+	tasks[1] = f->get_buffer_async(15, bytes[1], 5);
+	for (int i = 0; i < 2; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+	}
+	CHECK(String::utf8((const char *)bytes[0], 5) == "Hello");
+	CHECK(String::utf8((const char *)bytes[1], 5) == "My ol");
+
+	uint8_t tail[16] = {};
+	CHECK_MESSAGE(f->get_buffer_at(f->get_length() - 4, tail, 16) == 4, "Reads past the end should be truncated.");
+}
+
+TEST_CASE("[FileAccess] Encrypted files larger than a decryption chunk") {
+	const String path = OS::get_singleton()->get_cache_path().path_join("test_encrypted.bin");
+	Vector<uint8_t> key;
+	key.resize(32);
+	for (int i = 0; i < 32; i++) {
+		key.write[i] = i * 7;
+	}
+
+	// Not a multiple of the chunk or block size, so the last chunk is partial.
+	const int size = 1024 * 1024 + 13;
+	{
+		Ref<FileAccess> f = FileAccess::open_encrypted(path, FileAccess::WRITE, key);
+		REQUIRE(f.is_valid());
+		for (int i = 0; i < size; i++) {
+			f->store_8(i % 251);
+		}
+	}
+
+	Ref<FileAccess> f = FileAccess::open_encrypted(path, FileAccess::READ, key);
+	REQUIRE(f.is_valid());
+	CHECK(f->get_length() == size);
+	Vector<uint8_t> data = f->_get_buffer(size);
+	REQUIRE(data.size() == size);
+	bool match = true;
+	for (int i = 0; i < size && match; i++) {
+		match = data[i] == i % 251;
+	}
+	CHECK_MESSAGE(match, "Decrypted content should match what was written.");
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
@@ -146,6 +146,67 @@ TEST_CASE("[JSON] Parsing objects (dictionaries)") {
 			dictionary["empty_object"].hash() == Dictionary().hash(),
 			"The parsed JSON should contain the expected values.");
 }
+
+TEST_CASE("[JSON] Parsing UTF-8 buffers") {
+	JSON json;
+
+	const String source = String::utf8(R"({"name": "Gödot Éngine", "escaped": "tab\tquote\"", "long": "A string long enough to be scanned eight bytes at a time.", "values": [1, -2.5, true]})");
+	json.parse_utf8(source.to_utf8_buffer());
+	CHECK_MESSAGE(
+			json.get_error_line() == 0,
+			"Parsing a UTF-8 JSON buffer should parse successfully.");
+	const Dictionary dictionary = json.get_data();
+	CHECK_MESSAGE(
+			dictionary["name"] == String::utf8("Gödot Éngine"),
+			"Non-ASCII strings should be decoded from UTF-8.");
+	CHECK_MESSAGE(
+			dictionary["escaped"] == "tab\tquote\"",
+			"Escape sequences should be decoded.");
+	CHECK_MESSAGE(
+			dictionary["long"] == "A string long enough to be scanned eight bytes at a time.",
+			"Long strings should be decoded.");
+	CHECK_MESSAGE(
+			Array(dictionary["values"])[1] == Variant(-2.5),
+			"Numbers should be decoded.");
+
+	JSON json_string;
+	json_string.parse(source);
+	CHECK_MESSAGE(
+			JSON::stringify(json.get_data()) == JSON::stringify(json_string.get_data()),
+			"Parsing a UTF-8 buffer should give the same result as parsing a String.");
+
+	CHECK_MESSAGE(
+			json.parse_utf8(String("[1, 2").to_utf8_buffer()) != OK,
+			"Parsing an unterminated UTF-8 JSON buffer should fail.");
+}
+
+TEST_CASE("[JSON] Parsing packed numeric arrays") {
+	JSON json;
+
+	json.parse(R"({"ints": [1, -2, 3000000000], "floats": [1, 2.5, 1e3], "mixed": [1, "two"], "empty": []})", true);
+	const Dictionary dictionary = json.get_data();
+	CHECK_MESSAGE(
+			dictionary["ints"].get_type() == Variant::PACKED_INT64_ARRAY,
+			"Integer arrays should be decoded into a PackedInt64Array.");
+	CHECK_MESSAGE(
+			PackedInt64Array(dictionary["ints"])[2] == 3000000000,
+			"Large integers should be decoded exactly.");
+	CHECK_MESSAGE(
+			dictionary["floats"].get_type() == Variant::PACKED_FLOAT64_ARRAY,
+			"Numeric arrays should be decoded into a PackedFloat64Array.");
+	CHECK_MESSAGE(
+			PackedFloat64Array(dictionary["floats"])[2] == doctest::Approx(1000.0),
+			"Numeric arrays should contain the expected values.");
+	CHECK_MESSAGE(
+			dictionary["mixed"].get_type() == Variant::ARRAY,
+			"Arrays with non-numeric values should be decoded into an Array.");
+	CHECK_MESSAGE(
+			Array(dictionary["mixed"])[0] == Variant(1.0),
+			"Arrays with non-numeric values should contain the expected values.");
+	CHECK_MESSAGE(
+			dictionary["empty"].get_type() == Variant::ARRAY,
+			"Empty arrays should be decoded into an Array.");
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
@@ -36,6 +36,7 @@
 #include "core/io/resource_saver.h"
 #include "core/os/os.h"
 
+#include "tests/test_macros.h"
 #include "thirdparty/doctest/doctest.h"
 
 namespace TestResource {
@@ -109,6 +110,93 @@ TEST_CASE("[Resource] Saving and loading") {
 			loaded_child_resource_text->get_name() == "I'm a child resource",
 			"The loaded child resource name should be equal to the expected value.");
 }
+
+TEST_CASE("[Resource] Saving and loading many subresources") {
+	// Enough subresources for the binary saver to serialize them on worker threads.
+	Ref<Resource> resource = memnew(Resource);
+	Array children;
+	for (int i = 0; i < 100; i++) {
+		Ref<Resource> child_resource = memnew(Resource);
+		child_resource->set_name(vformat("Child %d", i));
+		child_resource->set_meta("index", i);
+		if (i > 0) {
+			child_resource->set_meta("previous", children[i - 1]);
+		}
+		children.push_back(child_resource);
+	}
+	resource->set_meta("children", children);
+	const String save_path_binary = OS::get_singleton()->get_cache_path().path_join("resource_many.res");
+	ResourceSaver::save(resource, save_path_binary);
+
+	const Ref<Resource> &loaded_resource = ResourceLoader::load(save_path_binary);
+	REQUIRE(loaded_resource.is_valid());
+	const Array loaded_children = loaded_resource->get_meta("children");
+	REQUIRE(loaded_children.size() == 100);
+	for (int i = 0; i < loaded_children.size(); i++) {
+		const Ref<Resource> loaded_child = loaded_children[i];
+		CHECK_MESSAGE(
+				loaded_child->get_name() == vformat("Child %d", i),
+				"The loaded child resource name should be equal to the expected value.");
+		CHECK_MESSAGE(
+				int(loaded_child->get_meta("index")) == i,
+				"The loaded child resource metadata should be equal to the expected value.");
+		if (i > 0) {
+			CHECK_MESSAGE(
+					Ref<Resource>(loaded_child->get_meta("previous")) == Ref<Resource>(loaded_children[i - 1]),
+					"References between subresources should be preserved.");
+		}
+	}
+}
+
+TEST_CASE("[Resource] Cache") {
+	const String path_a = "res://test_resource_cache_a.tres";
+	const String path_b = "res://test_resource_cache_b.tres";
+	const int initial_count = ResourceCache::get_cached_resource_count();
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_path(path_a);
+	CHECK_MESSAGE(
+			ResourceCache::has(path_a),
+			"The resource should be cached under its path.");
+	CHECK_MESSAGE(
+			ResourceCache::get_ref(path_a) == resource,
+			"The cache should return the resource registered under the path.");
+	CHECK_MESSAGE(
+			ResourceCache::get_cached_resource_count() == initial_count + 1,
+			"The cache should contain one more resource.");
+
+	resource->set_path(path_b);
+	CHECK_MESSAGE(
+			!ResourceCache::has(path_a),
+			"The previous path should be removed from the cache.");
+	CHECK_MESSAGE(
+			ResourceCache::get_ref(path_b) == resource,
+			"The resource should be cached under its new path.");
+
+	Ref<Resource> other = memnew(Resource);
+	ERR_PRINT_OFF;
+	other->set_path(path_b);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(
+			ResourceCache::get_ref(path_b) == resource,
+			"Setting a path already in use without taking it over should fail.");
+
+	other->set_path(path_b, true);
+	CHECK_MESSAGE(
+			ResourceCache::get_ref(path_b) == other,
+			"Taking over a path should replace the cached resource.");
+	CHECK_MESSAGE(
+			resource->get_path().is_empty(),
+			"The resource whose path was taken over should lose its path.");
+
+	other.unref();
+	CHECK_MESSAGE(
+			!ResourceCache::has(path_b),
+			"Freeing a resource should remove it from the cache.");
+	CHECK_MESSAGE(
+			ResourceCache::get_cached_resource_count() == initial_count,
+			"The cache should be back to its initial size.");
+}
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
@@ -32,6 +32,7 @@
 #define TEST_ASTAR_H
 
 #include "core/math/a_star.h"
+#include "core/math/a_star_grid_2d.h"
 
 #include "tests/test_macros.h"
 
@@ -85,6 +86,134 @@ TEST_CASE("[AStar3D] ABCX path") {
 	CHECK(path[3] == ABCX::C);
 }
 
+TEST_CASE("[AStar3D] Baked paths") {
+	ABCX abcx;
+	abcx.bake();
+	REQUIRE(abcx.is_baked());
+
+	Vector<int64_t> path = abcx.get_id_path(ABCX::X, ABCX::C);
+	REQUIRE(path.size() == 4);
+	CHECK(path[0] == ABCX::X);
+	CHECK(path[1] == ABCX::A);
+	CHECK(path[2] == ABCX::B);
+	CHECK(path[3] == ABCX::C);
+
+	// Disabling a point keeps the graph baked.
+	abcx.set_point_disabled(ABCX::B);
+	CHECK(abcx.is_baked());
+	path = abcx.get_id_path(ABCX::X, ABCX::C);
+	REQUIRE(path.size() == 3);
+	CHECK(path[1] == ABCX::A);
+	abcx.set_point_disabled(ABCX::B, false);
+
+	PackedInt64Array from_ids;
+	PackedInt64Array to_ids;
+	from_ids.push_back(ABCX::A);
+	to_ids.push_back(ABCX::C);
+	from_ids.push_back(ABCX::X);
+	to_ids.push_back(ABCX::B);
+	from_ids.push_back(ABCX::C);
+	to_ids.push_back(ABCX::C);
+	TypedArray<PackedInt64Array> paths = abcx.get_id_paths(from_ids, to_ids);
+	REQUIRE(paths.size() == 3);
+	CHECK(PackedInt64Array(paths[0]).size() == 3);
+	CHECK(PackedInt64Array(paths[1]).size() == 3);
+	CHECK(PackedInt64Array(paths[2]).size() == 1);
+
+	// Changing the connections discards the baked graph.
+	abcx.disconnect_points(ABCX::A, ABCX::B);
+	CHECK(!abcx.is_baked());
+	path = abcx.get_id_path(ABCX::A, ABCX::C);
+	REQUIRE(path.size() == 2);
+	CHECK(path[1] == ABCX::C);
+}
+
+TEST_CASE("[AStarGrid2D] Hierarchical paths") {
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	grid->set_size(Size2i(32, 32));
+	grid->set_cluster_size(8);
+	grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_NEVER);
+	grid->set_default_heuristic(AStarGrid2D::HEURISTIC_MANHATTAN);
+	grid->update();
+
+	// A wall along x = 12 with a single gap at y = 30.
+	for (int y = 0; y < 30; y++) {
+		grid->set_point_solid(Vector2i(12, y));
+	}
+	int64_t plain_size = grid->get_id_path(Vector2i(0, 0), Vector2i(31, 0)).size();
+	CHECK(plain_size == 92);
+
+	grid->set_hierarchical_enabled(true);
+	TypedArray<Vector2i> path = grid->get_id_path(Vector2i(0, 0), Vector2i(31, 0));
+	REQUIRE(path.size() >= plain_size);
+	CHECK(Vector2i(path[0]) == Vector2i(0, 0));
+	CHECK(Vector2i(path[path.size() - 1]) == Vector2i(31, 0));
+	bool valid = true;
+	for (int64_t i = 0; i < path.size(); i++) {
+		Vector2i id = path[i];
+		if (grid->is_point_solid(id) || (i > 0 && (id - Vector2i(path[i - 1])).abs() != Vector2i(1, 0) && (id - Vector2i(path[i - 1])).abs() != Vector2i(0, 1))) {
+			valid = false;
+		}
+	}
+	CHECK(valid);
+
+	// Closing the gap only rebuilds the affected clusters and disconnects both sides.
+	grid->set_point_solid(Vector2i(12, 30));
+	grid->set_point_solid(Vector2i(12, 31));
+	CHECK(grid->get_id_path(Vector2i(0, 0), Vector2i(31, 0)).is_empty());
+
+	// Opening a shortcut makes it available right away.
+	grid->set_point_solid(Vector2i(12, 4), false);
+	path = grid->get_id_path(Vector2i(0, 0), Vector2i(31, 0));
+	CHECK(path.size() < plain_size);
+	CHECK(path.has(Vector2i(12, 4)));
+
+	// Paths inside a single cluster don't use the hierarchy.
+	path = grid->get_id_path(Vector2i(0, 0), Vector2i(7, 7));
+	CHECK(path.size() == 15);
+}
+
+TEST_CASE("[AStarGrid2D] Flow fields") {
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	grid->set_size(Size2i(16, 16));
+	grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_NEVER);
+	grid->set_default_heuristic(AStarGrid2D::HEURISTIC_MANHATTAN);
+	grid->update();
+	for (int y = 0; y < 15; y++) {
+		grid->set_point_solid(Vector2i(8, y));
+	}
+
+	TypedArray<Vector2i> goals;
+	goals.push_back(Vector2i(15, 0));
+	goals.push_back(Vector2i(0, 0));
+	grid->build_flow_fields(goals);
+	CHECK(grid->has_flow_field(Vector2i(15, 0)));
+	CHECK(grid->has_flow_field(Vector2i(0, 0)));
+
+	// Following the field reaches the goal along a shortest path.
+	Vector2i id(0, 0);
+	int steps = 0;
+	while (id != Vector2i(15, 0) && steps < 256) {
+		Vector2i direction = grid->get_flow_direction(Vector2i(15, 0), id);
+		REQUIRE(direction != Vector2i());
+		id += direction;
+		CHECK_FALSE(grid->is_point_solid(id));
+		steps++;
+	}
+	CHECK(id == Vector2i(15, 0));
+	CHECK(steps == 45);
+	CHECK(grid->get_flow_distance(Vector2i(15, 0), Vector2i(0, 0)) == doctest::Approx(45));
+	CHECK(grid->get_flow_direction(Vector2i(15, 0), Vector2i(15, 0)) == Vector2i());
+
+	// Changing obstacles discards the cached fields.
+	grid->set_point_solid(Vector2i(8, 15));
+	CHECK_FALSE(grid->has_flow_field(Vector2i(15, 0)));
+	CHECK(grid->get_flow_distance(Vector2i(15, 0), Vector2i(0, 0)) == INFINITY);
+	CHECK(grid->get_flow_direction(Vector2i(15, 0), Vector2i(0, 0)) == Vector2i());
+}
+
 TEST_CASE("[AStar3D] Add/Remove") {
 	AStar3D a;
 
@@ -321,6 +321,71 @@ TEST_CASE("[Expression] Expressions with variables") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Expression] Batch execution") {
+	Expression expression;
+
+	PackedStringArray parameter_names;
+	parameter_names.push_back("foo");
+	parameter_names.push_back("bar");
+	CHECK_MESSAGE(
+			expression.parse("foo * bar + 2 * 5", parameter_names) == OK,
+			"The expression should parse successfully.");
+
+	Array foo_values;
+	foo_values.push_back(1);
+	foo_values.push_back(2);
+	foo_values.push_back(3.5);
+	PackedInt32Array bar_values;
+	bar_values.push_back(10);
+	bar_values.push_back(20);
+	bar_values.push_back(2);
+	Array columns;
+	columns.push_back(foo_values);
+	columns.push_back(bar_values);
+
+	const Array results = expression.execute_many(columns);
+	CHECK_MESSAGE(
+			!expression.has_execute_failed(),
+			"The batch execution should succeed.");
+	REQUIRE(results.size() == 3);
+	CHECK_MESSAGE(
+			int(results[0]) == 20,
+			"The first row should return the expected value.");
+	CHECK_MESSAGE(
+			int(results[1]) == 50,
+			"The second row should return the expected value.");
+	CHECK_MESSAGE(
+			double(results[2]) == doctest::Approx(17.0),
+			"Rows with different operand types should return the expected value.");
+
+	Array mismatched_columns;
+	mismatched_columns.push_back(foo_values);
+	mismatched_columns.push_back(PackedInt32Array());
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(
+			expression.execute_many(mismatched_columns).is_empty(),
+			"Columns with different sizes should be rejected.");
+	ERR_PRINT_ON;
+
+	CHECK_MESSAGE(
+			expression.parse("1 / foo", parameter_names) == OK,
+			"The expression should parse successfully.");
+	Array zero_column;
+	zero_column.push_back(1);
+	zero_column.push_back(0);
+	Array zero_columns;
+	zero_columns.push_back(zero_column);
+	zero_columns.push_back(zero_column);
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(
+			expression.execute_many(zero_columns).is_empty(),
+			"A failing row should abort the batch execution.");
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"A failing row should be reported as an execution failure.");
+}
+
 TEST_CASE("[Expression] Invalid expressions") {
 	Expression expression;
 
@@ -0,0 +1,125 @@
+/*************************************************************************/
+/*  test_packed_array_math.h                                             */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PACKED_ARRAY_MATH_H
+#define TEST_PACKED_ARRAY_MATH_H
+
+#include "core/math/packed_array_math.h"
+#include "core/variant/variant.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestPackedArrayMath {
+
+// 11 elements, so both the vector body and the scalar tail of the kernels run.
+static PackedFloat32Array make_range(int p_size, float p_offset) {
+	PackedFloat32Array array;
+	for (int i = 0; i < p_size; i++) {
+		array.push_back(i + p_offset);
+	}
+	return array;
+}
+
+TEST_CASE("[PackedArrayMath] Element-wise operations") {
+	PackedFloat32Array a = make_range(11, 1);
+	const PackedFloat32Array b = make_range(11, 0);
+
+	PackedArrayMath::add(a.ptrw(), b.ptr(), a.size());
+	for (int i = 0; i < a.size(); i++) {
+		CHECK(a[i] == doctest::Approx(2 * i + 1));
+	}
+
+	a = make_range(11, 1);
+	PackedArrayMath::mul(a.ptrw(), b.ptr(), a.size());
+	for (int i = 0; i < a.size(); i++) {
+		CHECK(a[i] == doctest::Approx((i + 1) * i));
+	}
+
+	a = make_range(11, 1);
+	PackedArrayMath::scale(a.ptrw(), 0.5f, a.size());
+	CHECK(a[10] == doctest::Approx(5.5));
+
+	a = make_range(11, 1);
+	PackedArrayMath::lerp(a.ptrw(), b.ptr(), 0.25f, a.size());
+	for (int i = 0; i < a.size(); i++) {
+		CHECK(a[i] == doctest::Approx(i + 0.75));
+	}
+
+	a = make_range(11, 0);
+	PackedArrayMath::clamp(a.ptrw(), 2.0f, 7.5f, a.size());
+	CHECK(a[0] == doctest::Approx(2));
+	CHECK(a[5] == doctest::Approx(5));
+	CHECK(a[10] == doctest::Approx(7.5));
+}
+
+TEST_CASE("[PackedArrayMath] Reductions") {
+	const PackedFloat32Array a = make_range(11, 1);
+	const PackedFloat32Array b = make_range(11, 0);
+
+	CHECK(PackedArrayMath::sum(a.ptr(), a.size()) == doctest::Approx(66));
+	CHECK(PackedArrayMath::dot(a.ptr(), b.ptr(), a.size()) == doctest::Approx(440));
+	CHECK(PackedArrayMath::min(b.ptr(), b.size()) == doctest::Approx(0));
+	CHECK(PackedArrayMath::max(b.ptr(), b.size()) == doctest::Approx(10));
+
+	PackedFloat32Array unordered = make_range(9, 0);
+	unordered.set(6, -3);
+	unordered.set(2, 20);
+	CHECK(PackedArrayMath::min(unordered.ptr(), unordered.size()) == doctest::Approx(-3));
+	CHECK(PackedArrayMath::max(unordered.ptr(), unordered.size()) == doctest::Approx(20));
+
+	const float single = 4;
+	CHECK(PackedArrayMath::min(&single, 1) == doctest::Approx(4));
+	CHECK(PackedArrayMath::max(&single, 1) == doctest::Approx(4));
+}
+
+TEST_CASE("[PackedArrayMath] Script methods") {
+	Variant array = make_range(5, 0);
+	Callable::CallError ce;
+	Variant ret;
+	Variant factor = 2.0;
+	const Variant *args[1] = { &factor };
+	array.callp("scale", args, 1, ret, ce);
+	REQUIRE(ce.error == Callable::CallError::CALL_OK);
+	CHECK(double(array.call("sum")) == doctest::Approx(20));
+
+	PackedVector3Array points;
+	points.push_back(Vector3(1, 0, 0));
+	points.push_back(Vector3(0, 1, 0));
+	Variant points_variant = points;
+	Variant transform = Transform3D(Basis(), Vector3(0, 0, 5));
+	const Variant *transform_args[1] = { &transform };
+	points_variant.callp("transform_by", transform_args, 1, ret, ce);
+	REQUIRE(ce.error == Callable::CallError::CALL_OK);
+	CHECK(Vector3(points_variant.call("sum")).is_equal_approx(Vector3(1, 1, 10)));
+}
+
+} // namespace TestPackedArrayMath
+
+#endif // TEST_PACKED_ARRAY_MATH_H
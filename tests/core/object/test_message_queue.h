@@ -0,0 +1,130 @@
+/*************************************************************************/
+/*  test_message_queue.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_MESSAGE_QUEUE_H
+#define TEST_MESSAGE_QUEUE_H
+
+#include "core/object/message_queue.h"
+#include "core/object/object.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+class _TestMessageQueueReceiver : public Object {
+	GDCLASS(_TestMessageQueueReceiver, Object);
+
+public:
+	LocalVector<int> received;
+
+	void receive(int p_value) { received.push_back(p_value); }
+};
+
+namespace TestMessageQueue {
+
+struct ThreadPushData {
+	_TestMessageQueueReceiver *receiver = nullptr;
+	int count = 0;
+	int offset = 0;
+};
+
+static void push_from_thread(void *p_userdata) {
+	ThreadPushData *data = static_cast<ThreadPushData *>(p_userdata);
+	for (int i = 0; i < data->count; i++) {
+		MessageQueue::get_singleton()->push_callable(callable_mp(data->receiver, &_TestMessageQueueReceiver::receive), data->offset + i);
+	}
+}
+
+TEST_CASE("[MessageQueue] Messages are delivered in order and the queue grows past its initial size") {
+	MessageQueue *queue = MessageQueue::get_singleton() ? nullptr : memnew(MessageQueue);
+	_TestMessageQueueReceiver *receiver = memnew(_TestMessageQueueReceiver);
+
+	// Enough messages to exceed the default preallocated 4 MiB.
+	const int count = 100000;
+	for (int i = 0; i < count; i++) {
+		CHECK_EQ(MessageQueue::get_singleton()->push_callable(callable_mp(receiver, &_TestMessageQueueReceiver::receive), i), OK);
+	}
+	MessageQueue::get_singleton()->flush();
+
+	REQUIRE(receiver->received.size() == (uint32_t)count);
+	bool in_order = true;
+	for (int i = 0; i < count; i++) {
+		in_order = in_order && receiver->received[i] == i;
+	}
+	CHECK_MESSAGE(in_order, "Messages should be delivered in the order they were pushed.");
+
+	memdelete(receiver);
+	if (queue) {
+		memdelete(queue);
+	}
+}
+
+TEST_CASE("[MessageQueue] Messages pushed from other threads keep their order") {
+	MessageQueue *queue = MessageQueue::get_singleton() ? nullptr : memnew(MessageQueue);
+	_TestMessageQueueReceiver *receiver = memnew(_TestMessageQueueReceiver);
+
+	const int count = 10000;
+	ThreadPushData data[2];
+	Thread threads[2];
+	for (int i = 0; i < 2; i++) {
+		data[i].receiver = receiver;
+		data[i].count = count;
+		data[i].offset = (i + 1) * count;
+		threads[i].start(push_from_thread, &data[i]);
+	}
+	for (int i = 0; i < count; i++) {
+		MessageQueue::get_singleton()->push_callable(callable_mp(receiver, &_TestMessageQueueReceiver::receive), i);
+	}
+	for (int i = 0; i < 2; i++) {
+		threads[i].wait_to_finish();
+	}
+	MessageQueue::get_singleton()->flush();
+
+	REQUIRE(receiver->received.size() == (uint32_t)count * 3);
+	// Each producer's messages must come out in the order it pushed them.
+	int next[3] = { 0, count, count * 2 };
+	bool in_order = true;
+	for (uint32_t i = 0; i < receiver->received.size(); i++) {
+		int value = receiver->received[i];
+		int producer = value / count;
+		in_order = in_order && value == next[producer];
+		next[producer]++;
+	}
+	CHECK_MESSAGE(in_order, "Messages from each thread should be delivered in the order they were pushed.");
+
+	memdelete(receiver);
+	if (queue) {
+		memdelete(queue);
+	}
+}
+
+} // namespace TestMessageQueue
+
+#endif // TEST_MESSAGE_QUEUE_H
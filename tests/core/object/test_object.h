@@ -58,6 +58,52 @@ public:
 	int get_property() const { return property_value; }
 };
 
+class _TestLazyBaseObject : public Object {
+	GDCLASS(_TestLazyBaseObject, Object);
+
+	int value = 0;
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_value", "value"), &_TestLazyBaseObject::set_value);
+		ClassDB::bind_method(D_METHOD("get_value"), &_TestLazyBaseObject::get_value);
+		ADD_PROPERTY(PropertyInfo(Variant::INT, "value"), "set_value", "get_value");
+	}
+
+public:
+	void set_value(int p_value) { value = p_value; }
+	int get_value() const { return value; }
+};
+
+class _TestLazyDerivedObject : public _TestLazyBaseObject {
+	GDCLASS(_TestLazyDerivedObject, _TestLazyBaseObject);
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("get_doubled_value"), &_TestLazyDerivedObject::get_doubled_value);
+	}
+
+public:
+	int get_doubled_value() const { return get_value() * 2; }
+};
+
+class _TestLazyInstancedObject : public Object {
+	GDCLASS(_TestLazyInstancedObject, Object);
+
+	int value = 0;
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_value", "value"), &_TestLazyInstancedObject::set_value);
+		ClassDB::bind_method(D_METHOD("get_value"), &_TestLazyInstancedObject::get_value);
+		ADD_PROPERTY(PropertyInfo(Variant::INT, "value"), "set_value", "get_value");
+	}
+
+public:
+	void set_value(int p_value) { value = p_value; }
+	int get_value() const { return value; }
+};
+
 namespace TestObject {
 
 class _MockScriptInstance : public ScriptInstance {
@@ -182,6 +228,37 @@ TEST_CASE("[Object] Construction") {
 			"The database pointer returned by the object id should reference same object.");
 }
 
+TEST_CASE("[Object] Instance lookup") {
+	CHECK_MESSAGE(
+			ObjectDB::get_instance(ObjectID()) == nullptr,
+			"A null ID should never resolve to an object.");
+
+	Object *object = memnew(Object);
+	ObjectID id = object->get_instance_id();
+	memdelete(object);
+	CHECK_MESSAGE(
+			ObjectDB::get_instance(id) == nullptr,
+			"The ID of a freed object should no longer resolve.");
+
+	// Allocate enough objects to span several slot chunks.
+	Vector<Object *> objects;
+	for (int i = 0; i < 10000; i++) {
+		objects.push_back(memnew(Object));
+	}
+	bool all_found = true;
+	for (int i = 0; i < objects.size(); i++) {
+		all_found = all_found && ObjectDB::get_instance(objects[i]->get_instance_id()) == objects[i];
+	}
+	CHECK_MESSAGE(all_found, "Every live object should be found by its ID.");
+	CHECK_MESSAGE(
+			ObjectDB::get_instance(id) == nullptr,
+			"The ID of a freed object should not resolve to an object reusing its slot.");
+
+	for (int i = 0; i < objects.size(); i++) {
+		memdelete(objects[i]);
+	}
+}
+
 TEST_CASE("[Object] Script instance property setter") {
 	Object object;
 	_MockScriptInstance *script_instance = memnew(_MockScriptInstance);
@@ -281,6 +358,46 @@ TEST_CASE("[Object] Absent name getter") {
 			actual_value == Variant(),
 			"The returned value should equal nil variant.");
 }
+
+TEST_CASE("[Object] Lazy class binding on query") {
+	const bool lazy_binding = ClassDB::is_lazy_binding_enabled();
+	ClassDB::set_lazy_binding_enabled(true);
+	const uint32_t lazy_count = ClassDB::get_lazy_class_count();
+	GDREGISTER_CLASS(_TestLazyBaseObject);
+	GDREGISTER_CLASS(_TestLazyDerivedObject);
+	ClassDB::set_lazy_binding_enabled(lazy_binding);
+
+	CHECK_MESSAGE(
+			ClassDB::get_lazy_class_count() == lazy_count + 2,
+			"Both classes should be registered without being bound.");
+	CHECK(ClassDB::class_exists("_TestLazyDerivedObject"));
+	CHECK(ClassDB::is_parent_class("_TestLazyDerivedObject", "_TestLazyBaseObject"));
+
+	CHECK_MESSAGE(
+			ClassDB::has_method("_TestLazyDerivedObject", "get_value"),
+			"Querying the derived class should bind its parent too.");
+	CHECK(ClassDB::has_method("_TestLazyDerivedObject", "get_doubled_value"));
+	CHECK(ClassDB::has_property("_TestLazyBaseObject", "value"));
+	CHECK_MESSAGE(
+			ClassDB::get_lazy_class_count() == lazy_count,
+			"Both classes should be marked as bound.");
+}
+
+TEST_CASE("[Object] Lazy class binding on instantiation") {
+	const bool lazy_binding = ClassDB::is_lazy_binding_enabled();
+	ClassDB::set_lazy_binding_enabled(true);
+	GDREGISTER_CLASS(_TestLazyInstancedObject);
+	ClassDB::set_lazy_binding_enabled(lazy_binding);
+
+	Object *object = ClassDB::instantiate("_TestLazyInstancedObject");
+	REQUIRE(object != nullptr);
+
+	bool valid = false;
+	object->set("value", 42, &valid);
+	CHECK(valid);
+	CHECK(int(object->get("value")) == 42);
+	memdelete(object);
+}
 } // namespace TestObject
 
 #endif // TEST_OBJECT_H
@@ -0,0 +1,128 @@
+/*************************************************************************/
+/*  test_memory.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/os/frame_arena.h"
+#include "core/os/memory.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestMemory {
+
+TEST_CASE("[Memory] Reallocation keeps contents across size classes") {
+	uint8_t *mem = (uint8_t *)Memory::alloc_static(8, true);
+	for (int i = 0; i < 8; i++) {
+		mem[i] = i;
+	}
+
+	// Grow through several pool classes and past the largest one.
+	const size_t sizes[] = { 40, 200, 1000, 5000, 24 };
+	size_t filled = 8;
+	for (size_t size : sizes) {
+		mem = (uint8_t *)Memory::realloc_static(mem, size, true);
+		for (size_t i = 0; i < MIN(filled, size); i++) {
+			CHECK_MESSAGE(mem[i] == uint8_t(i), "Reallocation should keep the existing contents.");
+		}
+		for (size_t i = filled; i < size; i++) {
+			mem[i] = uint8_t(i);
+		}
+		filled = size;
+	}
+	Memory::free_static(mem, true);
+}
+
+TEST_CASE("[Memory] Allocations are aligned") {
+	for (size_t size = 1; size < 2048; size += 37) {
+		void *mem = Memory::alloc_static(size);
+		CHECK(((uintptr_t)mem & 15) == 0);
+		Memory::free_static(mem);
+	}
+}
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[Memory] Allocations are accounted to the tag of their scope") {
+	const uint64_t before = Memory::get_tag_usage(Memory::TAG_PHYSICS);
+	void *mem = nullptr;
+	{
+		MemoryTagScope scope(Memory::TAG_PHYSICS);
+		CHECK(Memory::get_current_tag() == Memory::TAG_PHYSICS);
+		mem = Memory::alloc_static(1000);
+	}
+	CHECK_MESSAGE(Memory::get_current_tag() == Memory::TAG_CORE, "The previous tag should be restored when leaving the scope.");
+	CHECK(Memory::get_tag_usage(Memory::TAG_PHYSICS) == before + 1000);
+
+	// Reallocating keeps the tag the block was allocated with, whatever the current scope is.
+	mem = Memory::realloc_static(mem, 3000);
+	CHECK(Memory::get_tag_usage(Memory::TAG_PHYSICS) == before + 3000);
+
+	Memory::free_static(mem);
+	CHECK(Memory::get_tag_usage(Memory::TAG_PHYSICS) == before);
+}
+#endif
+
+TEST_CASE("[FrameArena] Allocation and reset") {
+	FrameArena arena(256);
+
+	uint32_t *values = arena.alloc_array<uint32_t>(16);
+	for (uint32_t i = 0; i < 16; i++) {
+		values[i] = i;
+	}
+	CHECK(((uintptr_t)values & (alignof(uint32_t) - 1)) == 0);
+
+	void *aligned = arena.alloc(3, 64);
+	CHECK(((uintptr_t)aligned & 63) == 0);
+
+	// Larger than a block, gets one of its own.
+	uint8_t *big = (uint8_t *)arena.alloc(1024);
+	for (int i = 0; i < 1024; i++) {
+		big[i] = 0xAB;
+	}
+	for (uint32_t i = 0; i < 16; i++) {
+		CHECK_MESSAGE(values[i] == i, "Earlier allocations should not be overwritten.");
+	}
+	CHECK(arena.get_used() == 16 * sizeof(uint32_t) + 3 + 1024);
+
+	uint64_t capacity = arena.get_capacity();
+	arena.reset();
+	CHECK(arena.get_used() == 0);
+	CHECK_MESSAGE(arena.get_capacity() >= capacity, "Blocks should be merged, not released.");
+
+	// The merged block covers a frame of the same size.
+	arena.alloc_array<uint32_t>(16);
+	arena.alloc(3, 64);
+	arena.alloc(1024);
+	CHECK(arena.get_capacity() == capacity);
+}
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
@@ -167,6 +167,28 @@ TEST_CASE("[NodePath] Empty path") {
 			node_path_empty.is_empty(),
 			"The node path should be considered empty.");
 }
+
+TEST_CASE("[NodePath] Names are shared with existing StringNames") {
+	const StringName position = SNAME("position");
+	const StringName parent = StringName(String("Parent"));
+	const NodePath node_path = NodePath("Parent//Child/:position:x:");
+
+	CHECK_MESSAGE(
+			node_path.get_name_count() == 2,
+			"Repeated slashes should not produce empty names.");
+	CHECK_MESSAGE(
+			node_path.get_name(0) == parent,
+			"The name should be the same StringName as one built from a String.");
+	CHECK_MESSAGE(
+			node_path.get_subname(0) == position,
+			"The subname should be the same StringName as one built from a static C string.");
+	CHECK_MESSAGE(
+			node_path.get_subname_count() == 2,
+			"A trailing colon should be allowed.");
+	CHECK_MESSAGE(
+			node_path.get_subname(1) == StringName("x"),
+			"The returned subname should match the expected value.");
+}
 } // namespace TestNodePath
 
 #endif // TEST_NODE_PATH_H
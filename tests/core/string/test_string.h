@@ -356,6 +356,20 @@ TEST_CASE("[String] Find") {
 	CHECK(s.rfind("man") == 15);
 }
 
+TEST_CASE("[String] Find in long strings") {
+	// Long enough to go through the vectorized search, with matches on and across block boundaries.
+	String s = "abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0123456789";
+	CHECK(s.find("a") == 0);
+	CHECK(s.find("9") == 35);
+	CHECK(s.find("9a") == 35);
+	CHECK(s.find("z0", 30) == 61);
+	CHECK(s.find(String("89")) == 34);
+	CHECK(s.find(String("89"), 35) == 70);
+	CHECK(s.find("9b") == -1);
+	CHECK(s.find("") == 0);
+	CHECK(s.find(String("")) == -1);
+}
+
 TEST_CASE("[String] Find no case") {
 	String s = "Pretty Whale Whale";
 	CHECK(s.findn("WHA") == 7);
@@ -1366,6 +1380,22 @@ TEST_CASE("[String] Cyrillic to_lower()") {
 	CHECK(state);
 }
 
+TEST_CASE("[String] UTF-8 and case conversion of long mixed strings") {
+	// Runs of ASCII long enough for the vectorized paths, broken up by multi-byte characters and CRs.
+	const char *utf8 = "Some [ext_resource type=\"Texture2D\" path=\"res://icon.svg\"] ÀÉÎ ÕÜ\r\nАБВГДЕЁ plain ASCII text again until the end";
+	String s = String::utf8(utf8);
+	CHECK(s.utf8() == CharString(utf8));
+	CHECK(s.find(String::utf8("ÀÉÎ")) == s.find("res://") + 17);
+
+	String no_cr;
+	CHECK(no_cr.parse_utf8(utf8, -1, true) == OK);
+	CHECK(no_cr.length() == s.length() - 1);
+	CHECK(no_cr.find("\r") == -1);
+
+	CHECK(s.to_upper() == String::utf8("SOME [EXT_RESOURCE TYPE=\"TEXTURE2D\" PATH=\"RES://ICON.SVG\"] ÀÉÎ ÕÜ\r\nАБВГДЕЁ PLAIN ASCII TEXT AGAIN UNTIL THE END"));
+	CHECK(s.to_lower() == String::utf8("some [ext_resource type=\"texture2d\" path=\"res://icon.svg\"] àéî õü\r\nабвгдеё plain ascii text again until the end"));
+}
+
 TEST_CASE("[String] Count and countn functionality") {
 #define COUNT_TEST(x)             \
 	{                             \
@@ -128,6 +128,36 @@ TEST_CASE("[HashMap] Const iteration") {
 		++idx;
 	}
 }
+
+TEST_CASE("[HashMap] String keys") {
+	HashMap<String, int> map;
+	for (int i = 0; i < 200; i++) {
+		map.insert(vformat("res://some/rather/long/directory/path/to/resource_%d.tres", i), i);
+	}
+	map.insert("", -1);
+
+	CHECK(map.size() == 201);
+	for (int i = 0; i < 200; i++) {
+		const int *value = map.getptr(vformat("res://some/rather/long/directory/path/to/resource_%d.tres", i));
+		REQUIRE(value);
+		CHECK(*value == i);
+	}
+	CHECK(map[""] == -1);
+	CHECK_FALSE(map.has("res://some/rather/long/directory/path/to/resource_200.tres"));
+}
+
+TEST_CASE("[HashMap] Buffer hashing covers every byte") {
+	uint8_t buffer[128] = {};
+	for (int len = 1; len <= 128; len++) {
+		uint32_t h = hash_wyhash_buffer(buffer, len);
+		CHECK(h == hash_wyhash_buffer(buffer, len));
+		for (int i = 0; i < len; i++) {
+			buffer[i] = 1;
+			CHECK_MESSAGE(hash_wyhash_buffer(buffer, len) != h, vformat("Changing byte %d of %d should change the hash.", i, len));
+			buffer[i] = 0;
+		}
+	}
+}
 } // namespace TestHashMap
 
 #endif // TEST_HASH_MAP_H
@@ -31,7 +31,10 @@
 #ifndef TEST_RID_H
 #define TEST_RID_H
 
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
+#include "core/templates/rid_owner.h"
 
 #include "tests/test_macros.h"
 
@@ -96,6 +99,98 @@ TEST_CASE("[RID] 'get_local_index'") {
 	CHECK(RID::from_uint64(4'294'967'295).get_local_index() == 4'294'967'295);
 	CHECK(RID::from_uint64(4'294'967'297).get_local_index() == 1);
 }
+
+TEST_CASE("[RID_Owner] Allocation, lookup and free") {
+	// Small chunks, so the chunk tables are grown several times.
+	RID_Owner<int> owner(sizeof(int) * 4);
+	LocalVector<RID> rids;
+	for (int i = 0; i < 100; i++) {
+		rids.push_back(owner.make_rid(i));
+	}
+	CHECK(owner.get_rid_count() == 100);
+
+	for (uint32_t i = 0; i < rids.size(); i++) {
+		CHECK(owner.owns(rids[i]));
+		CHECK(*owner.get_or_null(rids[i]) == int(i));
+	}
+
+	owner.free(rids[10]);
+	CHECK_FALSE(owner.owns(rids[10]));
+	CHECK(owner.get_or_null(rids[10]) == nullptr);
+
+	// The slot is reused, but the old RID must not validate against it.
+	RID reused = owner.make_rid(1000);
+	CHECK(reused.get_local_index() == rids[10].get_local_index());
+	CHECK(owner.get_or_null(rids[10]) == nullptr);
+	CHECK(*owner.get_or_null(reused) == 1000);
+
+	for (uint32_t i = 0; i < rids.size(); i++) {
+		if (i != 10) {
+			owner.free(rids[i]);
+		}
+	}
+	owner.free(reused);
+	CHECK(owner.get_rid_count() == 0);
+}
+
+struct RIDOwnerThreadData {
+	RID_Owner<uint64_t, true> owner = RID_Owner<uint64_t, true>(sizeof(uint64_t) * 8);
+	LocalVector<RID> stable_rids;
+	SafeFlag done;
+	SafeNumeric<uint32_t> failures;
+};
+
+static void _rid_owner_reader(void *p_userdata) {
+	RIDOwnerThreadData *data = (RIDOwnerThreadData *)p_userdata;
+	while (!data->done.is_set()) {
+		for (uint32_t i = 0; i < data->stable_rids.size(); i++) {
+			uint64_t *value = data->owner.get_or_null(data->stable_rids[i]);
+			if (!value || *value != data->stable_rids[i].get_id()) {
+				data->failures.increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[RID_Owner] Thread safe lookups while other RIDs are allocated and freed") {
+	RIDOwnerThreadData data;
+	for (int i = 0; i < 64; i++) {
+		RID rid = data.owner.allocate_rid();
+		data.owner.initialize_rid(rid, rid.get_id());
+		data.stable_rids.push_back(rid);
+	}
+
+	Thread readers[4];
+	for (int i = 0; i < 4; i++) {
+		readers[i].start(_rid_owner_reader, &data);
+	}
+
+	// Grows the chunk tables many times while the readers look up the stable RIDs.
+	LocalVector<RID> transient;
+	for (int i = 0; i < 20000; i++) {
+		RID rid = data.owner.allocate_rid();
+		data.owner.initialize_rid(rid, rid.get_id());
+		transient.push_back(rid);
+		if (i % 3 == 0) {
+			data.owner.free(transient[transient.size() / 2]);
+			transient.remove_at_unordered(transient.size() / 2);
+		}
+	}
+
+	data.done.set();
+	for (int i = 0; i < 4; i++) {
+		readers[i].wait_to_finish();
+	}
+
+	CHECK(data.failures.get() == 0);
+	for (uint32_t i = 0; i < transient.size(); i++) {
+		CHECK(*data.owner.get_or_null(transient[i]) == transient[i].get_id());
+		data.owner.free(transient[i]);
+	}
+	for (uint32_t i = 0; i < data.stable_rids.size(); i++) {
+		data.owner.free(data.stable_rids[i]);
+	}
+}
 } // namespace TestRID
 
 #endif // TEST_RID_H
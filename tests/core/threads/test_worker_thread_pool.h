@@ -153,6 +153,77 @@ TEST_CASE("[WorkerThreadPool] Process 256 elements on native task group low prio
 	CHECK(callable_group_counter.get() == count - 1);
 }
 
+struct DependencyTestData {
+	SafeNumeric<uint32_t> *counter = nullptr;
+	SafeNumeric<uint32_t> *order_errors = nullptr;
+	uint32_t expected_before = 0;
+};
+
+static void static_dependency_test(void *p_arg) {
+	DependencyTestData *data = (DependencyTestData *)p_arg;
+	if (data->counter->get() != data->expected_before) {
+		data->order_errors->increment();
+	}
+	data->counter->increment();
+}
+
+static void static_group_increment_test(void *p_arg, uint32_t p_index) {
+	SafeNumeric<uint32_t> *counter = (SafeNumeric<uint32_t> *)p_arg;
+	counter->increment();
+}
+
+TEST_CASE("[WorkerThreadPool] Task with task and group dependencies runs last") {
+	const int count = 64;
+	SafeNumeric<uint32_t> counter;
+	SafeNumeric<uint32_t> order_errors;
+
+	Vector<WorkerThreadPool::TaskID> dependencies;
+	for (int i = 0; i < count / 2; i++) {
+		dependencies.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_test, &counter, true));
+	}
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_group_increment_test, &counter, count / 2, -1, true);
+	dependencies.push_back(group);
+
+	DependencyTestData data;
+	data.counter = &counter;
+	data.order_errors = &order_errors;
+	data.expected_before = count;
+	WorkerThreadPool::TaskID last = WorkerThreadPool::get_singleton()->add_native_task(static_dependency_test, &data, true, String(), dependencies);
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(last);
+
+	CHECK(order_errors.get() == 0);
+	CHECK(counter.get() == count + 1);
+
+	for (int i = 0; i < count / 2; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(dependencies[i]);
+	}
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+}
+
+TEST_CASE("[WorkerThreadPool] Chain of dependent tasks runs in order") {
+	const int count = 32;
+	SafeNumeric<uint32_t> counter;
+	SafeNumeric<uint32_t> order_errors;
+	DependencyTestData data[count];
+	WorkerThreadPool::TaskID tasks[count];
+	for (int i = 0; i < count; i++) {
+		data[i].counter = &counter;
+		data[i].order_errors = &order_errors;
+		data[i].expected_before = i;
+		Vector<WorkerThreadPool::TaskID> dependencies;
+		if (i > 0) {
+			dependencies.push_back(tasks[i - 1]);
+		}
+		tasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_dependency_test, &data[i], true, String(), dependencies);
+	}
+	for (int i = count - 1; i >= 0; i--) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+	}
+
+	CHECK(order_errors.get() == 0);
+	CHECK(counter.get() == count);
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
@@ -109,6 +109,41 @@ TEST_CASE("[Array] resize(), insert(), and erase()") {
 	CHECK(int(arr[0]) == 1);
 }
 
+TEST_CASE("[Array] Typed arrays") {
+	Array arr;
+	arr.set_typed(Variant::STRING, StringName(), Variant());
+	arr.push_back("a");
+	arr.push_back(StringName("b"));
+	arr.insert(0, StringName("c"));
+	arr.set(1, StringName("d"));
+	CHECK(arr.size() == 3);
+	for (int i = 0; i < arr.size(); i++) {
+		CHECK(arr[i].get_type() == Variant::STRING);
+	}
+	CHECK(arr[0] == "c");
+	CHECK(arr[1] == "d");
+
+	ERR_PRINT_OFF;
+	arr.push_back(1);
+	arr.set(0, 1);
+	ERR_PRINT_ON;
+	CHECK(arr.size() == 3);
+	CHECK(arr[0] == "c");
+
+	Array other;
+	other.set_typed(Variant::STRING, StringName(), Variant());
+	other.push_back("e");
+	arr.append_array(other);
+	CHECK(arr.size() == 4);
+	CHECK(arr[3] == "e");
+
+	Array untyped = build_array(1, StringName("f"));
+	ERR_PRINT_OFF;
+	arr.append_array(untyped);
+	ERR_PRINT_ON;
+	CHECK(arr.size() == 4);
+}
+
 TEST_CASE("[Array] front() and back()") {
 	Array arr;
 	arr.push_back(1);
@@ -126,6 +126,48 @@ TEST_CASE("[Variant] Writer and parser Variant::FLOAT") {
 	CHECK_MESSAGE(float_parsed == 1.0e+100, "Should match the double literal.");
 }
 
+TEST_CASE("[Variant] Parser numbers and packed arrays") {
+	String errs;
+	int line = 0;
+	Variant parsed;
+	VariantParser::StreamString ss;
+
+	ss.s = "PackedFloat64Array(0.1, -2.5, 1e-5, 0.000123, 123456.789, -0.0, 3.14159265358979, 1.5e300, 7)";
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	const PackedFloat64Array doubles = parsed;
+	REQUIRE(doubles.size() == 9);
+	CHECK(doubles[0] == 0.1);
+	CHECK(doubles[1] == -2.5);
+	CHECK(doubles[2] == 1e-5);
+	CHECK(doubles[3] == 0.000123);
+	CHECK(doubles[4] == 123456.789);
+	CHECK(doubles[5] == 0.0);
+	CHECK(doubles[6] == 3.14159265358979);
+	CHECK(doubles[7] == 1.5e300);
+	CHECK(doubles[8] == 7.0);
+
+	ss = VariantParser::StreamString();
+	ss.s = "PackedInt64Array(0, -1, 42, 9007199254740993, -9223372036854775807)";
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	const PackedInt64Array ints = parsed;
+	REQUIRE(ints.size() == 5);
+	CHECK(ints[0] == 0);
+	CHECK(ints[1] == -1);
+	CHECK(ints[2] == 42);
+	CHECK(ints[3] == 9007199254740993);
+	CHECK(ints[4] == -9223372036854775807);
+
+	ss = VariantParser::StreamString();
+	ss.s = "PackedVector3Array(1, 2, 3, -0.5, 0.25, inf)";
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	const PackedVector3Array vectors = parsed;
+	REQUIRE(vectors.size() == 2);
+	CHECK(vectors[0] == Vector3(1, 2, 3));
+	CHECK(vectors[1].x == -0.5);
+	CHECK(vectors[1].y == 0.25);
+	CHECK(Math::is_inf(vectors[1].z));
+}
+
 TEST_CASE("[Variant] Assignment To Bool from Int,Float,String,Vec2,Vec2i,Vec3,Vec3i and Color") {
 	Variant int_v = 0;
 	Variant bool_v = true;
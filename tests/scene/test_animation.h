@@ -309,6 +309,43 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Sampling with track cursors") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(2.0);
+	const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track_index, NodePath("Enemy:position"));
+	for (int i = 0; i <= 20; i++) {
+		animation->position_track_insert_key(track_index, i * 0.1, Vector3(i, i * i * 0.1, -i));
+	}
+
+	// A cursor must never change the result, whether sampling moves forward, jumps back or stays still.
+	const double times[] = { 0.0, 0.05, 0.1, 0.15, 0.15, 0.42, 1.0, 0.3, 1.95, 2.0, 2.5, 0.0, -0.5, 0.7 };
+
+	SUBCASE("Uncompressed") {
+		Animation::TrackSampleCursor cursor;
+		for (const double time : times) {
+			Vector3 expected;
+			Vector3 sampled;
+			CHECK(animation->position_track_interpolate(track_index, time, &expected) == OK);
+			CHECK(animation->position_track_interpolate(track_index, time, &sampled, &cursor) == OK);
+			CHECK(sampled.is_equal_approx(expected));
+		}
+	}
+
+	SUBCASE("Compressed") {
+		animation->compress(128); // Small pages, so the cursor also has to move between them.
+		CHECK(animation->track_is_compressed(track_index));
+		Animation::TrackSampleCursor cursor;
+		for (const double time : times) {
+			Vector3 expected;
+			Vector3 sampled;
+			CHECK(animation->position_track_interpolate(track_index, time, &expected) == OK);
+			CHECK(animation->position_track_interpolate(track_index, time, &sampled, &cursor) == OK);
+			CHECK(sampled.is_equal_approx(expected));
+		}
+	}
+}
+
 } // namespace TestAnimation
 
 #endif // TEST_ANIMATION_H
@@ -316,6 +316,87 @@ TEST_CASE("[SceneTree][ArrayMesh] Get/Set mesh metadata and actions") {
 	}
 }
 
+TEST_CASE("[ArrayMesh] Compressed UVs") {
+	Vector<Vector3> vertices;
+	vertices.push_back(Vector3(0, 0, 0));
+	vertices.push_back(Vector3(1, 0, 0));
+	vertices.push_back(Vector3(0, 1, 0));
+	Vector<Vector2> uvs;
+	uvs.push_back(Vector2(0, 0));
+	uvs.push_back(Vector2(0.25, 1));
+	uvs.push_back(Vector2(0.5, 0.75));
+
+	Array arrays;
+	arrays.resize(RS::ARRAY_MAX);
+	arrays[RS::ARRAY_VERTEX] = vertices;
+	arrays[RS::ARRAY_TEX_UV] = uvs;
+	arrays[RS::ARRAY_TEX_UV2] = uvs;
+
+	RS::SurfaceData uncompressed;
+	REQUIRE(RS::get_singleton()->mesh_create_surface_data_from_arrays(&uncompressed, RS::PRIMITIVE_TRIANGLES, arrays) == OK);
+	RS::SurfaceData compressed;
+	REQUIRE(RS::get_singleton()->mesh_create_surface_data_from_arrays(&compressed, RS::PRIMITIVE_TRIANGLES, arrays, Array(), Dictionary(), RS::ARRAY_FLAG_COMPRESS_UVS) == OK);
+
+	CHECK((compressed.format & RS::ARRAY_FLAG_COMPRESS_UVS) != 0);
+	CHECK(compressed.attribute_data.size() * 2 == uncompressed.attribute_data.size());
+
+	Array result = RS::get_singleton()->mesh_create_arrays_from_surface_data(compressed);
+	Vector<Vector2> result_uvs = result[RS::ARRAY_TEX_UV];
+	Vector<Vector2> result_uv2s = result[RS::ARRAY_TEX_UV2];
+	REQUIRE(result_uvs.size() == uvs.size());
+	REQUIRE(result_uv2s.size() == uvs.size());
+	for (int i = 0; i < uvs.size(); i++) {
+		// These values are exactly representable as half floats.
+		CHECK(result_uvs[i] == uvs[i]);
+		CHECK(result_uv2s[i] == uvs[i]);
+	}
+}
+
+TEST_CASE("[Mesh] Convex decomposition cache") {
+	Vector<Vector3> vertices;
+	vertices.push_back(Vector3(0, 0, 0));
+	vertices.push_back(Vector3(1, 0, 0));
+	vertices.push_back(Vector3(0, 1, 0));
+	Vector<uint32_t> indices;
+	indices.push_back(0);
+	indices.push_back(1);
+	indices.push_back(2);
+	Mesh::ConvexDecompositionSettings settings;
+
+	const String key = Mesh::ConvexDecompositionCache::make_key(vertices, indices, settings);
+	CHECK(key == Mesh::ConvexDecompositionCache::make_key(vertices, indices, settings));
+
+	Mesh::ConvexDecompositionSettings other_settings;
+	other_settings.max_convex_hulls = 4;
+	CHECK(key != Mesh::ConvexDecompositionCache::make_key(vertices, indices, other_settings));
+	vertices.write[2] = Vector3(0, 2, 0);
+	CHECK(key != Mesh::ConvexDecompositionCache::make_key(vertices, indices, settings));
+
+	Vector<Vector<Vector3>> hulls;
+	hulls.push_back(vertices);
+
+	Mesh::ConvexDecompositionCache cache;
+	Vector<Vector<Vector3>> found;
+	CHECK_FALSE(cache.lookup(key, found));
+	cache.store(key, hulls);
+	CHECK(cache.lookup(key, found));
+	CHECK(found == hulls);
+
+	const String path = OS::get_singleton()->get_cache_path().path_join("convex_decomposition.cache");
+	CHECK(cache.save(path) == OK);
+
+	Mesh::ConvexDecompositionCache loaded;
+	CHECK(loaded.load(path) == OK);
+	CHECK(loaded.lookup(key, found));
+	CHECK(found == hulls);
+
+	// Nothing was used since loading, so saving drops the file.
+	Mesh::ConvexDecompositionCache unused;
+	CHECK(unused.load(path) == OK);
+	CHECK(unused.save(path) == OK);
+	CHECK_FALSE(FileAccess::exists(path));
+}
+
 } // namespace TestArrayMesh
 
 #endif // TEST_ARRAYMESH_H
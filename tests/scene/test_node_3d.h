@@ -0,0 +1,100 @@
+/*************************************************************************/
+/*  test_node_3d.h                                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_NODE_3D_H
+#define TEST_NODE_3D_H
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+TEST_CASE("[SceneTree][Node3D] Global transform follows repeated parent changes") {
+	Node3D *parent = memnew(Node3D);
+	Node3D *child = memnew(Node3D);
+	Node3D *grandchild = memnew(Node3D);
+	parent->add_child(child);
+	child->add_child(grandchild);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	child->set_position(Vector3(0, 1, 0));
+	grandchild->set_position(Vector3(0, 0, 1));
+	CHECK(grandchild->get_global_position().is_equal_approx(Vector3(0, 1, 1)));
+
+	// Several changes without reading the global transform in between.
+	parent->set_position(Vector3(1, 0, 0));
+	parent->set_position(Vector3(2, 0, 0));
+	child->set_position(Vector3(0, 2, 0));
+	parent->set_scale(Vector3(2, 2, 2));
+	CHECK(grandchild->get_global_position().is_equal_approx(Vector3(2, 4, 2)));
+
+	// Reading only the middle node, then changing the root again.
+	CHECK(child->get_global_position().is_equal_approx(Vector3(2, 4, 0)));
+	parent->set_position(Vector3(3, 0, 0));
+	CHECK(grandchild->get_global_position().is_equal_approx(Vector3(3, 4, 2)));
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node3D] Children can leave and rejoin a parent") {
+	Node3D *parent = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	Node3D *children[4];
+	for (int i = 0; i < 4; i++) {
+		children[i] = memnew(Node3D);
+		children[i]->set_position(Vector3(i, 0, 0));
+		parent->add_child(children[i]);
+	}
+
+	parent->set_position(Vector3(0, 5, 0));
+	parent->remove_child(children[1]);
+	parent->set_position(Vector3(0, 6, 0));
+	for (int i = 0; i < 4; i++) {
+		if (i != 1) {
+			CHECK(children[i]->get_global_position().is_equal_approx(Vector3(i, 6, 0)));
+		}
+	}
+
+	parent->add_child(children[1]);
+	parent->set_position(Vector3(0, 7, 0));
+	parent->set_position(Vector3(0, 8, 0));
+	for (int i = 0; i < 4; i++) {
+		CHECK(children[i]->get_global_position().is_equal_approx(Vector3(i, 8, 0)));
+	}
+
+	memdelete(parent);
+}
+
+} // namespace TestNode3D
+
+#endif // TEST_NODE_3D_H
@@ -0,0 +1,93 @@
+/*************************************************************************/
+/*  test_scene_tree_timer.h                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_SCENE_TREE_TIMER_H
+#define TEST_SCENE_TREE_TIMER_H
+
+#include "scene/main/scene_tree.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSceneTreeTimer {
+
+TEST_CASE("[SceneTree][SceneTreeTimer] Timers time out in order") {
+	SceneTree *tree = SceneTree::get_singleton();
+
+	Ref<SceneTreeTimer> late = tree->create_timer(1.0);
+	Ref<SceneTreeTimer> early = tree->create_timer(0.25);
+	Ref<SceneTreeTimer> physics = tree->create_timer(0.25, true, true);
+
+	Array empty_signal_args;
+	empty_signal_args.push_back(Array());
+
+	SIGNAL_WATCH(late.ptr(), "timeout");
+	SIGNAL_WATCH(early.ptr(), "timeout");
+
+	tree->process(0.5);
+	SIGNAL_CHECK("timeout", empty_signal_args);
+	CHECK(early->get_time_left() == doctest::Approx(-0.25));
+	CHECK(late->get_time_left() == doctest::Approx(0.5));
+	CHECK(physics->get_time_left() == doctest::Approx(0.25));
+
+	SUBCASE("Changing the time left reschedules the timer") {
+		late->set_time_left(2.0);
+		tree->process(1.0);
+		CHECK(late->get_time_left() == doctest::Approx(1.0));
+		SIGNAL_CHECK_FALSE("timeout");
+
+		tree->process(1.0);
+		SIGNAL_CHECK("timeout", empty_signal_args);
+	}
+
+	SUBCASE("Timers processed in physics frames ignore idle frames") {
+		tree->process(1.0);
+		CHECK(physics->get_time_left() == doctest::Approx(0.25));
+		tree->physics_process(0.25);
+		CHECK(physics->get_time_left() == doctest::Approx(0.0));
+	}
+
+	SIGNAL_UNWATCH(late.ptr(), "timeout");
+	SIGNAL_UNWATCH(early.ptr(), "timeout");
+}
+
+TEST_CASE("[SceneTree][SceneTreeTimer] Timers nothing refers to are reused") {
+	SceneTree *tree = SceneTree::get_singleton();
+
+	ObjectID id = tree->create_timer(0.1)->get_instance_id();
+	tree->process(0.2);
+
+	Ref<SceneTreeTimer> timer = tree->create_timer(1.0);
+	CHECK(timer->get_instance_id() == id);
+	CHECK(timer->get_time_left() == doctest::Approx(1.0));
+}
+
+} // namespace TestSceneTreeTimer
+
+#endif // TEST_SCENE_TREE_TIMER_H
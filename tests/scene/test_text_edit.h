@@ -582,6 +582,36 @@ TEST_CASE("[SceneTree][TextEdit] text entry") {
 		CHECK(text_edit->get_indent_level(0) == 9);
 	}
 
+	SUBCASE("[TextEdit] lazy shaping") {
+		String long_text;
+		for (int i = 0; i < 10000; i++) {
+			long_text += "line " + itos(i) + "\n";
+		}
+
+		text_edit->set_text(long_text);
+		const int eager_width = text_edit->get_line_width(5000);
+		CHECK(eager_width > 0);
+
+		text_edit->set_lazy_shaping_enabled(true);
+		CHECK(text_edit->is_lazy_shaping_enabled());
+		CHECK(text_edit->get_line_count() == 10001);
+		CHECK(text_edit->get_line_wrap_count(9999) == 0);
+		CHECK(text_edit->get_line_width(5000) == eager_width);
+
+		// Lines are shaped again on use after being freed.
+		for (int i = 0; i < 10000; i++) {
+			CHECK(text_edit->get_line_width(i) > 0);
+		}
+		CHECK(text_edit->get_line_width(5000) == eager_width);
+
+		text_edit->set_line(5000, "line 5000 edited");
+		CHECK(text_edit->get_line_width(5000) > eager_width);
+
+		text_edit->set_lazy_shaping_enabled(false);
+		CHECK(text_edit->get_line_width(5000) > eager_width);
+		text_edit->set_text("");
+	}
+
 	SUBCASE("[TextEdit] selection") {
 		SIGNAL_WATCH(text_edit, "text_set");
 		SIGNAL_WATCH(text_edit, "text_changed");
@@ -31,6 +31,8 @@
 #ifndef TEST_THEME_H
 #define TEST_THEME_H
 
+#include "scene/gui/control.h"
+#include "scene/main/window.h"
 #include "scene/resources/theme.h"
 #include "tests/test_tools.h"
 
@@ -266,6 +268,52 @@ TEST_CASE_FIXTURE(Fixture, "[Theme] Bad theme item names") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Theme][SceneTree] Theme lookups shared between controls") {
+	Ref<Theme> theme = memnew(Theme);
+	theme->set_constant("separation", "Control", 7);
+
+	Control *root = memnew(Control);
+	Control *first = memnew(Control);
+	Control *second = memnew(Control);
+	root->add_child(first);
+	root->add_child(second);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	root->set_theme(theme);
+
+	SUBCASE("Controls with the same theme owner see the same items") {
+		CHECK(first->has_theme_constant("separation"));
+		CHECK(second->has_theme_constant("separation"));
+		CHECK_FALSE(second->has_theme_constant("missing_constant"));
+	}
+
+	SUBCASE("Changing the theme resource invalidates resolved lookups") {
+		CHECK(first->has_theme_constant("separation"));
+		theme->clear_constant("separation", "Control");
+		CHECK_FALSE(first->has_theme_constant("separation"));
+		CHECK_FALSE(second->has_theme_constant("separation"));
+	}
+
+	SUBCASE("Reparenting invalidates resolved lookups") {
+		CHECK(first->has_theme_constant("separation"));
+		root->remove_child(first);
+		SceneTree::get_singleton()->get_root()->add_child(first);
+		CHECK_FALSE(first->has_theme_constant("separation"));
+		CHECK(second->has_theme_constant("separation"));
+	}
+
+	SUBCASE("Type variations are resolved separately") {
+		theme->set_type_variation("CustomControl", "Control");
+		theme->set_constant("separation", "CustomControl", 3);
+		second->set_theme_type_variation("CustomControl");
+		CHECK(first->get_theme_constant("separation") == 7);
+		CHECK(second->get_theme_constant("separation") == 3);
+	}
+
+	memdelete(first);
+	memdelete(second);
+	memdelete(root);
+}
+
 } // namespace TestTheme
 
 #endif // TEST_THEME_H
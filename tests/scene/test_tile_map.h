@@ -0,0 +1,108 @@
+/*************************************************************************/
+/*  test_tile_map.h                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_TILE_MAP_H
+#define TEST_TILE_MAP_H
+
+#include "scene/2d/tile_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTileMap {
+
+TEST_CASE("[SceneTree][TileMap] Setting cells from packed arrays") {
+	TileMap *tile_map = memnew(TileMap);
+
+	PackedInt32Array coords = { 0, 0, 1, 0, -20, 35 };
+	PackedInt32Array source_ids = { 1, 2, 3 };
+	PackedInt32Array atlas_coords = { 0, 1, 2, 3, 4, 5 };
+	PackedInt32Array alternative_tiles = { 0, 1, 2 };
+	tile_map->set_cells_packed(0, coords, source_ids, atlas_coords, alternative_tiles);
+
+	CHECK(tile_map->get_used_cells(0).size() == 3);
+	CHECK(tile_map->get_cell_source_id(0, Vector2i(1, 0)) == 2);
+	CHECK(tile_map->get_cell_atlas_coords(0, Vector2i(1, 0)) == Vector2i(2, 3));
+	CHECK(tile_map->get_cell_alternative_tile(0, Vector2i(-20, 35)) == 2);
+
+	SUBCASE("Invalid values erase cells") {
+		tile_map->set_cells_packed(0, PackedInt32Array({ 0, 0 }), PackedInt32Array({ -1 }), PackedInt32Array({ -1, -1 }), PackedInt32Array({ -1 }));
+		CHECK(tile_map->get_used_cells(0).size() == 2);
+		CHECK(tile_map->get_cell_source_id(0, Vector2i(0, 0)) == TileSet::INVALID_SOURCE);
+	}
+
+	SUBCASE("Mismatched array sizes are refused") {
+		ERR_PRINT_OFF;
+		tile_map->set_cells_packed(0, PackedInt32Array({ 5, 5 }), PackedInt32Array({ 1, 1 }), PackedInt32Array({ 0, 0 }), PackedInt32Array({ 0 }));
+		ERR_PRINT_ON;
+		CHECK(tile_map->get_cell_source_id(0, Vector2i(5, 5)) == TileSet::INVALID_SOURCE);
+	}
+
+	memdelete(tile_map);
+}
+
+TEST_CASE("[SceneTree][TileMap] Filling and copying rects") {
+	TileMap *tile_map = memnew(TileMap);
+	// Spans several quadrants, including negative ones.
+	const Rect2i rect(-20, -3, 45, 37);
+	tile_map->fill_cells(0, rect, 1, Vector2i(2, 3), 0);
+
+	CHECK(tile_map->get_used_cells(0).size() == rect.size.x * rect.size.y);
+	CHECK(tile_map->get_used_rect() == rect);
+	CHECK(tile_map->get_cell_atlas_coords(0, Vector2i(-20, -3)) == Vector2i(2, 3));
+	CHECK(tile_map->get_cell_atlas_coords(0, Vector2i(24, 33)) == Vector2i(2, 3));
+	CHECK(tile_map->get_cell_source_id(0, Vector2i(25, 33)) == TileSet::INVALID_SOURCE);
+
+	SUBCASE("Erasing") {
+		tile_map->fill_cells(0, Rect2i(-20, -3, 45, 36));
+		CHECK(tile_map->get_used_cells(0).size() == rect.size.x);
+	}
+
+	SUBCASE("Overlapping copy") {
+		tile_map->set_cell(0, Vector2i(0, 0), 4, Vector2i(5, 6), 0);
+		tile_map->copy_cells(0, Rect2i(-1, -1, 3, 3), Vector2i(0, 0));
+		CHECK(tile_map->get_cell_source_id(0, Vector2i(1, 1)) == 4);
+		CHECK(tile_map->get_cell_source_id(0, Vector2i(0, 0)) == 1);
+	}
+
+	SUBCASE("Copy to another layer") {
+		tile_map->add_layer(-1);
+		tile_map->copy_cells(0, Rect2i(20, 30, 10, 10), Vector2i(100, 100), 1);
+		// Empty cells are copied too, as nothing.
+		CHECK(tile_map->get_used_cells(1).size() == 5 * 4);
+		CHECK(tile_map->get_cell_source_id(1, Vector2i(104, 103)) == 1);
+		CHECK(tile_map->get_cell_source_id(1, Vector2i(105, 103)) == TileSet::INVALID_SOURCE);
+	}
+
+	memdelete(tile_map);
+}
+
+} // namespace TestTileMap
+
+#endif // TEST_TILE_MAP_H
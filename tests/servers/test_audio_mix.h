@@ -0,0 +1,120 @@
+/*************************************************************************/
+/*  test_audio_mix.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_AUDIO_MIX_H
+#define TEST_AUDIO_MIX_H
+
+#include "core/templates/local_vector.h"
+#include "servers/audio/audio_mix.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioMix {
+
+// Odd on purpose, so the scalar tail after the vector loops is exercised too.
+constexpr uint32_t FRAMES = 37;
+
+static void fill_frames(LocalVector<AudioFrame> &r_frames, float p_seed) {
+	r_frames.resize(FRAMES);
+	for (uint32_t i = 0; i < FRAMES; i++) {
+		r_frames[i] = AudioFrame(Math::sin(p_seed + i * 0.37f), Math::cos(p_seed - i * 0.61f));
+	}
+}
+
+TEST_CASE("[AudioMix] Mix with volume ramp") {
+	LocalVector<AudioFrame> src;
+	LocalVector<AudioFrame> dst;
+	fill_frames(src, 0.5f);
+	fill_frames(dst, 2.0f);
+	LocalVector<AudioFrame> expected = dst;
+
+	const AudioFrame vol_start(0.25f, 1.0f);
+	const AudioFrame vol_final(0.75f, 0.0f);
+	for (uint32_t i = 0; i < FRAMES; i++) {
+		float lerp_param = float(i) / FRAMES;
+		expected[i] += (vol_final * lerp_param + (1 - lerp_param) * vol_start) * src[i];
+	}
+
+	AudioMix::mix_ramp(dst.ptr(), src.ptr(), vol_start, vol_final, FRAMES);
+
+	for (uint32_t i = 0; i < FRAMES; i++) {
+		CHECK(dst[i].l == doctest::Approx(expected[i].l));
+		CHECK(dst[i].r == doctest::Approx(expected[i].r));
+	}
+}
+
+TEST_CASE("[AudioMix] Accumulate") {
+	LocalVector<AudioFrame> src;
+	LocalVector<AudioFrame> dst;
+	fill_frames(src, 1.0f);
+	fill_frames(dst, 3.0f);
+	LocalVector<AudioFrame> expected = dst;
+	for (uint32_t i = 0; i < FRAMES; i++) {
+		expected[i] += src[i];
+	}
+
+	AudioMix::mix(dst.ptr(), src.ptr(), FRAMES);
+
+	for (uint32_t i = 0; i < FRAMES; i++) {
+		CHECK(dst[i].l == expected[i].l);
+		CHECK(dst[i].r == expected[i].r);
+	}
+}
+
+TEST_CASE("[AudioMix] Scale and peak") {
+	LocalVector<AudioFrame> buf;
+	fill_frames(buf, 0.0f);
+	// Put the loudest samples in the scalar tail and in the odd frame of a vector pair.
+	buf[FRAMES - 1].l = -4.0f;
+	buf[5].r = 3.0f;
+
+	const AudioFrame peak = AudioMix::scale_and_peak(buf.ptr(), 0.5f, FRAMES);
+
+	CHECK(peak.l == doctest::Approx(2.0f));
+	CHECK(peak.r == doctest::Approx(1.5f));
+	CHECK(buf[FRAMES - 1].l == doctest::Approx(-2.0f));
+	CHECK(buf[5].r == doctest::Approx(1.5f));
+}
+
+TEST_CASE("[AudioMix] Clear") {
+	LocalVector<AudioFrame> buf;
+	fill_frames(buf, 1.0f);
+
+	AudioMix::clear(buf.ptr(), FRAMES);
+
+	for (uint32_t i = 0; i < FRAMES; i++) {
+		CHECK(buf[i].l == 0.0f);
+		CHECK(buf[i].r == 0.0f);
+	}
+}
+
+} // namespace TestAudioMix
+
+#endif // TEST_AUDIO_MIX_H
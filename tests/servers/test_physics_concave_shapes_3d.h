@@ -0,0 +1,143 @@
+/*************************************************************************/
+/*  test_physics_concave_shapes_3d.h                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PHYSICS_CONCAVE_SHAPES_3D_H
+#define TEST_PHYSICS_CONCAVE_SHAPES_3D_H
+
+#include "core/templates/local_vector.h"
+#include "servers/physics_3d/godot_shape_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsConcaveShapes3D {
+
+static bool collect_face(void *p_userdata, GodotShape3D *p_convex) {
+	LocalVector<Face3> *faces = static_cast<LocalVector<Face3> *>(p_userdata);
+	const GodotFaceShape3D *face = static_cast<GodotFaceShape3D *>(p_convex);
+	faces->push_back(Face3(face->vertex[0], face->vertex[1], face->vertex[2]));
+	return false;
+}
+
+static bool has_face(const LocalVector<Face3> &p_faces, const Face3 &p_face) {
+	for (uint32_t i = 0; i < p_faces.size(); i++) {
+		if (p_faces[i].vertex[0].is_equal_approx(p_face.vertex[0]) && p_faces[i].vertex[1].is_equal_approx(p_face.vertex[1]) && p_faces[i].vertex[2].is_equal_approx(p_face.vertex[2])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+TEST_CASE("[Physics][ConcavePolygonShape3D] Culling finds every overlapping face") {
+	// A bumpy 20x20 grid of quads, enough faces for several BVH levels.
+	PackedVector3Array vertices;
+	for (int z = 0; z < 20; z++) {
+		for (int x = 0; x < 20; x++) {
+			Vector3 p00(x, Math::sin(x * 0.7) * Math::cos(z * 0.3), z);
+			Vector3 p10(x + 1, Math::sin((x + 1) * 0.7) * Math::cos(z * 0.3), z);
+			Vector3 p01(x, Math::sin(x * 0.7) * Math::cos((z + 1) * 0.3), z + 1);
+			vertices.push_back(p00);
+			vertices.push_back(p10);
+			vertices.push_back(p01);
+		}
+	}
+
+	GodotConcavePolygonShape3D shape;
+	Dictionary data;
+	data["faces"] = vertices;
+	data["backface_collision"] = false;
+	shape.set_data(data);
+
+	const AABB queries[] = { AABB(Vector3(3.2, -0.5, 4.1), Vector3(2.5, 1.0, 1.7)), AABB(Vector3(-1, -2, -1), Vector3(30, 4, 30)), AABB(Vector3(12.5, 0.9, 12.5), Vector3(0.1, 0.1, 0.1)) };
+	for (const AABB &query : queries) {
+		LocalVector<Face3> found;
+		shape.cull(query, collect_face, &found, false);
+
+		int expected = 0;
+		for (int i = 0; i < vertices.size(); i += 3) {
+			Face3 face(vertices[i], vertices[i + 1], vertices[i + 2]);
+			if (face.get_aabb().intersects_inclusive(query)) {
+				expected++;
+				CHECK(has_face(found, face));
+			}
+		}
+		CHECK(int(found.size()) >= expected);
+	}
+
+	LocalVector<Face3> found;
+	shape.cull(AABB(Vector3(50, 0, 50), Vector3(1, 1, 1)), collect_face, &found, false);
+	CHECK(found.size() == 0);
+}
+
+TEST_CASE("[Physics][HeightMapShape3D] Culling skips cells outside the query height") {
+	// A 100x100 ramp, larger than one bounds chunk so the quadtree is used.
+	const int size = 100;
+	PackedFloat32Array heights;
+	heights.resize(size * size);
+	for (int z = 0; z < size; z++) {
+		for (int x = 0; x < size; x++) {
+			heights.set(z * size + x, x * 0.5);
+		}
+	}
+
+	GodotHeightMapShape3D shape;
+	Dictionary data;
+	data["width"] = size;
+	data["depth"] = size;
+	data["heights"] = heights;
+	data["min_height"] = 0.0;
+	data["max_height"] = (size - 1) * 0.5;
+	shape.set_data(data);
+
+	// The shape is centered, so x = 0 is the middle of the ramp.
+	LocalVector<Face3> all_heights;
+	shape.cull(AABB(Vector3(-40, -100, -5), Vector3(80, 200, 10)), collect_face, &all_heights, false);
+
+	const AABB query(Vector3(-40, 20, -5), Vector3(80, 2, 10));
+	LocalVector<Face3> found;
+	shape.cull(query, collect_face, &found, false);
+
+	CHECK(found.size() > 0);
+	CHECK(found.size() < all_heights.size());
+	for (uint32_t i = 0; i < found.size(); i++) {
+		AABB face_aabb = found[i].get_aabb();
+		CHECK(face_aabb.position.y <= query.position.y + query.size.y);
+		CHECK(face_aabb.position.y + face_aabb.size.y >= query.position.y);
+	}
+	for (uint32_t i = 0; i < all_heights.size(); i++) {
+		AABB face_aabb = all_heights[i].get_aabb();
+		if (face_aabb.position.y <= query.position.y + query.size.y && face_aabb.position.y + face_aabb.size.y >= query.position.y) {
+			CHECK(has_face(found, all_heights[i]));
+		}
+	}
+}
+
+} // namespace TestPhysicsConcaveShapes3D
+
+#endif // TEST_PHYSICS_CONCAVE_SHAPES_3D_H
@@ -0,0 +1,104 @@
+/*************************************************************************/
+/*  test_physics_snapshot.h                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PHYSICS_SNAPSHOT_H
+#define TEST_PHYSICS_SNAPSHOT_H
+
+#include "servers/physics_snapshot.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsSnapshot {
+
+TEST_CASE("[Physics][Snapshot] Round trip") {
+	const Transform3D transform_3d(Basis(Vector3(0, 1, 0), 0.5), Vector3(1, 2, 3));
+	const Transform2D transform_2d(0.25, Vector2(-4, 5));
+
+	PhysicsSnapshotWriter writer;
+	writer.put_u32(0xDEADBEEF);
+	writer.put_u64(0x0123456789ABCDEF);
+	writer.put_real(1.5);
+	writer.put_vector2(Vector2(6, 7));
+	writer.put_vector3(Vector3(8, 9, 10));
+	writer.put_transform_2d(transform_2d);
+	writer.put_transform_3d(transform_3d);
+
+	Vector<uint8_t> data = writer.get_data();
+	CHECK(data.size() == writer.get_position());
+
+	PhysicsSnapshotReader reader(data.ptr(), data.size());
+	CHECK(reader.get_u32() == 0xDEADBEEF);
+	CHECK(reader.get_u64() == 0x0123456789ABCDEF);
+	CHECK(reader.get_real() == 1.5);
+	CHECK(reader.get_vector2() == Vector2(6, 7));
+	CHECK(reader.get_vector3() == Vector3(8, 9, 10));
+	CHECK(reader.get_transform_2d() == transform_2d);
+	CHECK(reader.get_transform_3d() == transform_3d);
+	CHECK_FALSE(reader.has_overflowed());
+	CHECK(reader.get_position() == (uint32_t)data.size());
+}
+
+TEST_CASE("[Physics][Snapshot] Reserved sizes and truncation") {
+	PhysicsSnapshotWriter writer;
+	uint32_t size_position = writer.get_position();
+	writer.put_u32(0);
+	writer.put_u64(42);
+	writer.set_u32(size_position, writer.get_position() - size_position - 4);
+
+	uint32_t record_position = writer.get_position();
+	writer.put_u32(7);
+	writer.truncate(record_position);
+
+	Vector<uint8_t> data = writer.get_data();
+	CHECK(data.size() == 12);
+
+	PhysicsSnapshotReader reader(data.ptr(), data.size());
+	CHECK(reader.get_u32() == 8);
+	CHECK(reader.get_u64() == 42);
+	CHECK_FALSE(reader.has_overflowed());
+}
+
+TEST_CASE("[Physics][Snapshot] Reading past the end") {
+	const uint8_t data[6] = {};
+	PhysicsSnapshotReader reader(data, 6);
+	CHECK(reader.get_u32() == 0);
+	CHECK_FALSE(reader.has_overflowed());
+	CHECK(reader.get_u32() == 0);
+	CHECK(reader.has_overflowed());
+	CHECK(reader.get_u64() == 0);
+
+	PhysicsSnapshotReader seeking(data, 6);
+	seeking.seek(7);
+	CHECK(seeking.has_overflowed());
+}
+
+} // namespace TestPhysicsSnapshot
+
+#endif // TEST_PHYSICS_SNAPSHOT_H
@@ -0,0 +1,109 @@
+/*************************************************************************/
+/*  test_physics_vertex_array_3d.h                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PHYSICS_VERTEX_ARRAY_3D_H
+#define TEST_PHYSICS_VERTEX_ARRAY_3D_H
+
+#include "core/templates/local_vector.h"
+#include "servers/physics_3d/godot_shape_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsVertexArray3D {
+
+// Not a multiple of four, so the padding and the scalar tail are exercised.
+constexpr uint32_t VERTEX_COUNT = 37;
+
+static void fill_vertices(LocalVector<Vector3> &r_vertices) {
+	r_vertices.resize(VERTEX_COUNT);
+	for (uint32_t i = 0; i < VERTEX_COUNT; i++) {
+		r_vertices[i] = Vector3(Math::sin(i * 0.37f), Math::cos(i * 0.61f), Math::sin(1.0f + i * 1.13f)) * 2.0f;
+	}
+}
+
+TEST_CASE("[Physics][VertexArray3D] Support matches a linear scan") {
+	LocalVector<Vector3> vertices;
+	fill_vertices(vertices);
+	GodotVertexArray3D array;
+	array.set(vertices.ptr(), vertices.size());
+
+	const Vector3 directions[] = { Vector3(1, 0, 0), Vector3(0, -1, 0), Vector3(0.3, 0.4, -0.5), Vector3(-1, -1, 1).normalized() };
+	for (const Vector3 &dir : directions) {
+		uint32_t expected = 0;
+		for (uint32_t i = 1; i < VERTEX_COUNT; i++) {
+			if (dir.dot(vertices[i]) > dir.dot(vertices[expected])) {
+				expected = i;
+			}
+		}
+
+		real_t max_support = 0.0;
+		CHECK(array.find_support(dir, max_support) == expected);
+		CHECK(max_support == doctest::Approx(dir.dot(vertices[expected])));
+	}
+}
+
+TEST_CASE("[Physics][VertexArray3D] Ties resolve to the lowest index") {
+	LocalVector<Vector3> vertices;
+	vertices.resize(VERTEX_COUNT);
+	for (uint32_t i = 0; i < VERTEX_COUNT; i++) {
+		vertices[i] = Vector3(i == 5 || i == 22 ? 1.0 : 0.0, real_t(i), 0.0);
+	}
+	GodotVertexArray3D array;
+	array.set(vertices.ptr(), vertices.size());
+
+	real_t max_support = 0.0;
+	CHECK(array.find_support(Vector3(1, 0, 0), max_support) == 5);
+	CHECK(max_support == doctest::Approx(1.0));
+}
+
+TEST_CASE("[Physics][VertexArray3D] Projection range") {
+	LocalVector<Vector3> vertices;
+	fill_vertices(vertices);
+	GodotVertexArray3D array;
+	array.set(vertices.ptr(), vertices.size());
+
+	const Vector3 dir = Vector3(0.2, -0.7, 0.4);
+	real_t expected_min = dir.dot(vertices[0]);
+	real_t expected_max = expected_min;
+	for (uint32_t i = 1; i < VERTEX_COUNT; i++) {
+		expected_min = MIN(expected_min, dir.dot(vertices[i]));
+		expected_max = MAX(expected_max, dir.dot(vertices[i]));
+	}
+
+	real_t r_min = 0.0;
+	real_t r_max = 0.0;
+	array.project_range(dir, r_min, r_max);
+	CHECK(r_min == doctest::Approx(expected_min));
+	CHECK(r_max == doctest::Approx(expected_max));
+}
+
+} // namespace TestPhysicsVertexArray3D
+
+#endif // TEST_PHYSICS_VERTEX_ARRAY_3D_H
@@ -112,6 +112,58 @@ TEST_SUITE("[TextServer]") {
 			}
 		}
 
+		SUBCASE("[TextServer] Text layout: Shaping cache") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC) || !ts->has_method("shaping_cache_get_stats")) {
+					continue;
+				}
+
+				RID font1 = ts->create_font();
+				ts->font_set_data_ptr(font1, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_set_allow_system_fallback(font1, false);
+
+				Array font;
+				font.push_back(font1);
+
+				String test = U"Inventory row 42";
+
+				RID ctx1 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx1, test, font, 16);
+				const Glyph *glyphs1 = ts->shaped_text_get_glyphs(ctx1);
+				int gl_size1 = ts->shaped_text_get_glyph_count(ctx1);
+				CHECK_FALSE_MESSAGE(gl_size1 == 0, "Shaping failed");
+
+				int64_t hits = Dictionary(ts->call("shaping_cache_get_stats"))["hits"];
+
+				RID ctx2 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx2, test, font, 16);
+				const Glyph *glyphs2 = ts->shaped_text_get_glyphs(ctx2);
+				int gl_size2 = ts->shaped_text_get_glyph_count(ctx2);
+
+				CHECK_MESSAGE(int64_t(Dictionary(ts->call("shaping_cache_get_stats"))["hits"]) > hits, "Identical text was not served from the shaping cache.");
+				CHECK_FALSE_MESSAGE(gl_size1 != gl_size2, "Cached shaping produced a different glyph count.");
+				for (int j = 0; j < MIN(gl_size1, gl_size2); j++) {
+					CHECK_FALSE_MESSAGE(glyphs1[j].index != glyphs2[j].index, "Cached shaping produced different glyphs.");
+					CHECK_FALSE_MESSAGE(glyphs1[j].start != glyphs2[j].start || glyphs1[j].end != glyphs2[j].end, "Cached shaping produced different glyph ranges.");
+					CHECK_FALSE_MESSAGE(glyphs1[j].advance != glyphs2[j].advance, "Cached shaping produced different advances.");
+				}
+
+				ts->free_rid(ctx1);
+				ts->free_rid(ctx2);
+
+				ts->call("shaping_cache_clear");
+				CHECK_FALSE_MESSAGE(int64_t(Dictionary(ts->call("shaping_cache_get_stats"))["entries"]) != 0, "Shaping cache was not cleared.");
+
+				for (int j = 0; j < font.size(); j++) {
+					ts->free_rid(font[j]);
+				}
+				font.clear();
+			}
+		}
+
 		SUBCASE("[TextServer] Text layout: BiDi") {
 			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
 				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
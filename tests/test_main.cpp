@@ -30,8 +30,10 @@
 
 #include "test_main.h"
 
+#include "tests/core/debugger/test_trace_profiler.h"
 #include "tests/core/input/test_input_event_key.h"
 #include "tests/core/input/test_shortcut.h"
+#include "tests/core/io/test_compact_variant.h"
 #include "tests/core/io/test_config_file.h"
 #include "tests/core/io/test_file_access.h"
 #include "tests/core/io/test_image.h"
@@ -48,6 +50,7 @@
 #include "tests/core/math/test_geometry_2d.h"
 #include "tests/core/math/test_geometry_3d.h"
 #include "tests/core/math/test_math_funcs.h"
+#include "tests/core/math/test_packed_array_math.h"
 #include "tests/core/math/test_plane.h"
 #include "tests/core/math/test_quaternion.h"
 #include "tests/core/math/test_random_number_generator.h"
@@ -62,8 +65,10 @@
 #include "tests/core/math/test_vector4.h"
 #include "tests/core/math/test_vector4i.h"
 #include "tests/core/object/test_class_db.h"
+#include "tests/core/object/test_message_queue.h"
 #include "tests/core/object/test_method_bind.h"
 #include "tests/core/object/test_object.h"
+#include "tests/core/os/test_memory.h"
 #include "tests/core/os/test_os.h"
 #include "tests/core/string/test_node_path.h"
 #include "tests/core/string/test_string.h"
@@ -91,12 +96,19 @@
 #include "tests/scene/test_code_edit.h"
 #include "tests/scene/test_curve.h"
 #include "tests/scene/test_gradient.h"
+#include "tests/scene/test_node_3d.h"
 #include "tests/scene/test_path_2d.h"
 #include "tests/scene/test_path_3d.h"
 #include "tests/scene/test_primitives.h"
+#include "tests/scene/test_scene_tree_timer.h"
 #include "tests/scene/test_sprite_frames.h"
 #include "tests/scene/test_text_edit.h"
 #include "tests/scene/test_theme.h"
+#include "tests/scene/test_tile_map.h"
+#include "tests/servers/test_audio_mix.h"
+#include "tests/servers/test_physics_concave_shapes_3d.h"
+#include "tests/servers/test_physics_snapshot.h"
+#include "tests/servers/test_physics_vertex_array_3d.h"
 #include "tests/servers/test_text_server.h"
 #include "tests/test_validate_testing.h"
 
@@ -104,6 +116,13 @@
 
 #include "tests/test_macros.h"
 
+#ifdef BENCHMARKS_ENABLED
+#include "tests/benchmarks/benchmark.h"
+
+// Usage: `godot --test benchmark`, see run_benchmarks() for the options.
+REGISTER_TEST_COMMAND("benchmark", &run_benchmarks);
+#endif
+
 #include "scene/theme/theme_db.h"
 #include "servers/navigation_server_2d.h"
 #include "servers/navigation_server_3d.h"
@@ -403,7 +403,9 @@ namespace RVO {
 		for (size_t i = beginPlane; i < planes.size(); ++i) {
 			if (planes[i].normal * (planes[i].point - result) > distance) {
 				/* Result does not satisfy constraint of plane i. */
-				std::vector<Plane> projPlanes;
+				// Reused to avoid allocating for every failing plane, agents are computed in parallel.
+				static thread_local std::vector<Plane> projPlanes;
+				projPlanes.clear();
 
 				for (size_t j = 0; j < i; ++j) {
 					Plane plane;
@@ -50,6 +50,7 @@
 // - The compute velocity function now need the timeStep.
 // - Moved the `Plane` class here.
 // - Added a new parameter `ignore_y_` in the `Agent`. This parameter is used to control a godot feature that allows to avoid collisions by moving on the horizontal plane.
+// - The projected planes of `linearProgram4` are reused between calls.
 namespace RVO {
 	/**
 	 * \brief   Defines a plane.
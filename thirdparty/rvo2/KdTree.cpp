@@ -40,32 +40,49 @@
 namespace RVO {
 	const size_t RVO3D_MAX_LEAF_SIZE = 10;
 
-	KdTree::KdTree() { }
+	KdTree::KdTree() : deferDepth_(0) { }
 
-	void KdTree::buildAgentTree(std::vector<Agent *> agents)
+	void KdTree::buildAgentTree(std::vector<Agent *> &agents, size_t deferDepth)
 	{
 		agents_.swap(agents);
+		deferredNodes_.clear();
+
+		positions_.resize(agents_.size());
+		for (size_t i = 0; i < agents_.size(); ++i) {
+			positions_[i] = agents_[i]->position_;
+		}
 
 		if (!agents_.empty()) {
 			agentTree_.resize(2 * agents_.size() - 1);
+			deferDepth_ = deferDepth;
 			buildAgentTreeRecursive(0, agents_.size(), 0);
+			deferDepth_ = 0;
 		}
 	}
 
-	void KdTree::buildAgentTreeRecursive(size_t begin, size_t end, size_t node)
+	void KdTree::buildAgentTreeRecursive(size_t begin, size_t end, size_t node, size_t depth)
 	{
+		if (deferDepth_ > 0 && depth == deferDepth_) {
+			DeferredNode deferred;
+			deferred.begin = begin;
+			deferred.end = end;
+			deferred.node = node;
+			deferredNodes_.push_back(deferred);
+			return;
+		}
+
 		agentTree_[node].begin = begin;
 		agentTree_[node].end = end;
-		agentTree_[node].minCoord = agents_[begin]->position_;
-		agentTree_[node].maxCoord = agents_[begin]->position_;
+		agentTree_[node].minCoord = positions_[begin];
+		agentTree_[node].maxCoord = positions_[begin];
 
 		for (size_t i = begin + 1; i < end; ++i) {
-			agentTree_[node].maxCoord[0] = std::max(agentTree_[node].maxCoord[0], agents_[i]->position_.x());
-			agentTree_[node].minCoord[0] = std::min(agentTree_[node].minCoord[0], agents_[i]->position_.x());
-			agentTree_[node].maxCoord[1] = std::max(agentTree_[node].maxCoord[1], agents_[i]->position_.y());
-			agentTree_[node].minCoord[1] = std::min(agentTree_[node].minCoord[1], agents_[i]->position_.y());
-			agentTree_[node].maxCoord[2] = std::max(agentTree_[node].maxCoord[2], agents_[i]->position_.z());
-			agentTree_[node].minCoord[2] = std::min(agentTree_[node].minCoord[2], agents_[i]->position_.z());
+			agentTree_[node].maxCoord[0] = std::max(agentTree_[node].maxCoord[0], positions_[i].x());
+			agentTree_[node].minCoord[0] = std::min(agentTree_[node].minCoord[0], positions_[i].x());
+			agentTree_[node].maxCoord[1] = std::max(agentTree_[node].maxCoord[1], positions_[i].y());
+			agentTree_[node].minCoord[1] = std::min(agentTree_[node].minCoord[1], positions_[i].y());
+			agentTree_[node].maxCoord[2] = std::max(agentTree_[node].maxCoord[2], positions_[i].z());
+			agentTree_[node].minCoord[2] = std::min(agentTree_[node].minCoord[2], positions_[i].z());
 		}
 
 		if (end - begin > RVO3D_MAX_LEAF_SIZE) {
@@ -89,16 +106,17 @@ namespace RVO {
 			size_t right = end;
 
 			while (left < right) {
-				while (left < right && agents_[left]->position_[coord] < splitValue) {
+				while (left < right && positions_[left][coord] < splitValue) {
 					++left;
 				}
 
-				while (right > left && agents_[right - 1]->position_[coord] >= splitValue) {
+				while (right > left && positions_[right - 1][coord] >= splitValue) {
 					--right;
 				}
 
 				if (left < right) {
 					std::swap(agents_[left], agents_[right - 1]);
+					std::swap(positions_[left], positions_[right - 1]);
 					++left;
 					--right;
 				}
@@ -115,8 +133,8 @@ namespace RVO {
 			agentTree_[node].left = node + 1;
 			agentTree_[node].right = node + 2 * leftSize;
 
-			buildAgentTreeRecursive(begin, left, agentTree_[node].left);
-			buildAgentTreeRecursive(left, end, agentTree_[node].right);
+			buildAgentTreeRecursive(begin, left, agentTree_[node].left, depth + 1);
+			buildAgentTreeRecursive(left, end, agentTree_[node].right, depth + 1);
 		}
 	}
 
@@ -129,7 +147,10 @@ namespace RVO {
 	{
 		if (agentTree_[node].end - agentTree_[node].begin <= RVO3D_MAX_LEAF_SIZE) {
 			for (size_t i = agentTree_[node].begin; i < agentTree_[node].end; ++i) {
-				agent->insertAgentNeighbor(agents_[i], rangeSq);
+				// Reject the agents out of range using the contiguous positions, before touching the agent itself.
+				if (absSq(agent->position_ - positions_[i]) < rangeSq) {
+					agent->insertAgentNeighbor(agents_[i], rangeSq);
+				}
 			}
 		}
 		else {
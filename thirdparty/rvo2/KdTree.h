@@ -44,6 +44,7 @@
 // Note: Slightly modified to work better with Godot.
 // - Removed `sim_`.
 // - KdTree things are public
+// - Agent positions are also stored in a contiguous array, and subtrees below a given depth can be deferred to be built in parallel.
 namespace RVO {
 	class Agent;
 	class RVOSimulator;
@@ -89,6 +90,16 @@ namespace RVO {
 			Vector3 minCoord;
 		};
 
+		/**
+		 * \brief   A subtree left to be built by buildAgentTreeRecursive.
+		 */
+		class DeferredNode {
+		public:
+			size_t begin;
+			size_t end;
+			size_t node;
+		};
+
 		/**
 		 * \brief   Constructs a <i>k</i>d-tree instance.
 		 * \param   sim  The simulator instance.
@@ -97,10 +108,12 @@ namespace RVO {
 
 		/**
 		 * \brief   Builds an agent <i>k</i>d-tree.
+		 * \param   agents      The agents to build the tree from, swapped with the previous ones.
+		 * \param   deferDepth  If not zero, the subtrees at this depth are only added to deferredNodes_, and need to be built afterwards with buildAgentTreeRecursive.
 		 */
-		void buildAgentTree(std::vector<Agent *> agents);
+		void buildAgentTree(std::vector<Agent *> &agents, size_t deferDepth = 0);
 
-		void buildAgentTreeRecursive(size_t begin, size_t end, size_t node);
+		void buildAgentTreeRecursive(size_t begin, size_t end, size_t node, size_t depth = 0);
 
 		/**
 		 * \brief   Computes the agent neighbors of the specified agent.
@@ -112,7 +125,10 @@ namespace RVO {
 		void queryAgentTreeRecursive(Agent *agent, float &rangeSq, size_t node) const;
 
 		std::vector<Agent *> agents_;
+		std::vector<Vector3> positions_;
 		std::vector<AgentTreeNode> agentTree_;
+		std::vector<DeferredNode> deferredNodes_;
+		size_t deferDepth_;
 
 		friend class Agent;
 		friend class RVOSimulator;